@@ -87,6 +87,19 @@
 
 #define MBEDTLS_MPI_MAX_BITS                              ( 8 * MBEDTLS_MPI_MAX_SIZE )    /**< Maximum number of bits for usable MPIs. */
 
+#if !defined(MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND)
+/*
+ * Bound on the small primes by which mbedtls_mpi_gen_prime() sieves its
+ * candidates before running Miller-Rabin on them. Default: 16384
+ * Minimum value: 3. Maximum value: 65536.
+ *
+ * The table of primes is built on each call to mbedtls_mpi_gen_prime() and
+ * takes about 5 bytes of heap per prime (about 10 kB by default).
+ * A smaller bound uses less memory but leaves more candidates to Miller-Rabin.
+ */
+#define MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND                 16384    /**< Largest small prime used to sieve prime candidates. */
+#endif /* !MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND */
+
 /*
  * When reading from files with mbedtls_mpi_read_file() and writing to files with
  * mbedtls_mpi_write_file() the buffer should have space
@@ -75,6 +75,17 @@
 #error "MBEDTLS_DHM_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_DHM_FIXED_BASE) &&                                  \
+    ( !defined(MBEDTLS_DHM_C) || defined(MBEDTLS_DHM_ALT) )
+#error "MBEDTLS_DHM_FIXED_BASE defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND) &&                      \
+    ( MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND < 3 ||                          \
+      MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND > 65536 )
+#error "MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND must be between 3 and 65536"
+#endif
+
 #if defined(MBEDTLS_CMAC_C) && \
     ( !defined(MBEDTLS_CIPHER_C ) || ( !defined(MBEDTLS_AES_C) && !defined(MBEDTLS_DES_C) ) )
 #error "MBEDTLS_CMAC_C defined, but not all prerequisites"
@@ -125,10 +136,22 @@
 #error "MBEDTLS_ECP_RESTARTABLE defined, but it cannot coexist with an alternative or PSA-based ECP implementation"
 #endif
 
+#if defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW) &&                  \
+    ( !defined(MBEDTLS_ECP_C) ||                                      \
+      ( defined(MBEDTLS_ECP_FIXED_POINT_OPTIM) &&                     \
+        MBEDTLS_ECP_FIXED_POINT_OPTIM != 1 ) )
+#error "MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC) && !defined(MBEDTLS_HMAC_DRBG_C)
 #error "MBEDTLS_ECDSA_DETERMINISTIC defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL) &&                                \
+    ( !defined(MBEDTLS_ECDSA_C) || defined(MBEDTLS_ECDSA_SIGN_ALT) )
+#error "MBEDTLS_ECDSA_NONCE_POOL defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_ECP_C) && ( !defined(MBEDTLS_BIGNUM_C) || (    \
     !defined(MBEDTLS_ECP_DP_SECP192R1_ENABLED) &&                  \
     !defined(MBEDTLS_ECP_DP_SECP224R1_ENABLED) &&                  \
@@ -363,6 +386,16 @@
 #error "MBEDTLS_LMS_PRIVATE requires MBEDTLS_LMS_C"
 #endif
 
+#if defined(MBEDTLS_LMS_KEYGEN_THREADS) &&                             \
+    ( !defined(MBEDTLS_LMS_PRIVATE) ||                                  \
+      !defined(MBEDTLS_THREADING_PTHREAD) )
+#error "MBEDTLS_LMS_KEYGEN_THREADS defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_LMS_KEYGEN_THREADS) && MBEDTLS_LMS_KEYGEN_THREADS < 1
+#error "MBEDTLS_LMS_KEYGEN_THREADS must be at least 1"
+#endif
+
 #if defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C) &&                          \
     ( !defined(MBEDTLS_PLATFORM_C) || !defined(MBEDTLS_PLATFORM_MEMORY) )
 #error "MBEDTLS_MEMORY_BUFFER_ALLOC_C defined, but not all prerequisites"
@@ -376,6 +409,10 @@
 #error "MBEDTLS_MEMORY_DEBUG defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_MPI_MONTMUL_ASM_A64) && !defined(MBEDTLS_MPI_MONTMUL_ASM)
+#error "MBEDTLS_MPI_MONTMUL_ASM_A64 defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_PADLOCK_C) && !defined(MBEDTLS_HAVE_ASM)
 #error "MBEDTLS_PADLOCK_C defined, but not all prerequisites"
 #endif
@@ -625,6 +662,17 @@
 #error "MBEDTLS_PSA_CRYPTO_C defined, but not all prerequisites (missing RNG)"
 #endif
 
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD) &&                     \
+    ( !defined(MBEDTLS_PSA_CRYPTO_C) ||                                 \
+      !defined(MBEDTLS_THREADING_PTHREAD) )
+#error "MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD) &&                     \
+    defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
+#error "MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD is not compatible with MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG"
+#endif
+
 #if defined(MBEDTLS_PSA_CRYPTO_C) && !defined(MBEDTLS_CIPHER_C )
 #error "MBEDTLS_PSA_CRYPTO_C defined, but not all prerequisites"
 #endif
@@ -633,6 +681,14 @@
 #error "MBEDTLS_PSA_CRYPTO_SPM defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_PSA_KEY_SLOT_MAX_COUNT) &&                          \
+    ( ( defined(MBEDTLS_PSA_KEY_SLOT_COUNT) &&                          \
+        MBEDTLS_PSA_KEY_SLOT_MAX_COUNT < MBEDTLS_PSA_KEY_SLOT_COUNT ) || \
+      ( !defined(MBEDTLS_PSA_KEY_SLOT_COUNT) &&                         \
+        MBEDTLS_PSA_KEY_SLOT_MAX_COUNT < 32 ) )
+#error "MBEDTLS_PSA_KEY_SLOT_MAX_COUNT must be at least MBEDTLS_PSA_KEY_SLOT_COUNT"
+#endif
+
 #if defined(MBEDTLS_PSA_CRYPTO_SE_C) &&    \
     ! ( defined(MBEDTLS_PSA_CRYPTO_C) && \
         defined(MBEDTLS_PSA_CRYPTO_STORAGE_C) )
@@ -668,6 +724,11 @@
 #error "MBEDTLS_PSA_INJECT_ENTROPY is not compatible with MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG"
 #endif
 
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE) && \
+    !defined(MBEDTLS_PSA_CRYPTO_C)
+#error "MBEDTLS_PSA_KEY_REPRESENTATION_CACHE defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_PSA_ITS_FILE_C) && \
     !defined(MBEDTLS_FS_IO)
 #error "MBEDTLS_PSA_ITS_FILE_C defined, but not all prerequisites"
@@ -683,6 +744,12 @@
 #error "MBEDTLS_RSA_C defined, but none of the PKCS1 versions enabled"
 #endif
 
+#if defined(MBEDTLS_RSA_GEN_KEY_PARALLEL) &&                          \
+    ( !defined(MBEDTLS_RSA_C) || !defined(MBEDTLS_GENPRIME) ||          \
+      !defined(MBEDTLS_THREADING_PTHREAD) )
+#error "MBEDTLS_RSA_GEN_KEY_PARALLEL defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_X509_RSASSA_PSS_SUPPORT) &&                        \
     ( !defined(MBEDTLS_RSA_C) || !defined(MBEDTLS_PKCS1_V21) )
 #error "MBEDTLS_X509_RSASSA_PSS_SUPPORT defined, but not all prerequisites"
@@ -778,6 +845,24 @@
 #error "MBEDTLS_SHA256_USE_A64_CRYPTO_ONLY defined on non-Aarch64 system"
 #endif
 
+#if defined(MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT)
+#if !defined(MBEDTLS_SHA256_C)
+#error "MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT defined without MBEDTLS_SHA256_C"
+#endif
+#if defined(MBEDTLS_SHA256_ALT) || defined(MBEDTLS_SHA256_PROCESS_ALT)
+#error "MBEDTLS_SHA256_*ALT can't be used with MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT"
+#endif
+#endif
+
+#if defined(MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT)
+#if !defined(MBEDTLS_SHA1_C)
+#error "MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT defined without MBEDTLS_SHA1_C"
+#endif
+#if defined(MBEDTLS_SHA1_ALT) || defined(MBEDTLS_SHA1_PROCESS_ALT)
+#error "MBEDTLS_SHA1_*ALT can't be used with MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT"
+#endif
+#endif
+
 #if defined(MBEDTLS_SSL_PROTO_TLS1_2) && !defined(MBEDTLS_USE_PSA_CRYPTO) && \
     !( defined(MBEDTLS_SHA1_C) || defined(MBEDTLS_SHA256_C) || defined(MBEDTLS_SHA512_C) )
 #error "MBEDTLS_SSL_PROTO_TLS1_2 defined, but not all prerequisites"
@@ -867,6 +952,27 @@
 #error "MBEDTLS_SSL_SRV_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C) &&                              \
+    ( !defined(MBEDTLS_SSL_ASYNC_PRIVATE) || !defined(MBEDTLS_SSL_SRV_C) || \
+      !defined(MBEDTLS_X509_CRT_PARSE_C) ||                             \
+      !defined(MBEDTLS_THREADING_PTHREAD) )
+#error "MBEDTLS_SSL_ASYNC_ENGINE_C defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH) && \
+    MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH < 1
+#error "MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH must be at least 1"
+#endif
+
+#if defined(MBEDTLS_SSL_CACHE_INDEXED) && !defined(MBEDTLS_SSL_CACHE_C)
+#error "MBEDTLS_SSL_CACHE_INDEXED defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_SSL_CACHE_SHARDS) && \
+    ( MBEDTLS_SSL_CACHE_SHARDS < 1 || MBEDTLS_SSL_CACHE_SHARDS > 256 )
+#error "MBEDTLS_SSL_CACHE_SHARDS must be between 1 and 256"
+#endif
+
 #if defined(MBEDTLS_SSL_TLS_C) && \
     !( defined(MBEDTLS_SSL_PROTO_TLS1_2) || defined(MBEDTLS_SSL_PROTO_TLS1_3) )
 #error "MBEDTLS_SSL_TLS_C defined, but no protocols are active"
@@ -108,6 +108,25 @@ extern "C" {
 
 #if !defined(MBEDTLS_DHM_ALT)
 
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+/**
+ * \brief          A precomputed table for the generator of a DHM group.
+ *
+ *                 Once set up, it is only read, so it can be shared by any
+ *                 number of DHM contexts, including in different threads.
+ */
+typedef struct mbedtls_dhm_fixed_base
+{
+    mbedtls_mpi MBEDTLS_PRIVATE(P);      /*!<  The prime modulus. */
+    mbedtls_mpi MBEDTLS_PRIVATE(G);      /*!<  The generator. */
+    mbedtls_mpi MBEDTLS_PRIVATE(RP);     /*!<  The cached value = \c R^2 mod \c P. */
+    size_t MBEDTLS_PRIVATE(wsize);       /*!<  The comb width, in bits. */
+    size_t MBEDTLS_PRIVATE(d);           /*!<  The comb tooth spacing, in bits. */
+    mbedtls_mpi_uint *MBEDTLS_PRIVATE(table); /*!<  The comb table for \c G. */
+}
+mbedtls_dhm_fixed_base;
+#endif /* MBEDTLS_DHM_FIXED_BASE */
+
 /**
  * \brief          The DHM context structure.
  */
@@ -123,6 +142,9 @@ typedef struct mbedtls_dhm_context
     mbedtls_mpi MBEDTLS_PRIVATE(Vi);     /*!<  The blinding value. */
     mbedtls_mpi MBEDTLS_PRIVATE(Vf);     /*!<  The unblinding value. */
     mbedtls_mpi MBEDTLS_PRIVATE(pX);     /*!<  The previous \c X. */
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+    const mbedtls_dhm_fixed_base *MBEDTLS_PRIVATE(fixed_base); /*!<  The table for \c G, if any. */
+#endif
 }
 mbedtls_dhm_context;
 
@@ -219,6 +241,68 @@ int mbedtls_dhm_set_group( mbedtls_dhm_context *ctx,
                            const mbedtls_mpi *P,
                            const mbedtls_mpi *G );
 
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+/**
+ * \brief          This function initializes a fixed-base table.
+ *
+ * \param fb       The table to initialize.
+ */
+void mbedtls_dhm_fixed_base_init( mbedtls_dhm_fixed_base *fb );
+
+/**
+ * \brief          This function precomputes a table for exponentiations
+ *                 of the generator \p G modulo the prime \p P.
+ *
+ * \note           The setup costs about half of a modular exponentiation.
+ *                 It pays for itself from the first key pair generated
+ *                 with the table.
+ *
+ * \param fb       The table to set up. This must be initialized. If it was
+ *                 already set up, its previous content is freed, even if
+ *                 this function fails.
+ * \param P        The MPI holding the DHM prime modulus. It must be odd.
+ * \param G        The MPI holding the DHM generator. It must be
+ *                 greater than 1 and less than \p P.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_DHM_BAD_INPUT_DATA if \p P or \p G is
+ *                 not acceptable.
+ * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED if a memory allocation
+ *                 failed.
+ */
+int mbedtls_dhm_fixed_base_setup( mbedtls_dhm_fixed_base *fb,
+                                  const mbedtls_mpi *P,
+                                  const mbedtls_mpi *G );
+
+/**
+ * \brief          This function frees a fixed-base table.
+ *
+ * \param fb       The table to free. This may be \c NULL, in which case
+ *                 this function is a no-op.
+ */
+void mbedtls_dhm_fixed_base_free( mbedtls_dhm_fixed_base *fb );
+
+/**
+ * \brief          This function sets the prime modulus and generator from
+ *                 a precomputed table, and uses the table to compute
+ *                 \c G^X in mbedtls_dhm_make_params() and
+ *                 mbedtls_dhm_make_public().
+ *
+ * \note           The context keeps a pointer to \p fb until its group is
+ *                 set again or it is freed. \p fb must not be modified or
+ *                 freed before then.
+ *
+ * \param ctx      The DHM context to configure. This must be initialized.
+ * \param fb       The table to use. This must have been set up with
+ *                 mbedtls_dhm_fixed_base_setup().
+ *
+ * \return         \c 0 if successful.
+ * \return         An \c MBEDTLS_ERR_DHM_XXX error code on failure.
+ */
+int mbedtls_dhm_set_fixed_base( mbedtls_dhm_context *ctx,
+                                const mbedtls_dhm_fixed_base *fb );
+#endif /* MBEDTLS_DHM_FIXED_BASE */
+
 /**
  * \brief          This function imports the raw public value of the peer.
  *
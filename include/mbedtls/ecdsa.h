@@ -36,6 +36,10 @@
 #include "mbedtls/ecp.h"
 #include "mbedtls/md.h"
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL) && defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
 /**
  * \brief           Maximum ECDSA signature size for a given curve bit size
  *
@@ -120,6 +124,45 @@ typedef void mbedtls_ecdsa_restart_ctx;
 
 #endif /* MBEDTLS_ECP_RESTARTABLE */
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+/**
+ * \brief           A pool of precomputed ECDSA nonces for one curve.
+ *
+ *                  Each entry holds the two values of a signature that do
+ *                  not depend on the key or the message: k^-1 mod n and
+ *                  r = x(k G) mod n, for a random ephemeral key k. The
+ *                  value of k itself is not kept. See
+ *                  mbedtls_ecdsa_sign_pooled().
+ *
+ * \warning         The entries are as sensitive as private keys: an entry
+ *                  used for two signatures, or leaked, reveals the signing
+ *                  key. Each entry is handed out once and then wiped.
+ */
+typedef struct mbedtls_ecdsa_nonce_pool
+{
+    mbedtls_ecp_group MBEDTLS_PRIVATE(grp);     /*!< Group used to compute the entries  */
+    mbedtls_mpi *MBEDTLS_PRIVATE(kinv);         /*!< k^-1 mod n, for each entry         */
+    mbedtls_mpi *MBEDTLS_PRIVATE(r);            /*!< x(k G) mod n, for each entry       */
+    size_t MBEDTLS_PRIVATE(size);               /*!< Number of entries when full        */
+    size_t MBEDTLS_PRIVATE(count);              /*!< Number of entries available        */
+    int (*MBEDTLS_PRIVATE(f_rng))(void *, unsigned char *, size_t); /*!< RNG for k    */
+    void *MBEDTLS_PRIVATE(p_rng);               /*!< Context for the RNG                */
+    unsigned long MBEDTLS_PRIVATE(pid);         /*!< Process the entries belong to      */
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    pthread_mutex_t MBEDTLS_PRIVATE(mutex);     /*!< Protects the entries and flags     */
+    pthread_mutex_t MBEDTLS_PRIVATE(gen_mutex); /*!< Serializes the use of grp and RNG  */
+    pthread_cond_t MBEDTLS_PRIVATE(refill);     /*!< Signalled when an entry is taken   */
+    pthread_t MBEDTLS_PRIVATE(thread);          /*!< Refill thread                      */
+    int MBEDTLS_PRIVATE(running);               /*!< Is the refill thread running?      */
+    int MBEDTLS_PRIVATE(stop);                  /*!< Asks the refill thread to exit     */
+    int MBEDTLS_PRIVATE(thread_ret);            /*!< Why the refill thread stopped      */
+#elif defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(mutex);     /*!< Protects the entries     */
+    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(gen_mutex); /*!< Serializes grp and RNG   */
+#endif
+} mbedtls_ecdsa_nonce_pool;
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
+
 /**
  * \brief          This function checks whether a given group can be used
  *                 for ECDSA.
@@ -170,6 +213,151 @@ int mbedtls_ecdsa_sign( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
                 const mbedtls_mpi *d, const unsigned char *buf, size_t blen,
                 int (*f_rng)(void *, unsigned char *, size_t), void *p_rng );
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+/**
+ * \brief           This function initializes a nonce pool.
+ *
+ * \param pool      The pool to initialize. This must not be \c NULL.
+ */
+void mbedtls_ecdsa_nonce_pool_init( mbedtls_ecdsa_nonce_pool *pool );
+
+/**
+ * \brief           This function sets up an empty nonce pool for a curve.
+ *
+ * \param pool      The pool to set up. This must be initialized.
+ * \param gid       The curve the nonces are for. It must be usable for
+ *                  ECDSA.
+ * \param size      The maximum number of entries of the pool. This must
+ *                  not be \c 0.
+ * \param f_rng     The RNG function used to generate the ephemeral keys and
+ *                  for side channel countermeasures. This must not be
+ *                  \c NULL. If mbedtls_ecdsa_nonce_pool_start() is used,
+ *                  it is called from another thread and must be
+ *                  thread-safe.
+ * \param p_rng     The RNG context to be passed to \p f_rng. This may be
+ *                  \c NULL if \p f_rng doesn't need a context parameter.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if \p gid cannot be used
+ *                  for ECDSA or \p size is \c 0.
+ * \return          Another \c MBEDTLS_ERR_ECP_XXX error code on failure.
+ */
+int mbedtls_ecdsa_nonce_pool_setup( mbedtls_ecdsa_nonce_pool *pool,
+                                    mbedtls_ecp_group_id gid, size_t size,
+                                    int (*f_rng)(void *, unsigned char *, size_t),
+                                    void *p_rng );
+
+/**
+ * \brief           This function fills a nonce pool in the calling thread.
+ *
+ *                  This lets an application precompute nonces at a time
+ *                  of its choosing, for example when it is idle. It can be
+ *                  called concurrently with mbedtls_ecdsa_sign_pooled(),
+ *                  or with itself on the same pool, if #MBEDTLS_THREADING_C
+ *                  is enabled: concurrent fills take turns.
+ *
+ * \param pool      The pool to fill. This must be set up, and its refill
+ *                  thread must not be running.
+ * \param max       The maximum number of entries to add.
+ *
+ * \return          \c 0 on success, including when the pool was already
+ *                  full.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if the refill thread of
+ *                  \p pool is running.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX or \c MBEDTLS_MPI_XXX
+ *                  error code on failure.
+ */
+int mbedtls_ecdsa_nonce_pool_fill( mbedtls_ecdsa_nonce_pool *pool, size_t max );
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/**
+ * \brief           This function starts a thread that keeps a nonce pool
+ *                  full.
+ *
+ *                  The thread computes a new entry whenever
+ *                  mbedtls_ecdsa_sign_pooled() takes one, until
+ *                  mbedtls_ecdsa_nonce_pool_free() is called. If the RNG
+ *                  fails, the thread stops and signing falls back to
+ *                  computing the nonces inline.
+ *
+ * \note            Do not call fork() while the thread is running: the
+ *                  child process could inherit the pool's lock in a locked
+ *                  state. Without a refill thread, fork() is safe: the
+ *                  entries inherited by the child are discarded the first
+ *                  time it uses the pool, so the parent and the child never
+ *                  use the same nonce.
+ *
+ * \param pool      The pool. This must be set up.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if the thread is already
+ *                  running.
+ * \return          #MBEDTLS_ERR_ECP_ALLOC_FAILED if the thread could not
+ *                  be created.
+ */
+int mbedtls_ecdsa_nonce_pool_start( mbedtls_ecdsa_nonce_pool *pool );
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+/**
+ * \brief           This function stops the refill thread of a nonce pool,
+ *                  if any, and frees the pool, wiping all its entries.
+ *
+ * \param pool      The pool to free. This may be \c NULL, in which case
+ *                  this function does nothing. If it is not \c NULL, it
+ *                  must be initialized.
+ */
+void mbedtls_ecdsa_nonce_pool_free( mbedtls_ecdsa_nonce_pool *pool );
+
+/**
+ * \brief           This function computes the ECDSA signature of a
+ *                  previously-hashed message, using a precomputed nonce.
+ *
+ *                  The signature is s = k^-1 (e + r d) mod n, with the next
+ *                  k^-1 and r taken from \p pool, so signing only costs a
+ *                  few multiplications modulo n. When the pool is empty,
+ *                  the nonce is computed inline as with
+ *                  mbedtls_ecdsa_sign(). The result is a regular,
+ *                  randomized ECDSA signature.
+ *
+ *                  This function can be called from several threads at
+ *                  once with the same pool if #MBEDTLS_THREADING_C is
+ *                  enabled, as long as each thread has its own \p grp.
+ *
+ * \see             ecp.h
+ *
+ * \param grp       The context for the elliptic curve to use. This must be
+ *                  initialized and set up for the same curve as \p pool.
+ * \param r         The MPI context in which to store the first part
+ *                  the signature. This must be initialized.
+ * \param s         The MPI context in which to store the second part
+ *                  the signature. This must be initialized.
+ * \param d         The private signing key. This must be initialized.
+ * \param buf       The content to be signed. This is usually the hash of
+ *                  the original data to be signed. This must be a readable
+ *                  buffer of length \p blen Bytes. It may be \c NULL if
+ *                  \p blen is zero.
+ * \param blen      The length of \p buf in Bytes.
+ * \param pool      The nonce pool. This must be set up.
+ * \param f_rng     The RNG function used when \p pool is empty. This must
+ *                  not be \c NULL.
+ * \param p_rng     The RNG context to be passed to \p f_rng. This may be
+ *                  \c NULL if \p f_rng doesn't need a context parameter.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if \p grp and \p pool
+ *                  are for different curves.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX
+ *                  or \c MBEDTLS_MPI_XXX error code on failure.
+ */
+int mbedtls_ecdsa_sign_pooled( mbedtls_ecp_group *grp,
+                               mbedtls_mpi *r, mbedtls_mpi *s,
+                               const mbedtls_mpi *d,
+                               const unsigned char *buf, size_t blen,
+                               mbedtls_ecdsa_nonce_pool *pool,
+                               int (*f_rng)(void *, unsigned char *, size_t),
+                               void *p_rng );
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
+
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC)
 /**
  * \brief           This function computes the ECDSA signature of a
@@ -253,6 +441,56 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
                           const mbedtls_ecp_point *Q, const mbedtls_mpi *r,
                           const mbedtls_mpi *s);
 
+/**
+ * \brief           This function verifies several ECDSA signatures of
+ *                  previously-hashed messages on the same curve.
+ *
+ *                  Each signature is checked as by mbedtls_ecdsa_verify(),
+ *                  but the modular inversions are shared between all the
+ *                  signatures and the point multiplications are
+ *                  interleaved (see mbedtls_ecp_muladd_batch()), which is
+ *                  faster than verifying the signatures one by one.
+ *
+ * \see             ecp.h
+ *
+ * \param grp       The ECP group to use.
+ *                  This must be initialized and have group parameters
+ *                  set, for example through mbedtls_ecp_group_load().
+ * \param buf       An array of \p count hashes that were signed. Each
+ *                  \c buf[i] must be a readable buffer of length
+ *                  \c blen[i] Bytes. It may be \c NULL if \c blen[i] is
+ *                  zero.
+ * \param blen      An array of \p count hash lengths, in Bytes.
+ * \param Q         An array of \p count pointers to the public keys to use
+ *                  for verification. Each of them must be initialized.
+ *                  The same key may appear several times.
+ * \param r         An array of \p count first integers of the signatures.
+ *                  Each of them must be initialized.
+ * \param s         An array of \p count second integers of the signatures.
+ *                  Each of them must be initialized.
+ * \param count     The number of signatures. This may be \c 0.
+ * \param results   The buffer for the result bitmap. This must be a
+ *                  writable buffer of length ( \p count + 7 ) / 8 Bytes.
+ *                  On return, bit ( \c i % 8 ) of \c results[i / 8] is set
+ *                  if signature \c i is valid, and cleared if it is not,
+ *                  including when \c Q[i] is not a valid public key.
+ *
+ * \return          \c 0 if all the signatures are valid.
+ * \return          #MBEDTLS_ERR_ECP_VERIFY_FAILED if at least one signature
+ *                  is invalid. \p results tells which ones.
+ * \return          Another \c MBEDTLS_ERR_ECP_XXX or \c MBEDTLS_MPI_XXX
+ *                  error code on other kinds of failure. The content of
+ *                  \p results is then unspecified.
+ */
+int mbedtls_ecdsa_verify_batch( mbedtls_ecp_group *grp,
+                                const unsigned char * const buf[],
+                                const size_t blen[],
+                                const mbedtls_ecp_point * const Q[],
+                                const mbedtls_mpi r[],
+                                const mbedtls_mpi s[],
+                                size_t count,
+                                unsigned char *results );
+
 /**
  * \brief           This function computes the ECDSA signature and writes it
  *                  to a buffer, serialized as defined in <em>RFC-4492:
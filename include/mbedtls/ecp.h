@@ -294,6 +294,10 @@ mbedtls_ecp_group;
  * For each n-bit Short Weierstrass curve that is enabled, this adds 4n bytes
  * of code size if n < 384 and 8n otherwise.
  *
+ * The tables for all built-in curves are precomputed, so loading a group
+ * never computes them at run time. See also
+ * MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW to trade more code size for speed.
+ *
  * Change this value to 0 to reduce code size.
  */
 #define MBEDTLS_ECP_FIXED_POINT_OPTIM  1   /**< Enable fixed-point speed-up. */
@@ -1062,6 +1066,59 @@ int mbedtls_ecp_muladd_restartable(
              const mbedtls_mpi *m, const mbedtls_ecp_point *P,
              const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
              mbedtls_ecp_restart_ctx *rs_ctx );
+
+/**
+ * \brief           This function computes several linear combinations of
+ *                  the generator and other points:
+ *                  \p R[i] = \p m[i] * G + \p n[i] * \p Q[i]
+ *                  for \c i from \c 0 to \p count - 1.
+ *
+ *                  The result is the same as calling mbedtls_ecp_muladd()
+ *                  on each item with \c P set to the generator, but the
+ *                  precomputation for the generator and the final
+ *                  inversions are shared between the items, and the two
+ *                  multiplications of each item are interleaved. This is
+ *                  meant for verifying many signatures at once.
+ *
+ * \note            This function does not guarantee a constant execution
+ *                  flow and timing. It must only be used with public data.
+ *
+ * \note            This function is only defined for short Weierstrass curves.
+ *                  It may not be included in builds without any short
+ *                  Weierstrass curve.
+ *
+ * \param grp       The ECP group to use.
+ *                  This must be initialized and have group parameters
+ *                  set, for example through mbedtls_ecp_group_load().
+ * \param R         An array of \p count points in which to store the
+ *                  results. Each of them must be initialized.
+ * \param m         An array of \p count integers by which to multiply the
+ *                  generator. Each of them must be in the range
+ *                  \c 0 to \c N - 1.
+ * \param n         An array of \p count integers by which to multiply the
+ *                  points \p Q. Each of them must be in the range
+ *                  \c 0 to \c N - 1.
+ * \param Q         An array of \p count pointers to the points to multiply
+ *                  by \p n. Each of them must be a valid public key.
+ * \param count     The number of items. This may be \c 0.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_INVALID_KEY if one of the \p m or \p n
+ *                  is out of range, or one of the \p Q is not a valid public
+ *                  key.
+ * \return          #MBEDTLS_ERR_ECP_ALLOC_FAILED or
+ *                  #MBEDTLS_ERR_MPI_ALLOC_FAILED on memory-allocation
+ *                  failure.
+ * \return          #MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE if \p grp does not
+ *                  designate a short Weierstrass curve.
+ * \return          Another negative error code on other kinds of failure.
+ */
+int mbedtls_ecp_muladd_batch( mbedtls_ecp_group *grp,
+                              mbedtls_ecp_point R[],
+                              const mbedtls_mpi m[],
+                              const mbedtls_mpi n[],
+                              const mbedtls_ecp_point * const Q[],
+                              size_t count );
 #endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
 
 /**
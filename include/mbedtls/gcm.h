@@ -70,6 +70,13 @@ typedef struct mbedtls_gcm_context
     int MBEDTLS_PRIVATE(mode);                             /*!< The operation to perform:
                                                #MBEDTLS_GCM_ENCRYPT or
                                                #MBEDTLS_GCM_DECRYPT. */
+#if defined(MBEDTLS_AESNI_C)
+    unsigned char MBEDTLS_PRIVATE(H_pow)[8][16];           /*!< Powers of H for the
+                                               CLMUL GHASH kernels. */
+    int MBEDTLS_PRIVATE(aesni);                            /*!< Use the AES-NI GCM engine:
+                                               0 = no, 1 = GHASH only,
+                                               2 = AES and GHASH. */
+#endif
 }
 mbedtls_gcm_context;
 
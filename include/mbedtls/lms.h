@@ -75,6 +75,22 @@
                                           MBEDTLS_LMOTS_I_KEY_ID_LEN + \
                                           MBEDTLS_LMS_M_NODE_BYTES(type))
 
+#define MBEDTLS_LMS_SEED_SIZE_LEN       (2)
+#define MBEDTLS_LMS_SEED_SIZE_MAX       (0xFFFFu)
+
+/* The number of nodes of the Merkle tree, which is stored in exported private
+ * keys. */
+#define MBEDTLS_LMS_TREE_NODE_COUNT(type) ((2u << MBEDTLS_LMS_H_TREE_HEIGHT(type)) - 1u)
+
+#define MBEDTLS_LMS_PRIVATE_KEY_LEN(type, seed_size) (MBEDTLS_LMS_TYPE_LEN + \
+                                                      MBEDTLS_LMOTS_TYPE_LEN + \
+                                                      MBEDTLS_LMOTS_I_KEY_ID_LEN + \
+                                                      MBEDTLS_LMOTS_Q_LEAF_ID_LEN + \
+                                                      MBEDTLS_LMS_SEED_SIZE_LEN + \
+                                                      (seed_size) + \
+                                                      (MBEDTLS_LMS_TREE_NODE_COUNT(type) * \
+                                                       MBEDTLS_LMS_M_NODE_BYTES(type)))
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -210,8 +226,10 @@ typedef struct {
 #if defined(MBEDTLS_LMS_PRIVATE)
 /** LMS private context structure.
  *
- * A LMS private key is a set of LMOTS private keys, an index to the next usable
- * key, and the applicable parameter set.
+ * A LMS private key is the seed from which the LMOTS private keys are
+ * derived, an index to the next usable key, and the applicable parameter set.
+ * The context also caches the whole Merkle tree, so that signing only needs
+ * to copy the authentication path out of it.
  *
  * The context must be initialized before it is used. A public key must either
  * be imported or generated from a private context.
@@ -221,6 +239,9 @@ typedef struct {
  *   UNINITIALIZED -> INIT [label="init"];
  *   HAVE_PRIVATE_KEY -> INIT [label="free"];
  *   INIT -> HAVE_PRIVATE_KEY [label="generate_private_key"];
+ *   INIT -> HAVE_PRIVATE_KEY [label="import_private_key"];
+ *   HAVE_PRIVATE_KEY -> HAVE_PRIVATE_KEY [label="export_private_key"];
+ *   HAVE_PRIVATE_KEY -> HAVE_PRIVATE_KEY [label="import_private_key"];
  * }
  * \enddot
  */
@@ -228,16 +249,15 @@ typedef struct {
     mbedtls_lms_parameters_t MBEDTLS_PRIVATE(params);
     uint32_t MBEDTLS_PRIVATE(q_next_usable_key); /*!< The index of the next OTS key that has not
                                                       been used. */
-    mbedtls_lmots_private_t *MBEDTLS_PRIVATE(ots_private_keys); /*!< The private key material. One OTS key
-                                                              for each leaf node in the Merkle tree. NULL
-                                                              when have_private_key is 0 and non-NULL otherwise.
-                                                              is 2^MBEDTLS_LMS_H_TREE_HEIGHT(type) in length. */
-    mbedtls_lmots_public_t *MBEDTLS_PRIVATE(ots_public_keys); /*!< The OTS key public keys, used to
-                                                                   build the Merkle tree. NULL
-                                                                   when have_private_key is 0 and
-                                                                   non-NULL otherwise.
-                                                                   Is 2^MBEDTLS_LMS_H_TREE_HEIGHT(type)
-                                                                   in length. */
+    unsigned char *MBEDTLS_PRIVATE(seed); /*!< The seed from which the OTS private keys are
+                                               derived. NULL when have_private_key is 0 or
+                                               seed_size is 0. */
+    size_t MBEDTLS_PRIVATE(seed_size); /*!< The length of the seed. */
+    unsigned char *MBEDTLS_PRIVATE(tree); /*!< The nodes of the Merkle tree, indexed from 1 as
+                                               in RFC8554 section 5.3. Index 0 is unused, so this
+                                               is 2^(MBEDTLS_LMS_H_TREE_HEIGHT(type) + 1) nodes in
+                                               length. NULL when have_private_key is 0 and
+                                               non-NULL otherwise. */
     unsigned char MBEDTLS_PRIVATE(have_private_key); /*!< Whether the context contains a private key.
                                                      Boolean values only. */
 } mbedtls_lms_private_t;
@@ -358,6 +378,9 @@ void mbedtls_lms_private_free( mbedtls_lms_private_t *ctx );
  *                           may change considerably in future versions.
  *
  * \note                     The seed must have at least 256 bits of entropy.
+ *                           The private context keeps a copy of it, from
+ *                           which it derives each LMOTS private key when it
+ *                           is needed.
  *
  * \param ctx                The initialized LMOTS context to generate the key
  *                           into.
@@ -367,7 +390,8 @@ void mbedtls_lms_private_free( mbedtls_lms_private_t *ctx );
  * \param p_rng              The RNG context to be passed to f_rng
  * \param seed               The seed used to deterministically generate the
  *                           key.
- * \param seed_size          The length of the seed.
+ * \param seed_size          The length of the seed. This must be at most
+ *                           #MBEDTLS_LMS_SEED_SIZE_MAX.
  *
  * \return         \c 0 on success.
  * \return         A non-zero error code on failure.
@@ -442,6 +466,86 @@ int mbedtls_lms_sign( mbedtls_lms_private_t *ctx,
                       void* p_rng, const unsigned char *msg,
                       unsigned int msg_size, unsigned char *sig, size_t sig_size,
                       size_t *sig_len );
+
+/**
+ * \brief                    This function exports the state of an LMS private
+ *                           context, so that it can be stored and later
+ *                           imported with mbedtls_lms_import_private_key().
+ *
+ *                           The exported state is, in this order:
+ *                           the LMS type (4 bytes), the LMOTS type
+ *                           (4 bytes), the key identifier I, the index of the
+ *                           next usable key (4 bytes), the seed size
+ *                           (#MBEDTLS_LMS_SEED_SIZE_LEN bytes), the seed, and
+ *                           the #MBEDTLS_LMS_TREE_NODE_COUNT nodes of the
+ *                           Merkle tree in node index order, starting from the
+ *                           root. Integers are in network byte order. This
+ *                           format is specific to this library.
+ *
+ * \warning                  The exported state contains the seed, from which
+ *                           all the private keys are derived. It must be
+ *                           protected like any other private key.
+ *
+ * \warning                  Each call to mbedtls_lms_sign() uses up a
+ *                           private key. To make sure that no LMOTS private
+ *                           key is ever used twice, export the state and
+ *                           commit it to persistent storage after each
+ *                           signature and before the signature is released.
+ *                           Never import a state that is older than the last
+ *                           one that was stored.
+ *
+ * \param ctx                The initialized LMS private context to export.
+ *                           This must contain a private key.
+ * \param key                The buffer to write the state into.
+ * \param key_size           The size of \p key in bytes. This must be at least
+ *                           #MBEDTLS_LMS_PRIVATE_KEY_LEN of the key type and
+ *                           seed size.
+ * \param key_len            If not NULL, will be written with the size of the
+ *                           exported state.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_LMS_BUFFER_TOO_SMALL if \p key_size is too
+ *                 small.
+ * \return         A non-zero error code on failure.
+ */
+int mbedtls_lms_export_private_key( const mbedtls_lms_private_t *ctx,
+                                    unsigned char *key, size_t key_size,
+                                    size_t *key_len );
+
+/**
+ * \brief                    This function imports an LMS private key state
+ *                           that was exported with
+ *                           mbedtls_lms_export_private_key().
+ *
+ *                           The state is checked before it is used: the leaf
+ *                           of the next usable key is derived again from the
+ *                           seed, and the internal nodes of the Merkle tree,
+ *                           up to the root which is the public key, are
+ *                           recalculated and compared with the stored ones.
+ *                           This costs one LMOTS public key calculation and one
+ *                           hash per internal node, which is much less than
+ *                           generating the key.
+ *
+ * \note                     If the context already contains a private key, the
+ *                           state must be for the same key, and its index of
+ *                           the next usable key must not be lower than the one
+ *                           in the context. This rejects a state that would
+ *                           reuse a private key that the context has already
+ *                           used. On failure, the context is left unchanged.
+ *
+ * \param ctx                The initialized LMS private context to store the
+ *                           key in.
+ * \param key                The buffer to read the state from.
+ * \param key_size           The size of the state in bytes.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_LMS_BAD_INPUT_DATA if the state is malformed,
+ *                 corrupted, uses unsupported parameters, or does not match
+ *                 the key already in \p ctx.
+ * \return         A non-zero error code on failure.
+ */
+int mbedtls_lms_import_private_key( mbedtls_lms_private_t *ctx,
+                                    const unsigned char *key, size_t key_size );
 #endif /* defined(MBEDTLS_LMS_PRIVATE) */
 
 #ifdef __cplusplus
@@ -118,6 +118,46 @@
  */
 //#define MBEDTLS_HAVE_SSE2
 
+/**
+ * \def MBEDTLS_MPI_MONTMUL_ASM
+ *
+ * Use dedicated assembly kernels for the multiply-accumulate row at the heart
+ * of bignum multiplication and Montgomery multiplication, in place of the
+ * generic MULADDC macros.
+ *
+ * Kernels exist for:
+ *      x86-64, using MULX/ADCX/ADOX (BMI2 and ADX) when the CPU supports
+ *              them, detected at runtime with CPUID;
+ *      AArch64, using MUL/UMULH, only if #MBEDTLS_MPI_MONTMUL_ASM_A64 is
+ *              also enabled.
+ * On other targets, or with compilers that do not support GNU-style inline
+ * assembly, this option has no effect.
+ *
+ * Module:  library/bignum_core.c
+ *
+ * Requires: MBEDTLS_HAVE_ASM, MBEDTLS_BIGNUM_C
+ *
+ * Comment to use the generic MULADDC code on all platforms.
+ */
+#define MBEDTLS_MPI_MONTMUL_ASM
+
+/**
+ * \def MBEDTLS_MPI_MONTMUL_ASM_A64
+ *
+ * Use the AArch64 multiply-accumulate kernel of #MBEDTLS_MPI_MONTMUL_ASM.
+ *
+ * \note This option is experimental: the kernel is only tested by the
+ *       all.sh component that cross-compiles for AArch64 and runs the test
+ *       suites under QEMU.
+ *
+ * Module:  library/bignum_core.c
+ *
+ * Requires: MBEDTLS_MPI_MONTMUL_ASM
+ *
+ * Uncomment to use the AArch64 kernel on AArch64 targets.
+ */
+//#define MBEDTLS_MPI_MONTMUL_ASM_A64
+
 /**
  * \def MBEDTLS_HAVE_TIME
  *
@@ -639,6 +679,25 @@
  */
 //#define MBEDTLS_CTR_DRBG_USE_128_BIT_KEY
 
+/**
+ * \def MBEDTLS_DHM_FIXED_BASE
+ *
+ * Enable precomputed tables for the generator of a Diffie-Hellman group
+ * (mbedtls_dhm_fixed_base_setup() and mbedtls_dhm_set_fixed_base()).
+ * With a table, generating an ephemeral key pair costs about 2.5 times
+ * less than with a generic modular exponentiation, for 16 to 64 times
+ * the size of the prime modulus in memory.
+ *
+ * When this option and MBEDTLS_SSL_SRV_C are enabled, the SSL configuration
+ * keeps a table for its DHE group, which is shared by all the SSL contexts
+ * using the configuration.
+ *
+ * Requires: MBEDTLS_DHM_C
+ *
+ * Uncomment this macro to enable fixed-base tables for DHM.
+ */
+//#define MBEDTLS_DHM_FIXED_BASE
+
 /**
  * \def MBEDTLS_ECP_DP_SECP192R1_ENABLED
  *
@@ -674,6 +733,66 @@
  */
 #define MBEDTLS_ECP_NIST_OPTIM
 
+/**
+ * \def MBEDTLS_ECP_NIST_FIXED_LIMBS
+ *
+ * Use dedicated fixed-size field arithmetic for scalar multiplication on
+ * secp256r1 and secp384r1.
+ *
+ * Coordinates are kept in fixed-size arrays in Montgomery representation
+ * instead of heap-allocated MPIs, which removes allocations and the generic
+ * modular reduction from the inner loop of mbedtls_ecp_mul() and
+ * mbedtls_ecp_muladd(). The generic code is still used for restartable
+ * operations (see MBEDTLS_ECP_RESTARTABLE) and for groups handled by
+ * MBEDTLS_ECP_INTERNAL_ALT.
+ *
+ * Comment this macro to always use the generic ECP arithmetic.
+ */
+#define MBEDTLS_ECP_NIST_FIXED_LIMBS
+
+/**
+ * \def MBEDTLS_ECP_MONTGOMERY_FIXED_LIMBS
+ *
+ * Use dedicated fixed-size field arithmetic for scalar multiplication on
+ * Curve25519 and Curve448.
+ *
+ * The Montgomery ladder of mbedtls_ecp_mul() then works on unsaturated
+ * limbs kept on the stack (radix 2^51 for Curve25519, 2^56 for Curve448)
+ * instead of heap-allocated MPIs. This speeds up X25519 and X448 key
+ * generation and key agreement, through both the ECDH and the PSA APIs.
+ *
+ * This is only effective on platforms with 64-bit limbs and a 128-bit
+ * integer type (see MBEDTLS_HAVE_INT64 and MBEDTLS_NO_UDBL_DIVISION);
+ * elsewhere, and for groups handled by MBEDTLS_ECP_INTERNAL_ALT, the
+ * generic code is used.
+ *
+ * Comment this macro to always use the generic ECP arithmetic.
+ */
+#define MBEDTLS_ECP_MONTGOMERY_FIXED_LIMBS
+
+/**
+ * \def MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW
+ *
+ * Use larger precomputed tables for multiplication of the generator of the
+ * built-in short Weierstrass curves.
+ *
+ * The tables are built into the library when MBEDTLS_ECP_FIXED_POINT_OPTIM
+ * is 1, so they are never computed at run time. This option uses tables
+ * with a window one bit wider, which saves about 15% of the point doublings
+ * and additions in ECDSA signature, key generation and the first half of
+ * ECDHE. Since every step then scans a table twice as large, the net
+ * speed-up ranges from a few percent on the curves with dedicated
+ * arithmetic to about 20% on Brainpool curves.
+ *
+ * This doubles the size of the tables: 8n bytes of read-only data per n-bit
+ * curve if n < 384 and 16n bytes otherwise.
+ *
+ * Requires: MBEDTLS_ECP_C, MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+ *
+ * Uncomment this macro to use the larger tables.
+ */
+//#define MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW
+
 /**
  * \def MBEDTLS_ECP_RESTARTABLE
  *
@@ -712,6 +831,26 @@
  */
 #define MBEDTLS_ECDSA_DETERMINISTIC
 
+/**
+ * \def MBEDTLS_ECDSA_NONCE_POOL
+ *
+ * Enable pools of precomputed ECDSA nonces, see mbedtls_ecdsa_sign_pooled().
+ *
+ * The part of an ECDSA signature that does not depend on the key or the
+ * message, a point multiplication k G and an inversion modulo n, can be
+ * computed ahead of time: either explicitly with
+ * mbedtls_ecdsa_nonce_pool_fill(), or by a background thread started with
+ * mbedtls_ecdsa_nonce_pool_start() if MBEDTLS_THREADING_PTHREAD is enabled.
+ * Signing with a filled pool then only costs a few multiplications modulo n.
+ *
+ * Requires: MBEDTLS_ECDSA_C
+ *
+ * This option is not compatible with MBEDTLS_ECDSA_SIGN_ALT.
+ *
+ * Uncomment this macro to enable ECDSA nonce pools.
+ */
+//#define MBEDTLS_ECDSA_NONCE_POOL
+
 /**
  * \def MBEDTLS_KEY_EXCHANGE_PSK_ENABLED
  *
@@ -1232,6 +1371,31 @@
  */
 //#define MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG
 
+/** \def MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD
+ *
+ * Give each thread its own instance of the PSA random generator.
+ *
+ * By default, psa_generate_random() and mbedtls_psa_get_random() draw from a
+ * single DRBG instance which is protected by a mutex. With this option, each
+ * thread lazily creates its own DRBG the first time it needs random data.
+ * Each instance is seeded and reseeded from the shared entropy context, so
+ * threads only contend when they gather entropy, not on every call.
+ *
+ * After fork(), the DRBG of the calling thread is reseeded in the child
+ * process before it is used again, so that the parent and the child do not
+ * produce the same output.
+ *
+ * This option does not change the behavior of DRBG contexts that the
+ * application manages itself: an mbedtls_ctr_drbg_context or
+ * mbedtls_hmac_drbg_context can still be shared between threads and is
+ * protected by its own mutex.
+ *
+ * Requires: MBEDTLS_PSA_CRYPTO_C, MBEDTLS_THREADING_PTHREAD
+ *
+ * Uncomment this to use a separate PSA random generator in each thread.
+ */
+//#define MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD
+
 /**
  * \def MBEDTLS_PSA_CRYPTO_SPM
  *
@@ -1259,6 +1423,33 @@
  */
 //#define MBEDTLS_PSA_INJECT_ENTROPY
 
+/**
+ * \def MBEDTLS_PSA_KEY_REPRESENTATION_CACHE
+ *
+ * Keep the parsed form of RSA and ECC keys in the PSA key slot.
+ *
+ * By default, the built-in RSA and ECC implementations parse the key
+ * material into an mbedtls_rsa_context or mbedtls_ecp_keypair at the start
+ * of each operation and free it at the end. When this option is enabled,
+ * the parsed key is kept with the key slot after its first use, together
+ * with the values that the bignum and ECP modules compute lazily (such as
+ * the Montgomery constants of the RSA modulus and primes, the RSA blinding
+ * values, and the precomputed multiples of the curve generator). Later
+ * operations with the same key reuse it.
+ *
+ * The cached representation is freed when the key is destroyed, purged or
+ * evicted from memory, or when the PSA subsystem is shut down.
+ *
+ * \note This option trades memory for speed: each RSA or ECC key that has
+ *       been used keeps a parsed copy of itself in memory, which for ECC
+ *       keys includes the curve's precomputed table (see
+ *       #MBEDTLS_ECP_WINDOW_SIZE).
+ *
+ * Module:  library/psa_crypto.c
+ * Requires: MBEDTLS_PSA_CRYPTO_C
+ */
+//#define MBEDTLS_PSA_KEY_REPRESENTATION_CACHE
+
 /**
  * \def MBEDTLS_RSA_NO_CRT
  *
@@ -1270,6 +1461,25 @@
  */
 //#define MBEDTLS_RSA_NO_CRT
 
+/**
+ * \def MBEDTLS_RSA_GEN_KEY_PARALLEL
+ *
+ * Make mbedtls_rsa_gen_key() search for the two primes of the key at the
+ * same time, one in the calling thread and one in a thread that it creates.
+ * On a machine with a spare core, this roughly halves the time it takes to
+ * generate a key.
+ *
+ * The random generator passed to mbedtls_rsa_gen_key() is then called from
+ * both threads, but never concurrently. The order of the calls depends on
+ * the scheduling of the threads, so the key is not reproducible from the
+ * state of a deterministic random generator.
+ *
+ * Requires: MBEDTLS_RSA_C, MBEDTLS_GENPRIME, MBEDTLS_THREADING_PTHREAD
+ *
+ * Uncomment this macro to search for the primes of RSA keys in parallel.
+ */
+//#define MBEDTLS_RSA_GEN_KEY_PARALLEL
+
 /**
  * \def MBEDTLS_SELF_TEST
  *
@@ -1357,6 +1567,29 @@
  */
 //#define MBEDTLS_SSL_ASYNC_PRIVATE
 
+/**
+ * \def MBEDTLS_SSL_CACHE_INDEXED
+ *
+ * Make the SSL session cache (MBEDTLS_SSL_CACHE_C) index its entries by
+ * session ID in a hash table instead of keeping them in a single linked list.
+ *
+ * With this option, lookups, insertions and evictions take constant time
+ * regardless of the number of cached sessions. The cache is split into
+ * MBEDTLS_SSL_CACHE_SHARDS independent shards, each with its own hash table,
+ * expiry list and (if MBEDTLS_THREADING_C is enabled) mutex, so that
+ * concurrent handshakes only contend when their session IDs hash to the
+ * same shard. The configured maximum number of entries still applies to
+ * the cache as a whole.
+ *
+ * Enabling this option makes each cache entry and the cache context larger,
+ * so only enable it for servers that cache many sessions.
+ *
+ * Requires: MBEDTLS_SSL_CACHE_C
+ *
+ * Uncomment to enable the indexed session cache.
+ */
+//#define MBEDTLS_SSL_CACHE_INDEXED
+
 /**
  * \def MBEDTLS_SSL_CONTEXT_SERIALIZATION
  *
@@ -2254,6 +2487,26 @@
  */
 #define MBEDTLS_CHACHA20_C
 
+/**
+ * \def MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT
+ *
+ * Generate the ChaCha20 keystream several blocks at a time with SIMD
+ * instructions: 4 blocks with SSE2 or 8 blocks with AVX2 on x86-64, and
+ * 4 blocks with Neon on Aarch64. AVX2 is only used if it is available at
+ * runtime. Inputs shorter than 256 bytes use the C implementation.
+ *
+ * \note If MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT is defined when building
+ * for another architecture, or with a compiler other than GCC or Clang,
+ * it will be silently ignored.
+ *
+ * Requires: MBEDTLS_CHACHA20_C.
+ *
+ * Module:  library/chacha20.c
+ *
+ * Uncomment to use the SIMD implementations of ChaCha20 when available.
+ */
+//#define MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT
+
 /**
  * \def MBEDTLS_CHACHAPOLY_C
  *
@@ -2935,6 +3188,29 @@
  */
 #define MBEDTLS_SHA1_C
 
+/**
+ * \def MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT
+ *
+ * Enable acceleration of the SHA-1 cryptographic hash algorithm with the
+ * x86-64 SHA extensions if they are available at runtime. If not, the library
+ * will fall back to the C implementation.
+ *
+ * \note If MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT is defined when building
+ * for a non-x86-64 target, or with a compiler other than GCC or Clang, it
+ * will be silently ignored.
+ *
+ * \note The code uses function-specific target attributes, so no additional
+ * \c CFLAGS are required.
+ *
+ * Requires: MBEDTLS_SHA1_C, MBEDTLS_HAVE_ASM
+ *
+ * Module:  library/sha1.c
+ *
+ * Uncomment to have the library check for the x86-64 SHA extensions
+ * and use them for SHA-1 if available.
+ */
+//#define MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT
+
 /**
  * \def MBEDTLS_SHA224_C
  *
@@ -3021,6 +3297,29 @@
  */
 //#define MBEDTLS_SHA256_USE_A64_CRYPTO_ONLY
 
+/**
+ * \def MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT
+ *
+ * Enable acceleration of the SHA-256 and SHA-224 cryptographic hash algorithms
+ * with the x86-64 SHA extensions if they are available at runtime.
+ * If not, the library will fall back to the C implementation.
+ *
+ * \note If MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT is defined when building
+ * for a non-x86-64 target, or with a compiler other than GCC or Clang, it
+ * will be silently ignored.
+ *
+ * \note The code uses function-specific target attributes, so no additional
+ * \c CFLAGS are required.
+ *
+ * Requires: MBEDTLS_SHA256_C, MBEDTLS_HAVE_ASM
+ *
+ * Module:  library/sha256.c
+ *
+ * Uncomment to have the library check for the x86-64 SHA extensions
+ * and use them for SHA-256 if available.
+ */
+//#define MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT
+
 /**
  * \def MBEDTLS_SHA384_C
  *
@@ -3108,6 +3407,26 @@
  */
 //#define MBEDTLS_SHA512_USE_A64_CRYPTO_ONLY
 
+/**
+ * \def MBEDTLS_SSL_ASYNC_ENGINE_C
+ *
+ * Enable a built-in implementation of the asynchronous private key callbacks
+ * (see MBEDTLS_SSL_ASYNC_PRIVATE) that performs the RSA and ECDSA private key
+ * operations of TLS servers on a pool of worker threads, and signals their
+ * completion through a file descriptor that an event loop can wait for.
+ * Operations with the same key are performed in batches.
+ *
+ * Module:  library/ssl_async_engine.c
+ * Caller:
+ *
+ * Requires: MBEDTLS_SSL_ASYNC_PRIVATE, MBEDTLS_SSL_SRV_C,
+ *           MBEDTLS_X509_CRT_PARSE_C, MBEDTLS_THREADING_PTHREAD
+ *
+ * This module is used by the server side of TLS 1.2, which is the only user
+ * of the asynchronous private key callbacks.
+ */
+//#define MBEDTLS_SSL_ASYNC_ENGINE_C
+
 /**
  * \def MBEDTLS_SSL_CACHE_C
  *
@@ -3457,6 +3776,7 @@
 /* MPI / BIGNUM options */
 //#define MBEDTLS_MPI_WINDOW_SIZE            6 /**< Maximum window size used. */
 //#define MBEDTLS_MPI_MAX_SIZE            1024 /**< Maximum number of bytes for usable MPIs. */
+//#define MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND 16384 /**< Largest small prime used to sieve prime candidates in mbedtls_mpi_gen_prime(). */
 
 /* CTR_DRBG options */
 //#define MBEDTLS_CTR_DRBG_ENTROPY_LEN               48 /**< Amount of entropy used per seed by default (48 with SHA-512, 32 with SHA-256) */
@@ -3475,6 +3795,9 @@
 //#define MBEDTLS_ECP_WINDOW_SIZE            4 /**< Maximum window size used */
 //#define MBEDTLS_ECP_FIXED_POINT_OPTIM      1 /**< Enable fixed-point speed-up */
 
+/* LMS options */
+//#define MBEDTLS_LMS_KEYGEN_THREADS         4 /**< Number of threads that compute the one-time public keys in mbedtls_lms_generate_private_key(). Requires MBEDTLS_LMS_PRIVATE and MBEDTLS_THREADING_PTHREAD */
+
 /* Entropy options */
 //#define MBEDTLS_ENTROPY_MAX_SOURCES                20 /**< Maximum number of sources supported */
 //#define MBEDTLS_ENTROPY_MAX_GATHER                128 /**< Maximum amount requested from entropy sources */
@@ -3560,12 +3883,37 @@
  *
  * If this option is unset, the library will fall back to a default value of
  * 32 keys.
+ *
+ * If #MBEDTLS_PSA_KEY_SLOT_MAX_COUNT is larger than this value, this is only
+ * the number of key slots that are allocated statically, and the key slot
+ * table grows on demand by blocks of this many slots.
  */
 //#define MBEDTLS_PSA_KEY_SLOT_COUNT 32
 
+/** \def MBEDTLS_PSA_KEY_SLOT_MAX_COUNT
+ * Maximum number of simultaneously loaded keys, if the key slot table is
+ * allowed to grow beyond #MBEDTLS_PSA_KEY_SLOT_COUNT.
+ *
+ * When all the key slots are in use, the library allocates
+ * #MBEDTLS_PSA_KEY_SLOT_COUNT more key slots on the heap, up to this limit.
+ * Once the limit is reached, the least recently used persistent key is
+ * evicted from memory to make room for a new key.
+ *
+ * This value also determines the size of the range of identifiers reserved
+ * for volatile keys. It must be at least #MBEDTLS_PSA_KEY_SLOT_COUNT.
+ *
+ * If this option is unset, it defaults to #MBEDTLS_PSA_KEY_SLOT_COUNT, so the
+ * key slot table never grows.
+ */
+//#define MBEDTLS_PSA_KEY_SLOT_MAX_COUNT 4096
+
+/* SSL asynchronous engine options */
+//#define MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH          8 /**< Maximum number of operations with the same key that a worker thread takes at once */
+
 /* SSL Cache options */
 //#define MBEDTLS_SSL_CACHE_DEFAULT_TIMEOUT       86400 /**< 1 day  */
 //#define MBEDTLS_SSL_CACHE_DEFAULT_MAX_ENTRIES      50 /**< Maximum entries in cache */
+//#define MBEDTLS_SSL_CACHE_SHARDS                   16 /**< Number of shards of an indexed cache */
 
 /* SSL options */
 
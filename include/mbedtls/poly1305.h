@@ -54,6 +54,8 @@ typedef struct mbedtls_poly1305_context
     uint32_t MBEDTLS_PRIVATE(acc)[5];    /** The accumulator number. */
     uint8_t MBEDTLS_PRIVATE(queue)[16];  /** The current partial block of data. */
     size_t MBEDTLS_PRIVATE(queue_len);   /** The number of bytes stored in 'queue'. */
+    uint64_t MBEDTLS_PRIVATE(r_pow)[4][3]; /** r, r^2, r^3 and r^4, if the
+                                             * implementation uses them. */
 }
 mbedtls_poly1305_context;
 
@@ -352,16 +352,36 @@ int mbedtls_psa_get_random( void *p_rng,
 #if defined(MBEDTLS_CTR_DRBG_C)
 #include "mbedtls/ctr_drbg.h"
 typedef mbedtls_ctr_drbg_context mbedtls_psa_drbg_context_t;
+#if !defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
 static mbedtls_f_rng_t *const mbedtls_psa_get_random = mbedtls_ctr_drbg_random;
+#endif
 #elif defined(MBEDTLS_HMAC_DRBG_C)
 #include "mbedtls/hmac_drbg.h"
 typedef mbedtls_hmac_drbg_context mbedtls_psa_drbg_context_t;
+#if !defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
 static mbedtls_f_rng_t *const mbedtls_psa_get_random = mbedtls_hmac_drbg_random;
 #endif
+#endif
+
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+
+/* With a per-thread PSA random generator, the DRBG instance is selected
+ * from the calling thread, so the state parameter is ignored. See the
+ * documentation of mbedtls_psa_get_random() above. */
+int mbedtls_psa_get_random( void *p_rng,
+                            unsigned char *output,
+                            size_t output_size );
+
+#define MBEDTLS_PSA_RANDOM_STATE NULL
+
+#else /* MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD */
+
 extern mbedtls_psa_drbg_context_t *const mbedtls_psa_random_state;
 
 #define MBEDTLS_PSA_RANDOM_STATE mbedtls_psa_random_state
 
+#endif /* MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD */
+
 #endif /* !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG) */
 
 #endif /* MBEDTLS_PSA_CRYPTO_C */
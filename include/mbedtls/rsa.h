@@ -115,6 +115,10 @@ typedef struct mbedtls_rsa_context
     mbedtls_mpi MBEDTLS_PRIVATE(Vi);             /*!<  The cached blinding value. */
     mbedtls_mpi MBEDTLS_PRIVATE(Vf);             /*!<  The cached un-blinding value. */
 
+    mbedtls_mpi_uint *MBEDTLS_PRIVATE(W);        /*!<  The cached working memory of
+                                                       private key operations. */
+    size_t MBEDTLS_PRIVATE(W_limbs);             /*!<  The size of \p W in limbs. */
+
     int MBEDTLS_PRIVATE(padding);                /*!< Selects padding mode:
                                      #MBEDTLS_RSA_PKCS_V15 for 1.5 padding and
                                      #MBEDTLS_RSA_PKCS_V21 for OAEP or PSS. */
@@ -427,6 +431,10 @@ size_t mbedtls_rsa_get_len( const mbedtls_rsa_context *ctx );
  * \note           mbedtls_rsa_init() must be called before this function,
  *                 to set up the RSA context.
  *
+ * \note           If #MBEDTLS_RSA_GEN_KEY_PARALLEL is enabled, this function
+ *                 searches for the two primes in two threads. \p f_rng is
+ *                 then called from both threads, but never concurrently.
+ *
  * \param ctx      The initialized RSA context used to hold the key.
  * \param f_rng    The RNG function to be used for key generation.
  *                 This is mandatory and must not be \c NULL.
@@ -570,6 +578,45 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
                  const unsigned char *input,
                  unsigned char *output );
 
+/**
+ * \brief          This function performs several RSA private key operations
+ *                 with the same key.
+ *
+ *                 Each operation is performed as by mbedtls_rsa_private(),
+ *                 with its own blinding values, but the context is locked
+ *                 only once to take the blinding values for the whole batch,
+ *                 and the working memory of the exponentiations is shared.
+ *
+ * \note           With #MBEDTLS_THREADING_C, mbedtls_rsa_private() and this
+ *                 function only hold the context's mutex while they update
+ *                 the blinding values and draw the random exponent blinding
+ *                 factors, so several threads can perform private key
+ *                 operations with the same context at the same time. Every
+ *                 call to \p f_rng is made under the mutex.
+ *
+ * \param ctx      The initialized RSA context to use.
+ * \param f_rng    The RNG function, used for blinding. It is mandatory.
+ * \param p_rng    The RNG context to pass to \p f_rng. This may be \c NULL
+ *                 if \p f_rng doesn't need a context.
+ * \param input    An array of \p count input buffers. Each of them must be
+ *                 a readable buffer of length \c ctx->len Bytes.
+ * \param output   An array of \p count output buffers. Each of them must be
+ *                 a writable buffer of length \c ctx->len Bytes. \c output[i]
+ *                 may be the same buffer as \c input[i], but must not
+ *                 overlap any other input buffer.
+ * \param count    The number of operations. This may be \c 0.
+ *
+ * \return         \c 0 on success.
+ * \return         An \c MBEDTLS_ERR_RSA_XXX error code on failure. The
+ *                 content of the output buffers is then unspecified.
+ */
+int mbedtls_rsa_private_batch( mbedtls_rsa_context *ctx,
+                 int (*f_rng)(void *, unsigned char *, size_t),
+                 void *p_rng,
+                 const unsigned char * const input[],
+                 unsigned char * const output[],
+                 size_t count );
+
 /**
  * \brief          This function adds the message padding, then performs an RSA
  *                 operation.
@@ -176,6 +176,40 @@ int mbedtls_sha256( const unsigned char *input,
                     unsigned char *output,
                     int is224 );
 
+/**
+ * \brief          This function calculates the SHA-224 or SHA-256
+ *                 checksums of several independent buffers.
+ *
+ *                 The result is the same as calling mbedtls_sha256() on
+ *                 each buffer in turn, but on platforms with suitable SIMD
+ *                 support (AVX2 on x86-64, Neon on Aarch64) the messages
+ *                 are hashed several at a time, one per vector lane. This
+ *                 is faster when there are many short messages to hash,
+ *                 for example hash chains or certificate fingerprints.
+ *
+ * \param input    An array of \p count buffers holding the data. Each
+ *                 \c input[i] must be a readable buffer of length
+ *                 \c ilen[i] Bytes.
+ * \param ilen     An array of \p count lengths, in Bytes.
+ * \param output   An array of \p count buffers for the SHA-224 or SHA-256
+ *                 checksum results. Each \c output[i] must be a writable
+ *                 buffer of length \c 32 bytes for SHA-256, \c 28 bytes
+ *                 for SHA-224. \c output[i] may be the same buffer as
+ *                 \c input[i], but must not otherwise overlap any of the
+ *                 input buffers.
+ * \param count    The number of messages to hash. This may be \c 0.
+ * \param is224    Determines which function to use. This must be
+ *                 either \c 0 for SHA-256, or \c 1 for SHA-224.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha256_multi( const unsigned char * const input[],
+                          const size_t ilen[],
+                          unsigned char * const output[],
+                          size_t count,
+                          int is224 );
+
 #if defined(MBEDTLS_SELF_TEST)
 
 /**
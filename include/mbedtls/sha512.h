@@ -187,6 +187,43 @@ int mbedtls_sha512( const unsigned char *input,
                     unsigned char *output,
                     int is384 );
 
+/**
+ * \brief          This function calculates the SHA-384 or SHA-512
+ *                 checksums of several independent buffers.
+ *
+ *                 The result is the same as calling mbedtls_sha512() on
+ *                 each buffer in turn, but on platforms with suitable SIMD
+ *                 support (AVX2 on x86-64, Neon on Aarch64) the messages
+ *                 are hashed several at a time, one per vector lane. This
+ *                 is faster when there are many short messages to hash.
+ *
+ * \param input    An array of \p count buffers holding the data. Each
+ *                 \c input[i] must be a readable buffer of length
+ *                 \c ilen[i] Bytes.
+ * \param ilen     An array of \p count lengths, in Bytes.
+ * \param output   An array of \p count buffers for the SHA-384 or SHA-512
+ *                 checksum results. Each \c output[i] must be a writable
+ *                 buffer of length \c 64 bytes for SHA-512, \c 48 bytes
+ *                 for SHA-384. \c output[i] may be the same buffer as
+ *                 \c input[i], but must not otherwise overlap any of the
+ *                 input buffers.
+ * \param count    The number of messages to hash. This may be \c 0.
+ * \param is384    Determines which function to use. This must be either
+ *                 \c 0 for SHA-512, or \c 1 for SHA-384.
+ *
+ * \note           When \c MBEDTLS_SHA384_C is not defined, \p is384 must
+ *                 be \c 0, or the function will return
+ *                 #MBEDTLS_ERR_SHA512_BAD_INPUT_DATA.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha512_multi( const unsigned char * const input[],
+                          const size_t ilen[],
+                          unsigned char * const output[],
+                          size_t count,
+                          int is384 );
+
 #if defined(MBEDTLS_SELF_TEST)
 
  /**
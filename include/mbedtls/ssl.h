@@ -1464,6 +1464,9 @@ struct mbedtls_ssl_config
 #if defined(MBEDTLS_DHM_C)
     mbedtls_mpi MBEDTLS_PRIVATE(dhm_P);              /*!< prime modulus for DHM              */
     mbedtls_mpi MBEDTLS_PRIVATE(dhm_G);              /*!< generator for DHM                  */
+#if defined(MBEDTLS_DHM_FIXED_BASE) && defined(MBEDTLS_SSL_SRV_C)
+    mbedtls_dhm_fixed_base MBEDTLS_PRIVATE(dhm_fixed_base); /*!< precomputed table for dhm_G */
+#endif
 #endif
 
 #if defined(MBEDTLS_SSL_HANDSHAKE_WITH_PSK_ENABLED)
@@ -3512,6 +3515,12 @@ void mbedtls_ssl_conf_psk_cb( mbedtls_ssl_config *conf,
  * \param dhm_G    Diffie-Hellman-Merkle generator in big-endian binary form
  * \param G_len    Length of DHM generator
  *
+ * \note           If #MBEDTLS_DHM_FIXED_BASE is enabled, this also
+ *                 precomputes a table for \p dhm_G, which the SSL contexts
+ *                 using this configuration share to generate their
+ *                 ephemeral keys. If the table cannot be set up, the keys
+ *                 are generated without it.
+ *
  * \return         0 if successful
  */
 int mbedtls_ssl_conf_dh_param_bin( mbedtls_ssl_config *conf,
@@ -3525,6 +3534,10 @@ int mbedtls_ssl_conf_dh_param_bin( mbedtls_ssl_config *conf,
  * \param conf     SSL configuration
  * \param dhm_ctx  Diffie-Hellman-Merkle context
  *
+ * \note           As for mbedtls_ssl_conf_dh_param_bin(), this also
+ *                 precomputes a table for the generator if
+ *                 #MBEDTLS_DHM_FIXED_BASE is enabled.
+ *
  * \return         0 if successful
  */
 int mbedtls_ssl_conf_dh_param_ctx( mbedtls_ssl_config *conf, mbedtls_dhm_context *dhm_ctx );
@@ -0,0 +1,243 @@
+/**
+ * \file ssl_async_engine.h
+ *
+ * \brief Asynchronous private key operations on a pool of worker threads
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef MBEDTLS_SSL_ASYNC_ENGINE_H
+#define MBEDTLS_SSL_ASYNC_ENGINE_H
+#include "mbedtls/private_access.h"
+
+#include "mbedtls/build_info.h"
+
+#include "mbedtls/ssl.h"
+
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+#include "mbedtls/threading.h"
+#endif
+
+/**
+ * \name SECTION: Module settings
+ *
+ * The configuration options you can set for this module are in this section.
+ * Either change them in mbedtls_config.h or define them on the compiler command line.
+ * \{
+ */
+#if !defined(MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH)
+#define MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH   8 /**< Maximum number of operations with the same key that a worker thread takes at once */
+#endif
+
+/** \} name SECTION: Module settings */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+
+typedef struct mbedtls_ssl_async_job mbedtls_ssl_async_job;
+
+/**
+ * \brief          Context for the built-in asynchronous private key engine.
+ *
+ *                 The engine performs the private key operations of TLS
+ *                 server handshakes on a pool of worker threads. It
+ *                 implements the callbacks of
+ *                 mbedtls_ssl_conf_async_private_cb(), and can be shared by
+ *                 any number of SSL contexts, through one or more SSL
+ *                 configurations.
+ *
+ *                 When an operation completes, the engine makes the file
+ *                 descriptor returned by mbedtls_ssl_async_engine_get_fd()
+ *                 readable. The application then calls
+ *                 mbedtls_ssl_async_engine_next_completed() to find out
+ *                 which handshakes it can resume.
+ */
+typedef struct mbedtls_ssl_async_engine
+{
+    int (*MBEDTLS_PRIVATE(f_rng))(void *, unsigned char *, size_t); /*!< RNG for the operations */
+    void *MBEDTLS_PRIVATE(p_rng);               /*!< Context for the RNG                */
+    pthread_mutex_t MBEDTLS_PRIVATE(mutex);     /*!< Protects everything below          */
+    pthread_cond_t MBEDTLS_PRIVATE(work);       /*!< Signalled when there is work       */
+    pthread_cond_t MBEDTLS_PRIVATE(done);       /*!< Signalled when a batch completes   */
+    pthread_t *MBEDTLS_PRIVATE(threads);        /*!< Worker threads                     */
+    size_t MBEDTLS_PRIVATE(thread_count);       /*!< Number of worker threads           */
+    const mbedtls_pk_context **MBEDTLS_PRIVATE(busy); /*!< Keys that a worker holds    */
+    mbedtls_ssl_async_job *MBEDTLS_PRIVATE(queue);    /*!< Operations to perform       */
+    mbedtls_ssl_async_job **MBEDTLS_PRIVATE(queue_tail);
+    size_t MBEDTLS_PRIVATE(queued);             /*!< Number of operations in the queue  */
+    mbedtls_ssl_async_job *MBEDTLS_PRIVATE(ready);    /*!< Completed, not yet reported */
+    mbedtls_ssl_async_job **MBEDTLS_PRIVATE(ready_tail);
+    int MBEDTLS_PRIVATE(fd)[2];                 /*!< Completion pipe                    */
+    int MBEDTLS_PRIVATE(stop);                  /*!< Asks the workers to exit           */
+} mbedtls_ssl_async_engine;
+
+/**
+ * \brief          Initialize an asynchronous engine context.
+ *
+ * \param engine   The context to initialize.
+ */
+void mbedtls_ssl_async_engine_init( mbedtls_ssl_async_engine *engine );
+
+/**
+ * \brief          Start the worker threads of an asynchronous engine.
+ *
+ *                 Then register the engine with each SSL configuration that
+ *                 should use it:
+ *                 \code
+ *                 mbedtls_ssl_conf_async_private_cb( &conf,
+ *                         mbedtls_ssl_async_engine_sign,
+ *                         mbedtls_ssl_async_engine_decrypt,
+ *                         mbedtls_ssl_async_engine_resume,
+ *                         mbedtls_ssl_async_engine_cancel,
+ *                         &engine );
+ *                 \endcode
+ *
+ * \note           The worker threads call \p f_rng concurrently with each
+ *                 other and with the application, so it must be thread-safe.
+ *                 This is the case of mbedtls_ctr_drbg_random() and
+ *                 mbedtls_hmac_drbg_random() with #MBEDTLS_THREADING_C.
+ *
+ * \param engine   The engine context to set up.
+ * \param threads  The number of worker threads. This must not be \c 0.
+ * \param f_rng    The RNG function, used for blinding and ECDSA nonces.
+ * \param p_rng    The RNG context.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if \p threads is \c 0 or
+ *                 \p f_rng is \c NULL.
+ * \return         #MBEDTLS_ERR_SSL_ALLOC_FAILED if memory, the worker
+ *                 threads or the completion pipe could not be allocated.
+ */
+int mbedtls_ssl_async_engine_setup( mbedtls_ssl_async_engine *engine,
+                                    size_t threads,
+                                    int (*f_rng)(void *, unsigned char *, size_t),
+                                    void *p_rng );
+
+/**
+ * \brief          Start callback for signatures, to pass to
+ *                 mbedtls_ssl_conf_async_private_cb().
+ *                 See ::mbedtls_ssl_async_sign_t.
+ *
+ *                 The engine signs with the private key that the SSL context
+ *                 selected with \p cert. It handles RSA keys (PKCS#1 v1.5)
+ *                 and EC keys. For other keys, such as opaque and RSA-alt
+ *                 keys, it returns #MBEDTLS_ERR_SSL_HW_ACCEL_FALLTHROUGH so
+ *                 that the handshake signs inline.
+ *
+ *                 Signatures with the same RSA key are batched with
+ *                 mbedtls_rsa_private_batch(). Operations with the same EC
+ *                 key are performed by one worker at a time, one after the
+ *                 other, since the precomputations cached in an EC key are
+ *                 not thread-safe.
+ */
+int mbedtls_ssl_async_engine_sign( mbedtls_ssl_context *ssl,
+                                   mbedtls_x509_crt *cert,
+                                   mbedtls_md_type_t md_alg,
+                                   const unsigned char *hash,
+                                   size_t hash_len );
+
+/**
+ * \brief          Start callback for decryptions, to pass to
+ *                 mbedtls_ssl_conf_async_private_cb().
+ *                 See ::mbedtls_ssl_async_decrypt_t.
+ *
+ *                 The worker threads only perform the RSA private key
+ *                 operation. The PKCS#1 v1.5 padding is removed in constant
+ *                 time by mbedtls_ssl_async_engine_resume(), so the time
+ *                 at which an operation is reported as completed does not
+ *                 depend on its padding.
+ */
+int mbedtls_ssl_async_engine_decrypt( mbedtls_ssl_context *ssl,
+                                      mbedtls_x509_crt *cert,
+                                      const unsigned char *input,
+                                      size_t input_len );
+
+/**
+ * \brief          Resume callback, to pass to
+ *                 mbedtls_ssl_conf_async_private_cb().
+ *                 See ::mbedtls_ssl_async_resume_t.
+ *
+ *                 This returns #MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS until a
+ *                 worker has completed the operation. It never blocks.
+ */
+int mbedtls_ssl_async_engine_resume( mbedtls_ssl_context *ssl,
+                                     unsigned char *output,
+                                     size_t *output_len,
+                                     size_t output_size );
+
+/**
+ * \brief          Cancel callback, to pass to
+ *                 mbedtls_ssl_conf_async_private_cb().
+ *                 See ::mbedtls_ssl_async_cancel_t.
+ *
+ *                 If a worker is performing the operation, this waits until
+ *                 it is done, so that the SSL context and its private key
+ *                 can be freed as soon as this function returns.
+ */
+void mbedtls_ssl_async_engine_cancel( mbedtls_ssl_context *ssl );
+
+/**
+ * \brief          Get the file descriptor that signals completions.
+ *
+ *                 The descriptor is readable whenever
+ *                 mbedtls_ssl_async_engine_next_completed() has a context to
+ *                 return. Add it to the set of descriptors that the event
+ *                 loop waits for (with \c poll(), \c epoll, etc.). Do not
+ *                 read from it or close it.
+ *
+ * \param engine   The engine context. It must be set up.
+ *
+ * \return         The file descriptor.
+ */
+int mbedtls_ssl_async_engine_get_fd( const mbedtls_ssl_async_engine *engine );
+
+/**
+ * \brief          Get an SSL context whose asynchronous operation has
+ *                 completed since the last call.
+ *
+ *                 Call mbedtls_ssl_handshake() on the returned context to
+ *                 resume its handshake. Call this function in a loop until it
+ *                 returns \c NULL: each context is only returned once.
+ *
+ * \param engine   The engine context.
+ *
+ * \return         An SSL context whose handshake can make progress, or
+ *                 \c NULL if there is none.
+ */
+mbedtls_ssl_context *mbedtls_ssl_async_engine_next_completed(
+                                        mbedtls_ssl_async_engine *engine );
+
+/**
+ * \brief          Stop the worker threads and free an engine context.
+ *
+ * \note           Free or reset the SSL contexts that use the engine first:
+ *                 the engine frees the operations that are still pending, and
+ *                 the SSL contexts must not refer to them afterwards.
+ *
+ * \param engine   The engine context to free. This may be \c NULL.
+ */
+void mbedtls_ssl_async_engine_free( mbedtls_ssl_async_engine *engine );
+
+#endif /* MBEDTLS_SSL_ASYNC_ENGINE_C */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ssl_async_engine.h */
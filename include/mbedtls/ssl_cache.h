@@ -47,6 +47,10 @@
 #define MBEDTLS_SSL_CACHE_DEFAULT_MAX_ENTRIES      50   /*!< Maximum entries in cache */
 #endif
 
+#if !defined(MBEDTLS_SSL_CACHE_SHARDS)
+#define MBEDTLS_SSL_CACHE_SHARDS                   16   /*!< Shards of an indexed cache */
+#endif
+
 /** \} name SECTION: Module settings */
 
 #ifdef __cplusplus
@@ -72,18 +76,59 @@ struct mbedtls_ssl_cache_entry
     size_t MBEDTLS_PRIVATE(session_len);
 
     mbedtls_ssl_cache_entry *MBEDTLS_PRIVATE(next);      /*!< chain pointer      */
+
+#if defined(MBEDTLS_SSL_CACHE_INDEXED)
+    mbedtls_ssl_cache_entry *MBEDTLS_PRIVATE(prev);      /*!< previous entry in
+                                                              the expiry list */
+    mbedtls_ssl_cache_entry *MBEDTLS_PRIVATE(bucket_next); /*!< hash bucket
+                                                                chain pointer */
+    uint32_t MBEDTLS_PRIVATE(hash);                      /*!< session ID hash */
+    uint64_t MBEDTLS_PRIVATE(seq);                       /*!< insertion order */
+#endif /* MBEDTLS_SSL_CACHE_INDEXED */
 };
 
+#if defined(MBEDTLS_SSL_CACHE_INDEXED)
+/**
+ * \brief   One shard of an indexed cache
+ *
+ * Entries are reachable both through the hash table \c buckets and
+ * through a doubly linked list sorted by insertion time (oldest first),
+ * which gives the next entry to expire or to evict in constant time.
+ */
+typedef struct mbedtls_ssl_cache_shard
+{
+    mbedtls_ssl_cache_entry **MBEDTLS_PRIVATE(buckets);  /*!< hash table       */
+    unsigned MBEDTLS_PRIVATE(bucket_bits);       /*!< log2 of the table size */
+    int MBEDTLS_PRIVATE(count);                  /*!< entries in this shard  */
+    mbedtls_ssl_cache_entry *MBEDTLS_PRIVATE(oldest);    /*!< expiry list head */
+    mbedtls_ssl_cache_entry *MBEDTLS_PRIVATE(newest);    /*!< expiry list tail */
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(mutex);    /*!< mutex            */
+#endif
+}
+mbedtls_ssl_cache_shard;
+#endif /* MBEDTLS_SSL_CACHE_INDEXED */
+
 /**
  * \brief Cache context
  */
 struct mbedtls_ssl_cache_context
 {
+#if defined(MBEDTLS_SSL_CACHE_INDEXED)
+    mbedtls_ssl_cache_shard MBEDTLS_PRIVATE(shards)[MBEDTLS_SSL_CACHE_SHARDS]; /*!< shards */
+#else
     mbedtls_ssl_cache_entry *MBEDTLS_PRIVATE(chain);     /*!< start of the chain     */
+#endif
     int MBEDTLS_PRIVATE(timeout);                /*!< cache entry timeout    */
     int MBEDTLS_PRIVATE(max_entries);            /*!< maximum entries        */
+#if defined(MBEDTLS_SSL_CACHE_INDEXED)
+    int MBEDTLS_PRIVATE(count);                  /*!< entries in all shards  */
+    uint64_t MBEDTLS_PRIVATE(seq);               /*!< next insertion number  */
+#endif
 #if defined(MBEDTLS_THREADING_C)
-    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(mutex);    /*!< mutex                  */
+    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(mutex);    /*!< mutex (with
+                                     MBEDTLS_SSL_CACHE_INDEXED, it only
+                                     protects \c count and \c seq) */
 #endif
 };
 
@@ -142,6 +187,11 @@ void mbedtls_ssl_cache_set_timeout( mbedtls_ssl_cache_context *cache, int timeou
  * \brief          Set the maximum number of cache entries
  *                 (Default: MBEDTLS_SSL_CACHE_DEFAULT_MAX_ENTRIES (50))
  *
+ * \note           With #MBEDTLS_SSL_CACHE_INDEXED, the maximum applies to
+ *                 the cache as a whole: when it is reached, the oldest entry
+ *                 of all shards is evicted. Lowering the maximum takes
+ *                 effect at the next insertion.
+ *
  * \param cache    SSL cache context
  * \param max      cache entry maximum
  */
@@ -109,6 +109,22 @@ extern mbedtls_threading_mutex_t mbedtls_threading_readdir_mutex;
 extern mbedtls_threading_mutex_t mbedtls_threading_gmtime_mutex;
 #endif /* MBEDTLS_HAVE_TIME_DATE && !MBEDTLS_PLATFORM_GMTIME_R_ALT */
 
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+/* This mutex protects the PSA key slot table: the index of the keys in
+ * memory, the lists of free and evictable slots and the lock counter of
+ * each key slot. It is not held while a key is in use. */
+extern mbedtls_threading_mutex_t mbedtls_threading_key_slot_mutex;
+
+/* This mutex serializes the accesses to persistent key storage: loading,
+ * saving and destroying persistent keys. It is taken before
+ * mbedtls_threading_key_slot_mutex, never while holding it. */
+extern mbedtls_threading_mutex_t mbedtls_threading_key_storage_mutex;
+
+/* This mutex protects the initialization state of the PSA subsystem,
+ * in psa_crypto_init() and mbedtls_psa_crypto_free(). */
+extern mbedtls_threading_mutex_t mbedtls_threading_psa_globaldata_mutex;
+#endif /* MBEDTLS_PSA_CRYPTO_C */
+
 #endif /* MBEDTLS_THREADING_C */
 
 #ifdef __cplusplus
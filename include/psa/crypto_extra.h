@@ -46,6 +46,11 @@ extern "C" {
 #define MBEDTLS_PSA_KEY_SLOT_COUNT 32
 #endif
 
+/* See mbedtls_config.h for definition */
+#if !defined(MBEDTLS_PSA_KEY_SLOT_MAX_COUNT)
+#define MBEDTLS_PSA_KEY_SLOT_MAX_COUNT MBEDTLS_PSA_KEY_SLOT_COUNT
+#endif
+
 /** \addtogroup attributes
  * @{
  */
@@ -812,6 +817,72 @@ psa_status_t mbedtls_psa_platform_get_builtin_key(
 
 /** @} */
 
+/** \defgroup psa_batch_verify Batch signature verification
+ * @{
+ */
+
+/**
+ * \brief Verify several hash signatures at once.
+ *
+ * This function gives the same results as calling psa_verify_hash() on
+ * each (\p keys[i], \p hashes[i], \p signatures[i]) with the algorithm
+ * \p alg, but it can be faster. In particular, for ECDSA with keys in
+ * local storage, consecutive signatures made with keys of the same type
+ * and size are verified together with mbedtls_ecdsa_verify_batch().
+ *
+ * \note This function is not part of the PSA Cryptography API.
+ *
+ * \param[in] keys              The identifiers of the keys to use. Each key
+ *                              must be a public key or an asymmetric key
+ *                              pair, and must allow the usage
+ *                              #PSA_KEY_USAGE_VERIFY_HASH and the algorithm
+ *                              \p alg.
+ * \param alg                   A signature algorithm that is compatible
+ *                              with the types of the keys
+ *                              (#PSA_ALG_IS_SIGN_HASH(\p alg) is true).
+ * \param[in] hashes            The hashes whose signatures are to be
+ *                              verified.
+ * \param[in] hash_lengths      The sizes of the \p hashes in bytes.
+ * \param[in] signatures        The signatures to verify.
+ * \param[in] signature_lengths The sizes of the \p signatures in bytes.
+ * \param count                 The number of signatures.
+ * \param[out] results          A bitmap of (\p count + 7) / 8 bytes. On
+ *                              #PSA_SUCCESS or #PSA_ERROR_INVALID_SIGNATURE,
+ *                              bit (i % 8) of \p results[i / 8] is set if
+ *                              and only if signature i is valid.
+ *
+ * \retval #PSA_SUCCESS
+ *         All the signatures are valid.
+ * \retval #PSA_ERROR_INVALID_SIGNATURE
+ *         The calculation was performed successfully, but at least one
+ *         signature is not valid. \p results tells which.
+ * \retval #PSA_ERROR_INVALID_HANDLE
+ * \retval #PSA_ERROR_NOT_PERMITTED
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ * \retval #PSA_ERROR_INVALID_ARGUMENT
+ * \retval #PSA_ERROR_INSUFFICIENT_MEMORY
+ * \retval #PSA_ERROR_COMMUNICATION_FAILURE
+ * \retval #PSA_ERROR_HARDWARE_FAILURE
+ * \retval #PSA_ERROR_CORRUPTION_DETECTED
+ * \retval #PSA_ERROR_STORAGE_FAILURE
+ * \retval #PSA_ERROR_DATA_CORRUPT
+ * \retval #PSA_ERROR_DATA_INVALID
+ * \retval #PSA_ERROR_BAD_STATE
+ *         The library has not been previously initialized by psa_crypto_init().
+ *         It is implementation-dependent whether a failure to initialize
+ *         results in this error code.
+ */
+psa_status_t mbedtls_psa_verify_hash_batch( const mbedtls_svc_key_id_t keys[],
+                                            psa_algorithm_t alg,
+                                            const uint8_t * const hashes[],
+                                            const size_t hash_lengths[],
+                                            const uint8_t * const signatures[],
+                                            const size_t signature_lengths[],
+                                            size_t count,
+                                            uint8_t *results );
+
+/** @} */
+
 /** \addtogroup crypto_types
  * @{
  */
@@ -1000,6 +1000,12 @@ int mbedtls_aes_crypt_cbc( mbedtls_aes_context *ctx,
     }
 #endif
 
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mode == MBEDTLS_AES_DECRYPT &&
+        mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+        return( mbedtls_aesni_crypt_cbc_dec( ctx, length, iv, input, output ) );
+#endif
+
     if( mode == MBEDTLS_AES_DECRYPT )
     {
         while( length > 0 )
@@ -1104,6 +1110,42 @@ int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
     if( ret != 0 )
         return( ret );
 
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+    {
+        /* Process groups of four blocks with the multi-block AES-NI kernel.
+         * Leave the last full block to the loop below if it needs the
+         * special tweak handling of ciphertext stealing. */
+        unsigned char tweaks[64];
+        unsigned char buf[64];
+        size_t i;
+
+        while( blocks > 4 || ( blocks == 4 && ! leftover ) )
+        {
+            for( i = 0; i < 64; i += 16 )
+            {
+                memcpy( tweaks + i, tweak, 16 );
+                mbedtls_gf128mul_x_ble( tweak, tweak );
+            }
+
+            for( i = 0; i < 64; i++ )
+                buf[i] = input[i] ^ tweaks[i];
+
+            ret = mbedtls_aesni_crypt_ecb_blocks( &ctx->crypt, mode, 4,
+                                                  buf, buf );
+            if( ret != 0 )
+                return( ret );
+
+            for( i = 0; i < 64; i++ )
+                output[i] = buf[i] ^ tweaks[i];
+
+            output += 64;
+            input += 64;
+            blocks -= 4;
+        }
+    }
+#endif
+
     while( blocks-- )
     {
         size_t i;
@@ -1342,6 +1384,33 @@ int mbedtls_aes_crypt_ctr( mbedtls_aes_context *ctx,
     if ( n > 0x0F )
         return( MBEDTLS_ERR_AES_BAD_INPUT_DATA );
 
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+    {
+        /* Use up the current stream block, then let the multi-block AES-NI
+         * kernel process whole blocks. The loop below takes care of the
+         * remaining bytes. */
+        while( n != 0 && length > 0 )
+        {
+            c = *input++;
+            *output++ = (unsigned char)( c ^ stream_block[n] );
+            n = ( n + 1 ) & 0x0F;
+            length--;
+        }
+
+        if( length >= 16 )
+        {
+            ret = mbedtls_aesni_crypt_ctr( ctx, length / 16, nonce_counter,
+                                           input, output );
+            if( ret != 0 )
+                goto exit;
+            input  += length & ~(size_t) 0x0F;
+            output += length & ~(size_t) 0x0F;
+            length &= 0x0F;
+        }
+    }
+#endif
+
     while( length-- )
     {
         if( n == 0 ) {
@@ -34,6 +34,11 @@
 
 #include "aesni.h"
 
+#if defined(MBEDTLS_GCM_C)
+#include "mbedtls/gcm.h"
+#endif
+#include "mbedtls/platform_util.h"
+
 #include <string.h>
 
 #ifndef asm
@@ -88,6 +93,12 @@ int mbedtls_aesni_has_support( unsigned int what )
 #define xmm0_xmm4   "0xE0"
 #define xmm1_xmm0   "0xC1"
 #define xmm1_xmm2   "0xD1"
+#define xmm1_xmm3   "0xD9"
+#define xmm1_xmm4   "0xE1"
+#define xmm4_xmm0   "0xC4"
+#define xmm4_xmm1   "0xCC"
+#define xmm4_xmm2   "0xD4"
+#define xmm4_xmm3   "0xDC"
 
 /*
  * AES-NI AES-ECB block en(de)cryption
@@ -134,6 +145,220 @@ int mbedtls_aesni_crypt_ecb( mbedtls_aes_context *ctx,
     return( 0 );
 }
 
+/*
+ * AES-NI AES-ECB en(de)cryption of 4 consecutive blocks
+ *
+ * The four blocks go through each round back to back, so that the latency
+ * of one AESENC/AESDEC instruction is hidden behind the other three.
+ */
+static void aesni_crypt_ecb_4( const mbedtls_aes_context *ctx,
+                               int mode,
+                               const unsigned char input[64],
+                               unsigned char output[64] )
+{
+    int rounds = ctx->nr;
+    const uint32_t *rk = ctx->buf + ctx->rk_offset;
+
+    /* volatile: the outputs are only scratch registers, but the statement
+     * must not be optimized away since it writes to memory. */
+    asm volatile( "movdqu    (%3), %%xmm0    \n\t" // load input
+                  "movdqu  16(%3), %%xmm1    \n\t"
+                  "movdqu  32(%3), %%xmm2    \n\t"
+                  "movdqu  48(%3), %%xmm3    \n\t"
+                  "movdqu    (%1), %%xmm4    \n\t" // load round key 0
+                  "pxor      %%xmm4, %%xmm0  \n\t" // round 0
+                  "pxor      %%xmm4, %%xmm1  \n\t"
+                  "pxor      %%xmm4, %%xmm2  \n\t"
+                  "pxor      %%xmm4, %%xmm3  \n\t"
+                  "add       $16, %1         \n\t" // point to next round key
+                  "subl      $1, %0          \n\t" // normal rounds = nr - 1
+                  "test      %2, %2          \n\t" // mode?
+                  "jz        2f              \n\t" // 0 = decrypt
+
+                  "1:                        \n\t" // encryption loop
+                  "movdqu    (%1), %%xmm4    \n\t" // load round key
+                  AESENC     xmm4_xmm0      "\n\t" // do round
+                  AESENC     xmm4_xmm1      "\n\t"
+                  AESENC     xmm4_xmm2      "\n\t"
+                  AESENC     xmm4_xmm3      "\n\t"
+                  "add       $16, %1         \n\t" // point to next round key
+                  "subl      $1, %0          \n\t" // loop
+                  "jnz       1b              \n\t"
+                  "movdqu    (%1), %%xmm4    \n\t" // load round key
+                  AESENCLAST xmm4_xmm0      "\n\t" // last round
+                  AESENCLAST xmm4_xmm1      "\n\t"
+                  AESENCLAST xmm4_xmm2      "\n\t"
+                  AESENCLAST xmm4_xmm3      "\n\t"
+                  "jmp       3f              \n\t"
+
+                  "2:                        \n\t" // decryption loop
+                  "movdqu    (%1), %%xmm4    \n\t"
+                  AESDEC     xmm4_xmm0      "\n\t" // do round
+                  AESDEC     xmm4_xmm1      "\n\t"
+                  AESDEC     xmm4_xmm2      "\n\t"
+                  AESDEC     xmm4_xmm3      "\n\t"
+                  "add       $16, %1         \n\t"
+                  "subl      $1, %0          \n\t"
+                  "jnz       2b              \n\t"
+                  "movdqu    (%1), %%xmm4    \n\t" // load round key
+                  AESDECLAST xmm4_xmm0      "\n\t" // last round
+                  AESDECLAST xmm4_xmm1      "\n\t"
+                  AESDECLAST xmm4_xmm2      "\n\t"
+                  AESDECLAST xmm4_xmm3      "\n\t"
+
+                  "3:                        \n\t"
+                  "movdqu    %%xmm0,   (%4)  \n\t" // export output
+                  "movdqu    %%xmm1, 16(%4)  \n\t"
+                  "movdqu    %%xmm2, 32(%4)  \n\t"
+                  "movdqu    %%xmm3, 48(%4)  \n\t"
+                  : "+r" (rounds), "+r" (rk)
+                  : "r" (mode), "r" (input), "r" (output)
+                  : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4" );
+}
+
+/*
+ * r = a XOR b, for a length that is a multiple of 8 bytes
+ */
+static void aesni_xor( unsigned char *r,
+                       const unsigned char *a,
+                       const unsigned char *b,
+                       size_t n )
+{
+    uint64_t x, y;
+    size_t i;
+
+    for( i = 0; i < n; i += 8 )
+    {
+        memcpy( &x, a + i, 8 );
+        memcpy( &y, b + i, 8 );
+        x ^= y;
+        memcpy( r + i, &x, 8 );
+    }
+}
+
+/*
+ * AES-NI AES-ECB en(de)cryption of a sequence of blocks
+ */
+int mbedtls_aesni_crypt_ecb_blocks( mbedtls_aes_context *ctx,
+                                    int mode,
+                                    size_t blocks,
+                                    const unsigned char *input,
+                                    unsigned char *output )
+{
+    for( ; blocks >= 4; blocks -= 4 )
+    {
+        aesni_crypt_ecb_4( ctx, mode, input, output );
+        input  += 64;
+        output += 64;
+    }
+
+    for( ; blocks > 0; blocks-- )
+    {
+        mbedtls_aesni_crypt_ecb( ctx, mode, input, output );
+        input  += 16;
+        output += 16;
+    }
+
+    return( 0 );
+}
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+/*
+ * AES-NI AES-CBC decryption
+ *
+ * Unlike encryption, CBC decryption of each block only depends on
+ * ciphertext, so four blocks can be deciphered in parallel.
+ */
+int mbedtls_aesni_crypt_cbc_dec( mbedtls_aes_context *ctx,
+                                 size_t length,
+                                 unsigned char iv[16],
+                                 const unsigned char *input,
+                                 unsigned char *output )
+{
+    unsigned char ciphertext[64];
+    unsigned char plaintext[64];
+    size_t chunk;
+
+    while( length > 0 )
+    {
+        chunk = length >= 64 ? 64 : 16;
+
+        /* Keep a copy of the ciphertext: input and output may overlap. */
+        memcpy( ciphertext, input, chunk );
+        if( chunk == 64 )
+            aesni_crypt_ecb_4( ctx, MBEDTLS_AES_DECRYPT, ciphertext, plaintext );
+        else
+            mbedtls_aesni_crypt_ecb( ctx, MBEDTLS_AES_DECRYPT,
+                                     ciphertext, plaintext );
+
+        aesni_xor( output, plaintext, iv, 16 );
+        aesni_xor( output + 16, plaintext + 16, ciphertext, chunk - 16 );
+
+        memcpy( iv, ciphertext + chunk - 16, 16 );
+
+        input  += chunk;
+        output += chunk;
+        length -= chunk;
+    }
+
+    return( 0 );
+}
+#endif /* MBEDTLS_CIPHER_MODE_CBC */
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+/*
+ * AES-NI AES-CTR encryption of whole blocks
+ */
+int mbedtls_aesni_crypt_ctr( mbedtls_aes_context *ctx,
+                             size_t blocks,
+                             unsigned char nonce_counter[16],
+                             const unsigned char *input,
+                             unsigned char *output )
+{
+    unsigned char counters[64];
+    unsigned char stream[64];
+    uint32_t low;
+    size_t i, n;
+    int j;
+
+    while( blocks > 0 )
+    {
+        n = blocks >= 4 ? 4 : 1;
+        low = MBEDTLS_GET_UINT32_BE( nonce_counter, 12 );
+
+        for( i = 0; i < n; i++ )
+        {
+            memcpy( counters + 16 * i, nonce_counter, 16 );
+            if( low != 0xFFFFFFFF )
+            {
+                /* Common case: no carry out of the low 32 bits. */
+                low++;
+                MBEDTLS_PUT_UINT32_BE( low, nonce_counter, 12 );
+                continue;
+            }
+            for( j = 16; j > 0; j-- )
+                if( ++nonce_counter[j - 1] != 0 )
+                    break;
+            low = MBEDTLS_GET_UINT32_BE( nonce_counter, 12 );
+        }
+
+        if( n == 4 )
+            aesni_crypt_ecb_4( ctx, MBEDTLS_AES_ENCRYPT, counters, stream );
+        else
+            mbedtls_aesni_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT,
+                                     counters, stream );
+
+        aesni_xor( output, input, stream, 16 * n );
+
+        input  += 16 * n;
+        output += 16 * n;
+        blocks -= n;
+    }
+
+    return( 0 );
+}
+#endif /* MBEDTLS_CIPHER_MODE_CTR */
+
 /*
  * GCM multiplication: c = a times b in GF(2^128)
  * Based on [CLMUL-WP] algorithms 1 (with equation 27) and 5.
@@ -246,6 +471,234 @@ void mbedtls_aesni_gcm_mult( unsigned char c[16],
     return;
 }
 
+#if defined(MBEDTLS_GCM_C)
+/* Mask for PSHUFB to reverse the byte order of an XMM register */
+static const unsigned char aesni_bswap_mask[16] =
+{
+    15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+};
+
+/*
+ * GHASH of 1 to 8 blocks with a single reduction:
+ * x = ( x + X_1 ) * H^n + X_2 * H^(n-1) + ... + X_n * H
+ *
+ * h_pow points to the n byte-reversed powers H^n, ..., H^1. The products
+ * are summed unreduced, since the shift and reduction steps of
+ * mbedtls_aesni_gcm_mult() are linear and can be applied once to the sum.
+ */
+static void aesni_ghash_n( unsigned char x[16],
+                           const unsigned char *h_pow,
+                           const unsigned char *input,
+                           size_t n )
+{
+    asm volatile( "movdqu (%4), %%xmm7              \n\t" // byte reversal mask
+                  "movdqu (%3), %%xmm0              \n\t" // x
+                  "pshufb %%xmm7, %%xmm0            \n\t"
+                  "pxor %%xmm5, %%xmm5              \n\t" // sum, low half
+                  "pxor %%xmm6, %%xmm6              \n\t" // sum, high half
+
+                  "1:                               \n\t"
+                  "movdqu (%1), %%xmm1              \n\t" // a = X_i
+                  "pshufb %%xmm7, %%xmm1            \n\t"
+                  "pxor %%xmm0, %%xmm1              \n\t" // (+ x for i = 1)
+                  "movdqu (%0), %%xmm2              \n\t" // b = H^(n+1-i)
+                  "movdqa %%xmm2, %%xmm3            \n\t"
+                  "movdqa %%xmm2, %%xmm4            \n\t"
+                  "movdqa %%xmm2, %%xmm0            \n\t"
+                  PCLMULQDQ xmm1_xmm2 ",0x00         \n\t" // a0*b0 = c1:c0
+                  PCLMULQDQ xmm1_xmm4 ",0x11         \n\t" // a1*b1 = d1:d0
+                  PCLMULQDQ xmm1_xmm3 ",0x10         \n\t" // a1*b0 = e1:e0
+                  PCLMULQDQ xmm1_xmm0 ",0x01         \n\t" // a0*b1 = f1:f0
+                  "pxor %%xmm0, %%xmm3              \n\t" // e1+f1:e0+f0
+                  "movdqa %%xmm3, %%xmm0            \n\t"
+                  "pslldq $8, %%xmm3                \n\t" // e0+f0:0
+                  "psrldq $8, %%xmm0                \n\t" // 0:e1+f1
+                  "pxor %%xmm3, %%xmm2              \n\t" // c1+e0+f0:c0
+                  "pxor %%xmm0, %%xmm4              \n\t" // d1:d0+e1+f1
+                  "pxor %%xmm2, %%xmm5              \n\t" // accumulate
+                  "pxor %%xmm4, %%xmm6              \n\t"
+                  "pxor %%xmm0, %%xmm0              \n\t" // x only goes
+                  "add $16, %0                      \n\t" // into X_1
+                  "add $16, %1                      \n\t"
+                  "sub $1, %2                       \n\t"
+                  "jnz 1b                           \n\t"
+
+                  /*
+                   * Shift the sum one bit to the left and reduce it as in
+                   * mbedtls_aesni_gcm_mult().
+                   */
+                  "movdqa %%xmm5, %%xmm1            \n\t" // r1:r0
+                  "movdqa %%xmm6, %%xmm2            \n\t" // r3:r2
+                  "movdqa %%xmm1, %%xmm3            \n\t"
+                  "movdqa %%xmm2, %%xmm4            \n\t"
+                  "psllq $1, %%xmm1                 \n\t"
+                  "psllq $1, %%xmm2                 \n\t"
+                  "psrlq $63, %%xmm3                \n\t"
+                  "psrlq $63, %%xmm4                \n\t"
+                  "movdqa %%xmm3, %%xmm5            \n\t"
+                  "pslldq $8, %%xmm3                \n\t"
+                  "pslldq $8, %%xmm4                \n\t"
+                  "psrldq $8, %%xmm5                \n\t"
+                  "por %%xmm3, %%xmm1               \n\t"
+                  "por %%xmm4, %%xmm2               \n\t"
+                  "por %%xmm5, %%xmm2               \n\t" // x3:x2:x1:x0
+
+                  "movdqa %%xmm1, %%xmm3            \n\t"
+                  "movdqa %%xmm1, %%xmm4            \n\t"
+                  "movdqa %%xmm1, %%xmm5            \n\t"
+                  "psllq $63, %%xmm3                \n\t"
+                  "psllq $62, %%xmm4                \n\t"
+                  "psllq $57, %%xmm5                \n\t"
+                  "pxor %%xmm4, %%xmm3              \n\t"
+                  "pxor %%xmm5, %%xmm3              \n\t"
+                  "pslldq $8, %%xmm3                \n\t"
+                  "pxor %%xmm3, %%xmm1              \n\t" // d:x0
+
+                  "movdqa %%xmm1, %%xmm0            \n\t"
+                  "movdqa %%xmm1, %%xmm4            \n\t"
+                  "movdqa %%xmm1, %%xmm5            \n\t"
+                  "psrlq $1, %%xmm0                 \n\t"
+                  "psrlq $2, %%xmm4                 \n\t"
+                  "psrlq $7, %%xmm5                 \n\t"
+                  "pxor %%xmm4, %%xmm0              \n\t"
+                  "pxor %%xmm5, %%xmm0              \n\t"
+                  "movdqa %%xmm1, %%xmm3            \n\t"
+                  "movdqa %%xmm1, %%xmm4            \n\t"
+                  "movdqa %%xmm1, %%xmm5            \n\t"
+                  "psllq $63, %%xmm3                \n\t"
+                  "psllq $62, %%xmm4                \n\t"
+                  "psllq $57, %%xmm5                \n\t"
+                  "pxor %%xmm4, %%xmm3              \n\t"
+                  "pxor %%xmm5, %%xmm3              \n\t"
+                  "psrldq $8, %%xmm3                \n\t"
+                  "pxor %%xmm3, %%xmm0              \n\t"
+                  "pxor %%xmm1, %%xmm0              \n\t"
+                  "pxor %%xmm2, %%xmm0              \n\t" // reduced sum
+
+                  "pshufb %%xmm7, %%xmm0            \n\t"
+                  "movdqu %%xmm0, (%3)              \n\t"
+                  : "+r" (h_pow), "+r" (input), "+r" (n)
+                  : "r" (x), "r" (aesni_bswap_mask)
+                  : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+                    "xmm5", "xmm6", "xmm7" );
+}
+
+/*
+ * Precompute the powers of H for the GHASH kernels
+ */
+void mbedtls_aesni_gcm_powers( unsigned char h_pow[8][16],
+                               const unsigned char h[16] )
+{
+    unsigned char p[16];
+    size_t i, j;
+
+    memcpy( p, h, 16 );
+    for( i = 8; i > 0; i-- )
+    {
+        /* h_pow[i - 1] = H^(9 - i), byte-reversed */
+        for( j = 0; j < 16; j++ )
+            h_pow[i - 1][j] = p[15 - j];
+        mbedtls_aesni_gcm_mult( p, p, h );
+    }
+
+    mbedtls_platform_zeroize( p, sizeof( p ) );
+}
+
+/*
+ * GHASH of whole blocks, eight at a time
+ */
+void mbedtls_aesni_gcm_ghash( unsigned char x[16],
+                              const unsigned char h_pow[8][16],
+                              const unsigned char *input,
+                              size_t blocks )
+{
+    size_t n;
+
+    while( blocks > 0 )
+    {
+        n = blocks >= 8 ? 8 : blocks;
+        aesni_ghash_n( x, h_pow[8 - n], input, n );
+
+        input  += 16 * n;
+        blocks -= n;
+    }
+}
+
+/*
+ * GCM encryption or decryption of whole blocks
+ *
+ * Each batch of up to 8 counter blocks is encrypted with the 4-way
+ * kernel and hashed with a single reduction. When encrypting, the
+ * ciphertext of a batch is hashed after the keystream of the next batch
+ * has been computed, so that the AES and CLMUL units work in parallel.
+ */
+int mbedtls_aesni_gcm_crypt( mbedtls_aes_context *ctx,
+                             int mode,
+                             size_t blocks,
+                             unsigned char y[16],
+                             const unsigned char h_pow[8][16],
+                             unsigned char x[16],
+                             const unsigned char *input,
+                             unsigned char *output )
+{
+    unsigned char counters[128];
+    unsigned char stream[128];
+    const unsigned char *pending = NULL;
+    size_t pending_n = 0;
+    uint32_t ctr;
+    size_t i, n;
+
+    ctr = MBEDTLS_GET_UINT32_BE( y, 12 );
+
+    while( blocks > 0 )
+    {
+        n = blocks >= 8 ? 8 : blocks;
+
+        for( i = 0; i < n; i++ )
+        {
+            /* Only the low 32 bits are incremented, modulo 2^32 */
+            ctr++;
+            memcpy( counters + 16 * i, y, 12 );
+            MBEDTLS_PUT_UINT32_BE( ctr, counters, 16 * i + 12 );
+        }
+
+        for( i = 0; i + 4 <= n; i += 4 )
+            aesni_crypt_ecb_4( ctx, MBEDTLS_AES_ENCRYPT,
+                               counters + 16 * i, stream + 16 * i );
+        for( ; i < n; i++ )
+            mbedtls_aesni_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT,
+                                     counters + 16 * i, stream + 16 * i );
+
+        if( mode == MBEDTLS_GCM_DECRYPT )
+        {
+            aesni_ghash_n( x, h_pow[8 - n], input, n );
+        }
+        else if( pending_n > 0 )
+        {
+            aesni_ghash_n( x, h_pow[8 - pending_n], pending, pending_n );
+        }
+
+        aesni_xor( output, input, stream, 16 * n );
+
+        pending = output;
+        pending_n = n;
+
+        input  += 16 * n;
+        output += 16 * n;
+        blocks -= n;
+    }
+
+    if( mode == MBEDTLS_GCM_ENCRYPT && pending_n > 0 )
+        aesni_ghash_n( x, h_pow[8 - pending_n], pending, pending_n );
+
+    MBEDTLS_PUT_UINT32_BE( ctr, y, 12 );
+
+    mbedtls_platform_zeroize( stream, sizeof( stream ) );
+
+    return( 0 );
+}
+#endif /* MBEDTLS_GCM_C */
+
 /*
  * Compute decryption round keys from encryption round keys
  */
@@ -75,6 +75,74 @@ int mbedtls_aesni_crypt_ecb( mbedtls_aes_context *ctx,
                              const unsigned char input[16],
                              unsigned char output[16] );
 
+/**
+ * \brief          Internal AES-NI AES-ECB en(de)cryption of several blocks
+ *
+ * \note           This function is only for internal use by other library
+ *                 functions; you must not call it directly.
+ *
+ * \param ctx      AES context
+ * \param mode     MBEDTLS_AES_ENCRYPT or MBEDTLS_AES_DECRYPT
+ * \param blocks   Number of 16-byte blocks to process
+ * \param input    Input buffer of \p blocks * 16 bytes
+ * \param output   Output buffer of \p blocks * 16 bytes. This may be
+ *                 the same as \p input but must not otherwise overlap it.
+ *
+ * \return         0 on success (cannot fail)
+ */
+int mbedtls_aesni_crypt_ecb_blocks( mbedtls_aes_context *ctx,
+                                    int mode,
+                                    size_t blocks,
+                                    const unsigned char *input,
+                                    unsigned char *output );
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+/**
+ * \brief          Internal AES-NI AES-CBC decryption
+ *
+ * \note           This function is only for internal use by other library
+ *                 functions; you must not call it directly.
+ *
+ * \param ctx      AES context, set up for decryption
+ * \param length   Length of the input data, a multiple of 16
+ * \param iv       Initialization vector, updated after use
+ * \param input    Buffer holding the ciphertext
+ * \param output   Buffer holding the plaintext. This may be the same
+ *                 as \p input but must not otherwise overlap it.
+ *
+ * \return         0 on success (cannot fail)
+ */
+int mbedtls_aesni_crypt_cbc_dec( mbedtls_aes_context *ctx,
+                                 size_t length,
+                                 unsigned char iv[16],
+                                 const unsigned char *input,
+                                 unsigned char *output );
+#endif /* MBEDTLS_CIPHER_MODE_CBC */
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+/**
+ * \brief          Internal AES-NI AES-CTR en(de)cryption of whole blocks
+ *
+ * \note           This function is only for internal use by other library
+ *                 functions; you must not call it directly.
+ *
+ * \param ctx      AES context, set up for encryption
+ * \param blocks   Number of 16-byte blocks to process
+ * \param nonce_counter The 128-bit counter block, incremented once
+ *                 per block
+ * \param input    Input buffer of \p blocks * 16 bytes
+ * \param output   Output buffer of \p blocks * 16 bytes. This may be
+ *                 the same as \p input but must not otherwise overlap it.
+ *
+ * \return         0 on success (cannot fail)
+ */
+int mbedtls_aesni_crypt_ctr( mbedtls_aes_context *ctx,
+                             size_t blocks,
+                             unsigned char nonce_counter[16],
+                             const unsigned char *input,
+                             unsigned char *output );
+#endif /* MBEDTLS_CIPHER_MODE_CTR */
+
 /**
  * \brief          Internal GCM multiplication: c = a * b in GF(2^128)
  *
@@ -92,6 +160,69 @@ void mbedtls_aesni_gcm_mult( unsigned char c[16],
                              const unsigned char a[16],
                              const unsigned char b[16] );
 
+#if defined(MBEDTLS_GCM_C)
+/**
+ * \brief          Internal computation of the powers of the GHASH key
+ *
+ * \note           This function is only for internal use by other library
+ *                 functions; you must not call it directly.
+ *
+ * \param h_pow    On output, H^8, H^7, ..., H^1 in the internal
+ *                 representation of the GHASH kernels
+ * \param h        The hash subkey H, as a GCM bit string
+ */
+void mbedtls_aesni_gcm_powers( unsigned char h_pow[8][16],
+                               const unsigned char h[16] );
+
+/**
+ * \brief          Internal GHASH update with whole blocks
+ *
+ * \note           This function is only for internal use by other library
+ *                 functions; you must not call it directly.
+ *
+ * \param x        The GHASH state, updated in place
+ * \param h_pow    Powers of H from mbedtls_aesni_gcm_powers()
+ * \param input    Input buffer of \p blocks * 16 bytes
+ * \param blocks   Number of 16-byte blocks to hash
+ */
+void mbedtls_aesni_gcm_ghash( unsigned char x[16],
+                              const unsigned char h_pow[8][16],
+                              const unsigned char *input,
+                              size_t blocks );
+
+/**
+ * \brief          Internal AES-GCM en(de)cryption of whole blocks
+ *
+ *                 This generates the CTR keystream and updates GHASH
+ *                 over the ciphertext, eight blocks at a time.
+ *
+ * \note           This function is only for internal use by other library
+ *                 functions; you must not call it directly.
+ *
+ * \param ctx      AES context, set up for encryption
+ * \param mode     MBEDTLS_GCM_ENCRYPT or MBEDTLS_GCM_DECRYPT
+ * \param blocks   Number of 16-byte blocks to process
+ * \param y        The counter block. Its low 32 bits are incremented
+ *                 before each block, modulo 2^32.
+ * \param h_pow    Powers of H from mbedtls_aesni_gcm_powers()
+ * \param x        The GHASH state, updated in place
+ * \param input    Input buffer of \p blocks * 16 bytes
+ * \param output   Output buffer of \p blocks * 16 bytes. This may be
+ *                 the same as \p input or start before it, but must not
+ *                 otherwise overlap it.
+ *
+ * \return         0 on success (cannot fail)
+ */
+int mbedtls_aesni_gcm_crypt( mbedtls_aes_context *ctx,
+                             int mode,
+                             size_t blocks,
+                             unsigned char y[16],
+                             const unsigned char h_pow[8][16],
+                             unsigned char x[16],
+                             const unsigned char *input,
+                             unsigned char *output );
+#endif /* MBEDTLS_GCM_C */
+
 /**
  * \brief           Internal round key inversion. This function computes
  *                  decryption round keys from the encryption round keys.
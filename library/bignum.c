@@ -39,6 +39,7 @@
 
 #include "mbedtls/bignum.h"
 #include "bignum_core.h"
+#include "bignum_internal.h"
 #include "bn_mul.h"
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
@@ -1534,6 +1535,16 @@ static void mpi_montmul( mbedtls_mpi *A, const mbedtls_mpi *B,
     mbedtls_mpi_core_montmul( A->p, A->p, B->p, B->n, N->p, N->n, mm, T->p );
 }
 
+/** Montgomery squaring: A = A * A * R^-1 mod N
+ *
+ * See mpi_montmul() regarding constraints and guarantees on the parameters.
+ */
+static void mpi_montsqr( mbedtls_mpi *A, const mbedtls_mpi *N,
+                         mbedtls_mpi_uint mm, mbedtls_mpi *T )
+{
+    mbedtls_mpi_core_montsqr( A->p, A->p, N->p, N->n, mm, T->p );
+}
+
 /*
  * Montgomery reduction: A = A * R^-1 mod N
  *
@@ -1700,7 +1711,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
         MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[j], &W[1]    ) );
 
         for( i = 0; i < wsize - 1; i++ )
-            mpi_montmul( &W[j], &W[j], N, mm, &T );
+            mpi_montsqr( &W[j], N, mm, &T );
 
         /*
          * W[i] = W[i - 1] * W[1]
@@ -1747,7 +1758,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
             /*
              * out of window, square X
              */
-            mpi_montmul( X, X, N, mm, &T );
+            mpi_montsqr( X, N, mm, &T );
             continue;
         }
 
@@ -1765,7 +1776,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
              * X = X^wsize R^-1 mod N
              */
             for( i = 0; i < wsize; i++ )
-                mpi_montmul( X, X, N, mm, &T );
+                mpi_montsqr( X, N, mm, &T );
 
             /*
              * X = X * W[wbits] R^-1 mod N
@@ -1784,7 +1795,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A,
      */
     for( i = 0; i < nbits; i++ )
     {
-        mpi_montmul( X, X, N, mm, &T );
+        mpi_montsqr( X, N, mm, &T );
 
         wbits <<= 1;
 
@@ -1817,6 +1828,131 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Number of limbs of E to scan in mbedtls_mpi_exp_mod_ct(). High zero limbs
+ * are skipped, but at least one limb is always scanned.
+ */
+static size_t mpi_exp_limbs( const mbedtls_mpi *E )
+{
+    size_t n = E->n;
+
+    while( n > 1 && E->p[n - 1] == 0 )
+        n--;
+
+    return( n == 0 ? 1 : n );
+}
+
+size_t mbedtls_mpi_exp_mod_ct_working_limbs( const mbedtls_mpi *E,
+                                             const mbedtls_mpi *N )
+{
+    return( mbedtls_mpi_core_exp_mod_working_limbs( N->n,
+                                                    mpi_exp_limbs( E ) ) );
+}
+
+int mbedtls_mpi_exp_mod_prepare_rr( mbedtls_mpi *prec_RR,
+                                    const mbedtls_mpi *N )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    MPI_VALIDATE_RET( prec_RR != NULL );
+    MPI_VALIDATE_RET( N != NULL );
+
+    if( mbedtls_mpi_cmp_int( N, 0 ) <= 0 || ( N->p[0] & 1 ) == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( prec_RR->p == NULL )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_core_get_mont_r2_unsafe( prec_RR, N ) );
+
+    /* mbedtls_mpi_exp_mod_ct() needs at least N->n limbs */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( prec_RR, N->n ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Fixed-window exponentiation for secret exponents: X = A^E mod N
+ */
+int mbedtls_mpi_exp_mod_ct( mbedtls_mpi *X, const mbedtls_mpi *A,
+                            const mbedtls_mpi *E, const mbedtls_mpi *N,
+                            mbedtls_mpi *prec_RR,
+                            mbedtls_mpi_uint *T, size_t T_limbs )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi RR, *RRp;
+    mbedtls_mpi_uint *W = T;
+    const mbedtls_mpi_uint zero = 0;
+    const mbedtls_mpi_uint *Ep;
+    size_t E_limbs, W_limbs;
+
+    MPI_VALIDATE_RET( X != NULL );
+    MPI_VALIDATE_RET( A != NULL );
+    MPI_VALIDATE_RET( E != NULL );
+    MPI_VALIDATE_RET( N != NULL );
+
+    if( mbedtls_mpi_cmp_int( N, 0 ) <= 0 || ( N->p[0] & 1 ) == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( mbedtls_mpi_cmp_int( E, 0 ) < 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( mbedtls_mpi_bitlen( E ) > MBEDTLS_MPI_MAX_BITS ||
+        mbedtls_mpi_bitlen( N ) > MBEDTLS_MPI_MAX_BITS )
+        return ( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    E_limbs = mpi_exp_limbs( E );
+    Ep = ( E->n == 0 ) ? &zero : E->p;
+    W_limbs = mbedtls_mpi_core_exp_mod_working_limbs( N->n, E_limbs );
+
+    if( T != NULL && T_limbs < W_limbs )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    mbedtls_mpi_init( &RR );
+
+    /*
+     * R^2 mod N, with at least N->n limbs. A value cached by
+     * mbedtls_mpi_exp_mod() is accepted too.
+     */
+    RRp = ( prec_RR != NULL ) ? prec_RR : &RR;
+    if( RRp->p == NULL )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_core_get_mont_r2_unsafe( RRp, N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( RRp, N->n ) );
+
+    /*
+     * X = A mod N, on exactly as many limbs as N (beyond the limbs
+     * that mbedtls_mpi_core_exp_mod() touches, X is zero)
+     */
+    if( A->s < 0 || mbedtls_mpi_cmp_mpi( A, N ) >= 0 )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( X, A, N ) );
+    else
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, A ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, N->n ) );
+
+    if( W == NULL )
+    {
+        W = mbedtls_calloc( W_limbs, ciL );
+        if( W == NULL )
+        {
+            ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+            goto cleanup;
+        }
+    }
+
+    mbedtls_mpi_core_exp_mod( X->p, X->p, N->p, N->n, Ep, E_limbs,
+                              RRp->p, W );
+
+cleanup:
+    if( T == NULL && W != NULL )
+    {
+        mbedtls_platform_zeroize( W, W_limbs * ciL );
+        mbedtls_free( W );
+    }
+
+    mbedtls_mpi_free( &RR );
+
+    return( ret );
+}
+
 /*
  * Greatest common divisor: G = gcd(A, B)  (HAC 14.54)
  */
@@ -2320,6 +2456,247 @@ int mbedtls_mpi_is_prime_ext( const mbedtls_mpi *X, int rounds,
     return( mpi_miller_rabin( &XX, rounds, f_rng, p_rng ) );
 }
 
+/*
+ * Sieve for mbedtls_mpi_gen_prime()
+ *
+ * Candidates are sieved by all odd primes up to
+ * MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND. The primes are packed in groups whose
+ * product fits in half a limb: as in mbedtls_mpi_mod_int(), the residue of a
+ * candidate modulo the product of a group costs two divisions per limb, and
+ * gives the residues modulo all the primes of the group.
+ */
+typedef struct
+{
+    uint16_t *primes;           /* The odd primes up to the bound          */
+    size_t prime_count;
+    mbedtls_mpi_uint *moduli;   /* The product of the primes of each group */
+    uint16_t *group_end;        /* Index in primes of the end of each group */
+    size_t group_count;
+} mpi_sieve;
+
+/* Maximum number of groups whose residues are computed in one pass over the
+ * limbs of a candidate. The blocks start with a single group, which rejects
+ * about two thirds of the candidates, and double in size up to this. */
+#define MPI_SIEVE_BLOCK 16
+
+static void mpi_sieve_init( mpi_sieve *sieve )
+{
+    memset( sieve, 0, sizeof( *sieve ) );
+}
+
+static void mpi_sieve_free( mpi_sieve *sieve )
+{
+    mbedtls_free( sieve->primes );
+    mbedtls_free( sieve->moduli );
+    mbedtls_free( sieve->group_end );
+    mpi_sieve_init( sieve );
+}
+
+/*
+ * Build the table of the odd primes up to bound (sieve of Eratosthenes, on
+ * odd numbers only: composite[i] is for 2 * i + 1) and pack them in groups.
+ */
+static int mpi_sieve_setup( mpi_sieve *sieve, size_t bound )
+{
+    int ret = 0;
+    unsigned char *composite;
+    size_t size = ( bound + 1 ) / 2;
+    size_t i, j, k, p;
+    mbedtls_mpi_uint m;
+
+    composite = mbedtls_calloc( size, 1 );
+    if( composite == NULL )
+        return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
+
+    for( i = 1; i < size; i++ )
+    {
+        if( composite[i] )
+            continue;
+
+        sieve->prime_count++;
+        p = 2 * i + 1;
+        for( j = p * p / 2; j < size; j += p )
+            composite[j] = 1;
+    }
+
+    sieve->primes = mbedtls_calloc( sieve->prime_count, sizeof( uint16_t ) );
+    if( sieve->primes == NULL )
+    {
+        ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    for( i = 1, k = 0; i < size; i++ )
+    {
+        if( ! composite[i] )
+            sieve->primes[k++] = (uint16_t) ( 2 * i + 1 );
+    }
+
+    /* Count, then fill in, the groups. A new group starts whenever the
+     * product would exceed 2^biH. */
+    for( k = 0; k < 2; k++ )
+    {
+        sieve->group_count = 0;
+        m = 1;
+        for( i = 0; i < sieve->prime_count; i++ )
+        {
+            if( m > ( (mbedtls_mpi_uint) 1 << biH ) / sieve->primes[i] )
+            {
+                if( k == 1 )
+                {
+                    sieve->moduli[sieve->group_count] = m;
+                    sieve->group_end[sieve->group_count] = (uint16_t) i;
+                }
+                sieve->group_count++;
+                m = 1;
+            }
+            m *= sieve->primes[i];
+        }
+        if( k == 1 )
+        {
+            sieve->moduli[sieve->group_count] = m;
+            sieve->group_end[sieve->group_count] = (uint16_t) i;
+        }
+        sieve->group_count++;
+
+        if( k == 0 )
+        {
+            sieve->moduli = mbedtls_calloc( sieve->group_count,
+                                            sizeof( mbedtls_mpi_uint ) );
+            sieve->group_end = mbedtls_calloc( sieve->group_count,
+                                               sizeof( uint16_t ) );
+            if( sieve->moduli == NULL || sieve->group_end == NULL )
+            {
+                ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+                goto cleanup;
+            }
+        }
+    }
+
+cleanup:
+    mbedtls_free( composite );
+
+    return( ret );
+}
+
+/*
+ * Set R[g - g0] to X mod moduli[g] for g0 <= g < g1, in one pass over the
+ * limbs of X (X must be positive).
+ */
+static void mpi_sieve_residues( const mpi_sieve *sieve, const mbedtls_mpi *X,
+                                size_t g0, size_t g1, mbedtls_mpi_uint *R )
+{
+    size_t i, g;
+    mbedtls_mpi_uint x, y, m;
+
+    for( g = g0; g < g1; g++ )
+        R[g - g0] = 0;
+
+    for( i = X->n; i > 0; i-- )
+    {
+        x = X->p[i - 1];
+        for( g = g0; g < g1; g++ )
+        {
+            m = sieve->moduli[g];
+            y = ( R[g - g0] << biH ) | ( x >> biH );
+            y %= m;
+            y = ( y << biH ) | ( ( x << biH ) >> biH );
+            R[g - g0] = y % m;
+        }
+    }
+}
+
+/*
+ * Return 0 if no prime of the sieve divides X, or
+ * MBEDTLS_ERR_MPI_NOT_ACCEPTABLE if one does. X must be larger than the
+ * largest prime of the sieve.
+ */
+static int mpi_sieve_check( const mpi_sieve *sieve, const mbedtls_mpi *X )
+{
+    mbedtls_mpi_uint R[MPI_SIEVE_BLOCK];
+    size_t block = 1, g0, g1, g, j = 0;
+
+    for( g0 = 0; g0 < sieve->group_count; g0 = g1 )
+    {
+        g1 = sieve->group_count - g0 < block ? sieve->group_count : g0 + block;
+        mpi_sieve_residues( sieve, X, g0, g1, R );
+
+        for( g = g0; g < g1; g++ )
+        {
+            for( ; j < sieve->group_end[g]; j++ )
+            {
+                if( R[g - g0] % sieve->primes[j] == 0 )
+                    return( MBEDTLS_ERR_MPI_NOT_ACCEPTABLE );
+            }
+        }
+
+        if( block < MPI_SIEVE_BLOCK )
+            block *= 2;
+    }
+
+    return( 0 );
+}
+
+/*
+ * Set R[i] to X mod primes[i] for all the primes of the sieve
+ */
+static void mpi_sieve_prime_residues( const mpi_sieve *sieve,
+                                      const mbedtls_mpi *X, uint16_t *R )
+{
+    mbedtls_mpi_uint RG[MPI_SIEVE_BLOCK];
+    size_t g0, g1, g, j = 0;
+
+    for( g0 = 0; g0 < sieve->group_count; g0 = g1 )
+    {
+        g1 = sieve->group_count - g0 < MPI_SIEVE_BLOCK ?
+             sieve->group_count : g0 + MPI_SIEVE_BLOCK;
+        mpi_sieve_residues( sieve, X, g0, g1, RG );
+
+        for( g = g0; g < g1; g++ )
+        {
+            for( ; j < sieve->group_end[g]; j++ )
+                R[j] = (uint16_t) ( RG[g - g0] % sieve->primes[j] );
+        }
+    }
+}
+
+/*
+ * Update the residues from mpi_sieve_prime_residues() when step is added to X
+ */
+static void mpi_sieve_add( const mpi_sieve *sieve, uint16_t *R,
+                           unsigned step )
+{
+    size_t i;
+    unsigned r;
+
+    for( i = 0; i < sieve->prime_count; i++ )
+    {
+        r = R[i] + step;
+        while( r >= sieve->primes[i] )
+            r -= sieve->primes[i];
+        R[i] = (uint16_t) r;
+    }
+}
+
+/*
+ * Safe prime candidates: given the residues R of X from
+ * mpi_sieve_prime_residues(), return 0 if no prime of the sieve divides
+ * either X or Y = (X-1) / 2, or MBEDTLS_ERR_MPI_NOT_ACCEPTABLE if one does.
+ * An odd prime p divides Y if and only if X = 1 mod p.
+ */
+static int mpi_sieve_check_safe( const mpi_sieve *sieve, const uint16_t *R )
+{
+    size_t i;
+
+    for( i = 0; i < sieve->prime_count; i++ )
+    {
+        if( R[i] <= 1 )
+            return( MBEDTLS_ERR_MPI_NOT_ACCEPTABLE );
+    }
+
+    return( 0 );
+}
+
 /*
  * Prime number generation
  *
@@ -2343,6 +2720,9 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int flags,
     int rounds;
     mbedtls_mpi_uint r;
     mbedtls_mpi Y;
+    mpi_sieve sieve;
+    uint16_t *R = NULL;
+    int use_sieve;
 
     MPI_VALIDATE_RET( X     != NULL );
     MPI_VALIDATE_RET( f_rng != NULL );
@@ -2351,6 +2731,29 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int flags,
         return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
 
     mbedtls_mpi_init( &Y );
+    mpi_sieve_init( &sieve );
+
+    /*
+     * Sieve the candidates by the small primes up to
+     * MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND (at most 2^16) instead of trial
+     * division by the primes below 1000, as long as neither X nor
+     * Y = (X-1) / 2 can be one of those primes.
+     */
+    use_sieve = nbits > 32;
+    if( use_sieve )
+    {
+        MBEDTLS_MPI_CHK( mpi_sieve_setup( &sieve,
+                                          MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND ) );
+        if( ( flags & MBEDTLS_MPI_GEN_PRIME_FLAG_DH ) != 0 )
+        {
+            R = mbedtls_calloc( sieve.prime_count, sizeof( uint16_t ) );
+            if( R == NULL )
+            {
+                ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+                goto cleanup;
+            }
+        }
+    }
 
     n = BITS_TO_LIMBS( nbits );
 
@@ -2387,7 +2790,20 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int flags,
 
         if( ( flags & MBEDTLS_MPI_GEN_PRIME_FLAG_DH ) == 0 )
         {
-            ret = mbedtls_mpi_is_prime_ext( X, rounds, f_rng, p_rng );
+            /*
+             * Each candidate is drawn afresh rather than searched for
+             * incrementally from the previous one: scanning X, X+2, ...
+             * would pick primes that follow a long gap more often than
+             * others.
+             */
+            if( use_sieve )
+            {
+                ret = mpi_sieve_check( &sieve, X );
+                if( ret == 0 )
+                    ret = mpi_miller_rabin( X, rounds, f_rng, p_rng );
+            }
+            else
+                ret = mbedtls_mpi_is_prime_ext( X, rounds, f_rng, p_rng );
 
             if( ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
                 goto cleanup;
@@ -2412,14 +2828,24 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int flags,
             MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Y, X ) );
             MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &Y, 1 ) );
 
+            /* The candidates are searched incrementally from X, so the
+             * residues of X modulo the primes of the sieve only need to be
+             * computed once and are then updated along with X. */
+            if( use_sieve )
+                mpi_sieve_prime_residues( &sieve, X, R );
+
             while( 1 )
             {
                 /*
                  * First, check small factors for X and Y
                  * before doing Miller-Rabin on any of them
                  */
-                if( ( ret = mpi_check_small_factors(  X         ) ) == 0 &&
-                    ( ret = mpi_check_small_factors( &Y         ) ) == 0 &&
+                if( use_sieve )
+                    ret = mpi_sieve_check_safe( &sieve, R );
+                else if( ( ret = mpi_check_small_factors( X ) ) == 0 )
+                    ret = mpi_check_small_factors( &Y );
+
+                if( ret == 0 &&
                     ( ret = mpi_miller_rabin(  X, rounds, f_rng, p_rng  ) )
                                                                     == 0 &&
                     ( ret = mpi_miller_rabin( &Y, rounds, f_rng, p_rng  ) )
@@ -2436,6 +2862,8 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int flags,
                  */
                 MBEDTLS_MPI_CHK( mbedtls_mpi_add_int(  X,  X, 12 ) );
                 MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( &Y, &Y, 6  ) );
+                if( use_sieve )
+                    mpi_sieve_add( &sieve, R, 12 );
             }
         }
     }
@@ -2443,6 +2871,8 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int flags,
 cleanup:
 
     mbedtls_mpi_free( &Y );
+    mpi_sieve_free( &sieve );
+    mbedtls_free( R );
 
     return( ret );
 }
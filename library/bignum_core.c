@@ -418,6 +418,215 @@ mbedtls_mpi_uint mbedtls_mpi_core_sub( mbedtls_mpi_uint *X,
     return( c );
 }
 
+/*
+ * Dedicated multiply-accumulate kernels for the inner loop of multiplication
+ * and Montgomery multiplication: d[0..n-1] += s[0..n-1] * b, returning the
+ * carry limb. Unlike MULADDC, they handle whole rows in a single asm block.
+ */
+#if defined(MBEDTLS_MPI_MONTMUL_ASM) && defined(MBEDTLS_HAVE_ASM) && \
+    defined(MBEDTLS_HAVE_INT64) && defined(__GNUC__)
+#if defined(__amd64__) || defined(__x86_64__)
+#define MPI_CORE_MLA_X86_MULX
+#elif defined(__aarch64__) && defined(MBEDTLS_MPI_MONTMUL_ASM_A64)
+#define MPI_CORE_MLA_A64
+#endif
+#endif /* MBEDTLS_MPI_MONTMUL_ASM && MBEDTLS_HAVE_ASM && ... */
+
+#if defined(MPI_CORE_MLA_X86_MULX)
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include "mbedtls/threading.h"
+#endif
+
+/*
+ * MULX (BMI2) does not touch the flags, so ADCX and ADOX can run two
+ * independent carry chains: one for the low halves of the products added to
+ * d[j], one for the high halves carried into d[j + 1]. The loop control only
+ * uses LEA, MOV and JRCXZ, which preserve both chains.
+ */
+static int mpi_core_mla_x86_mulx_determine_support( void )
+{
+    unsigned int a, b, c, d;
+
+    /* Leaf 0: the highest supported leaf */
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (0), "c" (0) );
+    if( a < 7 )
+        return( 0 );
+
+    /* Leaf 7: EBX bit 8 is BMI2 (MULX), bit 19 is ADX (ADCX/ADOX) */
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (7), "c" (0) );
+    return( ( b & ( 1U << 8 ) ) != 0 && ( b & ( 1U << 19 ) ) != 0 );
+}
+
+/*
+ * Several threads may multiply at the same time, so with pthreads the
+ * detection runs under pthread_once(), as in sha256.c.
+ */
+#if defined(MBEDTLS_THREADING_PTHREAD)
+static pthread_once_t mpi_core_mla_x86_mulx_once = PTHREAD_ONCE_INIT;
+#else
+static int mpi_core_mla_x86_mulx_once = 0;
+#endif
+static int mpi_core_mla_x86_mulx_supported = 0;
+
+static void mpi_core_mla_x86_mulx_detect( void )
+{
+    mpi_core_mla_x86_mulx_supported = mpi_core_mla_x86_mulx_determine_support();
+}
+
+static int mpi_core_mla_asm_has_support( void )
+{
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    (void) pthread_once( &mpi_core_mla_x86_mulx_once,
+                         mpi_core_mla_x86_mulx_detect );
+#else
+    if( !mpi_core_mla_x86_mulx_once )
+    {
+        mpi_core_mla_x86_mulx_detect();
+        mpi_core_mla_x86_mulx_once = 1;
+    }
+#endif
+
+    return( mpi_core_mla_x86_mulx_supported );
+}
+
+static mbedtls_mpi_uint mpi_core_mla_asm( mbedtls_mpi_uint *d,
+                                          const mbedtls_mpi_uint *s,
+                                          size_t n, mbedtls_mpi_uint b )
+{
+    mbedtls_mpi_uint c;
+    size_t n4 = n / 4, n1 = n & 3;
+
+    asm volatile(
+        "xorl   %%r10d, %%r10d          \n\t" /* clears CF and OF too */
+        "movq   %[n4], %%rcx            \n\t"
+        "1:                             \n\t"
+        "jrcxz  2f                      \n\t"
+        "mulxq  0(%[s]), %%r8, %%r9     \n\t"
+        "movq   0(%[d]), %%r11          \n\t"
+        "adcxq  %%r8, %%r11             \n\t"
+        "adoxq  %%r10, %%r11            \n\t"
+        "movq   %%r11, 0(%[d])          \n\t"
+        "mulxq  8(%[s]), %%r8, %%r10    \n\t"
+        "movq   8(%[d]), %%r11          \n\t"
+        "adcxq  %%r8, %%r11             \n\t"
+        "adoxq  %%r9, %%r11             \n\t"
+        "movq   %%r11, 8(%[d])          \n\t"
+        "mulxq  16(%[s]), %%r8, %%r9    \n\t"
+        "movq   16(%[d]), %%r11         \n\t"
+        "adcxq  %%r8, %%r11             \n\t"
+        "adoxq  %%r10, %%r11            \n\t"
+        "movq   %%r11, 16(%[d])         \n\t"
+        "mulxq  24(%[s]), %%r8, %%r10   \n\t"
+        "movq   24(%[d]), %%r11         \n\t"
+        "adcxq  %%r8, %%r11             \n\t"
+        "adoxq  %%r9, %%r11             \n\t"
+        "movq   %%r11, 24(%[d])         \n\t"
+        "leaq   32(%[s]), %[s]          \n\t"
+        "leaq   32(%[d]), %[d]          \n\t"
+        "leaq   -1(%%rcx), %%rcx        \n\t"
+        "jmp    1b                      \n\t"
+        "2:                             \n\t"
+        "movq   %[n1], %%rcx            \n\t"
+        "3:                             \n\t"
+        "jrcxz  4f                      \n\t"
+        "mulxq  0(%[s]), %%r8, %%r9     \n\t"
+        "movq   0(%[d]), %%r11          \n\t"
+        "adcxq  %%r8, %%r11             \n\t"
+        "adoxq  %%r10, %%r11            \n\t"
+        "movq   %%r11, 0(%[d])          \n\t"
+        "movq   %%r9, %%r10             \n\t"
+        "leaq   8(%[s]), %[s]           \n\t"
+        "leaq   8(%[d]), %[d]           \n\t"
+        "leaq   -1(%%rcx), %%rcx        \n\t"
+        "jmp    3b                      \n\t"
+        "4:                             \n\t"
+        /* The pending high half absorbs both chains without overflowing,
+         * since the whole row plus carry fits in n + 1 limbs */
+        "movl   $0, %%r11d              \n\t"
+        "adcxq  %%r11, %%r10            \n\t"
+        "adoxq  %%r11, %%r10            \n\t"
+        "movq   %%r10, %[c]             \n\t"
+        : [c] "=r" (c), [d] "+r" (d), [s] "+r" (s)
+        : [n4] "r" (n4), [n1] "r" (n1), "d" (b)
+        : "rcx", "r8", "r9", "r10", "r11", "cc", "memory"
+    );
+
+    return( c );
+}
+#endif /* MPI_CORE_MLA_X86_MULX */
+
+#if defined(MPI_CORE_MLA_A64)
+/*
+ * Four limbs per iteration: the low halves of the products are added to d
+ * in one ADCS chain, then the carry-in and the high halves (shifted by one
+ * limb) in a second chain, whose carry-out becomes the next carry-in.
+ */
+#define mpi_core_mla_asm_has_support( ) 1
+
+static mbedtls_mpi_uint mpi_core_mla_asm( mbedtls_mpi_uint *d,
+                                          const mbedtls_mpi_uint *s,
+                                          size_t n, mbedtls_mpi_uint b )
+{
+    mbedtls_mpi_uint c = 0;
+    size_t n4 = n / 4, n1 = n & 3;
+
+    asm volatile(
+        "cbz    %[n4], 2f               \n\t"
+        "1:                             \n\t"
+        "ldp    x4, x5, [%[s]], #16     \n\t"
+        "ldp    x6, x7, [%[s]], #16     \n\t"
+        "ldp    x8, x9, [%[d]]          \n\t"
+        "ldp    x10, x11, [%[d], #16]   \n\t"
+        "mul    x12, x4, %[b]           \n\t"
+        "umulh  x4, x4, %[b]            \n\t"
+        "mul    x13, x5, %[b]           \n\t"
+        "umulh  x5, x5, %[b]            \n\t"
+        "mul    x14, x6, %[b]           \n\t"
+        "umulh  x6, x6, %[b]            \n\t"
+        "mul    x15, x7, %[b]           \n\t"
+        "umulh  x7, x7, %[b]            \n\t"
+        "adds   x8, x8, x12             \n\t"
+        "adcs   x9, x9, x13             \n\t"
+        "adcs   x10, x10, x14           \n\t"
+        "adcs   x11, x11, x15           \n\t"
+        "adc    x7, x7, xzr             \n\t"
+        "adds   x8, x8, %[c]            \n\t"
+        "adcs   x9, x9, x4              \n\t"
+        "adcs   x10, x10, x5            \n\t"
+        "adcs   x11, x11, x6            \n\t"
+        "adc    %[c], x7, xzr           \n\t"
+        "stp    x8, x9, [%[d]], #16     \n\t"
+        "stp    x10, x11, [%[d]], #16   \n\t"
+        "subs   %[n4], %[n4], #1        \n\t"
+        "b.ne   1b                      \n\t"
+        "2:                             \n\t"
+        "cbz    %[n1], 4f               \n\t"
+        "3:                             \n\t"
+        "ldr    x4, [%[s]], #8          \n\t"
+        "ldr    x8, [%[d]]              \n\t"
+        "mul    x12, x4, %[b]           \n\t"
+        "umulh  x4, x4, %[b]            \n\t"
+        "adds   x8, x8, x12             \n\t"
+        "adc    x4, x4, xzr             \n\t"
+        "adds   x8, x8, %[c]            \n\t"
+        "adc    %[c], x4, xzr           \n\t"
+        "str    x8, [%[d]], #8          \n\t"
+        "subs   %[n1], %[n1], #1        \n\t"
+        "b.ne   3b                      \n\t"
+        "4:                             \n\t"
+        : [c] "+r" (c), [d] "+r" (d), [s] "+r" (s),
+          [n4] "+r" (n4), [n1] "+r" (n1)
+        : [b] "r" (b)
+        : "x4", "x5", "x6", "x7", "x8", "x9", "x10", "x11",
+          "x12", "x13", "x14", "x15", "cc", "memory"
+    );
+
+    return( c );
+}
+#endif /* MPI_CORE_MLA_A64 */
+
 mbedtls_mpi_uint mbedtls_mpi_core_mla( mbedtls_mpi_uint *d, size_t d_len,
                                        const mbedtls_mpi_uint *s, size_t s_len,
                                        mbedtls_mpi_uint b )
@@ -431,21 +640,32 @@ mbedtls_mpi_uint mbedtls_mpi_core_mla( mbedtls_mpi_uint *d, size_t d_len,
     if( d_len < s_len )
         s_len = d_len;
     size_t excess_len = d_len - s_len;
-    size_t steps_x8 = s_len / 8;
-    size_t steps_x1 = s_len & 7;
 
-    while( steps_x8-- )
+#if defined(MPI_CORE_MLA_X86_MULX) || defined(MPI_CORE_MLA_A64)
+    if( mpi_core_mla_asm_has_support() )
     {
-        MULADDC_X8_INIT
-        MULADDC_X8_CORE
-        MULADDC_X8_STOP
+        c = mpi_core_mla_asm( d, s, s_len, b );
+        d += s_len;
     }
-
-    while( steps_x1-- )
+    else
+#endif
     {
-        MULADDC_X1_INIT
-        MULADDC_X1_CORE
-        MULADDC_X1_STOP
+        size_t steps_x8 = s_len / 8;
+        size_t steps_x1 = s_len & 7;
+
+        while( steps_x8-- )
+        {
+            MULADDC_X8_INIT
+            MULADDC_X8_CORE
+            MULADDC_X8_STOP
+        }
+
+        while( steps_x1-- )
+        {
+            MULADDC_X1_INIT
+            MULADDC_X1_CORE
+            MULADDC_X1_STOP
+        }
     }
 
     while( excess_len-- )
@@ -582,14 +802,312 @@ cleanup:
 
 /* BEGIN MERGE SLOT 1 */
 
+static size_t exp_mod_get_window_size( size_t Ebits )
+{
+    size_t wsize = ( Ebits > 671 ) ? 6 : ( Ebits > 239 ) ? 5 : 4;
+
+#if( MBEDTLS_MPI_WINDOW_SIZE < 6 )
+    if( wsize > MBEDTLS_MPI_WINDOW_SIZE )
+        wsize = MBEDTLS_MPI_WINDOW_SIZE;
+#endif
+
+    return( wsize );
+}
+
+size_t mbedtls_mpi_core_exp_mod_working_limbs( size_t AN_limbs, size_t E_limbs )
+{
+    const size_t wsize = exp_mod_get_window_size( E_limbs * biL );
+    const size_t welem = ( (size_t) 1 ) << wsize;
+
+    /* The table, one selected entry and the montmul() temporary */
+    const size_t table_limbs  = welem * AN_limbs;
+    const size_t select_limbs = AN_limbs;
+    const size_t temp_limbs   = 2 * AN_limbs + 1;
+
+    return( table_limbs + select_limbs + temp_limbs );
+}
+
+/*
+ * Fixed-window exponentiation: X = A^E mod N  (HAC 14.82)
+ */
+void mbedtls_mpi_core_exp_mod( mbedtls_mpi_uint *X,
+                               const mbedtls_mpi_uint *A,
+                               const mbedtls_mpi_uint *N, size_t AN_limbs,
+                               const mbedtls_mpi_uint *E, size_t E_limbs,
+                               const mbedtls_mpi_uint *RR,
+                               mbedtls_mpi_uint *T )
+{
+    const size_t wsize = exp_mod_get_window_size( E_limbs * biL );
+    const size_t welem = ( (size_t) 1 ) << wsize;
+
+    /* Split the working memory as described in
+     * mbedtls_mpi_core_exp_mod_working_limbs() */
+    mbedtls_mpi_uint * const Wtable  = T;
+    mbedtls_mpi_uint * const Wselect = Wtable + welem * AN_limbs;
+    mbedtls_mpi_uint * const temp    = Wselect + AN_limbs;
+
+    const mbedtls_mpi_uint mm = mbedtls_mpi_core_montmul_init( N );
+    const mbedtls_mpi_uint one = 1;
+
+    /*
+     * Wtable[i] = A^i * R mod N, so that Wtable[0] is 1 in Montgomery form
+     */
+    mbedtls_mpi_core_montmul( Wtable, RR, &one, 1, N, AN_limbs, mm, temp );
+    mbedtls_mpi_core_montmul( Wtable + AN_limbs, A, RR, AN_limbs,
+                              N, AN_limbs, mm, temp );
+    for( size_t i = 2; i < welem; i++ )
+    {
+        mbedtls_mpi_core_montmul( Wtable + i * AN_limbs,
+                                  Wtable + ( i - 1 ) * AN_limbs,
+                                  Wtable + AN_limbs, AN_limbs,
+                                  N, AN_limbs, mm, temp );
+    }
+
+    /* A is not used after this point, so X may alias it */
+    memcpy( X, Wtable, AN_limbs * ciL );
+
+    /*
+     * Scan every bit of E from the top, squaring once per bit and
+     * multiplying by a table entry once per window. The window boundaries
+     * only depend on E_limbs, and the entry is read with a constant-time
+     * lookup, so nothing about E leaks through timing or memory accesses.
+     */
+    size_t E_bits = E_limbs * biL;
+    size_t window = 0;
+    size_t window_bits = 0;
+
+    while( E_bits-- > 0 )
+    {
+        mbedtls_mpi_core_montsqr( X, X, N, AN_limbs, mm, temp );
+
+        window <<= 1;
+        window |= ( E[E_bits / biL] >> ( E_bits % biL ) ) & 1;
+        window_bits++;
+
+        if( window_bits == wsize || E_bits == 0 )
+        {
+            mbedtls_mpi_core_ct_uint_table_lookup( Wselect, Wtable,
+                                                   AN_limbs, welem, window );
+            mbedtls_mpi_core_montmul( X, X, Wselect, AN_limbs,
+                                      N, AN_limbs, mm, temp );
+            window = 0;
+            window_bits = 0;
+        }
+    }
+
+    /*
+     * X = A^E * R * R^-1 mod N = A^E mod N
+     */
+    mbedtls_mpi_core_montmul( X, X, &one, 1, N, AN_limbs, mm, temp );
+}
+
 /* END MERGE SLOT 1 */
 
 /* BEGIN MERGE SLOT 2 */
 
+/*
+ * Full product of two limbs: returns the low half and stores the high half
+ * in *hi.
+ */
+static mbedtls_mpi_uint mpi_core_mul_limb( mbedtls_mpi_uint *hi,
+                                           mbedtls_mpi_uint a,
+                                           mbedtls_mpi_uint b )
+{
+#if defined(MBEDTLS_HAVE_UDBL)
+    mbedtls_t_udbl r = (mbedtls_t_udbl) a * b;
+
+    *hi = (mbedtls_mpi_uint) ( r >> biL );
+    return( (mbedtls_mpi_uint) r );
+#else
+    mbedtls_mpi_uint lo = 0;
+
+    *hi = mbedtls_mpi_core_mla( &lo, 1, &a, 1, b );
+    return( lo );
+#endif
+}
+
+void mbedtls_mpi_core_montsqr( mbedtls_mpi_uint *X,
+                               const mbedtls_mpi_uint *A,
+                               const mbedtls_mpi_uint *N,
+                               size_t AN_limbs,
+                               mbedtls_mpi_uint mm,
+                               mbedtls_mpi_uint *T )
+{
+    const size_t n = AN_limbs;
+    mbedtls_mpi_uint c, carry, borrow;
+    size_t i;
+
+    memset( T, 0, ( 2 * n + 1 ) * ciL );
+
+    /*
+     * T = sum_{i < j} A[i] * A[j] * 2^(biL*(i+j)): row i only adds to limbs
+     * that no earlier row has reached, so its carry-out is stored directly.
+     */
+    for( i = 0; i + 1 < n; i++ )
+    {
+        T[i + n] = mbedtls_mpi_core_mla( T + 2 * i + 1, n - i - 1,
+                                         A + i + 1, n - i - 1, A[i] );
+    }
+
+    /*
+     * T = 2 * T + sum_i A[i]^2 * 2^(biL*2i), two limbs of T per step. The
+     * sum of cross products is less than 2^(2*biL*n - 1), so nothing is
+     * shifted out of the top limb. In each addition below, at most one of
+     * the two carries can be set, since a carry leaves a zero sum behind.
+     */
+    c = 0;
+    carry = 0;
+    for( i = 0; i < n; i++ )
+    {
+        mbedtls_mpi_uint lo, hi, t0 = T[2 * i], t1 = T[2 * i + 1];
+
+        lo = mpi_core_mul_limb( &hi, A[i], A[i] );
+
+        T[2 * i]     = ( t0 << 1 ) | c;
+        T[2 * i + 1] = ( t1 << 1 ) | ( t0 >> ( biL - 1 ) );
+        c = t1 >> ( biL - 1 );
+
+        T[2 * i] += carry;
+        carry = ( T[2 * i] < carry );
+        T[2 * i] += lo;
+        carry += ( T[2 * i] < lo );
+
+        T[2 * i + 1] += carry;
+        carry = ( T[2 * i + 1] < carry );
+        T[2 * i + 1] += hi;
+        carry += ( T[2 * i + 1] < hi );
+    }
+
+    /*
+     * Montgomery reduction: T = (T + m * N) / R, one limb of m at a time.
+     * T[i + n] collects the carry-out of each row, and carry the bit that
+     * overflows out of T[i + n] into the next row.
+     */
+    carry = 0;
+    for( i = 0; i < n; i++ )
+    {
+        mbedtls_mpi_uint u = T[i] * mm;
+        mbedtls_mpi_uint t;
+
+        c = mbedtls_mpi_core_mla( T + i, n, N, n, u );
+
+        t = T[i + n] + carry;
+        carry = ( t < carry );
+        t += c;
+        carry |= ( t < c );
+        T[i + n] = t;
+    }
+
+    /*
+     * As in mbedtls_mpi_core_montmul(), the result is T + n or T + n - N,
+     * depending on (carry, borrow).
+     */
+    borrow = mbedtls_mpi_core_sub( X, T + n, N, n );
+    mbedtls_ct_mpi_uint_cond_assign( n, X, T + n, (unsigned char) ( carry ^ borrow ) );
+}
+
 /* END MERGE SLOT 2 */
 
 /* BEGIN MERGE SLOT 3 */
 
+size_t mbedtls_mpi_core_fixed_base_table_limbs( size_t AN_limbs, size_t wsize )
+{
+    return( ( ( (size_t) 1 ) << wsize ) * AN_limbs );
+}
+
+/*
+ * Comb table for fixed-base exponentiation (HAC 14.117):
+ * table[i] = prod_{bit j of i set} A^(2^(j*d)) * R mod N
+ */
+void mbedtls_mpi_core_fixed_base_setup( mbedtls_mpi_uint *table,
+                                        size_t wsize, size_t d,
+                                        const mbedtls_mpi_uint *A,
+                                        const mbedtls_mpi_uint *N,
+                                        size_t AN_limbs,
+                                        const mbedtls_mpi_uint *RR,
+                                        mbedtls_mpi_uint *T )
+{
+    const mbedtls_mpi_uint mm = mbedtls_mpi_core_montmul_init( N );
+    const mbedtls_mpi_uint one = 1;
+
+    mbedtls_mpi_core_montmul( table, RR, &one, 1, N, AN_limbs, mm, T );
+    mbedtls_mpi_core_montmul( table + AN_limbs, A, RR, AN_limbs,
+                              N, AN_limbs, mm, T );
+
+    for( size_t j = 1; j < wsize; j++ )
+    {
+        const size_t half = ( (size_t) 1 ) << ( j - 1 );
+        const size_t top = half << 1;
+        mbedtls_mpi_uint *tooth = table + top * AN_limbs;
+
+        /* table[2^j] = table[2^(j-1)]^(2^d) */
+        memcpy( tooth, table + half * AN_limbs, AN_limbs * ciL );
+        for( size_t i = 0; i < d; i++ )
+            mbedtls_mpi_core_montsqr( tooth, tooth, N, AN_limbs, mm, T );
+
+        /* table[2^j + k] = table[2^j] * table[k] */
+        for( size_t k = 1; k < top; k++ )
+        {
+            mbedtls_mpi_core_montmul( tooth + k * AN_limbs, tooth,
+                                      table + k * AN_limbs, AN_limbs,
+                                      N, AN_limbs, mm, T );
+        }
+    }
+}
+
+/*
+ * Fixed-base comb exponentiation: X = A^E mod N  (HAC 14.117)
+ */
+void mbedtls_mpi_core_fixed_base_exp_mod( mbedtls_mpi_uint *X,
+                                          const mbedtls_mpi_uint *table,
+                                          size_t wsize, size_t d,
+                                          const mbedtls_mpi_uint *N,
+                                          size_t AN_limbs,
+                                          const mbedtls_mpi_uint *E,
+                                          size_t E_limbs,
+                                          mbedtls_mpi_uint *T )
+{
+    const size_t welem = ( (size_t) 1 ) << wsize;
+    const size_t E_bits = E_limbs * biL;
+    const mbedtls_mpi_uint mm = mbedtls_mpi_core_montmul_init( N );
+    const mbedtls_mpi_uint one = 1;
+
+    mbedtls_mpi_uint * const Wselect = T;
+    mbedtls_mpi_uint * const temp    = T + AN_limbs;
+
+    memcpy( X, table, AN_limbs * ciL );
+
+    /*
+     * Column c of the comb is made of the bits c, d + c, 2d + c, ... of E.
+     * Which bits exist only depends on E_limbs, and the entry for the
+     * column is read with a constant-time lookup.
+     */
+    for( size_t c = d; c-- > 0; )
+    {
+        size_t index = 0;
+
+        mbedtls_mpi_core_montsqr( X, X, N, AN_limbs, mm, temp );
+
+        for( size_t j = 0; j < wsize; j++ )
+        {
+            const size_t bit = j * d + c;
+
+            if( bit < E_bits )
+                index |= (size_t) ( ( E[bit / biL] >> ( bit % biL ) ) & 1 ) << j;
+        }
+
+        mbedtls_mpi_core_ct_uint_table_lookup( Wselect, table,
+                                               AN_limbs, welem, index );
+        mbedtls_mpi_core_montmul( X, X, Wselect, AN_limbs,
+                                  N, AN_limbs, mm, temp );
+    }
+
+    /*
+     * X = A^E * R * R^-1 mod N = A^E mod N
+     */
+    mbedtls_mpi_core_montmul( X, X, &one, 1, N, AN_limbs, mm, temp );
+}
+
 /* END MERGE SLOT 3 */
 
 /* BEGIN MERGE SLOT 4 */
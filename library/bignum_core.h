@@ -496,14 +496,186 @@ int mbedtls_mpi_core_fill_random( mbedtls_mpi_uint *X, size_t X_limbs,
 
 /* BEGIN MERGE SLOT 1 */
 
+/**
+ * \brief          Returns the number of limbs of working memory required for
+ *                 a call to `mbedtls_mpi_core_exp_mod()`.
+ *
+ * \param AN_limbs The number of limbs in the input `A` and the modulus `N`
+ *                 (and the output `X`) that will be passed to
+ *                 `mbedtls_mpi_core_exp_mod()`.
+ * \param E_limbs  The number of limbs in the exponent `E` that will be passed
+ *                 to `mbedtls_mpi_core_exp_mod()`.
+ *
+ * \return         The number of limbs of working memory required by
+ *                 `mbedtls_mpi_core_exp_mod()`.
+ */
+size_t mbedtls_mpi_core_exp_mod_working_limbs( size_t AN_limbs, size_t E_limbs );
+
+/**
+ * \brief            Perform a modular exponentiation with secret exponent:
+ *                   X = A^E mod N
+ *
+ * This uses a fixed window of 4 to 6 bits (depending on the size of \p E,
+ * and capped by #MBEDTLS_MPI_WINDOW_SIZE) and processes every bit of the
+ * \p E_limbs limbs of \p E. The sequence of operations and memory accesses
+ * depends only on \p AN_limbs and \p E_limbs, not on the values of \p A or
+ * \p E. No memory is allocated.
+ *
+ * \p X may be aliased to \p A, but may not otherwise overlap any of the
+ * other parameters.
+ *
+ * \param[out] X     The destination MPI, as a little endian array of length
+ *                   \p AN_limbs.
+ * \param[in] A      The base MPI, as a little endian array of length
+ *                   \p AN_limbs. It must be in canonical form (A < N).
+ * \param[in] N      The modulus, as a little endian array of length
+ *                   \p AN_limbs. It must be odd.
+ * \param AN_limbs   The number of limbs in \p X, \p A, \p N and \p RR.
+ * \param[in] E      The exponent, as a little endian array of length
+ *                   \p E_limbs.
+ * \param E_limbs    The number of limbs in \p E.
+ * \param[in] RR     The precomputed residue of 2^{2*biL*AN_limbs} mod N, as a
+ *                   little endian array of length \p AN_limbs.
+ *                   See mbedtls_mpi_core_get_mont_r2_unsafe().
+ * \param[in,out] T  Temporary storage of at least the number of limbs returned
+ *                   by `mbedtls_mpi_core_exp_mod_working_limbs()`.
+ *                   Its initial content is unused and its final content is
+ *                   indeterminate. It holds values derived from \p A, so the
+ *                   caller should zeroize it before releasing it.
+ */
+void mbedtls_mpi_core_exp_mod( mbedtls_mpi_uint *X,
+                               const mbedtls_mpi_uint *A,
+                               const mbedtls_mpi_uint *N, size_t AN_limbs,
+                               const mbedtls_mpi_uint *E, size_t E_limbs,
+                               const mbedtls_mpi_uint *RR,
+                               mbedtls_mpi_uint *T );
+
 /* END MERGE SLOT 1 */
 
 /* BEGIN MERGE SLOT 2 */
 
+/**
+ * \brief Montgomery squaring: X = A * A * R^-1 mod N
+ *
+ * This computes the same value as
+ * `mbedtls_mpi_core_montmul(X, A, A, AN_limbs, N, AN_limbs, mm, T)`, but
+ * only computes each cross product A[i]*A[j] (i < j) once, and then performs
+ * a separate Montgomery reduction, for about 3/4 of the multiplications.
+ *
+ * \p A must be in canonical form. That is, < \p N.
+ *
+ * \p X may be aliased to \p A, but may not otherwise overlap any of the
+ * other parameters.
+ *
+ * \param[out]    X         The destination MPI, as a little-endian array of
+ *                          length \p AN_limbs.
+ *                          On successful completion, X contains the result of
+ *                          the squaring `A * A * R^-1` mod N where
+ *                          `R = 2^(biL*AN_limbs)`.
+ * \param[in]     A         Little-endian presentation of the operand.
+ *                          Must have the same number of limbs as \p N.
+ * \param[in]     N         Little-endian presentation of the modulus.
+ *                          This must be odd, and have exactly the same number
+ *                          of limbs as \p A.
+ * \param[in]     AN_limbs  The number of limbs in \p X, \p A and \p N.
+ * \param         mm        The Montgomery constant for \p N: -N^-1 mod 2^biL.
+ *                          This can be calculated by `mbedtls_mpi_core_montmul_init()`.
+ * \param[in,out] T         Temporary storage of size at least 2*AN_limbs+1 limbs.
+ *                          Its initial content is unused and
+ *                          its final content is indeterminate.
+ *                          It must not alias or otherwise overlap any of the
+ *                          other parameters.
+ */
+void mbedtls_mpi_core_montsqr( mbedtls_mpi_uint *X,
+                               const mbedtls_mpi_uint *A,
+                               const mbedtls_mpi_uint *N,
+                               size_t AN_limbs,
+                               mbedtls_mpi_uint mm,
+                               mbedtls_mpi_uint *T );
+
 /* END MERGE SLOT 2 */
 
 /* BEGIN MERGE SLOT 3 */
 
+/**
+ * \brief          Returns the number of limbs of the table filled in by
+ *                 `mbedtls_mpi_core_fixed_base_setup()`.
+ *
+ * \param AN_limbs The number of limbs in the modulus `N`.
+ * \param wsize    The comb width, in bits.
+ *
+ * \return         The number of limbs in the table: `2^wsize * AN_limbs`.
+ */
+size_t mbedtls_mpi_core_fixed_base_table_limbs( size_t AN_limbs, size_t wsize );
+
+/**
+ * \brief            Precompute a comb table for exponentiations with the
+ *                   fixed base \p A (HAC 14.117).
+ *
+ * Entry \c i of the table is the product of `A^(2^(j*d))` over the bits
+ * \c j that are set in \c i, in Montgomery form. Entry 0 is 1 in Montgomery
+ * form. With it, `mbedtls_mpi_core_fixed_base_exp_mod()` can raise \p A to
+ * any exponent of at most `wsize * d` bits with \p d squarings and \p d
+ * multiplications.
+ *
+ * \param[out] table The table, as an array of
+ *                   `mbedtls_mpi_core_fixed_base_table_limbs()` limbs.
+ * \param wsize      The comb width, in bits. It must be between 1 and 8.
+ * \param d          The spacing between the comb teeth, in bits. It must be
+ *                   at least 1.
+ * \param[in] A      The base, as a little endian array of length
+ *                   \p AN_limbs. It must be in canonical form (A < N).
+ * \param[in] N      The modulus, as a little endian array of length
+ *                   \p AN_limbs. It must be odd.
+ * \param AN_limbs   The number of limbs in \p A, \p N, \p RR and each
+ *                   table entry.
+ * \param[in] RR     The precomputed residue of 2^{2*biL*AN_limbs} mod N, as a
+ *                   little endian array of length \p AN_limbs.
+ * \param[in,out] T  Temporary storage of at least 2*AN_limbs+1 limbs.
+ */
+void mbedtls_mpi_core_fixed_base_setup( mbedtls_mpi_uint *table,
+                                        size_t wsize, size_t d,
+                                        const mbedtls_mpi_uint *A,
+                                        const mbedtls_mpi_uint *N,
+                                        size_t AN_limbs,
+                                        const mbedtls_mpi_uint *RR,
+                                        mbedtls_mpi_uint *T );
+
+/**
+ * \brief            Perform a modular exponentiation with a fixed base and a
+ *                   secret exponent: X = A^E mod N, where \p table was filled
+ *                   in for \c A by `mbedtls_mpi_core_fixed_base_setup()`.
+ *
+ * The sequence of operations and memory accesses depends only on
+ * \p AN_limbs, \p E_limbs, \p wsize and \p d, not on the value of \p E:
+ * every table entry is read for each of the \p d multiplications.
+ *
+ * \param[out] X     The destination MPI, as a little endian array of length
+ *                   \p AN_limbs. It must not overlap any of the other
+ *                   parameters.
+ * \param[in] table  The table filled in by
+ *                   `mbedtls_mpi_core_fixed_base_setup()`.
+ * \param wsize      The comb width that \p table was filled in with.
+ * \param d          The tooth spacing that \p table was filled in with.
+ * \param[in] N      The modulus, as a little endian array of length
+ *                   \p AN_limbs.
+ * \param AN_limbs   The number of limbs in \p X, \p N and each table entry.
+ * \param[in] E      The exponent, as a little endian array of length
+ *                   \p E_limbs. It must be less than `2^(wsize * d)`.
+ * \param E_limbs    The number of limbs in \p E.
+ * \param[in,out] T  Temporary storage of at least 3*AN_limbs+1 limbs.
+ *                   Its final content depends on \p E, so the caller should
+ *                   zeroize it before releasing it.
+ */
+void mbedtls_mpi_core_fixed_base_exp_mod( mbedtls_mpi_uint *X,
+                                          const mbedtls_mpi_uint *table,
+                                          size_t wsize, size_t d,
+                                          const mbedtls_mpi_uint *N,
+                                          size_t AN_limbs,
+                                          const mbedtls_mpi_uint *E,
+                                          size_t E_limbs,
+                                          mbedtls_mpi_uint *T );
+
 /* END MERGE SLOT 3 */
 
 /* BEGIN MERGE SLOT 4 */
@@ -0,0 +1,100 @@
+/**
+ * \file bignum_internal.h
+ *
+ * \brief Multi-precision integer library: internal interfaces shared with
+ *        other library modules.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MBEDTLS_BIGNUM_INTERNAL_H
+#define MBEDTLS_BIGNUM_INTERNAL_H
+
+#include "common.h"
+
+#include "mbedtls/bignum.h"
+
+/**
+ * \brief          Return the number of limbs of working memory that
+ *                 mbedtls_mpi_exp_mod_ct() needs for the given exponent and
+ *                 modulus.
+ *
+ * \param E        The exponent that will be passed to
+ *                 mbedtls_mpi_exp_mod_ct().
+ * \param N        The modulus that will be passed to mbedtls_mpi_exp_mod_ct().
+ *
+ * \return         The number of limbs (not bytes) of working memory.
+ */
+size_t mbedtls_mpi_exp_mod_ct_working_limbs( const mbedtls_mpi *E,
+                                             const mbedtls_mpi *N );
+
+/**
+ * \brief          Perform a modular exponentiation with a secret exponent:
+ *                 X = A^E mod N
+ *
+ *                 Unlike mbedtls_mpi_exp_mod(), which uses a sliding window
+ *                 whose shape depends on the bits of \p E, this uses the
+ *                 fixed-window mbedtls_mpi_core_exp_mod(): the sequence of
+ *                 operations only depends on the number of limbs of \p E and
+ *                 \p N. Use it for private exponents, and
+ *                 mbedtls_mpi_exp_mod() for public ones.
+ *
+ * \param X        The destination MPI. This must point to an initialized MPI.
+ *                 It may alias \p A.
+ * \param A        The base of the exponentiation.
+ * \param E        The exponent MPI. It must be non-negative.
+ * \param N        The base for the modular reduction. It must be odd and
+ *                 positive.
+ * \param prec_RR  A helper MPI depending solely on \p N, with the same
+ *                 semantics as in mbedtls_mpi_exp_mod(). This may be \c NULL.
+ * \param T        Working memory of \p T_limbs limbs, or \c NULL to have the
+ *                 function allocate (and free) its own. The function leaves
+ *                 secret-dependent data in it; the caller must zeroize it
+ *                 before releasing it.
+ * \param T_limbs  The number of limbs in \p T. If \p T is not \c NULL, this
+ *                 must be at least mbedtls_mpi_exp_mod_ct_working_limbs().
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED if a memory allocation failed.
+ * \return         #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if \c N is negative or
+ *                 even, if \c E is negative, or if \p T is too small.
+ */
+int mbedtls_mpi_exp_mod_ct( mbedtls_mpi *X, const mbedtls_mpi *A,
+                            const mbedtls_mpi *E, const mbedtls_mpi *N,
+                            mbedtls_mpi *prec_RR,
+                            mbedtls_mpi_uint *T, size_t T_limbs );
+
+/**
+ * \brief          Fill in the cache of R^2 mod N that mbedtls_mpi_exp_mod()
+ *                 and mbedtls_mpi_exp_mod_ct() take as \c prec_RR.
+ *
+ *                 After this function returns successfully, those functions
+ *                 only read \p prec_RR when it is passed with the same \p N,
+ *                 so several threads can use it at the same time.
+ *
+ * \param prec_RR  The cache to fill in. This must point to an initialized
+ *                 MPI. If it is already set, it is only grown if needed.
+ * \param N        The modulus. It must be odd and positive.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED if a memory allocation failed.
+ * \return         #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if \c N is negative or even.
+ */
+int mbedtls_mpi_exp_mod_prepare_rr( mbedtls_mpi *prec_RR,
+                                    const mbedtls_mpi *N );
+
+#endif /* MBEDTLS_BIGNUM_INTERNAL_H */
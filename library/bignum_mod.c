@@ -39,7 +39,7 @@ int mbedtls_mpi_mod_residue_setup( mbedtls_mpi_mod_residue *r,
                                    mbedtls_mpi_uint *p,
                                    size_t p_limbs )
 {
-    if( p_limbs < m->limbs || !mbedtls_mpi_core_lt_ct( m->p, p, p_limbs ) )
+    if( p_limbs < m->limbs || !mbedtls_mpi_core_lt_ct( p, m->p, m->limbs ) )
         return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
 
     r->limbs = m->limbs;
@@ -186,6 +186,28 @@ exit:
 
 /* BEGIN MERGE SLOT 1 */
 
+int mbedtls_mpi_mod_exp( mbedtls_mpi_mod_residue *X,
+                         const mbedtls_mpi_mod_residue *A,
+                         const mbedtls_mpi_uint *E, size_t E_limbs,
+                         const mbedtls_mpi_mod_modulus *N,
+                         mbedtls_mpi_uint *T, size_t T_limbs )
+{
+    if( N->int_rep != MBEDTLS_MPI_MOD_REP_MONTGOMERY ||
+        N->rep.mont.rr == NULL )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( X->limbs != N->limbs || A->limbs != N->limbs || E_limbs == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( T_limbs < mbedtls_mpi_core_exp_mod_working_limbs( N->limbs, E_limbs ) )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    mbedtls_mpi_core_exp_mod( X->p, A->p, N->p, N->limbs, E, E_limbs,
+                              N->rep.mont.rr, T );
+
+    return( 0 );
+}
+
 /* END MERGE SLOT 1 */
 
 /* BEGIN MERGE SLOT 2 */
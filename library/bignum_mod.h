@@ -150,6 +150,39 @@ void mbedtls_mpi_mod_modulus_free( mbedtls_mpi_mod_modulus *m );
 
 /* BEGIN MERGE SLOT 1 */
 
+/** \brief  Perform a modular exponentiation with secret exponent:
+ *         X = A^E mod N
+ *
+ * This is a thin wrapper around mbedtls_mpi_core_exp_mod() that takes the
+ * Montgomery constants from \p N. It does not allocate memory, and its
+ * running time only depends on the number of limbs of \p N and \p E.
+ *
+ * \p X may be aliased to \p A.
+ *
+ * \param[out] X      The address of the result residue. It must be set up
+ *                    with the same modulus as \p A.
+ * \param[in] A       The address of the base residue.
+ * \param[in] E       The exponent, as a little endian array of length
+ *                    \p E_limbs.
+ * \param E_limbs     The number of limbs in \p E.
+ * \param[in] N       The address of the modulus. It must have been set up
+ *                    with #MBEDTLS_MPI_MOD_REP_MONTGOMERY.
+ * \param[in,out] T   Temporary storage of length \p T_limbs limbs.
+ * \param T_limbs     The number of limbs in \p T. This must be at least
+ *                    `mbedtls_mpi_core_exp_mod_working_limbs( N->limbs,
+ *                    E_limbs )`.
+ *
+ * \return      \c 0 if successful.
+ * \return      #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if \p N is not set up for
+ *              Montgomery representation, if \p X or \p A do not have the
+ *              size of \p N, if \p E_limbs is 0 or if \p T is too small.
+ */
+int mbedtls_mpi_mod_exp( mbedtls_mpi_mod_residue *X,
+                         const mbedtls_mpi_mod_residue *A,
+                         const mbedtls_mpi_uint *E, size_t E_limbs,
+                         const mbedtls_mpi_mod_modulus *N,
+                         mbedtls_mpi_uint *T, size_t T_limbs );
+
 /* END MERGE SLOT 1 */
 
 /* BEGIN MERGE SLOT 2 */
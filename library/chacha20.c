@@ -34,6 +34,21 @@
 
 #include "mbedtls/platform.h"
 
+#if defined(MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT)
+#  if defined(__GNUC__) && ( defined(__amd64__) || defined(__x86_64__) )
+#    define CHACHA20_SIMD_X86_64
+#    include <immintrin.h>
+#    ifndef asm
+#      define asm __asm
+#    endif
+#  elif defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#    define CHACHA20_SIMD_NEON
+#    include <arm_neon.h>
+#  else
+#    undef MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT
+#  endif
+#endif
+
 #if !defined(MBEDTLS_CHACHA20_ALT)
 
 #if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
@@ -157,6 +172,378 @@ static void chacha20_block( const uint32_t initial_state[16],
     mbedtls_platform_zeroize( working_state, sizeof( working_state ) );
 }
 
+#if defined(MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT)
+/*
+ * The SIMD kernels keep word i of each of the 4 or 8 blocks in the lanes
+ * of vector x[i], so that the quarter rounds operate on all the blocks at
+ * once. The blocks use consecutive counter values, which wrap modulo 2^32
+ * like ctx->state[CHACHA20_CTR_INDEX] in the C code. At the end, groups of
+ * 4 words are transposed back into block order and XORed with the input.
+ */
+#define CHACHA20_SIMD_DOUBLE_ROUND( QR, x )  \
+    do                                      \
+    {                                       \
+        QR( x, 0, 4,  8, 12 );              \
+        QR( x, 1, 5,  9, 13 );              \
+        QR( x, 2, 6, 10, 14 );              \
+        QR( x, 3, 7, 11, 15 );              \
+        QR( x, 0, 5, 10, 15 );              \
+        QR( x, 1, 6, 11, 12 );              \
+        QR( x, 2, 7,  8, 13 );              \
+        QR( x, 3, 4,  9, 14 );              \
+    } while( 0 )
+
+#if defined(CHACHA20_SIMD_X86_64)
+
+#define CHACHA20_SSE2_ROTL( v, n ) \
+    _mm_or_si128( _mm_slli_epi32( v, n ), _mm_srli_epi32( v, 32 - ( n ) ) )
+
+#define CHACHA20_SSE2_QR( x, a, b, c, d )                                  \
+    do                                                                      \
+    {                                                                       \
+        x[a] = _mm_add_epi32( x[a], x[b] );                                 \
+        x[d] = _mm_xor_si128( x[d], x[a] );                                 \
+        x[d] = _mm_shufflehi_epi16( _mm_shufflelo_epi16( x[d], 0xB1 ),      \
+                                    0xB1 );                                 \
+        x[c] = _mm_add_epi32( x[c], x[d] );                                 \
+        x[b] = _mm_xor_si128( x[b], x[c] );                                 \
+        x[b] = CHACHA20_SSE2_ROTL( x[b], 12 );                              \
+        x[a] = _mm_add_epi32( x[a], x[b] );                                 \
+        x[d] = _mm_xor_si128( x[d], x[a] );                                 \
+        x[d] = CHACHA20_SSE2_ROTL( x[d], 8 );                               \
+        x[c] = _mm_add_epi32( x[c], x[d] );                                 \
+        x[b] = _mm_xor_si128( x[b], x[c] );                                 \
+        x[b] = CHACHA20_SSE2_ROTL( x[b], 7 );                               \
+    } while( 0 )
+
+/*
+ * Encrypt 4 blocks (256 bytes) with SSE2, which all x86-64 processors have.
+ */
+static void chacha20_blocks_sse2( uint32_t state[16],
+                                  const unsigned char *input,
+                                  unsigned char *output )
+{
+    __m128i s[16], x[16];
+    __m128i t0, t1, t2, t3;
+    size_t i, k;
+
+    for( i = 0U; i < 16U; i++ )
+        s[i] = _mm_set1_epi32( (int) state[i] );
+    s[CHACHA20_CTR_INDEX] = _mm_add_epi32( s[CHACHA20_CTR_INDEX],
+                                           _mm_set_epi32( 3, 2, 1, 0 ) );
+
+    for( i = 0U; i < 16U; i++ )
+        x[i] = s[i];
+
+    for( i = 0U; i < 10U; i++ )
+        CHACHA20_SIMD_DOUBLE_ROUND( CHACHA20_SSE2_QR, x );
+
+    for( i = 0U; i < 16U; i++ )
+        x[i] = _mm_add_epi32( x[i], s[i] );
+
+    for( i = 0U; i < 16U; i += 4U )
+    {
+        t0 = _mm_unpacklo_epi32( x[i    ], x[i + 1] );
+        t1 = _mm_unpacklo_epi32( x[i + 2], x[i + 3] );
+        t2 = _mm_unpackhi_epi32( x[i    ], x[i + 1] );
+        t3 = _mm_unpackhi_epi32( x[i + 2], x[i + 3] );
+
+        /* Words i to i + 3 of blocks 0 to 3 */
+        x[i    ] = _mm_unpacklo_epi64( t0, t1 );
+        x[i + 1] = _mm_unpackhi_epi64( t0, t1 );
+        x[i + 2] = _mm_unpacklo_epi64( t2, t3 );
+        x[i + 3] = _mm_unpackhi_epi64( t2, t3 );
+
+        for( k = 0U; k < 4U; k++ )
+        {
+            size_t offset = k * CHACHA20_BLOCK_SIZE_BYTES + i * 4U;
+            __m128i m = _mm_loadu_si128( (const __m128i *) ( input + offset ) );
+
+            _mm_storeu_si128( (__m128i *) ( output + offset ),
+                              _mm_xor_si128( m, x[i + k] ) );
+        }
+    }
+
+    mbedtls_platform_zeroize( s, sizeof( s ) );
+    mbedtls_platform_zeroize( x, sizeof( x ) );
+    mbedtls_platform_zeroize( &t0, sizeof( t0 ) );
+    mbedtls_platform_zeroize( &t1, sizeof( t1 ) );
+    mbedtls_platform_zeroize( &t2, sizeof( t2 ) );
+    mbedtls_platform_zeroize( &t3, sizeof( t3 ) );
+
+    state[CHACHA20_CTR_INDEX] += 4U;
+}
+
+#if defined(MBEDTLS_HAVE_ASM)
+#define CHACHA20_SIMD_AVX2
+
+#define CHACHA20_AVX2_ROTL( v, n ) \
+    _mm256_or_si256( _mm256_slli_epi32( v, n ), _mm256_srli_epi32( v, 32 - ( n ) ) )
+
+#define CHACHA20_AVX2_QR( x, a, b, c, d )                                  \
+    do                                                                      \
+    {                                                                       \
+        x[a] = _mm256_add_epi32( x[a], x[b] );                              \
+        x[d] = _mm256_xor_si256( x[d], x[a] );                              \
+        x[d] = _mm256_shuffle_epi8( x[d], rot16 );                          \
+        x[c] = _mm256_add_epi32( x[c], x[d] );                              \
+        x[b] = _mm256_xor_si256( x[b], x[c] );                              \
+        x[b] = CHACHA20_AVX2_ROTL( x[b], 12 );                              \
+        x[a] = _mm256_add_epi32( x[a], x[b] );                              \
+        x[d] = _mm256_xor_si256( x[d], x[a] );                              \
+        x[d] = _mm256_shuffle_epi8( x[d], rot8 );                           \
+        x[c] = _mm256_add_epi32( x[c], x[d] );                              \
+        x[b] = _mm256_xor_si256( x[b], x[c] );                              \
+        x[b] = CHACHA20_AVX2_ROTL( x[b], 7 );                               \
+    } while( 0 )
+
+/*
+ * Check whether the processor and the operating system support AVX2.
+ */
+static int chacha20_has_avx2( void )
+{
+    static int avx2 = -1;
+    unsigned int a, b, c, d;
+
+    if( avx2 < 0 )
+    {
+        int result = 0;
+
+        asm( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d) : "a" (1), "c" (0) );
+
+        /* OSXSAVE and AVX, then check that the OS saves the YMM state */
+        if( ( c & ( 1U << 27 ) ) != 0 && ( c & ( 1U << 28 ) ) != 0 )
+        {
+            asm( ".byte 0x0f, 0x01, 0xd0" : "=a" (a), "=d" (d) : "c" (0) );
+            if( ( a & 0x6 ) == 0x6 )
+            {
+                asm( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                             : "a" (7), "c" (0) );
+                result = ( b & ( 1U << 5 ) ) != 0;
+            }
+        }
+
+        avx2 = result;
+    }
+
+    return( avx2 );
+}
+
+/*
+ * Encrypt 8 blocks (512 bytes) with AVX2.
+ */
+__attribute__((target("avx2")))
+static void chacha20_blocks_avx2( uint32_t state[16],
+                                  const unsigned char *input,
+                                  unsigned char *output )
+{
+    const __m256i rot16 = _mm256_setr_epi8( 2, 3, 0, 1, 6, 7, 4, 5,
+                                            10, 11, 8, 9, 14, 15, 12, 13,
+                                            2, 3, 0, 1, 6, 7, 4, 5,
+                                            10, 11, 8, 9, 14, 15, 12, 13 );
+    const __m256i rot8 = _mm256_setr_epi8( 3, 0, 1, 2, 7, 4, 5, 6,
+                                           11, 8, 9, 10, 15, 12, 13, 14,
+                                           3, 0, 1, 2, 7, 4, 5, 6,
+                                           11, 8, 9, 10, 15, 12, 13, 14 );
+    __m256i s[16], x[16];
+    __m256i t0, t1, t2, t3;
+    __m256i lo, hi, m;
+    size_t i, k;
+
+    for( i = 0U; i < 16U; i++ )
+        s[i] = _mm256_set1_epi32( (int) state[i] );
+    s[CHACHA20_CTR_INDEX] = _mm256_add_epi32( s[CHACHA20_CTR_INDEX],
+                                   _mm256_set_epi32( 7, 6, 5, 4, 3, 2, 1, 0 ) );
+
+    for( i = 0U; i < 16U; i++ )
+        x[i] = s[i];
+
+    for( i = 0U; i < 10U; i++ )
+        CHACHA20_SIMD_DOUBLE_ROUND( CHACHA20_AVX2_QR, x );
+
+    for( i = 0U; i < 16U; i++ )
+        x[i] = _mm256_add_epi32( x[i], s[i] );
+
+    /* Transpose each group of 4 words within the 128-bit lanes: the low
+     * lane of x[i + k] then holds words i to i + 3 of block k and the high
+     * lane holds the same words of block k + 4. */
+    for( i = 0U; i < 16U; i += 4U )
+    {
+        t0 = _mm256_unpacklo_epi32( x[i    ], x[i + 1] );
+        t1 = _mm256_unpacklo_epi32( x[i + 2], x[i + 3] );
+        t2 = _mm256_unpackhi_epi32( x[i    ], x[i + 1] );
+        t3 = _mm256_unpackhi_epi32( x[i + 2], x[i + 3] );
+
+        x[i    ] = _mm256_unpacklo_epi64( t0, t1 );
+        x[i + 1] = _mm256_unpackhi_epi64( t0, t1 );
+        x[i + 2] = _mm256_unpacklo_epi64( t2, t3 );
+        x[i + 3] = _mm256_unpackhi_epi64( t2, t3 );
+    }
+
+    /* Combine words i to i + 3 with words i + 4 to i + 7 to produce
+     * 32 bytes of one block at a time. */
+    for( i = 0U; i < 16U; i += 8U )
+    {
+        for( k = 0U; k < 4U; k++ )
+        {
+            size_t offset = k * CHACHA20_BLOCK_SIZE_BYTES + i * 4U;
+            size_t offset_hi = offset + 4U * CHACHA20_BLOCK_SIZE_BYTES;
+
+            lo = _mm256_permute2x128_si256( x[i + k], x[i + 4 + k], 0x20 );
+            hi = _mm256_permute2x128_si256( x[i + k], x[i + 4 + k], 0x31 );
+
+            m = _mm256_loadu_si256( (const __m256i *) ( input + offset ) );
+            _mm256_storeu_si256( (__m256i *) ( output + offset ),
+                                 _mm256_xor_si256( m, lo ) );
+
+            m = _mm256_loadu_si256( (const __m256i *) ( input + offset_hi ) );
+            _mm256_storeu_si256( (__m256i *) ( output + offset_hi ),
+                                 _mm256_xor_si256( m, hi ) );
+        }
+    }
+
+    mbedtls_platform_zeroize( s, sizeof( s ) );
+    mbedtls_platform_zeroize( x, sizeof( x ) );
+    mbedtls_platform_zeroize( &t0, sizeof( t0 ) );
+    mbedtls_platform_zeroize( &t1, sizeof( t1 ) );
+    mbedtls_platform_zeroize( &t2, sizeof( t2 ) );
+    mbedtls_platform_zeroize( &t3, sizeof( t3 ) );
+    mbedtls_platform_zeroize( &lo, sizeof( lo ) );
+    mbedtls_platform_zeroize( &hi, sizeof( hi ) );
+
+    state[CHACHA20_CTR_INDEX] += 8U;
+}
+#endif /* MBEDTLS_HAVE_ASM */
+
+#elif defined(CHACHA20_SIMD_NEON)
+
+#define CHACHA20_NEON_ROTL( v, n ) \
+    vsriq_n_u32( vshlq_n_u32( v, n ), v, 32 - ( n ) )
+
+#define CHACHA20_NEON_QR( x, a, b, c, d )                                  \
+    do                                                                      \
+    {                                                                       \
+        x[a] = vaddq_u32( x[a], x[b] );                                     \
+        x[d] = veorq_u32( x[d], x[a] );                                     \
+        x[d] = vreinterpretq_u32_u16(                                       \
+                   vrev32q_u16( vreinterpretq_u16_u32( x[d] ) ) );          \
+        x[c] = vaddq_u32( x[c], x[d] );                                     \
+        x[b] = veorq_u32( x[b], x[c] );                                     \
+        x[b] = CHACHA20_NEON_ROTL( x[b], 12 );                              \
+        x[a] = vaddq_u32( x[a], x[b] );                                     \
+        x[d] = veorq_u32( x[d], x[a] );                                     \
+        x[d] = CHACHA20_NEON_ROTL( x[d], 8 );                               \
+        x[c] = vaddq_u32( x[c], x[d] );                                     \
+        x[b] = veorq_u32( x[b], x[c] );                                     \
+        x[b] = CHACHA20_NEON_ROTL( x[b], 7 );                               \
+    } while( 0 )
+
+/*
+ * Encrypt 4 blocks (256 bytes) with Neon, which all Aarch64 processors have.
+ */
+static void chacha20_blocks_neon( uint32_t state[16],
+                                  const unsigned char *input,
+                                  unsigned char *output )
+{
+    static const uint32_t lanes[4] = { 0, 1, 2, 3 };
+    uint32x4_t s[16], x[16];
+    uint64x2_t t0, t1, t2, t3;
+    size_t i, k;
+
+    for( i = 0U; i < 16U; i++ )
+        s[i] = vdupq_n_u32( state[i] );
+    s[CHACHA20_CTR_INDEX] = vaddq_u32( s[CHACHA20_CTR_INDEX],
+                                       vld1q_u32( lanes ) );
+
+    for( i = 0U; i < 16U; i++ )
+        x[i] = s[i];
+
+    for( i = 0U; i < 10U; i++ )
+        CHACHA20_SIMD_DOUBLE_ROUND( CHACHA20_NEON_QR, x );
+
+    for( i = 0U; i < 16U; i++ )
+        x[i] = vaddq_u32( x[i], s[i] );
+
+    for( i = 0U; i < 16U; i += 4U )
+    {
+        t0 = vreinterpretq_u64_u32( vtrn1q_u32( x[i    ], x[i + 1] ) );
+        t1 = vreinterpretq_u64_u32( vtrn2q_u32( x[i    ], x[i + 1] ) );
+        t2 = vreinterpretq_u64_u32( vtrn1q_u32( x[i + 2], x[i + 3] ) );
+        t3 = vreinterpretq_u64_u32( vtrn2q_u32( x[i + 2], x[i + 3] ) );
+
+        /* Words i to i + 3 of blocks 0 to 3 */
+        x[i    ] = vreinterpretq_u32_u64( vtrn1q_u64( t0, t2 ) );
+        x[i + 1] = vreinterpretq_u32_u64( vtrn1q_u64( t1, t3 ) );
+        x[i + 2] = vreinterpretq_u32_u64( vtrn2q_u64( t0, t2 ) );
+        x[i + 3] = vreinterpretq_u32_u64( vtrn2q_u64( t1, t3 ) );
+
+        for( k = 0U; k < 4U; k++ )
+        {
+            size_t offset = k * CHACHA20_BLOCK_SIZE_BYTES + i * 4U;
+            uint8x16_t m = vld1q_u8( input + offset );
+
+            vst1q_u8( output + offset,
+                      veorq_u8( m, vreinterpretq_u8_u32( x[i + k] ) ) );
+        }
+    }
+
+    mbedtls_platform_zeroize( s, sizeof( s ) );
+    mbedtls_platform_zeroize( x, sizeof( x ) );
+    mbedtls_platform_zeroize( &t0, sizeof( t0 ) );
+    mbedtls_platform_zeroize( &t1, sizeof( t1 ) );
+    mbedtls_platform_zeroize( &t2, sizeof( t2 ) );
+    mbedtls_platform_zeroize( &t3, sizeof( t3 ) );
+
+    state[CHACHA20_CTR_INDEX] += 4U;
+}
+
+#endif /* CHACHA20_SIMD_NEON */
+
+/**
+ * \brief           Encrypt as many groups of 4 or 8 whole blocks as possible
+ *                  with the best available SIMD kernel.
+ *
+ * \param state     The ChaCha20 state. Its counter is advanced by the number
+ *                  of blocks processed.
+ * \param size      The number of bytes available.
+ * \param input     The input data.
+ * \param output    The output buffer.
+ *
+ * \return          The number of bytes processed, a multiple of 256.
+ */
+static size_t chacha20_simd_process( uint32_t state[16],
+                                     size_t size,
+                                     const unsigned char *input,
+                                     unsigned char *output )
+{
+    size_t offset = 0U;
+
+#if defined(CHACHA20_SIMD_AVX2)
+    if( size >= 8U * CHACHA20_BLOCK_SIZE_BYTES && chacha20_has_avx2() )
+    {
+        do
+        {
+            chacha20_blocks_avx2( state, input + offset, output + offset );
+            offset += 8U * CHACHA20_BLOCK_SIZE_BYTES;
+        }
+        while( size - offset >= 8U * CHACHA20_BLOCK_SIZE_BYTES );
+    }
+#endif
+
+    while( size - offset >= 4U * CHACHA20_BLOCK_SIZE_BYTES )
+    {
+#if defined(CHACHA20_SIMD_X86_64)
+        chacha20_blocks_sse2( state, input + offset, output + offset );
+#else
+        chacha20_blocks_neon( state, input + offset, output + offset );
+#endif
+        offset += 4U * CHACHA20_BLOCK_SIZE_BYTES;
+    }
+
+    return( offset );
+}
+#endif /* MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT */
+
 void mbedtls_chacha20_init( mbedtls_chacha20_context *ctx )
 {
     mbedtls_platform_zeroize( ctx->state, sizeof( ctx->state ) );
@@ -235,6 +622,17 @@ int mbedtls_chacha20_update( mbedtls_chacha20_context *ctx,
         size--;
     }
 
+#if defined(MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT)
+    /* Process groups of full blocks with SIMD */
+    if( size >= 4U * CHACHA20_BLOCK_SIZE_BYTES )
+    {
+        size_t done = chacha20_simd_process( ctx->state, size,
+                                             input + offset, output + offset );
+        offset += done;
+        size   -= done;
+    }
+#endif
+
     /* Process full blocks */
     while( size >= CHACHA20_BLOCK_SIZE_BYTES )
     {
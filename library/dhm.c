@@ -32,6 +32,8 @@
 #include "mbedtls/dhm.h"
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
+#include "bignum_core.h"
+#include "bignum_internal.h"
 
 #include <string.h>
 
@@ -110,6 +112,17 @@ void mbedtls_dhm_init( mbedtls_dhm_context *ctx )
     memset( ctx, 0, sizeof( mbedtls_dhm_context ) );
 }
 
+/*
+ * Forget the values derived from the group, before it is changed
+ */
+static void dhm_reset_group_cache( mbedtls_dhm_context *ctx )
+{
+    mbedtls_mpi_free( &ctx->RP );
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+    ctx->fixed_base = NULL;
+#endif
+}
+
 size_t mbedtls_dhm_get_bitlen( const mbedtls_dhm_context *ctx )
 {
     return( mbedtls_mpi_bitlen( &ctx->P ) );
@@ -160,6 +173,8 @@ int mbedtls_dhm_read_params( mbedtls_dhm_context *ctx,
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
+    dhm_reset_group_cache( ctx );
+
     if( ( ret = dhm_read_bignum( &ctx->P,  p, end ) ) != 0 ||
         ( ret = dhm_read_bignum( &ctx->G,  p, end ) ) != 0 ||
         ( ret = dhm_read_bignum( &ctx->GY, p, end ) ) != 0 )
@@ -186,6 +201,38 @@ cleanup:
     return( ret );
 }
 
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+/*
+ * GX = G^X mod P with the comb table of fb, for 0 <= X < P
+ */
+static int dhm_fixed_base_exp( const mbedtls_dhm_fixed_base *fb,
+                               mbedtls_mpi *GX, const mbedtls_mpi *X )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const size_t AN_limbs = fb->P.n;
+    const size_t T_limbs = 3 * AN_limbs + 1;
+    const mbedtls_mpi_uint zero = 0;
+    mbedtls_mpi_uint *T;
+
+    T = mbedtls_calloc( T_limbs, sizeof( mbedtls_mpi_uint ) );
+    if( T == NULL )
+        return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( GX, 0 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( GX, AN_limbs ) );
+
+    mbedtls_mpi_core_fixed_base_exp_mod( GX->p, fb->table, fb->wsize, fb->d,
+                                         fb->P.p, AN_limbs,
+                                         X->n == 0 ? &zero : X->p,
+                                         X->n == 0 ? 1 : X->n, T );
+
+cleanup:
+    mbedtls_platform_zeroize( T, T_limbs * sizeof( mbedtls_mpi_uint ) );
+    mbedtls_free( T );
+    return( ret );
+}
+#endif /* MBEDTLS_DHM_FIXED_BASE */
+
 static int dhm_make_common( mbedtls_dhm_context *ctx, int x_size,
                             int (*f_rng)(void *, unsigned char *, size_t),
                             void *p_rng )
@@ -214,8 +261,14 @@ static int dhm_make_common( mbedtls_dhm_context *ctx, int x_size,
     /*
      * Calculate GX = G^X mod P
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->GX, &ctx->G, &ctx->X,
-                          &ctx->P , &ctx->RP ) );
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+    if( ctx->fixed_base != NULL )
+        MBEDTLS_MPI_CHK( dhm_fixed_base_exp( ctx->fixed_base,
+                                             &ctx->GX, &ctx->X ) );
+    else
+#endif
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_ct( &ctx->GX, &ctx->G, &ctx->X,
+                                             &ctx->P, &ctx->RP, NULL, 0 ) );
 
     if( ( ret = dhm_check_range( &ctx->GX, &ctx->P ) ) != 0 )
         return( ret );
@@ -280,6 +333,8 @@ int mbedtls_dhm_set_group( mbedtls_dhm_context *ctx,
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
+    dhm_reset_group_cache( ctx );
+
     if( ( ret = mbedtls_mpi_copy( &ctx->P, P ) ) != 0 ||
         ( ret = mbedtls_mpi_copy( &ctx->G, G ) ) != 0 )
     {
@@ -289,6 +344,120 @@ int mbedtls_dhm_set_group( mbedtls_dhm_context *ctx,
     return( 0 );
 }
 
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+void mbedtls_dhm_fixed_base_init( mbedtls_dhm_fixed_base *fb )
+{
+    memset( fb, 0, sizeof( mbedtls_dhm_fixed_base ) );
+}
+
+/*
+ * Comb width for the table: 5 bits, or 6 bits above 2560 bits, capped like
+ * the window of mbedtls_mpi_exp_mod(). Wider combs save few multiplications
+ * compared to the time spent scanning the larger table for each of them.
+ */
+static size_t dhm_fixed_base_wsize( size_t Pbits )
+{
+    size_t wsize = ( Pbits > 2560 ) ? 6 : 5;
+
+#if( MBEDTLS_MPI_WINDOW_SIZE < 6 )
+    if( wsize > MBEDTLS_MPI_WINDOW_SIZE )
+        wsize = MBEDTLS_MPI_WINDOW_SIZE;
+#endif
+
+    return( wsize );
+}
+
+/*
+ * Precompute the comb table for G
+ */
+int mbedtls_dhm_fixed_base_setup( mbedtls_dhm_fixed_base *fb,
+                                  const mbedtls_mpi *P,
+                                  const mbedtls_mpi *G )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi_uint *T = NULL;
+    mbedtls_mpi Gn;
+    size_t AN_limbs, Pbits;
+
+    mbedtls_dhm_fixed_base_free( fb );
+
+    if( mbedtls_mpi_cmp_int( P, 0 ) <= 0 || mbedtls_mpi_get_bit( P, 0 ) == 0 ||
+        mbedtls_mpi_cmp_int( G, 1 ) <= 0 || mbedtls_mpi_cmp_mpi( G, P ) >= 0 )
+        return( MBEDTLS_ERR_DHM_BAD_INPUT_DATA );
+
+    mbedtls_mpi_init( &Gn );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &fb->P, P ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &fb->G, G ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_prepare_rr( &fb->RP, &fb->P ) );
+
+    AN_limbs = fb->P.n;
+    Pbits = mbedtls_mpi_bitlen( &fb->P );
+    fb->wsize = dhm_fixed_base_wsize( Pbits );
+    fb->d = ( Pbits + fb->wsize - 1 ) / fb->wsize;
+
+    /* G on exactly as many limbs as P */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Gn, G ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &Gn, AN_limbs ) );
+
+    fb->table = mbedtls_calloc(
+        mbedtls_mpi_core_fixed_base_table_limbs( AN_limbs, fb->wsize ),
+        sizeof( mbedtls_mpi_uint ) );
+    T = mbedtls_calloc( 2 * AN_limbs + 1, sizeof( mbedtls_mpi_uint ) );
+    if( fb->table == NULL || T == NULL )
+    {
+        ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    mbedtls_mpi_core_fixed_base_setup( fb->table, fb->wsize, fb->d, Gn.p,
+                                       fb->P.p, AN_limbs, fb->RP.p, T );
+
+cleanup:
+    mbedtls_free( T );
+    mbedtls_mpi_free( &Gn );
+    if( ret != 0 )
+        mbedtls_dhm_fixed_base_free( fb );
+
+    return( ret );
+}
+
+void mbedtls_dhm_fixed_base_free( mbedtls_dhm_fixed_base *fb )
+{
+    if( fb == NULL )
+        return;
+
+    mbedtls_free( fb->table );
+    mbedtls_mpi_free( &fb->RP );
+    mbedtls_mpi_free( &fb->G );
+    mbedtls_mpi_free( &fb->P );
+
+    mbedtls_platform_zeroize( fb, sizeof( mbedtls_dhm_fixed_base ) );
+}
+
+/*
+ * Set the group from a fixed-base table, and use the table for G^X
+ */
+int mbedtls_dhm_set_fixed_base( mbedtls_dhm_context *ctx,
+                                const mbedtls_dhm_fixed_base *fb )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( fb->table == NULL )
+        return( MBEDTLS_ERR_DHM_BAD_INPUT_DATA );
+
+    if( ( ret = mbedtls_dhm_set_group( ctx, &fb->P, &fb->G ) ) != 0 )
+        return( ret );
+
+    if( ( ret = mbedtls_mpi_copy( &ctx->RP, &fb->RP ) ) != 0 )
+        return( MBEDTLS_ERROR_ADD( MBEDTLS_ERR_DHM_SET_GROUP_FAILED, ret ) );
+
+    ctx->fixed_base = fb;
+
+    return( 0 );
+}
+#endif /* MBEDTLS_DHM_FIXED_BASE */
+
 /*
  * Import the peer's public value G^Y
  */
@@ -393,7 +562,8 @@ static int dhm_update_blinding( mbedtls_dhm_context *ctx,
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vf, &ctx->Vf, &R ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vf, &ctx->Vf, &ctx->P ) );
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->Vf, &ctx->Vf, &ctx->X, &ctx->P, &ctx->RP ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_ct( &ctx->Vf, &ctx->Vf, &ctx->X,
+                                             &ctx->P, &ctx->RP, NULL, 0 ) );
 
 cleanup:
     mbedtls_mpi_free( &R );
@@ -429,8 +599,8 @@ int mbedtls_dhm_calc_secret( mbedtls_dhm_context *ctx,
     MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &GYb, &GYb, &ctx->P ) );
 
     /* Do modular exponentiation */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->K, &GYb, &ctx->X,
-                          &ctx->P, &ctx->RP ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_ct( &ctx->K, &GYb, &ctx->X,
+                                             &ctx->P, &ctx->RP, NULL, 0 ) );
 
     /* Unblind secret value */
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->K, &ctx->K, &ctx->Vf ) );
@@ -530,6 +700,8 @@ int mbedtls_dhm_parse_dhm( mbedtls_dhm_context *dhm, const unsigned char *dhmin,
 
     end = p + len;
 
+    dhm_reset_group_cache( dhm );
+
     if( ( ret = mbedtls_asn1_get_mpi( &p, end, &dhm->P  ) ) != 0 ||
         ( ret = mbedtls_asn1_get_mpi( &p, end, &dhm->G ) ) != 0 )
     {
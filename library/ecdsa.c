@@ -30,8 +30,18 @@
 #include "mbedtls/ecdsa.h"
 #include "mbedtls/asn1write.h"
 
+#include "bignum_core.h"
+#include "ecp_internal.h"
+
 #include <string.h>
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL) && !defined(_WIN32) && \
+    ( defined(unix) || defined(__unix) || defined(__unix__) || \
+      ( defined(__APPLE__) && defined(__MACH__) ) )
+#include <unistd.h>
+#define ECDSA_NONCE_POOL_HAVE_GETPID
+#endif
+
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC)
 #include "mbedtls/hmac_drbg.h"
 #endif
@@ -233,6 +243,100 @@ cleanup:
 #endif /* ECDSA_DETERMINISTIC || !ECDSA_SIGN_ALT || !ECDSA_VERIFY_ALT */
 
 #if !defined(MBEDTLS_ECDSA_SIGN_ALT)
+/*
+ * Maximum number of limbs of a group order. By Hasse's theorem the order can
+ * be one bit longer than p.
+ */
+#define ECDSA_MAX_LIMBS     BITS_TO_LIMBS( MBEDTLS_ECP_MAX_BITS + 1 )
+
+/*
+ * X = A^-1 mod N for 0 < A < N, where N is the (prime) order of the group.
+ *
+ * This computes A^(N - 2) with a fixed 4-bit window over the exponent, which
+ * is public, so the only operations on A are Montgomery multiplications
+ * with fixed-size operands. Unlike the binary extended GCD of
+ * mbedtls_mpi_inv_mod(), this is constant-time in A, and it is faster
+ * for the sizes of curve orders.
+ */
+static int ecdsa_inv_mod_n( const mbedtls_ecp_group *grp, mbedtls_mpi *X,
+                            const mbedtls_mpi *A )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const mbedtls_mpi_uint *N = grp->N.p;
+    const size_t limbs = grp->N.n;
+    const mbedtls_mpi_uint one = 1;
+    mbedtls_mpi_uint W[16][ECDSA_MAX_LIMBS];
+    mbedtls_mpi_uint E[ECDSA_MAX_LIMBS];
+    mbedtls_mpi_uint R[ECDSA_MAX_LIMBS];
+    mbedtls_mpi_uint T[2 * ECDSA_MAX_LIMBS + 1];
+    mbedtls_mpi_uint mm, borrow;
+    mbedtls_mpi RR;
+    size_t i, j, nbits = limbs * biL;
+    unsigned int e;
+    int started = 0;
+
+    /* Fermat's little theorem needs an odd prime; leave custom groups with
+     * unusual orders to the generic code. */
+    if( limbs > ECDSA_MAX_LIMBS || ( N[0] & 1 ) == 0 ||
+        mbedtls_mpi_cmp_int( &grp->N, 3 ) < 0 )
+        return( mbedtls_mpi_inv_mod( X, A, &grp->N ) );
+
+    mbedtls_mpi_init( &RR );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_core_get_mont_r2_unsafe( &RR, &grp->N ) );
+    mm = mbedtls_mpi_core_montmul_init( N );
+
+    /* E = N - 2 */
+    borrow = 2;
+    for( i = 0; i < limbs; i++ )
+    {
+        E[i] = N[i] - borrow;
+        borrow = ( N[i] < borrow );
+    }
+
+    /* W[i] = A^i, in Montgomery form. A may alias X, so copy it first. */
+    memset( R, 0, sizeof( R ) );
+    memcpy( R, A->p, ( A->n < limbs ? A->n : limbs ) * ciL );
+    mbedtls_mpi_core_montmul( W[1], R, RR.p, RR.n, N, limbs, mm, T );
+    for( i = 2; i < 16; i++ )
+        mbedtls_mpi_core_montmul( W[i], W[i-1], W[1], limbs, N, limbs, mm, T );
+
+    /* biL is a multiple of 4, so windows don't straddle limbs */
+    for( i = nbits; i > 0; i -= 4 )
+    {
+        e = ( E[( i - 4 ) / biL] >> ( ( i - 4 ) % biL ) ) & 0x0F;
+
+        if( ! started )
+        {
+            if( e != 0 )
+            {
+                memcpy( R, W[e], limbs * ciL );
+                started = 1;
+            }
+            continue;
+        }
+
+        for( j = 0; j < 4; j++ )
+            mbedtls_mpi_core_montmul( R, R, R, limbs, N, limbs, mm, T );
+        if( e != 0 )
+            mbedtls_mpi_core_montmul( R, R, W[e], limbs, N, limbs, mm, T );
+    }
+
+    /* Out of Montgomery form */
+    mbedtls_mpi_core_montmul( R, R, &one, 1, N, limbs, mm, T );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, limbs ) );
+    memcpy( X->p, R, limbs * ciL );
+
+cleanup:
+    mbedtls_mpi_free( &RR );
+    mbedtls_platform_zeroize( W, sizeof( W ) );
+    mbedtls_platform_zeroize( R, sizeof( R ) );
+    mbedtls_platform_zeroize( T, sizeof( T ) );
+
+    return( ret );
+}
+
 /*
  * Compute ECDSA signature of a hashed message (SEC1 4.1.3)
  * Obviously, compared to SEC1 4.1.3, we skip step 4 (hash message)
@@ -351,7 +455,7 @@ modn:
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &e, &e, &t ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( pk, pk, &t ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( pk, pk, &grp->N ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( s, pk, &grp->N ) );
+        MBEDTLS_MPI_CHK( ecdsa_inv_mod_n( grp, s, pk ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, s, &e ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( s, s, &grp->N ) );
     }
@@ -396,6 +500,510 @@ int mbedtls_ecdsa_sign( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
     return( ecdsa_sign_restartable( grp, r, s, d, buf, blen,
                                     f_rng, p_rng, f_rng, p_rng, NULL ) );
 }
+
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+/*
+ * Compute a nonce entry: kinv = k^-1 mod n and r = x(kG) mod n, for a random
+ * ephemeral key k (SEC1 4.1.3 steps 1-3, and the inversion of step 6).
+ */
+static int ecdsa_gen_nonce( mbedtls_ecp_group *grp,
+                            mbedtls_mpi *kinv, mbedtls_mpi *r,
+                            int (*f_rng)(void *, unsigned char *, size_t),
+                            void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    int key_tries = 0;
+    mbedtls_ecp_point R;
+    mbedtls_mpi k;
+
+    mbedtls_ecp_point_init( &R );
+    mbedtls_mpi_init( &k );
+
+    do
+    {
+        if( key_tries++ > 10 )
+        {
+            ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+            goto cleanup;
+        }
+
+        MBEDTLS_MPI_CHK( mbedtls_ecp_gen_privkey( grp, &k, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_mul( grp, &R, &k, &grp->G,
+                                          f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( r, &R.X, &grp->N ) );
+    }
+    while( mbedtls_mpi_cmp_int( r, 0 ) == 0 );
+
+    MBEDTLS_MPI_CHK( ecdsa_inv_mod_n( grp, kinv, &k ) );
+
+cleanup:
+    mbedtls_ecp_point_free( &R );
+    mbedtls_mpi_free( &k );
+
+    return( ret );
+}
+
+#if defined(MBEDTLS_THREADING_C)
+/*
+ * Lock and unlock one of the mutexes of a pool: pool->mutex protects the
+ * entries and the state of the refill thread, pool->gen_mutex serializes
+ * the computation of new entries, which uses pool->grp and the RNG.
+ *
+ * With MBEDTLS_THREADING_PTHREAD, the refill thread sleeps on a condition
+ * variable, which must be paired with a pthread mutex. So the pool owns
+ * plain pthread mutexes in that case, rather than mbedtls mutexes.
+ */
+#if defined(MBEDTLS_THREADING_PTHREAD)
+typedef pthread_mutex_t ecdsa_nonce_pool_mutex_t;
+#else
+typedef mbedtls_threading_mutex_t ecdsa_nonce_pool_mutex_t;
+#endif
+
+static int ecdsa_nonce_pool_lock( ecdsa_nonce_pool_mutex_t *mutex )
+{
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    if( pthread_mutex_lock( mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+    return( 0 );
+#else
+    return( mbedtls_mutex_lock( mutex ) );
+#endif
+}
+
+static int ecdsa_nonce_pool_unlock( ecdsa_nonce_pool_mutex_t *mutex )
+{
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    if( pthread_mutex_unlock( mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+    return( 0 );
+#else
+    return( mbedtls_mutex_unlock( mutex ) );
+#endif
+}
+#endif /* MBEDTLS_THREADING_C */
+
+/*
+ * Compute a new entry for a pool, taking turns with the other threads that
+ * compute entries for the same pool.
+ */
+static int ecdsa_nonce_pool_gen( mbedtls_ecdsa_nonce_pool *pool,
+                                 mbedtls_mpi *kinv, mbedtls_mpi *r )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = ecdsa_nonce_pool_lock( &pool->gen_mutex ) ) != 0 )
+        return( ret );
+#endif
+
+    ret = ecdsa_gen_nonce( &pool->grp, kinv, r, pool->f_rng, pool->p_rng );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ecdsa_nonce_pool_unlock( &pool->gen_mutex ) != 0 && ret == 0 )
+        ret = MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+#endif
+
+    return( ret );
+}
+
+/*
+ * Identify the current process, so that a pool can tell that it has been
+ * inherited by a child process through fork().
+ */
+static unsigned long ecdsa_nonce_pool_pid( void )
+{
+#if defined(ECDSA_NONCE_POOL_HAVE_GETPID)
+    return( (unsigned long) getpid( ) );
+#else
+    return( 0 );
+#endif
+}
+
+/*
+ * Discard the entries of a pool inherited from the parent process, since
+ * the parent may use them too. Must be called with the pool locked.
+ */
+static void ecdsa_nonce_pool_check_fork( mbedtls_ecdsa_nonce_pool *pool )
+{
+    unsigned long pid = ecdsa_nonce_pool_pid( );
+
+    if( pool->pid != pid )
+    {
+        while( pool->count > 0 )
+        {
+            pool->count--;
+            mbedtls_mpi_free( &pool->kinv[pool->count] );
+            mbedtls_mpi_free( &pool->r[pool->count] );
+        }
+        pool->pid = pid;
+    }
+}
+
+/*
+ * Take an entry from the pool, if there is one. Returns 1 if an entry was
+ * taken, 0 if the pool was empty.
+ */
+static int ecdsa_nonce_pool_take( mbedtls_ecdsa_nonce_pool *pool,
+                                  mbedtls_mpi *kinv, mbedtls_mpi *r )
+{
+    int taken = 0;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ecdsa_nonce_pool_lock( &pool->mutex ) != 0 )
+        return( 0 );
+#endif
+
+    ecdsa_nonce_pool_check_fork( pool );
+
+    if( pool->count > 0 )
+    {
+        /* Swap rather than copy: no allocation under the lock, and the slot
+         * gets the caller's empty MPIs. */
+        pool->count--;
+        mbedtls_mpi_swap( kinv, &pool->kinv[pool->count] );
+        mbedtls_mpi_swap( r, &pool->r[pool->count] );
+        taken = 1;
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+        if( pool->running )
+            pthread_cond_signal( &pool->refill );
+#endif
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    (void) ecdsa_nonce_pool_unlock( &pool->mutex );
+#endif
+
+    return( taken );
+}
+
+/*
+ * Store a new entry in the pool. Returns 0 if it was stored, 1 if the pool
+ * was already full. Must be called with the pool locked.
+ */
+static int ecdsa_nonce_pool_put( mbedtls_ecdsa_nonce_pool *pool,
+                                 mbedtls_mpi *kinv, mbedtls_mpi *r )
+{
+    int full = 1;
+
+    ecdsa_nonce_pool_check_fork( pool );
+
+    if( pool->count < pool->size )
+    {
+        mbedtls_mpi_swap( kinv, &pool->kinv[pool->count] );
+        mbedtls_mpi_swap( r, &pool->r[pool->count] );
+        pool->count++;
+        full = 0;
+    }
+
+    return( full );
+}
+
+void mbedtls_ecdsa_nonce_pool_init( mbedtls_ecdsa_nonce_pool *pool )
+{
+    memset( pool, 0, sizeof( mbedtls_ecdsa_nonce_pool ) );
+    mbedtls_ecp_group_init( &pool->grp );
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    (void) pthread_mutex_init( &pool->mutex, NULL );
+    (void) pthread_mutex_init( &pool->gen_mutex, NULL );
+    (void) pthread_cond_init( &pool->refill, NULL );
+#elif defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init( &pool->mutex );
+    mbedtls_mutex_init( &pool->gen_mutex );
+#endif
+}
+
+int mbedtls_ecdsa_nonce_pool_setup( mbedtls_ecdsa_nonce_pool *pool,
+                                    mbedtls_ecp_group_id gid, size_t size,
+                                    int (*f_rng)(void *, unsigned char *, size_t),
+                                    void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i;
+
+    if( size == 0 || f_rng == NULL || ! mbedtls_ecdsa_can_do( gid ) )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_group_load( &pool->grp, gid ) );
+    if( pool->grp.N.p == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    pool->kinv = mbedtls_calloc( size, sizeof( mbedtls_mpi ) );
+    pool->r = mbedtls_calloc( size, sizeof( mbedtls_mpi ) );
+    if( pool->kinv == NULL || pool->r == NULL )
+    {
+        mbedtls_free( pool->kinv );
+        mbedtls_free( pool->r );
+        pool->kinv = NULL;
+        pool->r = NULL;
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+    }
+
+    for( i = 0; i < size; i++ )
+    {
+        mbedtls_mpi_init( &pool->kinv[i] );
+        mbedtls_mpi_init( &pool->r[i] );
+    }
+
+    pool->size = size;
+    pool->count = 0;
+    pool->f_rng = f_rng;
+    pool->p_rng = p_rng;
+    pool->pid = ecdsa_nonce_pool_pid( );
+
+cleanup:
+    return( ret );
+}
+
+int mbedtls_ecdsa_nonce_pool_fill( mbedtls_ecdsa_nonce_pool *pool, size_t max )
+{
+    int ret = 0;
+    mbedtls_mpi kinv, r;
+
+    if( pool->size == 0 )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    {
+        int running;
+
+        if( ( ret = ecdsa_nonce_pool_lock( &pool->mutex ) ) != 0 )
+            return( ret );
+        running = pool->running;
+        if( ( ret = ecdsa_nonce_pool_unlock( &pool->mutex ) ) != 0 )
+            return( ret );
+        if( running )
+            return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+    }
+#endif
+
+    mbedtls_mpi_init( &kinv );
+    mbedtls_mpi_init( &r );
+
+    for( ; max > 0; max-- )
+    {
+        int full;
+
+        MBEDTLS_MPI_CHK( ecdsa_nonce_pool_gen( pool, &kinv, &r ) );
+
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = ecdsa_nonce_pool_lock( &pool->mutex ) ) != 0 )
+            goto cleanup;
+#endif
+        full = ecdsa_nonce_pool_put( pool, &kinv, &r );
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = ecdsa_nonce_pool_unlock( &pool->mutex ) ) != 0 )
+            goto cleanup;
+#endif
+        if( full )
+            break;
+    }
+
+cleanup:
+    mbedtls_mpi_free( &kinv );
+    mbedtls_mpi_free( &r );
+
+    return( ret );
+}
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/*
+ * Refill thread: computes entries outside the pool lock, and sleeps while
+ * the pool is full. A call to mbedtls_ecdsa_nonce_pool_fill() that started
+ * before this thread may still be computing entries; pool->gen_mutex makes
+ * them take turns on the group and the RNG.
+ */
+static void *ecdsa_nonce_pool_thread( void *arg )
+{
+    mbedtls_ecdsa_nonce_pool *pool = arg;
+    mbedtls_mpi kinv, r;
+    int ret = 0;
+
+    mbedtls_mpi_init( &kinv );
+    mbedtls_mpi_init( &r );
+
+    if( ( ret = ecdsa_nonce_pool_lock( &pool->mutex ) ) != 0 )
+        goto exit;
+    while( ! pool->stop )
+    {
+        if( pool->count == pool->size )
+        {
+            pthread_cond_wait( &pool->refill, &pool->mutex );
+            continue;
+        }
+        if( ( ret = ecdsa_nonce_pool_unlock( &pool->mutex ) ) != 0 )
+            goto exit;
+
+        ret = ecdsa_nonce_pool_gen( pool, &kinv, &r );
+
+        if( ecdsa_nonce_pool_lock( &pool->mutex ) != 0 )
+        {
+            ret = MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+            goto exit;
+        }
+        if( ret != 0 )
+            break;
+        (void) ecdsa_nonce_pool_put( pool, &kinv, &r );
+    }
+    pool->thread_ret = ret;
+    (void) ecdsa_nonce_pool_unlock( &pool->mutex );
+    ret = 0;
+
+exit:
+    /* Only reached with ret != 0 if the lock itself failed. */
+    if( ret != 0 )
+        pool->thread_ret = ret;
+    mbedtls_mpi_free( &kinv );
+    mbedtls_mpi_free( &r );
+
+    return( NULL );
+}
+
+int mbedtls_ecdsa_nonce_pool_start( mbedtls_ecdsa_nonce_pool *pool )
+{
+    int ret = 0;
+
+    if( pool->size == 0 )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    if( ( ret = ecdsa_nonce_pool_lock( &pool->mutex ) ) != 0 )
+        return( ret );
+
+    if( pool->running )
+    {
+        ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
+        goto exit;
+    }
+
+    /* The new thread blocks on the pool lock until we release it. */
+    pool->stop = 0;
+    pool->thread_ret = 0;
+    pool->running = 1;
+    if( pthread_create( &pool->thread, NULL,
+                        ecdsa_nonce_pool_thread, pool ) != 0 )
+    {
+        pool->running = 0;
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+    }
+
+exit:
+    if( ecdsa_nonce_pool_unlock( &pool->mutex ) != 0 && ret == 0 )
+        ret = MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+    return( ret );
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+void mbedtls_ecdsa_nonce_pool_free( mbedtls_ecdsa_nonce_pool *pool )
+{
+    size_t i;
+
+    if( pool == NULL )
+        return;
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    {
+        /* If the lock fails, still set the flag: the thread checks it
+         * at least once after each entry it computes. */
+        int locked = ( ecdsa_nonce_pool_lock( &pool->mutex ) == 0 );
+        int running = pool->running;
+
+        pool->stop = 1;
+        pthread_cond_signal( &pool->refill );
+        if( locked )
+            (void) ecdsa_nonce_pool_unlock( &pool->mutex );
+
+        if( running )
+            (void) pthread_join( pool->thread, NULL );
+        pool->running = 0;
+    }
+#endif
+
+    if( pool->kinv != NULL )
+    {
+        for( i = 0; i < pool->size; i++ )
+            mbedtls_mpi_free( &pool->kinv[i] );
+        mbedtls_free( pool->kinv );
+    }
+    if( pool->r != NULL )
+    {
+        for( i = 0; i < pool->size; i++ )
+            mbedtls_mpi_free( &pool->r[i] );
+        mbedtls_free( pool->r );
+    }
+
+    mbedtls_ecp_group_free( &pool->grp );
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    (void) pthread_cond_destroy( &pool->refill );
+    (void) pthread_mutex_destroy( &pool->gen_mutex );
+    (void) pthread_mutex_destroy( &pool->mutex );
+#elif defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &pool->gen_mutex );
+    mbedtls_mutex_free( &pool->mutex );
+#endif
+
+    mbedtls_platform_zeroize( pool, sizeof( mbedtls_ecdsa_nonce_pool ) );
+}
+
+/*
+ * Compute ECDSA signature of a hashed message with a precomputed nonce:
+ * SEC1 4.1.3 steps 5-6 only.
+ */
+int mbedtls_ecdsa_sign_pooled( mbedtls_ecp_group *grp,
+                               mbedtls_mpi *r, mbedtls_mpi *s,
+                               const mbedtls_mpi *d,
+                               const unsigned char *buf, size_t blen,
+                               mbedtls_ecdsa_nonce_pool *pool,
+                               int (*f_rng)(void *, unsigned char *, size_t),
+                               void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    int sign_tries = 0;
+    mbedtls_mpi kinv, e;
+
+    if( f_rng == NULL || pool->size == 0 || grp->id != pool->grp.id )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    if( ! mbedtls_ecdsa_can_do( grp->id ) || grp->N.p == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    /* Make sure d is in range 1..n-1 */
+    if( mbedtls_mpi_cmp_int( d, 1 ) < 0 || mbedtls_mpi_cmp_mpi( d, &grp->N ) >= 0 )
+        return( MBEDTLS_ERR_ECP_INVALID_KEY );
+
+    mbedtls_mpi_init( &kinv ); mbedtls_mpi_init( &e );
+
+    do
+    {
+        if( sign_tries++ > 10 )
+        {
+            ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+            goto cleanup;
+        }
+
+        if( ! ecdsa_nonce_pool_take( pool, &kinv, r ) )
+            MBEDTLS_MPI_CHK( ecdsa_gen_nonce( grp, &kinv, r, f_rng, p_rng ) );
+
+        /*
+         * Step 5: derive MPI from hashed message
+         */
+        MBEDTLS_MPI_CHK( derive_mpi( grp, &e, buf, blen ) );
+
+        /*
+         * Step 6: compute s = (e + r * d) / k
+         */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, r, d ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &e, &e, s ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &e, &e, &grp->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, &kinv, &e ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( s, s, &grp->N ) );
+    }
+    while( mbedtls_mpi_cmp_int( s, 0 ) == 0 );
+
+cleanup:
+    mbedtls_mpi_free( &kinv ); mbedtls_mpi_free( &e );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
 #endif /* !MBEDTLS_ECDSA_SIGN_ALT */
 
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC)
@@ -565,7 +1173,7 @@ muladd:
     /*
      * Step 5: R = u1 G + u2 Q
      */
-    MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_restartable( grp,
+    MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_public_restartable( grp,
                      &R, pu1, &grp->G, pu2, Q, ECDSA_RS_ECP ) );
 
     if( mbedtls_ecp_is_zero( &R ) )
@@ -612,6 +1220,218 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
 }
 #endif /* !MBEDTLS_ECDSA_VERIFY_ALT */
 
+#if defined(MBEDTLS_ECDSA_VERIFY_ALT)
+/*
+ * Verify several ECDSA signatures of hashed messages, one by one
+ */
+int mbedtls_ecdsa_verify_batch( mbedtls_ecp_group *grp,
+                                const unsigned char * const buf[],
+                                const size_t blen[],
+                                const mbedtls_ecp_point * const Q[],
+                                const mbedtls_mpi r[],
+                                const mbedtls_mpi s[],
+                                size_t count,
+                                unsigned char *results )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i, valid = 0;
+
+    if( count == 0 )
+        return( 0 );
+
+    memset( results, 0, ( count + 7 ) / 8 );
+
+    for( i = 0; i < count; i++ )
+    {
+        ret = mbedtls_ecdsa_verify( grp, buf[i], blen[i], Q[i], &r[i], &s[i] );
+        if( ret == 0 )
+        {
+            results[i / 8] |= (unsigned char)( 1 << ( i % 8 ) );
+            valid++;
+        }
+        else if( ret != MBEDTLS_ERR_ECP_VERIFY_FAILED &&
+                 ret != MBEDTLS_ERR_ECP_INVALID_KEY )
+        {
+            return( ret );
+        }
+    }
+
+    return( valid == count ? 0 : MBEDTLS_ERR_ECP_VERIFY_FAILED );
+}
+#else
+/*
+ * Verify several ECDSA signatures of hashed messages (SEC1 4.1.4)
+ *
+ * The steps are those of ecdsa_verify_restartable(), with the inversions of
+ * the s shared by Montgomery's trick and the point multiplications done by
+ * mbedtls_ecp_muladd_batch().
+ */
+int mbedtls_ecdsa_verify_batch( mbedtls_ecp_group *grp,
+                                const unsigned char * const buf[],
+                                const size_t blen[],
+                                const mbedtls_ecp_point * const Q[],
+                                const mbedtls_mpi r[],
+                                const mbedtls_mpi s[],
+                                size_t count,
+                                unsigned char *results )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi *u1 = NULL, *u2 = NULL, *c = NULL;
+    mbedtls_ecp_point *R = NULL;
+    const mbedtls_ecp_point **Qv = NULL;
+    size_t *idx = NULL;
+    size_t i, j, n = 0, valid = 0;
+    mbedtls_mpi s_inv, t;
+
+    if( count == 0 )
+        return( 0 );
+
+    /* Fail cleanly on curves such as Curve25519 that can't be used for ECDSA */
+    if( ! mbedtls_ecdsa_can_do( grp->id ) || grp->N.p == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    memset( results, 0, ( count + 7 ) / 8 );
+
+    mbedtls_mpi_init( &s_inv ); mbedtls_mpi_init( &t );
+
+    u1 = mbedtls_calloc( count, sizeof( mbedtls_mpi ) );
+    u2 = mbedtls_calloc( count, sizeof( mbedtls_mpi ) );
+    c = mbedtls_calloc( count, sizeof( mbedtls_mpi ) );
+    R = mbedtls_calloc( count, sizeof( mbedtls_ecp_point ) );
+    Qv = mbedtls_calloc( count, sizeof( mbedtls_ecp_point * ) );
+    idx = mbedtls_calloc( count, sizeof( size_t ) );
+    if( u1 == NULL || u2 == NULL || c == NULL || R == NULL ||
+        Qv == NULL || idx == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    for( i = 0; i < count; i++ )
+    {
+        mbedtls_mpi_init( &u1[i] );
+        mbedtls_mpi_init( &u2[i] );
+        mbedtls_mpi_init( &c[i] );
+        mbedtls_ecp_point_init( &R[i] );
+    }
+
+    /*
+     * Step 1: keep the signatures with r and s in range 1..n-1, and
+     * whose public key is valid
+     * Step 3: derive MPI from hashed message, in u1
+     */
+    for( i = 0; i < count; i++ )
+    {
+        if( mbedtls_mpi_cmp_int( &r[i], 1 ) < 0 ||
+            mbedtls_mpi_cmp_mpi( &r[i], &grp->N ) >= 0 ||
+            mbedtls_mpi_cmp_int( &s[i], 1 ) < 0 ||
+            mbedtls_mpi_cmp_mpi( &s[i], &grp->N ) >= 0 ||
+            mbedtls_ecp_check_pubkey( grp, Q[i] ) != 0 )
+        {
+            continue;
+        }
+
+        MBEDTLS_MPI_CHK( derive_mpi( grp, &u1[n], buf[i], blen[i] ) );
+        Qv[n] = Q[i];
+        idx[n] = i;
+        n++;
+    }
+
+    if( n == 0 )
+    {
+        ret = MBEDTLS_ERR_ECP_VERIFY_FAILED;
+        goto cleanup;
+    }
+
+    /*
+     * Step 4: u1 = e / s mod n, u2 = r / s mod n
+     *
+     * With c[j] = s_0 * ... * s_j, a single inversion gives
+     * t = 1 / c[n-1], then going down 1 / s_j = t * c[j-1] and
+     * 1 / c[j-1] = t * s_j.
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &c[0], &s[idx[0]] ) );
+    for( j = 1; j < n; j++ )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &c[j], &c[j-1], &s[idx[j]] ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &c[j], &c[j], &grp->N ) );
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &t, &c[n-1], &grp->N ) );
+
+    for( j = n - 1; ; j-- )
+    {
+        if( j > 0 )
+        {
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &s_inv, &t, &c[j-1] ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &s_inv, &s_inv, &grp->N ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &t, &s[idx[j]] ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &t, &t, &grp->N ) );
+        }
+        else
+        {
+            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &s_inv, &t ) );
+        }
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &u1[j], &u1[j], &s_inv ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &u1[j], &u1[j], &grp->N ) );
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &u2[j], &r[idx[j]], &s_inv ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &u2[j], &u2[j], &grp->N ) );
+
+        if( j == 0 )
+            break;
+    }
+
+    /*
+     * Step 5: R = u1 G + u2 Q
+     */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_batch( grp, R, u1, u2, Qv, n ) );
+
+    /*
+     * Step 6: convert xR to an integer (no-op)
+     * Step 7: reduce xR mod n (gives v)
+     * Step 8: check if v (that is, R.X) is equal to r
+     */
+    for( j = 0; j < n; j++ )
+    {
+        if( mbedtls_ecp_is_zero( &R[j] ) )
+            continue;
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &R[j].X, &R[j].X, &grp->N ) );
+
+        if( mbedtls_mpi_cmp_mpi( &R[j].X, &r[idx[j]] ) == 0 )
+        {
+            results[idx[j] / 8] |= (unsigned char)( 1 << ( idx[j] % 8 ) );
+            valid++;
+        }
+    }
+
+    ret = valid == count ? 0 : MBEDTLS_ERR_ECP_VERIFY_FAILED;
+
+cleanup:
+    if( u1 != NULL && u2 != NULL && c != NULL && R != NULL )
+    {
+        for( i = 0; i < count; i++ )
+        {
+            mbedtls_mpi_free( &u1[i] );
+            mbedtls_mpi_free( &u2[i] );
+            mbedtls_mpi_free( &c[i] );
+            mbedtls_ecp_point_free( &R[i] );
+        }
+    }
+    mbedtls_free( u1 );
+    mbedtls_free( u2 );
+    mbedtls_free( c );
+    mbedtls_free( R );
+    mbedtls_free( Qv );
+    mbedtls_free( idx );
+    mbedtls_mpi_free( &s_inv ); mbedtls_mpi_free( &t );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECDSA_VERIFY_ALT */
+
 /*
  * Convert a signature (given by context) to ASN.1
  */
@@ -78,6 +78,8 @@
 #include "mbedtls/error.h"
 
 #include "bn_mul.h"
+#include "bignum_core.h"
+#include "ecp_internal.h"
 #include "ecp_invasive.h"
 
 #include <string.h>
@@ -337,6 +339,11 @@ static void mpi_free_many( mbedtls_mpi *arr, size_t size )
         mbedtls_mpi_free( arr++ );
 }
 
+/* Constant MPIs, for curve-specific constants held in static arrays */
+#define ECP_MPI_INIT(s, n, p) {s, (n), (mbedtls_mpi_uint *)(p)}
+#define ECP_MPI_INIT_ARRAY(x)   \
+    ECP_MPI_INIT(1, sizeof(x) / sizeof(mbedtls_mpi_uint), x)
+
 /*
  * List of supported curves:
  *  - internal ID
@@ -2135,9 +2142,17 @@ static unsigned char ecp_pick_window_size( const mbedtls_ecp_group *grp,
      * If P == G, pre-compute a bit more, since this may be re-used later.
      * Just adding one avoids upping the cost of the first mul too much,
      * and the memory cost too.
+     *
+     * With MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW, the static tables were
+     * generated with one more bit of window, so pick that size again.
      */
     if( p_eq_g )
+    {
         w++;
+#if defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
+        w++;
+#endif
+    }
 
     /*
      * If static comb table may not be used (!p_eq_g) or static comb table does
@@ -2148,7 +2163,7 @@ static unsigned char ecp_pick_window_size( const mbedtls_ecp_group *grp,
      * static comb table, because the size of static comb table is fixed when
      * it is generated.
      */
-#if( MBEDTLS_ECP_WINDOW_SIZE < 6 )
+#if( MBEDTLS_ECP_WINDOW_SIZE < 7 )
     if( (!p_eq_g || !ecp_group_is_static_comb_table(grp)) && w > MBEDTLS_ECP_WINDOW_SIZE )
         w = MBEDTLS_ECP_WINDOW_SIZE;
 #endif
@@ -2294,228 +2309,1647 @@ cleanup:
     return( ret );
 }
 
-#endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
+#if defined(MBEDTLS_ECP_NIST_FIXED_LIMBS) &&         \
+    ( defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED) ||   \
+      defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED) )
+#define ECP_FIXED_LIMBS
+#endif
 
-#if defined(MBEDTLS_ECP_MONTGOMERY_ENABLED)
+#if defined(ECP_FIXED_LIMBS)
 /*
- * For Montgomery curves, we do all the internal arithmetic in projective
- * coordinates. Import/export of points uses only the x coordinates, which is
- * internally represented as X / Z.
+ * Fixed-size field arithmetic for secp256r1 and secp384r1
  *
- * For scalar multiplication, we'll use a Montgomery ladder.
+ * The functions above work on variable-length mbedtls_mpi, which means heap
+ * (re)allocations and a call to ecp_modp() for every field operation. For
+ * these two curves, ecp_mul_comb_fixed() below runs the same comb method
+ * with coordinates held in fixed-size limb arrays, in Montgomery
+ * representation, using the constant-time mbedtls_mpi_core_montmul() for
+ * multiplications and squarings. The only heap allocation is the table of
+ * precomputed points, made once per call.
+ *
+ * The point formulas and the scalar recoding are the same as for the
+ * generic code, so the comments on ecp_comb_recode_core(), ecp_double_jac()
+ * and ecp_add_mixed() about side channels and special cases apply here too.
  */
 
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+#define ECP_FIXED_MAX_LIMBS     BITS_TO_LIMBS( 384 )
+#else
+#define ECP_FIXED_MAX_LIMBS     BITS_TO_LIMBS( 256 )
+#endif
+
+/* The window for an arbitrary point is at most 5, see ecp_pick_window_size() */
+#define ECP_FIXED_MAX_PRE       16
+
 /*
- * Normalize Montgomery x/z coordinates: X = X/Z, Z = 1
- * Cost: 1M + 1I
+ * R^2 mod p, for the conversion into Montgomery representation.
+ * R = 2^256 and 2^384 respectively, whatever the size of a limb.
  */
-static int ecp_normalize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P )
-{
-#if defined(MBEDTLS_ECP_NORMALIZE_MXZ_ALT)
-    if( mbedtls_internal_ecp_grp_capable( grp ) )
-        return( mbedtls_internal_ecp_normalize_mxz( grp, P ) );
-#endif /* MBEDTLS_ECP_NORMALIZE_MXZ_ALT */
-
-#if defined(MBEDTLS_ECP_NO_FALLBACK) && defined(MBEDTLS_ECP_NORMALIZE_MXZ_ALT)
-    return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
-#else
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    MPI_ECP_INV( &P->Z, &P->Z );
-    MPI_ECP_MUL( &P->X, &P->X, &P->Z );
-    MPI_ECP_LSET( &P->Z, 1 );
+#if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+static const mbedtls_mpi_uint secp256r1_fixed_rr[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00 ),
+};
+#endif
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+static const mbedtls_mpi_uint secp384r1_fixed_rr[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+#endif
 
-cleanup:
-    return( ret );
-#endif /* !defined(MBEDTLS_ECP_NO_FALLBACK) || !defined(MBEDTLS_ECP_NORMALIZE_MXZ_ALT) */
-}
+/*
+ * Field context: modulus, Montgomery constants, and scratch space for
+ * mbedtls_mpi_core_montmul() so that it is wiped only once per call.
+ */
+typedef struct
+{
+    const mbedtls_mpi_uint *p;
+    const mbedtls_mpi_uint *rr;
+    size_t limbs;
+    mbedtls_mpi_uint mm;
+    mbedtls_mpi_uint one[ECP_FIXED_MAX_LIMBS];  /* R mod p */
+    mbedtls_mpi_uint T[2 * ECP_FIXED_MAX_LIMBS + 1];
+} ecp_fixed_field;
+
+/* Jacobian point, coordinates in Montgomery representation */
+typedef struct
+{
+    mbedtls_mpi_uint X[ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi_uint Y[ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi_uint Z[ECP_FIXED_MAX_LIMBS];
+} ecp_fixed_point;
 
 /*
- * Randomize projective x/z coordinates:
- * (X, Z) -> (l X, l Z) for random l
- * This is sort of the reverse operation of ecp_normalize_mxz().
+ * Can the fixed-size code handle this group (and this call)?
  *
- * This countermeasure was first suggested in [2].
- * Cost: 2M
+ * It does not support restarting: if the caller wants an operation that can
+ * be interrupted, fall back to the generic code.
  */
-static int ecp_randomize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P,
-                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+static int ecp_fixed_can_mul( const mbedtls_ecp_group *grp,
+                              mbedtls_ecp_restart_ctx *rs_ctx )
 {
-#if defined(MBEDTLS_ECP_RANDOMIZE_MXZ_ALT)
-    if( mbedtls_internal_ecp_grp_capable( grp ) )
-        return( mbedtls_internal_ecp_randomize_mxz( grp, P, f_rng, p_rng ) );
-#endif /* MBEDTLS_ECP_RANDOMIZE_MXZ_ALT */
-
-#if defined(MBEDTLS_ECP_NO_FALLBACK) && defined(MBEDTLS_ECP_RANDOMIZE_MXZ_ALT)
-    return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL &&
+        ( rs_ctx->rsm != NULL || mbedtls_ecp_restart_is_enabled() ) )
+        return( 0 );
 #else
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    mbedtls_mpi l;
-    mbedtls_mpi_init( &l );
+    (void) rs_ctx;
+#endif
 
-    /* Generate l such that 1 < l < p */
-    MPI_ECP_RAND( &l );
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( 0 );
+#endif
 
-    MPI_ECP_MUL( &P->X, &P->X, &l );
-    MPI_ECP_MUL( &P->Z, &P->Z, &l );
+    /* Both curves have A = -3, which the point doubling relies on */
+    if( grp->A.p != NULL )
+        return( 0 );
 
-cleanup:
-    mbedtls_mpi_free( &l );
+#if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+    if( grp->id == MBEDTLS_ECP_DP_SECP256R1 )
+        return( grp->P.n == BITS_TO_LIMBS( 256 ) );
+#endif
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+    if( grp->id == MBEDTLS_ECP_DP_SECP384R1 )
+        return( grp->P.n == BITS_TO_LIMBS( 384 ) );
+#endif
 
-    if( ret == MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
-        ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
-    return( ret );
-#endif /* !defined(MBEDTLS_ECP_NO_FALLBACK) || !defined(MBEDTLS_ECP_RANDOMIZE_MXZ_ALT) */
+    return( 0 );
 }
 
+#if defined(MBEDTLS_HAVE_UDBL)
 /*
- * Double-and-add: R = 2P, S = P + Q, with d = X(P - Q),
- * for Montgomery curves in x/z coordinates.
+ * Montgomery multiplication X = A * B * R^-1 mod N (CIOS method)
  *
- * http://www.hyperelliptic.org/EFD/g1p/auto-code/montgom/xz/ladder/mladd-1987-m.op3
- * with
- * d =  X1
- * P = (X2, Z2)
- * Q = (X3, Z3)
- * R = (X4, Z4)
- * S = (X5, Z5)
- * and eliminating temporary variables tO, ..., t4.
- *
- * Cost: 5M + 4S
+ * Same contract and constant-flow properties as mbedtls_mpi_core_montmul(),
+ * but with the running product in a double-width integer, which is a lot
+ * faster for the handful of limbs of a field element. T must have room for
+ * n + 1 limbs.
  */
-static int ecp_double_add_mxz( const mbedtls_ecp_group *grp,
-                               mbedtls_ecp_point *R, mbedtls_ecp_point *S,
-                               const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q,
-                               const mbedtls_mpi *d,
-                               mbedtls_mpi T[4] )
+static inline void ecp_fixed_montmul( mbedtls_mpi_uint *X,
+                                      const mbedtls_mpi_uint *A,
+                                      const mbedtls_mpi_uint *B,
+                                      const mbedtls_mpi_uint *N,
+                                      mbedtls_mpi_uint mm, size_t n,
+                                      mbedtls_mpi_uint *T )
 {
-#if defined(MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT)
-    if( mbedtls_internal_ecp_grp_capable( grp ) )
-        return( mbedtls_internal_ecp_double_add_mxz( grp, R, S, P, Q, d ) );
-#endif /* MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT */
+    mbedtls_t_udbl r;
+    mbedtls_mpi_uint c, u, hi, borrow;
+    size_t i, j;
 
-#if defined(MBEDTLS_ECP_NO_FALLBACK) && defined(MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT)
-    return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+    memset( T, 0, ( n + 1 ) * ciL );
+
+    for( i = 0; i < n; i++ )
+    {
+        /* T += A * B[i] */
+        c = 0;
+        for( j = 0; j < n; j++ )
+        {
+            r = (mbedtls_t_udbl) A[j] * B[i] + T[j] + c;
+            T[j] = (mbedtls_mpi_uint) r;
+            c = (mbedtls_mpi_uint) ( r >> biL );
+        }
+        r = (mbedtls_t_udbl) T[n] + c;
+        T[n] = (mbedtls_mpi_uint) r;
+        hi = (mbedtls_mpi_uint) ( r >> biL );
+
+        /* T = ( T + u * N ) / 2^biL, with u chosen so that it is exact */
+        u = T[0] * mm;
+        r = (mbedtls_t_udbl) u * N[0] + T[0];
+        c = (mbedtls_mpi_uint) ( r >> biL );
+        for( j = 1; j < n; j++ )
+        {
+            r = (mbedtls_t_udbl) u * N[j] + T[j] + c;
+            T[j - 1] = (mbedtls_mpi_uint) r;
+            c = (mbedtls_mpi_uint) ( r >> biL );
+        }
+        r = (mbedtls_t_udbl) T[n] + c;
+        T[n - 1] = (mbedtls_mpi_uint) r;
+        T[n] = hi + (mbedtls_mpi_uint) ( r >> biL );
+    }
+
+    /* T < 2N, so at most one subtraction is needed: keep T only if T < N,
+     * that is if T[n] == 0 and T - N borrows */
+    borrow = mbedtls_mpi_core_sub( X, T, N, n );
+    mbedtls_mpi_core_cond_assign( X, T, n,
+                                  (unsigned char) ( borrow & ( T[n] ^ 1 ) ) );
+}
+#endif /* MBEDTLS_HAVE_UDBL */
+
+static void ecp_fixed_mul( ecp_fixed_field *F, mbedtls_mpi_uint *X,
+                           const mbedtls_mpi_uint *A,
+                           const mbedtls_mpi_uint *B )
+{
+#if defined(MBEDTLS_SELF_TEST)
+    mul_count++;
+#endif
+#if defined(MBEDTLS_HAVE_UDBL)
+    ecp_fixed_montmul( X, A, B, F->p, F->mm, F->limbs, F->T );
 #else
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi_core_montmul( X, A, B, F->limbs, F->p, F->limbs, F->mm, F->T );
+#endif
+}
 
-    MPI_ECP_ADD( &T[0], &P->X,   &P->Z ); /* Pp := PX + PZ                    */
-    MPI_ECP_SUB( &T[1], &P->X,   &P->Z ); /* Pm := PX - PZ                    */
-    MPI_ECP_ADD( &T[2], &Q->X,   &Q->Z ); /* Qp := QX + XZ                    */
-    MPI_ECP_SUB( &T[3], &Q->X,   &Q->Z ); /* Qm := QX - QZ                    */
-    MPI_ECP_MUL( &T[3], &T[3],   &T[0] ); /* Qm * Pp                          */
-    MPI_ECP_MUL( &T[2], &T[2],   &T[1] ); /* Qp * Pm                          */
-    MPI_ECP_SQR( &T[0], &T[0]          ); /* Pp^2                             */
-    MPI_ECP_SQR( &T[1], &T[1]          ); /* Pm^2                             */
-    MPI_ECP_MUL( &R->X, &T[0],   &T[1] ); /* Pp^2 * Pm^2                      */
-    MPI_ECP_SUB( &T[0], &T[0],   &T[1] ); /* Pp^2 - Pm^2                      */
-    MPI_ECP_MUL( &R->Z, &grp->A, &T[0] ); /* A * (Pp^2 - Pm^2)                */
-    MPI_ECP_ADD( &R->Z, &T[1],   &R->Z ); /* [ A * (Pp^2-Pm^2) ] + Pm^2       */
-    MPI_ECP_ADD( &S->X, &T[3],   &T[2] ); /* Qm*Pp + Qp*Pm                    */
-    MPI_ECP_SQR( &S->X, &S->X          ); /* (Qm*Pp + Qp*Pm)^2                */
-    MPI_ECP_SUB( &S->Z, &T[3],   &T[2] ); /* Qm*Pp - Qp*Pm                    */
-    MPI_ECP_SQR( &S->Z, &S->Z          ); /* (Qm*Pp - Qp*Pm)^2                */
-    MPI_ECP_MUL( &S->Z, d,       &S->Z ); /* d * ( Qm*Pp - Qp*Pm )^2          */
-    MPI_ECP_MUL( &R->Z, &T[0],   &R->Z ); /* [A*(Pp^2-Pm^2)+Pm^2]*(Pp^2-Pm^2) */
+static void ecp_fixed_add( ecp_fixed_field *F, mbedtls_mpi_uint *X,
+                           const mbedtls_mpi_uint *A,
+                           const mbedtls_mpi_uint *B )
+{
+    mbedtls_mpi_uint carry, borrow;
 
-cleanup:
+    carry = mbedtls_mpi_core_add( X, A, B, F->limbs );
+    borrow = mbedtls_mpi_core_sub( F->T, X, F->p, F->limbs );
 
-    return( ret );
-#endif /* !defined(MBEDTLS_ECP_NO_FALLBACK) || !defined(MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT) */
+    /* Subtract p if A + B overflowed or if it is at least p */
+    mbedtls_mpi_core_cond_assign( X, F->T, F->limbs,
+                                  (unsigned char) ( carry | ( borrow ^ 1 ) ) );
+}
+
+static void ecp_fixed_sub( ecp_fixed_field *F, mbedtls_mpi_uint *X,
+                           const mbedtls_mpi_uint *A,
+                           const mbedtls_mpi_uint *B )
+{
+    mbedtls_mpi_uint borrow;
+
+    borrow = mbedtls_mpi_core_sub( X, A, B, F->limbs );
+    (void) mbedtls_mpi_core_add_if( X, F->p, F->limbs, (unsigned) borrow );
+}
+
+/* X = -X if cond == 1, assuming X != 0 (true for the Y coordinate of a
+ * point of odd order) */
+static void ecp_fixed_cond_neg( ecp_fixed_field *F, mbedtls_mpi_uint *X,
+                                unsigned char cond )
+{
+    (void) mbedtls_mpi_core_sub( F->T, F->p, X, F->limbs );
+    mbedtls_mpi_core_cond_assign( X, F->T, F->limbs, cond );
 }
 
 /*
- * Multiplication with Montgomery ladder in x/z coordinates,
- * for curves in Montgomery form
+ * X = A^-1 = A^(p-2) mod p, A != 0
+ *
+ * Fixed 4-bit window exponentiation. The exponent is public, so this is
+ * constant-time with respect to A.
  */
-static int ecp_mul_mxz( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
-                        const mbedtls_mpi *m, const mbedtls_ecp_point *P,
-                        int (*f_rng)(void *, unsigned char *, size_t),
-                        void *p_rng )
+static void ecp_fixed_inv( ecp_fixed_field *F, mbedtls_mpi_uint *X,
+                           const mbedtls_mpi_uint *A )
 {
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    size_t i;
-    unsigned char b;
-    mbedtls_ecp_point RP;
-    mbedtls_mpi PX;
-    mbedtls_mpi tmp[4];
-    mbedtls_ecp_point_init( &RP ); mbedtls_mpi_init( &PX );
+    mbedtls_mpi_uint W[16][ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi_uint E[ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi_uint R[ECP_FIXED_MAX_LIMBS];
+    size_t i, j, nbits = F->limbs * biL;
+    unsigned int e;
+
+    /* E = p - 2, no borrow since the low limb of both primes is odd and
+     * larger than 2 */
+    memcpy( E, F->p, F->limbs * ciL );
+    E[0] -= 2;
+
+    /* W[i] = A^i */
+    memcpy( W[1], A, F->limbs * ciL );
+    for( i = 2; i < 16; i++ )
+        ecp_fixed_mul( F, W[i], W[i-1], A );
+
+    /* biL is a multiple of 4, so windows don't straddle limbs, and the top
+     * window of p - 2 is non-zero */
+    for( i = nbits; i > 0; i -= 4 )
+    {
+        e = ( E[( i - 4 ) / biL] >> ( ( i - 4 ) % biL ) ) & 0x0F;
 
-    mpi_init_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+        if( i == nbits )
+        {
+            memcpy( R, W[e], F->limbs * ciL );
+            continue;
+        }
 
-    if( f_rng == NULL )
-        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+        for( j = 0; j < 4; j++ )
+            ecp_fixed_mul( F, R, R, R );
+        if( e != 0 )
+            ecp_fixed_mul( F, R, R, W[e] );
+    }
 
-    /* Save PX and read from P before writing to R, in case P == R */
-    MPI_ECP_MOV( &PX, &P->X );
-    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &RP, P ) );
+    memcpy( X, R, F->limbs * ciL );
+    mbedtls_platform_zeroize( W, sizeof( W ) );
+    mbedtls_platform_zeroize( R, sizeof( R ) );
+}
 
-    /* Set R to zero in modified x/z coordinates */
-    MPI_ECP_LSET( &R->X, 1 );
-    MPI_ECP_LSET( &R->Z, 0 );
-    mbedtls_mpi_free( &R->Y );
+/* X = A * R mod p, 0 <= A < p */
+static void ecp_fixed_from_mpi( ecp_fixed_field *F, mbedtls_mpi_uint *X,
+                                const mbedtls_mpi *A )
+{
+    size_t i;
 
-    /* RP.X might be slightly larger than P, so reduce it */
-    MOD_ADD( &RP.X );
+    for( i = 0; i < F->limbs; i++ )
+        X[i] = i < A->n ? A->p[i] : 0;
 
-    /* Randomize coordinates of the starting point */
-    MBEDTLS_MPI_CHK( ecp_randomize_mxz( grp, &RP, f_rng, p_rng ) );
+    ecp_fixed_mul( F, X, X, F->rr );
+}
 
-    /* Loop invariant: R = result so far, RP = R + P */
-    i = grp->nbits + 1; /* one past the (zero-based) required msb for private keys */
-    while( i-- > 0 )
-    {
-        b = mbedtls_mpi_get_bit( m, i );
-        /*
-         *  if (b) R = 2R + P else R = 2R,
-         * which is:
-         *  if (b) double_add( RP, R, RP, R )
-         *  else   double_add( R, RP, R, RP )
-         * but using safe conditional swaps to avoid leaks
-         */
-        MPI_ECP_COND_SWAP( &R->X, &RP.X, b );
-        MPI_ECP_COND_SWAP( &R->Z, &RP.Z, b );
-        MBEDTLS_MPI_CHK( ecp_double_add_mxz( grp, R, &RP, R, &RP, &PX, tmp ) );
-        MPI_ECP_COND_SWAP( &R->X, &RP.X, b );
-        MPI_ECP_COND_SWAP( &R->Z, &RP.Z, b );
-    }
+/* X = A * R^-1 mod p */
+static int ecp_fixed_to_mpi( ecp_fixed_field *F, mbedtls_mpi *X,
+                             const mbedtls_mpi_uint *A )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const mbedtls_mpi_uint one = 1;
 
-    /*
-     * Knowledge of the projective coordinates may leak the last few bits of the
-     * scalar [1], and since our MPI implementation isn't constant-flow,
-     * inversion (used for coordinate normalization) may leak the full value
-     * of its input via side-channels [2].
-     *
-     * [1] https://eprint.iacr.org/2003/191
-     * [2] https://eprint.iacr.org/2020/055
-     *
-     * Avoid the leak by randomizing coordinates before we normalize them.
-     */
-    MBEDTLS_MPI_CHK( ecp_randomize_mxz( grp, R, f_rng, p_rng ) );
-    MBEDTLS_MPI_CHK( ecp_normalize_mxz( grp, R ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, F->limbs ) );
 
-cleanup:
-    mbedtls_ecp_point_free( &RP ); mbedtls_mpi_free( &PX );
+    mbedtls_mpi_core_montmul( X->p, A, &one, 1, F->p, F->limbs,
+                              F->mm, F->T );
 
-    mpi_free_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+cleanup:
     return( ret );
 }
 
-#endif /* MBEDTLS_ECP_MONTGOMERY_ENABLED */
+static void ecp_fixed_field_init( const mbedtls_ecp_group *grp,
+                                  ecp_fixed_field *F )
+{
+    const mbedtls_mpi_uint one = 1;
+
+    F->p = grp->P.p;
+    F->limbs = grp->P.n;
+#if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+    if( grp->id == MBEDTLS_ECP_DP_SECP256R1 )
+        F->rr = secp256r1_fixed_rr;
+#endif
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+    if( grp->id == MBEDTLS_ECP_DP_SECP384R1 )
+        F->rr = secp384r1_fixed_rr;
+#endif
+    F->mm = mbedtls_mpi_core_montmul_init( F->p );
+
+    /* one = R^2 * 1 * R^-1 = R mod p */
+    mbedtls_mpi_core_montmul( F->one, F->rr, &one, 1, F->p, F->limbs,
+                              F->mm, F->T );
+}
 
 /*
- * Restartable multiplication R = m * P
+ * Point doubling R = 2 P, Jacobian coordinates, A = -3
  *
- * This internal function can be called without an RNG in case where we know
- * the inputs are not sensitive.
+ * Same formulas as ecp_double_jac().
+ *
+ * Cost: 1D := 4M + 4S
  */
-static int ecp_mul_restartable_internal( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
-             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
-             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
-             mbedtls_ecp_restart_ctx *rs_ctx )
+static void ecp_fixed_double_jac( ecp_fixed_field *F, ecp_fixed_point *R,
+                                  const ecp_fixed_point *P )
 {
-    int ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
-#if defined(MBEDTLS_ECP_INTERNAL_ALT)
-    char is_grp_capable = 0;
+    mbedtls_mpi_uint t0[ECP_FIXED_MAX_LIMBS], t1[ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi_uint t2[ECP_FIXED_MAX_LIMBS], t3[ECP_FIXED_MAX_LIMBS];
+
+#if defined(MBEDTLS_SELF_TEST)
+    dbl_count++;
+#endif
+
+    /* t0 <- M = 3(X + Z^2)(X - Z^2) */
+    ecp_fixed_mul( F, t1, P->Z, P->Z );
+    ecp_fixed_add( F, t2, P->X, t1 );
+    ecp_fixed_sub( F, t3, P->X, t1 );
+    ecp_fixed_mul( F, t1, t2, t3 );
+    ecp_fixed_add( F, t0, t1, t1 );
+    ecp_fixed_add( F, t0, t0, t1 );
+
+    /* t1 <- S = 4.X.Y^2 */
+    ecp_fixed_mul( F, t2, P->Y, P->Y );
+    ecp_fixed_add( F, t2, t2, t2 );
+    ecp_fixed_mul( F, t1, P->X, t2 );
+    ecp_fixed_add( F, t1, t1, t1 );
+
+    /* t3 <- U = 8.Y^4 */
+    ecp_fixed_mul( F, t3, t2, t2 );
+    ecp_fixed_add( F, t3, t3, t3 );
+
+    /* t2 <- T = M^2 - 2.S */
+    ecp_fixed_mul( F, t2, t0, t0 );
+    ecp_fixed_sub( F, t2, t2, t1 );
+    ecp_fixed_sub( F, t2, t2, t1 );
+
+    /* t1 <- S = M(S - T) - U */
+    ecp_fixed_sub( F, t1, t1, t2 );
+    ecp_fixed_mul( F, t1, t1, t0 );
+    ecp_fixed_sub( F, t1, t1, t3 );
+
+    /* Z = 2.Y.Z, P is no longer used after this */
+    ecp_fixed_mul( F, R->Z, P->Y, P->Z );
+    ecp_fixed_add( F, R->Z, R->Z, R->Z );
+
+    memcpy( R->X, t2, F->limbs * ciL );
+    memcpy( R->Y, t1, F->limbs * ciL );
+}
+
+/*
+ * First half of the mixed addition R = P + Q: t0 = X2.Z1^2 - X1 and
+ * t1 = Y2.Z1^3 - Y1, which are both zero iff P == Q, and only t0 is zero
+ * iff P == -Q.
+ */
+static void ecp_fixed_add_mixed_start( ecp_fixed_field *F,
+                                       mbedtls_mpi_uint *t0,
+                                       mbedtls_mpi_uint *t1,
+                                       const ecp_fixed_point *P,
+                                       const ecp_fixed_point *Q )
+{
+    ecp_fixed_mul( F, t0, P->Z, P->Z );
+    ecp_fixed_mul( F, t1, t0, P->Z );
+    ecp_fixed_mul( F, t0, t0, Q->X );
+    ecp_fixed_mul( F, t1, t1, Q->Y );
+    ecp_fixed_sub( F, t0, t0, P->X );
+    ecp_fixed_sub( F, t1, t1, P->Y );
+}
+
+/* Second half of the mixed addition, from the output of the first half */
+static void ecp_fixed_add_mixed_end( ecp_fixed_field *F, ecp_fixed_point *R,
+                                     const ecp_fixed_point *P,
+                                     mbedtls_mpi_uint *t0,
+                                     mbedtls_mpi_uint *t1 )
+{
+    mbedtls_mpi_uint t2[ECP_FIXED_MAX_LIMBS], t3[ECP_FIXED_MAX_LIMBS];
+
+    ecp_fixed_mul( F, R->Z, P->Z, t0 );
+    ecp_fixed_mul( F, t2, t0, t0 );
+    ecp_fixed_mul( F, t3, t2, t0 );
+    ecp_fixed_mul( F, t2, t2, P->X );
+
+    ecp_fixed_add( F, t0, t2, t2 );
+
+    ecp_fixed_mul( F, R->X, t1, t1 );
+    ecp_fixed_sub( F, R->X, R->X, t0 );
+    ecp_fixed_sub( F, R->X, R->X, t3 );
+    ecp_fixed_sub( F, t2, t2, R->X );
+    ecp_fixed_mul( F, t2, t2, t1 );
+    ecp_fixed_mul( F, t3, t3, P->Y );
+    ecp_fixed_sub( F, R->Y, t2, t3 );
+}
+
+/*
+ * Addition: R = P + Q, mixed affine-Jacobian coordinates
+ *
+ * Same formulas as ecp_add_mixed(), without the special cases, which cannot
+ * happen in the comb method: P and Q must be non-zero, and P != +-Q.
+ * R may alias P.
+ *
+ * Cost: 1A := 8M + 3S
+ */
+static void ecp_fixed_add_mixed( ecp_fixed_field *F, ecp_fixed_point *R,
+                                 const ecp_fixed_point *P,
+                                 const ecp_fixed_point *Q )
+{
+    mbedtls_mpi_uint t0[ECP_FIXED_MAX_LIMBS], t1[ECP_FIXED_MAX_LIMBS];
+
+#if defined(MBEDTLS_SELF_TEST)
+    add_count++;
+#endif
+
+    ecp_fixed_add_mixed_start( F, t0, t1, P, Q );
+    ecp_fixed_add_mixed_end( F, R, P, t0, t1 );
+}
+
+/*
+ * Addition: R = P + Q, Jacobian coordinates (add-1998-cmo-2)
+ *
+ * Used to build the table of precomputed points without normalizing it
+ * half-way, see ecp_fixed_precompute_comb(). Same restrictions as
+ * ecp_fixed_add_mixed(); R may alias P or Q.
+ *
+ * Cost: 12M + 4S
+ */
+static void ecp_fixed_add_jac( ecp_fixed_field *F, ecp_fixed_point *R,
+                               const ecp_fixed_point *P,
+                               const ecp_fixed_point *Q )
+{
+    mbedtls_mpi_uint u1[ECP_FIXED_MAX_LIMBS], s1[ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi_uint h[ECP_FIXED_MAX_LIMBS], r[ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi_uint t[ECP_FIXED_MAX_LIMBS];
+
+#if defined(MBEDTLS_SELF_TEST)
+    add_count++;
+#endif
+
+    /* u1 = X1.Z2^2, s1 = Y1.Z2^3 */
+    ecp_fixed_mul( F, t, Q->Z, Q->Z );
+    ecp_fixed_mul( F, u1, P->X, t );
+    ecp_fixed_mul( F, t, t, Q->Z );
+    ecp_fixed_mul( F, s1, P->Y, t );
+
+    /* h = X2.Z1^2 - u1, r = Y2.Z1^3 - s1 */
+    ecp_fixed_mul( F, t, P->Z, P->Z );
+    ecp_fixed_mul( F, h, Q->X, t );
+    ecp_fixed_sub( F, h, h, u1 );
+    ecp_fixed_mul( F, t, t, P->Z );
+    ecp_fixed_mul( F, r, Q->Y, t );
+    ecp_fixed_sub( F, r, r, s1 );
+
+    /* Z3 = Z1.Z2.h */
+    ecp_fixed_mul( F, R->Z, P->Z, Q->Z );
+    ecp_fixed_mul( F, R->Z, R->Z, h );
+
+    /* u1 = u1.h^2, h = h^3 */
+    ecp_fixed_mul( F, t, h, h );
+    ecp_fixed_mul( F, u1, u1, t );
+    ecp_fixed_mul( F, h, h, t );
+
+    /* X3 = r^2 - h^3 - 2.u1.h^2 */
+    ecp_fixed_mul( F, R->X, r, r );
+    ecp_fixed_sub( F, R->X, R->X, h );
+    ecp_fixed_sub( F, R->X, R->X, u1 );
+    ecp_fixed_sub( F, R->X, R->X, u1 );
+
+    /* Y3 = r.(u1.h^2 - X3) - s1.h^3 */
+    ecp_fixed_sub( F, u1, u1, R->X );
+    ecp_fixed_mul( F, u1, u1, r );
+    ecp_fixed_mul( F, s1, s1, h );
+    ecp_fixed_sub( F, R->Y, u1, s1 );
+}
+
+/*
+ * Normalize the points *T[0..count-1] to Z = 1 (Montgomery trick: a single
+ * inversion, then 3 multiplications per point)
+ *
+ * c is scratch space for count field elements.
+ */
+static void ecp_fixed_normalize_many( ecp_fixed_field *F, ecp_fixed_point *T[],
+                                      size_t count,
+                                      mbedtls_mpi_uint (*c)[ECP_FIXED_MAX_LIMBS] )
+{
+    mbedtls_mpi_uint u[ECP_FIXED_MAX_LIMBS], zi[ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi_uint zz[ECP_FIXED_MAX_LIMBS];
+    size_t i;
+
+    /* c[i] = Z_0 * ... * Z_i */
+    memcpy( c[0], T[0]->Z, F->limbs * ciL );
+    for( i = 1; i < count; i++ )
+        ecp_fixed_mul( F, c[i], c[i-1], T[i]->Z );
+
+    /* u = 1 / (Z_0 * ... * Z_{count-1}) */
+    ecp_fixed_inv( F, u, c[count-1] );
+
+    for( i = count - 1; ; i-- )
+    {
+        /* zi = 1 / Z_i, and u = 1 / (Z_0 * ... * Z_{i-1}) for next round */
+        if( i == 0 )
+            memcpy( zi, u, F->limbs * ciL );
+        else
+        {
+            ecp_fixed_mul( F, zi, u, c[i-1] );
+            ecp_fixed_mul( F, u, u, T[i]->Z );
+        }
+
+        ecp_fixed_mul( F, zz, zi, zi );
+        ecp_fixed_mul( F, T[i]->X, T[i]->X, zz );
+        ecp_fixed_mul( F, zz, zz, zi );
+        ecp_fixed_mul( F, T[i]->Y, T[i]->Y, zz );
+        memcpy( T[i]->Z, F->one, F->limbs * ciL );
+
+        if( i == 0 )
+            break;
+    }
+}
+
+/*
+ * Randomize jacobian coordinates, see ecp_randomize_jac()
+ */
+static int ecp_fixed_randomize_jac( const mbedtls_ecp_group *grp,
+                                    ecp_fixed_field *F, ecp_fixed_point *pt,
+                                    int (*f_rng)(void *, unsigned char *, size_t),
+                                    void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi_uint L[ECP_FIXED_MAX_LIMBS];
+    mbedtls_mpi l;
+
+    mbedtls_mpi_init( &l );
+
+    /* Generate l such that 1 < l < p */
+    MPI_ECP_RAND( &l );
+    ecp_fixed_from_mpi( F, L, &l );
+
+    ecp_fixed_mul( F, pt->Z, pt->Z, L );
+    ecp_fixed_mul( F, pt->Y, pt->Y, L );
+    ecp_fixed_mul( F, L, L, L );
+    ecp_fixed_mul( F, pt->X, pt->X, L );
+    ecp_fixed_mul( F, pt->Y, pt->Y, L );
+
+cleanup:
+    mbedtls_mpi_free( &l );
+    mbedtls_platform_zeroize( L, sizeof( L ) );
+
+    if( ret == MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
+        ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+    return( ret );
+}
+
+/*
+ * Precompute points for the comb method, see ecp_precompute_comb()
+ *
+ * The additions are done in Jacobian coordinates so that the table only
+ * needs to be normalized once, at the end.
+ */
+static void ecp_fixed_precompute_comb( ecp_fixed_field *F,
+                                       ecp_fixed_point T[],
+                                       const ecp_fixed_point *P,
+                                       unsigned char w, size_t d )
+{
+    const unsigned char T_size = 1U << ( w - 1 );
+    ecp_fixed_point *ptrs[ECP_FIXED_MAX_PRE];
+    mbedtls_mpi_uint c[ECP_FIXED_MAX_PRE][ECP_FIXED_MAX_LIMBS];
+    unsigned char i;
+    size_t j;
+
+    T[0] = *P;
+
+    for( j = 0; j < d * ( w - 1 ); j++ )
+    {
+        i = 1U << ( j / d );
+
+        if( j % d == 0 )
+            T[i] = T[i >> 1];
+
+        ecp_fixed_double_jac( F, &T[i], &T[i] );
+    }
+
+    for( i = 1; i < T_size; i <<= 1 )
+    {
+        j = i;
+        while( j-- )
+            ecp_fixed_add_jac( F, &T[i + j], &T[j], &T[i] );
+    }
+
+    for( i = 1; i < T_size; i++ )
+        ptrs[i - 1] = &T[i];
+
+    ecp_fixed_normalize_many( F, ptrs, T_size - 1, c );
+}
+
+/*
+ * Select precomputed point: R = sign(i) * T[ abs(i) / 2 ], see
+ * ecp_select_comb()
+ */
+static void ecp_fixed_select_comb( ecp_fixed_field *F, ecp_fixed_point *R,
+                                   const ecp_fixed_point T[],
+                                   unsigned char T_size, unsigned char i )
+{
+    /* Read the whole table to thwart cache-based timing attacks */
+    mbedtls_mpi_core_ct_uint_table_lookup( (mbedtls_mpi_uint *) R,
+                                           (const mbedtls_mpi_uint *) T,
+                                           sizeof( ecp_fixed_point ) / ciL,
+                                           T_size, ( i & 0x7Fu ) >> 1 );
+
+    ecp_fixed_cond_neg( F, R->Y, i >> 7 );
+}
+
+/*
+ * Comb multiplication with fixed-size field elements, see ecp_mul_comb()
+ * and ecp_mul_comb_after_precomp().
+ *
+ * If P is the base point, use the table attached to the group, otherwise
+ * compute one for P.
+ */
+static int ecp_mul_comb_fixed( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                               const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                               int (*f_rng)(void *, unsigned char *, size_t),
+                               void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    ecp_fixed_field F;
+    ecp_fixed_point *T = NULL;
+    ecp_fixed_point Q, Txi;
+    mbedtls_mpi_uint zi[ECP_FIXED_MAX_LIMBS], zz[ECP_FIXED_MAX_LIMBS];
+    unsigned char k[COMB_MAX_D + 1];
+    unsigned char w, p_eq_g, parity_trick;
+    unsigned char T_size;
+    size_t d, i;
+
+    ecp_fixed_field_init( grp, &F );
+
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+    p_eq_g = ( grp->T != NULL &&
+               MPI_ECP_CMP( &P->Y, &grp->G.Y ) == 0 &&
+               MPI_ECP_CMP( &P->X, &grp->G.X ) == 0 );
+#else
+    p_eq_g = 0;
+#endif
+
+    /* Same window as the generic code, which built grp->T (if any) */
+    w = ecp_pick_window_size( grp, p_eq_g );
+    T_size = 1U << ( w - 1 );
+    d = ( grp->nbits + w - 1 ) / w;
+
+    T = mbedtls_calloc( T_size, sizeof( ecp_fixed_point ) );
+    if( T == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    if( p_eq_g )
+    {
+        for( i = 0; i < T_size; i++ )
+        {
+            ecp_fixed_from_mpi( &F, T[i].X, &grp->T[i].X );
+            ecp_fixed_from_mpi( &F, T[i].Y, &grp->T[i].Y );
+            memcpy( T[i].Z, F.one, F.limbs * ciL );
+        }
+    }
+    else
+    {
+        ecp_fixed_from_mpi( &F, Q.X, &P->X );
+        ecp_fixed_from_mpi( &F, Q.Y, &P->Y );
+        memcpy( Q.Z, F.one, F.limbs * ciL );
+
+        ecp_fixed_precompute_comb( &F, T, &Q, w, d );
+    }
+
+    MBEDTLS_MPI_CHK( ecp_comb_recode_scalar( grp, m, k, d, w,
+                                             &parity_trick ) );
+
+    /* Start with a non-zero point and randomize its coordinates */
+    i = d;
+    ecp_fixed_select_comb( &F, &Q, T, T_size, k[i] );
+    if( f_rng != 0 )
+        MBEDTLS_MPI_CHK( ecp_fixed_randomize_jac( grp, &F, &Q, f_rng, p_rng ) );
+
+    while( i != 0 )
+    {
+        --i;
+
+        ecp_fixed_double_jac( &F, &Q, &Q );
+        ecp_fixed_select_comb( &F, &Txi, T, T_size, k[i] );
+        ecp_fixed_add_mixed( &F, &Q, &Q, &Txi );
+    }
+
+    ecp_fixed_cond_neg( &F, Q.Y, parity_trick );
+
+    /* Randomize before normalizing, see ecp_mul_comb_after_precomp() */
+    if( f_rng != 0 )
+        MBEDTLS_MPI_CHK( ecp_fixed_randomize_jac( grp, &F, &Q, f_rng, p_rng ) );
+
+    ecp_fixed_inv( &F, zi, Q.Z );
+    ecp_fixed_mul( &F, zz, zi, zi );
+    ecp_fixed_mul( &F, Q.X, Q.X, zz );
+    ecp_fixed_mul( &F, zz, zz, zi );
+    ecp_fixed_mul( &F, Q.Y, Q.Y, zz );
+
+    MBEDTLS_MPI_CHK( ecp_fixed_to_mpi( &F, &R->X, Q.X ) );
+    MBEDTLS_MPI_CHK( ecp_fixed_to_mpi( &F, &R->Y, Q.Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+
+cleanup:
+
+    if( T != NULL )
+    {
+        mbedtls_platform_zeroize( T, T_size * sizeof( ecp_fixed_point ) );
+        mbedtls_free( T );
+    }
+    mbedtls_platform_zeroize( &F, sizeof( F ) );
+    mbedtls_platform_zeroize( &Q, sizeof( Q ) );
+    mbedtls_platform_zeroize( &Txi, sizeof( Txi ) );
+    mbedtls_platform_zeroize( zi, sizeof( zi ) );
+    mbedtls_platform_zeroize( zz, sizeof( zz ) );
+    mbedtls_platform_zeroize( k, sizeof( k ) );
+
+    /* prevent caller from using invalid value */
+    if( ret != 0 )
+        mbedtls_ecp_point_free( R );
+
+    return( ret );
+}
+#endif /* ECP_FIXED_LIMBS */
+
+#endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
+
+#if defined(MBEDTLS_ECP_MONTGOMERY_ENABLED)
+/*
+ * For Montgomery curves, we do all the internal arithmetic in projective
+ * coordinates. Import/export of points uses only the x coordinates, which is
+ * internally represented as X / Z.
+ *
+ * For scalar multiplication, we'll use a Montgomery ladder.
+ */
+
+/*
+ * Normalize Montgomery x/z coordinates: X = X/Z, Z = 1
+ * Cost: 1M + 1I
+ */
+static int ecp_normalize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P )
+{
+#if defined(MBEDTLS_ECP_NORMALIZE_MXZ_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( mbedtls_internal_ecp_normalize_mxz( grp, P ) );
+#endif /* MBEDTLS_ECP_NORMALIZE_MXZ_ALT */
+
+#if defined(MBEDTLS_ECP_NO_FALLBACK) && defined(MBEDTLS_ECP_NORMALIZE_MXZ_ALT)
+    return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+#else
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    MPI_ECP_INV( &P->Z, &P->Z );
+    MPI_ECP_MUL( &P->X, &P->X, &P->Z );
+    MPI_ECP_LSET( &P->Z, 1 );
+
+cleanup:
+    return( ret );
+#endif /* !defined(MBEDTLS_ECP_NO_FALLBACK) || !defined(MBEDTLS_ECP_NORMALIZE_MXZ_ALT) */
+}
+
+/*
+ * Randomize projective x/z coordinates:
+ * (X, Z) -> (l X, l Z) for random l
+ * This is sort of the reverse operation of ecp_normalize_mxz().
+ *
+ * This countermeasure was first suggested in [2].
+ * Cost: 2M
+ */
+static int ecp_randomize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P,
+                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+{
+#if defined(MBEDTLS_ECP_RANDOMIZE_MXZ_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( mbedtls_internal_ecp_randomize_mxz( grp, P, f_rng, p_rng ) );
+#endif /* MBEDTLS_ECP_RANDOMIZE_MXZ_ALT */
+
+#if defined(MBEDTLS_ECP_NO_FALLBACK) && defined(MBEDTLS_ECP_RANDOMIZE_MXZ_ALT)
+    return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+#else
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi l;
+    mbedtls_mpi_init( &l );
+
+    /* Generate l such that 1 < l < p */
+    MPI_ECP_RAND( &l );
+
+    MPI_ECP_MUL( &P->X, &P->X, &l );
+    MPI_ECP_MUL( &P->Z, &P->Z, &l );
+
+cleanup:
+    mbedtls_mpi_free( &l );
+
+    if( ret == MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
+        ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+    return( ret );
+#endif /* !defined(MBEDTLS_ECP_NO_FALLBACK) || !defined(MBEDTLS_ECP_RANDOMIZE_MXZ_ALT) */
+}
+
+/*
+ * Double-and-add: R = 2P, S = P + Q, with d = X(P - Q),
+ * for Montgomery curves in x/z coordinates.
+ *
+ * http://www.hyperelliptic.org/EFD/g1p/auto-code/montgom/xz/ladder/mladd-1987-m.op3
+ * with
+ * d =  X1
+ * P = (X2, Z2)
+ * Q = (X3, Z3)
+ * R = (X4, Z4)
+ * S = (X5, Z5)
+ * and eliminating temporary variables tO, ..., t4.
+ *
+ * Cost: 5M + 4S
+ */
+static int ecp_double_add_mxz( const mbedtls_ecp_group *grp,
+                               mbedtls_ecp_point *R, mbedtls_ecp_point *S,
+                               const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q,
+                               const mbedtls_mpi *d,
+                               mbedtls_mpi T[4] )
+{
+#if defined(MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( mbedtls_internal_ecp_double_add_mxz( grp, R, S, P, Q, d ) );
+#endif /* MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT */
+
+#if defined(MBEDTLS_ECP_NO_FALLBACK) && defined(MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT)
+    return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+#else
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    MPI_ECP_ADD( &T[0], &P->X,   &P->Z ); /* Pp := PX + PZ                    */
+    MPI_ECP_SUB( &T[1], &P->X,   &P->Z ); /* Pm := PX - PZ                    */
+    MPI_ECP_ADD( &T[2], &Q->X,   &Q->Z ); /* Qp := QX + XZ                    */
+    MPI_ECP_SUB( &T[3], &Q->X,   &Q->Z ); /* Qm := QX - QZ                    */
+    MPI_ECP_MUL( &T[3], &T[3],   &T[0] ); /* Qm * Pp                          */
+    MPI_ECP_MUL( &T[2], &T[2],   &T[1] ); /* Qp * Pm                          */
+    MPI_ECP_SQR( &T[0], &T[0]          ); /* Pp^2                             */
+    MPI_ECP_SQR( &T[1], &T[1]          ); /* Pm^2                             */
+    MPI_ECP_MUL( &R->X, &T[0],   &T[1] ); /* Pp^2 * Pm^2                      */
+    MPI_ECP_SUB( &T[0], &T[0],   &T[1] ); /* Pp^2 - Pm^2                      */
+    MPI_ECP_MUL( &R->Z, &grp->A, &T[0] ); /* A * (Pp^2 - Pm^2)                */
+    MPI_ECP_ADD( &R->Z, &T[1],   &R->Z ); /* [ A * (Pp^2-Pm^2) ] + Pm^2       */
+    MPI_ECP_ADD( &S->X, &T[3],   &T[2] ); /* Qm*Pp + Qp*Pm                    */
+    MPI_ECP_SQR( &S->X, &S->X          ); /* (Qm*Pp + Qp*Pm)^2                */
+    MPI_ECP_SUB( &S->Z, &T[3],   &T[2] ); /* Qm*Pp - Qp*Pm                    */
+    MPI_ECP_SQR( &S->Z, &S->Z          ); /* (Qm*Pp - Qp*Pm)^2                */
+    MPI_ECP_MUL( &S->Z, d,       &S->Z ); /* d * ( Qm*Pp - Qp*Pm )^2          */
+    MPI_ECP_MUL( &R->Z, &T[0],   &R->Z ); /* [A*(Pp^2-Pm^2)+Pm^2]*(Pp^2-Pm^2) */
+
+cleanup:
+
+    return( ret );
+#endif /* !defined(MBEDTLS_ECP_NO_FALLBACK) || !defined(MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT) */
+}
+
+/*
+ * Multiplication with Montgomery ladder in x/z coordinates,
+ * for curves in Montgomery form
+ */
+static int ecp_mul_mxz( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                        const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                        int (*f_rng)(void *, unsigned char *, size_t),
+                        void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i;
+    unsigned char b;
+    mbedtls_ecp_point RP;
+    mbedtls_mpi PX;
+    mbedtls_mpi tmp[4];
+    mbedtls_ecp_point_init( &RP ); mbedtls_mpi_init( &PX );
+
+    mpi_init_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+
+    if( f_rng == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    /* Save PX and read from P before writing to R, in case P == R */
+    MPI_ECP_MOV( &PX, &P->X );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &RP, P ) );
+
+    /* Set R to zero in modified x/z coordinates */
+    MPI_ECP_LSET( &R->X, 1 );
+    MPI_ECP_LSET( &R->Z, 0 );
+    mbedtls_mpi_free( &R->Y );
+
+    /* RP.X might be slightly larger than P, so reduce it */
+    MOD_ADD( &RP.X );
+
+    /* Randomize coordinates of the starting point */
+    MBEDTLS_MPI_CHK( ecp_randomize_mxz( grp, &RP, f_rng, p_rng ) );
+
+    /* Loop invariant: R = result so far, RP = R + P */
+    i = grp->nbits + 1; /* one past the (zero-based) required msb for private keys */
+    while( i-- > 0 )
+    {
+        b = mbedtls_mpi_get_bit( m, i );
+        /*
+         *  if (b) R = 2R + P else R = 2R,
+         * which is:
+         *  if (b) double_add( RP, R, RP, R )
+         *  else   double_add( R, RP, R, RP )
+         * but using safe conditional swaps to avoid leaks
+         */
+        MPI_ECP_COND_SWAP( &R->X, &RP.X, b );
+        MPI_ECP_COND_SWAP( &R->Z, &RP.Z, b );
+        MBEDTLS_MPI_CHK( ecp_double_add_mxz( grp, R, &RP, R, &RP, &PX, tmp ) );
+        MPI_ECP_COND_SWAP( &R->X, &RP.X, b );
+        MPI_ECP_COND_SWAP( &R->Z, &RP.Z, b );
+    }
+
+    /*
+     * Knowledge of the projective coordinates may leak the last few bits of the
+     * scalar [1], and since our MPI implementation isn't constant-flow,
+     * inversion (used for coordinate normalization) may leak the full value
+     * of its input via side-channels [2].
+     *
+     * [1] https://eprint.iacr.org/2003/191
+     * [2] https://eprint.iacr.org/2020/055
+     *
+     * Avoid the leak by randomizing coordinates before we normalize them.
+     */
+    MBEDTLS_MPI_CHK( ecp_randomize_mxz( grp, R, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_mxz( grp, R ) );
+
+cleanup:
+    mbedtls_ecp_point_free( &RP ); mbedtls_mpi_free( &PX );
+
+    mpi_free_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+    return( ret );
+}
+
+#if defined(MBEDTLS_ECP_MONTGOMERY_FIXED_LIMBS) &&                   \
+    defined(MBEDTLS_HAVE_INT64) && defined(MBEDTLS_HAVE_UDBL) &&     \
+    ( defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED) ||                  \
+      defined(MBEDTLS_ECP_DP_CURVE448_ENABLED) )
+#define ECP_MXZ_FIXED_LIMBS
+#endif
+
+#if defined(ECP_MXZ_FIXED_LIMBS)
+/*
+ * Fixed-size field arithmetic for Curve25519 and Curve448
+ *
+ * ecp_mul_mxz() above works on mbedtls_mpi, so each of the ~2500 field
+ * operations of an X25519 ladder goes through the generic multiplication
+ * and ecp_mod_p255(). For these two curves, ecp_mul_mxz_fixed() runs the
+ * same ladder with unsaturated limbs kept on the stack:
+ * - Curve25519: 5 limbs in radix 2^51, reduction by 2^255 = 19 mod p;
+ * - Curve448: 8 limbs in radix 2^56, reduction by 2^448 = 2^224 + 1 mod p.
+ * This needs 64-bit limbs and a 128-bit double-width type, so it is only
+ * available when mbedtls_t_udbl is 128 bits wide.
+ *
+ * All the functions below are constant-time. Field elements are only
+ * partially reduced, except by the *_to_bytes() functions. The bounds
+ * noted for each function are what the ladder needs: every input of a
+ * multiplication is the sum or difference of two outputs of a
+ * multiplication, and every operand of a subtraction is the output of a
+ * multiplication.
+ */
+
+#define ECP_MXZ_MAX_LIMBS       8
+#define ECP_MXZ_MAX_BYTES       56
+
+/*
+ * Field operations for one curve, used by the shared ladder below.
+ */
+typedef struct
+{
+    mbedtls_ecp_group_id id;
+    size_t pbits;       /* size of p in bits, to check the group */
+    size_t limbs;       /* number of limbs in a field element */
+    size_t bytes;       /* size of an element in little-endian encoding */
+    uint64_t a24;       /* (A + 2) / 4, as stored in grp->A */
+    void (*add)( uint64_t *r, const uint64_t *a, const uint64_t *b );
+    void (*sub)( uint64_t *r, const uint64_t *a, const uint64_t *b );
+    void (*mul)( uint64_t *r, const uint64_t *a, const uint64_t *b );
+    void (*sqr)( uint64_t *r, const uint64_t *a );
+    void (*mul_small)( uint64_t *r, const uint64_t *a, uint64_t c );
+    void (*inv)( uint64_t *r, const uint64_t *a );
+    void (*from_bytes)( uint64_t *r, const unsigned char *buf );
+    void (*to_bytes)( unsigned char *buf, const uint64_t *a );
+} ecp_mxz_field;
+
+#if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
+#define X25519_MASK     ( ( (uint64_t) 1 << 51 ) - 1 )
+
+/*
+ * Carry t[0..4] into r, folding the top carry back with 2^255 = 19.
+ * Output limbs are below 2^51 + 2^20 for inputs below 2^118.
+ */
+static void ecp_x25519_carry( uint64_t *r, mbedtls_t_udbl t[5] )
+{
+    mbedtls_t_udbl c;
+
+    t[1] += t[0] >> 51; r[0] = (uint64_t) t[0] & X25519_MASK;
+    t[2] += t[1] >> 51; r[1] = (uint64_t) t[1] & X25519_MASK;
+    t[3] += t[2] >> 51; r[2] = (uint64_t) t[2] & X25519_MASK;
+    t[4] += t[3] >> 51; r[3] = (uint64_t) t[3] & X25519_MASK;
+    c = ( t[4] >> 51 ) * 19 + r[0]; r[4] = (uint64_t) t[4] & X25519_MASK;
+    r[0] = (uint64_t) c & X25519_MASK;
+    r[1] += (uint64_t) ( c >> 51 );
+}
+
+/* r = a + b, for a, b below 2^52 */
+static void ecp_x25519_add( uint64_t *r, const uint64_t *a, const uint64_t *b )
+{
+    size_t i;
+
+    for( i = 0; i < 5; i++ )
+        r[i] = a[i] + b[i];
+}
+
+/* r = a + 2p - b, for a below 2^52 and b the output of a multiplication */
+static void ecp_x25519_sub( uint64_t *r, const uint64_t *a, const uint64_t *b )
+{
+    r[0] = a[0] + 0xFFFFFFFFFFFDA - b[0];
+    r[1] = a[1] + 0xFFFFFFFFFFFFE - b[1];
+    r[2] = a[2] + 0xFFFFFFFFFFFFE - b[2];
+    r[3] = a[3] + 0xFFFFFFFFFFFFE - b[3];
+    r[4] = a[4] + 0xFFFFFFFFFFFFE - b[4];
+}
+
+/* r = a * b, for a, b below 2^54 */
+static void ecp_x25519_mul( uint64_t *r, const uint64_t *a, const uint64_t *b )
+{
+    mbedtls_t_udbl t[5];
+    const uint64_t b1 = 19 * b[1], b2 = 19 * b[2];
+    const uint64_t b3 = 19 * b[3], b4 = 19 * b[4];
+
+    t[0] = (mbedtls_t_udbl) a[0] * b[0] + (mbedtls_t_udbl) a[1] * b4 +
+           (mbedtls_t_udbl) a[2] * b3   + (mbedtls_t_udbl) a[3] * b2 +
+           (mbedtls_t_udbl) a[4] * b1;
+    t[1] = (mbedtls_t_udbl) a[0] * b[1] + (mbedtls_t_udbl) a[1] * b[0] +
+           (mbedtls_t_udbl) a[2] * b4   + (mbedtls_t_udbl) a[3] * b3 +
+           (mbedtls_t_udbl) a[4] * b2;
+    t[2] = (mbedtls_t_udbl) a[0] * b[2] + (mbedtls_t_udbl) a[1] * b[1] +
+           (mbedtls_t_udbl) a[2] * b[0] + (mbedtls_t_udbl) a[3] * b4 +
+           (mbedtls_t_udbl) a[4] * b3;
+    t[3] = (mbedtls_t_udbl) a[0] * b[3] + (mbedtls_t_udbl) a[1] * b[2] +
+           (mbedtls_t_udbl) a[2] * b[1] + (mbedtls_t_udbl) a[3] * b[0] +
+           (mbedtls_t_udbl) a[4] * b4;
+    t[4] = (mbedtls_t_udbl) a[0] * b[4] + (mbedtls_t_udbl) a[1] * b[3] +
+           (mbedtls_t_udbl) a[2] * b[2] + (mbedtls_t_udbl) a[3] * b[1] +
+           (mbedtls_t_udbl) a[4] * b[0];
+
+    ecp_x25519_carry( r, t );
+}
+
+/* r = a^2, for a below 2^54 */
+static void ecp_x25519_sqr( uint64_t *r, const uint64_t *a )
+{
+    mbedtls_t_udbl t[5];
+    const uint64_t d0 = 2 * a[0], d1 = 2 * a[1], d2 = 2 * a[2];
+    const uint64_t d3 = 2 * a[3];
+    const uint64_t a3 = 19 * a[3], a4 = 19 * a[4];
+
+    t[0] = (mbedtls_t_udbl) a[0] * a[0] + (mbedtls_t_udbl) d1 * a4 +
+           (mbedtls_t_udbl) d2 * a3;
+    t[1] = (mbedtls_t_udbl) d0 * a[1] + (mbedtls_t_udbl) d2 * a4 +
+           (mbedtls_t_udbl) a[3] * a3;
+    t[2] = (mbedtls_t_udbl) d0 * a[2] + (mbedtls_t_udbl) a[1] * a[1] +
+           (mbedtls_t_udbl) d3 * a4;
+    t[3] = (mbedtls_t_udbl) d0 * a[3] + (mbedtls_t_udbl) d1 * a[2] +
+           (mbedtls_t_udbl) a[4] * a4;
+    t[4] = (mbedtls_t_udbl) d0 * a[4] + (mbedtls_t_udbl) d1 * a[3] +
+           (mbedtls_t_udbl) a[2] * a[2];
+
+    ecp_x25519_carry( r, t );
+}
+
+/* r = a * c, for a below 2^54 and c below 2^32 */
+static void ecp_x25519_mul_small( uint64_t *r, const uint64_t *a, uint64_t c )
+{
+    mbedtls_t_udbl t[5];
+    size_t i;
+
+    for( i = 0; i < 5; i++ )
+        t[i] = (mbedtls_t_udbl) a[i] * c;
+
+    ecp_x25519_carry( r, t );
+}
+
+/* r = a^(2^n) */
+static void ecp_x25519_sqr_n( uint64_t *r, const uint64_t *a, size_t n )
+{
+    ecp_x25519_sqr( r, a );
+    while( --n > 0 )
+        ecp_x25519_sqr( r, r );
+}
+
+/*
+ * r = a^(p - 2) = a^(2^255 - 21), which is 1/a for a != 0.
+ * Uses the usual chain: t_k = a^(2^k - 1) for k = 5, 10, 20, ..., 250.
+ */
+static void ecp_x25519_inv( uint64_t *r, const uint64_t *a )
+{
+    uint64_t a2[5], a11[5], t5[5], t10[5], t50[5], t[5], u[5];
+
+    ecp_x25519_sqr( a2, a );                    /* a^2 */
+    ecp_x25519_sqr_n( t, a2, 2 );               /* a^8 */
+    ecp_x25519_mul( t, t, a );                  /* a^9 */
+    ecp_x25519_mul( a11, t, a2 );               /* a^11 */
+    ecp_x25519_sqr( u, a11 );                   /* a^22 */
+    ecp_x25519_mul( t5, u, t );                 /* a^31 = t_5 */
+    ecp_x25519_sqr_n( u, t5, 5 );
+    ecp_x25519_mul( t10, u, t5 );               /* t_10 */
+    ecp_x25519_sqr_n( u, t10, 10 );
+    ecp_x25519_mul( t, u, t10 );                /* t_20 */
+    ecp_x25519_sqr_n( u, t, 20 );
+    ecp_x25519_mul( u, u, t );                  /* t_40 */
+    ecp_x25519_sqr_n( u, u, 10 );
+    ecp_x25519_mul( t50, u, t10 );              /* t_50 */
+    ecp_x25519_sqr_n( u, t50, 50 );
+    ecp_x25519_mul( t, u, t50 );                /* t_100 */
+    ecp_x25519_sqr_n( u, t, 100 );
+    ecp_x25519_mul( u, u, t );                  /* t_200 */
+    ecp_x25519_sqr_n( u, u, 50 );
+    ecp_x25519_mul( u, u, t50 );                /* t_250 */
+    ecp_x25519_sqr_n( u, u, 5 );
+    ecp_x25519_mul( r, u, a11 );                /* a^(2^255 - 32 + 11) */
+
+    mbedtls_platform_zeroize( a2, sizeof( a2 ) );
+    mbedtls_platform_zeroize( a11, sizeof( a11 ) );
+    mbedtls_platform_zeroize( t5, sizeof( t5 ) );
+    mbedtls_platform_zeroize( t10, sizeof( t10 ) );
+    mbedtls_platform_zeroize( t50, sizeof( t50 ) );
+    mbedtls_platform_zeroize( t, sizeof( t ) );
+    mbedtls_platform_zeroize( u, sizeof( u ) );
+}
+
+/* Load a 256-bit little-endian value, reducing bit 255 (2^255 = 19) */
+static void ecp_x25519_from_bytes( uint64_t *r, const unsigned char *buf )
+{
+    const uint64_t w0 = MBEDTLS_GET_UINT64_LE( buf,  0 );
+    const uint64_t w1 = MBEDTLS_GET_UINT64_LE( buf,  8 );
+    const uint64_t w2 = MBEDTLS_GET_UINT64_LE( buf, 16 );
+    const uint64_t w3 = MBEDTLS_GET_UINT64_LE( buf, 24 );
+
+    r[0] = ( w0 & X25519_MASK ) + 19 * ( w3 >> 63 );
+    r[1] = ( ( w0 >> 51 ) | ( w1 << 13 ) ) & X25519_MASK;
+    r[2] = ( ( w1 >> 38 ) | ( w2 << 26 ) ) & X25519_MASK;
+    r[3] = ( ( w2 >> 25 ) | ( w3 << 39 ) ) & X25519_MASK;
+    r[4] = ( w3 >> 12 ) & X25519_MASK;
+}
+
+/* Store the canonical representative of a in 32 bytes, little-endian */
+static void ecp_x25519_to_bytes( unsigned char *buf, const uint64_t *a )
+{
+    mbedtls_t_udbl t[5];
+    uint64_t h[5], q;
+    size_t i;
+
+    /* Bring all limbs below 2^51 + 2^20, so that h < 2p */
+    for( i = 0; i < 5; i++ )
+        t[i] = a[i];
+    ecp_x25519_carry( h, t );
+
+    /* q = 1 if h >= p, that is if h + 19 >= 2^255 */
+    q = ( h[0] + 19 ) >> 51;
+    q = ( h[1] + q ) >> 51;
+    q = ( h[2] + q ) >> 51;
+    q = ( h[3] + q ) >> 51;
+    q = ( h[4] + q ) >> 51;
+
+    /* h - q p = h + 19 q - q 2^255 */
+    h[0] += 19 * q;
+    h[1] += h[0] >> 51; h[0] &= X25519_MASK;
+    h[2] += h[1] >> 51; h[1] &= X25519_MASK;
+    h[3] += h[2] >> 51; h[2] &= X25519_MASK;
+    h[4] += h[3] >> 51; h[3] &= X25519_MASK;
+                        h[4] &= X25519_MASK;
+
+    MBEDTLS_PUT_UINT64_LE( h[0]         | ( h[1] << 51 ), buf,  0 );
+    MBEDTLS_PUT_UINT64_LE( ( h[1] >> 13 ) | ( h[2] << 38 ), buf,  8 );
+    MBEDTLS_PUT_UINT64_LE( ( h[2] >> 26 ) | ( h[3] << 25 ), buf, 16 );
+    MBEDTLS_PUT_UINT64_LE( ( h[3] >> 39 ) | ( h[4] << 12 ), buf, 24 );
+
+    mbedtls_platform_zeroize( h, sizeof( h ) );
+    mbedtls_platform_zeroize( t, sizeof( t ) );
+}
+
+static const ecp_mxz_field ecp_x25519_field =
+{
+    MBEDTLS_ECP_DP_CURVE25519, 255, 5, 32, 121666,
+    ecp_x25519_add, ecp_x25519_sub, ecp_x25519_mul, ecp_x25519_sqr,
+    ecp_x25519_mul_small, ecp_x25519_inv,
+    ecp_x25519_from_bytes, ecp_x25519_to_bytes,
+};
+#endif /* MBEDTLS_ECP_DP_CURVE25519_ENABLED */
+
+#if defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+#define X448_MASK       ( ( (uint64_t) 1 << 56 ) - 1 )
+
+/*
+ * Carry t[0..7] into r, folding the top carry back with
+ * 2^448 = 2^224 + 1. Output limbs are below 2^56 + 2^12 for inputs
+ * below 2^124.
+ */
+static void ecp_x448_carry( uint64_t *r, mbedtls_t_udbl t[8] )
+{
+    mbedtls_t_udbl c;
+    size_t i, pass;
+
+    for( pass = 0; pass < 2; pass++ )
+    {
+        for( i = 0; i < 7; i++ )
+        {
+            t[i + 1] += t[i] >> 56;
+            t[i] &= X448_MASK;
+        }
+        c = t[7] >> 56;
+        t[7] &= X448_MASK;
+        t[0] += c;
+        t[4] += c;
+    }
+
+    for( i = 0; i < 8; i++ )
+        r[i] = (uint64_t) t[i];
+}
+
+/* r = a + b, for a, b below 2^57 */
+static void ecp_x448_add( uint64_t *r, const uint64_t *a, const uint64_t *b )
+{
+    size_t i;
+
+    for( i = 0; i < 8; i++ )
+        r[i] = a[i] + b[i];
+}
+
+/* r = a + 2p - b, for a below 2^57 and b the output of a multiplication */
+static void ecp_x448_sub( uint64_t *r, const uint64_t *a, const uint64_t *b )
+{
+    size_t i;
+
+    for( i = 0; i < 8; i++ )
+        r[i] = a[i] + ( i == 4 ? 0x1FFFFFFFFFFFFFC : 0x1FFFFFFFFFFFFFE ) - b[i];
+}
+
+/*
+ * Fold the 15 column sums of a product: limb 8 + i has weight
+ * 2^448 2^(56 i) = 2^(56 (i + 4)) + 2^(56 i) mod p.
+ */
+static void ecp_x448_reduce( uint64_t *r, mbedtls_t_udbl t[15] )
+{
+    size_t k;
+
+    for( k = 14; k >= 8; k-- )
+    {
+        t[k - 4] += t[k];
+        t[k - 8] += t[k];
+    }
+
+    ecp_x448_carry( r, t );
+}
+
+/* r = a * b, for a, b below 2^58 */
+static void ecp_x448_mul( uint64_t *r, const uint64_t *a, const uint64_t *b )
+{
+    mbedtls_t_udbl t[15];
+    size_t i, j;
+
+    memset( t, 0, sizeof( t ) );
+    for( i = 0; i < 8; i++ )
+        for( j = 0; j < 8; j++ )
+            t[i + j] += (mbedtls_t_udbl) a[i] * b[j];
+
+    ecp_x448_reduce( r, t );
+}
+
+/* r = a^2, for a below 2^58 */
+static void ecp_x448_sqr( uint64_t *r, const uint64_t *a )
+{
+    mbedtls_t_udbl t[15];
+    uint64_t d;
+    size_t i, j;
+
+    memset( t, 0, sizeof( t ) );
+    for( i = 0; i < 8; i++ )
+    {
+        t[2 * i] += (mbedtls_t_udbl) a[i] * a[i];
+        d = 2 * a[i];
+        for( j = i + 1; j < 8; j++ )
+            t[i + j] += (mbedtls_t_udbl) d * a[j];
+    }
+
+    ecp_x448_reduce( r, t );
+}
+
+/* r = a * c, for a below 2^58 and c below 2^32 */
+static void ecp_x448_mul_small( uint64_t *r, const uint64_t *a, uint64_t c )
+{
+    mbedtls_t_udbl t[8];
+    size_t i;
+
+    for( i = 0; i < 8; i++ )
+        t[i] = (mbedtls_t_udbl) a[i] * c;
+
+    ecp_x448_carry( r, t );
+}
+
+/* r = a^(2^n) */
+static void ecp_x448_sqr_n( uint64_t *r, const uint64_t *a, size_t n )
+{
+    ecp_x448_sqr( r, a );
+    while( --n > 0 )
+        ecp_x448_sqr( r, r );
+}
+
+/*
+ * r = a^(p - 2), which is 1/a for a != 0.
+ * In binary, p - 2 = 2^448 - 2^224 - 3 is 223 ones, a zero, 222 ones,
+ * a zero and a one. With t_k = a^(2^k - 1):
+ * r = ((t_223^2)^(2^222) t_222)^4 a.
+ */
+static void ecp_x448_inv( uint64_t *r, const uint64_t *a )
+{
+    uint64_t t3[8], t6[8], t24[8], t30[8], t[8], u[8];
+
+    ecp_x448_sqr( u, a );
+    ecp_x448_mul( u, u, a );                    /* t_2 */
+    ecp_x448_sqr( u, u );
+    ecp_x448_mul( t3, u, a );                   /* t_3 */
+    ecp_x448_sqr_n( u, t3, 3 );
+    ecp_x448_mul( t6, u, t3 );                  /* t_6 */
+    ecp_x448_sqr_n( u, t6, 6 );
+    ecp_x448_mul( t, u, t6 );                   /* t_12 */
+    ecp_x448_sqr_n( u, t, 12 );
+    ecp_x448_mul( t24, u, t );                  /* t_24 */
+    ecp_x448_sqr_n( u, t24, 6 );
+    ecp_x448_mul( t30, u, t6 );                 /* t_30 */
+    ecp_x448_sqr_n( u, t24, 24 );
+    ecp_x448_mul( t, u, t24 );                  /* t_48 */
+    ecp_x448_sqr_n( u, t, 48 );
+    ecp_x448_mul( t, u, t );                    /* t_96 */
+    ecp_x448_sqr_n( u, t, 96 );
+    ecp_x448_mul( t, u, t );                    /* t_192 */
+    ecp_x448_sqr_n( u, t, 30 );
+    ecp_x448_mul( t, u, t30 );                  /* t_222 */
+    ecp_x448_sqr( u, t );
+    ecp_x448_mul( u, u, a );                    /* t_223 */
+    ecp_x448_sqr_n( u, u, 223 );
+    ecp_x448_mul( u, u, t );
+    ecp_x448_sqr_n( u, u, 2 );
+    ecp_x448_mul( r, u, a );
+
+    mbedtls_platform_zeroize( t3, sizeof( t3 ) );
+    mbedtls_platform_zeroize( t6, sizeof( t6 ) );
+    mbedtls_platform_zeroize( t24, sizeof( t24 ) );
+    mbedtls_platform_zeroize( t30, sizeof( t30 ) );
+    mbedtls_platform_zeroize( t, sizeof( t ) );
+    mbedtls_platform_zeroize( u, sizeof( u ) );
+}
+
+/* Load a 448-bit little-endian value */
+static void ecp_x448_from_bytes( uint64_t *r, const unsigned char *buf )
+{
+    size_t i, j;
+
+    for( i = 0; i < 8; i++ )
+    {
+        r[i] = 0;
+        for( j = 0; j < 7; j++ )
+            r[i] |= (uint64_t) buf[7 * i + j] << ( 8 * j );
+    }
+}
+
+/* Store the canonical representative of a in 56 bytes, little-endian */
+static void ecp_x448_to_bytes( unsigned char *buf, const uint64_t *a )
+{
+    mbedtls_t_udbl t[8];
+    uint64_t h[8], x, borrow, mask, c;
+    size_t i, j;
+
+    /* Bring all limbs below 2^56 + 2^12, so that h < 2p */
+    for( i = 0; i < 8; i++ )
+        t[i] = a[i];
+    ecp_x448_carry( h, t );
+
+    /*
+     * h = h - p, with a borrow in { -1, 0, 1 } kept modulo 2^64: adding 2^56
+     * keeps the true value of x non-negative.
+     */
+    borrow = 0;
+    for( i = 0; i < 8; i++ )
+    {
+        x = h[i] + ( (uint64_t) 1 << 56 ) -
+            ( i == 4 ? X448_MASK - 1 : X448_MASK ) - borrow;
+        h[i] = x & X448_MASK;
+        borrow = 1 - ( x >> 56 );
+    }
+
+    /* If that went negative (borrow == 1), add p back */
+    mask = (uint64_t) 0 - borrow;
+    c = 0;
+    for( i = 0; i < 8; i++ )
+    {
+        x = h[i] + ( ( i == 4 ? X448_MASK - 1 : X448_MASK ) & mask ) + c;
+        h[i] = x & X448_MASK;
+        c = x >> 56;
+    }
+
+    for( i = 0; i < 8; i++ )
+        for( j = 0; j < 7; j++ )
+            buf[7 * i + j] = (unsigned char) ( h[i] >> ( 8 * j ) );
+
+    mbedtls_platform_zeroize( h, sizeof( h ) );
+    mbedtls_platform_zeroize( t, sizeof( t ) );
+}
+
+static const ecp_mxz_field ecp_x448_field =
+{
+    MBEDTLS_ECP_DP_CURVE448, 448, 8, 56, 39082,
+    ecp_x448_add, ecp_x448_sub, ecp_x448_mul, ecp_x448_sqr,
+    ecp_x448_mul_small, ecp_x448_inv,
+    ecp_x448_from_bytes, ecp_x448_to_bytes,
+};
+#endif /* MBEDTLS_ECP_DP_CURVE448_ENABLED */
+
+/*
+ * Return the fixed-size field for this group, or NULL if the generic code
+ * must be used.
+ */
+static const ecp_mxz_field *ecp_mxz_fixed_field( const mbedtls_ecp_group *grp )
+{
+    const ecp_mxz_field *F = NULL;
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( NULL );
+#endif
+
+#if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
+    if( grp->id == MBEDTLS_ECP_DP_CURVE25519 )
+        F = &ecp_x25519_field;
+#endif
+#if defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+    if( grp->id == MBEDTLS_ECP_DP_CURVE448 )
+        F = &ecp_x448_field;
+#endif
+
+    if( F == NULL || grp->pbits != F->pbits ||
+        grp->nbits >= 8 * F->bytes )
+        return( NULL );
+
+    return( F );
+}
+
+/* Swap a and b if swap == 1, in constant time */
+static void ecp_mxz_fixed_cswap( const ecp_mxz_field *F,
+                                 uint64_t *a, uint64_t *b, uint64_t swap )
+{
+    const uint64_t mask = (uint64_t) 0 - swap;
+    uint64_t t;
+    size_t i;
+
+    for( i = 0; i < F->limbs; i++ )
+    {
+        t = mask & ( a[i] ^ b[i] );
+        a[i] ^= t;
+        b[i] ^= t;
+    }
+}
+
+/* Draw l such that 1 < l < p, see ecp_randomize_mxz() */
+static int ecp_mxz_fixed_rand( const mbedtls_ecp_group *grp,
+                               const ecp_mxz_field *F, uint64_t *L,
+                               int (*f_rng)(void *, unsigned char *, size_t),
+                               void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    unsigned char buf[ECP_MXZ_MAX_BYTES];
+    mbedtls_mpi l;
+
+    mbedtls_mpi_init( &l );
+
+    MPI_ECP_RAND( &l );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary_le( &l, buf, F->bytes ) );
+    F->from_bytes( L, buf );
+
+cleanup:
+    mbedtls_mpi_free( &l );
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+
+    if( ret == MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
+        ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+    return( ret );
+}
+
+/*
+ * Montgomery ladder with fixed-size field elements, see ecp_mul_mxz().
+ *
+ * Same algorithm, same coordinate randomization (so the same RNG
+ * consumption), but the conditional swaps are merged between iterations
+ * as in RFC 7748 section 5, and the final inversion is a constant-time
+ * exponentiation.
+ */
+static int ecp_mul_mxz_fixed( const mbedtls_ecp_group *grp,
+                              const ecp_mxz_field *F,
+                              mbedtls_ecp_point *R,
+                              const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                              int (*f_rng)(void *, unsigned char *, size_t),
+                              void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    uint64_t X1[ECP_MXZ_MAX_LIMBS], L[ECP_MXZ_MAX_LIMBS];
+    uint64_t X2[ECP_MXZ_MAX_LIMBS], Z2[ECP_MXZ_MAX_LIMBS];
+    uint64_t X3[ECP_MXZ_MAX_LIMBS], Z3[ECP_MXZ_MAX_LIMBS];
+    uint64_t T[4][ECP_MXZ_MAX_LIMBS];
+    unsigned char k[ECP_MXZ_MAX_BYTES], buf[ECP_MXZ_MAX_BYTES];
+    uint64_t b, swap = 0;
+    size_t i;
+
+    if( f_rng == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    /* Read from P before writing to R, in case P == R. P->X is not reduced
+     * mod p, but ecp_check_pubkey_mx() ensured that it fits in F->bytes. */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary_le( &P->X, buf, F->bytes ) );
+    F->from_bytes( X1, buf );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary_le( m, k, F->bytes ) );
+
+    /* R = zero in x/z coordinates, RP = P with randomized coordinates */
+    memset( X2, 0, sizeof( X2 ) );
+    memset( Z2, 0, sizeof( Z2 ) );
+    X2[0] = 1;
+    MBEDTLS_MPI_CHK( ecp_mxz_fixed_rand( grp, F, Z3, f_rng, p_rng ) );
+    F->mul( X3, X1, Z3 );
+
+    /* Loop invariant: (X2, Z2) = result so far, (X3, Z3) = that + P */
+    i = grp->nbits + 1;
+    while( i-- > 0 )
+    {
+        b = ( k[i / 8] >> ( i % 8 ) ) & 1;
+        swap ^= b;
+        ecp_mxz_fixed_cswap( F, X2, X3, swap );
+        ecp_mxz_fixed_cswap( F, Z2, Z3, swap );
+        swap = b;
+
+        /* Double-and-add, see ecp_double_add_mxz() */
+        F->add( T[0], X2, Z2 );             /* Pp := PX + PZ                    */
+        F->sub( T[1], X2, Z2 );             /* Pm := PX - PZ                    */
+        F->add( T[2], X3, Z3 );             /* Qp := QX + QZ                    */
+        F->sub( T[3], X3, Z3 );             /* Qm := QX - QZ                    */
+        F->mul( T[3], T[3], T[0] );         /* Qm * Pp                          */
+        F->mul( T[2], T[2], T[1] );         /* Qp * Pm                          */
+        F->sqr( T[0], T[0] );               /* Pp^2                             */
+        F->sqr( T[1], T[1] );               /* Pm^2                             */
+        F->mul( X2, T[0], T[1] );           /* Pp^2 * Pm^2                      */
+        F->sub( T[0], T[0], T[1] );         /* Pp^2 - Pm^2                      */
+        F->mul_small( Z2, T[0], F->a24 );   /* A * (Pp^2 - Pm^2)                */
+        F->add( Z2, T[1], Z2 );             /* [ A * (Pp^2-Pm^2) ] + Pm^2       */
+        F->add( X3, T[3], T[2] );           /* Qm*Pp + Qp*Pm                    */
+        F->sqr( X3, X3 );                   /* (Qm*Pp + Qp*Pm)^2                */
+        F->sub( Z3, T[3], T[2] );           /* Qm*Pp - Qp*Pm                    */
+        F->sqr( Z3, Z3 );                   /* (Qm*Pp - Qp*Pm)^2                */
+        F->mul( Z3, Z3, X1 );               /* d * ( Qm*Pp - Qp*Pm )^2          */
+        F->mul( Z2, Z2, T[0] );             /* [A*(Pp^2-Pm^2)+Pm^2]*(Pp^2-Pm^2) */
+    }
+    ecp_mxz_fixed_cswap( F, X2, X3, swap );
+    ecp_mxz_fixed_cswap( F, Z2, Z3, swap );
+
+    /* Randomize before normalizing, as in ecp_mul_mxz() */
+    MBEDTLS_MPI_CHK( ecp_mxz_fixed_rand( grp, F, L, f_rng, p_rng ) );
+    F->mul( X2, X2, L );
+    F->mul( Z2, Z2, L );
+
+    /* Z2 = 0 only for points of small order; mbedtls_mpi_inv_mod() would
+     * fail in ecp_normalize_mxz(), so fail the same way. */
+    F->to_bytes( buf, Z2 );
+    b = 0;
+    for( i = 0; i < F->bytes; i++ )
+        b |= buf[i];
+    if( b == 0 )
+    {
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+        goto cleanup;
+    }
+
+    F->inv( T[0], Z2 );
+    F->mul( X2, X2, T[0] );
+    F->to_bytes( buf, X2 );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary_le( &R->X, buf, F->bytes ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+    mbedtls_mpi_free( &R->Y );
+
+cleanup:
+    mbedtls_platform_zeroize( X1, sizeof( X1 ) );
+    mbedtls_platform_zeroize( L, sizeof( L ) );
+    mbedtls_platform_zeroize( X2, sizeof( X2 ) );
+    mbedtls_platform_zeroize( Z2, sizeof( Z2 ) );
+    mbedtls_platform_zeroize( X3, sizeof( X3 ) );
+    mbedtls_platform_zeroize( Z3, sizeof( Z3 ) );
+    mbedtls_platform_zeroize( T, sizeof( T ) );
+    mbedtls_platform_zeroize( k, sizeof( k ) );
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+
+    return( ret );
+}
+#endif /* ECP_MXZ_FIXED_LIMBS */
+
+#endif /* MBEDTLS_ECP_MONTGOMERY_ENABLED */
+
+/*
+ * Restartable multiplication R = m * P
+ *
+ * This internal function can be called without an RNG in case where we know
+ * the inputs are not sensitive.
+ */
+static int ecp_mul_restartable_internal( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+             mbedtls_ecp_restart_ctx *rs_ctx )
+{
+    int ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    char is_grp_capable = 0;
 #endif
 
 #if defined(MBEDTLS_ECP_RESTARTABLE)
@@ -2549,11 +3983,27 @@ static int ecp_mul_restartable_internal( mbedtls_ecp_group *grp, mbedtls_ecp_poi
     ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
 #if defined(MBEDTLS_ECP_MONTGOMERY_ENABLED)
     if( mbedtls_ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_MONTGOMERY )
+    {
+#if defined(ECP_MXZ_FIXED_LIMBS)
+        const ecp_mxz_field *F = ecp_mxz_fixed_field( grp );
+        if( F != NULL )
+            MBEDTLS_MPI_CHK( ecp_mul_mxz_fixed( grp, F, R, m, P,
+                                                f_rng, p_rng ) );
+        else
+#endif
         MBEDTLS_MPI_CHK( ecp_mul_mxz( grp, R, m, P, f_rng, p_rng ) );
+    }
 #endif
 #if defined(MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED)
     if( mbedtls_ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
+    {
+#if defined(ECP_FIXED_LIMBS)
+        if( ecp_fixed_can_mul( grp, rs_ctx ) )
+            MBEDTLS_MPI_CHK( ecp_mul_comb_fixed( grp, R, m, P, f_rng, p_rng ) );
+        else
+#endif
         MBEDTLS_MPI_CHK( ecp_mul_comb( grp, R, m, P, f_rng, p_rng, rs_ctx ) );
+    }
 #endif
 
 cleanup:
@@ -2631,62 +4081,465 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
         MPI_ECP_ADD( &RHS, &RHS, &grp->A );
     }
 
-    MPI_ECP_MUL( &RHS, &RHS, &pt->X  );
-    MPI_ECP_ADD( &RHS, &RHS, &grp->B );
+    MPI_ECP_MUL( &RHS, &RHS, &pt->X  );
+    MPI_ECP_ADD( &RHS, &RHS, &grp->B );
+
+    if( MPI_ECP_CMP( &YY, &RHS ) != 0 )
+        ret = MBEDTLS_ERR_ECP_INVALID_KEY;
+
+cleanup:
+
+    mbedtls_mpi_free( &YY ); mbedtls_mpi_free( &RHS );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
+
+#if defined(MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED)
+/*
+ * R = m * P with shortcuts for m == 0, m == 1 and m == -1
+ * NOT constant-time - ONLY for short Weierstrass!
+ */
+static int mbedtls_ecp_mul_shortcuts( mbedtls_ecp_group *grp,
+                                      mbedtls_ecp_point *R,
+                                      const mbedtls_mpi *m,
+                                      const mbedtls_ecp_point *P,
+                                      mbedtls_ecp_restart_ctx *rs_ctx )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi tmp;
+    mbedtls_mpi_init( &tmp );
+
+    if( mbedtls_mpi_cmp_int( m, 0 ) == 0 )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( R ) );
+    }
+    else if( mbedtls_mpi_cmp_int( m, 1 ) == 0 )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, P ) );
+    }
+    else if( mbedtls_mpi_cmp_int( m, -1 ) == 0 )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, P ) );
+        MPI_ECP_NEG( &R->Y );
+    }
+    else
+    {
+        MBEDTLS_MPI_CHK( ecp_mul_restartable_internal( grp, R, m, P,
+                                                       NULL, NULL, rs_ctx ) );
+    }
+
+cleanup:
+    mbedtls_mpi_free( &tmp );
+
+    return( ret );
+}
+
+/*
+ * Width of the NAF representation of the scalars in mbedtls_ecp_muladd_batch():
+ * the table of each Q[i] holds 2^(w-2) = 8 odd multiples, and the table of G,
+ * which is computed once for all items, holds 32 odd multiples.
+ */
+#define ECP_BATCH_WNAF_Q        5
+#define ECP_BATCH_WNAF_G        7
+
+/* Number of items whose tables, then results, are normalized together */
+#define ECP_BATCH_CHUNK         16
+
+/*
+ * Recode m in width-w NAF: m = sum( naf[i] 2^i ) where each non-zero digit
+ * is odd, |naf[i]| < 2^(w-1), and any w consecutive digits contain at most
+ * one non-zero digit (GECC 3.35). If m < 0, the digits are those of |m|,
+ * negated.
+ *
+ * naf must have room for bitlen(m) + 1 digits. Returns the number of digits.
+ *
+ * NOT constant-time
+ */
+static size_t ecp_wnaf_recode( signed char naf[], const mbedtls_mpi *m,
+                               unsigned char w )
+{
+    size_t len = mbedtls_mpi_bitlen( m ) + 1;
+    size_t bit = 0, now, j;
+    int carry = 0, word;
+
+    memset( naf, 0, len );
+
+    while( bit < len )
+    {
+        /* Even digit (with the carry from the previous window): zero */
+        if( (int) mbedtls_mpi_get_bit( m, bit ) == carry )
+        {
+            bit++;
+            continue;
+        }
+
+        now = w;
+        if( now > len - bit )
+            now = len - bit;
+
+        word = carry;
+        for( j = 0; j < now; j++ )
+            word += mbedtls_mpi_get_bit( m, bit + j ) << j;
+
+        /* word is odd and less than 2^w: map it to ]-2^(w-1), 2^(w-1)[ */
+        carry = ( word >> ( w - 1 ) ) & 1;
+        word -= carry << w;
+
+        naf[bit] = (signed char) ( mbedtls_mpi_cmp_int( m, 0 ) < 0 ? -word : word );
+        bit += now;
+    }
+
+    return( len );
+}
+
+/*
+ * Index in a table of odd multiples for the non-zero NAF digit d: the table
+ * holds P, 3P, ..., (2 half - 1)P followed by their opposites.
+ */
+static size_t ecp_wnaf_index( size_t half, int d )
+{
+    if( d > 0 )
+        return( ( d - 1 ) / 2 );
+    else
+        return( half + ( -d - 1 ) / 2 );
+}
+
+/*
+ * Compute the tables of odd multiples of P[0..count-1] for
+ * ecp_muladd_wnaf(): T[j][k] = (2k+1) P[j] and T[j][half+k] = -T[j][k]
+ * for 0 <= k < half. All the points of all the tables are normalized with
+ * the same two inversions.
+ *
+ * D must have room for count points and ptrs for count * ( half - 1 )
+ * pointers.
+ */
+static int ecp_batch_precompute( const mbedtls_ecp_group *grp,
+                                 mbedtls_ecp_point *T[],
+                                 const mbedtls_ecp_point * const P[],
+                                 size_t count, size_t half,
+                                 mbedtls_ecp_point D[],
+                                 mbedtls_ecp_point *ptrs[],
+                                 mbedtls_mpi tmp[4] )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t j, k, n;
+
+    /* D[j] = 2 P[j] */
+    for( j = 0; j < count; j++ )
+    {
+        MBEDTLS_MPI_CHK( ecp_double_jac( grp, &D[j], P[j], tmp ) );
+        ptrs[j] = &D[j];
+    }
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, ptrs, count ) );
+
+    /* T[j][k] = T[j][k-1] + D[j] */
+    n = 0;
+    for( j = 0; j < count; j++ )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &T[j][0], P[j] ) );
+
+        for( k = 1; k < half; k++ )
+        {
+            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[j][k], &T[j][k-1], &D[j],
+                                            tmp ) );
+            ptrs[n++] = &T[j][k];
+        }
+    }
+    if( n > 0 )
+        MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, ptrs, n ) );
+
+    /* The opposites only differ by Y */
+    for( j = 0; j < count; j++ )
+    {
+        for( k = 0; k < half; k++ )
+        {
+            MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &T[j][half + k], &T[j][k] ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T[j][half + k].Y,
+                                                  &grp->P, &T[j][k].Y ) );
+        }
+    }
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * R = sum( k_j P_j ) for 0 <= j < count in Jacobian coordinates, from the
+ * NAF representations naf[j] of the scalars, of len[j] digits, and the
+ * tables T[j] of odd multiples of the points, of 2 half[j] entries. The
+ * multiplications share their doublings (Straus' trick).
+ *
+ * NOT constant-time
+ */
+static int ecp_muladd_wnaf( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                            const signed char * const naf[],
+                            const size_t len[],
+                            const mbedtls_ecp_point * const T[],
+                            const size_t half[], size_t count,
+                            mbedtls_mpi tmp[4] )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i = 0, j;
+
+    for( j = 0; j < count; j++ )
+    {
+        if( len[j] > i )
+            i = len[j];
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( R ) );
+
+    while( i-- > 0 )
+    {
+        if( MPI_ECP_CMP_INT( &R->Z, 0 ) != 0 )
+            MBEDTLS_MPI_CHK( ecp_double_jac( grp, R, R, tmp ) );
+
+        for( j = 0; j < count; j++ )
+        {
+            if( i < len[j] && naf[j][i] != 0 )
+                MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, R,
+                        &T[j][ecp_wnaf_index( half[j], naf[j][i] )], tmp ) );
+        }
+    }
+
+cleanup:
+    return( ret );
+}
+
+#if defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
+/*
+ * GLV method for secp256k1 (GECC 3.5): the map (x, y) -> (beta x, y), where
+ * beta is a cube root of unity mod p, is the multiplication by lambda, a cube
+ * root of unity mod N. Splitting k = k1 + k2 lambda mod N with k1 and k2 of
+ * about 128 bits, k P = k1 P + k2 (lambda P) needs only half the doublings.
+ */
+
+/* Width of the NAF representation of the half-size scalars */
+#define ECP_GLV_WNAF            5
+#define ECP_GLV_HALF            ( 1 << ( ECP_GLV_WNAF - 2 ) )
+
+/* Room for the NAF of a half-size scalar, see ecp_glv_split() */
+#define ECP_GLV_NAF_LEN         ( 128 + 2 )
+
+static const mbedtls_mpi_uint secp256k1_glv_beta[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x01, 0x95, 0x71, 0x28, 0x6C, 0x39, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x89, 0xF5, 0x12, 0x75, 0x49, 0xF0, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x34, 0x34, 0xAC, 0x9E, 0x47, 0x64, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x07, 0x7C, 0x65, 0x2B, 0x6A, 0xE9, 0x7A ),
+};
+
+/*
+ * Short basis (a1, b1), (a2, b2) of the lattice of the (x, y) such that
+ * x + y lambda = 0 mod N, with b1 < 0 and b2 = a1.
+ */
+static const mbedtls_mpi_uint secp256k1_glv_a1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xEB, 0x84, 0x92, 0xE4, 0x90, 0x6C, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x6B, 0xD4, 0xA7, 0x21, 0xD2, 0x86, 0x30 ),
+};
+static const mbedtls_mpi_uint secp256k1_glv_minus_b1[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xE4, 0xBF, 0x0A, 0xA9, 0x7F, 0x54, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x88, 0x0E, 0x01, 0xD6, 0x7E, 0x43, 0xE4 ),
+};
+static const mbedtls_mpi_uint secp256k1_glv_a2[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xCF, 0x44, 0x9D, 0x8D, 0x10, 0xC1, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xF3, 0xE2, 0xA8, 0xF7, 0x50, 0xCA, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+
+static const mbedtls_mpi ecp_glv_beta = ECP_MPI_INIT_ARRAY(
+        secp256k1_glv_beta );
+static const mbedtls_mpi ecp_glv_a1 = ECP_MPI_INIT_ARRAY(
+        secp256k1_glv_a1 );
+static const mbedtls_mpi ecp_glv_minus_b1 = ECP_MPI_INIT_ARRAY(
+        secp256k1_glv_minus_b1 );
+static const mbedtls_mpi ecp_glv_a2 = ECP_MPI_INIT_ARRAY(
+        secp256k1_glv_a2 );
+
+/*
+ * Split 0 <= k < N as k = k1 + k2 lambda mod N (GECC Algorithm 3.74):
+ *   c1 = round( b2 k / N ), c2 = round( -b1 k / N ),
+ *   k1 = k - c1 a1 - c2 a2, k2 = -c1 b1 - c2 b2.
+ * Both |k1| and |k2| are less than 2^128.
+ */
+static int ecp_glv_split( const mbedtls_ecp_group *grp,
+                          mbedtls_mpi *k1, mbedtls_mpi *k2,
+                          const mbedtls_mpi *k )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi c1, c2, t, half_n;
+
+    mbedtls_mpi_init( &c1 ); mbedtls_mpi_init( &c2 );
+    mbedtls_mpi_init( &t ); mbedtls_mpi_init( &half_n );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &half_n, &grp->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &half_n, 1 ) );
+
+    /* c1 = ( a1 k + N / 2 ) / N, c2 = ( -b1 k + N / 2 ) / N */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &ecp_glv_a1, k ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &t, &t, &half_n ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_div_mpi( &c1, NULL, &t, &grp->N ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &ecp_glv_minus_b1, k ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &t, &t, &half_n ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_div_mpi( &c2, NULL, &t, &grp->N ) );
+
+    /* k1 = k - c1 a1 - c2 a2 */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c1, &ecp_glv_a1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k1, k, &t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c2, &ecp_glv_a2 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k1, k1, &t ) );
+
+    /* k2 = c1 (-b1) - c2 a1 */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( k2, &c1, &ecp_glv_minus_b1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c2, &ecp_glv_a1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k2, k2, &t ) );
+
+    /* Cannot happen, but the NAF buffers rely on it */
+    if( mbedtls_mpi_bitlen( k1 ) > 128 || mbedtls_mpi_bitlen( k2 ) > 128 )
+        ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
+
+cleanup:
+    mbedtls_mpi_free( &c1 ); mbedtls_mpi_free( &c2 );
+    mbedtls_mpi_free( &t ); mbedtls_mpi_free( &half_n );
+
+    return( ret );
+}
+
+/*
+ * Tell if mbedtls_ecp_muladd_public_restartable() and
+ * mbedtls_ecp_muladd_batch() can use ecp_muladd_glv()
+ */
+static int ecp_glv_can_muladd( const mbedtls_ecp_group *grp,
+                               const mbedtls_ecp_restart_ctx *rs_ctx )
+{
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && ( rs_ctx->ma != NULL ||
+                            mbedtls_ecp_restart_is_enabled() ) )
+        return( 0 );
+#else
+    (void) rs_ctx;
+#endif
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( 0 );
+#endif
 
-    if( MPI_ECP_CMP( &YY, &RHS ) != 0 )
-        ret = MBEDTLS_ERR_ECP_INVALID_KEY;
+    return( grp->id == MBEDTLS_ECP_DP_SECP256K1 );
+}
 
-cleanup:
+/*
+ * Same checks on m and P as mbedtls_ecp_mul_shortcuts()
+ */
+static int ecp_glv_check( const mbedtls_ecp_group *grp,
+                          const mbedtls_mpi *m, const mbedtls_ecp_point *P )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
-    mbedtls_mpi_free( &YY ); mbedtls_mpi_free( &RHS );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
+
+    if( mbedtls_mpi_cmp_int( m, 0 ) != 0 &&
+        mbedtls_mpi_cmp_int( m, 1 ) != 0 &&
+        mbedtls_mpi_cmp_int( m, -1 ) != 0 )
+        MBEDTLS_MPI_CHK( mbedtls_ecp_check_privkey( grp, m ) );
 
+cleanup:
     return( ret );
 }
-#endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
 
-#if defined(MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED)
 /*
- * R = m * P with shortcuts for m == 0, m == 1 and m == -1
- * NOT constant-time - ONLY for short Weierstrass!
+ * R = m P + n Q on secp256k1 as k1 P + k2 (lambda P) + k3 Q + k4 (lambda Q),
+ * with tables of odd multiples of P and Q and their images by lambda.
+ *
+ * NOT constant-time
  */
-static int mbedtls_ecp_mul_shortcuts( mbedtls_ecp_group *grp,
-                                      mbedtls_ecp_point *R,
-                                      const mbedtls_mpi *m,
-                                      const mbedtls_ecp_point *P,
-                                      mbedtls_ecp_restart_ctx *rs_ctx )
+static int ecp_muladd_glv( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                           const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                           const mbedtls_mpi *n, const mbedtls_ecp_point *Q )
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    mbedtls_mpi tmp;
-    mbedtls_mpi_init( &tmp );
+    const mbedtls_mpi *k[2] = { m, n };
+    const mbedtls_ecp_point *Pk[2] = { P, Q };
+    mbedtls_ecp_point *T = NULL, *Tj[2], D[2];
+    mbedtls_ecp_point *ptrs[2 * ( ECP_GLV_HALF - 1 )];
+    mbedtls_mpi kk, s[4], tmp[4];
+    signed char naf[4][ECP_GLV_NAF_LEN];
+    const signed char *nafp[4];
+    const mbedtls_ecp_point *Tp[4];
+    size_t len[4], half[4];
+    size_t i, j;
 
-    if( mbedtls_mpi_cmp_int( m, 0 ) == 0 )
+    mbedtls_mpi_init( &kk );
+    mpi_init_many( s, sizeof( s ) / sizeof( mbedtls_mpi ) );
+    mpi_init_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+    mbedtls_ecp_point_init( &D[0] );
+    mbedtls_ecp_point_init( &D[1] );
+
+    MBEDTLS_MPI_CHK( ecp_glv_check( grp, m, P ) );
+    MBEDTLS_MPI_CHK( ecp_glv_check( grp, n, Q ) );
+
+    T = mbedtls_calloc( 4 * 2 * ECP_GLV_HALF, sizeof( mbedtls_ecp_point ) );
+    if( T == NULL )
     {
-        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
-        MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( R ) );
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
     }
-    else if( mbedtls_mpi_cmp_int( m, 1 ) == 0 )
+    for( i = 0; i < 4 * 2 * ECP_GLV_HALF; i++ )
+        mbedtls_ecp_point_init( &T[i] );
+
+    /* T[2j] holds the odd multiples of the j-th point, T[2j+1] their images */
+    Tj[0] = T;
+    Tj[1] = T + 2 * 2 * ECP_GLV_HALF;
+    MBEDTLS_MPI_CHK( ecp_batch_precompute( grp, Tj, Pk, 2, ECP_GLV_HALF,
+                                           D, ptrs, tmp ) );
+
+    for( j = 0; j < 2; j++ )
     {
-        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
-        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, P ) );
+        for( i = 0; i < 2 * ECP_GLV_HALF; i++ )
+        {
+            mbedtls_ecp_point *L = &Tj[j][2 * ECP_GLV_HALF + i];
+
+            MBEDTLS_MPI_CHK( mbedtls_ecp_copy( L, &Tj[j][i] ) );
+            MPI_ECP_MUL( &L->X, &L->X, &ecp_glv_beta );
+        }
+
+        /* k is 0, +-1 or in [1, N-1] */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &kk, k[j], &grp->N ) );
+        MBEDTLS_MPI_CHK( ecp_glv_split( grp, &s[2 * j], &s[2 * j + 1], &kk ) );
     }
-    else if( mbedtls_mpi_cmp_int( m, -1 ) == 0 )
+
+    for( j = 0; j < 4; j++ )
     {
-        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
-        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, P ) );
-        MPI_ECP_NEG( &R->Y );
+        len[j] = ecp_wnaf_recode( naf[j], &s[j], ECP_GLV_WNAF );
+        nafp[j] = naf[j];
+        Tp[j] = T + j * 2 * ECP_GLV_HALF;
+        half[j] = ECP_GLV_HALF;
     }
-    else
+
+    MBEDTLS_MPI_CHK( ecp_muladd_wnaf( grp, R, nafp, len, Tp, half, 4, tmp ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, R ) );
+
+cleanup:
+    if( T != NULL )
     {
-        MBEDTLS_MPI_CHK( ecp_mul_restartable_internal( grp, R, m, P,
-                                                       NULL, NULL, rs_ctx ) );
+        for( i = 0; i < 4 * 2 * ECP_GLV_HALF; i++ )
+            mbedtls_ecp_point_free( &T[i] );
+        mbedtls_free( T );
     }
 
-cleanup:
-    mbedtls_mpi_free( &tmp );
+    mbedtls_ecp_point_free( &D[0] );
+    mbedtls_ecp_point_free( &D[1] );
+    mbedtls_mpi_free( &kk );
+    mpi_free_many( s, sizeof( s ) / sizeof( mbedtls_mpi ) );
+    mpi_free_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
 
     return( ret );
 }
+#endif /* MBEDTLS_ECP_DP_SECP256K1_ENABLED */
 
 /*
  * Restartable linear combination
@@ -2793,13 +4646,441 @@ int mbedtls_ecp_muladd( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
 {
     return( mbedtls_ecp_muladd_restartable( grp, R, m, P, n, Q, NULL ) );
 }
+
+/*
+ * Linear combination with public scalars, for signature verification
+ * NOT constant-time, even less so than mbedtls_ecp_muladd_restartable()
+ */
+int mbedtls_ecp_muladd_public_restartable(
+             mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
+             mbedtls_ecp_restart_ctx *rs_ctx )
+{
+#if defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
+    if( ecp_glv_can_muladd( grp, rs_ctx ) )
+        return( ecp_muladd_glv( grp, R, m, P, n, Q ) );
+#endif
+
+    return( mbedtls_ecp_muladd_restartable( grp, R, m, P, n, Q, rs_ctx ) );
+}
+
+#if defined(ECP_FIXED_LIMBS)
+/* Is A zero? 0 <= A < p. NOT constant-time */
+static int ecp_fixed_is_zero( ecp_fixed_field *F, const mbedtls_mpi_uint *A )
+{
+    size_t i;
+
+    for( i = 0; i < F->limbs; i++ )
+    {
+        if( A[i] != 0 )
+            return( 0 );
+    }
+
+    return( 1 );
+}
+
+/*
+ * Addition: R = R + Q, mixed affine-Jacobian coordinates, with the special
+ * cases of ecp_add_mixed(). Q must be non-zero. R_zero tells whether R is
+ * zero on entry, and the return value whether it is zero on exit.
+ *
+ * NOT constant-time
+ */
+static int ecp_fixed_add_mixed_vartime( ecp_fixed_field *F,
+                                        ecp_fixed_point *R, int R_zero,
+                                        const ecp_fixed_point *Q )
+{
+    mbedtls_mpi_uint t0[ECP_FIXED_MAX_LIMBS], t1[ECP_FIXED_MAX_LIMBS];
+
+    if( R_zero )
+    {
+        *R = *Q;
+        return( 0 );
+    }
+
+#if defined(MBEDTLS_SELF_TEST)
+    add_count++;
+#endif
+
+    ecp_fixed_add_mixed_start( F, t0, t1, R, Q );
+
+    if( ecp_fixed_is_zero( F, t0 ) )
+    {
+        /* R == Q: double, R == -Q: zero */
+        if( !ecp_fixed_is_zero( F, t1 ) )
+            return( 1 );
+
+        ecp_fixed_double_jac( F, R, R );
+        return( 0 );
+    }
+
+    ecp_fixed_add_mixed_end( F, R, R, t0, t1 );
+    return( 0 );
+}
+
+/*
+ * Same as ecp_batch_precompute() for the fixed-size code. T[j][0] must hold
+ * the affine point P[j] on entry; c is scratch space for as many field
+ * elements as ptrs has room for.
+ */
+static void ecp_fixed_batch_precompute( ecp_fixed_field *F,
+                                        ecp_fixed_point *T[],
+                                        size_t count, size_t half,
+                                        ecp_fixed_point D[],
+                                        ecp_fixed_point *ptrs[],
+                                        mbedtls_mpi_uint (*c)[ECP_FIXED_MAX_LIMBS] )
+{
+    size_t j, k, n;
+
+    /* D[j] = 2 P[j] */
+    for( j = 0; j < count; j++ )
+    {
+        ecp_fixed_double_jac( F, &D[j], &T[j][0] );
+        ptrs[j] = &D[j];
+    }
+    ecp_fixed_normalize_many( F, ptrs, count, c );
+
+    /* T[j][k] = T[j][k-1] + D[j], which is never a special case since the
+     * order of the group is a large prime */
+    n = 0;
+    for( j = 0; j < count; j++ )
+    {
+        for( k = 1; k < half; k++ )
+        {
+            ecp_fixed_add_mixed( F, &T[j][k], &T[j][k-1], &D[j] );
+            ptrs[n++] = &T[j][k];
+        }
+    }
+    if( n > 0 )
+        ecp_fixed_normalize_many( F, ptrs, n, c );
+
+    for( j = 0; j < count; j++ )
+    {
+        for( k = 0; k < half; k++ )
+        {
+            T[j][half + k] = T[j][k];
+            ecp_fixed_cond_neg( F, T[j][half + k].Y, 1 );
+        }
+    }
+}
+
+/*
+ * Same as ecp_muladd_wnaf() for the fixed-size code. Returns 1 if the
+ * result is zero, in which case R is left undefined.
+ *
+ * NOT constant-time
+ */
+static int ecp_fixed_muladd_wnaf( ecp_fixed_field *F, ecp_fixed_point *R,
+                                  const signed char nafG[], size_t lenG,
+                                  const ecp_fixed_point TG[], size_t halfG,
+                                  const signed char nafQ[], size_t lenQ,
+                                  const ecp_fixed_point TQ[], size_t halfQ )
+{
+    size_t i = lenG > lenQ ? lenG : lenQ;
+    int zero = 1;
+
+    while( i-- > 0 )
+    {
+        if( !zero )
+            ecp_fixed_double_jac( F, R, R );
+
+        if( i < lenG && nafG[i] != 0 )
+            zero = ecp_fixed_add_mixed_vartime( F, R, zero,
+                                &TG[ecp_wnaf_index( halfG, nafG[i] )] );
+
+        if( i < lenQ && nafQ[i] != 0 )
+            zero = ecp_fixed_add_mixed_vartime( F, R, zero,
+                                &TQ[ecp_wnaf_index( halfQ, nafQ[i] )] );
+    }
+
+    return( zero );
+}
+
+/*
+ * mbedtls_ecp_muladd_batch() with the fixed-size code, for the groups
+ * accepted by ecp_fixed_can_mul(). The inputs have already been checked.
+ */
+static int ecp_muladd_batch_fixed( const mbedtls_ecp_group *grp,
+                                   mbedtls_ecp_point R[],
+                                   const mbedtls_mpi m[],
+                                   const mbedtls_mpi n[],
+                                   const mbedtls_ecp_point * const Q[],
+                                   size_t count )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const size_t halfG = (size_t) 1 << ( ECP_BATCH_WNAF_G - 2 );
+    const size_t halfQ = (size_t) 1 << ( ECP_BATCH_WNAF_Q - 2 );
+    const size_t ptrs_size = ECP_BATCH_CHUNK * ( halfQ - 1 ) > halfG - 1 ?
+                             ECP_BATCH_CHUNK * ( halfQ - 1 ) : halfG - 1;
+    const size_t TQ_size = ECP_BATCH_CHUNK * 2 * halfQ;
+    ecp_fixed_field F;
+    ecp_fixed_point *TG = NULL, *TQ = NULL, *D = NULL, *S = NULL;
+    ecp_fixed_point **ptrs = NULL;
+    ecp_fixed_point *Tp[ECP_BATCH_CHUNK];
+    mbedtls_mpi_uint (*c)[ECP_FIXED_MAX_LIMBS] = NULL;
+    signed char *nafG = NULL, *nafQ = NULL;
+    int zero[ECP_BATCH_CHUNK];
+    size_t lenG, lenQ, i, j, k, chunk;
+
+    TG = mbedtls_calloc( 2 * halfG, sizeof( ecp_fixed_point ) );
+    TQ = mbedtls_calloc( TQ_size, sizeof( ecp_fixed_point ) );
+    D = mbedtls_calloc( ECP_BATCH_CHUNK, sizeof( ecp_fixed_point ) );
+    S = mbedtls_calloc( ECP_BATCH_CHUNK, sizeof( ecp_fixed_point ) );
+    ptrs = mbedtls_calloc( ptrs_size, sizeof( ecp_fixed_point * ) );
+    c = mbedtls_calloc( ptrs_size, sizeof( *c ) );
+    nafG = mbedtls_calloc( 1, grp->nbits + 1 );
+    nafQ = mbedtls_calloc( 1, grp->nbits + 1 );
+    if( TG == NULL || TQ == NULL || D == NULL || S == NULL ||
+        ptrs == NULL || c == NULL || nafG == NULL || nafQ == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    ecp_fixed_field_init( grp, &F );
+
+    ecp_fixed_from_mpi( &F, TG[0].X, &grp->G.X );
+    ecp_fixed_from_mpi( &F, TG[0].Y, &grp->G.Y );
+    memcpy( TG[0].Z, F.one, F.limbs * ciL );
+
+    Tp[0] = TG;
+    ecp_fixed_batch_precompute( &F, Tp, 1, halfG, D, ptrs, c );
+
+    for( i = 0; i < count; i += chunk )
+    {
+        chunk = count - i < ECP_BATCH_CHUNK ? count - i : ECP_BATCH_CHUNK;
+
+        for( j = 0; j < chunk; j++ )
+        {
+            Tp[j] = TQ + j * 2 * halfQ;
+            ecp_fixed_from_mpi( &F, Tp[j][0].X, &Q[i + j]->X );
+            ecp_fixed_from_mpi( &F, Tp[j][0].Y, &Q[i + j]->Y );
+            memcpy( Tp[j][0].Z, F.one, F.limbs * ciL );
+        }
+
+        ecp_fixed_batch_precompute( &F, Tp, chunk, halfQ, D, ptrs, c );
+
+        for( j = 0; j < chunk; j++ )
+        {
+            lenG = ecp_wnaf_recode( nafG, &m[i + j], ECP_BATCH_WNAF_G );
+            lenQ = ecp_wnaf_recode( nafQ, &n[i + j], ECP_BATCH_WNAF_Q );
+
+            zero[j] = ecp_fixed_muladd_wnaf( &F, &S[j],
+                                             nafG, lenG, TG, halfG,
+                                             nafQ, lenQ, Tp[j], halfQ );
+        }
+
+        /* Normalize the non-zero results together */
+        k = 0;
+        for( j = 0; j < chunk; j++ )
+        {
+            if( !zero[j] )
+                ptrs[k++] = &S[j];
+        }
+        if( k > 0 )
+            ecp_fixed_normalize_many( &F, ptrs, k, c );
+
+        for( j = 0; j < chunk; j++ )
+        {
+            if( zero[j] )
+            {
+                MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( &R[i + j] ) );
+                continue;
+            }
+
+            MBEDTLS_MPI_CHK( ecp_fixed_to_mpi( &F, &R[i + j].X, S[j].X ) );
+            MBEDTLS_MPI_CHK( ecp_fixed_to_mpi( &F, &R[i + j].Y, S[j].Y ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R[i + j].Z, 1 ) );
+        }
+    }
+
+cleanup:
+    mbedtls_free( TG );
+    mbedtls_free( TQ );
+    mbedtls_free( D );
+    mbedtls_free( S );
+    mbedtls_free( ptrs );
+    mbedtls_free( c );
+    mbedtls_free( nafG );
+    mbedtls_free( nafQ );
+
+    return( ret );
+}
+#endif /* ECP_FIXED_LIMBS */
+
+/*
+ * Batch linear combination with the generator
+ * NOT constant-time
+ */
+int mbedtls_ecp_muladd_batch( mbedtls_ecp_group *grp,
+                              mbedtls_ecp_point R[],
+                              const mbedtls_mpi m[],
+                              const mbedtls_mpi n[],
+                              const mbedtls_ecp_point * const Q[],
+                              size_t count )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const size_t halfG = (size_t) 1 << ( ECP_BATCH_WNAF_G - 2 );
+    const size_t halfQ = (size_t) 1 << ( ECP_BATCH_WNAF_Q - 2 );
+    const size_t ptrs_size = ECP_BATCH_CHUNK * ( halfQ - 1 ) > halfG - 1 ?
+                             ECP_BATCH_CHUNK * ( halfQ - 1 ) : halfG - 1;
+    const size_t TQ_size = ECP_BATCH_CHUNK * 2 * halfQ;
+    const mbedtls_ecp_point *G = &grp->G;
+    mbedtls_ecp_point *TG = NULL, *TQ = NULL, *D = NULL;
+    mbedtls_ecp_point **ptrs = NULL;
+    mbedtls_ecp_point *Tp[ECP_BATCH_CHUNK];
+    signed char *nafG = NULL, *nafQ = NULL;
+    const signed char *naf[2];
+    const mbedtls_ecp_point *T[2];
+    size_t len[2], half[2] = { halfG, halfQ };
+    size_t i, j, k, chunk;
+    mbedtls_mpi tmp[4];
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    char is_grp_capable = 0;
+#endif
+
+    if( mbedtls_ecp_get_type( grp ) != MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
+        return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+
+    if( count == 0 )
+        return( 0 );
+
+    mpi_init_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+
+    for( i = 0; i < count; i++ )
+    {
+        if( mbedtls_mpi_cmp_int( &m[i], 0 ) < 0 ||
+            mbedtls_mpi_cmp_mpi( &m[i], &grp->N ) >= 0 ||
+            mbedtls_mpi_cmp_int( &n[i], 0 ) < 0 ||
+            mbedtls_mpi_cmp_mpi( &n[i], &grp->N ) >= 0 )
+        {
+            ret = MBEDTLS_ERR_ECP_INVALID_KEY;
+            goto cleanup;
+        }
+
+        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, Q[i] ) );
+    }
+
+#if defined(ECP_FIXED_LIMBS)
+    if( ecp_fixed_can_mul( grp, NULL ) )
+    {
+        ret = ecp_muladd_batch_fixed( grp, R, m, n, Q, count );
+        goto cleanup;
+    }
+#endif
+
+#if defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
+    /* Halving the doublings beats sharing the table of G */
+    if( ecp_glv_can_muladd( grp, NULL ) )
+    {
+        for( i = 0; i < count; i++ )
+            MBEDTLS_MPI_CHK( ecp_muladd_glv( grp, &R[i], &m[i], G,
+                                             &n[i], Q[i] ) );
+        goto cleanup;
+    }
+#endif
+
+    TG = mbedtls_calloc( 2 * halfG, sizeof( mbedtls_ecp_point ) );
+    TQ = mbedtls_calloc( TQ_size, sizeof( mbedtls_ecp_point ) );
+    D = mbedtls_calloc( ECP_BATCH_CHUNK, sizeof( mbedtls_ecp_point ) );
+    ptrs = mbedtls_calloc( ptrs_size, sizeof( mbedtls_ecp_point * ) );
+    nafG = mbedtls_calloc( 1, grp->nbits + 1 );
+    nafQ = mbedtls_calloc( 1, grp->nbits + 1 );
+    if( TG == NULL || TQ == NULL || D == NULL || ptrs == NULL ||
+        nafG == NULL || nafQ == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    for( k = 0; k < 2 * halfG; k++ )
+        mbedtls_ecp_point_init( &TG[k] );
+    for( k = 0; k < TQ_size; k++ )
+        mbedtls_ecp_point_init( &TQ[k] );
+    for( k = 0; k < ECP_BATCH_CHUNK; k++ )
+        mbedtls_ecp_point_init( &D[k] );
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp ) ) )
+        MBEDTLS_MPI_CHK( mbedtls_internal_ecp_init( grp ) );
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+
+    Tp[0] = TG;
+    MBEDTLS_MPI_CHK( ecp_batch_precompute( grp, Tp, &G, 1, halfG,
+                                           D, ptrs, tmp ) );
+
+    naf[0] = nafG;
+    naf[1] = nafQ;
+    T[0] = TG;
+
+    for( i = 0; i < count; i += chunk )
+    {
+        chunk = count - i < ECP_BATCH_CHUNK ? count - i : ECP_BATCH_CHUNK;
+
+        for( j = 0; j < chunk; j++ )
+            Tp[j] = TQ + j * 2 * halfQ;
+
+        MBEDTLS_MPI_CHK( ecp_batch_precompute( grp, Tp, Q + i, chunk, halfQ,
+                                               D, ptrs, tmp ) );
+
+        for( j = 0; j < chunk; j++ )
+        {
+            len[0] = ecp_wnaf_recode( nafG, &m[i + j], ECP_BATCH_WNAF_G );
+            len[1] = ecp_wnaf_recode( nafQ, &n[i + j], ECP_BATCH_WNAF_Q );
+            T[1] = Tp[j];
+
+            MBEDTLS_MPI_CHK( ecp_muladd_wnaf( grp, &R[i + j], naf, len,
+                                              T, half, 2, tmp ) );
+        }
+
+        /* Normalize the non-zero results together */
+        k = 0;
+        for( j = 0; j < chunk; j++ )
+        {
+            if( MPI_ECP_CMP_INT( &R[i + j].Z, 0 ) != 0 )
+                ptrs[k++] = &R[i + j];
+        }
+        if( k > 0 )
+            MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, ptrs, k ) );
+    }
+
+cleanup:
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( is_grp_capable )
+        mbedtls_internal_ecp_free( grp );
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+
+    if( TG != NULL )
+    {
+        for( k = 0; k < 2 * halfG; k++ )
+            mbedtls_ecp_point_free( &TG[k] );
+        mbedtls_free( TG );
+    }
+    if( TQ != NULL )
+    {
+        for( k = 0; k < TQ_size; k++ )
+            mbedtls_ecp_point_free( &TQ[k] );
+        mbedtls_free( TQ );
+    }
+    if( D != NULL )
+    {
+        for( k = 0; k < ECP_BATCH_CHUNK; k++ )
+            mbedtls_ecp_point_free( &D[k] );
+        mbedtls_free( D );
+    }
+    mbedtls_free( ptrs );
+    mbedtls_free( nafG );
+    mbedtls_free( nafQ );
+    mpi_free_many( tmp, sizeof( tmp ) / sizeof( mbedtls_mpi ) );
+
+    return( ret );
+}
 #endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
 
 #if defined(MBEDTLS_ECP_MONTGOMERY_ENABLED)
 #if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
-#define ECP_MPI_INIT(s, n, p) {s, (n), (mbedtls_mpi_uint *)(p)}
-#define ECP_MPI_INIT_ARRAY(x)   \
-    ECP_MPI_INIT(1, sizeof(x) / sizeof(mbedtls_mpi_uint), x)
 /*
  * Constants for the two points other than 0, 1, -1 (mod p) in
  * https://cr.yp.to/ecdh.html#validate
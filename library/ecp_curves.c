@@ -104,7 +104,8 @@ static const mbedtls_mpi_uint secp192r1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xF8, 0xDE, 0x99, 0xFF, 0xFF, 0xFF, 0xFF ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint secp192r1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x10, 0xFF, 0x82, 0xFD, 0x0A, 0xFF, 0xF4 ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x88, 0xA1, 0x43, 0xEB, 0x20, 0xBF, 0x7C ),
@@ -283,6 +284,361 @@ static const mbedtls_ecp_point secp192r1_T[16] = {
     ECP_POINT_INIT_XY_Z0(secp192r1_T_14_X, secp192r1_T_14_Y),
     ECP_POINT_INIT_XY_Z0(secp192r1_T_15_X, secp192r1_T_15_Y),
 };
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp192r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x10, 0xFF, 0x82, 0xFD, 0x0A, 0xFF, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x88, 0xA1, 0x43, 0xEB, 0x20, 0xBF, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x90, 0x30, 0xB0, 0x0E, 0xA8, 0x8D, 0x18 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x48, 0x79, 0x1E, 0xA1, 0x77, 0xF9, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xCD, 0x24, 0x6B, 0xED, 0x11, 0x10, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xDA, 0xC8, 0xFF, 0x95, 0x2B, 0x19, 0x07 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xF0, 0x2A, 0x88, 0xC9, 0x32, 0x48, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x44, 0x35, 0xEF, 0x7F, 0xBC, 0x95, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xF1, 0x02, 0x74, 0x96, 0x1A, 0x57, 0xF1 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x29, 0xA2, 0x4B, 0x99, 0xA8, 0x09, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xDF, 0x97, 0x73, 0x3E, 0xEA, 0xD3, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x7B, 0x90, 0x49, 0xCD, 0xA1, 0x1C, 0x0D ),
+};
+static const mbedtls_mpi_uint secp192r1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xAC, 0x9F, 0x22, 0x09, 0xB9, 0xB0, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x1A, 0xA2, 0xA3, 0x5B, 0x47, 0xA8, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x76, 0x4C, 0xE0, 0xE6, 0xCD, 0xB0, 0xBD ),
+};
+static const mbedtls_mpi_uint secp192r1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xCE, 0x6F, 0x07, 0xF3, 0xAB, 0x5A, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x8E, 0xC5, 0x3F, 0x57, 0x39, 0x84, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xA1, 0xDD, 0xB9, 0x55, 0xCC, 0x21, 0x7A ),
+};
+static const mbedtls_mpi_uint secp192r1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xE2, 0xA9, 0x5F, 0xA3, 0x2A, 0xDD, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xEA, 0x4E, 0x85, 0xFC, 0xDB, 0x28, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xBB, 0xE0, 0x4A, 0xEC, 0x7A, 0x8B, 0x8F ),
+};
+static const mbedtls_mpi_uint secp192r1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x03, 0xCB, 0xB6, 0x88, 0x93, 0xBE, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x59, 0xE7, 0x31, 0x7D, 0x08, 0x94, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x7D, 0xB2, 0x6D, 0x67, 0x34, 0x67, 0xC8 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x33, 0xF4, 0xD4, 0x2D, 0x5A, 0xB1, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0xC3, 0x92, 0xF2, 0xA7, 0xEE, 0x57, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0xDC, 0xF8, 0xD0, 0x91, 0x06, 0x73, 0x0C ),
+};
+static const mbedtls_mpi_uint secp192r1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x5E, 0xF4, 0xBB, 0x90, 0x78, 0x79, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x87, 0xDE, 0xE9, 0x83, 0x9E, 0x8A, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xDE, 0x54, 0x93, 0x31, 0x4C, 0xB2, 0x31 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xD8, 0xAE, 0x37, 0xAF, 0x34, 0xD8, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xEF, 0xB4, 0x8B, 0xB1, 0x59, 0xE2, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xF2, 0xA2, 0xA2, 0xE0, 0xAB, 0x0E, 0x48 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x95, 0xB4, 0x9A, 0xE3, 0x37, 0xC3, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x7C, 0x1A, 0x67, 0x9B, 0xDC, 0xCD, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x2E, 0xB3, 0x79, 0x84, 0x7B, 0x15, 0xC2 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xCC, 0x25, 0x3B, 0xCB, 0x11, 0xCC, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0xEC, 0xCC, 0xBE, 0xD1, 0x43, 0x24, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x89, 0x09, 0xB3, 0x81, 0xB4, 0x83, 0x72 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xFF, 0xE9, 0xDC, 0xBB, 0x45, 0xF5, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xBC, 0x73, 0x68, 0x89, 0x20, 0xFD, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x6B, 0x2F, 0x63, 0x70, 0xE1, 0xEE, 0x0E ),
+};
+static const mbedtls_mpi_uint secp192r1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x21, 0x1E, 0x85, 0x49, 0x0B, 0x98, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xEC, 0x50, 0x96, 0xF1, 0xA3, 0xD0, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xD3, 0x8D, 0x80, 0xE9, 0xBE, 0x74, 0x3B ),
+};
+static const mbedtls_mpi_uint secp192r1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x7C, 0xCB, 0x14, 0x41, 0xA5, 0x00, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xAE, 0x59, 0xE1, 0xB2, 0x56, 0x42, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x20, 0x1F, 0x10, 0x3D, 0x4F, 0xAD, 0xE4 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xD9, 0xA9, 0x69, 0x79, 0x1B, 0xC0, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x0F, 0xFB, 0x1F, 0x9C, 0x55, 0x22, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x35, 0xEA, 0x0F, 0xAE, 0x3A, 0x2B, 0x22 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x43, 0xB8, 0x71, 0xE7, 0xE4, 0xB9, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x7F, 0x9F, 0x71, 0x03, 0x7D, 0x00, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x10, 0xBA, 0x7E, 0x0A, 0x10, 0xB5, 0x02 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x60, 0xD1, 0xE3, 0xB1, 0xC9, 0x6C, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x8F, 0x85, 0x66, 0xD3, 0x6F, 0x6B, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x72, 0xEB, 0x44, 0x94, 0x32, 0xCD, 0xE1 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x66, 0x9C, 0x5D, 0x28, 0x0A, 0x7F, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x1D, 0xF6, 0x07, 0x28, 0xD6, 0x23, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x1D, 0x28, 0xA0, 0xAC, 0xB3, 0x87, 0x40 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xDF, 0xCE, 0xD6, 0x9A, 0x75, 0x3E, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xBD, 0x5E, 0xFE, 0x6C, 0xB6, 0x29, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xDC, 0x8F, 0x59, 0xCC, 0x52, 0x4B, 0xC2 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x42, 0x15, 0x88, 0xD8, 0xDC, 0x33, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xE7, 0x57, 0x58, 0xED, 0xF9, 0x8B, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xDF, 0xF8, 0xF2, 0xA7, 0x6C, 0xF1, 0x6F ),
+};
+static const mbedtls_mpi_uint secp192r1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x27, 0xB3, 0x30, 0x33, 0xF6, 0x40, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xDC, 0x8F, 0xEB, 0x1C, 0x1C, 0x9A, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x1B, 0xCD, 0x12, 0x76, 0x31, 0x51, 0x33 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x22, 0x11, 0x02, 0x55, 0xA0, 0x77, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x58, 0x99, 0xEF, 0x5F, 0xBD, 0x1A, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x10, 0x2C, 0xCD, 0xB9, 0xAB, 0x6B, 0x32 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x32, 0xD9, 0xA5, 0x81, 0x79, 0x18, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x9B, 0xCA, 0x4C, 0xC6, 0x0B, 0x95, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x2B, 0x4F, 0xE1, 0x07, 0x6D, 0xF8, 0x07 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xCE, 0x1D, 0x2E, 0x9D, 0xB7, 0x77, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x81, 0x3E, 0xD0, 0xCF, 0x3A, 0xA3, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x57, 0x66, 0x57, 0x87, 0xD4, 0xAE, 0x16 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x23, 0xEC, 0x7C, 0xAA, 0x66, 0xF0, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x12, 0xE7, 0xB9, 0x1A, 0x9E, 0x9E, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x93, 0x63, 0x0D, 0xA7, 0x37, 0xF9, 0x37 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x89, 0x60, 0x70, 0x0C, 0xE2, 0x46, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xC9, 0x17, 0x50, 0xE6, 0xC1, 0xFE, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xD0, 0xFC, 0xE6, 0x33, 0xD4, 0x02, 0x06 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xD4, 0x96, 0x3A, 0xE9, 0x3B, 0x76, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xC4, 0x8D, 0x00, 0xCD, 0x82, 0xEE, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xD2, 0x37, 0x00, 0x35, 0x9C, 0xBB, 0xE4 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x77, 0x01, 0x26, 0x36, 0x99, 0xA2, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xA7, 0xCB, 0xEC, 0x10, 0xA0, 0xE4, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x07, 0xF6, 0xAC, 0x93, 0xE4, 0x6E, 0x16 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x00, 0xD7, 0x4A, 0x95, 0x62, 0x16, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x90, 0xA4, 0x59, 0x7F, 0xF6, 0xB6, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xE9, 0xD8, 0xB2, 0xF5, 0x2C, 0x0F, 0x0A ),
+};
+static const mbedtls_mpi_uint secp192r1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x74, 0xC4, 0xF7, 0xD7, 0xB2, 0x9E, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x6F, 0xC1, 0xD3, 0x87, 0xA3, 0x3C, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x03, 0x64, 0x43, 0x8C, 0x82, 0x45, 0x8B ),
+};
+static const mbedtls_mpi_uint secp192r1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x0A, 0x9B, 0xCC, 0x62, 0x2E, 0x12, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xAA, 0xBA, 0x2B, 0x98, 0x53, 0xAF, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xB9, 0x92, 0x94, 0xCF, 0x33, 0x7D, 0x51 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x66, 0xED, 0x9D, 0x3D, 0xFD, 0xE2, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xDD, 0xE4, 0x3D, 0x2E, 0x89, 0xCA, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x2B, 0x32, 0x2B, 0xBF, 0x43, 0x2C, 0xEB ),
+};
+static const mbedtls_mpi_uint secp192r1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xC9, 0x72, 0x2E, 0xF6, 0x5C, 0xF0, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xDC, 0x5B, 0x12, 0xE1, 0xC2, 0xF6, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x1A, 0x50, 0x11, 0x6A, 0xF2, 0xA7, 0x0F ),
+};
+static const mbedtls_mpi_uint secp192r1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x6D, 0x98, 0xBB, 0x58, 0x86, 0x4C, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x62, 0xBD, 0x43, 0x5C, 0xCA, 0x81, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x8A, 0xA0, 0x51, 0x46, 0xB5, 0x40, 0x46 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xD3, 0x31, 0xE6, 0x24, 0x59, 0xC9, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xB7, 0x0D, 0xC3, 0xFB, 0xB8, 0x8F, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x06, 0x12, 0x46, 0x91, 0x01, 0x60, 0xD4 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xE8, 0xD4, 0x5A, 0x91, 0xD1, 0xE6, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x3D, 0x87, 0x7D, 0xF1, 0x30, 0x13, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x15, 0x2C, 0xA5, 0x29, 0x07, 0xCC, 0x23 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x28, 0x3C, 0xB2, 0xD6, 0x38, 0x4A, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x8B, 0x4C, 0x95, 0x9A, 0xA7, 0x68, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xDD, 0xC4, 0xA4, 0xF6, 0x16, 0x0D, 0x75 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x54, 0xD3, 0x7C, 0xAD, 0x19, 0x2D, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xF3, 0xF6, 0x65, 0xE3, 0xE4, 0xD8, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xBF, 0x56, 0xCF, 0x3A, 0xB3, 0x78, 0x7F ),
+};
+static const mbedtls_mpi_uint secp192r1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x6F, 0xCD, 0xE8, 0xC9, 0xB3, 0xC7, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x02, 0x8A, 0xE2, 0xCE, 0x93, 0xED, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x17, 0xEF, 0xCC, 0x1F, 0x46, 0x39, 0x9D ),
+};
+static const mbedtls_mpi_uint secp192r1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x40, 0x2F, 0xEB, 0x79, 0x73, 0x91, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x83, 0xEC, 0xC5, 0x9E, 0xE8, 0x3D, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xB4, 0x25, 0xA4, 0x61, 0xD4, 0x8D, 0xE4 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x5B, 0xAB, 0xA7, 0xFE, 0x08, 0x24, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x5D, 0xE8, 0xC9, 0x39, 0xFD, 0xD1, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x0A, 0x2A, 0x60, 0xED, 0x4A, 0xA3, 0x8A ),
+};
+static const mbedtls_mpi_uint secp192r1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x39, 0xAC, 0xD1, 0xD2, 0xF9, 0x8F, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xC6, 0x5B, 0x53, 0x3C, 0xC3, 0x0B, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x79, 0x85, 0xF7, 0xF4, 0x0C, 0x61, 0xE7 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x4C, 0x2B, 0xC3, 0x84, 0x3F, 0xA9, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x00, 0x58, 0x6F, 0xAF, 0xB2, 0x58, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x90, 0xD9, 0x66, 0x0F, 0xC6, 0x92, 0xA3 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x81, 0x42, 0x03, 0xEC, 0x37, 0x68, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x9E, 0x55, 0x61, 0x10, 0xD5, 0x27, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xF2, 0x72, 0x08, 0xC9, 0x30, 0xF7, 0x48 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xE5, 0xA2, 0x1E, 0x70, 0x08, 0xEC, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x1A, 0xAD, 0x27, 0x39, 0xEB, 0x29, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x81, 0xCC, 0x59, 0x09, 0xB4, 0xE8, 0xF2 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x36, 0xE4, 0xBE, 0xC4, 0xA4, 0xE5, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x39, 0x17, 0x0E, 0xA7, 0xC7, 0x16, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x89, 0x4B, 0xF3, 0x28, 0x1C, 0xAF, 0x93 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xF4, 0x36, 0xCE, 0x03, 0x41, 0x76, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xD7, 0x7D, 0x5E, 0x2C, 0x8F, 0xE1, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xD5, 0x51, 0xC0, 0xD9, 0x59, 0x45, 0x43 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xED, 0x52, 0xD6, 0x2C, 0x41, 0x7C, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xD5, 0x80, 0xDE, 0xD5, 0x5D, 0x48, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xD0, 0x8E, 0x10, 0x0E, 0x24, 0x96, 0x56 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x1A, 0xBA, 0xD7, 0x80, 0xAE, 0xA7, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x4D, 0x4B, 0x0D, 0xA7, 0xF4, 0x34, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x1D, 0x1A, 0xE7, 0xD5, 0xF9, 0x20, 0xF8 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xA1, 0xD5, 0xB1, 0x57, 0xCC, 0x1D, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x81, 0x9B, 0xC8, 0xE4, 0xD0, 0x16, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x42, 0x8C, 0x49, 0x76, 0x47, 0x24, 0xEE ),
+};
+static const mbedtls_mpi_uint secp192r1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x54, 0xFA, 0x6A, 0x19, 0x2B, 0xA8, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xE3, 0xD2, 0xC2, 0xC8, 0xC2, 0x22, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x70, 0x20, 0xA5, 0x29, 0x1D, 0xBF, 0xEE ),
+};
+static const mbedtls_mpi_uint secp192r1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x7F, 0xBA, 0x66, 0x36, 0xC0, 0xA5, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x51, 0x49, 0x1E, 0x7C, 0x2B, 0xE4, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x29, 0xE0, 0x27, 0xD1, 0x8E, 0xB8, 0xD6 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xE7, 0x6A, 0xB3, 0xD2, 0x78, 0xAE, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x90, 0x9C, 0xB1, 0x77, 0x4E, 0x38, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xAA, 0x19, 0x04, 0x4E, 0x08, 0x78, 0xEA ),
+};
+static const mbedtls_mpi_uint secp192r1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xB9, 0x22, 0x8D, 0xC0, 0xF1, 0x9C, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x6C, 0x9D, 0xB3, 0x71, 0x8F, 0x4D, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x70, 0x50, 0x7A, 0x4E, 0x5D, 0x61, 0x11 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xAA, 0xF6, 0x82, 0x25, 0xD6, 0xC7, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xB5, 0x11, 0x7C, 0xBF, 0xA8, 0x62, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x0C, 0x82, 0x22, 0x83, 0x97, 0x49, 0x87 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x53, 0x43, 0x06, 0xDC, 0x77, 0xAD, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x92, 0xAB, 0xD1, 0x6F, 0x66, 0xC4, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x44, 0x8F, 0x4B, 0x4C, 0x03, 0x3E, 0xA5 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xD3, 0x82, 0x2B, 0xC6, 0x1E, 0xC3, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x8C, 0x1F, 0xE1, 0xA5, 0x7C, 0x4E, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xAC, 0xF8, 0x1D, 0xAE, 0xE4, 0xDA, 0x73 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x54, 0xDE, 0x13, 0x96, 0x04, 0xDB, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x73, 0xAD, 0x24, 0x7B, 0xCB, 0x4F, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xEF, 0x78, 0x4C, 0x4E, 0x8C, 0x64, 0x84 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x17, 0xF0, 0x1B, 0xC0, 0x10, 0xCB, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x36, 0x06, 0x65, 0x26, 0x87, 0x2C, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x40, 0x1C, 0xDA, 0x59, 0x72, 0xEC, 0x68 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xB9, 0x88, 0x01, 0xE8, 0x0A, 0x5B, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xCC, 0x7E, 0xA9, 0x68, 0xCC, 0xC7, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x59, 0x76, 0x9C, 0xC3, 0x6F, 0x5E, 0x74 ),
+};
+static const mbedtls_mpi_uint secp192r1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xC9, 0xA7, 0x94, 0x9B, 0x72, 0xCD, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x5B, 0x10, 0x53, 0x82, 0x3E, 0xE9, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x07, 0xEB, 0x99, 0x89, 0xA3, 0x82, 0x7F ),
+};
+static const mbedtls_mpi_uint secp192r1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x23, 0x78, 0xD1, 0xF6, 0x8B, 0x3A, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xCA, 0xF9, 0x11, 0x10, 0x0B, 0x8A, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xA1, 0xF8, 0x47, 0xBC, 0xC0, 0x1A, 0xA0 ),
+};
+static const mbedtls_ecp_point secp192r1_T[32] = {
+    ECP_POINT_INIT_XY_Z1(secp192r1_T_0_X, secp192r1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_1_X, secp192r1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_2_X, secp192r1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_3_X, secp192r1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_4_X, secp192r1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_5_X, secp192r1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_6_X, secp192r1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_7_X, secp192r1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_8_X, secp192r1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_9_X, secp192r1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_10_X, secp192r1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_11_X, secp192r1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_12_X, secp192r1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_13_X, secp192r1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_14_X, secp192r1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_15_X, secp192r1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_16_X, secp192r1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_17_X, secp192r1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_18_X, secp192r1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_19_X, secp192r1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_20_X, secp192r1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_21_X, secp192r1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_22_X, secp192r1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_23_X, secp192r1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_24_X, secp192r1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_25_X, secp192r1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_26_X, secp192r1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_27_X, secp192r1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_28_X, secp192r1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_29_X, secp192r1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_30_X, secp192r1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(secp192r1_T_31_X, secp192r1_T_31_Y),
+};
 #else
 #define secp192r1_T NULL
 #endif
@@ -322,7 +678,8 @@ static const mbedtls_mpi_uint secp224r1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
     MBEDTLS_BYTES_TO_T_UINT_4( 0xFF, 0xFF, 0xFF, 0xFF ),
 };
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint secp224r1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x1D, 0x5C, 0x11, 0xD6, 0x80, 0x32, 0x34 ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x11, 0xC2, 0x56, 0xD3, 0xC1, 0x03, 0x4A ),
@@ -533,6 +890,425 @@ static const mbedtls_ecp_point secp224r1_T[16] = {
     ECP_POINT_INIT_XY_Z0(secp224r1_T_14_X, secp224r1_T_14_Y),
     ECP_POINT_INIT_XY_Z0(secp224r1_T_15_X, secp224r1_T_15_Y),
 };
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp224r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x1D, 0x5C, 0x11, 0xD6, 0x80, 0x32, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x11, 0xC2, 0x56, 0xD3, 0xC1, 0x03, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x90, 0x13, 0x32, 0x7F, 0xBF, 0xB4, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x0C, 0x0E, 0xB7, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x7E, 0x00, 0x85, 0x99, 0x81, 0xD5, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x47, 0x07, 0x5A, 0xA0, 0x75, 0x43, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xDF, 0x22, 0x4C, 0xFB, 0x23, 0xF7, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x63, 0x37, 0xBD, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x67, 0xE2, 0x08, 0xC5, 0x81, 0x97, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x3A, 0xAE, 0xE6, 0xF5, 0xE2, 0xAA, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xF6, 0xCB, 0x78, 0x90, 0xA7, 0x32, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xBA, 0xDA, 0xE6, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xB2, 0x3F, 0xCC, 0xA2, 0xC9, 0x61, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x1F, 0xCB, 0x2F, 0x34, 0x23, 0xB7, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xE0, 0xEB, 0x82, 0x46, 0xE3, 0x33, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x7B, 0x80, 0xE8, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x8A, 0x0C, 0xF0, 0xA8, 0x5F, 0x91, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x88, 0x17, 0x90, 0xC2, 0xB9, 0x07, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x06, 0xCF, 0x7A, 0xC3, 0x40, 0x4F, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xDC, 0x6C, 0xCB, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x35, 0xE1, 0xB4, 0x97, 0x61, 0xE2, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xFB, 0x25, 0x6B, 0xEF, 0x26, 0xAD, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xCB, 0x93, 0x8C, 0xFA, 0xE4, 0x22, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xC0, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xEB, 0x81, 0x9D, 0x77, 0x22, 0xBE, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xA9, 0xC0, 0x3E, 0xCE, 0x7B, 0x39, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x11, 0x29, 0xFE, 0x68, 0x32, 0x76, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xC2, 0xE4, 0x59, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x48, 0xD9, 0x2E, 0x68, 0x38, 0x85, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x3D, 0x01, 0x8A, 0xD4, 0xCC, 0x88, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xD2, 0x83, 0x08, 0xA4, 0x24, 0x41, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xEB, 0x53, 0xB0, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xE0, 0x7C, 0x43, 0x89, 0x2D, 0x34, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x03, 0xF6, 0x4B, 0xFC, 0xBB, 0xF5, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x01, 0x61, 0x5D, 0x29, 0xDF, 0x4B, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x33, 0x8F, 0x95, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x33, 0x88, 0x01, 0xEB, 0xD5, 0xD4, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x76, 0x6D, 0xB7, 0xC7, 0x8A, 0xCD, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xC0, 0xBD, 0xF5, 0x66, 0x96, 0x46, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x08, 0x9E, 0xC9, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x65, 0x57, 0x2F, 0x88, 0x21, 0x02, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x1D, 0x5D, 0xCC, 0x7A, 0x00, 0x6D, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xE2, 0x34, 0xF6, 0x95, 0x35, 0x6D, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xCE, 0x5F, 0x1D, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x86, 0xD5, 0x9F, 0x60, 0x77, 0x49, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x75, 0xFE, 0xB2, 0xA7, 0x39, 0x47, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xB1, 0x16, 0x06, 0x20, 0x58, 0xF8, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xA8, 0xBC, 0xDB, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xF6, 0x79, 0xFD, 0x74, 0x1C, 0xC7, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x05, 0x32, 0x11, 0x9A, 0xA0, 0x39, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x37, 0x02, 0x0F, 0x60, 0x2C, 0x24, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xF7, 0x26, 0x18, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x72, 0xAA, 0xE8, 0x0B, 0x7B, 0xA4, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x6C, 0x86, 0x48, 0x26, 0x76, 0xF7, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x41, 0x20, 0x80, 0x8C, 0x54, 0xD3, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x08, 0xA8, 0x5C, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x1F, 0x05, 0x47, 0x9A, 0xC8, 0x8E, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xAD, 0xCF, 0x36, 0x54, 0xC7, 0x6E, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xC0, 0xD4, 0xB5, 0xCB, 0xE0, 0x71, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x32, 0x8E, 0x1D, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x7E, 0xF1, 0xD9, 0x8A, 0x36, 0x04, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xDA, 0xCC, 0x84, 0x2A, 0x3D, 0x4A, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xAE, 0x1E, 0x3B, 0x52, 0xFA, 0x06, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x38, 0x37, 0x1E, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x67, 0xFC, 0xCD, 0x95, 0x73, 0x6B, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x81, 0x78, 0x4C, 0x83, 0xB5, 0xA9, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x4A, 0x2C, 0x73, 0xA3, 0x92, 0xEC, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x06, 0x65, 0x2B, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x8A, 0x2E, 0x30, 0xCB, 0xE3, 0x5A, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x52, 0x29, 0xAA, 0x0B, 0x55, 0x97, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xE1, 0xB9, 0xB6, 0xA3, 0x39, 0x9B, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xE8, 0x05, 0xEE, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x98, 0xF4, 0x7A, 0x5F, 0xF7, 0x07, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x04, 0xAF, 0x89, 0xF1, 0x88, 0x09, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xCB, 0x6F, 0x8D, 0xA7, 0x86, 0x55, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x4A, 0x3D, 0xF4, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xE8, 0xEB, 0x6F, 0x23, 0xB6, 0xF2, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x30, 0x3B, 0x0B, 0xF4, 0x48, 0x8E, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xE8, 0xBE, 0x7F, 0xA4, 0xBC, 0x1B, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xC6, 0xEC, 0x88, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x32, 0x21, 0x2F, 0xA7, 0x0F, 0x6E, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xB0, 0x3E, 0x9D, 0x77, 0xAA, 0x83, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x29, 0x83, 0xC3, 0x36, 0x11, 0x41, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xCE, 0xD3, 0xF7, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x2C, 0x06, 0x07, 0xA3, 0x0A, 0xA7, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xA8, 0x1A, 0x03, 0xD1, 0x7F, 0x04, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x6E, 0x6F, 0x2F, 0x5E, 0x82, 0xA5, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x35, 0xF6, 0x6C, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x8C, 0x56, 0x12, 0xA3, 0xCC, 0x84, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x91, 0x11, 0x71, 0xC5, 0x5A, 0xDC, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x52, 0x10, 0x5F, 0x06, 0x4F, 0x29, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x4D, 0x4E, 0x0D, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xFF, 0x2F, 0xAF, 0x14, 0xEA, 0xFA, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x56, 0xB8, 0x52, 0x38, 0xEC, 0xBC, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x66, 0xF2, 0xA8, 0xF6, 0xA1, 0xD8, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xBA, 0x78, 0x19, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xB7, 0x68, 0x9D, 0xB6, 0xEE, 0x19, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x9B, 0xD0, 0x2E, 0x06, 0x11, 0xAD, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x77, 0x88, 0x5B, 0xC2, 0x8F, 0x0B, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xF2, 0xA8, 0x5F, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xE1, 0xF9, 0x50, 0x6E, 0xC4, 0x3B, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x91, 0xD1, 0xB1, 0x85, 0x90, 0x08, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x64, 0x51, 0xF0, 0xA7, 0x10, 0x9D, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x7E, 0x18, 0xCF, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x0A, 0x8A, 0xDB, 0x55, 0x03, 0xEC, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x06, 0xE8, 0x83, 0x96, 0x6E, 0x0B, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xD7, 0x8D, 0x25, 0x5E, 0x2F, 0x69, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xB0, 0x2B, 0x80, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x57, 0x6D, 0xCB, 0xD7, 0xFC, 0xA4, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x80, 0x48, 0xB3, 0xE8, 0x4B, 0xFA, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xB6, 0x29, 0x58, 0xC9, 0xB4, 0x83, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x7B, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xA3, 0x92, 0xBF, 0x6F, 0x9E, 0x81, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x39, 0x79, 0xC1, 0x69, 0xE5, 0x74, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x17, 0xF3, 0xA4, 0x0B, 0x78, 0x21, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x13, 0xCC, 0xE8, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x2C, 0x5B, 0x95, 0x64, 0x0F, 0x6B, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xCC, 0xE6, 0x58, 0x9E, 0xB3, 0xFB, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xD1, 0xF3, 0x4E, 0x28, 0x98, 0xC6, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x6F, 0x93, 0xDF, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x3D, 0x11, 0x69, 0x3B, 0x48, 0xE1, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x1A, 0xE2, 0xC5, 0xD1, 0x34, 0x0F, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xA7, 0xCF, 0x7C, 0x77, 0x38, 0x2D, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xCF, 0x55, 0x79, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x41, 0x25, 0x4B, 0x28, 0x3C, 0x71, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x87, 0xE8, 0xA8, 0x1E, 0x8E, 0x88, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xEB, 0x06, 0x6D, 0xA9, 0x74, 0x90, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x75, 0x0C, 0x9B, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x1D, 0x7D, 0x40, 0x94, 0x81, 0xC9, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xD9, 0x4F, 0x10, 0x44, 0xF4, 0x52, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x08, 0xE2, 0xBF, 0x2B, 0x45, 0xE0, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x33, 0x48, 0x45, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x67, 0x2C, 0xC5, 0x87, 0x65, 0x05, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xB5, 0xC0, 0xE4, 0xD1, 0x1E, 0x23, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x6D, 0x8F, 0x72, 0xFC, 0x65, 0x68, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x76, 0xB1, 0xF9, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xF3, 0x36, 0x87, 0x0C, 0x5E, 0x34, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x60, 0xCB, 0x04, 0xF4, 0x02, 0xEA, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x9F, 0xFC, 0x79, 0x19, 0x2A, 0x0C, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x1B, 0x1D, 0x48, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xC9, 0x92, 0xA3, 0x74, 0x5E, 0x86, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x2A, 0x18, 0x15, 0xEF, 0xF7, 0x9D, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x59, 0xA0, 0x47, 0x5D, 0x14, 0x32, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x92, 0x21, 0x7F, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x58, 0x8D, 0x97, 0xCD, 0x76, 0x66, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x0D, 0x08, 0xD4, 0x34, 0x62, 0x19, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x3E, 0xBF, 0x1B, 0xAE, 0xAD, 0x83, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x89, 0x0A, 0x05, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xF9, 0x25, 0x09, 0x10, 0xFE, 0x52, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x90, 0x66, 0x58, 0xE4, 0x40, 0x1E, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xE7, 0x82, 0x2E, 0x9B, 0xDB, 0x1C, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xF1, 0x7E, 0x79, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xBC, 0x1F, 0x3E, 0x44, 0x02, 0xA2, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x09, 0xE3, 0x6A, 0xC1, 0x79, 0x8F, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x3D, 0x0F, 0xDC, 0x54, 0xAB, 0xF2, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x0E, 0x18, 0xB3, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x31, 0xB5, 0x93, 0x3D, 0x26, 0xA5, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x53, 0xD9, 0x9C, 0x46, 0xEB, 0xF3, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xD6, 0xFD, 0xF2, 0xFB, 0x08, 0xAB, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x2E, 0xAD, 0xCC, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x10, 0xFB, 0xF7, 0xDB, 0xB9, 0x3D, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x8B, 0x4C, 0x1C, 0x22, 0x50, 0xB3, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x21, 0x15, 0x2D, 0xBA, 0x9D, 0x92, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x76, 0x41, 0xA7, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xEE, 0xA6, 0x3F, 0x10, 0x5B, 0x60, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xB0, 0x23, 0xFF, 0x16, 0x3A, 0x7A, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x99, 0x4E, 0x07, 0x82, 0xF9, 0x37, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x3F, 0xB1, 0x9B, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xC3, 0x2C, 0xF7, 0xC1, 0x5D, 0xF7, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x33, 0x4E, 0x4E, 0x8C, 0x7C, 0x6B, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xD2, 0xE8, 0x94, 0x4E, 0x93, 0xC5, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFC, 0xA5, 0x4B, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x16, 0x20, 0xE8, 0xBD, 0xCC, 0x8A, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x9E, 0xD7, 0x01, 0x89, 0x76, 0xA5, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x75, 0xA5, 0x41, 0xCB, 0x23, 0xB0, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x90, 0xEE, 0xC7, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x8C, 0x2A, 0x5C, 0x5B, 0x0F, 0xE3, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xEC, 0x96, 0x12, 0x8D, 0x35, 0x0D, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x17, 0x4C, 0xB1, 0xB0, 0xED, 0x4F, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x30, 0xB5, 0xB0, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xA5, 0xA1, 0x45, 0xFA, 0x89, 0xCF, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x69, 0xD8, 0xC2, 0x98, 0xBF, 0x7D, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xC5, 0xAD, 0xB5, 0x5E, 0xA3, 0xBF, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x26, 0x8E, 0x92, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x41, 0x12, 0x46, 0x20, 0xBF, 0x5D, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x4E, 0x84, 0xBB, 0x61, 0x29, 0x7C, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x03, 0x6D, 0x7E, 0x63, 0x6E, 0x2D, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x73, 0xEE, 0x5E, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x75, 0x1B, 0xD4, 0xDD, 0xFD, 0xC7, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x9D, 0xC7, 0xB3, 0x09, 0x0C, 0x47, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xA8, 0xFD, 0x2A, 0x32, 0x45, 0xD1, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xDB, 0x5F, 0x2C, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x23, 0x07, 0x28, 0x3D, 0x19, 0x9F, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xB5, 0x1E, 0xBF, 0x48, 0x03, 0x6A, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xFF, 0x16, 0xB5, 0x1D, 0x16, 0x15, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x4F, 0x86, 0xCB, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xE4, 0xFF, 0x85, 0x15, 0x41, 0x81, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x66, 0x31, 0x90, 0x5E, 0xD1, 0x40, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x31, 0xA6, 0xCD, 0x9B, 0xF5, 0xD2, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x87, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x0D, 0x55, 0xA8, 0x7A, 0x5F, 0x32, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x7E, 0x59, 0x1C, 0x03, 0x63, 0x3D, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xAF, 0x22, 0xF8, 0x38, 0xEF, 0x9D, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xC4, 0xA4, 0xB9, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x7E, 0x95, 0x3D, 0x55, 0xF0, 0xAF, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xE4, 0x92, 0xB5, 0x95, 0xC7, 0x10, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x2D, 0xE4, 0x83, 0x07, 0xF7, 0x5C, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x0A, 0x76, 0x58, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x5A, 0xB5, 0xDE, 0x6E, 0xA6, 0x08, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x85, 0x01, 0x2C, 0x8D, 0x8C, 0x46, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x9E, 0x13, 0xAA, 0x27, 0xB3, 0xB1, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xEA, 0x3B, 0x9F, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x3D, 0x18, 0x0B, 0x51, 0x22, 0x96, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x85, 0x7F, 0xCE, 0xDC, 0x00, 0x56, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x07, 0x07, 0xC2, 0x70, 0x73, 0xFA, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xC2, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xE0, 0x3A, 0x3C, 0xE3, 0xEB, 0xA9, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x32, 0x05, 0xBB, 0x0F, 0xF0, 0x75, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xFD, 0x15, 0x7A, 0xCD, 0xF1, 0x75, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xC5, 0x0F, 0x21, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x64, 0x96, 0x4E, 0x19, 0xD0, 0xC9, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x58, 0x0D, 0xEC, 0xAC, 0xE7, 0xC8, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xB7, 0x81, 0xE2, 0x75, 0xEA, 0xFF, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x95, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xD3, 0x1D, 0x9E, 0x57, 0xD7, 0xFA, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xAC, 0xCD, 0xF9, 0x2A, 0x21, 0x9E, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x58, 0xD1, 0x0B, 0xDB, 0xBD, 0xA1, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x2E, 0x6E, 0xFC, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x32, 0x5E, 0x17, 0x19, 0x6C, 0xBF, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x9F, 0x26, 0x68, 0x5A, 0x6F, 0xE0, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x86, 0x4F, 0xF0, 0xD2, 0x96, 0x5A, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x48, 0x33, 0x9B, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x6E, 0x9D, 0x15, 0x59, 0x39, 0x8D, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x3B, 0x26, 0x38, 0x0D, 0xF7, 0xD9, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x13, 0x20, 0xE9, 0xC5, 0xBF, 0x4D, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x88, 0xFB, 0x11, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x63, 0x70, 0x6B, 0x71, 0xC2, 0x9C, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x38, 0x2C, 0x4F, 0x1D, 0xE9, 0x91, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xDD, 0x8E, 0xFC, 0xC5, 0xCE, 0x08, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xE3, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x48, 0xB4, 0xE4, 0x53, 0xBF, 0xC0, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x33, 0xE8, 0xD8, 0x60, 0x86, 0x49, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xE9, 0x3E, 0x47, 0x17, 0x43, 0x32, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x93, 0x77, 0x67, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xFA, 0xAE, 0x4E, 0x60, 0x11, 0x5D, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x18, 0xE1, 0x6C, 0xB4, 0x56, 0x81, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x98, 0x35, 0x23, 0x8B, 0x9E, 0xA8, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x10, 0x97, 0xDA, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x60, 0xD9, 0xA5, 0xBB, 0x37, 0x56, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x94, 0x54, 0x73, 0x02, 0x66, 0x8A, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xAA, 0xEE, 0x44, 0x4D, 0xAE, 0x02, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x2F, 0x53, 0xE1, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224r1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xF3, 0xB8, 0x69, 0xD7, 0x9C, 0x1F, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x23, 0x50, 0x9A, 0xC1, 0x46, 0xEB, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xA9, 0xF2, 0x0E, 0xFB, 0xCA, 0x30, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x75, 0x29, 0xFD, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_ecp_point secp224r1_T[32] = {
+    ECP_POINT_INIT_XY_Z1(secp224r1_T_0_X, secp224r1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_1_X, secp224r1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_2_X, secp224r1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_3_X, secp224r1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_4_X, secp224r1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_5_X, secp224r1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_6_X, secp224r1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_7_X, secp224r1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_8_X, secp224r1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_9_X, secp224r1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_10_X, secp224r1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_11_X, secp224r1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_12_X, secp224r1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_13_X, secp224r1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_14_X, secp224r1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_15_X, secp224r1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_16_X, secp224r1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_17_X, secp224r1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_18_X, secp224r1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_19_X, secp224r1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_20_X, secp224r1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_21_X, secp224r1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_22_X, secp224r1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_23_X, secp224r1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_24_X, secp224r1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_25_X, secp224r1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_26_X, secp224r1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_27_X, secp224r1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_28_X, secp224r1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_29_X, secp224r1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_30_X, secp224r1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(secp224r1_T_31_X, secp224r1_T_31_Y),
+};
 #else
 #define secp224r1_T NULL
 #endif
@@ -572,7 +1348,8 @@ static const mbedtls_mpi_uint secp256r1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint secp256r1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xC2, 0x98, 0xD8, 0x45, 0x39, 0xA1, 0xF4 ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x33, 0xEB, 0x2D, 0x81, 0x7D, 0x03, 0x77 ),
@@ -783,80 +1560,500 @@ static const mbedtls_ecp_point secp256r1_T[16] = {
     ECP_POINT_INIT_XY_Z0(secp256r1_T_14_X, secp256r1_T_14_Y),
     ECP_POINT_INIT_XY_Z0(secp256r1_T_15_X, secp256r1_T_15_Y),
 };
-#else
-#define secp256r1_T NULL
-#endif
-
-#endif /* MBEDTLS_ECP_DP_SECP256R1_ENABLED */
-
-/*
- * Domain parameters for secp384r1
- */
-#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
-static const mbedtls_mpi_uint secp384r1_p[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp256r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xC2, 0x98, 0xD8, 0x45, 0x39, 0xA1, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x33, 0xEB, 0x2D, 0x81, 0x7D, 0x03, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x40, 0xA4, 0x63, 0xE5, 0xE6, 0xBC, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x42, 0x2C, 0xE1, 0xF2, 0xD1, 0x17, 0x6B ),
 };
-static const mbedtls_mpi_uint secp384r1_b[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x2A, 0xEC, 0xD3, 0xED, 0xC8, 0x85, 0x2A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xD1, 0x2E, 0x8A, 0x8D, 0x39, 0x56, 0xC6 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x87, 0x13, 0x50, 0x8F, 0x08, 0x14, 0x03 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x41, 0x81, 0xFE, 0x6E, 0x9C, 0x1D, 0x18 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x2D, 0xF8, 0xE3, 0x6B, 0x05, 0x8E, 0x98 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xE7, 0x3E, 0xE2, 0xA7, 0x2F, 0x31, 0xB3 ),
+static const mbedtls_mpi_uint secp256r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x51, 0xBF, 0x37, 0x68, 0x40, 0xB6, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x5E, 0x31, 0x6B, 0x57, 0x33, 0xCE, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x9E, 0x0F, 0x7C, 0x4A, 0xEB, 0xE7, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x7F, 0x1A, 0xFE, 0xE2, 0x42, 0xE3, 0x4F ),
 };
-static const mbedtls_mpi_uint secp384r1_gx[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x29, 0x55, 0xBF, 0x5D, 0xF2, 0x02, 0x55 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xAD, 0x20, 0xF3, 0x1E, 0xC7, 0xB1, 0x8E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA ),
+static const mbedtls_mpi_uint secp256r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x3F, 0x1C, 0x5A, 0x7C, 0x16, 0xDB, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x8E, 0x31, 0xBF, 0x2A, 0xCE, 0xB3, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x2F, 0xBC, 0xD2, 0x1E, 0xC4, 0xF1, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xB2, 0xD1, 0x6E, 0x43, 0x2C, 0xCC, 0xEF ),
 };
-static const mbedtls_mpi_uint secp384r1_gy[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x81, 0x7E, 0x1D, 0xCE, 0xB1, 0x60, 0x0A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xDC, 0x92, 0x92, 0xBF, 0x98, 0x9E, 0x5D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36 ),
+static const mbedtls_mpi_uint secp256r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x55, 0xB2, 0x97, 0xF1, 0x07, 0xFE, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xA5, 0x34, 0x37, 0x33, 0x45, 0x82, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xF5, 0x34, 0xED, 0x77, 0x4A, 0x38, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x38, 0x9F, 0x8D, 0x9C, 0x4F, 0x68, 0xF3 ),
 };
-static const mbedtls_mpi_uint secp384r1_n[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x29, 0xC5, 0xCC, 0x6A, 0x19, 0xEC, 0xEC ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xA7, 0xB0, 0x48, 0xB2, 0x0D, 0x1A, 0x58 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x2D, 0x37, 0xF4, 0x81, 0x4D, 0x63, 0xC7 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+static const mbedtls_mpi_uint secp256r1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x18, 0x18, 0x73, 0x64, 0x02, 0xC9, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x70, 0x16, 0xCA, 0x28, 0xEC, 0x0B, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x20, 0x9C, 0x09, 0x2F, 0x4D, 0x66, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x62, 0xFA, 0x55, 0x34, 0xCA, 0xCC, 0x13 ),
 };
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
-static const mbedtls_mpi_uint secp384r1_T_0_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x29, 0x55, 0xBF, 0x5D, 0xF2, 0x02, 0x55 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xAD, 0x20, 0xF3, 0x1E, 0xC7, 0xB1, 0x8E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA ),
+static const mbedtls_mpi_uint secp256r1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x1C, 0x42, 0x05, 0x31, 0xC2, 0x84, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x0D, 0xDB, 0x6C, 0x21, 0x75, 0x64, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x6A, 0x21, 0xFB, 0xB1, 0x46, 0x04, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x89, 0x46, 0xAF, 0xA5, 0xA5, 0x5B, 0x4B ),
 };
-static const mbedtls_mpi_uint secp384r1_T_0_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x81, 0x7E, 0x1D, 0xCE, 0xB1, 0x60, 0x0A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xDC, 0x92, 0x92, 0xBF, 0x98, 0x9E, 0x5D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36 ),
+static const mbedtls_mpi_uint secp256r1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x1C, 0xDB, 0xCB, 0x09, 0x28, 0xB2, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xCD, 0xF6, 0x30, 0xEB, 0xC8, 0x91, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x0F, 0xE8, 0xBF, 0x40, 0x87, 0xE2, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xE7, 0xE7, 0x40, 0x2A, 0x34, 0x74, 0x0F ),
 };
-static const mbedtls_mpi_uint secp384r1_T_1_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x92, 0x00, 0x2C, 0x78, 0xDB, 0x1F, 0x37 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xF3, 0xEB, 0xB7, 0x06, 0xF7, 0xB6, 0xBC ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xBC, 0x2C, 0xCF, 0xD8, 0xED, 0x53, 0xE7 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x75, 0x7B, 0xA3, 0xAB, 0xC3, 0x2C, 0x85 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x9D, 0x78, 0x41, 0xF6, 0x76, 0x84, 0xAC ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x56, 0xE8, 0x52, 0xB3, 0xCB, 0xA8, 0xBD ),
+static const mbedtls_mpi_uint secp256r1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x51, 0x1C, 0x35, 0x87, 0x8E, 0x96, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x7B, 0xE1, 0xF5, 0x81, 0xC5, 0xC5, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x4E, 0x99, 0x9D, 0x2A, 0xF0, 0x58, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xEC, 0xC1, 0xF5, 0x00, 0x0B, 0x1C, 0x53 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xAA, 0x21, 0x8B, 0x7D, 0xC4, 0x52, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x87, 0x7E, 0x5A, 0x29, 0x36, 0x50, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x51, 0xB4, 0x88, 0x14, 0x28, 0xA9, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xE0, 0x02, 0xC4, 0x1E, 0x45, 0xD6, 0x27 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x43, 0x67, 0x55, 0x14, 0xEC, 0x96, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x50, 0x41, 0x0F, 0x29, 0x98, 0xEB, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xF5, 0xEE, 0xCD, 0x0C, 0x74, 0x91, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xE5, 0xE9, 0x1B, 0x5E, 0xFA, 0x58, 0x2A ),
+};
+static const mbedtls_mpi_uint secp256r1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xA9, 0x95, 0x21, 0x50, 0xC5, 0xB7, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x58, 0xDD, 0xB8, 0x74, 0xD4, 0x7E, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xE9, 0x04, 0xE1, 0xD2, 0xEC, 0xB9, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x0E, 0xBD, 0xA2, 0x75, 0xD9, 0x90, 0xDC ),
+};
+static const mbedtls_mpi_uint secp256r1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xEB, 0xD6, 0x4D, 0x03, 0x52, 0xB5, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xFD, 0x1D, 0xC0, 0xBB, 0x54, 0xD5, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x7A, 0x97, 0xF0, 0x77, 0x32, 0xFD, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x74, 0x53, 0x81, 0x32, 0xE2, 0x7C, 0xC8 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x40, 0x03, 0x17, 0x5B, 0xC3, 0x4D, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xC5, 0xDA, 0x75, 0xC9, 0xAF, 0xD3, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x28, 0xF0, 0x29, 0xEB, 0x21, 0x23, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x22, 0x6B, 0xAD, 0x2F, 0x8D, 0xB1, 0xAF ),
+};
+static const mbedtls_mpi_uint secp256r1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x6A, 0x77, 0xF1, 0x73, 0x82, 0xF5, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x6C, 0xB9, 0xF6, 0x55, 0x97, 0x88, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x8F, 0x20, 0x22, 0x63, 0xD6, 0xA8, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x48, 0xCA, 0xFC, 0x10, 0x1C, 0xD8, 0x5E ),
+};
+static const mbedtls_mpi_uint secp256r1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xAF, 0x6A, 0x33, 0x1B, 0x1E, 0xC6, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xF5, 0x51, 0x42, 0xBD, 0x87, 0x7E, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xB3, 0x11, 0x65, 0x23, 0x20, 0xB3, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xF4, 0x41, 0x23, 0xCF, 0xA9, 0x0F, 0x46 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x01, 0xAF, 0xCB, 0x79, 0x3B, 0xE6, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x74, 0x15, 0x44, 0x3F, 0x12, 0x7E, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x4A, 0x9E, 0x80, 0x6E, 0x22, 0x59, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x5E, 0x77, 0x41, 0x3A, 0xF6, 0xD6, 0x18 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x76, 0x64, 0x01, 0xD0, 0xB6, 0xE4, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x25, 0xEC, 0xD4, 0xE5, 0xA7, 0xB9, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x90, 0xE4, 0xCB, 0x1E, 0xB7, 0x75, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xCD, 0x2A, 0xB5, 0x2F, 0x47, 0x6B, 0xDF ),
+};
+static const mbedtls_mpi_uint secp256r1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x55, 0x40, 0x78, 0x16, 0x87, 0x73, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x39, 0x7D, 0xB8, 0xB3, 0xB0, 0xC7, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x11, 0xB5, 0x1B, 0x37, 0x13, 0x9A, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xD5, 0x8F, 0xA8, 0xE1, 0x39, 0x26, 0xB4 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xD6, 0xB4, 0x20, 0x06, 0x42, 0xE9, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x0D, 0xFA, 0x29, 0xD9, 0xD0, 0x0F, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x2C, 0x02, 0x76, 0xA7, 0xB0, 0x1E, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x1C, 0x62, 0xA5, 0xDC, 0x7D, 0xCB, 0xFF ),
+};
+static const mbedtls_mpi_uint secp256r1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x96, 0x27, 0x09, 0x1B, 0x7B, 0xE3, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x19, 0x2C, 0xBD, 0x02, 0xC1, 0x9F, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x3F, 0x7F, 0x90, 0x5E, 0xE7, 0x2D, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x77, 0x9C, 0x5A, 0x29, 0x51, 0x98, 0xD3 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xB8, 0x19, 0xF1, 0xE7, 0x08, 0x6A, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x69, 0xFC, 0x8A, 0x23, 0xD5, 0xB7, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x70, 0x9F, 0x45, 0x32, 0x61, 0x89, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x91, 0x6A, 0xA8, 0x57, 0x62, 0xA4, 0x57 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x4C, 0x31, 0xBB, 0xEF, 0x6F, 0xA5, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x5C, 0x79, 0x74, 0x40, 0x1F, 0xE6, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x50, 0x78, 0x43, 0x52, 0x56, 0x3C, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xEC, 0x21, 0x66, 0x7D, 0x12, 0x4B, 0x7C ),
+};
+static const mbedtls_mpi_uint secp256r1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x81, 0xC8, 0x56, 0x07, 0x03, 0x1E, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xA2, 0x37, 0x7D, 0xE3, 0x47, 0xF6, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xFB, 0xFA, 0xFE, 0x36, 0xEB, 0x91, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xF6, 0xB7, 0x35, 0xFB, 0x62, 0x82, 0x15 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xE9, 0xDC, 0x32, 0x55, 0x22, 0xC3, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x47, 0x1B, 0x36, 0xCE, 0xD4, 0x7C, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x28, 0x85, 0x3F, 0x70, 0x5E, 0xBE, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x62, 0x8E, 0xC9, 0xA3, 0x1A, 0x28, 0x4C ),
+};
+static const mbedtls_mpi_uint secp256r1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x3D, 0x6A, 0x4D, 0xDD, 0x11, 0x29, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x08, 0x60, 0xB9, 0x7C, 0xD0, 0xED, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x7D, 0x6E, 0xE3, 0x6F, 0x8A, 0x74, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x5C, 0xBF, 0x4B, 0x34, 0x99, 0xC4, 0xBF ),
+};
+static const mbedtls_mpi_uint secp256r1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x75, 0x74, 0x8E, 0x2D, 0xF6, 0xC6, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x99, 0x91, 0x48, 0x87, 0x9F, 0x63, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x24, 0x8A, 0x95, 0x94, 0xAA, 0x01, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xAA, 0x51, 0xED, 0x8A, 0xAE, 0x43, 0x27 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x78, 0xEB, 0x86, 0x21, 0xA8, 0xDD, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x32, 0x41, 0xCE, 0x12, 0x36, 0x00, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x77, 0xB5, 0x91, 0xAB, 0x1F, 0xCE, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x73, 0x8F, 0x48, 0xFF, 0x29, 0x3F, 0x0F ),
+};
+static const mbedtls_mpi_uint secp256r1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x0D, 0x96, 0xE6, 0x63, 0x80, 0xB0, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xF4, 0xCB, 0xAE, 0xE2, 0x99, 0x96, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x76, 0xE5, 0x4C, 0xA4, 0x64, 0x15, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x29, 0x38, 0x81, 0xA5, 0x0E, 0xF0, 0x08 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x4A, 0x51, 0x70, 0x39, 0xFF, 0x17, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x80, 0xDD, 0xDA, 0xBA, 0xB5, 0xA7, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xC8, 0x26, 0x81, 0xC3, 0x33, 0x1E, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xC1, 0x57, 0x1D, 0xD0, 0x56, 0xE1, 0xB9 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x05, 0x81, 0xEA, 0x0D, 0x50, 0x0D, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xF3, 0x02, 0x02, 0x62, 0xA4, 0x2A, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x63, 0xC9, 0x3D, 0xAB, 0x56, 0x00, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x42, 0x21, 0x45, 0xAA, 0xB6, 0x6A, 0x50 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x31, 0x51, 0xC0, 0x5B, 0x73, 0x97, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xB5, 0xBE, 0x22, 0x68, 0x07, 0x65, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x5B, 0xF5, 0xF7, 0x89, 0xB1, 0xF2, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x26, 0x2C, 0x13, 0x82, 0x4C, 0x14, 0xAA ),
+};
+static const mbedtls_mpi_uint secp256r1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x22, 0x82, 0xB3, 0x14, 0xBE, 0x1C, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xAF, 0xD0, 0xFF, 0xB2, 0x72, 0xCE, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x43, 0x47, 0x84, 0x18, 0x4D, 0xA1, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x39, 0x37, 0x92, 0xE3, 0x9F, 0xD8, 0xC1 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x5B, 0x3F, 0x5F, 0x5C, 0x6A, 0x41, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x24, 0x52, 0xDA, 0xDB, 0x03, 0xE9, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x86, 0x91, 0x42, 0xF1, 0x80, 0xCC, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x2C, 0x15, 0x7A, 0xF8, 0x5C, 0x03, 0xB2 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x0E, 0xC8, 0x95, 0x91, 0x56, 0x12, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xC5, 0x97, 0xAF, 0x68, 0x25, 0xE0, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xE4, 0x14, 0x8A, 0xC5, 0x1D, 0x3E, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x80, 0x96, 0x74, 0x9C, 0x35, 0x2F, 0xF1 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x7B, 0xA7, 0xFE, 0x1B, 0x9D, 0x42, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x9A, 0x5E, 0x59, 0xDC, 0xA4, 0x51, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x69, 0x12, 0xE7, 0xB1, 0xAA, 0x00, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x61, 0xBF, 0x84, 0x67, 0x77, 0xEA, 0x90 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0xF2, 0x02, 0x0D, 0x25, 0x04, 0xD1, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x59, 0x4D, 0xFB, 0xCC, 0x3B, 0x58, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xB6, 0xA7, 0x5B, 0x62, 0x44, 0x75, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x86, 0x1E, 0x10, 0xD3, 0x21, 0xA3, 0xD1 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xA0, 0x2D, 0xE6, 0x6C, 0xB2, 0x90, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x62, 0x58, 0x7C, 0x19, 0x23, 0x70, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x72, 0x56, 0x86, 0xBF, 0x19, 0x4E, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x98, 0x7D, 0xA0, 0xF5, 0x03, 0x65, 0xA6 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x47, 0xFE, 0x21, 0xC0, 0xB7, 0xDE, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x00, 0x71, 0x7D, 0x7D, 0x84, 0xAE, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x1D, 0x7B, 0xE1, 0xA7, 0xFC, 0x69, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xFC, 0x0A, 0x32, 0xEC, 0x60, 0xBA, 0xAD ),
+};
+static const mbedtls_mpi_uint secp256r1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x81, 0xE4, 0xC4, 0x14, 0xD6, 0xC9, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xC5, 0x8F, 0xAE, 0x98, 0x4A, 0x6B, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x8E, 0xB6, 0x38, 0xE0, 0x8B, 0xEF, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x1F, 0x27, 0xDB, 0x96, 0xF5, 0x9C, 0xBE ),
+};
+static const mbedtls_mpi_uint secp256r1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x95, 0x6F, 0x8E, 0x3E, 0x65, 0x7B, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x4D, 0x9E, 0x9B, 0xFF, 0xE6, 0xDB, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x9F, 0x13, 0xA4, 0x8C, 0x2A, 0x77, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x7E, 0xC6, 0x66, 0xE5, 0x35, 0xF3, 0xA1 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xF1, 0x7C, 0xF7, 0xFB, 0x61, 0xB1, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x00, 0xE3, 0x8C, 0xED, 0x4F, 0x3C, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x20, 0x0E, 0x05, 0xD0, 0xA2, 0xB4, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x99, 0x49, 0xC3, 0x86, 0xA2, 0x61, 0x5A ),
+};
+static const mbedtls_mpi_uint secp256r1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x4E, 0x21, 0x70, 0x68, 0xAF, 0x7B, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x61, 0xC2, 0xF2, 0x7D, 0xCA, 0x5B, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x1A, 0xD9, 0x1E, 0x31, 0xDF, 0xC6, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x0D, 0x38, 0xA1, 0xAD, 0xAA, 0xCF, 0xE8 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x28, 0x6D, 0x96, 0x78, 0x31, 0x9E, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xA2, 0xF8, 0x89, 0x86, 0x86, 0xBA, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x8D, 0xCF, 0x4A, 0x6D, 0x9C, 0x1F, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x7F, 0x84, 0xE0, 0x73, 0x42, 0x2B, 0x2D ),
+};
+static const mbedtls_mpi_uint secp256r1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x0C, 0x13, 0x69, 0x90, 0x1A, 0x9E, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xE7, 0x83, 0x93, 0xFD, 0x10, 0xCB, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x71, 0xCC, 0x44, 0x26, 0x8A, 0x43, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xEA, 0xE4, 0x1E, 0x10, 0xEB, 0xEA, 0x37 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x37, 0x4A, 0xD8, 0xCB, 0xB5, 0x12, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xEA, 0xB1, 0xC7, 0xB4, 0x6D, 0xD6, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x1E, 0xE3, 0x2C, 0x20, 0xE4, 0x2B, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xAF, 0x0F, 0xE4, 0x2D, 0x9C, 0xBE, 0x17 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x87, 0xCC, 0x38, 0xCB, 0x3C, 0x5B, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x09, 0xB1, 0x34, 0x80, 0x9D, 0x8D, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x81, 0x5B, 0xE7, 0x86, 0x6E, 0xCC, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xE6, 0xDB, 0x3F, 0x94, 0xBF, 0x14, 0x69 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x6F, 0xB1, 0x00, 0x33, 0x4D, 0xB4, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x57, 0x2D, 0x00, 0xF3, 0x8E, 0x98, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x4F, 0x49, 0xD0, 0xEB, 0xE1, 0x6F, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x0D, 0x71, 0x7F, 0x69, 0x41, 0xF8, 0xAE ),
+};
+static const mbedtls_mpi_uint secp256r1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x96, 0xD4, 0x8B, 0x1F, 0xFB, 0x38, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0xB1, 0xA0, 0xBF, 0xAE, 0xDA, 0xC9, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xF6, 0x2C, 0x64, 0x5E, 0x36, 0x51, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x8F, 0x0E, 0x16, 0xFA, 0xB0, 0xB8, 0x75 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x9C, 0xAB, 0xED, 0x13, 0xD1, 0x33, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x45, 0x9D, 0xE6, 0xA3, 0x7B, 0xF8, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x5A, 0xD6, 0xE4, 0x36, 0x62, 0x43, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xA5, 0x98, 0x3F, 0xF9, 0xF6, 0x93, 0x58 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x4F, 0xD5, 0xAA, 0x15, 0x2E, 0x83, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x36, 0xC7, 0x6B, 0x0D, 0xFF, 0x77, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x4F, 0x0C, 0x20, 0x18, 0x11, 0x30, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x38, 0xE9, 0xD4, 0xBC, 0x71, 0xE4, 0x26 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x27, 0x24, 0xC5, 0xA4, 0xC5, 0x76, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x4B, 0xA3, 0xF5, 0x43, 0x82, 0x95, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x0D, 0x6E, 0xF3, 0x98, 0x67, 0x16, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xE6, 0xE9, 0xC6, 0x27, 0x39, 0xE3, 0x43 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x8D, 0xCA, 0xF0, 0x76, 0xED, 0x9A, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x0D, 0xF5, 0x0A, 0xDE, 0x9C, 0xB8, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xE1, 0x51, 0x59, 0x1E, 0xA2, 0x5E, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x30, 0x41, 0x28, 0xA4, 0xDA, 0x10, 0xE2 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x03, 0x58, 0x07, 0x65, 0xA1, 0x46, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xA0, 0x70, 0xE0, 0xAD, 0xF1, 0x3D, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x34, 0x69, 0x68, 0x38, 0xFB, 0x01, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x6E, 0xF1, 0xF0, 0x57, 0x62, 0xBA, 0x1C ),
+};
+static const mbedtls_mpi_uint secp256r1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x40, 0x93, 0xEE, 0xB6, 0xA9, 0x38, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x38, 0x6B, 0x4A, 0xA1, 0x29, 0x24, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x15, 0xC2, 0xA5, 0x0D, 0x77, 0x88, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x76, 0x1D, 0x89, 0x8E, 0x1F, 0xDE, 0x4A ),
+};
+static const mbedtls_mpi_uint secp256r1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xE6, 0xAD, 0x27, 0x4B, 0x2B, 0x70, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x67, 0x05, 0xA1, 0x33, 0x1A, 0xF1, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xB9, 0x62, 0xA3, 0x80, 0xCB, 0x33, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xB2, 0x5B, 0x85, 0xF5, 0x42, 0xBB, 0xA7 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xE5, 0x5F, 0xC9, 0x96, 0x60, 0xCC, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xDE, 0x51, 0x23, 0xD7, 0x08, 0x0E, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x5B, 0x6A, 0xBB, 0xF5, 0x3F, 0x32, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xA2, 0xF7, 0x89, 0xAE, 0x2D, 0xAA, 0x2C ),
+};
+static const mbedtls_mpi_uint secp256r1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xEB, 0xA7, 0x2D, 0x76, 0xD6, 0x96, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x5E, 0x77, 0xFB, 0x8E, 0x76, 0x04, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xF7, 0x24, 0xAF, 0x3D, 0x9C, 0x34, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x90, 0x0C, 0xDE, 0xCA, 0x6C, 0xDB, 0xE6 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xFD, 0x16, 0xA4, 0xF5, 0x01, 0xAA, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xC4, 0x1E, 0x78, 0x0B, 0x27, 0xC3, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x34, 0x10, 0x02, 0x04, 0x0F, 0x68, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xF7, 0x4B, 0x65, 0x3C, 0xFE, 0x90, 0xEB ),
+};
+static const mbedtls_mpi_uint secp256r1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x19, 0x57, 0xB3, 0x16, 0xBF, 0x35, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x64, 0x68, 0x34, 0x63, 0x0C, 0xEB, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x6C, 0x9B, 0x7E, 0xE0, 0x57, 0x7B, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x5A, 0xB3, 0x70, 0x6F, 0xCF, 0x57, 0x31 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x9E, 0xC4, 0x5A, 0x14, 0x4C, 0xC2, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x32, 0x1A, 0x6B, 0x90, 0x56, 0x0C, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xA3, 0x5F, 0x34, 0x4E, 0x7B, 0xEF, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x47, 0x77, 0x40, 0x5D, 0x65, 0xC9, 0xB4 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x66, 0xF8, 0xFC, 0xFE, 0xE3, 0xF4, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x0A, 0x8B, 0xE1, 0x07, 0x08, 0x2A, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x2E, 0x9B, 0x1B, 0x06, 0xC7, 0xC4, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x00, 0xDD, 0xDA, 0x2B, 0xE9, 0xD7, 0x41 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x6E, 0x4B, 0x1D, 0x79, 0x8A, 0x0A, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x2F, 0xAA, 0xB2, 0xFF, 0x4D, 0x34, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x06, 0x7A, 0x35, 0x04, 0xD7, 0x26, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x85, 0xBC, 0xC1, 0x77, 0xBB, 0xE6, 0x4C ),
+};
+static const mbedtls_mpi_uint secp256r1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x2B, 0xCC, 0xAF, 0xF4, 0x37, 0xE4, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x2B, 0xDA, 0x3A, 0xD6, 0xB2, 0x1F, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x0C, 0x58, 0xBB, 0x2D, 0xE1, 0xC0, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x54, 0xC7, 0x33, 0x34, 0x37, 0x18, 0x25 ),
+};
+static const mbedtls_mpi_uint secp256r1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x2F, 0xD9, 0xBF, 0x0F, 0xD9, 0x12, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xAE, 0x85, 0xA1, 0xB3, 0xB9, 0xB9, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xF4, 0xE6, 0x9C, 0x7E, 0x7A, 0x0C, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x21, 0x8F, 0xB4, 0x7F, 0x30, 0x1F, 0x53 ),
+};
+static const mbedtls_ecp_point secp256r1_T[32] = {
+    ECP_POINT_INIT_XY_Z1(secp256r1_T_0_X, secp256r1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_1_X, secp256r1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_2_X, secp256r1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_3_X, secp256r1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_4_X, secp256r1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_5_X, secp256r1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_6_X, secp256r1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_7_X, secp256r1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_8_X, secp256r1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_9_X, secp256r1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_10_X, secp256r1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_11_X, secp256r1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_12_X, secp256r1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_13_X, secp256r1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_14_X, secp256r1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_15_X, secp256r1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_16_X, secp256r1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_17_X, secp256r1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_18_X, secp256r1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_19_X, secp256r1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_20_X, secp256r1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_21_X, secp256r1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_22_X, secp256r1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_23_X, secp256r1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_24_X, secp256r1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_25_X, secp256r1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_26_X, secp256r1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_27_X, secp256r1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_28_X, secp256r1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_29_X, secp256r1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_30_X, secp256r1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(secp256r1_T_31_X, secp256r1_T_31_Y),
+};
+#else
+#define secp256r1_T NULL
+#endif
+
+#endif /* MBEDTLS_ECP_DP_SECP256R1_ENABLED */
+
+/*
+ * Domain parameters for secp384r1
+ */
+#if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+static const mbedtls_mpi_uint secp384r1_p[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+};
+static const mbedtls_mpi_uint secp384r1_b[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x2A, 0xEC, 0xD3, 0xED, 0xC8, 0x85, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xD1, 0x2E, 0x8A, 0x8D, 0x39, 0x56, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x87, 0x13, 0x50, 0x8F, 0x08, 0x14, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x41, 0x81, 0xFE, 0x6E, 0x9C, 0x1D, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x2D, 0xF8, 0xE3, 0x6B, 0x05, 0x8E, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xE7, 0x3E, 0xE2, 0xA7, 0x2F, 0x31, 0xB3 ),
+};
+static const mbedtls_mpi_uint secp384r1_gx[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x29, 0x55, 0xBF, 0x5D, 0xF2, 0x02, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xAD, 0x20, 0xF3, 0x1E, 0xC7, 0xB1, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA ),
+};
+static const mbedtls_mpi_uint secp384r1_gy[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x81, 0x7E, 0x1D, 0xCE, 0xB1, 0x60, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xDC, 0x92, 0x92, 0xBF, 0x98, 0x9E, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36 ),
+};
+static const mbedtls_mpi_uint secp384r1_n[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x29, 0xC5, 0xCC, 0x6A, 0x19, 0xEC, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xA7, 0xB0, 0x48, 0xB2, 0x0D, 0x1A, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x2D, 0x37, 0xF4, 0x81, 0x4D, 0x63, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+};
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
+static const mbedtls_mpi_uint secp384r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x29, 0x55, 0xBF, 0x5D, 0xF2, 0x02, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xAD, 0x20, 0xF3, 0x1E, 0xC7, 0xB1, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA ),
+};
+static const mbedtls_mpi_uint secp384r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x81, 0x7E, 0x1D, 0xCE, 0xB1, 0x60, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xDC, 0x92, 0x92, 0xBF, 0x98, 0x9E, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x92, 0x00, 0x2C, 0x78, 0xDB, 0x1F, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xF3, 0xEB, 0xB7, 0x06, 0xF7, 0xB6, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xBC, 0x2C, 0xCF, 0xD8, 0xED, 0x53, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x75, 0x7B, 0xA3, 0xAB, 0xC3, 0x2C, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x9D, 0x78, 0x41, 0xF6, 0x76, 0x84, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x56, 0xE8, 0x52, 0xB3, 0xCB, 0xA8, 0xBD ),
 };
 static const mbedtls_mpi_uint secp384r1_T_1_Y[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xF2, 0xAE, 0xA4, 0xB6, 0x89, 0x1B, 0xDA ),
@@ -1380,113 +2577,1205 @@ static const mbedtls_ecp_point secp384r1_T[32] = {
     ECP_POINT_INIT_XY_Z0(secp384r1_T_30_X, secp384r1_T_30_Y),
     ECP_POINT_INIT_XY_Z0(secp384r1_T_31_X, secp384r1_T_31_Y),
 };
-#else
-#define secp384r1_T NULL
-#endif
-
-#endif /* MBEDTLS_ECP_DP_SECP384R1_ENABLED */
-
-/*
- * Domain parameters for secp521r1
- */
-#if defined(MBEDTLS_ECP_DP_SECP521R1_ENABLED)
-static const mbedtls_mpi_uint secp521r1_p[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_2( 0xFF, 0x01 ),
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp384r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x29, 0x55, 0xBF, 0x5D, 0xF2, 0x02, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xAD, 0x20, 0xF3, 0x1E, 0xC7, 0xB1, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA ),
 };
-static const mbedtls_mpi_uint secp521r1_b[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x3F, 0x50, 0x6B, 0xD4, 0x1F, 0x45, 0xEF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x34, 0x2C, 0x3D, 0x88, 0xDF, 0x73, 0x35 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xBF, 0xB1, 0x3B, 0xBD, 0xC0, 0x52, 0x16 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x93, 0x7E, 0xEC, 0x51, 0x39, 0x19, 0x56 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x09, 0xF1, 0x8E, 0x91, 0x89, 0xB4, 0xB8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x15, 0xB3, 0x99, 0x5B, 0x72, 0xDA, 0xA2 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x40, 0x85, 0xB6, 0xA0, 0x21, 0x9A, 0x92 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x9A, 0x1C, 0x8E, 0x61, 0xB9, 0x3E, 0x95 ),
-    MBEDTLS_BYTES_TO_T_UINT_2( 0x51, 0x00 ),
+static const mbedtls_mpi_uint secp384r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x81, 0x7E, 0x1D, 0xCE, 0xB1, 0x60, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xDC, 0x92, 0x92, 0xBF, 0x98, 0x9E, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36 ),
 };
-static const mbedtls_mpi_uint secp521r1_gx[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xBD, 0xE5, 0xC2, 0x31, 0x7E, 0x7E, 0xF9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x42, 0x6A, 0x85, 0xC1, 0xB3, 0x48, 0x33 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xA8, 0xFF, 0xA2, 0x27, 0xC1, 0x1D, 0xFE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x59, 0xE7, 0xEF, 0x77, 0x5E, 0x4B, 0xA1 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x3D, 0x4D, 0x6B, 0x60, 0xAF, 0x28, 0xF8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xB5, 0x3F, 0x05, 0x39, 0x81, 0x64, 0x9C ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xB4, 0x95, 0x23, 0x66, 0xCB, 0x3E, 0x9E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xE9, 0x04, 0x04, 0xB7, 0x06, 0x8E, 0x85 ),
-    MBEDTLS_BYTES_TO_T_UINT_2( 0xC6, 0x00 ),
+static const mbedtls_mpi_uint secp384r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xB0, 0x43, 0xD4, 0x26, 0xAE, 0x3D, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x7E, 0x7D, 0x6F, 0x8D, 0x31, 0x26, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x08, 0x05, 0xCF, 0xC9, 0x8D, 0xD5, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x52, 0x5F, 0x1B, 0x16, 0x2D, 0xD1, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x5C, 0x8C, 0xA0, 0x61, 0xEA, 0x4A, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xF8, 0x19, 0xDA, 0xCC, 0x72, 0x3D, 0x98 ),
 };
-static const mbedtls_mpi_uint secp521r1_gy[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x66, 0xD1, 0x9F, 0x76, 0x94, 0xBE, 0x88 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xC2, 0x72, 0xA2, 0x86, 0x70, 0x3C, 0x35 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x07, 0xAD, 0x3F, 0x01, 0xB9, 0x50, 0xC5 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x26, 0xF4, 0x5E, 0x99, 0x72, 0xEE, 0x97 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x66, 0x3E, 0x27, 0x17, 0xBD, 0xAF, 0x17 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x44, 0x9B, 0x57, 0x49, 0x44, 0xF5, 0x98 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x1B, 0x7D, 0x2C, 0xB4, 0x5F, 0x8A, 0x5C ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xC0, 0x3B, 0x9A, 0x78, 0x6A, 0x29, 0x39 ),
-    MBEDTLS_BYTES_TO_T_UINT_2( 0x18, 0x01 ),
+static const mbedtls_mpi_uint secp384r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x3E, 0x9E, 0xD2, 0x5C, 0xCA, 0x16, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xBF, 0x23, 0x97, 0x63, 0x4E, 0xC3, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xFE, 0x8E, 0x6C, 0xB5, 0xD3, 0xA2, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xD8, 0x26, 0xC6, 0xEB, 0xC0, 0x9F, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xBF, 0xB9, 0xE0, 0xDA, 0x07, 0xFF, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xD3, 0xFA, 0xB9, 0x01, 0x74, 0x6E, 0x3A ),
 };
-static const mbedtls_mpi_uint secp521r1_n[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x64, 0x38, 0x91, 0x1E, 0xB7, 0x6F, 0xBB ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x47, 0x9C, 0x89, 0xB8, 0xC9, 0xB5, 0x3B ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xA5, 0x09, 0xF7, 0x48, 0x01, 0xCC, 0x7F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x96, 0x2F, 0xBF, 0x83, 0x87, 0x86, 0x51 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_2( 0xFF, 0x01 ),
+static const mbedtls_mpi_uint secp384r1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x21, 0x97, 0xDA, 0x90, 0x5A, 0x4D, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x98, 0x5C, 0xF0, 0x24, 0x7D, 0x54, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x17, 0x21, 0x35, 0x7A, 0x8B, 0xA5, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xCB, 0x73, 0x53, 0xE5, 0x6C, 0xC5, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x06, 0x5E, 0x0B, 0xF0, 0xD5, 0x40, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x8F, 0xFB, 0x36, 0x1E, 0x39, 0x5E, 0x4F ),
 };
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
-static const mbedtls_mpi_uint secp521r1_T_0_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xBD, 0xE5, 0xC2, 0x31, 0x7E, 0x7E, 0xF9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x42, 0x6A, 0x85, 0xC1, 0xB3, 0x48, 0x33 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xA8, 0xFF, 0xA2, 0x27, 0xC1, 0x1D, 0xFE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x59, 0xE7, 0xEF, 0x77, 0x5E, 0x4B, 0xA1 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x3D, 0x4D, 0x6B, 0x60, 0xAF, 0x28, 0xF8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xB5, 0x3F, 0x05, 0x39, 0x81, 0x64, 0x9C ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xB4, 0x95, 0x23, 0x66, 0xCB, 0x3E, 0x9E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xE9, 0x04, 0x04, 0xB7, 0x06, 0x8E, 0x85 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+static const mbedtls_mpi_uint secp384r1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xE6, 0x9B, 0x07, 0xBD, 0x81, 0xBA, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xE2, 0xE4, 0x4B, 0x43, 0x17, 0x57, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x71, 0x67, 0xD6, 0x11, 0x34, 0xF7, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x06, 0x16, 0x4E, 0x58, 0xD9, 0xA1, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xF2, 0x2D, 0x20, 0x47, 0x4E, 0xF6, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x37, 0x49, 0xF0, 0xF3, 0x4E, 0xCC, 0x34 ),
 };
-static const mbedtls_mpi_uint secp521r1_T_0_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x66, 0xD1, 0x9F, 0x76, 0x94, 0xBE, 0x88 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xC2, 0x72, 0xA2, 0x86, 0x70, 0x3C, 0x35 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x07, 0xAD, 0x3F, 0x01, 0xB9, 0x50, 0xC5 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x26, 0xF4, 0x5E, 0x99, 0x72, 0xEE, 0x97 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x66, 0x3E, 0x27, 0x17, 0xBD, 0xAF, 0x17 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x44, 0x9B, 0x57, 0x49, 0x44, 0xF5, 0x98 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x1B, 0x7D, 0x2C, 0xB4, 0x5F, 0x8A, 0x5C ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xC0, 0x3B, 0x9A, 0x78, 0x6A, 0x29, 0x39 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+static const mbedtls_mpi_uint secp384r1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x4E, 0xFB, 0x8E, 0x74, 0x93, 0xE2, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x5F, 0x1B, 0x8A, 0x44, 0x2F, 0x63, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xEF, 0xDD, 0xA1, 0xAA, 0xF3, 0x37, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x83, 0xF0, 0x6C, 0x19, 0xEC, 0x8E, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x33, 0x75, 0xF0, 0x4D, 0x11, 0x08, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x75, 0x8C, 0x22, 0x64, 0xDE, 0x7D, 0x53 ),
 };
-static const mbedtls_mpi_uint secp521r1_T_1_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xB1, 0x2D, 0xEB, 0x27, 0x2F, 0xE8, 0xDA ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x4B, 0x44, 0x25, 0xDB, 0x5C, 0x5F, 0x67 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x85, 0x28, 0x78, 0x2E, 0x75, 0x34, 0x32 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x57, 0x0F, 0x73, 0x78, 0x7A, 0xE3, 0x53 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xD8, 0xEC, 0xDC, 0xDA, 0x04, 0xAD, 0xAB ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x8A, 0x09, 0xF3, 0x58, 0x79, 0xD8, 0x29 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x03, 0xCB, 0x50, 0x1A, 0x7F, 0x56, 0x00 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xA6, 0x78, 0x38, 0x85, 0x67, 0x0B, 0x40 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+static const mbedtls_mpi_uint secp384r1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x80, 0x44, 0x96, 0x8B, 0x52, 0x85, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x41, 0xBD, 0x76, 0xB9, 0x8F, 0x2B, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x2C, 0x6B, 0xCB, 0x45, 0x23, 0xBF, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x1B, 0x33, 0xD1, 0xB4, 0xA6, 0x98, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x16, 0x1B, 0x8D, 0xF7, 0x89, 0xD5, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xA5, 0x47, 0xBF, 0x16, 0x9C, 0xD5, 0x17 ),
 };
-static const mbedtls_mpi_uint secp521r1_T_1_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xD5, 0xD2, 0x22, 0xC4, 0x00, 0x3B, 0xBA ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x93, 0x0E, 0x7B, 0x85, 0x51, 0xC3, 0x06 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xA6, 0x5F, 0x54, 0x49, 0x02, 0x81, 0x78 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xE9, 0x6B, 0x3A, 0x92, 0xE7, 0x72, 0x1D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x5F, 0x28, 0x9E, 0x91, 0x27, 0x88, 0xE3 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x28, 0x31, 0xB3, 0x84, 0xCA, 0x12, 0x32 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xF9, 0xAC, 0x22, 0x10, 0x0A, 0x64, 0x41 ),
+static const mbedtls_mpi_uint secp384r1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xDA, 0x83, 0xFA, 0x3D, 0x12, 0xF2, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xC3, 0xC7, 0x9F, 0xCE, 0x83, 0xF3, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xA5, 0x88, 0x13, 0x99, 0x75, 0xCD, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x12, 0x90, 0xD0, 0xF7, 0xA4, 0xE9, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x03, 0x57, 0xD7, 0x30, 0xA8, 0xDE, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x02, 0xA8, 0x68, 0x9A, 0xFD, 0x18, 0xB7 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x7B, 0x4D, 0xF6, 0xF3, 0x40, 0x3A, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x9D, 0xD9, 0xC4, 0xBD, 0x47, 0x92, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x5C, 0xC7, 0x76, 0xE3, 0xD5, 0x72, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x7A, 0xD9, 0x7B, 0x91, 0xEB, 0x52, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x7E, 0xD3, 0xC6, 0x03, 0x0E, 0xEC, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x5A, 0xB7, 0x53, 0x3E, 0x96, 0xA0, 0xBA ),
+};
+static const mbedtls_mpi_uint secp384r1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xB8, 0xE0, 0xAE, 0xD9, 0xC4, 0x36, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xF1, 0xF5, 0xA4, 0x04, 0xF2, 0xD7, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xCB, 0xC7, 0x37, 0x1F, 0x75, 0x57, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x2E, 0x36, 0xCA, 0x65, 0x86, 0x73, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x88, 0x32, 0xC3, 0x9B, 0x83, 0x61, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x18, 0x07, 0x97, 0xC2, 0xCE, 0x93, 0xE4 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x72, 0x93, 0x0D, 0x66, 0xE2, 0x66, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xAD, 0x80, 0x7F, 0x4C, 0x73, 0x88, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xA8, 0x1B, 0x52, 0x74, 0xC3, 0x1A, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x64, 0x2E, 0xC4, 0x0F, 0x60, 0xE9, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xEC, 0x8E, 0xBB, 0x27, 0x74, 0xE4, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xF7, 0x74, 0x14, 0xB7, 0x91, 0x12, 0x0D ),
+};
+static const mbedtls_mpi_uint secp384r1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x4A, 0x17, 0xDA, 0x39, 0x94, 0x45, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x83, 0xBF, 0x1C, 0x37, 0x27, 0x98, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x38, 0xAB, 0x06, 0xCB, 0x7B, 0x30, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x2A, 0x54, 0x76, 0x4F, 0x5A, 0xDB, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xA8, 0x3A, 0x12, 0xB1, 0x57, 0x79, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x1F, 0x12, 0x2D, 0x5A, 0x70, 0xB0, 0x13 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x5A, 0x1A, 0x7C, 0x8D, 0x65, 0x56, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xB6, 0x32, 0xB9, 0x81, 0x19, 0x07, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x4F, 0x97, 0xEA, 0xE0, 0xB8, 0xDE, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x29, 0x12, 0x0B, 0xEA, 0x50, 0x0B, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x46, 0x73, 0xE2, 0x7B, 0x8B, 0xD1, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x61, 0x8A, 0x63, 0x6D, 0x0A, 0xE0, 0xD3 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x07, 0x4C, 0xA4, 0xD8, 0x1A, 0x0A, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x89, 0x0B, 0x7A, 0xB4, 0x05, 0xE0, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x98, 0x5C, 0xF6, 0x0F, 0x97, 0x8B, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xAF, 0xBB, 0xCF, 0xE1, 0xB2, 0x4A, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xFB, 0xAD, 0x02, 0xB0, 0x6B, 0x91, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x2C, 0x42, 0x28, 0xA5, 0x57, 0x6E, 0x9B ),
+};
+static const mbedtls_mpi_uint secp384r1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xE9, 0x93, 0xE2, 0xD2, 0x56, 0x25, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xB6, 0xA0, 0x20, 0x32, 0x8A, 0xE4, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x7E, 0x46, 0xF8, 0xEC, 0xFA, 0x4B, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xE8, 0x18, 0x7D, 0xEA, 0xA3, 0x4A, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xDD, 0x3C, 0x4B, 0x65, 0xDF, 0x24, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x94, 0xF3, 0x59, 0x59, 0x4B, 0xE3, 0x1E ),
+};
+static const mbedtls_mpi_uint secp384r1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x77, 0x2F, 0x93, 0x01, 0x31, 0x62, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xF4, 0xB1, 0x4D, 0xCC, 0x75, 0x2C, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x6F, 0xB2, 0xDB, 0xC2, 0xAA, 0x96, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xAB, 0xB1, 0x38, 0x82, 0xD2, 0x4F, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xCB, 0x6E, 0xD8, 0x1B, 0xB3, 0x1D, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xE8, 0x7F, 0xF8, 0x92, 0xE9, 0xC4, 0x2D ),
+};
+static const mbedtls_mpi_uint secp384r1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x39, 0x1C, 0xBE, 0x82, 0xDC, 0xA1, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xAC, 0xE3, 0x9F, 0x17, 0xC0, 0x6E, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x6B, 0x48, 0xAD, 0x3C, 0xC0, 0x92, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xAA, 0x7E, 0x80, 0x20, 0xD5, 0x95, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x97, 0xCF, 0x1F, 0x8A, 0x95, 0x81, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xEC, 0x76, 0x86, 0x52, 0x70, 0xF5, 0x9E ),
+};
+static const mbedtls_mpi_uint secp384r1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x80, 0x7B, 0xD5, 0x08, 0xA4, 0x1B, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x1F, 0xE9, 0x32, 0x53, 0xBC, 0x6D, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x47, 0x43, 0x4E, 0x65, 0x69, 0xF4, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xD8, 0xD7, 0x48, 0xFF, 0xD8, 0x06, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x61, 0xCD, 0xA1, 0x2E, 0xC3, 0x88, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x4E, 0xA9, 0x3E, 0x81, 0x2D, 0x6F, 0xBE ),
+};
+static const mbedtls_mpi_uint secp384r1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x1F, 0x92, 0x08, 0xF9, 0xCB, 0xAC, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x3F, 0xC2, 0xE2, 0x86, 0x52, 0xD8, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x0A, 0x7B, 0x03, 0xFA, 0x50, 0x33, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xF0, 0x4F, 0xFC, 0x1D, 0x99, 0xC5, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x3E, 0x00, 0x3B, 0xA9, 0xA8, 0xCF, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x51, 0xC3, 0x9D, 0xF3, 0x2B, 0x4B, 0x54 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x5A, 0x92, 0x90, 0xE5, 0x8E, 0x22, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xDA, 0xC1, 0x9B, 0x7F, 0xFA, 0x3A, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xDF, 0x75, 0x9A, 0x12, 0x77, 0x4D, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x71, 0xA6, 0x51, 0x00, 0xEE, 0x0F, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x12, 0x71, 0x49, 0x27, 0x5B, 0x3F, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xFD, 0xAC, 0x71, 0x9E, 0x61, 0x36, 0xF5 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x0F, 0x26, 0x11, 0x48, 0x6B, 0xA2, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x29, 0x33, 0xF3, 0x4A, 0x75, 0x22, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x01, 0x8F, 0x22, 0x61, 0xF0, 0xE8, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xEF, 0x50, 0xD3, 0x92, 0xA0, 0x90, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x00, 0xA6, 0x47, 0x09, 0xF7, 0x46, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x8E, 0x6E, 0x38, 0x1D, 0x1D, 0x7B, 0xB5 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xA5, 0xC4, 0xC3, 0xE2, 0xF4, 0x0F, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xF2, 0xAF, 0x49, 0x7E, 0x69, 0x7B, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x15, 0x83, 0x4C, 0x8A, 0xDE, 0xA0, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xBC, 0x13, 0xF8, 0x18, 0x22, 0xE4, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x99, 0x91, 0xCF, 0xB8, 0x7A, 0x61, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xD5, 0xF5, 0x5A, 0x43, 0x98, 0xF6, 0x0A ),
+};
+static const mbedtls_mpi_uint secp384r1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x5F, 0x26, 0x5C, 0x32, 0xF2, 0x25, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xA5, 0x0E, 0xDE, 0xED, 0xF4, 0x52, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x92, 0x5B, 0x44, 0xBD, 0x1C, 0x10, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x18, 0xE3, 0xEA, 0xE8, 0x47, 0x19, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xE7, 0xD6, 0x16, 0xC3, 0xEE, 0xDA, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xC8, 0xB1, 0xD1, 0x19, 0x1C, 0x0C, 0x97 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x45, 0x2A, 0x9E, 0xE9, 0xDC, 0x9A, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xB0, 0x1C, 0x46, 0x7A, 0x29, 0xE4, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x39, 0x9C, 0x47, 0x77, 0xF7, 0x24, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x5B, 0xED, 0x9B, 0x4C, 0x5F, 0x7D, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x59, 0xDD, 0xAC, 0x2C, 0x0B, 0x54, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x72, 0x14, 0x47, 0x3C, 0x14, 0x47, 0x68 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xFA, 0x74, 0x22, 0x94, 0x8D, 0xD3, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xAF, 0x0D, 0x12, 0xCC, 0x61, 0x76, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x4B, 0xC7, 0x32, 0x16, 0xD5, 0xF2, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x51, 0xA4, 0x65, 0x48, 0x40, 0x26, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x31, 0xE1, 0xC8, 0xE1, 0xD8, 0x23, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x39, 0x92, 0x9E, 0xCE, 0xB4, 0x7C, 0xAF ),
+};
+static const mbedtls_mpi_uint secp384r1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x84, 0xCF, 0xA4, 0x68, 0x52, 0xC0, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x77, 0xBF, 0xFC, 0xE0, 0x17, 0x84, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xF9, 0xDF, 0xB5, 0x7F, 0x23, 0x06, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x61, 0xA7, 0x28, 0x24, 0x81, 0x47, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x9C, 0x9E, 0x79, 0xFD, 0x13, 0x9A, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xBD, 0x3B, 0x92, 0x51, 0x06, 0xDD, 0x15 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xA0, 0x57, 0x5A, 0xCF, 0xA7, 0x1F, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x69, 0xC7, 0x6B, 0xF2, 0x3B, 0x9E, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xD8, 0x5A, 0x0C, 0xCD, 0xF9, 0x27, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xE9, 0x34, 0xA4, 0x37, 0x22, 0xC1, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x00, 0x36, 0x04, 0x0E, 0xED, 0x3B, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xC6, 0xCD, 0x23, 0xD5, 0x04, 0x9B, 0xEE ),
+};
+static const mbedtls_mpi_uint secp384r1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x74, 0x8D, 0x7B, 0x3A, 0x5D, 0xF1, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xD6, 0x98, 0x94, 0xB7, 0x05, 0x3B, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x92, 0xDB, 0xEC, 0x9C, 0x01, 0x73, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xF6, 0x6F, 0x4D, 0xDA, 0xBF, 0xFB, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x95, 0x0C, 0xF4, 0x8E, 0x76, 0x48, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x3D, 0x98, 0xFC, 0x6C, 0x91, 0xDA, 0xC1 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xCD, 0x8A, 0x96, 0x49, 0xEF, 0xE4, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xA1, 0xD1, 0x98, 0xB4, 0xA2, 0xEF, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x87, 0x82, 0x03, 0xBF, 0xB2, 0x81, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x0E, 0xCE, 0x38, 0xEB, 0x1B, 0x1A, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xDD, 0xF2, 0x5D, 0x03, 0x57, 0xD5, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x3A, 0x90, 0xB5, 0xB3, 0x17, 0x84, 0x16 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x43, 0x99, 0x68, 0x07, 0x10, 0xA1, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x4B, 0xF9, 0xE6, 0x8F, 0x28, 0xC7, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x20, 0xD5, 0x03, 0xE3, 0x6C, 0xAA, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xE8, 0xA0, 0x6A, 0x62, 0x08, 0xFC, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x1C, 0xD4, 0x75, 0x45, 0x1E, 0x75, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x20, 0x88, 0x27, 0x96, 0x75, 0x4B, 0xFC ),
+};
+static const mbedtls_mpi_uint secp384r1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xBF, 0x23, 0xB7, 0xE6, 0x54, 0xC9, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xE6, 0x69, 0x2E, 0xBF, 0xEF, 0x00, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xAD, 0x13, 0xCC, 0x56, 0x23, 0x06, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x95, 0xDE, 0xF3, 0xF2, 0x30, 0x45, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x9F, 0x34, 0x3A, 0x3A, 0x2E, 0x1D, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x2F, 0xFC, 0x23, 0x83, 0xD5, 0x2A, 0x86 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x36, 0xD1, 0x85, 0x80, 0x81, 0x03, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xA9, 0x23, 0xB0, 0x92, 0xC9, 0xD4, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xF1, 0x5E, 0xA8, 0x49, 0xB7, 0xBF, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x15, 0x52, 0x5C, 0xE9, 0x47, 0xD2, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x19, 0x95, 0x75, 0xE8, 0x0E, 0x74, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xDE, 0xF2, 0x93, 0x2A, 0x46, 0x00, 0x23 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x02, 0x10, 0x59, 0x7F, 0xC9, 0x2A, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x20, 0x27, 0xAB, 0x7C, 0x6A, 0x9C, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xE9, 0xA1, 0x3D, 0x56, 0x9B, 0x23, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x71, 0xAC, 0x0D, 0xB2, 0x1F, 0xD5, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x66, 0x28, 0x56, 0xA2, 0x76, 0x39, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x07, 0x9A, 0xC0, 0x81, 0x85, 0x2E, 0x45 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x2A, 0x03, 0xA6, 0x13, 0x1D, 0xB5, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xE0, 0xEB, 0x17, 0xDF, 0xD8, 0x90, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x94, 0xEE, 0x61, 0x98, 0x35, 0x85, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x59, 0x3D, 0x6A, 0x29, 0xB1, 0x08, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x79, 0x0D, 0x68, 0x50, 0x69, 0xAB, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x4C, 0x9C, 0x88, 0x84, 0x27, 0x40, 0x1D ),
+};
+static const mbedtls_mpi_uint secp384r1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x80, 0xD0, 0x74, 0xCB, 0x01, 0xBB, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xAF, 0x6F, 0xBC, 0x25, 0x93, 0x27, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x65, 0x92, 0x03, 0x9C, 0x84, 0x7F, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xEE, 0x0F, 0x15, 0x00, 0x43, 0x47, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x48, 0xC1, 0x28, 0x15, 0x1C, 0x6B, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x83, 0x7D, 0x03, 0xB5, 0xF8, 0xB9, 0x3D ),
+};
+static const mbedtls_mpi_uint secp384r1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xA4, 0xDE, 0x7B, 0x0F, 0xE6, 0xCC, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0xA9, 0x66, 0xF8, 0xD6, 0xF7, 0x71, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x6B, 0xBE, 0x26, 0xD4, 0xCB, 0x01, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xE0, 0x30, 0x42, 0x33, 0xDF, 0xEF, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x46, 0x55, 0x87, 0x15, 0xF0, 0x2E, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x3B, 0x1A, 0xD6, 0x77, 0x4C, 0xFF, 0x28 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x4E, 0xB3, 0x66, 0xCF, 0x1B, 0x95, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xA4, 0xC8, 0x11, 0x8C, 0x9E, 0x24, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xDF, 0x1D, 0x16, 0x16, 0x37, 0xDA, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x84, 0x51, 0x33, 0x4E, 0x1B, 0xFD, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xA5, 0x08, 0xCD, 0x81, 0xC3, 0xB6, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x4F, 0x99, 0x50, 0xDF, 0x6A, 0xCF, 0xEC ),
+};
+static const mbedtls_mpi_uint secp384r1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x85, 0x32, 0x74, 0x37, 0xFC, 0xC2, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x29, 0xA8, 0xE1, 0xEB, 0x1D, 0x6A, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x10, 0xBB, 0xFC, 0x62, 0xAF, 0x2F, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x87, 0x57, 0x09, 0x71, 0x4F, 0xCA, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x22, 0x92, 0xE9, 0x92, 0xD3, 0xF9, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xDF, 0x76, 0x67, 0xCE, 0x9D, 0x6F, 0x78 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x8C, 0x6E, 0x4C, 0xDF, 0xB8, 0x57, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x4E, 0xAB, 0x9D, 0x57, 0x04, 0xE7, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xAF, 0x4E, 0x40, 0x93, 0x0E, 0x6D, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xDF, 0xC5, 0xEC, 0xD5, 0x6A, 0x7E, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xCC, 0x25, 0x45, 0x26, 0xEC, 0xE8, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x38, 0x05, 0xCD, 0xE7, 0xD0, 0x8C, 0x79 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x8F, 0x8E, 0xE4, 0x62, 0x59, 0xAF, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xD9, 0x09, 0x8E, 0x55, 0x32, 0xD9, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x02, 0x85, 0xB7, 0x2E, 0x38, 0xB9, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x95, 0x82, 0xF2, 0xE2, 0x0A, 0xE0, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x8A, 0x22, 0x1A, 0xCD, 0x22, 0xF5, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x2F, 0x6A, 0x1D, 0x71, 0x87, 0x6C, 0xA9 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x1D, 0x6A, 0x74, 0x67, 0xEF, 0x3F, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xF8, 0x93, 0x42, 0x3C, 0xC7, 0x76, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x11, 0xF4, 0x37, 0x9F, 0x89, 0x93, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xEC, 0x68, 0x17, 0x6D, 0xB0, 0x49, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x1C, 0x84, 0x9A, 0x8A, 0xAC, 0xC9, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xE8, 0xAA, 0x59, 0x85, 0xB4, 0x4E, 0xD8 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x1C, 0x39, 0x3A, 0x5F, 0xD3, 0x7E, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x2A, 0xC8, 0xA6, 0x08, 0x07, 0xE0, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xFB, 0x66, 0xF9, 0x4A, 0xDA, 0x87, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x5F, 0xBE, 0x34, 0x59, 0xF8, 0x3C, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xB2, 0x91, 0xC9, 0x1B, 0x0A, 0x7D, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x22, 0x3A, 0xE1, 0x39, 0xF8, 0x79, 0x87 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xED, 0xE0, 0xDE, 0x4A, 0x0E, 0xA5, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xA0, 0x0E, 0x20, 0x52, 0x64, 0xD1, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x16, 0x6A, 0x65, 0xB8, 0x9C, 0xB5, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x89, 0x1A, 0x70, 0xEE, 0x02, 0xE3, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x97, 0xB8, 0x21, 0x7F, 0x94, 0xB4, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xB3, 0xE5, 0xE8, 0x15, 0xC7, 0xE2, 0x56 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x5E, 0x84, 0x10, 0x54, 0x59, 0x09, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x80, 0x75, 0x0F, 0xAF, 0x74, 0x90, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x65, 0x93, 0x8E, 0xD7, 0x53, 0x24, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xF6, 0x08, 0x15, 0xC9, 0x3E, 0x7C, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xC6, 0x78, 0x3E, 0xAF, 0x80, 0x89, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x01, 0x6C, 0x14, 0x1E, 0xE7, 0xEC, 0xE9 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xC8, 0xEB, 0x61, 0x62, 0x75, 0xF7, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x23, 0x29, 0x79, 0x8D, 0x1B, 0x50, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x9A, 0x03, 0x9A, 0xCC, 0x7A, 0x5E, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x50, 0xD6, 0x15, 0xD7, 0x80, 0xAD, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xB2, 0xEE, 0xA9, 0x35, 0x7F, 0x6D, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x66, 0x9F, 0x6C, 0x7D, 0x53, 0xEF, 0x1C ),
+};
+static const mbedtls_mpi_uint secp384r1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xD3, 0x3F, 0x86, 0x57, 0x68, 0x5E, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xAE, 0x9A, 0x3B, 0x93, 0x9B, 0x51, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x62, 0x06, 0xAE, 0x55, 0x35, 0xE9, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x64, 0x4E, 0xAA, 0x7B, 0x54, 0xDE, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xEE, 0x4F, 0x1C, 0xE6, 0x4B, 0x98, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x48, 0x0A, 0x71, 0x3A, 0x32, 0xB6, 0x23 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x22, 0xD3, 0x6C, 0x3B, 0xB6, 0x95, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x0B, 0xC6, 0x69, 0x8F, 0xB0, 0x3A, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x59, 0xD2, 0xE2, 0x8C, 0xB1, 0xF4, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xBE, 0x74, 0x1F, 0x7F, 0xDC, 0xD0, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x7A, 0xCA, 0x09, 0x38, 0x26, 0x10, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x6D, 0x03, 0xE5, 0x2F, 0x14, 0x6A, 0xA5 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xCA, 0x6A, 0x79, 0x6A, 0x7D, 0x90, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xD1, 0x62, 0xFA, 0xC7, 0x98, 0x33, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x5D, 0x8C, 0xCB, 0xE6, 0xC7, 0xDF, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x35, 0x51, 0xE0, 0x25, 0xBD, 0xC0, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x67, 0x1B, 0x2E, 0x5B, 0xDB, 0x1A, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xD3, 0xBB, 0x2F, 0xD1, 0x9C, 0xD1, 0x8F ),
+};
+static const mbedtls_mpi_uint secp384r1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xBA, 0x6E, 0x2D, 0xC5, 0x73, 0x82, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xA2, 0x46, 0x33, 0xD6, 0x5E, 0x42, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xBC, 0xD3, 0x04, 0xCD, 0x40, 0xD8, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xA0, 0xD4, 0xBD, 0xE3, 0xA4, 0x95, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x0E, 0x63, 0x74, 0x34, 0xFC, 0x03, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x5A, 0x85, 0x82, 0x2C, 0x20, 0x15, 0x46 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x49, 0xEB, 0x83, 0x67, 0x51, 0xC7, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x8B, 0xB2, 0x9A, 0x60, 0x63, 0x71, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xD7, 0xF1, 0x0C, 0x52, 0x12, 0xA1, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x03, 0x87, 0x9F, 0x87, 0xDF, 0xCB, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x98, 0x25, 0x00, 0xA7, 0xF9, 0x2C, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xC2, 0x3D, 0x56, 0xAA, 0x96, 0x9C, 0x9D ),
+};
+static const mbedtls_mpi_uint secp384r1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x11, 0x49, 0x9D, 0xE1, 0xAD, 0xBA, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x9D, 0x15, 0xD3, 0xE5, 0x62, 0xE1, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xB0, 0xE5, 0x4F, 0xEC, 0xEA, 0x60, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x61, 0x04, 0xA2, 0x79, 0x6B, 0x80, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xB7, 0x85, 0xD1, 0xC4, 0xA7, 0xE2, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xED, 0xE9, 0xB0, 0x05, 0xC0, 0xA0, 0x18 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x31, 0xDD, 0x47, 0xC6, 0xB3, 0x82, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xCD, 0x6C, 0x0C, 0x2A, 0x19, 0x5B, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x67, 0x27, 0x9E, 0xBC, 0x77, 0xDE, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xD2, 0xA0, 0xCC, 0x53, 0x43, 0xD5, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x61, 0x81, 0x80, 0xD6, 0xAB, 0x6D, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x7A, 0x48, 0x30, 0xEA, 0xFF, 0xFC, 0x0D ),
+};
+static const mbedtls_mpi_uint secp384r1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x58, 0xCC, 0xC6, 0x2B, 0xC9, 0xCB, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xC8, 0x69, 0x4F, 0xE0, 0x9B, 0x97, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x12, 0x23, 0xFF, 0x2E, 0x9E, 0x9D, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xBA, 0x2F, 0xFA, 0x56, 0x62, 0x1F, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x6D, 0xFA, 0xEB, 0xB0, 0x97, 0x3B, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x40, 0xBC, 0xC0, 0xF5, 0xD3, 0x9A, 0x5E ),
+};
+static const mbedtls_mpi_uint secp384r1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xBF, 0x8F, 0xDD, 0xA4, 0x22, 0xFF, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xDB, 0xFB, 0xD9, 0x68, 0x6B, 0x7E, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x5E, 0x08, 0x90, 0x84, 0x67, 0x5E, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xF5, 0x77, 0x54, 0x27, 0x99, 0x8A, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x01, 0xD1, 0xC3, 0xFD, 0x92, 0x98, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x4F, 0xD1, 0x40, 0xE8, 0xC9, 0x7A, 0xE4 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x54, 0x83, 0x84, 0xB7, 0xAF, 0x76, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x95, 0x58, 0xFD, 0x4B, 0xB8, 0x30, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x4C, 0xDB, 0x13, 0x8A, 0x57, 0xD5, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xB3, 0xE3, 0xC1, 0xB3, 0x03, 0x63, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xDD, 0x40, 0x45, 0x2E, 0x72, 0xD2, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x5A, 0x17, 0xB2, 0xF8, 0xD3, 0x91, 0xA8 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x9C, 0xE1, 0x37, 0xEA, 0xCB, 0x74, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xAB, 0x83, 0xEA, 0x14, 0x2D, 0xC6, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x0B, 0x3A, 0x13, 0x2A, 0xD2, 0x86, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xEA, 0x22, 0xEC, 0x5D, 0x49, 0xA0, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xD4, 0x9D, 0xF4, 0xE8, 0x70, 0x09, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x65, 0x92, 0x48, 0x4B, 0x8D, 0xDF, 0x8B ),
+};
+static const mbedtls_mpi_uint secp384r1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x88, 0xDE, 0x8B, 0xE9, 0x11, 0xD5, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xAC, 0x90, 0xEC, 0xFE, 0x01, 0x66, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xF0, 0x97, 0x65, 0x44, 0xE4, 0x85, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x17, 0x8C, 0x09, 0xD8, 0x59, 0xDB, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x4B, 0x58, 0x49, 0x29, 0xCA, 0x53, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xD4, 0x3A, 0x72, 0x0F, 0x5C, 0x45, 0xD3 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x59, 0x5D, 0xA2, 0xE4, 0xD7, 0x1D, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x14, 0xA2, 0x49, 0x5F, 0x20, 0x09, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x17, 0xC4, 0xD0, 0xDB, 0xC2, 0xA6, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xDB, 0x58, 0x9A, 0x5F, 0x61, 0xC1, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x7C, 0xB4, 0xC9, 0xB9, 0x49, 0x11, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xDD, 0x6C, 0xE4, 0xB3, 0x18, 0x90, 0x61 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x22, 0xE9, 0xBC, 0xBA, 0xD3, 0xE5, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x10, 0x67, 0xEC, 0xFC, 0x7D, 0x7C, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x54, 0x1D, 0xE8, 0xD0, 0xE9, 0x50, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x4F, 0x8F, 0xF5, 0x83, 0xE1, 0x19, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xC7, 0x83, 0x6F, 0x02, 0x58, 0x13, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xD1, 0x7E, 0xB0, 0x32, 0x75, 0x2E, 0x2F ),
+};
+static const mbedtls_mpi_uint secp384r1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xCC, 0x43, 0x11, 0x3F, 0xE9, 0x68, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xCF, 0x62, 0x13, 0x9C, 0x53, 0xE4, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x0D, 0x22, 0x88, 0xDF, 0x33, 0x7A, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x9A, 0x25, 0xA7, 0x71, 0x89, 0xAF, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x07, 0x23, 0x20, 0x1F, 0xAB, 0x2D, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x72, 0x5C, 0xD7, 0xCB, 0x8D, 0x36, 0x9E ),
+};
+static const mbedtls_mpi_uint secp384r1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x11, 0x1C, 0x9E, 0xB1, 0x0F, 0xE7, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x82, 0xB0, 0x7D, 0x05, 0x2F, 0x51, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xE5, 0x45, 0x1B, 0x55, 0xF3, 0x0F, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xA1, 0xDC, 0x35, 0x76, 0xBC, 0x6D, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x64, 0xC3, 0xE7, 0xB9, 0x8A, 0xC2, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xCA, 0x25, 0x53, 0x0F, 0xEB, 0x14, 0x50 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xDA, 0x6D, 0xC5, 0x4D, 0x04, 0x99, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xBB, 0x9F, 0x10, 0xF5, 0xCE, 0xA3, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x19, 0x39, 0xB5, 0x50, 0x07, 0xE9, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x10, 0x52, 0x8A, 0x07, 0x96, 0x29, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xF9, 0xAE, 0x66, 0xF7, 0x52, 0x9B, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x5B, 0x06, 0xC0, 0x81, 0x52, 0x7C, 0x3A ),
+};
+static const mbedtls_mpi_uint secp384r1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x0B, 0x60, 0xAE, 0xFE, 0xF1, 0xAB, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xCC, 0x80, 0x1E, 0x05, 0x95, 0x85, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xF0, 0x4D, 0x8F, 0x7A, 0x4A, 0x8A, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x7B, 0x7C, 0x8F, 0x03, 0x01, 0xE1, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x02, 0x7E, 0xA5, 0x3E, 0xFD, 0xB6, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xC3, 0xB6, 0x06, 0xF9, 0xC4, 0xBA, 0xE4 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_32_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x27, 0x53, 0xE4, 0x97, 0xB0, 0xB0, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x84, 0x01, 0xF4, 0xA9, 0x28, 0x34, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x8F, 0xF6, 0x88, 0x8E, 0xB2, 0x3C, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xD9, 0xB6, 0x6B, 0x08, 0x71, 0x4F, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x49, 0x79, 0xFD, 0x20, 0x1C, 0x15, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x48, 0x57, 0xD9, 0x79, 0xF4, 0x30, 0xBD ),
+};
+static const mbedtls_mpi_uint secp384r1_T_32_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x66, 0xA4, 0xCE, 0x1E, 0xBE, 0xB2, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x23, 0x5C, 0xFA, 0x31, 0xF4, 0x09, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x89, 0x57, 0x7C, 0xF7, 0xA0, 0xEF, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xDB, 0x9C, 0xEE, 0x1D, 0x72, 0x56, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xF8, 0x9E, 0xC4, 0x27, 0xBC, 0x43, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xC7, 0x9A, 0xD8, 0x88, 0x41, 0xA7, 0xA3 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_33_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x74, 0x20, 0x9C, 0xB9, 0x90, 0x4C, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x95, 0xA7, 0x17, 0x57, 0x4B, 0xFC, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x6B, 0x4F, 0x24, 0x51, 0xD5, 0xEA, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x30, 0xE0, 0xE1, 0x3C, 0xC1, 0x10, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xC8, 0xE6, 0x04, 0xE5, 0x25, 0x7E, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x11, 0x92, 0x9B, 0x38, 0xA1, 0xF4, 0x91 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_33_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x86, 0x9E, 0xF3, 0xC6, 0xAD, 0x7E, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xB4, 0xDC, 0x89, 0x3D, 0xD7, 0xF6, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xA3, 0x70, 0x6E, 0x13, 0x90, 0x6F, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x6F, 0x10, 0x7E, 0xAD, 0x2C, 0x66, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x81, 0x45, 0x92, 0xB0, 0x12, 0xF6, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x73, 0x4D, 0xAF, 0x52, 0x1B, 0xC5, 0xB9 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_34_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xE5, 0x46, 0x43, 0x6A, 0xCB, 0xA9, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xA4, 0x94, 0xFD, 0xC9, 0x0E, 0x02, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x5B, 0x72, 0x11, 0x53, 0x74, 0x61, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xB8, 0xCC, 0x94, 0xEB, 0x19, 0x28, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xE6, 0x75, 0x52, 0xF4, 0xA3, 0x8A, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x0B, 0x65, 0x6C, 0xD8, 0x56, 0xEA, 0x8F ),
+};
+static const mbedtls_mpi_uint secp384r1_T_34_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xFE, 0x92, 0xE2, 0x92, 0x9A, 0xB3, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xE3, 0xC0, 0x9B, 0xF8, 0x21, 0x28, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x7D, 0xF5, 0x08, 0xA5, 0x22, 0x6A, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x2C, 0x98, 0xD2, 0xC6, 0x5D, 0x37, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xC3, 0xAD, 0x14, 0xAA, 0x2E, 0x38, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x1D, 0xAA, 0x63, 0x58, 0xC7, 0xAF, 0xF1 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_35_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x54, 0xBD, 0xDC, 0xEF, 0x05, 0xA2, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xF0, 0xCE, 0x9E, 0xF6, 0x67, 0x4C, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x41, 0x8E, 0xC3, 0xD4, 0xB6, 0x21, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x9C, 0xDC, 0xE1, 0xBE, 0x55, 0xE4, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x85, 0x47, 0x35, 0x39, 0x28, 0x9D, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x12, 0xA0, 0xD2, 0xAB, 0x28, 0x03, 0x06 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_35_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xDD, 0xBE, 0x5F, 0xB2, 0x51, 0xDF, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x33, 0x8B, 0x35, 0x4A, 0x60, 0xD9, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x85, 0x40, 0x31, 0x3C, 0x93, 0x64, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xBD, 0x7D, 0x4E, 0xDA, 0x1D, 0xA4, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x2E, 0xF8, 0x17, 0x68, 0xBF, 0x49, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xF1, 0xEC, 0xEE, 0xF8, 0x24, 0x9E, 0x13 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_36_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x7E, 0xAF, 0x6B, 0x17, 0x42, 0x4D, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xD0, 0xA6, 0x6F, 0x62, 0x00, 0xB3, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x86, 0xF4, 0xC1, 0x17, 0x1E, 0xCE, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x71, 0x76, 0x8B, 0x01, 0xB2, 0x71, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xFC, 0x65, 0x20, 0xEE, 0x84, 0xE7, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xB1, 0xCB, 0xC8, 0x19, 0x4E, 0x60, 0x7E ),
+};
+static const mbedtls_mpi_uint secp384r1_T_36_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x2A, 0x9D, 0xF2, 0x54, 0xC9, 0x8B, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xD6, 0xED, 0xF1, 0x72, 0xDD, 0xBD, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xD1, 0xED, 0x5C, 0x7F, 0xF8, 0x38, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x54, 0x2F, 0xD2, 0x16, 0xB0, 0xE3, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xCA, 0xEB, 0xEA, 0x30, 0x1D, 0x70, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xFB, 0x2C, 0x4F, 0xFA, 0x17, 0x44, 0xC3 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_37_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x84, 0x47, 0xA1, 0xF0, 0xE2, 0x14, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x0D, 0x58, 0x7C, 0xB9, 0x10, 0x8F, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xC5, 0x9B, 0x7E, 0x39, 0x60, 0x7A, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xEA, 0xC9, 0xC0, 0x7A, 0xC0, 0xE9, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xC5, 0x5A, 0xDF, 0xD4, 0xAD, 0xE8, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x28, 0x0A, 0x03, 0x66, 0x21, 0x7E, 0x40 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_37_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xB9, 0x66, 0x06, 0x86, 0x11, 0x34, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x69, 0xB9, 0x2E, 0x68, 0xB5, 0xD4, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x5A, 0x32, 0x65, 0x5F, 0x9D, 0x37, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x31, 0x79, 0x33, 0x0A, 0x75, 0xEF, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x8E, 0x27, 0x32, 0x85, 0xF8, 0x07, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x01, 0x15, 0x88, 0xFC, 0x21, 0x0B, 0x16 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_38_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xEC, 0x60, 0x5E, 0x4A, 0xE9, 0x86, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x3D, 0x31, 0xB0, 0x86, 0xA5, 0x90, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xB0, 0x50, 0x40, 0x94, 0xA4, 0x22, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xE4, 0x86, 0x2B, 0xED, 0xEC, 0xA6, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xBA, 0x08, 0x11, 0x73, 0xE1, 0x4A, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x1B, 0x34, 0x3D, 0x79, 0xEF, 0xFF, 0x0D ),
+};
+static const mbedtls_mpi_uint secp384r1_T_38_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x88, 0x4D, 0x81, 0x2B, 0x8B, 0xCE, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x35, 0xDB, 0xF0, 0x60, 0xFF, 0x30, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x38, 0x46, 0x9D, 0x8D, 0x50, 0x6F, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x64, 0x5C, 0x89, 0x0A, 0xDB, 0x3A, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x66, 0x36, 0xEC, 0xFF, 0x5E, 0xB5, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x55, 0x15, 0x2F, 0xEA, 0x47, 0x6E, 0xA3 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_39_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xB3, 0x09, 0x5F, 0x4C, 0x67, 0x24, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x27, 0x2F, 0x8E, 0x9F, 0xCB, 0x00, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x8E, 0x35, 0xEC, 0x6E, 0x1C, 0xF5, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xB3, 0x27, 0xF9, 0xE8, 0xC2, 0x47, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x47, 0x7B, 0x6A, 0x05, 0x16, 0x87, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xB4, 0xE1, 0x1F, 0x37, 0xF3, 0x99, 0x40 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_39_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xA0, 0xFB, 0x8C, 0x4D, 0x55, 0xBB, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xA7, 0x94, 0x3D, 0xE8, 0xE1, 0x9E, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x1B, 0xED, 0x9C, 0x5F, 0x0E, 0x90, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x18, 0x4E, 0xAD, 0x78, 0x4F, 0x23, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xC6, 0xE2, 0x64, 0x29, 0x25, 0x9D, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x45, 0x14, 0xEC, 0x1E, 0xE8, 0x8B, 0xC8 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_40_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x67, 0x16, 0x69, 0xB1, 0x68, 0x7C, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x9A, 0x36, 0x8F, 0x50, 0xB6, 0x7A, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xA6, 0x93, 0x77, 0xDD, 0x95, 0xF6, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x2A, 0xF7, 0xD8, 0x06, 0x7A, 0x3E, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x62, 0xF6, 0x17, 0x1B, 0x34, 0x1B, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xFB, 0x4B, 0x54, 0xD6, 0x58, 0x5A, 0xF1 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_40_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x24, 0x55, 0x1D, 0x6E, 0xEC, 0xCA, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x00, 0x07, 0x16, 0xE5, 0x2B, 0xD7, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x5E, 0xBF, 0xD5, 0x64, 0xD7, 0xD4, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xDF, 0x2A, 0xE3, 0x5D, 0x98, 0x0B, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xB3, 0xCF, 0x92, 0x73, 0xBA, 0x68, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x71, 0xC4, 0x37, 0x1A, 0x08, 0x59, 0x76 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_41_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xE1, 0xF1, 0x6F, 0x99, 0x92, 0xA3, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xB5, 0x2B, 0xB3, 0x1A, 0x98, 0x7B, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xF2, 0x59, 0x80, 0xE6, 0x0E, 0x67, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xBA, 0xE6, 0x1B, 0x0A, 0x91, 0xAA, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xC4, 0xE5, 0x6B, 0x7E, 0xE9, 0xFD, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x53, 0xDE, 0xDE, 0x27, 0xF0, 0xC8, 0x0A ),
+};
+static const mbedtls_mpi_uint secp384r1_T_41_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xA9, 0xAB, 0x70, 0x5E, 0x67, 0x80, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xCA, 0x5F, 0xC9, 0x50, 0x1E, 0x54, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xE1, 0xAE, 0xA3, 0x21, 0x96, 0x13, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xE9, 0x57, 0xA1, 0xC5, 0x0C, 0x72, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x55, 0xB0, 0x01, 0xC3, 0x45, 0xC1, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x8D, 0xF6, 0xDD, 0xA8, 0x66, 0xBC, 0x5A ),
+};
+static const mbedtls_mpi_uint secp384r1_T_42_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x2B, 0x20, 0xEB, 0x6B, 0xA2, 0xC7, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xB2, 0x83, 0x6F, 0xB6, 0xB7, 0x8B, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x5F, 0xC1, 0xF0, 0x53, 0xF5, 0x45, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x04, 0x6D, 0x7D, 0x0F, 0x4C, 0x82, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x3B, 0xD9, 0xAE, 0xF5, 0xAA, 0x26, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x28, 0x16, 0x65, 0xCD, 0x97, 0x32, 0x00 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_42_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x84, 0x09, 0xC3, 0xA6, 0x64, 0x06, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x42, 0x48, 0x7D, 0xEF, 0xC2, 0x5C, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x42, 0x3A, 0xEA, 0x34, 0x4F, 0x50, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x4F, 0x22, 0x3B, 0xBB, 0x93, 0x38, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xC1, 0xCA, 0x92, 0xB1, 0xFF, 0x95, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xF9, 0x4A, 0xA3, 0x1C, 0x28, 0xF2, 0xE8 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_43_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x0D, 0x61, 0xF5, 0x9D, 0x44, 0x00, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x51, 0x2E, 0xD7, 0xC0, 0x0F, 0x44, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x53, 0x5D, 0xD1, 0xBD, 0xE8, 0xFF, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x63, 0xD4, 0x69, 0xAD, 0x3B, 0xDF, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x08, 0x68, 0x5E, 0xE5, 0xA5, 0x78, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x14, 0x72, 0xCC, 0x33, 0xD5, 0x0E, 0x1C ),
+};
+static const mbedtls_mpi_uint secp384r1_T_43_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x8B, 0x96, 0xBB, 0xF0, 0x89, 0x43, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x80, 0xFB, 0xD5, 0x73, 0xD5, 0x9E, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x62, 0xCC, 0x12, 0x0F, 0x6B, 0x6D, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x1A, 0x74, 0xC6, 0xD7, 0xC8, 0x26, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x69, 0x8C, 0x2F, 0xE6, 0x07, 0x1A, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x68, 0xA5, 0xCF, 0xF0, 0xA6, 0x9B, 0xEB ),
+};
+static const mbedtls_mpi_uint secp384r1_T_44_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xAF, 0xD3, 0x60, 0x67, 0x9C, 0x1B, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x40, 0x9E, 0x02, 0x8A, 0x4E, 0x6F, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x9C, 0x4A, 0x46, 0x49, 0x0E, 0xF2, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xCC, 0x0D, 0xC0, 0x3C, 0x57, 0x0A, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x39, 0x5A, 0x43, 0x72, 0x0C, 0xB2, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x7C, 0x4C, 0x89, 0xC0, 0x5E, 0xED, 0xE5 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_44_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x88, 0x4B, 0x44, 0xF6, 0x5F, 0xA8, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xB4, 0xED, 0x3C, 0xDF, 0x57, 0xB0, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x78, 0x50, 0x0F, 0x94, 0x49, 0x06, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xEE, 0x6E, 0x27, 0x1C, 0x98, 0x15, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xBD, 0xEF, 0x1E, 0xBA, 0x77, 0x2A, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x73, 0xCD, 0x35, 0xBE, 0x12, 0x88, 0xA1 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_45_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x3A, 0xB9, 0xD6, 0x8B, 0x00, 0xC3, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xBD, 0xEE, 0xFF, 0x80, 0xA8, 0x18, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xFA, 0xB4, 0xF2, 0x83, 0xF3, 0x28, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x27, 0xDE, 0x96, 0x67, 0x57, 0x2B, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xDC, 0xC8, 0xF4, 0x61, 0xE2, 0xA8, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x6E, 0xCF, 0xA4, 0xFE, 0x9E, 0xD0, 0x09 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_45_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x60, 0x74, 0x5D, 0x8A, 0xEB, 0xE8, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xE4, 0xA4, 0xBE, 0xC6, 0x11, 0x35, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x6F, 0xF4, 0x3E, 0x76, 0xD2, 0x6B, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x76, 0xFD, 0x99, 0x96, 0x20, 0x9A, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xD7, 0x88, 0x43, 0x96, 0x5D, 0xBC, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x95, 0x33, 0x21, 0x35, 0x04, 0xED, 0xE8 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_46_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xAA, 0x45, 0x7E, 0x13, 0xCE, 0x70, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x72, 0x6E, 0x52, 0xD5, 0xAC, 0x03, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x3B, 0x22, 0x95, 0x7E, 0xB1, 0x76, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x57, 0x3D, 0xF5, 0xC3, 0xAA, 0x9C, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x2D, 0x24, 0xC8, 0x57, 0x6F, 0xFA, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x9C, 0x1D, 0x86, 0x02, 0xD7, 0x92, 0xB7 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_46_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x8B, 0xB7, 0x9A, 0x6D, 0xBC, 0xE4, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x5E, 0xD6, 0x34, 0x0E, 0xC2, 0x37, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xC8, 0x6E, 0x30, 0x11, 0x31, 0x6D, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x27, 0x25, 0x87, 0xB5, 0xA7, 0xF1, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xF4, 0x51, 0x29, 0x17, 0xAE, 0xC3, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x51, 0x04, 0xDA, 0x0A, 0xA4, 0xFE, 0x69 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_47_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x4D, 0x09, 0x24, 0xE9, 0x48, 0x18, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x65, 0xEA, 0xF8, 0xF9, 0xE2, 0x42, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x20, 0xAB, 0xCD, 0xB3, 0xF0, 0x0A, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x6A, 0xFD, 0x28, 0x0A, 0x3C, 0xBB, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x78, 0xCA, 0xB5, 0x01, 0x05, 0x1B, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xFB, 0x2D, 0xD6, 0xDD, 0xE9, 0xB3, 0x32 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_47_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x44, 0x4B, 0x9E, 0x03, 0x36, 0xB6, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x32, 0x89, 0x81, 0xA8, 0xEB, 0xD1, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xE9, 0x23, 0x55, 0xD2, 0xFB, 0xEE, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xE2, 0xEB, 0xE9, 0x43, 0xD7, 0x94, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xBA, 0x93, 0xCD, 0x2A, 0x38, 0x96, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x6A, 0x3C, 0x47, 0xCB, 0x59, 0xF3, 0x30 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_48_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x52, 0x01, 0x7F, 0x6E, 0xA8, 0xF5, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x5F, 0x7D, 0xC4, 0x4C, 0x7C, 0x15, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x5C, 0x07, 0x46, 0xAC, 0x6B, 0x5B, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xB4, 0x9B, 0x7A, 0xAC, 0xB0, 0x6F, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x35, 0xBD, 0x9C, 0x78, 0x89, 0x6C, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x62, 0xFB, 0x89, 0x99, 0xD6, 0xFA, 0xAC ),
+};
+static const mbedtls_mpi_uint secp384r1_T_48_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x1F, 0xE8, 0x2B, 0x2B, 0xB0, 0x5E, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x6A, 0xC9, 0x51, 0xE4, 0x59, 0x0E, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xF7, 0xD4, 0xF8, 0x92, 0x79, 0xF3, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x5B, 0xF1, 0x6D, 0x0E, 0xFE, 0x01, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xE9, 0x68, 0xC5, 0xA6, 0xD0, 0xC0, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xCC, 0x79, 0x34, 0xF2, 0xF1, 0x04, 0xB7 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_49_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x08, 0x20, 0x99, 0x3A, 0xD0, 0xC4, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x91, 0x4D, 0x9A, 0x96, 0xF9, 0xB9, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x6C, 0xDE, 0xA0, 0x6B, 0x85, 0x17, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xEC, 0xCE, 0xFF, 0x8E, 0x53, 0x7C, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x90, 0xF2, 0x95, 0xD5, 0xDB, 0x89, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xD2, 0x4B, 0x05, 0xDA, 0xC0, 0x4A, 0x9D ),
+};
+static const mbedtls_mpi_uint secp384r1_T_49_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xCB, 0xC7, 0x7D, 0x2D, 0x9F, 0x9C, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x74, 0xE1, 0x74, 0x84, 0x90, 0xE0, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x23, 0x8C, 0x89, 0xF1, 0x1F, 0xB2, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xD8, 0x38, 0xE5, 0x87, 0x82, 0xFB, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x00, 0x15, 0x98, 0x82, 0x43, 0x17, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xD9, 0xEB, 0xE7, 0x0B, 0xB5, 0x73, 0x45 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_50_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xFC, 0x00, 0x19, 0xD1, 0xC3, 0x9A, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x24, 0xE6, 0x97, 0xDC, 0x9C, 0xC5, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x75, 0xC3, 0xC3, 0x49, 0x64, 0x4B, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x76, 0x26, 0xD1, 0x9A, 0x5C, 0xE2, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x41, 0x3B, 0xA8, 0x48, 0x2C, 0xF8, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x7F, 0x31, 0xE1, 0x27, 0xD5, 0x29, 0x43 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_50_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xA2, 0xC9, 0xF3, 0xED, 0xF7, 0xAB, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xB9, 0x6F, 0x01, 0x6F, 0x81, 0x52, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x86, 0x99, 0xF5, 0xC8, 0x61, 0xB8, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xBC, 0x35, 0xCE, 0xEB, 0x20, 0xF3, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x28, 0x85, 0x9A, 0xB1, 0xB1, 0x5C, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xE0, 0xB7, 0x97, 0x6F, 0x6D, 0x47, 0xB1 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_51_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xB8, 0x0D, 0xA4, 0x32, 0xCF, 0x71, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x29, 0xCF, 0xA3, 0x51, 0xA6, 0x76, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x21, 0xCE, 0x81, 0x14, 0xFB, 0xAF, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xDA, 0xA9, 0xDA, 0xB9, 0xFB, 0xFF, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xEA, 0x38, 0x46, 0xD7, 0xBB, 0x7A, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xE8, 0xF2, 0x35, 0x72, 0x4B, 0x9F, 0xAC ),
+};
+static const mbedtls_mpi_uint secp384r1_T_51_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x28, 0xF6, 0x52, 0x32, 0x97, 0x2B, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x97, 0xCB, 0x80, 0xAF, 0xA0, 0x1B, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x32, 0x2A, 0x07, 0x97, 0x56, 0xBB, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xF1, 0x37, 0xFA, 0x6D, 0x73, 0xB0, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x46, 0x32, 0xDE, 0x81, 0x5F, 0x37, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xE9, 0xE3, 0xA7, 0xA1, 0x36, 0xDD, 0xBB ),
+};
+static const mbedtls_mpi_uint secp384r1_T_52_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x9C, 0x7A, 0x71, 0x38, 0xC8, 0xC3, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xDF, 0x4B, 0xBE, 0xBB, 0xB2, 0x00, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x64, 0x89, 0x53, 0x20, 0xBF, 0xF2, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x64, 0xFD, 0xF0, 0x22, 0x80, 0x31, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x89, 0xDF, 0x08, 0x0B, 0x6B, 0xB4, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x77, 0x70, 0x13, 0xB2, 0x38, 0xBC, 0x78 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_52_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x67, 0xB6, 0xBD, 0x1D, 0x53, 0xA0, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x67, 0x86, 0x9D, 0x9D, 0x0F, 0x44, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xAC, 0xE8, 0xC0, 0x03, 0x3E, 0x9C, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x77, 0x50, 0x88, 0x22, 0x44, 0x47, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x7C, 0x06, 0x90, 0x75, 0xB7, 0xD9, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x53, 0xE4, 0xA4, 0x75, 0x5C, 0x4C, 0x20 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_53_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x8F, 0x85, 0xD5, 0x1A, 0x1C, 0xC9, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xD7, 0x67, 0x73, 0x15, 0xC2, 0x79, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xF4, 0xA9, 0xD0, 0xD0, 0x65, 0x88, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x4B, 0x34, 0x22, 0xFD, 0x6B, 0x7A, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xA2, 0x29, 0x44, 0x76, 0x8F, 0xF4, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x8D, 0xC0, 0xD8, 0xE7, 0x5A, 0x1E, 0xDF ),
+};
+static const mbedtls_mpi_uint secp384r1_T_53_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x1F, 0x48, 0x44, 0x9E, 0x4D, 0x3D, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xEB, 0xF6, 0xA0, 0x44, 0xB4, 0x72, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xA9, 0x2E, 0x28, 0xC2, 0x18, 0x8E, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x45, 0xEB, 0x1C, 0x6B, 0xCE, 0x3F, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x18, 0x99, 0x42, 0xEB, 0xD5, 0xB4, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xF0, 0x4A, 0xAF, 0xE1, 0xB5, 0x4F, 0xA8 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_54_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x0D, 0x85, 0x09, 0xC6, 0xAB, 0xD7, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x2D, 0xC5, 0x19, 0x31, 0x71, 0x67, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xA0, 0x21, 0xE7, 0x9F, 0xC9, 0xC6, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xD6, 0xDB, 0xFC, 0xBF, 0xC4, 0x97, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xC9, 0xFF, 0xE8, 0x94, 0xD4, 0x3A, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xBE, 0xC5, 0x8F, 0x0C, 0xDF, 0xC2, 0x74 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_54_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x20, 0x47, 0xC0, 0x82, 0x9F, 0x3B, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xE5, 0x91, 0x58, 0x5C, 0xB4, 0xED, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x25, 0x13, 0x12, 0x6B, 0xFC, 0x75, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xAE, 0x71, 0x5A, 0x44, 0x1F, 0x13, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xA4, 0x16, 0xC4, 0xF8, 0x9A, 0x37, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x98, 0xDD, 0xEA, 0xC5, 0x9B, 0x11, 0xB8 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_55_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x72, 0x6C, 0xCE, 0xE2, 0x26, 0x15, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x08, 0x73, 0x92, 0xD8, 0x8C, 0x21, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x20, 0xFF, 0x5C, 0x11, 0x16, 0x12, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x9E, 0xE4, 0x1B, 0xF7, 0x26, 0xBB, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x91, 0xF6, 0x7A, 0x93, 0x3F, 0x08, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xBB, 0x4D, 0x2A, 0x2D, 0xA7, 0x9C, 0x9F ),
+};
+static const mbedtls_mpi_uint secp384r1_T_55_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x27, 0x60, 0x8D, 0x51, 0x8E, 0x39, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x31, 0x91, 0xF7, 0x2F, 0xFE, 0x0D, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xD2, 0xBF, 0x7F, 0xB1, 0xEB, 0x14, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xE6, 0x0C, 0x73, 0x0C, 0x0C, 0xB7, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xC8, 0x98, 0x76, 0xF9, 0xAC, 0xEC, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x17, 0xD0, 0xF4, 0xD9, 0x93, 0x9F, 0x95 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_56_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x16, 0x96, 0x35, 0x25, 0x46, 0x7D, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x5D, 0x46, 0xCB, 0x6A, 0xFD, 0xFD, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xCE, 0x59, 0x02, 0xA1, 0x88, 0x7B, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x70, 0xB9, 0x8B, 0x9B, 0x4B, 0xEE, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x81, 0xBF, 0x04, 0xD1, 0xF2, 0xBF, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x3B, 0xE3, 0x02, 0x56, 0xEB, 0xB8, 0xE2 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_56_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x5A, 0xAA, 0xE1, 0x8E, 0x91, 0x6E, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x68, 0xEE, 0x6E, 0xCE, 0x79, 0x27, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x48, 0x4E, 0x36, 0x34, 0x0A, 0x2F, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x03, 0x0C, 0xA0, 0x78, 0x38, 0x14, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x23, 0x8D, 0x17, 0xEF, 0x56, 0xE9, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x5C, 0x7B, 0xEB, 0xE9, 0xBD, 0x0C, 0x21 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_57_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x3D, 0x42, 0x2A, 0xB7, 0x1D, 0x6B, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xA2, 0xD9, 0x5A, 0xE6, 0x77, 0x02, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x7F, 0x0F, 0xC8, 0x54, 0xFF, 0x09, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xE5, 0x3E, 0xB8, 0x8F, 0x02, 0xB2, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x2D, 0xE2, 0xAA, 0x60, 0xF6, 0xF7, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x17, 0x3A, 0x66, 0x7E, 0xB4, 0xDE, 0x53 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_57_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x93, 0xCE, 0xAD, 0x26, 0x3A, 0x7F, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0xD7, 0x0C, 0x54, 0x44, 0x8E, 0xC6, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x99, 0x82, 0x6E, 0xDD, 0x96, 0xB9, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x2E, 0x9A, 0x35, 0x36, 0x2F, 0x82, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x00, 0xC1, 0x80, 0x33, 0x2C, 0x2E, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x94, 0x99, 0x8D, 0x95, 0x6F, 0x9B, 0xE6 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_58_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xAA, 0x88, 0x5C, 0x29, 0x16, 0x11, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x67, 0xF3, 0x6E, 0x97, 0x9F, 0x0B, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xB0, 0x04, 0xE0, 0x0F, 0x4E, 0xCD, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x36, 0xF8, 0x15, 0x3F, 0x0E, 0x1C, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x54, 0xAA, 0xFA, 0xA5, 0x95, 0xDF, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xDE, 0xC7, 0xF2, 0xBD, 0x62, 0xB4, 0x6F ),
+};
+static const mbedtls_mpi_uint secp384r1_T_58_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xDF, 0x28, 0xE0, 0xAE, 0x21, 0x57, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x0E, 0xBE, 0x91, 0x38, 0x6B, 0xA0, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x46, 0xB2, 0x1E, 0x17, 0x9C, 0x7C, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xC3, 0x67, 0x74, 0x68, 0xCF, 0x23, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x1A, 0x68, 0x2C, 0x3E, 0x38, 0xA4, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xFF, 0xA6, 0xA5, 0xB6, 0x04, 0x13, 0x64 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_59_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x0E, 0xBD, 0x0A, 0x7C, 0x19, 0xF5, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x62, 0x22, 0x95, 0x2F, 0xE0, 0x55, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x75, 0x24, 0x27, 0xFE, 0x45, 0xD7, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x6C, 0xBB, 0xD5, 0x7B, 0xB1, 0xEA, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xCA, 0xF7, 0x9F, 0x8D, 0x83, 0x16, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xFA, 0xE5, 0xE5, 0xA4, 0xA2, 0xD5, 0xC3 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_59_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xC9, 0x5E, 0x1C, 0xC6, 0x9D, 0x87, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x57, 0x48, 0x4E, 0x05, 0x50, 0xEB, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x86, 0x13, 0x02, 0xEA, 0xD2, 0xD8, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xC7, 0x41, 0x10, 0x34, 0xE2, 0x1D, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x16, 0x35, 0x5D, 0x1F, 0xEC, 0x8E, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xD5, 0xB9, 0x5C, 0x19, 0xF9, 0xB6, 0x74 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_60_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x25, 0x51, 0x63, 0x2D, 0xA4, 0xD7, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x51, 0x40, 0x1A, 0x1C, 0x3A, 0xC7, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x61, 0x5B, 0xE9, 0x6A, 0x8F, 0x44, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xE4, 0xB9, 0x9B, 0x06, 0x93, 0xDB, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x9A, 0xA6, 0x55, 0x01, 0x53, 0xF8, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xB5, 0x71, 0x90, 0xDA, 0x03, 0xF3, 0x56 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_60_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x20, 0x33, 0xA8, 0x21, 0x84, 0x76, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x9D, 0x02, 0xAB, 0x29, 0x65, 0x10, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xD2, 0xE8, 0x96, 0xCE, 0xBA, 0x17, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xE1, 0xAC, 0x1C, 0xFC, 0x1A, 0xD9, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xC4, 0x0D, 0x20, 0xFF, 0xCC, 0x5E, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xCC, 0x06, 0x1E, 0xEB, 0x75, 0x22, 0xB7 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_61_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x91, 0xB1, 0xE8, 0xFA, 0x3A, 0x13, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xC1, 0x96, 0xDA, 0x55, 0x59, 0x44, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x5B, 0xBC, 0xB8, 0x49, 0x23, 0x01, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x8B, 0x3C, 0x25, 0xF7, 0x73, 0xFE, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x15, 0x4A, 0x38, 0xE9, 0x07, 0xB2, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x99, 0xA8, 0xC0, 0x9E, 0x25, 0x10, 0x60 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_61_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x99, 0x8C, 0xC0, 0xA7, 0x49, 0x65, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xF3, 0xF5, 0xB0, 0x04, 0xD4, 0xA2, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xF8, 0x60, 0xAF, 0x4A, 0xC4, 0xCB, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x56, 0x7D, 0x25, 0xF1, 0xAB, 0x7C, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x1C, 0xF3, 0xFC, 0x89, 0x8D, 0x31, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xBD, 0xAD, 0x9D, 0x18, 0xDF, 0x92, 0xA5 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_62_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x54, 0x72, 0x82, 0xCC, 0xD1, 0x1A, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xEC, 0x3C, 0x9A, 0x53, 0x6C, 0xB4, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x3F, 0xEC, 0xA5, 0x3D, 0x88, 0x6A, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x4C, 0x02, 0x3D, 0x31, 0xEF, 0xD1, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x8F, 0xB9, 0x1F, 0x91, 0x25, 0x59, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x31, 0xD8, 0xBF, 0x11, 0x57, 0x78, 0x30 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_62_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x3C, 0x80, 0xA8, 0x56, 0x41, 0xD4, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xEC, 0xDE, 0x1F, 0x9A, 0xCF, 0xF9, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x63, 0x9F, 0x82, 0x84, 0x11, 0x34, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x95, 0x4F, 0x9A, 0xFB, 0x11, 0xDD, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xD3, 0x4D, 0x3E, 0xAD, 0xB7, 0xC7, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x33, 0x04, 0x05, 0x0C, 0x46, 0x1B, 0x8C ),
+};
+static const mbedtls_mpi_uint secp384r1_T_63_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x2A, 0xD7, 0xB1, 0xCC, 0x07, 0x20, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x22, 0x15, 0xCB, 0xF2, 0xFC, 0xD9, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x65, 0xC4, 0xF6, 0x80, 0x13, 0xDB, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xF6, 0xFB, 0x2E, 0xC3, 0x2B, 0xED, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xE0, 0x4B, 0x75, 0x86, 0x99, 0xAA, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xB3, 0x07, 0x79, 0x61, 0xBE, 0x79, 0x12 ),
+};
+static const mbedtls_mpi_uint secp384r1_T_63_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x29, 0x74, 0xE5, 0x50, 0xA9, 0xD7, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x3F, 0x66, 0x27, 0x5B, 0x7D, 0xC2, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xA0, 0xCB, 0x81, 0xE8, 0xF3, 0x8A, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x46, 0x33, 0xBC, 0xAC, 0xBF, 0x3C, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x36, 0x51, 0xC3, 0xFD, 0x2F, 0xE2, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x63, 0x2D, 0xD9, 0xA8, 0x83, 0xD0, 0x5E ),
+};
+static const mbedtls_ecp_point secp384r1_T[64] = {
+    ECP_POINT_INIT_XY_Z1(secp384r1_T_0_X, secp384r1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_1_X, secp384r1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_2_X, secp384r1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_3_X, secp384r1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_4_X, secp384r1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_5_X, secp384r1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_6_X, secp384r1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_7_X, secp384r1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_8_X, secp384r1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_9_X, secp384r1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_10_X, secp384r1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_11_X, secp384r1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_12_X, secp384r1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_13_X, secp384r1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_14_X, secp384r1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_15_X, secp384r1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_16_X, secp384r1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_17_X, secp384r1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_18_X, secp384r1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_19_X, secp384r1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_20_X, secp384r1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_21_X, secp384r1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_22_X, secp384r1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_23_X, secp384r1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_24_X, secp384r1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_25_X, secp384r1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_26_X, secp384r1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_27_X, secp384r1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_28_X, secp384r1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_29_X, secp384r1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_30_X, secp384r1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_31_X, secp384r1_T_31_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_32_X, secp384r1_T_32_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_33_X, secp384r1_T_33_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_34_X, secp384r1_T_34_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_35_X, secp384r1_T_35_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_36_X, secp384r1_T_36_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_37_X, secp384r1_T_37_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_38_X, secp384r1_T_38_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_39_X, secp384r1_T_39_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_40_X, secp384r1_T_40_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_41_X, secp384r1_T_41_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_42_X, secp384r1_T_42_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_43_X, secp384r1_T_43_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_44_X, secp384r1_T_44_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_45_X, secp384r1_T_45_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_46_X, secp384r1_T_46_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_47_X, secp384r1_T_47_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_48_X, secp384r1_T_48_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_49_X, secp384r1_T_49_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_50_X, secp384r1_T_50_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_51_X, secp384r1_T_51_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_52_X, secp384r1_T_52_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_53_X, secp384r1_T_53_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_54_X, secp384r1_T_54_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_55_X, secp384r1_T_55_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_56_X, secp384r1_T_56_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_57_X, secp384r1_T_57_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_58_X, secp384r1_T_58_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_59_X, secp384r1_T_59_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_60_X, secp384r1_T_60_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_61_X, secp384r1_T_61_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_62_X, secp384r1_T_62_Y),
+    ECP_POINT_INIT_XY_Z0(secp384r1_T_63_X, secp384r1_T_63_Y),
+};
+#else
+#define secp384r1_T NULL
+#endif
+
+#endif /* MBEDTLS_ECP_DP_SECP384R1_ENABLED */
+
+/*
+ * Domain parameters for secp521r1
+ */
+#if defined(MBEDTLS_ECP_DP_SECP521R1_ENABLED)
+static const mbedtls_mpi_uint secp521r1_p[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_2( 0xFF, 0x01 ),
+};
+static const mbedtls_mpi_uint secp521r1_b[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x3F, 0x50, 0x6B, 0xD4, 0x1F, 0x45, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x34, 0x2C, 0x3D, 0x88, 0xDF, 0x73, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xBF, 0xB1, 0x3B, 0xBD, 0xC0, 0x52, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x93, 0x7E, 0xEC, 0x51, 0x39, 0x19, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x09, 0xF1, 0x8E, 0x91, 0x89, 0xB4, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x15, 0xB3, 0x99, 0x5B, 0x72, 0xDA, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x40, 0x85, 0xB6, 0xA0, 0x21, 0x9A, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x9A, 0x1C, 0x8E, 0x61, 0xB9, 0x3E, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_2( 0x51, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_gx[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xBD, 0xE5, 0xC2, 0x31, 0x7E, 0x7E, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x42, 0x6A, 0x85, 0xC1, 0xB3, 0x48, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xA8, 0xFF, 0xA2, 0x27, 0xC1, 0x1D, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x59, 0xE7, 0xEF, 0x77, 0x5E, 0x4B, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x3D, 0x4D, 0x6B, 0x60, 0xAF, 0x28, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xB5, 0x3F, 0x05, 0x39, 0x81, 0x64, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xB4, 0x95, 0x23, 0x66, 0xCB, 0x3E, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xE9, 0x04, 0x04, 0xB7, 0x06, 0x8E, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_2( 0xC6, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_gy[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x66, 0xD1, 0x9F, 0x76, 0x94, 0xBE, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xC2, 0x72, 0xA2, 0x86, 0x70, 0x3C, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x07, 0xAD, 0x3F, 0x01, 0xB9, 0x50, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x26, 0xF4, 0x5E, 0x99, 0x72, 0xEE, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x66, 0x3E, 0x27, 0x17, 0xBD, 0xAF, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x44, 0x9B, 0x57, 0x49, 0x44, 0xF5, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x1B, 0x7D, 0x2C, 0xB4, 0x5F, 0x8A, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xC0, 0x3B, 0x9A, 0x78, 0x6A, 0x29, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_2( 0x18, 0x01 ),
+};
+static const mbedtls_mpi_uint secp521r1_n[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x64, 0x38, 0x91, 0x1E, 0xB7, 0x6F, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x47, 0x9C, 0x89, 0xB8, 0xC9, 0xB5, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xA5, 0x09, 0xF7, 0x48, 0x01, 0xCC, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x96, 0x2F, 0xBF, 0x83, 0x87, 0x86, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_2( 0xFF, 0x01 ),
+};
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
+static const mbedtls_mpi_uint secp521r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xBD, 0xE5, 0xC2, 0x31, 0x7E, 0x7E, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x42, 0x6A, 0x85, 0xC1, 0xB3, 0x48, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xA8, 0xFF, 0xA2, 0x27, 0xC1, 0x1D, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x59, 0xE7, 0xEF, 0x77, 0x5E, 0x4B, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x3D, 0x4D, 0x6B, 0x60, 0xAF, 0x28, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xB5, 0x3F, 0x05, 0x39, 0x81, 0x64, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xB4, 0x95, 0x23, 0x66, 0xCB, 0x3E, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xE9, 0x04, 0x04, 0xB7, 0x06, 0x8E, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x66, 0xD1, 0x9F, 0x76, 0x94, 0xBE, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xC2, 0x72, 0xA2, 0x86, 0x70, 0x3C, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x07, 0xAD, 0x3F, 0x01, 0xB9, 0x50, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x26, 0xF4, 0x5E, 0x99, 0x72, 0xEE, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x66, 0x3E, 0x27, 0x17, 0xBD, 0xAF, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x44, 0x9B, 0x57, 0x49, 0x44, 0xF5, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x1B, 0x7D, 0x2C, 0xB4, 0x5F, 0x8A, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xC0, 0x3B, 0x9A, 0x78, 0x6A, 0x29, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xB1, 0x2D, 0xEB, 0x27, 0x2F, 0xE8, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x4B, 0x44, 0x25, 0xDB, 0x5C, 0x5F, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x85, 0x28, 0x78, 0x2E, 0x75, 0x34, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x57, 0x0F, 0x73, 0x78, 0x7A, 0xE3, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xD8, 0xEC, 0xDC, 0xDA, 0x04, 0xAD, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x8A, 0x09, 0xF3, 0x58, 0x79, 0xD8, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x03, 0xCB, 0x50, 0x1A, 0x7F, 0x56, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xA6, 0x78, 0x38, 0x85, 0x67, 0x0B, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xD5, 0xD2, 0x22, 0xC4, 0x00, 0x3B, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x93, 0x0E, 0x7B, 0x85, 0x51, 0xC3, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xA6, 0x5F, 0x54, 0x49, 0x02, 0x81, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xE9, 0x6B, 0x3A, 0x92, 0xE7, 0x72, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x5F, 0x28, 0x9E, 0x91, 0x27, 0x88, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x28, 0x31, 0xB3, 0x84, 0xCA, 0x12, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xF9, 0xAC, 0x22, 0x10, 0x0A, 0x64, 0x41 ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xC6, 0x33, 0x1F, 0x69, 0x19, 0x18, 0xBF ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
 };
@@ -2184,12 +4473,1487 @@ static const mbedtls_ecp_point secp521r1_T[32] = {
     ECP_POINT_INIT_XY_Z0(secp521r1_T_30_X, secp521r1_T_30_Y),
     ECP_POINT_INIT_XY_Z0(secp521r1_T_31_X, secp521r1_T_31_Y),
 };
-#else
-#define secp521r1_T NULL
-#endif
-#endif /* MBEDTLS_ECP_DP_SECP521R1_ENABLED */
-
-#if defined(MBEDTLS_ECP_DP_SECP192K1_ENABLED)
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp521r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xBD, 0xE5, 0xC2, 0x31, 0x7E, 0x7E, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x42, 0x6A, 0x85, 0xC1, 0xB3, 0x48, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xA8, 0xFF, 0xA2, 0x27, 0xC1, 0x1D, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x59, 0xE7, 0xEF, 0x77, 0x5E, 0x4B, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x3D, 0x4D, 0x6B, 0x60, 0xAF, 0x28, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xB5, 0x3F, 0x05, 0x39, 0x81, 0x64, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xB4, 0x95, 0x23, 0x66, 0xCB, 0x3E, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xE9, 0x04, 0x04, 0xB7, 0x06, 0x8E, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x66, 0xD1, 0x9F, 0x76, 0x94, 0xBE, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xC2, 0x72, 0xA2, 0x86, 0x70, 0x3C, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x07, 0xAD, 0x3F, 0x01, 0xB9, 0x50, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x26, 0xF4, 0x5E, 0x99, 0x72, 0xEE, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x66, 0x3E, 0x27, 0x17, 0xBD, 0xAF, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x44, 0x9B, 0x57, 0x49, 0x44, 0xF5, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x1B, 0x7D, 0x2C, 0xB4, 0x5F, 0x8A, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xC0, 0x3B, 0x9A, 0x78, 0x6A, 0x29, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xBC, 0xE8, 0xF3, 0x87, 0x58, 0xEF, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x75, 0xD8, 0xCD, 0x53, 0xA9, 0xA5, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xE2, 0x0B, 0xAD, 0xEF, 0x7C, 0x24, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xB1, 0xBC, 0xBB, 0xE2, 0x79, 0x7B, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xE9, 0xDD, 0xD9, 0xF5, 0x1D, 0xCD, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x17, 0xAD, 0xD0, 0x0C, 0xE5, 0x6F, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xAA, 0x9A, 0xA9, 0xD3, 0x0D, 0xB1, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x3C, 0x38, 0x68, 0x9C, 0x17, 0xE3, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xDD, 0xCE, 0x2E, 0xB9, 0xDC, 0x70, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xF2, 0x4F, 0xB5, 0xB7, 0xF0, 0xF7, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x13, 0xF5, 0xAB, 0xA6, 0xA4, 0x8F, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x1D, 0xE1, 0xD0, 0x9D, 0x67, 0x65, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x78, 0xDE, 0xC5, 0x90, 0x70, 0xB2, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x25, 0xA1, 0x4D, 0x08, 0xDA, 0x74, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x6C, 0xD2, 0x4A, 0x99, 0xF8, 0xE6, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xD0, 0xE7, 0x2B, 0x6F, 0xB2, 0x54, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x2C, 0xE4, 0x57, 0x99, 0x41, 0x5A, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x80, 0x7D, 0xD8, 0x59, 0xE2, 0xEB, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xA1, 0xC7, 0x67, 0x33, 0x26, 0x82, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x34, 0x94, 0xFC, 0x0B, 0xD8, 0xC4, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x65, 0xB9, 0x00, 0x56, 0x3D, 0x20, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x36, 0xFD, 0x38, 0xF0, 0x71, 0x0A, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xAA, 0x75, 0xDC, 0xF1, 0x86, 0xDD, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xAD, 0x1A, 0x7D, 0xC3, 0x79, 0x7C, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x50, 0x8E, 0xFA, 0xC5, 0x17, 0xFA, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xFF, 0x87, 0x69, 0xE7, 0x1F, 0xEC, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xF1, 0xFE, 0x4F, 0x9A, 0xF3, 0xAB, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xE0, 0xAB, 0x6C, 0x6E, 0x77, 0x73, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xC8, 0x47, 0x69, 0xC3, 0x1A, 0xF8, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x59, 0x85, 0x93, 0x2B, 0xF0, 0x65, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x1D, 0xF6, 0x3E, 0x61, 0x72, 0xCB, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x19, 0x17, 0xD4, 0x8E, 0x01, 0x81, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x91, 0xD3, 0x1F, 0x5E, 0x29, 0x8F, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xC1, 0xB8, 0x12, 0xA5, 0x11, 0xAA, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x99, 0x7D, 0xC2, 0xA3, 0x27, 0xB8, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xB7, 0x02, 0x5A, 0x0A, 0xF7, 0x98, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x52, 0x6B, 0x83, 0x3A, 0xF7, 0xEF, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xB0, 0x8B, 0x6B, 0x87, 0xD8, 0x9A, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xAE, 0xBD, 0xF8, 0xEB, 0xB3, 0x35, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x90, 0x4C, 0x2C, 0x04, 0x44, 0x54, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x07, 0x02, 0x4D, 0x50, 0x83, 0xFF, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xD4, 0x06, 0x33, 0xD2, 0x38, 0x45, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xE3, 0x2A, 0xE3, 0xBA, 0x60, 0xF8, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x2C, 0x9C, 0x5D, 0xC2, 0x5D, 0x6B, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x38, 0x5B, 0xA4, 0x2F, 0xEB, 0x2E, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x32, 0xD9, 0x5C, 0x10, 0x67, 0xBB, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x50, 0x41, 0xD4, 0xB0, 0xA7, 0x57, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xEB, 0x29, 0xB6, 0xD2, 0x6F, 0x96, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x74, 0xB0, 0x74, 0x22, 0x4E, 0x6F, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x9A, 0x63, 0x91, 0x08, 0xCD, 0xB4, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xCB, 0x1D, 0x0F, 0x6A, 0x78, 0x66, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xF1, 0xCA, 0x75, 0xD6, 0x3E, 0xF3, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x94, 0x24, 0xF3, 0x07, 0xC7, 0x54, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xF6, 0xCF, 0x9B, 0xF0, 0x4D, 0x23, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x7E, 0x3E, 0x9F, 0x79, 0xD5, 0xCD, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x72, 0x02, 0x06, 0x94, 0x5E, 0xFF, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x34, 0xED, 0x4D, 0x8A, 0x04, 0x67, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xF6, 0x26, 0x8E, 0x62, 0x05, 0x1A, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x8F, 0x23, 0x95, 0x93, 0xBC, 0x11, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x2B, 0x69, 0x91, 0xE3, 0xCE, 0x68, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x60, 0x52, 0xF4, 0xE8, 0xE2, 0x55, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x1B, 0xF8, 0xEF, 0x19, 0x32, 0x4B, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xBE, 0xBB, 0x3F, 0xAA, 0x9C, 0xDC, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x5D, 0x73, 0x5F, 0x4F, 0x7D, 0x59, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xFF, 0x4D, 0xBE, 0x1C, 0xD3, 0xA2, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xD7, 0xD5, 0x81, 0x61, 0x29, 0xE9, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x18, 0xA7, 0x8F, 0x4B, 0x07, 0x2D, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xE7, 0xFB, 0xA4, 0x0C, 0x97, 0x45, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x96, 0xD7, 0x68, 0xA1, 0x7B, 0x36, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x07, 0x02, 0x1B, 0x6F, 0x27, 0x8A, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x62, 0x40, 0x79, 0x64, 0x55, 0xF8, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x88, 0x9B, 0x06, 0x38, 0xFF, 0x81, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x4C, 0xD7, 0x04, 0xF9, 0x03, 0xB2, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x49, 0xF4, 0x1A, 0x76, 0x37, 0x3F, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x68, 0x55, 0xFA, 0xBC, 0xD0, 0x75, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xA5, 0x58, 0x32, 0x0F, 0x09, 0x1D, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xF6, 0x3B, 0xA6, 0xAD, 0x04, 0x23, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xD9, 0x28, 0x32, 0x39, 0x2E, 0x12, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x44, 0xDB, 0x0B, 0xC2, 0x74, 0xA0, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x9B, 0xD5, 0x1B, 0xAD, 0x7A, 0x25, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x74, 0x3E, 0x7C, 0x06, 0x98, 0x37, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xB0, 0x36, 0x1E, 0x60, 0xA2, 0x0E, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xE8, 0x4E, 0x9C, 0xDE, 0x78, 0x06, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x83, 0xE9, 0xEC, 0x82, 0x7F, 0x87, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x54, 0x1E, 0x1A, 0x05, 0xCA, 0x74, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xFD, 0xD4, 0xCF, 0x0C, 0xCC, 0xB6, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x51, 0x9D, 0xA8, 0x9B, 0xD9, 0x9C, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xD0, 0x34, 0xF6, 0x1D, 0x2A, 0x4A, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x05, 0x5B, 0xD4, 0x6A, 0x54, 0x56, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x8B, 0x50, 0x35, 0xD6, 0x74, 0xA2, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x11, 0x37, 0xD9, 0xB9, 0xAA, 0xEE, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xE6, 0x5A, 0x15, 0x9C, 0xAA, 0x2A, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xF5, 0xF2, 0x2F, 0x8F, 0x37, 0x6E, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x7D, 0x25, 0x2B, 0x2E, 0xF4, 0xD0, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xD1, 0x5B, 0x41, 0x76, 0x0E, 0xE0, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x33, 0x61, 0xBC, 0x68, 0xC3, 0x83, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x0E, 0x83, 0xFC, 0x19, 0x88, 0xEB, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xB7, 0x74, 0xF1, 0xB3, 0x30, 0x93, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xAF, 0x8D, 0x5F, 0x7E, 0xAE, 0xFE, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xD2, 0x0D, 0xED, 0x7F, 0x20, 0xF2, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x9E, 0xD4, 0xBA, 0x75, 0x9B, 0x37, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xCD, 0x4C, 0xA3, 0x8E, 0xF2, 0x18, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x60, 0xC6, 0x28, 0x1C, 0x89, 0x60, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x84, 0xF2, 0x66, 0x74, 0x1F, 0x83, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xA8, 0xC5, 0xBB, 0x86, 0xA7, 0x2D, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xFB, 0x15, 0xF5, 0x02, 0x59, 0xFC, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xC5, 0x9F, 0x48, 0x86, 0x4A, 0x19, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x07, 0x05, 0x5F, 0xB4, 0x5F, 0xC3, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x57, 0xAD, 0x43, 0x6D, 0x3B, 0x21, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x4C, 0x0A, 0xBA, 0x94, 0xAF, 0x68, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x74, 0xD2, 0xE7, 0x3B, 0xEC, 0xA2, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xFA, 0xD2, 0xB9, 0xF2, 0x97, 0x97, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x8F, 0xED, 0xB0, 0x88, 0x7C, 0x69, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xF5, 0xC0, 0x4F, 0x23, 0xEE, 0xE2, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x67, 0x3E, 0x76, 0x60, 0xC0, 0xEB, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x54, 0x32, 0xDE, 0xA5, 0x85, 0xDF, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xD2, 0x8C, 0x43, 0xDA, 0x40, 0xB0, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xFC, 0x31, 0x66, 0x9B, 0x73, 0xAA, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x32, 0xD5, 0x24, 0xD9, 0xEC, 0x76, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x0E, 0x3C, 0xAD, 0xEE, 0x9E, 0xBD, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x60, 0x77, 0x83, 0xB9, 0x91, 0x00, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x58, 0x10, 0xAA, 0x08, 0x35, 0x62, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x29, 0x41, 0x4B, 0xA7, 0x61, 0x3E, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x73, 0x21, 0xF2, 0xF4, 0x07, 0x3D, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xE8, 0xDE, 0x51, 0xC6, 0x3A, 0x6D, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xFB, 0x9F, 0xF9, 0xCD, 0xE7, 0xAA, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x03, 0x19, 0x7B, 0xF3, 0xDB, 0x8D, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x52, 0x4A, 0x03, 0x56, 0x18, 0x51, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xE6, 0xA4, 0xFC, 0x8F, 0x07, 0x2A, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x10, 0x46, 0x67, 0xB0, 0xD4, 0x8D, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x7B, 0x36, 0x3D, 0x23, 0xBA, 0x5A, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x1E, 0x04, 0x4A, 0x1B, 0x13, 0xCC, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xA8, 0x7E, 0x79, 0x2A, 0xBB, 0x72, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xDB, 0x1D, 0x95, 0x45, 0x77, 0xC5, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xC2, 0xDF, 0xC3, 0xF9, 0x7D, 0x4E, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x53, 0x79, 0xF0, 0x0D, 0x71, 0xAB, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x6B, 0xE2, 0xA9, 0x1E, 0x54, 0x18, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x64, 0x04, 0xB7, 0xE1, 0xC4, 0xAD, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x2E, 0x47, 0x73, 0x53, 0xC0, 0x43, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x82, 0xA6, 0x38, 0x94, 0x14, 0x06, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x21, 0x9A, 0xD6, 0x3C, 0x81, 0x2D, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x4B, 0x05, 0x7C, 0xC9, 0xD7, 0x04, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xAE, 0xAC, 0x89, 0xBA, 0x1C, 0x68, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xA0, 0x23, 0x68, 0x17, 0x47, 0x5D, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x2D, 0x43, 0x3C, 0x1A, 0x46, 0xDF, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x4F, 0xD0, 0xC6, 0x0A, 0x49, 0x46, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xDC, 0xFE, 0xE8, 0x40, 0x1D, 0x60, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x87, 0x09, 0xEC, 0xC1, 0x6F, 0x5D, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x25, 0x2E, 0x34, 0xD7, 0x78, 0xA1, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x02, 0x6D, 0x45, 0x3A, 0x87, 0x21, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x3E, 0x3E, 0xB6, 0x3C, 0xE0, 0x77, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x72, 0x11, 0x86, 0x20, 0x43, 0xB6, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xB1, 0x85, 0x48, 0xEF, 0xCC, 0xDB, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x67, 0x8D, 0x87, 0xF3, 0xAA, 0xDD, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xB3, 0x5C, 0x27, 0x43, 0x96, 0x42, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x3A, 0x6B, 0x50, 0x6B, 0x79, 0xA3, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xCE, 0x00, 0xA8, 0xDB, 0xF3, 0xDC, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x5B, 0x49, 0xC0, 0xD9, 0x9C, 0x3C, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xC3, 0xB8, 0x1B, 0xC0, 0xE4, 0x94, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xD4, 0x85, 0xA8, 0xA8, 0xDE, 0xEE, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x15, 0x92, 0x94, 0xAA, 0xED, 0x76, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xD8, 0xAD, 0x58, 0xAA, 0x92, 0x7F, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xF8, 0x58, 0xB4, 0xA4, 0xD6, 0xC0, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x98, 0xD0, 0xEC, 0x42, 0x5D, 0x44, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x7D, 0xBE, 0x92, 0xB0, 0xD2, 0x9D, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x36, 0xF8, 0xAF, 0x5F, 0x86, 0x97, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xCF, 0x52, 0x7C, 0xC8, 0xE5, 0x84, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xBF, 0xFA, 0x00, 0x14, 0x7A, 0xDE, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xEF, 0x86, 0xA7, 0xDA, 0xEC, 0x4F, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xF5, 0xDC, 0x26, 0xD1, 0x9C, 0x57, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xD9, 0xB8, 0xFE, 0x89, 0xC0, 0x28, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x4A, 0xBB, 0x41, 0x8E, 0xFA, 0xDF, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xFE, 0xE1, 0x90, 0xE1, 0x8C, 0x5F, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x17, 0x9C, 0x40, 0xA1, 0x1E, 0x07, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xED, 0x29, 0x56, 0x56, 0x54, 0x03, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x3D, 0x3A, 0x90, 0x0C, 0x8E, 0xCD, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x41, 0xAC, 0xAF, 0x0E, 0x38, 0x5D, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xDC, 0x01, 0x50, 0x71, 0xF5, 0x2E, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xFB, 0x05, 0x32, 0x4C, 0xE4, 0x31, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x09, 0xA3, 0xB5, 0xAF, 0xFB, 0x7D, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x7E, 0x9A, 0xFB, 0x9B, 0x43, 0xD0, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x98, 0xB0, 0xEE, 0xA3, 0xCF, 0x30, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x8B, 0x47, 0x2F, 0x23, 0x96, 0x11, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x16, 0xB6, 0x94, 0xBA, 0xCF, 0xA6, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x95, 0xE3, 0xA3, 0x8F, 0x09, 0x0C, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0xAC, 0x1B, 0xE8, 0x29, 0x1B, 0x23, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xB2, 0x95, 0xF9, 0xC1, 0x4C, 0x35, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xEC, 0x4C, 0xDA, 0x57, 0xA5, 0x82, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xE1, 0x5A, 0xAE, 0x43, 0xFE, 0x45, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xDD, 0x91, 0x41, 0x14, 0x9D, 0x28, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x19, 0x2F, 0xFB, 0xFE, 0x4B, 0x22, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x66, 0x97, 0x20, 0xBD, 0x87, 0xD3, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x62, 0x2C, 0x31, 0x19, 0x17, 0xB6, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x2E, 0x77, 0xB7, 0x2E, 0x93, 0x6D, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xD2, 0xC5, 0xF6, 0xE4, 0x2A, 0x62, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x66, 0xF0, 0x82, 0xAB, 0x14, 0xCA, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x6D, 0xE8, 0x76, 0xD3, 0xE8, 0x7C, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x43, 0x1F, 0xD4, 0x7D, 0x14, 0x7A, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xEA, 0x10, 0x34, 0xFC, 0xD7, 0x4E, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x95, 0x59, 0xF2, 0x90, 0x77, 0x59, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x0D, 0x54, 0x1E, 0xA7, 0xB4, 0x9A, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xC8, 0x5D, 0xA1, 0x67, 0xF8, 0xD8, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xE7, 0xE8, 0x3E, 0x40, 0xE9, 0x2F, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xAF, 0x04, 0x2A, 0xE2, 0x3B, 0x7A, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xDC, 0x0B, 0x4C, 0x57, 0x95, 0x52, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xFB, 0x7C, 0xD0, 0xF6, 0xC6, 0x4F, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x76, 0xE7, 0x7D, 0x9B, 0x0C, 0x02, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x43, 0xCB, 0xF9, 0xB9, 0x60, 0x7D, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x4A, 0xC5, 0x23, 0x02, 0xD6, 0x80, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x52, 0x4E, 0xAE, 0xE6, 0x9D, 0x1C, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xA5, 0x36, 0xAD, 0x9B, 0x18, 0xAA, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xBF, 0xCB, 0xA0, 0x00, 0x3D, 0x07, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xBD, 0xA5, 0xFB, 0x0F, 0x02, 0xDC, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x32, 0x91, 0x89, 0x61, 0xC1, 0x18, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x0C, 0x2D, 0x04, 0xB6, 0x95, 0x9D, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x5A, 0x84, 0x1F, 0x51, 0xFC, 0x99, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x2E, 0x80, 0xB8, 0x52, 0xC4, 0x82, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x06, 0x3F, 0xF3, 0x6E, 0x15, 0x95, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x42, 0xBD, 0xA8, 0xEC, 0x67, 0x78, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xBD, 0xB1, 0xD7, 0x56, 0x37, 0x26, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x39, 0xF0, 0x87, 0x03, 0xB1, 0x49, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x0B, 0x2A, 0xE5, 0x04, 0x8E, 0x35, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x2D, 0x99, 0x15, 0xA6, 0x64, 0x59, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xEA, 0xF7, 0xF3, 0xA6, 0x8B, 0x41, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x39, 0xF1, 0x89, 0xBA, 0x87, 0xA2, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x9F, 0xE6, 0xB6, 0xB3, 0xA6, 0x47, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x62, 0xE4, 0xE5, 0xBB, 0xD1, 0x26, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x2A, 0xA6, 0xEC, 0xC7, 0x08, 0x09, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xD8, 0xBB, 0xD1, 0x02, 0x1C, 0x08, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x92, 0x3C, 0xFA, 0x5B, 0xAC, 0xA7, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xE5, 0xCE, 0x22, 0x24, 0x7D, 0xA4, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xDC, 0xD1, 0xE4, 0x63, 0xA4, 0x57, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x89, 0xC4, 0x75, 0xF2, 0xAF, 0x59, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x71, 0x03, 0xA2, 0x7E, 0x0C, 0x44, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xBF, 0x6C, 0xA8, 0x54, 0xE6, 0xE7, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xA4, 0xC0, 0xCB, 0xB1, 0x94, 0x7B, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x7F, 0x78, 0x69, 0x6A, 0x59, 0x12, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x6E, 0x8A, 0x96, 0xB9, 0x5D, 0xD0, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x6E, 0x7D, 0x14, 0x28, 0x77, 0x0F, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x96, 0xC5, 0xA8, 0x2B, 0x47, 0xE4, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x16, 0x7A, 0x5D, 0x4A, 0x60, 0x58, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xF6, 0x1F, 0xD2, 0xF3, 0xE1, 0x51, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x51, 0xC0, 0x1B, 0x10, 0xFB, 0x4B, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x20, 0x51, 0xB8, 0x01, 0x30, 0x22, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xAA, 0x2A, 0x5A, 0x21, 0x7A, 0x25, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x91, 0xDA, 0xC1, 0x2D, 0x1D, 0x91, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x1D, 0x85, 0xF4, 0x0D, 0xBD, 0x2D, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x9A, 0xCB, 0xF3, 0xAE, 0x46, 0x2C, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x37, 0x32, 0x47, 0x03, 0x09, 0x08, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xB9, 0x71, 0x11, 0xCA, 0x26, 0xA4, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x1E, 0x63, 0x98, 0xE6, 0xB0, 0xAB, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x03, 0x63, 0x3F, 0xBA, 0x17, 0x69, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x66, 0x5F, 0x38, 0xEF, 0x56, 0xE7, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x8F, 0x83, 0x75, 0xBE, 0x3A, 0xFF, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x5E, 0x2D, 0xB4, 0x5E, 0xB8, 0xC3, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xE3, 0x3F, 0x85, 0xBB, 0x5C, 0xF6, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x60, 0x40, 0xF0, 0xB6, 0x00, 0xCD, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x08, 0x5C, 0x08, 0x52, 0xBC, 0xB1, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xF1, 0x5E, 0xEF, 0x94, 0xCD, 0xFD, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xC6, 0x10, 0xC9, 0x4F, 0x20, 0x85, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xF2, 0x53, 0x6F, 0xDE, 0x74, 0xC4, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xAC, 0xAE, 0x91, 0x53, 0xBB, 0x7B, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x51, 0x5A, 0x68, 0xFD, 0x40, 0x03, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x51, 0xB9, 0xBB, 0x8B, 0x3B, 0xB6, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x0E, 0xFF, 0xF6, 0x26, 0xBF, 0xB3, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x4A, 0xC7, 0xDB, 0x6A, 0xBB, 0xCB, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x88, 0xBC, 0xCB, 0x3C, 0x5A, 0x73, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x6E, 0x21, 0x52, 0x06, 0xA5, 0x47, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x65, 0x30, 0x4B, 0x4C, 0x3B, 0x83, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xD1, 0x60, 0x02, 0xF9, 0xE1, 0x59, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xD0, 0xC1, 0x28, 0x04, 0xC1, 0xF0, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xCC, 0x8C, 0x77, 0xCA, 0xB5, 0x11, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x8E, 0xD2, 0xB6, 0xE6, 0xA6, 0x22, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x76, 0x97, 0xC0, 0x29, 0xB7, 0x33, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xCF, 0xA5, 0x2C, 0x9D, 0x2B, 0x65, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xA4, 0x4A, 0xF9, 0x11, 0x2F, 0xA9, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x44, 0x0B, 0xD7, 0xD7, 0x68, 0x77, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x3D, 0x13, 0xD7, 0xE4, 0xED, 0xA2, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xDD, 0x4A, 0x6B, 0xDD, 0x9F, 0x6C, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x18, 0x39, 0x05, 0x26, 0x58, 0x06, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x10, 0xC3, 0xC4, 0x4F, 0x02, 0x10, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x75, 0x9A, 0x74, 0xF9, 0x80, 0xE1, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x32, 0x87, 0x4F, 0x39, 0x87, 0x51, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xF9, 0x76, 0x6B, 0x8D, 0x50, 0x4E, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xA4, 0x1D, 0xF8, 0x6A, 0xBD, 0x4B, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x08, 0x25, 0x21, 0x0D, 0xF1, 0x68, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x44, 0x76, 0x29, 0xB2, 0x4A, 0xA4, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x1B, 0x4B, 0xD7, 0x91, 0xB5, 0xEE, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xA1, 0xBB, 0xB6, 0x7E, 0xAC, 0x86, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xEF, 0x1B, 0xDF, 0x35, 0x60, 0xE0, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xC0, 0x40, 0xF6, 0x11, 0x17, 0x78, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x48, 0x1E, 0x3A, 0x44, 0x23, 0x85, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x34, 0xD3, 0x4A, 0xFB, 0xDC, 0x0B, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x52, 0x94, 0xB4, 0x16, 0x87, 0xFB, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x61, 0x10, 0xA9, 0xAF, 0x5F, 0xCF, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xEC, 0x4E, 0x4C, 0x70, 0xF9, 0x77, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x83, 0xDE, 0xB9, 0x6E, 0xBD, 0xD2, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x7F, 0x20, 0xD5, 0x9E, 0x78, 0xD8, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x9B, 0xCE, 0x11, 0x51, 0xF4, 0x07, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x38, 0x8C, 0xDC, 0x24, 0xE4, 0xA5, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x26, 0x47, 0x5F, 0x8F, 0xFF, 0x0D, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xF8, 0x0C, 0xB6, 0xB2, 0x37, 0x6D, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xBF, 0x38, 0x4F, 0xC0, 0x6B, 0x74, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x46, 0x13, 0x5B, 0x43, 0x45, 0x04, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x11, 0x9C, 0xD8, 0xD1, 0xF5, 0x20, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xE4, 0x69, 0x37, 0x4B, 0x17, 0x0C, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x55, 0xD6, 0x56, 0xD7, 0xEC, 0xEC, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x87, 0x32, 0xBB, 0x3B, 0x9D, 0x79, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xFE, 0x19, 0x9F, 0xCA, 0xD1, 0x7E, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x84, 0x54, 0x22, 0x6E, 0xD0, 0x7B, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xBE, 0x55, 0xF9, 0xFE, 0x23, 0x80, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xCD, 0x85, 0x6F, 0xF4, 0x53, 0x27, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x6F, 0x24, 0x42, 0x61, 0x69, 0x09, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xFF, 0xD3, 0xD4, 0x38, 0x2C, 0xC5, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x50, 0x82, 0x65, 0x97, 0x0A, 0xBA, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xAC, 0x77, 0x11, 0x44, 0x26, 0x97, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x5A, 0xE2, 0xC9, 0xFF, 0x3F, 0xF1, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x78, 0x93, 0x80, 0xAB, 0xCD, 0xDD, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x21, 0xEC, 0xFA, 0xD4, 0xBD, 0xF7, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x9B, 0xC9, 0x50, 0xAA, 0xDA, 0x3D, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x2A, 0xFB, 0x78, 0x34, 0x92, 0x60, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xCF, 0x9F, 0x62, 0xF8, 0x75, 0xA8, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xF4, 0xF0, 0x24, 0x88, 0x44, 0x14, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xD1, 0xD8, 0x35, 0x2A, 0x58, 0xA9, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xD6, 0x42, 0xB3, 0x15, 0x6E, 0x87, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x9A, 0x69, 0x7A, 0xF0, 0xFE, 0xB4, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xB8, 0x54, 0x9D, 0xDD, 0xF1, 0x6A, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0xF8, 0x71, 0xA4, 0x59, 0x68, 0xDB, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x97, 0x91, 0x57, 0x52, 0x63, 0x33, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xCE, 0x30, 0x7A, 0x5E, 0xA0, 0xF0, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x45, 0xC4, 0xC1, 0x6D, 0xAE, 0x13, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x51, 0x99, 0x75, 0xE2, 0x40, 0x9E, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x99, 0x8A, 0x07, 0xB6, 0x5D, 0xF0, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x2B, 0x8B, 0x40, 0x12, 0x49, 0x07, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x1C, 0x71, 0x5B, 0x9C, 0x31, 0x38, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x3F, 0xA3, 0xCF, 0xF8, 0xE1, 0x66, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x2A, 0xDD, 0x66, 0x53, 0x1D, 0x0D, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xB7, 0xA2, 0x07, 0xD4, 0x18, 0xF6, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x56, 0x6D, 0x07, 0x92, 0xE7, 0x22, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x7E, 0xE7, 0xBE, 0xA5, 0x30, 0x0A, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x5D, 0x19, 0x6C, 0xAB, 0x83, 0xED, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x8F, 0x44, 0x1A, 0xB5, 0xE6, 0x30, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x77, 0x63, 0xF8, 0x67, 0xD6, 0x9B, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x0F, 0xE8, 0x03, 0xB4, 0xDD, 0x32, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x98, 0x57, 0x72, 0x40, 0x4B, 0x96, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x28, 0x1C, 0x07, 0x58, 0xF6, 0x03, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xE7, 0xE3, 0x73, 0x9A, 0xAB, 0xE9, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x30, 0x0F, 0x6A, 0x4B, 0x90, 0xE2, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xA0, 0xE2, 0xC5, 0x43, 0x77, 0x30, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x51, 0x0A, 0x3C, 0xE4, 0x91, 0x59, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xAE, 0x85, 0x96, 0x35, 0x48, 0x1A, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x1C, 0x67, 0x7F, 0x78, 0x6A, 0x8F, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x98, 0xFD, 0xF6, 0x58, 0xA1, 0x34, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xD1, 0x27, 0x94, 0xE1, 0x7F, 0x72, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x67, 0xF3, 0x8A, 0x4B, 0xE4, 0x8B, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xAC, 0x47, 0x59, 0x92, 0xB7, 0x51, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x58, 0xD7, 0xCE, 0x20, 0x18, 0xF9, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x80, 0xE5, 0x2F, 0xCB, 0x24, 0xA3, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xE7, 0x34, 0x94, 0x5D, 0xF7, 0x1D, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xE7, 0x76, 0x31, 0xA7, 0x7A, 0xD7, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xB9, 0xCA, 0x26, 0xA0, 0x6E, 0x0B, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x2C, 0x4C, 0x08, 0x70, 0x39, 0x4E, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xEA, 0x8B, 0x70, 0x3E, 0xA4, 0x8A, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xF9, 0x26, 0x24, 0x51, 0xFE, 0x88, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xBE, 0x09, 0xF7, 0xC6, 0xF5, 0x59, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x5B, 0xA0, 0x24, 0xD4, 0x84, 0x63, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xD1, 0x8D, 0x29, 0xE3, 0xE1, 0xA7, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x53, 0xB4, 0xB8, 0x26, 0x61, 0xCA, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xD3, 0x1C, 0x24, 0x26, 0xBD, 0x88, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xB3, 0xB0, 0x8E, 0xC7, 0xBE, 0xAB, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xC6, 0x7B, 0x38, 0x6E, 0xD7, 0x2E, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x17, 0x73, 0x1A, 0x26, 0x9F, 0xAE, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xF4, 0xAC, 0x46, 0xE4, 0x97, 0x9C, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x69, 0x76, 0x1D, 0xEA, 0xA8, 0x6A, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xB8, 0xF1, 0xCB, 0xCA, 0x29, 0x47, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x2E, 0x19, 0xFB, 0xCE, 0x15, 0x73, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x15, 0xAE, 0x9D, 0x8C, 0x49, 0xF4, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x25, 0xB1, 0xC3, 0x00, 0x41, 0xE0, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x3F, 0x3D, 0xBA, 0xD7, 0x71, 0xE8, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xA2, 0x0D, 0xA5, 0x8B, 0xB9, 0x0F, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x81, 0x7A, 0x99, 0x16, 0xAD, 0x5D, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xE1, 0x0B, 0x92, 0xBB, 0xF2, 0x43, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x39, 0x83, 0xC3, 0x85, 0x11, 0xB9, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x65, 0x0C, 0x0C, 0x12, 0xC4, 0x99, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x24, 0x43, 0x74, 0x23, 0xC8, 0xD9, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x52, 0xBD, 0x3B, 0x3F, 0xED, 0xCF, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x4B, 0x5F, 0xA5, 0xF1, 0x33, 0x1B, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x55, 0x82, 0xA5, 0x26, 0x3B, 0xB7, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x3C, 0x08, 0xB2, 0x0C, 0xD5, 0x2D, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xA4, 0x79, 0x7A, 0xCC, 0x3C, 0x15, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x14, 0x03, 0x0F, 0xBA, 0x72, 0xAD, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x89, 0x56, 0xE4, 0xDC, 0x8B, 0xAB, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x51, 0x07, 0x19, 0x23, 0xAD, 0x9B, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x7A, 0xA8, 0x10, 0x33, 0x1B, 0x5C, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x86, 0x25, 0xE5, 0xAA, 0xFA, 0xF5, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xF4, 0x09, 0x6F, 0xFE, 0x97, 0x62, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x20, 0xB9, 0xBD, 0x02, 0x4C, 0x0B, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xFE, 0x45, 0x0F, 0x1D, 0x87, 0x7F, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x82, 0x04, 0x36, 0xDB, 0xC8, 0xA4, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x5B, 0xC4, 0x25, 0x61, 0x6D, 0x41, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xA9, 0x15, 0x4F, 0xCB, 0xB9, 0xD6, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x6B, 0xB7, 0xB6, 0x7F, 0x4D, 0x66, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x4F, 0xEF, 0x22, 0xC8, 0x91, 0x67, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xA2, 0x42, 0x47, 0xE7, 0x0F, 0x5D, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xEF, 0xE0, 0x43, 0xA5, 0x64, 0x20, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x47, 0x85, 0x8A, 0x5F, 0xE4, 0xEA, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x63, 0x9E, 0x89, 0xC7, 0xF2, 0x52, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x91, 0x9D, 0x77, 0xD8, 0x5C, 0x5E, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x87, 0x10, 0x5A, 0xCE, 0xCA, 0x40, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x6A, 0x79, 0xA8, 0x41, 0xF6, 0xAA, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x52, 0xCD, 0x4D, 0x0C, 0x15, 0x46, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x6A, 0xAC, 0x7E, 0x1D, 0x70, 0x12, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x90, 0x2A, 0xB3, 0x1E, 0x7C, 0x8E, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x16, 0xB9, 0x1D, 0x8F, 0x8D, 0xA6, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xC1, 0xC3, 0x37, 0x4D, 0x3A, 0xB0, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x61, 0xE6, 0x47, 0x40, 0xB2, 0x92, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x5F, 0xF0, 0x09, 0xF1, 0x28, 0xE1, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x99, 0xD7, 0xF0, 0x35, 0xA9, 0x69, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xD1, 0x48, 0xA8, 0x75, 0x22, 0xD7, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xF0, 0x79, 0x80, 0x49, 0x97, 0xF6, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x57, 0x43, 0xDF, 0xAD, 0xB9, 0x85, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x33, 0x1B, 0x43, 0x3A, 0x51, 0xE0, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x2E, 0x47, 0x02, 0xB8, 0x73, 0x9E, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xF8, 0x34, 0x4B, 0x99, 0xB2, 0x37, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x27, 0x62, 0x48, 0x11, 0xEB, 0x66, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xCC, 0x12, 0x5D, 0x6F, 0x71, 0x71, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xC0, 0x52, 0x35, 0x51, 0xFB, 0x1E, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x68, 0x3B, 0xA7, 0xD2, 0x61, 0xA5, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0xFE, 0x5D, 0x9D, 0x76, 0x04, 0xD6, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x96, 0x60, 0x40, 0x42, 0x00, 0x89, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x2C, 0xE1, 0x1E, 0x13, 0xA2, 0x82, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xDA, 0x06, 0x8A, 0xF8, 0x16, 0x5D, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xCC, 0x48, 0x48, 0xF1, 0x03, 0x73, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x59, 0x6D, 0x09, 0x1F, 0x54, 0x94, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x94, 0xE2, 0x8C, 0x62, 0xD4, 0x16, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x55, 0x97, 0xC9, 0x30, 0x32, 0xC5, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xBB, 0x26, 0x07, 0x7B, 0x55, 0xA1, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x0D, 0x66, 0x05, 0x7A, 0xCC, 0x3C, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x43, 0x1B, 0x60, 0xBA, 0xFC, 0x04, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xF4, 0x14, 0x9C, 0xF6, 0xF1, 0x42, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x3F, 0xB9, 0x4C, 0x70, 0xF7, 0x72, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xFD, 0x10, 0x0A, 0x1B, 0x81, 0xC2, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x87, 0x9D, 0x75, 0x02, 0xEE, 0x77, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x99, 0xC4, 0x03, 0x7B, 0x3A, 0x1C, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x96, 0xCD, 0x57, 0xFB, 0x95, 0x7D, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x90, 0x5B, 0x56, 0x6F, 0xA7, 0x84, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x3D, 0xCE, 0xFE, 0xEC, 0xE0, 0xE5, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x20, 0x97, 0x30, 0x99, 0x66, 0x1A, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x3F, 0xBA, 0x16, 0x83, 0x97, 0xD0, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x3A, 0x26, 0xA1, 0x8C, 0xDE, 0x29, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xA9, 0xC1, 0x59, 0x28, 0xF4, 0x76, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xAD, 0xDC, 0x96, 0x60, 0x3C, 0x19, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x67, 0x75, 0xD1, 0x7D, 0x70, 0x27, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x5A, 0x34, 0xA5, 0xF6, 0x65, 0x0B, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xEF, 0x8D, 0x0A, 0x01, 0x88, 0x88, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x9E, 0x43, 0x9D, 0xCB, 0x6F, 0x31, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x8E, 0xBF, 0x0B, 0xB4, 0x72, 0x0D, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x02, 0x99, 0x96, 0xC0, 0x08, 0xF2, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xE6, 0xF3, 0x1E, 0xA3, 0x25, 0x9B, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xE8, 0x61, 0xE1, 0x21, 0xAA, 0x58, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xCA, 0x62, 0x8F, 0x78, 0xEA, 0x89, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x21, 0xBC, 0x69, 0x18, 0x69, 0x26, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x8D, 0x4D, 0xA0, 0x30, 0x7F, 0xBF, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x68, 0x42, 0x3E, 0x60, 0x97, 0x8E, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x73, 0x08, 0xFF, 0x2C, 0xDD, 0x0F, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x4D, 0x43, 0xD0, 0x56, 0x50, 0xD5, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x30, 0xA6, 0x16, 0xCC, 0xE1, 0x75, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xEC, 0xEE, 0x35, 0x93, 0x2A, 0x16, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x1E, 0xDC, 0x7A, 0x1C, 0x95, 0x9E, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xF3, 0xB1, 0xC1, 0x97, 0x21, 0x44, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x0B, 0xF8, 0x8D, 0xF1, 0x94, 0x7E, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xF7, 0x26, 0xE1, 0x86, 0xA0, 0x09, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xE5, 0xF0, 0x64, 0x22, 0x02, 0x79, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xBB, 0x68, 0x0A, 0xF8, 0x5B, 0xF0, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xD3, 0x1E, 0x9D, 0xEE, 0x32, 0xE7, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xCE, 0xCE, 0xD9, 0x42, 0x0C, 0x1C, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xA1, 0xA2, 0xE2, 0x8D, 0xF1, 0x5E, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x0A, 0x2D, 0x47, 0xF2, 0xF6, 0x13, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x12, 0xF9, 0x85, 0x4C, 0xB0, 0x69, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x84, 0xE7, 0x90, 0xC5, 0x1B, 0x33, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x38, 0x88, 0xFC, 0xCE, 0xC4, 0x3C, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x18, 0x79, 0x80, 0x04, 0x27, 0x6A, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xC4, 0x0B, 0xCA, 0xA6, 0xA3, 0xDB, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xFB, 0xA8, 0xAD, 0x5E, 0x62, 0xAC, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x63, 0x5A, 0x6F, 0x8E, 0x44, 0xCE, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x39, 0xBF, 0x67, 0x24, 0x00, 0x3C, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x55, 0x43, 0x5B, 0xF0, 0x2A, 0xD1, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xFF, 0xC6, 0xB9, 0xA1, 0xE5, 0x3A, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xA2, 0xEA, 0xAC, 0x1E, 0x1F, 0x47, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xC0, 0x74, 0x7D, 0x8E, 0xA7, 0x0D, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x85, 0x1D, 0xCF, 0xD7, 0x94, 0x9B, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xDD, 0x75, 0xA0, 0x14, 0x13, 0x41, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xEB, 0xB0, 0x02, 0x3C, 0xBC, 0x29, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x9A, 0xBC, 0xCF, 0xC5, 0x3A, 0x34, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x0D, 0xAB, 0x70, 0x19, 0xEA, 0xB5, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x0C, 0x23, 0xEB, 0x6B, 0x6F, 0xB2, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_32_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x1E, 0xCC, 0x23, 0x01, 0x98, 0x42, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0xDB, 0xDD, 0xAD, 0x6D, 0xEA, 0x5E, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x9E, 0xF4, 0x0A, 0x5F, 0x67, 0x1A, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xC4, 0x26, 0x5D, 0xE8, 0xDA, 0xF1, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xA3, 0xD8, 0x3F, 0x48, 0xB7, 0x6F, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x5B, 0xC7, 0x29, 0x06, 0x8E, 0xD8, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xD9, 0x19, 0x14, 0xBC, 0x43, 0x69, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x49, 0xDF, 0xC5, 0xD1, 0xC1, 0x12, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_32_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xDA, 0x00, 0x37, 0x02, 0x35, 0x76, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x2B, 0x76, 0xFE, 0x8E, 0xDD, 0x79, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x75, 0xFD, 0x56, 0x8B, 0x03, 0x89, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xDA, 0xB3, 0xE3, 0x42, 0xCB, 0x49, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xCC, 0x71, 0x1C, 0x2E, 0x0F, 0xD8, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xE8, 0x11, 0xE2, 0x59, 0x44, 0x5C, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x5B, 0x24, 0xD9, 0x57, 0x92, 0x77, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x25, 0xAD, 0x8E, 0x14, 0x3F, 0x11, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_33_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x6F, 0xE9, 0x39, 0x89, 0x0B, 0x07, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x40, 0x83, 0xB4, 0x62, 0x43, 0xB2, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x3F, 0xED, 0x52, 0x20, 0x3D, 0x8F, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x14, 0x35, 0x88, 0x6D, 0x2E, 0xDC, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xFF, 0x16, 0x37, 0x08, 0xD4, 0x57, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0xC9, 0x5E, 0x0D, 0x94, 0xE1, 0x7B, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xAF, 0x97, 0x90, 0xB1, 0xF1, 0xDE, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x71, 0xD7, 0x0F, 0x7E, 0xCA, 0x1F, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_33_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xEC, 0x03, 0xC7, 0x93, 0x6B, 0x2D, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x0D, 0xDB, 0xED, 0xDA, 0x26, 0x9A, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xA2, 0x3A, 0x72, 0x3C, 0x21, 0x3E, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x4A, 0xEE, 0x13, 0x74, 0xF1, 0xED, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x39, 0x45, 0x66, 0x6B, 0x00, 0x96, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x25, 0x6A, 0x46, 0x13, 0xFD, 0xA1, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x27, 0x98, 0xCD, 0xF4, 0xF8, 0x89, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x19, 0xAF, 0x11, 0x29, 0x82, 0x37, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_34_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x45, 0xB6, 0x49, 0x53, 0xC2, 0x9B, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x36, 0x1E, 0xA8, 0xD3, 0x6B, 0x07, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x94, 0x03, 0x8C, 0x4F, 0xE1, 0xC8, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x17, 0x7A, 0xBA, 0x29, 0x78, 0xAE, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x25, 0xE3, 0x77, 0xE4, 0xB0, 0x54, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x15, 0xF2, 0x7B, 0x1D, 0x07, 0xDE, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x33, 0x14, 0x45, 0x38, 0x7B, 0x3D, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0xC1, 0xE4, 0x03, 0xF9, 0xA0, 0xD6, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_34_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x67, 0xEA, 0x64, 0x5D, 0x84, 0x90, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x30, 0x25, 0x06, 0xDF, 0x09, 0x1C, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x6E, 0x19, 0xE0, 0x22, 0x57, 0x85, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x62, 0x3A, 0xFF, 0xDA, 0x6D, 0x62, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0xD7, 0xC2, 0x0E, 0x48, 0x16, 0x6E, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x6D, 0xA5, 0x2C, 0xFD, 0x5C, 0xB3, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xF6, 0x97, 0x7A, 0x71, 0x12, 0xA0, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x1D, 0x93, 0xF3, 0xBB, 0x74, 0xBC, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_35_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x3C, 0x0C, 0x8D, 0xC0, 0x24, 0xE5, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xAC, 0xA0, 0xD6, 0xAB, 0x10, 0x9D, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xCB, 0xA1, 0xA4, 0x3A, 0x04, 0x23, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xD1, 0x32, 0xBE, 0x34, 0x21, 0xA4, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xA7, 0x0A, 0x29, 0x04, 0x96, 0x8D, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x3B, 0x20, 0xF8, 0x50, 0x09, 0xE5, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xA1, 0x6D, 0x8C, 0xCE, 0x66, 0x1C, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0xD9, 0xCE, 0x68, 0x07, 0x3D, 0x75, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_35_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xF2, 0x49, 0x9E, 0x56, 0xDC, 0xFB, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x61, 0x4E, 0x8E, 0x84, 0x99, 0xCC, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x2D, 0x94, 0xDF, 0x42, 0x85, 0x5B, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x77, 0x6B, 0x1A, 0xD6, 0x52, 0x5C, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xE8, 0xD0, 0xA8, 0x8E, 0x55, 0xE8, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x8B, 0xBF, 0x82, 0x84, 0x46, 0x95, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xF1, 0x55, 0x96, 0x64, 0x6F, 0x2A, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xF2, 0x5A, 0x48, 0x5A, 0x6B, 0xF8, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_36_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x16, 0x4A, 0xE4, 0x9E, 0xFD, 0xE7, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xD3, 0x02, 0xF8, 0x88, 0xF6, 0x30, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x3C, 0xA3, 0x06, 0x03, 0x4E, 0x98, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x2C, 0x02, 0xD2, 0x22, 0x9F, 0x57, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x4A, 0x77, 0x09, 0xD2, 0x92, 0x4F, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xE7, 0xDA, 0x0A, 0xC3, 0x5F, 0xA1, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x5C, 0x1C, 0x05, 0x5B, 0x69, 0x2D, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xCD, 0x85, 0x9D, 0xCD, 0x1A, 0x13, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_36_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xE1, 0x38, 0x1D, 0xC8, 0x1A, 0xFB, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xD9, 0xB9, 0x5E, 0xD3, 0x8B, 0x96, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xBE, 0x90, 0xC3, 0x11, 0xB9, 0x75, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x3A, 0x79, 0x21, 0x98, 0xE2, 0xCC, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xA3, 0x2A, 0x62, 0x2D, 0xEA, 0x71, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x74, 0x80, 0x6D, 0xD0, 0x21, 0xD8, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xFE, 0xE1, 0x88, 0x37, 0xA1, 0x6D, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x5C, 0x8C, 0x8A, 0xD3, 0x76, 0xD0, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_37_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xD0, 0x8A, 0x40, 0x38, 0x08, 0x6D, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xDA, 0xC6, 0xD0, 0x7E, 0xE9, 0x13, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xB6, 0x02, 0x1A, 0x3F, 0xFB, 0x2D, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xC0, 0x17, 0xAD, 0x09, 0xA0, 0x2B, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x0E, 0xE2, 0xE3, 0xEC, 0x02, 0x16, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x5B, 0xE1, 0x65, 0x35, 0x85, 0x97, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x7A, 0xFC, 0x8A, 0x50, 0x9E, 0x44, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xFB, 0x14, 0x03, 0xA7, 0x1C, 0x99, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_37_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xF7, 0x93, 0xD9, 0x11, 0xCA, 0x40, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xCA, 0x9D, 0xFB, 0x2B, 0x26, 0x41, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xAB, 0xEC, 0x1D, 0x61, 0xBD, 0xCD, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x40, 0x38, 0x4E, 0x50, 0x52, 0x59, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x7A, 0xFE, 0xAE, 0x16, 0x36, 0x23, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x68, 0x21, 0x50, 0x97, 0xD8, 0x4B, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x9F, 0x3E, 0x6B, 0xD7, 0x86, 0x3F, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x11, 0x7C, 0xC9, 0xFB, 0xEE, 0x77, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_38_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x1A, 0xB5, 0xE4, 0x8C, 0xFB, 0x52, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x39, 0x7E, 0x0A, 0xBD, 0x33, 0xC7, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x3C, 0xD0, 0x3F, 0x24, 0xC3, 0xA8, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x97, 0x84, 0xAA, 0xED, 0x0B, 0x25, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xF1, 0x92, 0x4A, 0xF0, 0xA8, 0xD8, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x46, 0xB8, 0x56, 0x21, 0x8D, 0x90, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x67, 0x72, 0x75, 0xB5, 0x52, 0x40, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xD3, 0x5C, 0x2B, 0xFC, 0xC5, 0x6A, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_38_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xE2, 0xC2, 0x0E, 0x65, 0xAA, 0xC3, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x21, 0xC1, 0xCB, 0x03, 0xAD, 0x80, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xE7, 0x05, 0x8A, 0x2F, 0x7A, 0x1D, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x96, 0x33, 0x33, 0xF0, 0xC2, 0x42, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xD8, 0x82, 0x25, 0x6A, 0x39, 0x10, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x6D, 0x61, 0x72, 0x67, 0x58, 0x89, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xA6, 0x08, 0x55, 0xDA, 0x4F, 0xC9, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x37, 0x73, 0xB5, 0x7A, 0x35, 0xC9, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_39_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x1A, 0x1D, 0x29, 0x0D, 0x87, 0xCC, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xC0, 0x63, 0x2E, 0x5F, 0x3C, 0xB1, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xAF, 0x15, 0xD4, 0x4A, 0xE7, 0x2E, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x12, 0x57, 0xC1, 0x3F, 0x44, 0x25, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x32, 0x73, 0x3F, 0x7B, 0x38, 0x80, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x42, 0x8A, 0xCD, 0xEE, 0xF0, 0xB5, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x4F, 0xEB, 0xCC, 0xEF, 0x10, 0x5E, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xC1, 0x3D, 0xF0, 0x5C, 0x5E, 0x66, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_39_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xDC, 0x2B, 0x9E, 0xFA, 0x3C, 0x88, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x03, 0x14, 0xCD, 0xAB, 0xAC, 0x81, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xD2, 0x1B, 0x13, 0xAD, 0x80, 0x77, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x25, 0xB7, 0xBE, 0x56, 0x5C, 0x50, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xFD, 0xCE, 0xC7, 0xE3, 0xF7, 0x9E, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x35, 0x5E, 0x68, 0xC9, 0x4E, 0xF7, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x0F, 0x92, 0x56, 0x64, 0x57, 0x3E, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x4A, 0x72, 0xF8, 0xE4, 0xB7, 0x4C, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_40_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x79, 0x61, 0xF2, 0xFD, 0xD8, 0xA7, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x9E, 0x27, 0xEB, 0x34, 0xD3, 0xBF, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xDE, 0x0D, 0x8E, 0xAA, 0x1F, 0xF4, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x0E, 0xEE, 0xD0, 0xBB, 0x60, 0x72, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x5D, 0xE1, 0x9D, 0x36, 0x0F, 0xA2, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xB0, 0xB2, 0x86, 0x67, 0xD2, 0x62, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x4F, 0x15, 0x9D, 0x26, 0xBC, 0x2E, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xD3, 0x3D, 0x84, 0x09, 0x20, 0x69, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_40_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xE7, 0x64, 0xB2, 0x3A, 0x74, 0x25, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x4B, 0xFA, 0x16, 0x84, 0x69, 0x30, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xE8, 0xD5, 0x83, 0x56, 0x37, 0xB6, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xBC, 0xE7, 0x4E, 0xD6, 0xEC, 0xED, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x03, 0xEA, 0xD1, 0x85, 0x50, 0x45, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x88, 0x0E, 0x28, 0x24, 0x2D, 0xB9, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x3E, 0xC2, 0xFA, 0x09, 0x29, 0x22, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xEF, 0xCB, 0x32, 0x74, 0x3B, 0x00, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_41_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x83, 0x3A, 0x77, 0xB8, 0xF7, 0x0A, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xEC, 0x1A, 0xBD, 0x1E, 0x02, 0xB6, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x9C, 0x7F, 0x8C, 0xCF, 0xAA, 0x42, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xD7, 0x8D, 0x30, 0xFA, 0xE2, 0x37, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x56, 0x7D, 0x7A, 0x73, 0xD8, 0x10, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xC3, 0x79, 0x86, 0x4F, 0x06, 0xB9, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x06, 0x97, 0x67, 0x7E, 0x9F, 0xA4, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x53, 0xAE, 0x7D, 0xB7, 0xFB, 0x9F, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_41_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x1E, 0x8D, 0x36, 0xF8, 0x88, 0xB5, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x12, 0x32, 0x18, 0xDD, 0xCD, 0x24, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xCF, 0x33, 0x5C, 0xD8, 0x2C, 0x6A, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xD6, 0x7B, 0x06, 0xE1, 0xFF, 0x2A, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x5A, 0x99, 0x6A, 0x8E, 0x06, 0x34, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x76, 0xC9, 0x42, 0xB4, 0x30, 0xB7, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xBA, 0x06, 0xDD, 0x95, 0xCD, 0xBA, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x64, 0x79, 0xD4, 0x90, 0xC5, 0xFB, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_42_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x75, 0x82, 0x0B, 0xDB, 0x57, 0x1E, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x3C, 0x91, 0xE0, 0x68, 0x83, 0xF0, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x66, 0x1F, 0xF0, 0x72, 0xD8, 0x05, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x77, 0x00, 0x09, 0x0A, 0x8F, 0x6B, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xE5, 0x34, 0xEF, 0x38, 0x3B, 0xCD, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x6E, 0x6E, 0x3F, 0xC8, 0x56, 0x04, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x4C, 0xF8, 0xA4, 0x36, 0x58, 0x4D, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x6C, 0x06, 0x22, 0xCE, 0xE1, 0x0E, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_42_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x29, 0x81, 0xB0, 0xE4, 0xEE, 0x3B, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x38, 0x20, 0xF3, 0x10, 0xB7, 0x8F, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x20, 0x05, 0x7D, 0x6F, 0x98, 0x72, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x03, 0x39, 0xB0, 0x2D, 0x48, 0x67, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xA4, 0xEB, 0xF2, 0xCF, 0x31, 0x51, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xB2, 0x19, 0xDA, 0xD6, 0x46, 0x46, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xE0, 0xA7, 0xCC, 0xE4, 0x54, 0x14, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xCD, 0xAD, 0x27, 0x78, 0x6C, 0x47, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_43_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x9C, 0x33, 0x2B, 0xF2, 0xB9, 0xB5, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x1C, 0xF0, 0x76, 0xEC, 0x9D, 0xCF, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xD8, 0xB0, 0x98, 0xBE, 0x9D, 0xD2, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xFB, 0x95, 0x86, 0x2C, 0x8E, 0x8B, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x45, 0xA1, 0x46, 0x94, 0xA7, 0xE5, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xA8, 0x93, 0x7A, 0x27, 0x98, 0x65, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xA1, 0x41, 0x06, 0xA2, 0x94, 0x9F, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x1F, 0x26, 0x5C, 0x54, 0xF5, 0x5E, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_43_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x06, 0xB8, 0x1B, 0x48, 0x77, 0xEB, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x69, 0xF1, 0x18, 0x54, 0x8D, 0xDC, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xC7, 0x5F, 0xFA, 0x1A, 0xFD, 0x46, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x43, 0xC7, 0x28, 0xA5, 0x65, 0xFF, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x0F, 0x12, 0x65, 0x7A, 0x19, 0xBE, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x9B, 0x9E, 0x84, 0x40, 0xA5, 0xFC, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xBA, 0x1D, 0xEB, 0x65, 0x3A, 0xA1, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x86, 0x2E, 0xD5, 0x98, 0x4A, 0x5C, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_44_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x07, 0x0A, 0x71, 0x18, 0x94, 0xE6, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x6C, 0xA1, 0xB0, 0x14, 0x47, 0x17, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xFC, 0x25, 0x10, 0x56, 0x2C, 0x39, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xCE, 0x73, 0xC4, 0x4F, 0x6B, 0x44, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x18, 0xD6, 0x2C, 0x2C, 0xE5, 0xFA, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x58, 0xB0, 0xEB, 0x8B, 0xFB, 0x9D, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x07, 0x89, 0xC5, 0x61, 0x4A, 0x1E, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xAF, 0x16, 0x03, 0x83, 0xC0, 0x53, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_44_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xCD, 0xE6, 0xAC, 0xF3, 0x9A, 0x76, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xA9, 0xD0, 0x0D, 0x7B, 0x9E, 0xB5, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x08, 0x07, 0xB6, 0x7B, 0xD9, 0xD9, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x4F, 0xFB, 0x85, 0xFF, 0xA3, 0x09, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x4F, 0x76, 0xBC, 0xE5, 0xE6, 0x30, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xC5, 0x37, 0x0D, 0xDB, 0xA3, 0x3E, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x66, 0xF8, 0xC1, 0xAA, 0xBB, 0x00, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x8B, 0x8B, 0xE4, 0x45, 0xC0, 0x18, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_45_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xA0, 0xC2, 0xE6, 0x7C, 0x7F, 0x52, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x26, 0x2B, 0x2D, 0x60, 0x3A, 0x2F, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x5F, 0x1D, 0x38, 0xB0, 0x9A, 0xB7, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x7C, 0xEA, 0x8B, 0x15, 0xCA, 0xB7, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xA0, 0x6D, 0x21, 0x49, 0x32, 0x54, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x6F, 0x00, 0xE0, 0xDF, 0x56, 0xF4, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xBC, 0xAB, 0xA1, 0x4F, 0x00, 0xAC, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xFC, 0x7B, 0xE0, 0x41, 0xD2, 0x6B, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_45_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x30, 0x2D, 0xC6, 0xC4, 0xFE, 0x82, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xCF, 0xBC, 0x12, 0x45, 0x46, 0x5B, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xAE, 0x94, 0xE0, 0xA5, 0x0C, 0x14, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x16, 0xE3, 0x52, 0x9D, 0xA5, 0x09, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xBB, 0xC1, 0xA7, 0x1E, 0xE0, 0x04, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x1C, 0xDC, 0xA3, 0x81, 0xFD, 0x32, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x92, 0x34, 0xC1, 0x13, 0x69, 0x00, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x51, 0x2A, 0x05, 0xFD, 0xB4, 0x32, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_46_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x05, 0xE9, 0x9E, 0x1A, 0xBD, 0x39, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x05, 0x64, 0xB6, 0xB1, 0x6F, 0x59, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x3A, 0x3C, 0x60, 0xF2, 0x04, 0xF3, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xF4, 0xE4, 0x40, 0xE8, 0x2F, 0x4F, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xF3, 0x6F, 0xCF, 0x6D, 0x0F, 0xE7, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x9C, 0xF6, 0xC2, 0x30, 0xDE, 0x17, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xDD, 0x6E, 0x9A, 0x31, 0x37, 0x48, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x63, 0x31, 0xC8, 0xD4, 0x8D, 0x8E, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_46_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x53, 0x06, 0x37, 0xF1, 0xDB, 0x86, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x6C, 0x4A, 0xF4, 0xA1, 0x3B, 0xBC, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xCF, 0xB4, 0x59, 0x0A, 0x69, 0x54, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x0F, 0x67, 0x54, 0x84, 0xF7, 0xE0, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x14, 0xC5, 0x2B, 0x8D, 0x39, 0x81, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xB3, 0xFB, 0x15, 0x93, 0xC6, 0x5C, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x13, 0x8C, 0xD9, 0xA6, 0x0C, 0xEF, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x71, 0xE1, 0xCF, 0x14, 0x28, 0x5E, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_47_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x77, 0x66, 0x41, 0x83, 0x52, 0x84, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x21, 0x39, 0x53, 0x5F, 0x45, 0x3D, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x64, 0x2E, 0x5F, 0x4A, 0x95, 0xCE, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xBB, 0xCB, 0x5F, 0xDF, 0x95, 0xF8, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x5A, 0x7B, 0x1B, 0xB2, 0x22, 0x6B, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x49, 0xB3, 0x37, 0x51, 0x28, 0x93, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x02, 0x91, 0x2B, 0x76, 0x43, 0x87, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x3A, 0xD0, 0x12, 0x92, 0x84, 0x42, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_47_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x1B, 0x4F, 0xBD, 0x26, 0x2F, 0x53, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x8B, 0x33, 0xEB, 0x1F, 0x9E, 0x97, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xFB, 0xF2, 0x75, 0x44, 0x8E, 0x07, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x52, 0xBA, 0x1D, 0xA4, 0xC5, 0x3C, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x36, 0x87, 0x52, 0x33, 0x31, 0x74, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x5E, 0xA6, 0xD9, 0x93, 0xB6, 0xCE, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x2E, 0x83, 0x73, 0x69, 0x46, 0xFF, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x5F, 0x3F, 0x02, 0x21, 0x17, 0x52, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_48_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x7D, 0xC9, 0xBC, 0x4D, 0x95, 0x7D, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x4C, 0x74, 0xEC, 0x7A, 0xB3, 0x54, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x3B, 0x23, 0x95, 0x62, 0xDC, 0xBF, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x44, 0x1F, 0x39, 0x2D, 0xBB, 0x21, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x18, 0x11, 0xF7, 0x05, 0x50, 0x23, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x5B, 0x9F, 0xB0, 0xE7, 0x32, 0xB2, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x87, 0x46, 0xFD, 0x39, 0xEB, 0x9C, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x96, 0x24, 0xA7, 0x54, 0x3C, 0x71, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_48_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x06, 0x3F, 0x21, 0xA0, 0xE9, 0x77, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x33, 0x60, 0x9B, 0xA2, 0x1C, 0x06, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xC7, 0x24, 0xA1, 0xB1, 0x0D, 0xBE, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x41, 0x22, 0x87, 0xA6, 0xC6, 0x7B, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xF7, 0x8B, 0xF3, 0x21, 0xC0, 0x5E, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xB7, 0xF9, 0xA7, 0x5C, 0x11, 0x4E, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x23, 0xF6, 0xDE, 0x73, 0x6D, 0xFE, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xC1, 0x0A, 0x8E, 0xD8, 0x0C, 0x90, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_49_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x60, 0x35, 0x53, 0xD5, 0x62, 0xA6, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x2D, 0x6D, 0xB4, 0x60, 0xD3, 0x50, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xE8, 0x55, 0x8E, 0x84, 0x6C, 0x52, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xD1, 0xEB, 0x05, 0x4E, 0x50, 0x8F, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x64, 0x75, 0x3E, 0x35, 0x14, 0xCD, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x34, 0xB4, 0xE8, 0x45, 0x79, 0x72, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xE8, 0x18, 0x0E, 0x2D, 0xB9, 0x8C, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xB1, 0x9E, 0x09, 0xB1, 0xC4, 0xE2, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_49_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xDB, 0xFF, 0xA7, 0x1B, 0x1F, 0x55, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xE3, 0x3A, 0x39, 0x24, 0x82, 0x19, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x26, 0xC7, 0xF2, 0xA2, 0xB4, 0x3D, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xEF, 0x4E, 0x99, 0x1A, 0x24, 0x01, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x50, 0x4B, 0x04, 0xA1, 0x75, 0x2B, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xC4, 0xFC, 0x89, 0xA1, 0x26, 0x1C, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x5A, 0xF3, 0xF1, 0x4A, 0x28, 0x61, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xCC, 0xC1, 0x67, 0xB5, 0x55, 0xC5, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_50_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x77, 0x1A, 0x5B, 0xFC, 0x11, 0xA5, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x77, 0xF4, 0x1D, 0x9A, 0x5F, 0xBE, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xD7, 0x97, 0x55, 0x76, 0x85, 0x04, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x99, 0x7A, 0x7C, 0xDF, 0x48, 0x96, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x37, 0xED, 0x87, 0xC6, 0x05, 0x52, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x2D, 0x36, 0xF6, 0x1F, 0x97, 0x17, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x42, 0x9F, 0xFC, 0x92, 0x40, 0xBA, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xE0, 0xAD, 0xFA, 0xF4, 0x71, 0x52, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_50_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x6F, 0xC7, 0x7D, 0xC9, 0x2A, 0xDF, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x5B, 0x11, 0x8A, 0x7B, 0xC4, 0x50, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x65, 0xD0, 0xF3, 0xFE, 0x5B, 0xA6, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x08, 0x39, 0x9E, 0x32, 0xA0, 0x2A, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x6E, 0x49, 0xF5, 0x5C, 0xB7, 0xB2, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x37, 0xA5, 0x3B, 0xB0, 0xF2, 0x9F, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xA8, 0x19, 0x21, 0xD0, 0x62, 0xBC, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x03, 0xF9, 0xBD, 0x4E, 0xE6, 0xED, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_51_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x33, 0xDF, 0x6F, 0x17, 0xAC, 0x92, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xE7, 0x58, 0x4F, 0x4E, 0xCB, 0x18, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xC7, 0xE2, 0x31, 0xD0, 0x4B, 0x03, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xCB, 0x80, 0x23, 0x08, 0x81, 0xF1, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x29, 0x31, 0x98, 0x61, 0x2B, 0xAA, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x6D, 0x16, 0x17, 0x5A, 0x74, 0xEC, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x1D, 0x63, 0x63, 0xAD, 0x75, 0x92, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x8D, 0xA0, 0xEE, 0x22, 0xB9, 0xF6, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_51_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x26, 0xBA, 0x25, 0x9E, 0xB7, 0x9D, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x29, 0x09, 0x06, 0xC5, 0xD2, 0x75, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xA8, 0xB9, 0x6E, 0x49, 0x79, 0x3E, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xA3, 0xB9, 0xDC, 0xF9, 0x5B, 0xED, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x0B, 0x24, 0x64, 0x56, 0x46, 0xCC, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x1D, 0xEF, 0xEA, 0x1B, 0x9C, 0x9E, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xCD, 0x4E, 0x64, 0xDF, 0x93, 0x26, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x51, 0x60, 0xC5, 0x07, 0x6A, 0x14, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_52_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x26, 0x70, 0x2B, 0x6B, 0x30, 0x9D, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xF6, 0x7D, 0x65, 0xF9, 0x07, 0xD5, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xA2, 0x1E, 0xF4, 0x27, 0x9C, 0xD4, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x6F, 0x0D, 0xA0, 0x31, 0x4E, 0x2C, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x45, 0x60, 0xB6, 0x04, 0xC1, 0xC9, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x16, 0xD9, 0x66, 0xC1, 0x42, 0xD8, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x32, 0x0A, 0x82, 0x93, 0x3B, 0xA5, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xB8, 0xFA, 0x4D, 0xF5, 0x90, 0xFB, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_52_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x25, 0x5C, 0xD6, 0xF0, 0x2C, 0xC3, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x92, 0xA8, 0x5F, 0xE7, 0x7C, 0x04, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x89, 0x73, 0x73, 0x11, 0xCB, 0x10, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xAB, 0x81, 0x64, 0x8B, 0xA8, 0xE5, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0xC5, 0x74, 0x1C, 0xCD, 0xAE, 0x39, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x8F, 0x74, 0x97, 0x65, 0xD0, 0x5D, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x01, 0x9F, 0xEC, 0x75, 0x01, 0x22, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x3D, 0x14, 0xE2, 0x3B, 0xA8, 0x24, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_53_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0xB2, 0xEE, 0xAA, 0x61, 0x0C, 0x0B, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x4C, 0x25, 0x75, 0xED, 0xAB, 0x4F, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xBB, 0x19, 0xD5, 0x73, 0xAE, 0x72, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x2F, 0x42, 0x5A, 0x9C, 0x12, 0x20, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x39, 0x3E, 0xB0, 0x87, 0xCC, 0xCA, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0xD0, 0xB6, 0xEE, 0x9B, 0x94, 0xE9, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x47, 0x0E, 0xB2, 0xF8, 0x3F, 0x0A, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x4D, 0xE7, 0x20, 0x62, 0x75, 0x9A, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_53_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x7C, 0xC8, 0x40, 0x8E, 0xBE, 0xEE, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xEA, 0x7A, 0xF3, 0xDD, 0x70, 0x2E, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x55, 0x1B, 0xF2, 0x1C, 0x40, 0xFB, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x20, 0x2B, 0xD2, 0x32, 0xC8, 0xB3, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xD7, 0xE4, 0x79, 0xFF, 0xD5, 0xE6, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xB4, 0x70, 0x93, 0x92, 0x34, 0x8F, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x85, 0x2E, 0xE3, 0x00, 0x83, 0x11, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xE6, 0xA7, 0x53, 0xE1, 0x7C, 0xAC, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_54_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x24, 0x5D, 0x15, 0xE1, 0x68, 0x0F, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xE5, 0xEF, 0x33, 0xEA, 0xE2, 0x20, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xFE, 0x09, 0x68, 0xD7, 0xEF, 0x95, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x76, 0xBF, 0x62, 0x79, 0xEA, 0xB2, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xEB, 0xD1, 0xE4, 0x94, 0x97, 0x2C, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x3F, 0x50, 0x61, 0x1A, 0xA5, 0x12, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xB0, 0x33, 0x12, 0xA9, 0xB6, 0xBF, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x56, 0xB1, 0x42, 0x57, 0x80, 0x15, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_54_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x4C, 0xC0, 0x8F, 0x2D, 0xE3, 0x8A, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xB0, 0x24, 0x05, 0xC5, 0x4F, 0x2F, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xEE, 0x06, 0x20, 0x53, 0x85, 0xC1, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xCD, 0x88, 0xCC, 0x8F, 0xFC, 0xF6, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x74, 0x9D, 0xA7, 0xEA, 0x48, 0xCD, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x14, 0xFC, 0x89, 0x02, 0xC0, 0x90, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x2F, 0x64, 0xA0, 0x6A, 0xDF, 0xB5, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xD5, 0xA5, 0x3E, 0xDF, 0xED, 0xBD, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_55_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xFE, 0x5C, 0xF8, 0xD0, 0xE8, 0x54, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xC4, 0xEC, 0xC1, 0xCE, 0x53, 0x2F, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xDD, 0xA8, 0x57, 0x1E, 0x28, 0xCF, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x03, 0xE1, 0x36, 0xE4, 0x02, 0x81, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xAC, 0x1F, 0x1F, 0x05, 0xBF, 0xEE, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x34, 0xFE, 0x35, 0x8B, 0xBE, 0x62, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x0E, 0x68, 0x26, 0x9E, 0x2F, 0x23, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x7E, 0x61, 0xFC, 0x83, 0x09, 0xA4, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_55_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x3C, 0x2E, 0x12, 0xA2, 0x94, 0x49, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0xCD, 0x5D, 0xF6, 0x0B, 0x05, 0xA3, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x98, 0x4B, 0x3B, 0x68, 0x58, 0xE3, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x88, 0xF9, 0x91, 0xD6, 0xEB, 0xFD, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xD9, 0xA3, 0x3D, 0xAE, 0xF8, 0x5D, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xCC, 0xC9, 0x84, 0xA5, 0x12, 0x40, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x89, 0xF3, 0x7E, 0x74, 0xCC, 0x80, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x7F, 0x9E, 0x01, 0xC2, 0xC0, 0x53, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_56_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x04, 0x61, 0x1B, 0x6F, 0x92, 0x6B, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xB6, 0x29, 0x64, 0x6A, 0x3D, 0x1D, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xD3, 0x7E, 0xAA, 0x92, 0x80, 0xB1, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x44, 0x33, 0xCB, 0xE1, 0xE5, 0x9A, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xA4, 0x26, 0x5C, 0xB6, 0x28, 0x0A, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x3C, 0xB0, 0xF6, 0x83, 0xC1, 0x96, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xA4, 0x6C, 0x2A, 0x8B, 0xC9, 0xD7, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x70, 0x6B, 0xFB, 0xC7, 0xF8, 0x59, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_56_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xCD, 0x70, 0xA1, 0x4D, 0xF4, 0x45, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xA1, 0x5E, 0x35, 0x68, 0x0E, 0x9F, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xA4, 0x2E, 0x07, 0xF3, 0xC2, 0xA5, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x4C, 0x80, 0x14, 0x62, 0x7E, 0x68, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x6D, 0xD2, 0x34, 0x19, 0xB9, 0x63, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xE1, 0x1E, 0xCC, 0x91, 0x28, 0xAE, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xE4, 0xAD, 0xF6, 0x34, 0x00, 0xCE, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x8B, 0xF1, 0x19, 0xD0, 0xE2, 0x46, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_57_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x9C, 0x4E, 0xD8, 0x98, 0xFD, 0x66, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x87, 0xC1, 0x99, 0x6E, 0xE6, 0x12, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xB0, 0x25, 0xE4, 0xC1, 0xFD, 0x72, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x77, 0x83, 0xD3, 0xA1, 0xA1, 0xD4, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x7A, 0xD9, 0x36, 0x83, 0xB9, 0x81, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x8C, 0x0C, 0x55, 0x87, 0x73, 0x6B, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x06, 0x0A, 0xD0, 0xDA, 0xDA, 0xCC, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x76, 0x53, 0xDF, 0x43, 0xE9, 0xDB, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_57_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x27, 0x93, 0xA6, 0x32, 0x68, 0xBE, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x67, 0x94, 0xAD, 0x12, 0xA9, 0xB7, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xD2, 0x9C, 0xF6, 0x64, 0x4C, 0x60, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x9C, 0x5C, 0x1E, 0x14, 0x3E, 0xED, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x5A, 0xC8, 0x0A, 0x5E, 0xF5, 0xB3, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x39, 0x81, 0x11, 0x90, 0xB3, 0xAE, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x0D, 0x55, 0xFB, 0x28, 0x38, 0x8C, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x88, 0x2D, 0x7F, 0x99, 0x9B, 0x20, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_58_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xBA, 0xBA, 0xB7, 0xD4, 0xDC, 0x5A, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xB7, 0x9A, 0x48, 0x8C, 0xD8, 0xAC, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xE6, 0x53, 0x3B, 0x54, 0x04, 0xA2, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xF9, 0x5B, 0xA7, 0x67, 0xAD, 0x0D, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x05, 0xCD, 0xAD, 0x1C, 0x59, 0x70, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xC0, 0xC9, 0xDB, 0x87, 0x4B, 0x38, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xF1, 0x5A, 0x72, 0x61, 0xEC, 0xC2, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xA9, 0x57, 0x26, 0xE6, 0xF7, 0x08, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_58_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xB6, 0xCD, 0x44, 0xB3, 0xBC, 0x98, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xCE, 0x68, 0xCD, 0x3B, 0xEE, 0xF3, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xBA, 0xA3, 0x2D, 0x55, 0x16, 0x51, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xE1, 0x53, 0xA0, 0x31, 0x53, 0x1F, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xF3, 0x23, 0xAF, 0x71, 0x29, 0x60, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x86, 0x12, 0x29, 0xB6, 0x4D, 0x72, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x11, 0x37, 0xE4, 0x94, 0x9F, 0x82, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x54, 0xE4, 0x87, 0xCB, 0xF3, 0x3E, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_59_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x16, 0x61, 0x96, 0x5E, 0xEF, 0x40, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xD4, 0x7C, 0x67, 0x82, 0x3F, 0xE3, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x07, 0x5F, 0x53, 0x3C, 0xB7, 0x55, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x19, 0xF3, 0xCB, 0x33, 0xA8, 0xAB, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xB9, 0x5A, 0x49, 0x97, 0xF8, 0x69, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x90, 0x7C, 0xFC, 0x56, 0xE3, 0x6E, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x37, 0xEB, 0x2D, 0x4A, 0x07, 0xB4, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x3B, 0xB0, 0x90, 0x3B, 0x7F, 0x0D, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_59_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x26, 0x8D, 0x8B, 0x9A, 0x3D, 0x0D, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x3C, 0x0F, 0x9A, 0x4C, 0x0F, 0xD7, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x87, 0x4C, 0x56, 0x93, 0x68, 0x9D, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x6E, 0x99, 0xDD, 0x4A, 0x9E, 0x4A, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x59, 0xAB, 0xE4, 0x16, 0x4F, 0xF1, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x76, 0xB1, 0xFA, 0x2B, 0x41, 0x3B, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x98, 0x4C, 0x90, 0xDC, 0xD3, 0xE0, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xF0, 0x96, 0x5B, 0x85, 0x14, 0x77, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_60_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x4E, 0xFF, 0x51, 0x26, 0x8E, 0xFC, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x94, 0x21, 0x1C, 0x31, 0x3F, 0xAF, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x1D, 0x2A, 0x7D, 0x6E, 0xDC, 0x08, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x56, 0xFC, 0x43, 0x93, 0xA5, 0xE2, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x83, 0x85, 0x6F, 0xD1, 0x64, 0xDB, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x0A, 0xD0, 0x5C, 0x08, 0xBB, 0xC3, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x2F, 0x24, 0x71, 0xF1, 0x9A, 0x72, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x81, 0xCF, 0x10, 0x52, 0x35, 0x6F, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_60_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xB4, 0xB7, 0x7D, 0x7F, 0xA2, 0xDF, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xE3, 0x36, 0xB9, 0x24, 0x69, 0x2E, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x0B, 0x21, 0xAB, 0xF5, 0x16, 0xA4, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x02, 0xC5, 0xC7, 0xAF, 0xD4, 0xB1, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x62, 0x33, 0xEE, 0x01, 0x08, 0x21, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x9B, 0x86, 0x64, 0x13, 0x50, 0x38, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xB2, 0x78, 0x73, 0x8D, 0xE5, 0x5D, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x40, 0x76, 0x78, 0xB3, 0x82, 0x1A, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_61_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x55, 0x3D, 0x72, 0x9A, 0xD3, 0xB0, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x63, 0x7A, 0xF7, 0xB9, 0x7A, 0x8E, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x69, 0x82, 0x11, 0x9B, 0xBD, 0x2C, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xEF, 0x58, 0x5B, 0xAA, 0xCA, 0xE7, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x05, 0xE6, 0xEC, 0xE5, 0x9F, 0x01, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xF4, 0x0D, 0xEE, 0x36, 0x00, 0x1D, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xFB, 0x9E, 0xE1, 0xDB, 0x0F, 0xBE, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x6D, 0xE7, 0x21, 0x6C, 0x0D, 0x78, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_61_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x63, 0xC7, 0x50, 0x2B, 0x48, 0x08, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x0D, 0xDB, 0x7D, 0xE2, 0xEF, 0xE4, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xCC, 0xCF, 0x79, 0x18, 0x84, 0x38, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x63, 0xC0, 0x26, 0x33, 0xFB, 0xA6, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x0B, 0x69, 0xA3, 0x19, 0x81, 0xB7, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xD9, 0x71, 0xA9, 0xCF, 0x37, 0x38, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x8C, 0xDA, 0xD9, 0xFE, 0x03, 0x6C, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x1C, 0x17, 0xA3, 0xF3, 0x4C, 0x84, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_62_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x74, 0x9D, 0xFB, 0x17, 0xA8, 0xD3, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x66, 0x7B, 0x3C, 0x7E, 0xCD, 0xFB, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xE6, 0xB7, 0x42, 0xFC, 0xD6, 0x7B, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x8D, 0x30, 0x52, 0x28, 0x65, 0xF9, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x20, 0x88, 0x74, 0xEB, 0x80, 0xFD, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x2A, 0x3B, 0xD9, 0x2D, 0x18, 0xBE, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xE8, 0xEC, 0xF1, 0xAF, 0xDC, 0xF9, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xD4, 0x19, 0x39, 0x0E, 0x89, 0xD8, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_62_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xFC, 0xF8, 0xB4, 0x16, 0x17, 0x02, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xD1, 0x17, 0x34, 0xDB, 0xD8, 0x3D, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xCB, 0xBB, 0xB5, 0xB6, 0xAF, 0x18, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xF8, 0x53, 0x93, 0xC0, 0xCC, 0x57, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x1C, 0xCA, 0xC1, 0x68, 0x56, 0x2C, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x8C, 0x1B, 0x25, 0x98, 0xD5, 0x4F, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x0F, 0x37, 0xF8, 0x89, 0x44, 0x0A, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xC0, 0xF7, 0x9B, 0xFF, 0x63, 0x6E, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_63_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x23, 0x9A, 0x26, 0xEF, 0x10, 0x36, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x77, 0xE9, 0x91, 0x4F, 0x8A, 0xEE, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x14, 0xC6, 0xD1, 0x60, 0xFD, 0xA6, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x70, 0x50, 0x12, 0x2D, 0x1E, 0xAE, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x5E, 0xD2, 0x7F, 0x55, 0xDD, 0x88, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x55, 0xEE, 0xB1, 0xEF, 0xFD, 0x41, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xE1, 0x0C, 0xDA, 0x54, 0x78, 0x11, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xAC, 0x54, 0x6A, 0x0F, 0xD0, 0x7B, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp521r1_T_63_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xA9, 0xF6, 0x7E, 0x9F, 0x1C, 0x6D, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xBD, 0x23, 0x18, 0xB6, 0x15, 0xFC, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xEE, 0xEA, 0xB7, 0x7C, 0x5A, 0x15, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x9E, 0x56, 0x84, 0x78, 0xE4, 0x13, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xFA, 0xC7, 0x88, 0x82, 0xCE, 0x0E, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x15, 0x76, 0x81, 0x7A, 0x77, 0xAA, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x22, 0x42, 0xB9, 0x8A, 0x4F, 0x15, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xB3, 0x8B, 0x9A, 0xB7, 0xB7, 0xC5, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_ecp_point secp521r1_T[64] = {
+    ECP_POINT_INIT_XY_Z1(secp521r1_T_0_X, secp521r1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_1_X, secp521r1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_2_X, secp521r1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_3_X, secp521r1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_4_X, secp521r1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_5_X, secp521r1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_6_X, secp521r1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_7_X, secp521r1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_8_X, secp521r1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_9_X, secp521r1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_10_X, secp521r1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_11_X, secp521r1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_12_X, secp521r1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_13_X, secp521r1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_14_X, secp521r1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_15_X, secp521r1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_16_X, secp521r1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_17_X, secp521r1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_18_X, secp521r1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_19_X, secp521r1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_20_X, secp521r1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_21_X, secp521r1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_22_X, secp521r1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_23_X, secp521r1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_24_X, secp521r1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_25_X, secp521r1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_26_X, secp521r1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_27_X, secp521r1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_28_X, secp521r1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_29_X, secp521r1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_30_X, secp521r1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_31_X, secp521r1_T_31_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_32_X, secp521r1_T_32_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_33_X, secp521r1_T_33_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_34_X, secp521r1_T_34_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_35_X, secp521r1_T_35_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_36_X, secp521r1_T_36_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_37_X, secp521r1_T_37_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_38_X, secp521r1_T_38_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_39_X, secp521r1_T_39_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_40_X, secp521r1_T_40_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_41_X, secp521r1_T_41_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_42_X, secp521r1_T_42_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_43_X, secp521r1_T_43_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_44_X, secp521r1_T_44_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_45_X, secp521r1_T_45_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_46_X, secp521r1_T_46_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_47_X, secp521r1_T_47_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_48_X, secp521r1_T_48_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_49_X, secp521r1_T_49_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_50_X, secp521r1_T_50_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_51_X, secp521r1_T_51_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_52_X, secp521r1_T_52_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_53_X, secp521r1_T_53_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_54_X, secp521r1_T_54_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_55_X, secp521r1_T_55_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_56_X, secp521r1_T_56_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_57_X, secp521r1_T_57_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_58_X, secp521r1_T_58_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_59_X, secp521r1_T_59_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_60_X, secp521r1_T_60_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_61_X, secp521r1_T_61_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_62_X, secp521r1_T_62_Y),
+    ECP_POINT_INIT_XY_Z0(secp521r1_T_63_X, secp521r1_T_63_Y),
+};
+#else
+#define secp521r1_T NULL
+#endif
+#endif /* MBEDTLS_ECP_DP_SECP521R1_ENABLED */
+
+#if defined(MBEDTLS_ECP_DP_SECP192K1_ENABLED)
 static const mbedtls_mpi_uint secp192k1_p[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xEE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
@@ -2217,7 +5981,8 @@ static const mbedtls_mpi_uint secp192k1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
 
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint secp192k1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x6C, 0xE0, 0xEA, 0xB1, 0xD1, 0xA5, 0x1D ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xF4, 0xB7, 0x80, 0x02, 0x7D, 0xB0, 0x26 ),
@@ -2396,6 +6161,361 @@ static const mbedtls_ecp_point secp192k1_T[16] = {
     ECP_POINT_INIT_XY_Z0(secp192k1_T_14_X, secp192k1_T_14_Y),
     ECP_POINT_INIT_XY_Z0(secp192k1_T_15_X, secp192k1_T_15_Y),
 };
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp192k1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x6C, 0xE0, 0xEA, 0xB1, 0xD1, 0xA5, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xF4, 0xB7, 0x80, 0x02, 0x7D, 0xB0, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xE9, 0x57, 0xC0, 0x0E, 0xF1, 0x4F, 0xDB ),
+};
+static const mbedtls_mpi_uint secp192k1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x2F, 0x5E, 0xD9, 0x88, 0xAA, 0x82, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x86, 0xBE, 0x15, 0xD0, 0x63, 0x41, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x28, 0x56, 0x9C, 0x6D, 0x2F, 0x2F, 0x9B ),
+};
+static const mbedtls_mpi_uint secp192k1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x86, 0xBC, 0xAA, 0x11, 0x92, 0xAD, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xD8, 0x9C, 0x6E, 0xCB, 0xD6, 0x62, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x1A, 0x8C, 0x0F, 0xAB, 0x90, 0xCC, 0x06 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x4C, 0x8D, 0xEE, 0xA2, 0x50, 0xC2, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x14, 0xBC, 0x86, 0x2B, 0x2D, 0x1B, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x23, 0xE1, 0x26, 0x6A, 0xB3, 0xCD, 0x14 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x70, 0x0C, 0x89, 0x1C, 0x90, 0xEA, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xB8, 0x07, 0xAB, 0x86, 0x28, 0xC8, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x99, 0x78, 0x3C, 0x06, 0xDE, 0x71, 0x6E ),
+};
+static const mbedtls_mpi_uint secp192k1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xD4, 0x91, 0xAB, 0xE8, 0x80, 0xE4, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xF8, 0xEF, 0xE7, 0x69, 0x8E, 0xB3, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xD3, 0xA4, 0xE3, 0xAC, 0x41, 0xC9, 0xF9 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xF4, 0xC0, 0xA1, 0xFD, 0x5B, 0x3E, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x76, 0x0A, 0xE2, 0xFE, 0x39, 0xA8, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xCE, 0x02, 0x66, 0x07, 0xFD, 0x26, 0x24 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xB7, 0x50, 0x7D, 0x64, 0x55, 0x22, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x4A, 0x87, 0x49, 0xC5, 0x92, 0x1B, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xA2, 0x6F, 0x8B, 0x86, 0xF9, 0x59, 0x2F ),
+};
+static const mbedtls_mpi_uint secp192k1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x0A, 0x6B, 0x2C, 0xBA, 0x70, 0x09, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xA5, 0xC0, 0xB2, 0x0C, 0x51, 0xC6, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xBB, 0x3A, 0x9C, 0xC9, 0x72, 0xBB, 0x03 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x75, 0xC7, 0xA2, 0xE8, 0x39, 0x8D, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xCE, 0xDF, 0x3E, 0x51, 0x04, 0x7C, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x4A, 0xA1, 0x6D, 0xCF, 0x33, 0x25, 0x5F ),
+};
+static const mbedtls_mpi_uint secp192k1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xF6, 0x88, 0x5A, 0x6C, 0x23, 0xF4, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xBA, 0x91, 0x1C, 0x03, 0x34, 0x6C, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x5A, 0xBF, 0xFB, 0xC5, 0x8E, 0x82, 0xB7 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x26, 0x6F, 0x76, 0x90, 0x56, 0x8F, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xDA, 0x7C, 0xE1, 0xCE, 0x3F, 0x19, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xDB, 0x1D, 0x6F, 0x74, 0xEF, 0xC0, 0x48 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x4C, 0x1B, 0x3A, 0xFB, 0x0C, 0xD1, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x3B, 0x44, 0x14, 0x80, 0xCA, 0xBB, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xCC, 0xF7, 0xBA, 0x6D, 0xF3, 0xE3, 0xC4 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x9A, 0x1C, 0x09, 0xE9, 0xEE, 0xD8, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xB3, 0xBE, 0x3F, 0x65, 0x4A, 0x25, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x09, 0x5D, 0xBF, 0x68, 0xA6, 0x80, 0x16 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0xED, 0xBA, 0xAE, 0xFC, 0x0C, 0xD4, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x00, 0xC2, 0x43, 0x8C, 0x94, 0x08, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xCF, 0x33, 0xFC, 0xCD, 0xDD, 0x90, 0xCE ),
+};
+static const mbedtls_mpi_uint secp192k1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x89, 0x2E, 0x83, 0x76, 0x84, 0x35, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x39, 0xE4, 0xD0, 0x70, 0x7B, 0xCA, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xCC, 0x05, 0x93, 0x94, 0x94, 0x5E, 0x01 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xDF, 0x76, 0x6E, 0x71, 0xFF, 0x1F, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xE2, 0xF1, 0x8E, 0xC0, 0xCD, 0x00, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x88, 0xFA, 0x11, 0x20, 0x7F, 0x80, 0xBF ),
+};
+static const mbedtls_mpi_uint secp192k1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x6C, 0x86, 0xE9, 0x74, 0x2A, 0x15, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x3C, 0xDD, 0x98, 0xA1, 0x90, 0xD9, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x08, 0x90, 0x6D, 0x88, 0x3C, 0x7B, 0xB8 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x9E, 0x02, 0xE5, 0x71, 0x71, 0x2A, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x5A, 0xBC, 0xEB, 0xA1, 0x3E, 0xB3, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0x6D, 0xDA, 0xCE, 0x2E, 0xD3, 0x07, 0xB2 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x68, 0x64, 0xC3, 0x11, 0x7C, 0xE1, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x62, 0x10, 0xBF, 0x83, 0x0B, 0xAB, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xFB, 0x02, 0xA1, 0x37, 0x32, 0x21, 0x4D ),
+};
+static const mbedtls_mpi_uint secp192k1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xF3, 0x38, 0x79, 0xDC, 0xD5, 0xB7, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xFA, 0x2B, 0xBC, 0xAA, 0x12, 0xD8, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x87, 0x3D, 0x07, 0xB3, 0x99, 0x99, 0x43 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x49, 0x77, 0xA8, 0x3C, 0xCD, 0x2A, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x7B, 0x7F, 0xA9, 0x7B, 0x49, 0x9B, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xB2, 0x38, 0xE0, 0x5F, 0x61, 0x5A, 0x32 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xB5, 0xF4, 0xEA, 0x93, 0x91, 0x7E, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x3E, 0x79, 0x89, 0xE1, 0x2B, 0x97, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xAB, 0x8A, 0x2D, 0xC4, 0xE2, 0xF2, 0x92 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xAD, 0xA7, 0x2C, 0x07, 0x4A, 0x84, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xF9, 0x47, 0xE3, 0x75, 0x18, 0xD1, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x59, 0x0E, 0xDC, 0xE2, 0xB2, 0x94, 0x73 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x45, 0x4D, 0xAB, 0x11, 0xDC, 0xEC, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x24, 0x6E, 0xA0, 0xB1, 0x35, 0xD5, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x3B, 0x8E, 0x50, 0xC7, 0x17, 0x6C, 0x2E ),
+};
+static const mbedtls_mpi_uint secp192k1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0xAD, 0x6D, 0xC5, 0x9A, 0xF0, 0x2D, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x8E, 0xB2, 0x56, 0x27, 0x9D, 0xAD, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xF6, 0xFD, 0x3D, 0x08, 0x6C, 0x01, 0x78 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x8B, 0x5C, 0x97, 0x80, 0x1E, 0xDE, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xB1, 0x8E, 0xC9, 0xFD, 0xBC, 0xB1, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x73, 0x59, 0xF7, 0x88, 0xCA, 0xE4, 0xFE ),
+};
+static const mbedtls_mpi_uint secp192k1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xB5, 0xD7, 0xCE, 0x7D, 0x95, 0xF3, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xDA, 0xF6, 0x51, 0xDE, 0x08, 0xC7, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x1A, 0x7A, 0xEB, 0xA3, 0xB5, 0x6E, 0xF2 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x5C, 0xF9, 0x03, 0x68, 0xC7, 0xD8, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x75, 0xB3, 0xCE, 0xD6, 0x6F, 0xFD, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x6D, 0xB9, 0x5F, 0x6A, 0x9D, 0xAA, 0xBE ),
+};
+static const mbedtls_mpi_uint secp192k1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xF9, 0x52, 0x58, 0x09, 0x1F, 0x5E, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xC4, 0x4D, 0x22, 0xEA, 0x35, 0x0A, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x72, 0x65, 0x6A, 0x2D, 0xBD, 0xF8, 0xAC ),
+};
+static const mbedtls_mpi_uint secp192k1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x39, 0x5D, 0x24, 0xF6, 0xF9, 0x1F, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x92, 0x98, 0x8F, 0x58, 0xC5, 0xE5, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xE8, 0x26, 0xDA, 0xEE, 0x04, 0xA0, 0x3B ),
+};
+static const mbedtls_mpi_uint secp192k1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xE8, 0x6B, 0x90, 0x79, 0xB5, 0x31, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xB4, 0x79, 0x9E, 0x73, 0xE0, 0x70, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x4F, 0x67, 0xA2, 0xD8, 0x88, 0xF3, 0x7B ),
+};
+static const mbedtls_mpi_uint secp192k1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xE6, 0x6D, 0x80, 0x77, 0x67, 0xDF, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x5F, 0xBD, 0x3F, 0xBD, 0x50, 0x9D, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x02, 0x8B, 0xBE, 0x03, 0x7A, 0xE6, 0x8A ),
+};
+static const mbedtls_mpi_uint secp192k1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x1F, 0x6D, 0x28, 0xDE, 0x98, 0x57, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x40, 0x19, 0xA1, 0xF7, 0x8D, 0x9E, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x2A, 0x9E, 0x09, 0x69, 0x21, 0x11, 0x8F ),
+};
+static const mbedtls_mpi_uint secp192k1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x97, 0x2B, 0x86, 0x52, 0xDE, 0x0F, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x97, 0x31, 0x7D, 0x8D, 0xDB, 0x27, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xF6, 0x6C, 0xFA, 0x29, 0x6D, 0xB5, 0xD2 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x3D, 0x7B, 0x8C, 0xF4, 0x72, 0x01, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x2C, 0x56, 0xE3, 0xDB, 0xD4, 0xEE, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xAA, 0x41, 0x3D, 0x0D, 0x66, 0x7B, 0x83 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x44, 0x4A, 0xCD, 0xD0, 0x17, 0x85, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x85, 0xF2, 0x75, 0x92, 0xE2, 0x6B, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x8E, 0xA3, 0xA7, 0x09, 0xFC, 0xDE, 0xE5 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xA2, 0x44, 0x44, 0x84, 0x1A, 0xA8, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0xEA, 0xD1, 0xD7, 0xEB, 0xFB, 0x8D, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x87, 0xCF, 0xF9, 0xDF, 0x38, 0xD1, 0xF3 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x0A, 0x6C, 0xF5, 0xBC, 0xB0, 0x45, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x92, 0x05, 0xC5, 0x94, 0x84, 0x47, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x0C, 0x5E, 0xF0, 0x82, 0xB9, 0x82, 0xD2 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xA6, 0x81, 0x39, 0x92, 0x29, 0x63, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xEA, 0x7A, 0x23, 0x03, 0x45, 0xC9, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x70, 0x7B, 0x4A, 0x0F, 0x4B, 0xE8, 0x23 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xD6, 0x45, 0x9C, 0xFC, 0x11, 0xC4, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x30, 0x84, 0x11, 0x2E, 0x74, 0xCF, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xAC, 0x36, 0xD2, 0x68, 0x77, 0x78, 0x13 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x8F, 0xB9, 0x02, 0x21, 0xFC, 0x6A, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x5A, 0xD5, 0x57, 0x71, 0xD1, 0x89, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x0A, 0xD8, 0x4F, 0xD8, 0x97, 0xD5, 0xEB ),
+};
+static const mbedtls_mpi_uint secp192k1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xE7, 0x01, 0xDA, 0xD9, 0x21, 0x38, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0xCB, 0x0F, 0x98, 0xE4, 0x30, 0xFA, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x62, 0x8D, 0xD2, 0x1E, 0x65, 0x51, 0x83 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x94, 0xF8, 0x86, 0x85, 0x57, 0x1A, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x79, 0x8C, 0x71, 0xEE, 0x6E, 0x8F, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x62, 0x9D, 0xC2, 0xF0, 0x63, 0x5E, 0xA6 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x55, 0xFD, 0x2B, 0x61, 0x6B, 0xBB, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x0A, 0x77, 0xC6, 0xC4, 0x1D, 0x23, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x96, 0xBC, 0xD3, 0x31, 0x14, 0xF9, 0xC0 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x17, 0x52, 0xF3, 0xDD, 0x12, 0xCB, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x8E, 0xC1, 0xFC, 0xFB, 0x7C, 0xD7, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x7F, 0x54, 0xED, 0x32, 0x01, 0x66, 0x1E ),
+};
+static const mbedtls_mpi_uint secp192k1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xB5, 0x68, 0x7D, 0x7B, 0x9B, 0xD6, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xE6, 0x9E, 0xF1, 0xFC, 0x0E, 0xE0, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x3E, 0xDD, 0x42, 0xBF, 0x88, 0x35, 0x83 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x5E, 0x14, 0x05, 0xE7, 0xCA, 0x11, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x3A, 0x76, 0x92, 0x11, 0xBD, 0xF7, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x1E, 0xA6, 0xB2, 0xE4, 0x85, 0x22, 0x67 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x38, 0xA8, 0x82, 0x41, 0xBC, 0xA3, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xEC, 0x7D, 0xAD, 0xD7, 0xB5, 0xE0, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xCC, 0x8B, 0x36, 0x8B, 0x1F, 0x96, 0x5C ),
+};
+static const mbedtls_mpi_uint secp192k1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xFA, 0x52, 0x79, 0xB0, 0x71, 0x67, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xAA, 0x75, 0xB2, 0x20, 0x3C, 0x8F, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x6A, 0xDA, 0xE1, 0x84, 0x4B, 0x2C, 0x69 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x0B, 0xC4, 0x75, 0x43, 0x39, 0x4C, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x3F, 0x24, 0xAC, 0x62, 0xE4, 0x49, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xA8, 0xFD, 0x1F, 0x04, 0x6A, 0xC8, 0xBE ),
+};
+static const mbedtls_mpi_uint secp192k1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xAA, 0x87, 0x77, 0x67, 0xF7, 0xBB, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xD7, 0xF5, 0x1C, 0x82, 0x62, 0xD0, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xB9, 0x8F, 0xB9, 0x3E, 0x58, 0x6A, 0xD2 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x55, 0x3E, 0x74, 0x3F, 0x84, 0x1B, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x4D, 0x6D, 0x13, 0xC0, 0x7F, 0xDE, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x67, 0x76, 0x30, 0x0A, 0x3A, 0x03, 0xF0 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xA8, 0x2D, 0x26, 0xF7, 0x4B, 0x1C, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x01, 0xD3, 0xB2, 0xCC, 0x94, 0xDD, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xE9, 0x55, 0xDF, 0x10, 0x06, 0x58, 0x14 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xFB, 0x82, 0xFD, 0x45, 0xE8, 0x71, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x1C, 0xB9, 0xD1, 0x41, 0xB4, 0xBB, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xB0, 0xD2, 0x21, 0x9F, 0x3C, 0x99, 0xA4 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xCE, 0x52, 0x83, 0xFB, 0x50, 0x91, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xB5, 0x71, 0xD8, 0x93, 0x29, 0x62, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x21, 0x50, 0x77, 0xF6, 0xF0, 0x81, 0xD0 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xB0, 0xCC, 0x92, 0x0C, 0x44, 0x65, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x27, 0xA2, 0xC2, 0x8A, 0xA3, 0x69, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x36, 0x93, 0xC2, 0x29, 0x40, 0xD0, 0x5D ),
+};
+static const mbedtls_mpi_uint secp192k1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x99, 0x82, 0xBF, 0x5F, 0xF9, 0x9E, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xD6, 0x6F, 0x5C, 0x34, 0x5D, 0x40, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xF8, 0x23, 0xE7, 0x71, 0xEC, 0xF8, 0x2A ),
+};
+static const mbedtls_mpi_uint secp192k1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x41, 0x1E, 0xFF, 0x93, 0x04, 0x29, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x5A, 0x05, 0x49, 0x1C, 0x84, 0xBE, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x65, 0xBD, 0x65, 0xE3, 0x8E, 0x46, 0x04 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x27, 0x9C, 0xC6, 0xB0, 0x11, 0xA6, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x13, 0xE2, 0xE3, 0xC4, 0x50, 0xDB, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x75, 0xCF, 0x76, 0x38, 0xBF, 0x5A, 0x97 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x60, 0xC4, 0x23, 0xA8, 0xAF, 0xC8, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x39, 0xAB, 0xC4, 0xE2, 0xFE, 0x9C, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x0C, 0x60, 0xE0, 0x27, 0xF3, 0xB7, 0x80 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xC6, 0xE0, 0x33, 0x6C, 0x74, 0x90, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x00, 0x10, 0x2F, 0x34, 0x15, 0xCE, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x76, 0xD5, 0x3A, 0xEA, 0xA8, 0xE9, 0x34 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0xF5, 0x27, 0x9C, 0xB3, 0x78, 0x4C, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x41, 0x58, 0xAF, 0x76, 0x00, 0x00, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xC6, 0x38, 0xFD, 0x6C, 0x03, 0x36, 0xB5 ),
+};
+static const mbedtls_mpi_uint secp192k1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x13, 0xC9, 0xF6, 0x3D, 0xBE, 0xAA, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x8D, 0x58, 0x29, 0x1E, 0x75, 0xF2, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x8D, 0x82, 0x3F, 0xF2, 0x33, 0xFD, 0x44 ),
+};
+static const mbedtls_ecp_point secp192k1_T[32] = {
+    ECP_POINT_INIT_XY_Z1(secp192k1_T_0_X, secp192k1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_1_X, secp192k1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_2_X, secp192k1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_3_X, secp192k1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_4_X, secp192k1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_5_X, secp192k1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_6_X, secp192k1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_7_X, secp192k1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_8_X, secp192k1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_9_X, secp192k1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_10_X, secp192k1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_11_X, secp192k1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_12_X, secp192k1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_13_X, secp192k1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_14_X, secp192k1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_15_X, secp192k1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_16_X, secp192k1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_17_X, secp192k1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_18_X, secp192k1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_19_X, secp192k1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_20_X, secp192k1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_21_X, secp192k1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_22_X, secp192k1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_23_X, secp192k1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_24_X, secp192k1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_25_X, secp192k1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_26_X, secp192k1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_27_X, secp192k1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_28_X, secp192k1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_29_X, secp192k1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_30_X, secp192k1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(secp192k1_T_31_X, secp192k1_T_31_Y),
+};
 #else
 #define secp192k1_T NULL
 #endif
@@ -2434,7 +6554,8 @@ static const mbedtls_mpi_uint secp224k1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 ),
 };
 
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint secp224k1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0xA4, 0xB7, 0xB6, 0x0E, 0x65, 0x7E, 0x0F ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x75, 0x70, 0xE4, 0xE9, 0x67, 0xA4, 0x69 ),
@@ -2508,126 +6629,529 @@ static const mbedtls_mpi_uint secp224k1_T_5_Y[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x37, 0xE4, 0xFE, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_6_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x9B, 0xEE, 0x64, 0xC9, 0x1B, 0xBD, 0x77 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x5F, 0x34, 0xA9, 0x0B, 0xB7, 0x25, 0x52 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x13, 0xB1, 0x38, 0xFB, 0x9D, 0x78, 0xED ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xE7, 0x1B, 0xFA, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x9B, 0xEE, 0x64, 0xC9, 0x1B, 0xBD, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x5F, 0x34, 0xA9, 0x0B, 0xB7, 0x25, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x13, 0xB1, 0x38, 0xFB, 0x9D, 0x78, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xE7, 0x1B, 0xFA, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xB3, 0xB7, 0x44, 0x92, 0x6B, 0x00, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x82, 0x44, 0x3E, 0x18, 0x1A, 0x58, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xF8, 0xC0, 0xE4, 0xEE, 0xC1, 0xBF, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x32, 0x27, 0xB2, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x9A, 0x42, 0x62, 0x8B, 0x26, 0x54, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x85, 0x74, 0xA0, 0x79, 0xA8, 0xEE, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x36, 0x60, 0xB3, 0x28, 0x4D, 0x55, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x27, 0x82, 0x29, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xFC, 0x73, 0x77, 0xAF, 0x5C, 0xAC, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xED, 0xE5, 0xF6, 0x1D, 0xA8, 0x67, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xDE, 0x33, 0x1C, 0xF1, 0x80, 0x73, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xE2, 0xDE, 0x3C, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x3E, 0x6B, 0xFE, 0xF0, 0x04, 0x28, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xB2, 0x14, 0x9D, 0x18, 0x11, 0x7D, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xC4, 0xD6, 0x2E, 0x6E, 0x57, 0x4D, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x55, 0x1B, 0xDE, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xF7, 0x17, 0xBC, 0x45, 0xAB, 0x16, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xB0, 0xEF, 0x61, 0xE3, 0x20, 0x7C, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x85, 0x41, 0x4D, 0xF1, 0x7E, 0x4D, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xC2, 0x9B, 0x5E, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x2E, 0x49, 0x3D, 0x3E, 0x4B, 0xD3, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x2B, 0x9D, 0xD5, 0x27, 0xFA, 0xCA, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xB3, 0x6A, 0xE0, 0x79, 0x14, 0x28, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x1E, 0xDC, 0xF5, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x44, 0x56, 0xCD, 0xFC, 0x9F, 0x09, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x8C, 0x59, 0xA4, 0x64, 0x2A, 0x3A, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xA0, 0xB5, 0x86, 0x4E, 0x69, 0xDA, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x8B, 0x11, 0x38, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x17, 0x16, 0x12, 0x17, 0xDC, 0x00, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x76, 0x24, 0x6C, 0x97, 0x2C, 0xB5, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x71, 0xE3, 0xB0, 0xBB, 0x4E, 0x50, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x48, 0x26, 0xD5, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x5F, 0x28, 0xF6, 0x01, 0x5A, 0x60, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x95, 0xFE, 0xD0, 0xAD, 0x15, 0xD4, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x5B, 0x7A, 0xFD, 0x80, 0xF7, 0x9F, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0xBC, 0x1B, 0xDF, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xE6, 0xDF, 0x14, 0x29, 0xF4, 0xD4, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x12, 0xDD, 0xEC, 0x5B, 0x8A, 0x59, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x92, 0x3E, 0x35, 0x08, 0xE9, 0xCF, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x35, 0x29, 0x97, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xDB, 0xD6, 0x6A, 0xC5, 0x43, 0xA4, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x33, 0x50, 0x61, 0x70, 0xA1, 0xE9, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x15, 0x6E, 0x5F, 0x01, 0x0C, 0x8C, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xA1, 0x9A, 0x9D, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xC6, 0xF7, 0xE2, 0x4A, 0xCD, 0x9B, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x4D, 0x5A, 0xB8, 0xE2, 0x6D, 0xA6, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x3F, 0xB6, 0x17, 0xE3, 0x2C, 0x6F, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xA4, 0x59, 0x51, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x4F, 0x7C, 0x49, 0xCD, 0x6E, 0xEB, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xC9, 0x1F, 0xB7, 0x4D, 0x98, 0xC7, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xFD, 0x98, 0x20, 0x95, 0xBB, 0x20, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xF2, 0x73, 0x92, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xEF, 0xFB, 0x30, 0xFA, 0x12, 0x1A, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x4C, 0x24, 0xB4, 0x5B, 0xC9, 0x4C, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xDD, 0x5E, 0x84, 0x95, 0x4D, 0x26, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xFA, 0xF9, 0x3A, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xA3, 0x2E, 0x7A, 0xDC, 0xA7, 0x53, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x9F, 0x81, 0x84, 0xB2, 0x0D, 0xFE, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x89, 0x1B, 0x77, 0x0C, 0x89, 0x71, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xFF, 0x7F, 0xB2, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xE9, 0x2C, 0x79, 0xA6, 0x3C, 0xAD, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xE0, 0x23, 0x02, 0x86, 0x0F, 0x77, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x93, 0x6D, 0xE9, 0xF9, 0x3C, 0xBE, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xE7, 0x24, 0x92, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x3C, 0x5B, 0x4B, 0x1B, 0x25, 0x37, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xE8, 0x38, 0x1B, 0xA1, 0x5A, 0x2E, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x19, 0xFD, 0xF4, 0x78, 0x01, 0x6B, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x69, 0x37, 0x4F, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xE2, 0xBF, 0xD3, 0xEC, 0x95, 0x9C, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x7B, 0xFC, 0xD5, 0xD3, 0x25, 0x5E, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x55, 0x09, 0xA2, 0x58, 0x6A, 0xC9, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xCC, 0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x08, 0x65, 0x5E, 0xCB, 0xAB, 0x48, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x79, 0x8B, 0xC0, 0x11, 0xC0, 0x69, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xE8, 0x8C, 0x4C, 0xC5, 0x28, 0xE4, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x1F, 0x34, 0x5C, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_ecp_point secp224k1_T[16] = {
+    ECP_POINT_INIT_XY_Z1(secp224k1_T_0_X, secp224k1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_1_X, secp224k1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_2_X, secp224k1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_3_X, secp224k1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_4_X, secp224k1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_5_X, secp224k1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_6_X, secp224k1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_7_X, secp224k1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_8_X, secp224k1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_9_X, secp224k1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_10_X, secp224k1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_11_X, secp224k1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_12_X, secp224k1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_13_X, secp224k1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_14_X, secp224k1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_15_X, secp224k1_T_15_Y),
+};
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp224k1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0xA4, 0xB7, 0xB6, 0x0E, 0x65, 0x7E, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x75, 0x70, 0xE4, 0xE9, 0x67, 0xA4, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x28, 0xFC, 0x30, 0xDF, 0x99, 0xF0, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x5B, 0x45, 0xA1, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x61, 0x6D, 0x55, 0xDB, 0x4B, 0xCA, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xBD, 0xB0, 0xC0, 0xF7, 0x19, 0xE3, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xFB, 0xCA, 0x82, 0x42, 0x34, 0xBA, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x9F, 0x08, 0x7E, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xD1, 0x8A, 0x56, 0x97, 0xC1, 0x9B, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x17, 0x45, 0x7C, 0x1C, 0x49, 0x27, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x68, 0x47, 0x55, 0x43, 0xDA, 0x9F, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x08, 0xF9, 0x0F, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x4E, 0x26, 0x02, 0x4F, 0x6F, 0xD9, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x05, 0xFF, 0xC5, 0x3D, 0xE6, 0xA4, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x7B, 0x4D, 0x61, 0xA4, 0x28, 0xD6, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xE7, 0x7E, 0x3D, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x1A, 0x50, 0x30, 0x1F, 0x7B, 0x1E, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x29, 0x20, 0xCC, 0x2A, 0x61, 0xBC, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x57, 0x8F, 0x0B, 0xCA, 0xCD, 0xBF, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x6F, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x2B, 0x1C, 0x08, 0x90, 0xB1, 0xA2, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xAB, 0x68, 0x7D, 0x90, 0xED, 0xD6, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x9D, 0x18, 0xC2, 0xDA, 0xDB, 0xA8, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x28, 0x70, 0xB8, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xBD, 0x5C, 0xC4, 0x35, 0xFA, 0xDE, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xC7, 0x4F, 0x19, 0xD2, 0xDD, 0xC8, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x7A, 0x03, 0xA8, 0x33, 0x8E, 0x6C, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x78, 0x6F, 0x13, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xC4, 0x44, 0x8D, 0xDE, 0x4A, 0x94, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x40, 0x8B, 0xE7, 0xF8, 0x2A, 0x95, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x7A, 0x83, 0x01, 0x98, 0x51, 0xB1, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x82, 0x18, 0xCC, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x6B, 0x1D, 0x9C, 0x7B, 0xC8, 0x23, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xFA, 0xE4, 0x42, 0x8F, 0x26, 0x50, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB7, 0xFD, 0xFD, 0xBE, 0x27, 0x5A, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xF9, 0xE1, 0x5A, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x1B, 0xCD, 0x5A, 0x0D, 0x7C, 0xED, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x4F, 0xB2, 0xAB, 0xA1, 0xBB, 0x09, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x09, 0x83, 0x41, 0x74, 0xB4, 0x47, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x0B, 0x5D, 0xDA, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x3C, 0x7A, 0x9C, 0x3A, 0xFD, 0x5E, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x8C, 0xC3, 0x08, 0x6F, 0xD2, 0x06, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x9E, 0xFD, 0x8A, 0xE8, 0x8C, 0xB8, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x47, 0x43, 0xBF, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x80, 0x68, 0xED, 0x96, 0x50, 0x8E, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x23, 0xAD, 0xCD, 0x57, 0xBB, 0x47, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x35, 0x6F, 0x19, 0x42, 0xE7, 0x45, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x95, 0xCF, 0x53, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xE4, 0x90, 0xBC, 0xB5, 0x33, 0x03, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xA5, 0x85, 0x0C, 0x59, 0x67, 0x55, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x23, 0x78, 0x89, 0xD7, 0x60, 0xAF, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x4B, 0x95, 0xDE, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_6_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xB3, 0xB7, 0x44, 0x92, 0x6B, 0x00, 0x82 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x82, 0x44, 0x3E, 0x18, 0x1A, 0x58, 0x6A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xF8, 0xC0, 0xE4, 0xEE, 0xC1, 0xBF, 0x44 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x32, 0x27, 0xB2, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x75, 0x35, 0xB8, 0x5D, 0x9A, 0x88, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x6C, 0xF3, 0x73, 0xC6, 0x55, 0xA3, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xBC, 0x2B, 0x35, 0x54, 0x6E, 0x03, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xCD, 0x2A, 0x0A, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_7_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x9A, 0x42, 0x62, 0x8B, 0x26, 0x54, 0x21 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x85, 0x74, 0xA0, 0x79, 0xA8, 0xEE, 0xBE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x36, 0x60, 0xB3, 0x28, 0x4D, 0x55, 0xBE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x27, 0x82, 0x29, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x68, 0x5C, 0x07, 0x8B, 0xCC, 0x4A, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x11, 0x12, 0x17, 0x4C, 0x68, 0xBE, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x49, 0x63, 0x5E, 0x42, 0x39, 0x17, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xC3, 0xEC, 0x6B, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_7_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xFC, 0x73, 0x77, 0xAF, 0x5C, 0xAC, 0x78 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xED, 0xE5, 0xF6, 0x1D, 0xA8, 0x67, 0x43 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xDE, 0x33, 0x1C, 0xF1, 0x80, 0x73, 0xF8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xE2, 0xDE, 0x3C, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xA3, 0x42, 0xFB, 0x9A, 0x60, 0x6F, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xA9, 0x3E, 0x22, 0x2A, 0xAB, 0xFE, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x45, 0x7B, 0xF8, 0x99, 0xCD, 0x00, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xDB, 0x3D, 0x64, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_8_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x3E, 0x6B, 0xFE, 0xF0, 0x04, 0x28, 0x01 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xB2, 0x14, 0x9D, 0x18, 0x11, 0x7D, 0x9D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xC4, 0xD6, 0x2E, 0x6E, 0x57, 0x4D, 0xE1 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x55, 0x1B, 0xDE, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x4E, 0xB9, 0x98, 0xAD, 0x80, 0xF0, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xE4, 0x21, 0x77, 0x4D, 0xE8, 0x7B, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x26, 0x9E, 0xE5, 0xCF, 0x70, 0x48, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x21, 0xE4, 0x07, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_8_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xF7, 0x17, 0xBC, 0x45, 0xAB, 0x16, 0xAB ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xB0, 0xEF, 0x61, 0xE3, 0x20, 0x7C, 0xF8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x85, 0x41, 0x4D, 0xF1, 0x7E, 0x4D, 0x41 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xC2, 0x9B, 0x5E, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x93, 0x7E, 0x51, 0xD3, 0x1B, 0x4E, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xEB, 0xEA, 0xE3, 0xCC, 0x26, 0x9E, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x78, 0x1B, 0xD4, 0x55, 0xAC, 0x6E, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x0A, 0xCC, 0xD2, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_9_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x2E, 0x49, 0x3D, 0x3E, 0x4B, 0xD3, 0x32 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x2B, 0x9D, 0xD5, 0x27, 0xFA, 0xCA, 0xE0 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xB3, 0x6A, 0xE0, 0x79, 0x14, 0x28, 0x0F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x1E, 0xDC, 0xF5, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x6C, 0xC4, 0x97, 0xB7, 0x8B, 0x8B, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x22, 0x93, 0x3F, 0x1E, 0xB6, 0x22, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x1F, 0xFE, 0x25, 0x64, 0x2C, 0x36, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x4B, 0x0A, 0xC4, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_9_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x44, 0x56, 0xCD, 0xFC, 0x9F, 0x09, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x8C, 0x59, 0xA4, 0x64, 0x2A, 0x3A, 0xED ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xA0, 0xB5, 0x86, 0x4E, 0x69, 0xDA, 0x06 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x8B, 0x11, 0x38, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x0F, 0xEA, 0x01, 0x50, 0xC3, 0xAD, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x03, 0x29, 0xED, 0xB7, 0x9F, 0xC8, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x94, 0x3F, 0x8B, 0xAF, 0x9F, 0xE3, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x3C, 0x46, 0xE9, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_10_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x17, 0x16, 0x12, 0x17, 0xDC, 0x00, 0x7E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x76, 0x24, 0x6C, 0x97, 0x2C, 0xB5, 0xF9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x71, 0xE3, 0xB0, 0xBB, 0x4E, 0x50, 0x52 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x48, 0x26, 0xD5, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x92, 0x54, 0x3C, 0x6F, 0x30, 0x7B, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x8A, 0xF3, 0x14, 0xDB, 0x42, 0x23, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x93, 0x4E, 0x3E, 0x2E, 0xAE, 0x62, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xD6, 0xD6, 0xCB, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_10_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x5F, 0x28, 0xF6, 0x01, 0x5A, 0x60, 0x41 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x95, 0xFE, 0xD0, 0xAD, 0x15, 0xD4, 0xD9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x5B, 0x7A, 0xFD, 0x80, 0xF7, 0x9F, 0x64 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0xBC, 0x1B, 0xDF, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x0D, 0x50, 0x5E, 0x48, 0x36, 0x70, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x4D, 0xD9, 0x9B, 0x01, 0x23, 0x78, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xEF, 0xF1, 0x5C, 0x2D, 0xBD, 0x94, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x7A, 0xFA, 0xE7, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_11_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xE6, 0xDF, 0x14, 0x29, 0xF4, 0xD4, 0x14 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x12, 0xDD, 0xEC, 0x5B, 0x8A, 0x59, 0xE5 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x92, 0x3E, 0x35, 0x08, 0xE9, 0xCF, 0x0E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x35, 0x29, 0x97, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xE9, 0xB0, 0x18, 0x31, 0x07, 0xC7, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x16, 0x2C, 0x3F, 0x5F, 0xBB, 0x11, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x6A, 0xD4, 0xB2, 0x77, 0x32, 0x4F, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x39, 0x74, 0x0E, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_11_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xDB, 0xD6, 0x6A, 0xC5, 0x43, 0xA4, 0xA1 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x33, 0x50, 0x61, 0x70, 0xA1, 0xE9, 0xCE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x15, 0x6E, 0x5F, 0x01, 0x0C, 0x8C, 0xFA ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xA1, 0x9A, 0x9D, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x12, 0x56, 0x7B, 0xE5, 0x86, 0x77, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x38, 0x7A, 0x10, 0xD5, 0x91, 0x34, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xFA, 0x66, 0xCB, 0x2F, 0xE6, 0x9E, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xC7, 0x39, 0xE3, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_12_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xC6, 0xF7, 0xE2, 0x4A, 0xCD, 0x9B, 0x61 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x4D, 0x5A, 0xB8, 0xE2, 0x6D, 0xA6, 0x50 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x3F, 0xB6, 0x17, 0xE3, 0x2C, 0x6F, 0x65 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xA4, 0x59, 0x51, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x5F, 0x1E, 0x87, 0x96, 0x95, 0x64, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xBD, 0xFA, 0x85, 0x77, 0x4D, 0x64, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x3E, 0x31, 0x53, 0xB3, 0xC0, 0xBC, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x6E, 0x51, 0xDE, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_12_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x4F, 0x7C, 0x49, 0xCD, 0x6E, 0xEB, 0x3C ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xC9, 0x1F, 0xB7, 0x4D, 0x98, 0xC7, 0x67 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xFD, 0x98, 0x20, 0x95, 0xBB, 0x20, 0x3A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xF2, 0x73, 0x92, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x94, 0x33, 0x5C, 0xEE, 0x51, 0xC0, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x19, 0x42, 0xB0, 0x9E, 0x11, 0x13, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x43, 0xA7, 0x08, 0xBA, 0x91, 0xCB, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x3F, 0xC6, 0x78, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_13_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xEF, 0xFB, 0x30, 0xFA, 0x12, 0x1A, 0xB0 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x4C, 0x24, 0xB4, 0x5B, 0xC9, 0x4C, 0x0F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xDD, 0x5E, 0x84, 0x95, 0x4D, 0x26, 0xED ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xFA, 0xF9, 0x3A, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x6E, 0xC1, 0x93, 0x5D, 0xA1, 0xA8, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xDD, 0xC3, 0x13, 0xEB, 0xAD, 0x7E, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x43, 0xCC, 0xF9, 0x0C, 0x27, 0xA8, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xA2, 0x5C, 0x28, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_13_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xA3, 0x2E, 0x7A, 0xDC, 0xA7, 0x53, 0xA9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x9F, 0x81, 0x84, 0xB2, 0x0D, 0xFE, 0x31 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x89, 0x1B, 0x77, 0x0C, 0x89, 0x71, 0xEC ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xFF, 0x7F, 0xB2, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x91, 0x60, 0x3E, 0x58, 0xEF, 0x9F, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xC6, 0x34, 0x0C, 0x1A, 0x3B, 0xF6, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x66, 0x61, 0xDC, 0x84, 0x10, 0x32, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x21, 0x50, 0xE5, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_14_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xE9, 0x2C, 0x79, 0xA6, 0x3C, 0xAD, 0x93 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xE0, 0x23, 0x02, 0x86, 0x0F, 0x77, 0x2A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x93, 0x6D, 0xE9, 0xF9, 0x3C, 0xBE, 0xB9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xE7, 0x24, 0x92, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xD3, 0xEC, 0x76, 0xB2, 0x54, 0x10, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xDF, 0x46, 0xD1, 0x67, 0x99, 0xEC, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x00, 0x06, 0xDC, 0xB0, 0xA6, 0x44, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xA2, 0x36, 0xD2, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_14_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x3C, 0x5B, 0x4B, 0x1B, 0x25, 0x37, 0xD6 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xE8, 0x38, 0x1B, 0xA1, 0x5A, 0x2E, 0x68 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x19, 0xFD, 0xF4, 0x78, 0x01, 0x6B, 0x44 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x69, 0x37, 0x4F, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x24, 0xDF, 0xD6, 0x54, 0x4E, 0x83, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x2B, 0x60, 0xDC, 0x70, 0x94, 0x09, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x9F, 0xFB, 0x7C, 0x0A, 0x5B, 0xF4, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x0B, 0x8F, 0x76, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_15_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0xE2, 0xBF, 0xD3, 0xEC, 0x95, 0x9C, 0x03 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x7B, 0xFC, 0xD5, 0xD3, 0x25, 0x5E, 0x0F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x55, 0x09, 0xA2, 0x58, 0x6A, 0xC9, 0xFF ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xCC, 0x3B, 0xD9, 0x00, 0x00, 0x00, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xFD, 0xA2, 0xC0, 0x4E, 0x54, 0x04, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xB8, 0x7E, 0x92, 0x19, 0x7B, 0xE9, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x2B, 0x47, 0x10, 0xDB, 0x48, 0xBD, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x5F, 0x40, 0xD1, 0x00, 0x00, 0x00, 0x00 ),
 };
 static const mbedtls_mpi_uint secp224k1_T_15_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x08, 0x65, 0x5E, 0xCB, 0xAB, 0x48, 0xC8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x79, 0x8B, 0xC0, 0x11, 0xC0, 0x69, 0x38 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xE8, 0x8C, 0x4C, 0xC5, 0x28, 0xE4, 0xAE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x1F, 0x34, 0x5C, 0x00, 0x00, 0x00, 0x00 ),
-};
-static const mbedtls_ecp_point secp224k1_T[16] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x35, 0x90, 0x87, 0x3C, 0x25, 0x45, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x7B, 0xA7, 0x7F, 0xF6, 0xC8, 0xA8, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x3D, 0xE6, 0x36, 0x68, 0xC0, 0xA7, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x88, 0x39, 0xD1, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x18, 0xAA, 0x29, 0xC9, 0x3D, 0x2E, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xB9, 0x54, 0xA0, 0x09, 0x93, 0x5E, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x64, 0xE4, 0x14, 0x03, 0x7D, 0x8C, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xB5, 0x19, 0xE0, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x0B, 0x6E, 0x69, 0xE4, 0xF8, 0xE1, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x86, 0xE0, 0x7B, 0xD8, 0xF8, 0xA3, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x5B, 0xE0, 0x40, 0x98, 0xEE, 0x8E, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x87, 0xB0, 0x88, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xD8, 0x37, 0xC1, 0x3F, 0xA5, 0xAF, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x63, 0xFD, 0x11, 0xF1, 0x49, 0xC1, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x86, 0x57, 0xFE, 0x3D, 0xE8, 0x6A, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xF2, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xC4, 0x85, 0xFE, 0xCD, 0x2E, 0x84, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xBE, 0x59, 0x45, 0x76, 0x7D, 0xEA, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xED, 0x26, 0x8D, 0x6D, 0x12, 0xE6, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xA8, 0xDD, 0x40, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x5E, 0xDA, 0x61, 0x74, 0x80, 0x41, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xFA, 0x66, 0xB3, 0x91, 0xD8, 0xAF, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x5A, 0xC6, 0x24, 0x99, 0xE0, 0x70, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x5C, 0x76, 0xDF, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xF9, 0xCA, 0xB3, 0xE2, 0x55, 0x91, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xA0, 0xF8, 0x72, 0x1E, 0xFC, 0x8F, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x0A, 0x8C, 0x6A, 0xCB, 0xB6, 0xCD, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xC7, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x07, 0x80, 0x88, 0xB9, 0x42, 0x1D, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x59, 0xAA, 0x0B, 0x6F, 0x9C, 0xB6, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x0C, 0x77, 0x54, 0xD0, 0x0B, 0xF1, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xCA, 0x80, 0x73, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xC7, 0x88, 0xD6, 0xFC, 0xB7, 0xE5, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xB8, 0xF2, 0x8F, 0xEA, 0x36, 0xA0, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xDC, 0x19, 0x71, 0xA3, 0xE1, 0x9B, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xB6, 0x5D, 0xDA, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x43, 0x64, 0xFA, 0xC3, 0x9B, 0xE8, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x5D, 0x0B, 0xA1, 0x28, 0x70, 0x2E, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x0F, 0x00, 0x9E, 0xDD, 0x4E, 0x4D, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xB8, 0x93, 0xF7, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x6F, 0xA1, 0xD0, 0xDB, 0xDD, 0x6E, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x98, 0x75, 0xC6, 0xE3, 0x4A, 0xDB, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x85, 0x6C, 0xD5, 0x9C, 0x17, 0xC9, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xA2, 0xB5, 0xE8, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x67, 0x20, 0x21, 0x08, 0x7F, 0x38, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x1B, 0x0A, 0xBE, 0x99, 0xC4, 0x7A, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x88, 0x52, 0xEB, 0xD6, 0xAE, 0xE8, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xF8, 0x46, 0xDC, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xE3, 0x9B, 0x57, 0xA8, 0xA7, 0x15, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xC7, 0x86, 0xD6, 0x80, 0x00, 0x32, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xA5, 0xD3, 0x26, 0xBC, 0x9B, 0xF0, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x57, 0xA2, 0x3D, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x4F, 0x49, 0x0D, 0xFE, 0xD0, 0x41, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xCE, 0x7D, 0xCC, 0xCA, 0x3C, 0x10, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xE6, 0xC5, 0x81, 0xC9, 0xC1, 0xAC, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x3E, 0x4A, 0xFF, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xD1, 0x26, 0xCD, 0xD2, 0x99, 0x28, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x09, 0x4E, 0x07, 0xD7, 0xF3, 0xA6, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xBF, 0xD6, 0xCF, 0xD7, 0xF9, 0x55, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xC3, 0x78, 0x6C, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x91, 0x31, 0x90, 0xCA, 0x69, 0x37, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xCB, 0x79, 0x6F, 0x74, 0x3A, 0x98, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x0F, 0xB4, 0xFB, 0x39, 0x23, 0x91, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x3B, 0x9D, 0x77, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xE4, 0x28, 0x6D, 0x3A, 0xF1, 0x53, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x18, 0x15, 0xDD, 0x30, 0x5D, 0xF0, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xD5, 0xDB, 0x4D, 0x1E, 0xDF, 0x8A, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x29, 0x1A, 0x85, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xEE, 0x3B, 0x18, 0x0F, 0x02, 0xDE, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xAD, 0x13, 0x19, 0x65, 0xCE, 0x1F, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x5E, 0x09, 0xBD, 0x42, 0xA1, 0x1B, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x6D, 0x3B, 0x36, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xAF, 0x0E, 0x1C, 0xE5, 0x21, 0x3F, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xAA, 0x11, 0xC8, 0x3D, 0x41, 0xDE, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xC9, 0x3B, 0x0B, 0x99, 0xF9, 0x26, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xDA, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x97, 0x50, 0x26, 0x34, 0xE9, 0x7C, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x12, 0x6C, 0x69, 0x7F, 0x3A, 0x2E, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x8C, 0x48, 0xAA, 0xE6, 0x6E, 0x4E, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x71, 0x83, 0x2B, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x10, 0x23, 0x0A, 0x0D, 0x4D, 0x68, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x83, 0xFA, 0x62, 0x5D, 0x8E, 0x41, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xAE, 0xC9, 0xBF, 0x80, 0xD3, 0x59, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x49, 0x8E, 0x23, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xC6, 0xB2, 0x86, 0xA0, 0xDE, 0xE0, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x64, 0xEB, 0x84, 0x2B, 0x53, 0xD3, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x8F, 0x8E, 0xC4, 0x35, 0x52, 0xB1, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xE9, 0x71, 0xE9, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x2A, 0x70, 0x71, 0x97, 0x37, 0xC2, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xAE, 0x2D, 0xF7, 0x6A, 0xDE, 0xA8, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xC3, 0xFA, 0x4F, 0x35, 0x3B, 0xB7, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x13, 0x59, 0xF2, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x30, 0x48, 0xA4, 0xE3, 0xE6, 0x68, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x51, 0x11, 0xB6, 0x54, 0x2A, 0x1B, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x6D, 0xFD, 0xCF, 0xDB, 0xD2, 0xB1, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x0E, 0xFE, 0x9A, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x1B, 0x61, 0xEC, 0xE8, 0xDC, 0xE4, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xFE, 0xEB, 0xBA, 0x04, 0x23, 0xE0, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x3D, 0x75, 0x7C, 0xED, 0x82, 0xF7, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xED, 0xFB, 0xCA, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x12, 0xB1, 0xA3, 0xED, 0xD7, 0x99, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x9C, 0x3D, 0x7E, 0x95, 0x29, 0x47, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xD0, 0xC5, 0x09, 0x9A, 0x4F, 0xA1, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x2C, 0x9F, 0xF6, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x88, 0x1A, 0x10, 0x33, 0x3F, 0x14, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xC8, 0xD9, 0x30, 0x27, 0x8D, 0x31, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x09, 0x1F, 0x19, 0xDD, 0x96, 0x2B, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x18, 0x27, 0x96, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x78, 0xB7, 0x4F, 0x80, 0x88, 0x3A, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xC7, 0x04, 0x81, 0x58, 0xB6, 0x2D, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xB3, 0xAD, 0x07, 0x7C, 0x90, 0x47, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x8E, 0x79, 0x89, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xF3, 0x52, 0x0A, 0xC4, 0xB6, 0x6A, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x26, 0xBE, 0x1D, 0x1C, 0x82, 0xB7, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x63, 0x72, 0x44, 0x21, 0x26, 0xEB, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x88, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xD3, 0x2B, 0xB5, 0x76, 0x26, 0x8D, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x51, 0x68, 0xB8, 0xA1, 0x7A, 0xCE, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x55, 0xA2, 0x77, 0x41, 0xE0, 0x12, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x45, 0x62, 0x7C, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x0E, 0x0F, 0xE3, 0x09, 0x7D, 0x12, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x01, 0x57, 0xA8, 0x53, 0x5B, 0xF8, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x02, 0xFB, 0x40, 0x0D, 0x4E, 0xEB, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xE3, 0xD3, 0x71, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x88, 0x38, 0xEA, 0x9A, 0x1E, 0xFB, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xD5, 0x80, 0x92, 0xEE, 0xD2, 0xCD, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xED, 0x8B, 0x8A, 0x60, 0xFD, 0xB3, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xAE, 0xA5, 0x16, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_mpi_uint secp224k1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xBF, 0xDC, 0x4D, 0xF1, 0xB8, 0x60, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xB7, 0xD5, 0x04, 0xD1, 0x0F, 0xE3, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xA5, 0x89, 0x00, 0x54, 0xBA, 0x0D, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xD1, 0x7D, 0xEE, 0x00, 0x00, 0x00, 0x00 ),
+};
+static const mbedtls_ecp_point secp224k1_T[32] = {
     ECP_POINT_INIT_XY_Z1(secp224k1_T_0_X, secp224k1_T_0_Y),
     ECP_POINT_INIT_XY_Z0(secp224k1_T_1_X, secp224k1_T_1_Y),
     ECP_POINT_INIT_XY_Z0(secp224k1_T_2_X, secp224k1_T_2_Y),
@@ -2644,6 +7168,22 @@ static const mbedtls_ecp_point secp224k1_T[16] = {
     ECP_POINT_INIT_XY_Z0(secp224k1_T_13_X, secp224k1_T_13_Y),
     ECP_POINT_INIT_XY_Z0(secp224k1_T_14_X, secp224k1_T_14_Y),
     ECP_POINT_INIT_XY_Z0(secp224k1_T_15_X, secp224k1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_16_X, secp224k1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_17_X, secp224k1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_18_X, secp224k1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_19_X, secp224k1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_20_X, secp224k1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_21_X, secp224k1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_22_X, secp224k1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_23_X, secp224k1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_24_X, secp224k1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_25_X, secp224k1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_26_X, secp224k1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_27_X, secp224k1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_28_X, secp224k1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_29_X, secp224k1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_30_X, secp224k1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(secp224k1_T_31_X, secp224k1_T_31_Y),
 };
 #else
 #define secp224k1_T NULL
@@ -2682,7 +7222,8 @@ static const mbedtls_mpi_uint secp256k1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
 
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint secp256k1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x17, 0xF8, 0x16, 0x5B, 0x81, 0xF2, 0x59 ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x28, 0xCE, 0x2D, 0xDB, 0xFC, 0x9B, 0x02 ),
@@ -2893,6 +7434,425 @@ static const mbedtls_ecp_point secp256k1_T[16] = {
     ECP_POINT_INIT_XY_Z0(secp256k1_T_14_X, secp256k1_T_14_Y),
     ECP_POINT_INIT_XY_Z0(secp256k1_T_15_X, secp256k1_T_15_Y),
 };
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp256k1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x17, 0xF8, 0x16, 0x5B, 0x81, 0xF2, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x28, 0xCE, 0x2D, 0xDB, 0xFC, 0x9B, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x0B, 0x87, 0xCE, 0x95, 0x62, 0xA0, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xBB, 0xDC, 0xF9, 0x7E, 0x66, 0xBE, 0x79 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xD4, 0x10, 0xFB, 0x8F, 0xD0, 0x47, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x54, 0x85, 0xA6, 0x48, 0xB4, 0x17, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x08, 0x11, 0x0E, 0xFC, 0xFB, 0xA4, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xC4, 0xA3, 0x26, 0x77, 0xDA, 0x3A, 0x48 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xD3, 0x0F, 0xB1, 0x57, 0xD0, 0x27, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x3A, 0x7F, 0x34, 0x38, 0x06, 0x96, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xA8, 0xE4, 0x18, 0xD6, 0xB2, 0xD0, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x88, 0x4D, 0x8B, 0x54, 0xD5, 0x76, 0x65 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x5A, 0xB3, 0x74, 0xF6, 0xFB, 0x14, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xA5, 0xDC, 0x19, 0xFF, 0xC8, 0x91, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0xA2, 0x71, 0x74, 0xBD, 0x82, 0xA2, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x8C, 0x1E, 0x3A, 0x3E, 0xE6, 0x81, 0xB4 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x61, 0x86, 0xF7, 0xC8, 0xFC, 0x73, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xF4, 0xB3, 0x81, 0x36, 0x1C, 0xE2, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xAE, 0x39, 0x93, 0x80, 0x5E, 0x56, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x3C, 0x1E, 0x89, 0xAB, 0x7E, 0xC4, 0x29 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x3D, 0xAC, 0x26, 0xA9, 0x8A, 0x9D, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x0F, 0xF1, 0x2F, 0x5B, 0x81, 0x49, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x3E, 0xCA, 0x6A, 0xEC, 0x8D, 0x5A, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x3D, 0xB8, 0x88, 0xB7, 0x94, 0x0D, 0x4E ),
+};
+static const mbedtls_mpi_uint secp256k1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xE6, 0x7F, 0x2B, 0xC4, 0xF9, 0x6F, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xD4, 0xDE, 0x65, 0xB0, 0xB5, 0x47, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x5F, 0xAA, 0x29, 0x26, 0xC3, 0x53, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x26, 0xD3, 0x63, 0x72, 0xE1, 0xA2, 0xCE ),
+};
+static const mbedtls_mpi_uint secp256k1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x7B, 0xCF, 0xB3, 0xE5, 0x11, 0x51, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x47, 0xC5, 0x99, 0xA2, 0x7F, 0x15, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xB9, 0x51, 0xC2, 0xAB, 0x42, 0x4E, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xD9, 0x97, 0x9B, 0xB5, 0x5D, 0x68, 0x31 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x9A, 0x27, 0xCE, 0x89, 0x79, 0x2F, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x23, 0x0F, 0x27, 0xA8, 0x0F, 0x8B, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x23, 0x26, 0xBD, 0xE5, 0x7C, 0x5C, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x23, 0x01, 0xCD, 0x87, 0x45, 0x0E, 0x2C ),
+};
+static const mbedtls_mpi_uint secp256k1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x8D, 0x85, 0x79, 0xED, 0x91, 0x54, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x8E, 0x34, 0xC5, 0xF3, 0xDB, 0x81, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x01, 0x68, 0x94, 0x5C, 0xAA, 0x5B, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x27, 0xD4, 0x07, 0x27, 0x61, 0x2F, 0xA0 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x1F, 0xF4, 0x16, 0xBA, 0x69, 0x55, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x0C, 0x85, 0xA5, 0x05, 0xBB, 0x1E, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x5D, 0xE5, 0x57, 0x98, 0x76, 0x95, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xD8, 0xE7, 0x1C, 0xF8, 0xE5, 0x43, 0x25 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x23, 0x96, 0x05, 0xA0, 0x13, 0xE9, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xC3, 0xBF, 0x2F, 0x31, 0x40, 0x0E, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x34, 0x36, 0x57, 0x66, 0xB5, 0x3E, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x88, 0x3C, 0x17, 0x33, 0x05, 0xF0, 0x9A ),
+};
+static const mbedtls_mpi_uint secp256k1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xE9, 0xE4, 0x78, 0x21, 0x2E, 0xAC, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xC8, 0x3D, 0xD3, 0x70, 0xD8, 0xB8, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x6E, 0xBA, 0x39, 0xE4, 0x13, 0x08, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x0B, 0x0C, 0x7D, 0x04, 0xCE, 0x56, 0x3D ),
+};
+static const mbedtls_mpi_uint secp256k1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x5F, 0x00, 0x6E, 0xC7, 0x05, 0x72, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x0E, 0xBF, 0x0B, 0x92, 0x18, 0x5B, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x28, 0xD9, 0x79, 0xBB, 0xD9, 0xB4, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x16, 0xB1, 0x2C, 0x97, 0x98, 0x50, 0x42 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xBA, 0xCF, 0xFA, 0x66, 0x61, 0x77, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xF4, 0xB1, 0x32, 0x62, 0x41, 0xA9, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xD6, 0x09, 0x79, 0xA1, 0xA1, 0xD8, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xF3, 0x92, 0x21, 0xD8, 0x5D, 0xD8, 0x8F ),
+};
+static const mbedtls_mpi_uint secp256k1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xD6, 0x75, 0x12, 0x3B, 0x97, 0xF5, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x9A, 0x5B, 0x7B, 0x19, 0xC7, 0x56, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xB9, 0x3F, 0xCB, 0x4F, 0xB3, 0x4C, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xFF, 0xB2, 0xAF, 0x91, 0x05, 0xE0, 0x90 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x13, 0xED, 0x48, 0xDD, 0x72, 0xB0, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x12, 0x03, 0x3D, 0xDD, 0xCE, 0x02, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x94, 0x8E, 0xB3, 0xA0, 0xA5, 0xB0, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x66, 0x2F, 0xA8, 0x80, 0x75, 0x20, 0x0D ),
+};
+static const mbedtls_mpi_uint secp256k1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xD2, 0x93, 0xF6, 0x26, 0x73, 0x60, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x04, 0xD7, 0x73, 0xD4, 0xE9, 0xF8, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xA8, 0x06, 0x78, 0x5E, 0x10, 0x9D, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x5A, 0x2E, 0x9F, 0x8E, 0x57, 0x6F, 0x7F ),
+};
+static const mbedtls_mpi_uint secp256k1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x24, 0xE8, 0x48, 0x51, 0x19, 0x0F, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xDE, 0x0A, 0x98, 0x87, 0x67, 0x7F, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x26, 0x72, 0x8F, 0x50, 0xD0, 0x1E, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x13, 0x8C, 0xFA, 0x0E, 0x4E, 0x96, 0xC1 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x5F, 0xAB, 0xDD, 0x7C, 0x05, 0x8B, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x5B, 0xE3, 0x5E, 0x62, 0xE3, 0xD4, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x22, 0x8E, 0x3B, 0xBF, 0x9B, 0x01, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x1F, 0xC2, 0x01, 0x16, 0x05, 0xC3, 0x9B ),
+};
+static const mbedtls_mpi_uint secp256k1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xEA, 0x2A, 0x1B, 0x26, 0x85, 0x66, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xA3, 0xAD, 0x3F, 0x2B, 0xBC, 0xAC, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x51, 0xCD, 0x23, 0xEF, 0x4B, 0x13, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xCA, 0x35, 0xFA, 0x5C, 0xFC, 0xAB, 0xC7 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x8C, 0x65, 0x92, 0xD1, 0xAB, 0xB5, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x0E, 0x9D, 0xD1, 0x30, 0xB7, 0x85, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xCC, 0xA3, 0x29, 0xA0, 0xFB, 0xC5, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x55, 0xF7, 0x38, 0xF1, 0xB7, 0x58, 0x87 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x0A, 0x7B, 0x95, 0x48, 0x36, 0x66, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x37, 0x64, 0xF7, 0x55, 0xB6, 0xD9, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x48, 0x61, 0x46, 0x46, 0x0C, 0x0B, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x3F, 0x4E, 0x2C, 0x24, 0x4E, 0xE9, 0x40 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x3E, 0x0E, 0xA6, 0xF5, 0xF6, 0x58, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xD6, 0xA1, 0xE5, 0x6F, 0x1D, 0x73, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x84, 0x3E, 0xBD, 0x1D, 0x8E, 0xE0, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x5C, 0x74, 0xAB, 0x13, 0xE3, 0x9E, 0x16 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x36, 0xD6, 0x35, 0xC7, 0x81, 0xFA, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x49, 0xEB, 0xF2, 0x62, 0x53, 0x88, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xB3, 0x7E, 0x3D, 0x7F, 0x48, 0xEB, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x84, 0x7B, 0x45, 0xE5, 0xEA, 0xA5, 0xF1 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xDC, 0x57, 0xAF, 0x95, 0x4B, 0x66, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xAF, 0x62, 0x1B, 0x9C, 0xCE, 0x94, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x81, 0x2C, 0xA2, 0xFE, 0x40, 0x89, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xB5, 0x8C, 0xCB, 0x38, 0xC9, 0xEB, 0x0A ),
+};
+static const mbedtls_mpi_uint secp256k1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xA2, 0x53, 0x01, 0x8F, 0x5B, 0x20, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x1A, 0xDD, 0x20, 0x6F, 0xF8, 0xB7, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xC3, 0xC0, 0x83, 0x6D, 0x5D, 0xAE, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x82, 0xC2, 0x32, 0xA5, 0x48, 0x10, 0x5C ),
+};
+static const mbedtls_mpi_uint secp256k1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xA5, 0x73, 0xBC, 0xD1, 0xD4, 0xF3, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xB3, 0xA8, 0x98, 0x41, 0xB6, 0xFF, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x2A, 0x3E, 0x0F, 0xC7, 0x69, 0x24, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xC8, 0x80, 0x26, 0x33, 0xFC, 0x59, 0x68 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x10, 0x0F, 0x71, 0x19, 0xC4, 0xC3, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x7C, 0x26, 0xCA, 0x62, 0x23, 0x6F, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xC1, 0x53, 0xA7, 0x08, 0xB8, 0x04, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xE2, 0xCE, 0xFE, 0x13, 0xBB, 0x34, 0x0A ),
+};
+static const mbedtls_mpi_uint secp256k1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x45, 0x7B, 0x83, 0x51, 0x05, 0x66, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x75, 0xE1, 0x0E, 0xFE, 0x1C, 0x41, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x0F, 0x5F, 0xC1, 0x02, 0xAF, 0x1E, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x90, 0x8A, 0xE0, 0x2C, 0x73, 0x69, 0x1D ),
+};
+static const mbedtls_mpi_uint secp256k1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x6A, 0x50, 0x48, 0xCF, 0x5F, 0x21, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x1F, 0x27, 0xE7, 0x9A, 0xBF, 0x58, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xBB, 0xCA, 0xC0, 0xA2, 0xFB, 0x70, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xF3, 0x06, 0x1D, 0x9F, 0xC3, 0x7A, 0x0E ),
+};
+static const mbedtls_mpi_uint secp256k1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xE7, 0x0A, 0x10, 0x0E, 0xFA, 0x55, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x7A, 0x3C, 0x76, 0x41, 0x47, 0x46, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x78, 0xCD, 0xED, 0xEA, 0xC5, 0x0A, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xA2, 0xC7, 0x94, 0x99, 0x78, 0x71, 0x25 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x52, 0x09, 0x70, 0xCC, 0xDD, 0xF3, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x91, 0xCA, 0x53, 0xBD, 0xF9, 0x97, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xEA, 0x3A, 0x55, 0xD1, 0x8F, 0xD2, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xD4, 0xCC, 0xB0, 0xB6, 0x17, 0xC8, 0x1C ),
+};
+static const mbedtls_mpi_uint secp256k1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x53, 0x7F, 0x12, 0x83, 0xDD, 0xB1, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x6A, 0x3D, 0x78, 0xDD, 0x09, 0xE3, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x3D, 0x03, 0x75, 0x3C, 0x28, 0x44, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xC2, 0x85, 0xDA, 0xC7, 0x58, 0x3E, 0x1E ),
+};
+static const mbedtls_mpi_uint secp256k1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xAC, 0x9B, 0x95, 0x00, 0x85, 0xD4, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x2A, 0x2A, 0x60, 0x7A, 0x12, 0x9B, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xCB, 0x41, 0xE6, 0xF4, 0xBE, 0x48, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xAE, 0x0D, 0x7E, 0x42, 0x3F, 0xA5, 0xEF ),
+};
+static const mbedtls_mpi_uint secp256k1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xFD, 0x6A, 0xCA, 0x5E, 0xA1, 0xA2, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x9E, 0x1F, 0x89, 0x47, 0xC8, 0xD7, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x9D, 0x94, 0xDD, 0x70, 0x7E, 0xA2, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x65, 0xBB, 0xA2, 0xE1, 0xBA, 0x5B, 0x6F ),
+};
+static const mbedtls_mpi_uint secp256k1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x0F, 0x2F, 0x12, 0x99, 0x51, 0x08, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x36, 0x4B, 0x56, 0x1D, 0xF2, 0xBF, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x44, 0x13, 0xEA, 0x18, 0x49, 0x55, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0xF9, 0x29, 0xC7, 0xA6, 0x18, 0xF1, 0x80 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x9C, 0x1A, 0x1F, 0x60, 0x7C, 0x20, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x56, 0xB6, 0x04, 0xA1, 0x24, 0x66, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x7F, 0xDE, 0x9D, 0x2F, 0x03, 0xAF, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xAF, 0x56, 0x77, 0x8C, 0x40, 0xC9, 0x43 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x81, 0xF7, 0x5F, 0x04, 0xC2, 0x08, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x90, 0x87, 0x76, 0xA7, 0x05, 0x02, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x53, 0x79, 0x11, 0x7C, 0x84, 0xF2, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x51, 0x89, 0x97, 0x7A, 0x89, 0xC5, 0x38 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x39, 0x6F, 0xFD, 0xC9, 0x87, 0xE3, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xFD, 0xAE, 0x1C, 0x26, 0x48, 0xEB, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x73, 0xCA, 0x23, 0x64, 0x31, 0x4D, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x3C, 0xFB, 0x6D, 0xD5, 0x58, 0x78, 0x94 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xAF, 0xAD, 0xFB, 0x43, 0xD1, 0xA6, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x71, 0xE4, 0x39, 0x03, 0xF2, 0x5A, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x9C, 0x4B, 0xD0, 0x74, 0x1B, 0xC6, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xAE, 0x6E, 0xD2, 0x5F, 0x48, 0x92, 0x2F ),
+};
+static const mbedtls_mpi_uint secp256k1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x89, 0x2D, 0x19, 0x95, 0x37, 0x6A, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x99, 0x76, 0x4A, 0xAD, 0x5C, 0x6B, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xF4, 0xC6, 0x7F, 0x33, 0x62, 0x17, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x4C, 0x82, 0xF3, 0x88, 0x0B, 0x07, 0x20 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xA0, 0xB8, 0x99, 0x6C, 0x2B, 0x8E, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xAF, 0x6E, 0x77, 0xBB, 0xAA, 0xCB, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0xC5, 0x6B, 0xBC, 0xC2, 0x24, 0x20, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xDC, 0xD0, 0x90, 0x5A, 0xFD, 0xB0, 0x75 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xE2, 0x9C, 0x60, 0x8E, 0xF1, 0x9E, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xD2, 0x31, 0x40, 0xEB, 0xE1, 0xB2, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xF4, 0xF1, 0xFC, 0x4C, 0x73, 0x9D, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x26, 0xBF, 0x58, 0x4B, 0xA4, 0xF9, 0x3C ),
+};
+static const mbedtls_mpi_uint secp256k1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x02, 0xB0, 0xAE, 0x9D, 0x9C, 0xD5, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xD0, 0x32, 0x8E, 0xDB, 0x98, 0x2C, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xAA, 0xF6, 0xED, 0x91, 0x9E, 0x90, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x16, 0x77, 0x45, 0xC6, 0xDD, 0x2D, 0x80 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x4D, 0xA3, 0x20, 0xEB, 0x3A, 0xBB, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x6C, 0xFD, 0xC7, 0x8A, 0xE0, 0x20, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xE4, 0x1B, 0xD9, 0xEA, 0x4F, 0x42, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x8E, 0x84, 0xDB, 0x27, 0x7E, 0x6B, 0xD4 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x69, 0xD3, 0xC9, 0x14, 0xCC, 0xCD, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xB6, 0x97, 0x3B, 0x7A, 0xA7, 0x82, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xEF, 0xCD, 0xBC, 0x79, 0xD0, 0xA6, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x67, 0x38, 0x69, 0x48, 0x16, 0xA6, 0x7A ),
+};
+static const mbedtls_mpi_uint secp256k1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x9E, 0x4E, 0xAD, 0xC1, 0x3D, 0xA3, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x0B, 0x21, 0x0C, 0x43, 0xB2, 0x15, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x1D, 0x99, 0x99, 0xEE, 0x7A, 0x1D, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xB7, 0xC3, 0x56, 0x06, 0xA7, 0x5E, 0x21 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x03, 0x76, 0x5D, 0x5D, 0x0D, 0x5B, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xA2, 0xA2, 0x39, 0x2C, 0x52, 0x25, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xC1, 0x70, 0x12, 0x89, 0x96, 0x13, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x5B, 0xE6, 0x77, 0x0E, 0x99, 0xCF, 0x97 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x40, 0xD3, 0x64, 0x3C, 0x0E, 0x15, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xCD, 0x79, 0x0A, 0x4A, 0xE2, 0x27, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x02, 0xB4, 0x6E, 0x3C, 0x94, 0xA8, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xF3, 0x9B, 0xF3, 0x6A, 0x12, 0x6F, 0x0C ),
+};
+static const mbedtls_mpi_uint secp256k1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x35, 0x99, 0x14, 0x7C, 0x6A, 0x75, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x27, 0x61, 0x47, 0xC1, 0x3A, 0xE3, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x10, 0xEC, 0x2B, 0x23, 0x90, 0xBD, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xE5, 0xCC, 0xF5, 0xE6, 0x2F, 0xCA, 0x6F ),
+};
+static const mbedtls_mpi_uint secp256k1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xF1, 0xE0, 0x01, 0x3A, 0xF8, 0xF0, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x24, 0x3B, 0x3A, 0x5A, 0xC8, 0x3C, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xB6, 0x9B, 0xF7, 0x64, 0x1B, 0xF6, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xAD, 0x2D, 0x7B, 0x64, 0x22, 0xBF, 0x81 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x5B, 0x7E, 0x60, 0x60, 0x08, 0xB9, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x54, 0xC5, 0xF5, 0xBF, 0x84, 0xA5, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xD9, 0x62, 0xE9, 0x5C, 0x6E, 0xF7, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x91, 0x4E, 0x2B, 0xFB, 0x5E, 0xD4, 0x60 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xE3, 0x17, 0x04, 0x0E, 0xAF, 0x84, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x5B, 0xAE, 0x0F, 0xAD, 0x3D, 0x8E, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x34, 0xA1, 0xE9, 0x61, 0x09, 0xEE, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x08, 0xA9, 0x8B, 0xBE, 0x90, 0xAD, 0xCA ),
+};
+static const mbedtls_mpi_uint secp256k1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xEE, 0xAE, 0x40, 0xCE, 0xB0, 0xA6, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xED, 0x52, 0x82, 0x97, 0x55, 0x1B, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xF8, 0xEF, 0x78, 0xE2, 0x6D, 0x5F, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xAE, 0xBD, 0x18, 0x6D, 0x44, 0xFB, 0xB0 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xCB, 0x52, 0xCC, 0x4E, 0x2E, 0x4C, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x9A, 0x4F, 0xA9, 0x8C, 0x65, 0x4F, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x23, 0x48, 0x73, 0x3E, 0x45, 0x02, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x07, 0x57, 0xCB, 0x4F, 0x3F, 0x57, 0x44 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x7B, 0x6E, 0x71, 0x2C, 0xA9, 0x2E, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x22, 0xC8, 0xB2, 0xAA, 0xD0, 0xA2, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xA7, 0xE2, 0x45, 0x71, 0x12, 0xAF, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xF5, 0xC8, 0x05, 0xFF, 0x13, 0xC6, 0xAD ),
+};
+static const mbedtls_mpi_uint secp256k1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xCB, 0x00, 0xFB, 0x3E, 0x79, 0xD9, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xD7, 0xB4, 0x71, 0xCC, 0xA7, 0xB7, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x03, 0x87, 0xE3, 0x04, 0x4C, 0x25, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x80, 0x22, 0xF2, 0x92, 0x9A, 0x7F, 0xC9 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x52, 0x60, 0x93, 0x32, 0x0C, 0x6E, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xB9, 0x59, 0x8D, 0x8A, 0x12, 0xDF, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x30, 0x22, 0x40, 0x02, 0xA2, 0xEB, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xEF, 0x7B, 0x06, 0x14, 0x7F, 0xAC, 0x37 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xE7, 0x29, 0xDA, 0x5D, 0xBB, 0xBB, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x9B, 0x6E, 0xA7, 0x8F, 0x5F, 0x45, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xB4, 0xEC, 0xB5, 0x33, 0x35, 0xBA, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xC6, 0xC1, 0x57, 0x1F, 0x32, 0x8E, 0x28 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x59, 0xDA, 0x95, 0x90, 0xB7, 0x71, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x85, 0x74, 0x0A, 0xF6, 0x4F, 0xA0, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xA2, 0xD6, 0xD5, 0x47, 0x99, 0xB5, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x5A, 0x89, 0x3B, 0x38, 0xEE, 0x7D, 0x9E ),
+};
+static const mbedtls_mpi_uint secp256k1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x48, 0xEE, 0x53, 0x1A, 0xBA, 0x0F, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xA8, 0x6C, 0x02, 0x21, 0x19, 0x4A, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xCC, 0xC7, 0x0A, 0xC3, 0xB3, 0x1A, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x22, 0x07, 0x78, 0xFA, 0x1B, 0x83, 0x49 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x0F, 0x53, 0x1F, 0x49, 0xAD, 0xCC, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x1B, 0x3B, 0xFB, 0x7F, 0x1D, 0xE9, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xBF, 0x91, 0xBA, 0xFD, 0x93, 0x28, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xBA, 0x0F, 0x57, 0xD2, 0x8A, 0x89, 0x25 ),
+};
+static const mbedtls_mpi_uint secp256k1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x80, 0x71, 0x1B, 0x82, 0x59, 0xAA, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x4C, 0xC5, 0xC7, 0x4C, 0xE3, 0x89, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x03, 0x82, 0xF2, 0xD1, 0xAA, 0xD4, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x76, 0x26, 0xB0, 0xD4, 0xB6, 0x88, 0x21 ),
+};
+static const mbedtls_ecp_point secp256k1_T[32] = {
+    ECP_POINT_INIT_XY_Z1(secp256k1_T_0_X, secp256k1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_1_X, secp256k1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_2_X, secp256k1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_3_X, secp256k1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_4_X, secp256k1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_5_X, secp256k1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_6_X, secp256k1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_7_X, secp256k1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_8_X, secp256k1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_9_X, secp256k1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_10_X, secp256k1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_11_X, secp256k1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_12_X, secp256k1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_13_X, secp256k1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_14_X, secp256k1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_15_X, secp256k1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_16_X, secp256k1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_17_X, secp256k1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_18_X, secp256k1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_19_X, secp256k1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_20_X, secp256k1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_21_X, secp256k1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_22_X, secp256k1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_23_X, secp256k1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_24_X, secp256k1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_25_X, secp256k1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_26_X, secp256k1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_27_X, secp256k1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_28_X, secp256k1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_29_X, secp256k1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_30_X, secp256k1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(secp256k1_T_31_X, secp256k1_T_31_Y),
+};
 #else
 #define secp256k1_T NULL
 #endif
@@ -2939,7 +7899,8 @@ static const mbedtls_mpi_uint brainpoolP256r1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xA9, 0xEE, 0xA1, 0xDB, 0x57, 0xFB, 0xA9 ),
 };
 
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint brainpoolP256r1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x32, 0xCE, 0x9A, 0xBD, 0x53, 0x44, 0x3A ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x23, 0xBD, 0xE3, 0xE1, 0x27, 0xDE, 0xB9 ),
@@ -3132,7 +8093,410 @@ static const mbedtls_mpi_uint brainpoolP256r1_T_15_Y[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xA1, 0xE5, 0x5C, 0xC9, 0x1D, 0x44, 0x45 ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xE8, 0xE6, 0x6F, 0xBB, 0xC1, 0x81, 0x7F ),
 };
-static const mbedtls_ecp_point brainpoolP256r1_T[16] = {
+static const mbedtls_ecp_point brainpoolP256r1_T[16] = {
+    ECP_POINT_INIT_XY_Z1(brainpoolP256r1_T_0_X, brainpoolP256r1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_1_X, brainpoolP256r1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_2_X, brainpoolP256r1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_3_X, brainpoolP256r1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_4_X, brainpoolP256r1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_5_X, brainpoolP256r1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_6_X, brainpoolP256r1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_7_X, brainpoolP256r1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_8_X, brainpoolP256r1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_9_X, brainpoolP256r1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_10_X, brainpoolP256r1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_11_X, brainpoolP256r1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_12_X, brainpoolP256r1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_13_X, brainpoolP256r1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_14_X, brainpoolP256r1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_15_X, brainpoolP256r1_T_15_Y),
+};
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint brainpoolP256r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x32, 0xCE, 0x9A, 0xBD, 0x53, 0x44, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x23, 0xBD, 0xE3, 0xE1, 0x27, 0xDE, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xB7, 0x81, 0xFC, 0x2F, 0x48, 0x4B, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x57, 0x7E, 0xCB, 0xB9, 0xAE, 0xD2, 0x8B ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x69, 0x04, 0x2F, 0xC7, 0x54, 0x1D, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x8E, 0xED, 0x2D, 0x13, 0x45, 0x77, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x1D, 0x61, 0x14, 0x1A, 0x46, 0xF8, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xC4, 0xDA, 0xC3, 0x35, 0xF8, 0x7E, 0x54 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x98, 0xBB, 0x54, 0xB4, 0x99, 0xB8, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x48, 0xDE, 0x71, 0x00, 0x91, 0x8D, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x52, 0xEF, 0xEC, 0xD3, 0x5E, 0xBE, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x47, 0x55, 0xEC, 0x98, 0x72, 0x8A, 0x60 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xBE, 0xFC, 0x16, 0xCC, 0xBE, 0x5E, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xB6, 0x0D, 0xE1, 0xA7, 0xAF, 0xF8, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x9B, 0xF1, 0xB1, 0x4F, 0x24, 0x5F, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x90, 0x35, 0xED, 0x0E, 0x9D, 0x19, 0xA8 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x49, 0xA0, 0x61, 0x7A, 0xB0, 0x6B, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xCE, 0x73, 0xB4, 0xD2, 0xC8, 0x10, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x99, 0x61, 0x5A, 0xB0, 0x82, 0x7D, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xFC, 0xE4, 0x31, 0xD9, 0x18, 0x8C, 0x8D ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xFC, 0x4B, 0x7C, 0xD8, 0x69, 0x4A, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xC9, 0x38, 0x75, 0xB9, 0xE4, 0x5D, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xD3, 0x72, 0xAE, 0x56, 0xD4, 0x3A, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xDB, 0xEA, 0x73, 0xDA, 0xB6, 0x07, 0x03 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xA9, 0xB7, 0x68, 0x54, 0x79, 0x86, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xDE, 0x9F, 0x3B, 0x12, 0x1F, 0x6E, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xC2, 0x2C, 0x23, 0x12, 0x88, 0x34, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xE5, 0xAB, 0x08, 0xA2, 0x34, 0xA4, 0x54 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x71, 0x80, 0xDD, 0x4E, 0xE0, 0xA4, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x4A, 0xB6, 0xAA, 0x08, 0xF4, 0x23, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x53, 0xD0, 0xC2, 0x49, 0x93, 0x11, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xFC, 0x82, 0xAD, 0xA8, 0x97, 0xC2, 0x9F ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x04, 0x01, 0x36, 0x0D, 0xA5, 0x81, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x45, 0x97, 0x78, 0x49, 0x9E, 0x90, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x81, 0xF4, 0xC3, 0x40, 0x47, 0x5E, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x61, 0x6A, 0xF2, 0xF6, 0x6C, 0xBD, 0x9A ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xEE, 0xF4, 0x4B, 0x9C, 0x6E, 0xA7, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xEF, 0x12, 0xE3, 0x43, 0x0D, 0xC3, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x08, 0xCB, 0xB7, 0xC2, 0xAE, 0xB4, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x33, 0xD7, 0x93, 0x42, 0x22, 0x23, 0x2A ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xA9, 0x67, 0x47, 0xB0, 0xD2, 0x8E, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x71, 0x60, 0xB4, 0x91, 0x27, 0xC2, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x84, 0xE5, 0x3A, 0x90, 0x9A, 0xEC, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x39, 0x96, 0x42, 0x67, 0x49, 0x03, 0x7B ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xEC, 0x8B, 0xA7, 0xB1, 0xE9, 0xC2, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x8A, 0x3E, 0xAF, 0x61, 0xDA, 0x65, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x7F, 0x27, 0xE2, 0x93, 0x53, 0x33, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xBB, 0xEC, 0xB4, 0x2D, 0xD6, 0x5B, 0x86 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x28, 0x86, 0x7D, 0xAD, 0x75, 0xC8, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xE2, 0xBB, 0xA8, 0xAF, 0xC9, 0x2C, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x35, 0xD2, 0x30, 0xE0, 0xC5, 0xFC, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x39, 0xC0, 0x7B, 0x6A, 0x19, 0xAB, 0x77 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x98, 0xAC, 0x33, 0x2F, 0xCB, 0x91, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x2A, 0x24, 0x98, 0xBE, 0x15, 0xF9, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x40, 0xEF, 0x50, 0x44, 0xA9, 0x6D, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x7E, 0xFC, 0x4F, 0xCC, 0xD2, 0x01, 0x8E ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xC9, 0x59, 0x18, 0xB4, 0x0E, 0x1B, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xED, 0xB0, 0xE1, 0x53, 0xE0, 0xB0, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xD7, 0xCC, 0x3A, 0x99, 0x41, 0x23, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x4B, 0x75, 0x58, 0x5F, 0x11, 0x57, 0x60 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x80, 0xD9, 0x34, 0x9D, 0x19, 0x95, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x17, 0x92, 0x65, 0x7C, 0xA7, 0x10, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x11, 0x3E, 0xF1, 0x84, 0x9A, 0x40, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x2A, 0x39, 0x56, 0x10, 0xCF, 0x31, 0x54 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x86, 0xC3, 0xA5, 0xCB, 0x49, 0x72, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x4A, 0x1B, 0x6F, 0xC6, 0x91, 0x37, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xEE, 0x5F, 0xD8, 0xFB, 0x74, 0xB4, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xED, 0xC7, 0xE4, 0x22, 0xFC, 0xC7, 0x89 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x64, 0xCD, 0xEF, 0x69, 0xE6, 0xF9, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xDD, 0x9C, 0xBA, 0x78, 0x48, 0x3C, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xBB, 0xDC, 0x07, 0x99, 0xE8, 0x13, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x40, 0x85, 0xE9, 0xF1, 0x31, 0x0B, 0x8F ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x9C, 0x19, 0x2A, 0x7C, 0x6A, 0xE6, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xED, 0x1D, 0x66, 0x18, 0x91, 0xFB, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xB2, 0x4A, 0xC2, 0xDA, 0x52, 0x48, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x0E, 0xDB, 0x4B, 0xE7, 0x13, 0xA5, 0x3D ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xE4, 0xA4, 0x2E, 0x91, 0x1B, 0xE2, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x34, 0x37, 0xF8, 0x9A, 0x7C, 0xC3, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xA3, 0xF6, 0x6E, 0x3B, 0xCD, 0x46, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x9C, 0x02, 0xC1, 0x8F, 0x21, 0xDF, 0x46 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xB5, 0x4F, 0x9C, 0xAC, 0x95, 0xCC, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xF0, 0x13, 0xF1, 0x81, 0xA8, 0xA8, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x98, 0x70, 0xE2, 0x54, 0x8C, 0xF7, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x71, 0xB2, 0xE7, 0x9E, 0x9B, 0xFB, 0x04 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x6C, 0x46, 0x65, 0x24, 0xA9, 0x6B, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x65, 0xC7, 0xA1, 0x00, 0x8A, 0xB7, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x4A, 0xF9, 0x49, 0xE9, 0xCF, 0xD1, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xCE, 0x92, 0xA6, 0x6C, 0x82, 0xCC, 0x5D ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x17, 0xDA, 0x9C, 0x26, 0xA3, 0x5C, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xE0, 0xCE, 0x47, 0x78, 0x0C, 0x0D, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0xCC, 0x7F, 0x87, 0xCE, 0xFC, 0xE8, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xB9, 0x3F, 0x61, 0xFE, 0x99, 0xA3, 0x18 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0xC1, 0xE9, 0xFF, 0x03, 0x2E, 0xA4, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x59, 0xAE, 0xDF, 0x69, 0x90, 0xF2, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x57, 0x05, 0x82, 0x59, 0x88, 0xC7, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xB9, 0x40, 0x3B, 0xE0, 0xDF, 0xDE, 0x6E ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xC3, 0xE5, 0x21, 0x9C, 0xB0, 0x4D, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x86, 0xB4, 0xA8, 0x3F, 0xAB, 0x9F, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x16, 0xCD, 0xAB, 0xA7, 0xB7, 0x12, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x2B, 0xC2, 0x3E, 0x68, 0xE3, 0xF5, 0x1E ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x0A, 0x8A, 0x66, 0xD8, 0xDF, 0x8D, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x47, 0xBC, 0x07, 0x2F, 0x5F, 0xA2, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xDE, 0x54, 0x90, 0x28, 0x2A, 0x65, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x4F, 0x4F, 0x93, 0xED, 0xA9, 0x7A, 0x65 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xC3, 0x70, 0x50, 0xA6, 0x05, 0x45, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xB6, 0x35, 0x5E, 0x21, 0x78, 0x4D, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x10, 0x65, 0xEB, 0xF6, 0xCE, 0xA4, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xF6, 0x4F, 0x36, 0x09, 0x50, 0xE8, 0x1D ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xAC, 0xEF, 0x2B, 0x88, 0x35, 0xB1, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xED, 0x12, 0x3C, 0x24, 0xBF, 0xE0, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x3F, 0x3F, 0x80, 0xA3, 0x8C, 0x90, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x0E, 0xA8, 0x48, 0x90, 0x07, 0xF8, 0x59 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xA3, 0x4D, 0x8F, 0x7E, 0x9A, 0xF1, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xA0, 0x0F, 0xEC, 0x69, 0xD0, 0x50, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x1B, 0xA2, 0x9A, 0x85, 0x4D, 0x16, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xDC, 0x47, 0x28, 0x77, 0x54, 0x7E, 0x60 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xAE, 0xCB, 0xF2, 0xCB, 0xE6, 0x68, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x83, 0x48, 0x26, 0x26, 0x5D, 0xED, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xA8, 0x95, 0xB7, 0x91, 0xD5, 0x72, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xEB, 0xC9, 0x36, 0x98, 0x56, 0x1C, 0x2B ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x1C, 0x93, 0x92, 0x78, 0x30, 0x28, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xC4, 0x09, 0x37, 0xD1, 0xAD, 0x25, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x45, 0xCA, 0xD4, 0x6B, 0xF8, 0xC8, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x16, 0x59, 0x39, 0x7F, 0xA2, 0xB7, 0x1D ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xA5, 0x12, 0x58, 0xC7, 0x56, 0x1D, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xB5, 0x12, 0x12, 0x23, 0x17, 0x99, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x9E, 0x02, 0x7C, 0x85, 0x46, 0x4C, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x48, 0xB6, 0x89, 0x05, 0xDB, 0x70, 0x43 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x80, 0x16, 0x32, 0x5E, 0xB6, 0x14, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x2B, 0xF1, 0xE9, 0x97, 0xAF, 0x6E, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x96, 0xE4, 0x2A, 0x27, 0xA6, 0xD6, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x48, 0xAD, 0xBB, 0x82, 0xCB, 0x67, 0x96 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x18, 0x6A, 0xD8, 0x89, 0xC1, 0x16, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xD0, 0x08, 0x3B, 0x01, 0x43, 0xA2, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x0E, 0xB0, 0xF4, 0x55, 0x39, 0xA7, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xFD, 0xE1, 0xFA, 0x70, 0x6F, 0xAA, 0x23 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xBA, 0x22, 0xBC, 0x46, 0x03, 0x32, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x99, 0xF8, 0xB1, 0x5F, 0x2E, 0xEF, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xC2, 0xF4, 0x19, 0x17, 0x7E, 0x66, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x04, 0xDA, 0x04, 0x4D, 0x32, 0x3B, 0x9B ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x2D, 0x05, 0x26, 0x14, 0xCB, 0x86, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xCE, 0x65, 0x02, 0x36, 0xC4, 0xFB, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xC6, 0xC2, 0xF4, 0xB4, 0x4B, 0xE1, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x26, 0xB4, 0x0D, 0xEB, 0x83, 0x55, 0x5C ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x5A, 0x79, 0x2C, 0xCD, 0x38, 0x84, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xF6, 0xB9, 0x6A, 0x35, 0xE3, 0x1D, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x99, 0x3D, 0xCC, 0xA6, 0x04, 0xE1, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x45, 0x5A, 0x42, 0xA9, 0xA6, 0xF1, 0x34 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x3D, 0x69, 0xAE, 0x7F, 0x46, 0x95, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xE4, 0x02, 0x36, 0x08, 0xBD, 0x76, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xF5, 0xC2, 0xA7, 0x48, 0x4D, 0x99, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x4E, 0x22, 0xC8, 0x95, 0x3E, 0x37, 0x47 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xCE, 0x18, 0xD2, 0xE6, 0x32, 0x3C, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x52, 0x7D, 0x3F, 0x55, 0xDE, 0xD5, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xFA, 0x69, 0x5A, 0x7C, 0xBB, 0x4F, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0xA8, 0x06, 0x13, 0x0E, 0x5D, 0xCD, 0x16 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xF6, 0xC2, 0x67, 0x32, 0xD3, 0x16, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xEC, 0xC6, 0xA5, 0x93, 0x2A, 0xF4, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x7D, 0xE8, 0xFA, 0x29, 0xEE, 0x58, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x77, 0xC4, 0xF7, 0x65, 0x98, 0xC8, 0xA6 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x3D, 0x98, 0x95, 0x0A, 0x25, 0xD3, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x19, 0xCD, 0xCA, 0x1B, 0x4B, 0x88, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x00, 0xE6, 0x25, 0x70, 0x24, 0xEF, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xAB, 0x54, 0xFE, 0x28, 0xCA, 0xE3, 0x50 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x28, 0xD1, 0x85, 0xD2, 0x9D, 0xA4, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x4D, 0xFC, 0xE7, 0xD8, 0xAA, 0x2F, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x36, 0xC6, 0xC3, 0x1A, 0xB9, 0x07, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x73, 0x57, 0xFF, 0x32, 0x43, 0x05, 0x3E ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x06, 0x9C, 0x27, 0x54, 0x83, 0xDD, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xAD, 0xD2, 0x64, 0x89, 0x28, 0x7B, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xA5, 0x10, 0x59, 0xDF, 0xB5, 0xE8, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xE0, 0x3D, 0xB2, 0x4F, 0xAE, 0x5A, 0x79 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x76, 0x33, 0xD8, 0x93, 0x0F, 0xC7, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xDB, 0x13, 0x9C, 0x35, 0xB5, 0x35, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x2D, 0x25, 0x84, 0x82, 0x33, 0xA4, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x22, 0xF2, 0xBF, 0x37, 0xE2, 0x6E, 0x07 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xC3, 0x4B, 0x1C, 0x50, 0x76, 0xFE, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xCE, 0xB8, 0x14, 0xF9, 0x07, 0x99, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x91, 0xD7, 0xE4, 0x98, 0xDC, 0xD4, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x5D, 0xAA, 0x5C, 0xB3, 0xA7, 0x89, 0x83 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x2F, 0xB8, 0x06, 0x10, 0x1B, 0xC7, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x1D, 0xB9, 0x18, 0xF9, 0x86, 0xA7, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0x32, 0xBC, 0x36, 0xB1, 0x3F, 0xD4, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xF4, 0x04, 0x5C, 0xC9, 0x40, 0x00, 0x39 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xCC, 0x16, 0xCF, 0xF7, 0xCA, 0x52, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x73, 0x13, 0xA5, 0xC3, 0x80, 0x4B, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x4A, 0x9D, 0x99, 0x50, 0x62, 0xF5, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x13, 0x50, 0xA1, 0x82, 0x11, 0xD0, 0x2C ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x24, 0x30, 0x7B, 0x4D, 0x93, 0x50, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x33, 0x00, 0xFB, 0xE8, 0x29, 0x88, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xE5, 0xB9, 0xCF, 0xD9, 0x99, 0x4E, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x8A, 0x0A, 0xD0, 0x70, 0xF0, 0x04, 0xA4 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x0A, 0x85, 0x4C, 0x12, 0x33, 0x7D, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xDC, 0x23, 0xB7, 0x52, 0xB0, 0xEB, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x72, 0x32, 0x9D, 0xEF, 0xC3, 0x95, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xCF, 0xAA, 0xD6, 0x9E, 0x9D, 0x8C, 0x6E ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xE0, 0x20, 0xA8, 0xD6, 0x6A, 0x0C, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x67, 0xC3, 0x7A, 0x73, 0x2A, 0xC6, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x8A, 0x3E, 0xB4, 0x69, 0xD2, 0xEC, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x75, 0xFB, 0x59, 0x12, 0x0F, 0xC9, 0x04 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x46, 0x83, 0x95, 0xA8, 0x31, 0x51, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xA0, 0x93, 0x90, 0x7A, 0x82, 0x7B, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x71, 0x0D, 0x6D, 0xDA, 0xBF, 0x5E, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x1E, 0xEF, 0xF4, 0xBE, 0x80, 0x8F, 0x27 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x7D, 0xF3, 0x05, 0x11, 0x2A, 0x92, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xEE, 0x48, 0xA3, 0x8F, 0x1B, 0x2A, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x16, 0x9E, 0xE9, 0x07, 0x70, 0x9F, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x55, 0x65, 0x89, 0x4B, 0x26, 0xCB, 0x2D ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x78, 0x0B, 0xFD, 0x8D, 0xE3, 0x42, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xAA, 0xCF, 0x39, 0x89, 0x43, 0x06, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x95, 0xB1, 0x95, 0x30, 0x9D, 0x0F, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x37, 0x7C, 0x76, 0x13, 0x5F, 0xA5, 0x4D ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xF9, 0x27, 0xD8, 0x21, 0x67, 0x25, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x51, 0x38, 0x01, 0xDE, 0x77, 0xE6, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x51, 0xF0, 0x04, 0x8F, 0xF8, 0x08, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x2C, 0x7D, 0x84, 0x7A, 0xF5, 0xE2, 0x30 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x6E, 0x17, 0xAA, 0xDD, 0xB8, 0x5D, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xC3, 0xB1, 0xF5, 0xC4, 0x9C, 0x12, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xC8, 0xD7, 0xDC, 0x60, 0x15, 0xED, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xE8, 0xAB, 0x4F, 0x1C, 0x98, 0x09, 0x86 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xEF, 0x00, 0x92, 0x6C, 0x82, 0xF9, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xFC, 0x83, 0xE2, 0x59, 0x9B, 0x46, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x5B, 0x59, 0x41, 0xF3, 0x4B, 0x91, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x83, 0x12, 0x56, 0xF9, 0xDE, 0xDB, 0x0C ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x58, 0x55, 0x14, 0x38, 0xFA, 0x6D, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x45, 0xAB, 0xDC, 0x55, 0x43, 0x7E, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x20, 0x07, 0x6E, 0x5E, 0x4E, 0xCD, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x89, 0xB4, 0xE8, 0x08, 0x23, 0x7B, 0x8A ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xF8, 0x2D, 0x15, 0xB1, 0x41, 0x6E, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xC1, 0x9A, 0x2F, 0xE2, 0x15, 0xB6, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xD5, 0x4D, 0xBD, 0xDE, 0x5D, 0xF8, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xCB, 0xE5, 0xC4, 0x8A, 0xC5, 0x15, 0x1B ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x81, 0xAE, 0x81, 0x24, 0x20, 0xD6, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x80, 0xC0, 0xB6, 0x16, 0x8B, 0xD9, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x34, 0x62, 0x7F, 0xD2, 0x73, 0x74, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x28, 0xB3, 0xDC, 0x72, 0xE8, 0xBD, 0x09 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x6F, 0xA3, 0x84, 0xF5, 0x2F, 0x0F, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x29, 0x8E, 0x0F, 0x11, 0x56, 0x5B, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x78, 0xEF, 0xC9, 0xDB, 0x0E, 0x9F, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x82, 0x1C, 0xA2, 0xFD, 0x40, 0x60, 0x37 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xB3, 0x32, 0x4C, 0xAA, 0x05, 0x13, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xDD, 0xB5, 0xB0, 0xDD, 0xA0, 0xDA, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xAF, 0xD4, 0x5E, 0xE7, 0xBA, 0xF3, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x5A, 0x85, 0x8C, 0x79, 0x18, 0x94, 0x4B ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x49, 0x15, 0x39, 0x69, 0x76, 0x93, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x3B, 0xA7, 0xAB, 0x8F, 0x6F, 0x9D, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x9D, 0xEF, 0xDB, 0xD8, 0x1B, 0x95, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x1D, 0x0E, 0x54, 0x7C, 0xEE, 0xE8, 0x72 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x90, 0xC9, 0x05, 0xDC, 0x47, 0x0B, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x95, 0x64, 0x20, 0x74, 0xDD, 0xE9, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x36, 0x2F, 0xB8, 0x60, 0x5D, 0xC2, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x29, 0x9E, 0xDE, 0xB7, 0xC0, 0x6F, 0x36 ),
+};
+static const mbedtls_mpi_uint brainpoolP256r1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xF5, 0xA6, 0xC2, 0x2A, 0x15, 0xC4, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x36, 0xA0, 0x1C, 0x80, 0x7C, 0x34, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x8E, 0x82, 0x9F, 0x5F, 0x5D, 0x9A, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xA9, 0x16, 0xDB, 0x4A, 0xFC, 0x16, 0x82 ),
+};
+static const mbedtls_ecp_point brainpoolP256r1_T[32] = {
     ECP_POINT_INIT_XY_Z1(brainpoolP256r1_T_0_X, brainpoolP256r1_T_0_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_1_X, brainpoolP256r1_T_1_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_2_X, brainpoolP256r1_T_2_Y),
@@ -3149,6 +8513,22 @@ static const mbedtls_ecp_point brainpoolP256r1_T[16] = {
     ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_13_X, brainpoolP256r1_T_13_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_14_X, brainpoolP256r1_T_14_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_15_X, brainpoolP256r1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_16_X, brainpoolP256r1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_17_X, brainpoolP256r1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_18_X, brainpoolP256r1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_19_X, brainpoolP256r1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_20_X, brainpoolP256r1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_21_X, brainpoolP256r1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_22_X, brainpoolP256r1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_23_X, brainpoolP256r1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_24_X, brainpoolP256r1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_25_X, brainpoolP256r1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_26_X, brainpoolP256r1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_27_X, brainpoolP256r1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_28_X, brainpoolP256r1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_29_X, brainpoolP256r1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_30_X, brainpoolP256r1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP256r1_T_31_X, brainpoolP256r1_T_31_Y),
 };
 #else
 #define brainpoolP256r1_T NULL
@@ -3209,7 +8589,8 @@ static const mbedtls_mpi_uint brainpoolP384r1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x6D, 0x38, 0xA3, 0x82, 0x1E, 0xB9, 0x8C ),
 };
 
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint brainpoolP384r1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xAF, 0xD4, 0x47, 0xE2, 0xB2, 0x87, 0xEF ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x46, 0xD6, 0x36, 0x34, 0xE0, 0x26, 0xE8 ),
@@ -3619,110 +9000,1169 @@ static const mbedtls_mpi_uint brainpoolP384r1_T_25_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x06, 0x42, 0xDC, 0xA6, 0xE3, 0xC6, 0x12 ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_25_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x8C, 0x3D, 0x5D, 0x47, 0x31, 0x7C, 0xEB ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x85, 0xEE, 0x46, 0x7E, 0x13, 0x04, 0x41 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x3C, 0x8B, 0x43, 0x2E, 0x74, 0xF5, 0xF6 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x88, 0x8E, 0x07, 0x29, 0x08, 0x03, 0x26 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x9B, 0x89, 0xEB, 0x08, 0xE8, 0x43, 0xB5 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x07, 0x67, 0xFD, 0xD9, 0x73, 0x6F, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x8C, 0x3D, 0x5D, 0x47, 0x31, 0x7C, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x85, 0xEE, 0x46, 0x7E, 0x13, 0x04, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x3C, 0x8B, 0x43, 0x2E, 0x74, 0xF5, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x88, 0x8E, 0x07, 0x29, 0x08, 0x03, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x9B, 0x89, 0xEB, 0x08, 0xE8, 0x43, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x07, 0x67, 0xFD, 0xD9, 0x73, 0x6F, 0x18 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xEB, 0x21, 0x8D, 0x98, 0x43, 0x74, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xCC, 0x14, 0xD8, 0x08, 0xBB, 0xA6, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x98, 0xF2, 0x6A, 0x18, 0xC3, 0xDD, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x38, 0x91, 0xA0, 0x03, 0xF2, 0x04, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xAF, 0xE8, 0xFD, 0xFB, 0x13, 0x70, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x93, 0x87, 0x98, 0x4A, 0xE0, 0x00, 0x12 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x2E, 0x69, 0x9C, 0xA2, 0x2D, 0x03, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xFE, 0xF3, 0xB9, 0xC1, 0x85, 0x2A, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xFD, 0x86, 0xB1, 0xCD, 0xBF, 0x41, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xD8, 0x9A, 0x21, 0xF3, 0xFE, 0xCB, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x78, 0x04, 0x60, 0xB7, 0xA9, 0xA2, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x1E, 0x66, 0x2A, 0x54, 0x51, 0xBD, 0x8B ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x16, 0x36, 0xEF, 0x61, 0x2D, 0xEE, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x5F, 0x88, 0xA0, 0x13, 0x12, 0xF7, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xC6, 0xAD, 0x4A, 0x4A, 0x07, 0x01, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x74, 0xB1, 0x4F, 0xEB, 0xBD, 0xD5, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xF9, 0x71, 0xA2, 0x06, 0x4F, 0xD7, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x8B, 0x4D, 0x48, 0xE0, 0x98, 0xFB, 0x6A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xBA, 0x10, 0xA3, 0x0D, 0x52, 0xAC, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xD0, 0xE0, 0x36, 0xE6, 0x07, 0x3A, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x80, 0xF0, 0xAA, 0x49, 0x22, 0x4B, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xC7, 0xAB, 0x1C, 0x89, 0xCD, 0x24, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x2A, 0xFC, 0xB3, 0x6D, 0x45, 0x96, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xE4, 0xDB, 0x52, 0x3F, 0xC4, 0xB4, 0x19 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xCC, 0xC8, 0x7F, 0xBB, 0x6B, 0x87, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x21, 0x3C, 0x69, 0x7D, 0x38, 0x57, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x4C, 0x18, 0x3C, 0x53, 0xA5, 0x48, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xC3, 0x64, 0x45, 0xDB, 0xC4, 0x6D, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xCC, 0xD1, 0xBB, 0x17, 0xB8, 0x34, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x69, 0x71, 0xFA, 0xA0, 0x28, 0x4A, 0x3D ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xE8, 0x9E, 0x39, 0xEA, 0x8D, 0x38, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x9C, 0xBB, 0xCD, 0x80, 0x1A, 0xEE, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xA0, 0x45, 0xBF, 0xD9, 0x22, 0x11, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x7C, 0x5C, 0xD9, 0xC0, 0x9F, 0x69, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x8A, 0xA6, 0x79, 0x4E, 0x35, 0xB9, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x8B, 0x9A, 0x3E, 0xA1, 0xB8, 0x28, 0x10 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x2F, 0xEF, 0xBB, 0xA9, 0x72, 0x7F, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x34, 0xB7, 0x12, 0xB9, 0xE7, 0xC3, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x1D, 0xD9, 0x42, 0x77, 0x0C, 0x71, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x01, 0x59, 0xA7, 0x56, 0x03, 0x91, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x91, 0x99, 0x33, 0x30, 0x3E, 0xEF, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xC9, 0x5A, 0x9A, 0x54, 0x66, 0xF1, 0x70 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x2C, 0xB7, 0x6E, 0x71, 0x7D, 0x35, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x0D, 0xEF, 0xD1, 0x2D, 0x99, 0x63, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x31, 0xAF, 0x2D, 0xC9, 0xC6, 0xC2, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xC0, 0xDF, 0x80, 0x54, 0xC4, 0xAC, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x6B, 0xA0, 0x84, 0x96, 0xF7, 0x31, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xE2, 0x7C, 0x7A, 0x41, 0x45, 0x75, 0x6A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xEE, 0x58, 0x31, 0xE8, 0x68, 0xD6, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x2E, 0x48, 0xB7, 0x09, 0x9F, 0xD4, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xA9, 0x5C, 0xE7, 0x64, 0x43, 0x5D, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x58, 0x9F, 0x50, 0xAB, 0x68, 0xFF, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x88, 0x2D, 0xBA, 0x12, 0xBF, 0x8D, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xDF, 0x6F, 0xB3, 0x75, 0xA4, 0x55, 0x73 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x17, 0x92, 0x39, 0xB7, 0x13, 0x37, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x43, 0x71, 0xA7, 0xCA, 0x17, 0x1B, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xB9, 0xB0, 0x78, 0xEF, 0xA0, 0xDA, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x84, 0xF2, 0x0F, 0x85, 0xA2, 0xB6, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x65, 0x2E, 0x6E, 0x45, 0xB9, 0x4C, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x6A, 0x8C, 0x2B, 0x77, 0x96, 0x36, 0x22 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x7A, 0x13, 0x4A, 0x97, 0x63, 0x02, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x1E, 0x06, 0x03, 0x8F, 0xB9, 0xEE, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xEE, 0x8B, 0x89, 0xA9, 0x70, 0xDB, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x7B, 0x81, 0xC9, 0x70, 0x8D, 0x62, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xDA, 0x46, 0xF8, 0xF9, 0x3A, 0xBE, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x9C, 0x7A, 0x97, 0x62, 0xEB, 0xFA, 0x0F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x03, 0x3D, 0x3C, 0x46, 0x27, 0x9E, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x08, 0x1C, 0xD5, 0x25, 0xAF, 0xE9, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x69, 0xDC, 0x59, 0xF4, 0x8A, 0x7C, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x9A, 0x7A, 0x99, 0x21, 0x0C, 0x4E, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xCE, 0x85, 0x5F, 0xAC, 0xAA, 0x82, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x57, 0x69, 0x90, 0x76, 0xF3, 0x53, 0x3F ),
+};
+static const mbedtls_ecp_point brainpoolP384r1_T[32] = {
+    ECP_POINT_INIT_XY_Z1(brainpoolP384r1_T_0_X, brainpoolP384r1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_1_X, brainpoolP384r1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_2_X, brainpoolP384r1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_3_X, brainpoolP384r1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_4_X, brainpoolP384r1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_5_X, brainpoolP384r1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_6_X, brainpoolP384r1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_7_X, brainpoolP384r1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_8_X, brainpoolP384r1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_9_X, brainpoolP384r1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_10_X, brainpoolP384r1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_11_X, brainpoolP384r1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_12_X, brainpoolP384r1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_13_X, brainpoolP384r1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_14_X, brainpoolP384r1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_15_X, brainpoolP384r1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_16_X, brainpoolP384r1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_17_X, brainpoolP384r1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_18_X, brainpoolP384r1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_19_X, brainpoolP384r1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_20_X, brainpoolP384r1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_21_X, brainpoolP384r1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_22_X, brainpoolP384r1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_23_X, brainpoolP384r1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_24_X, brainpoolP384r1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_25_X, brainpoolP384r1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_26_X, brainpoolP384r1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_27_X, brainpoolP384r1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_28_X, brainpoolP384r1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_29_X, brainpoolP384r1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_30_X, brainpoolP384r1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_31_X, brainpoolP384r1_T_31_Y),
+};
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint brainpoolP384r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0xAF, 0xD4, 0x47, 0xE2, 0xB2, 0x87, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x46, 0xD6, 0x36, 0x34, 0xE0, 0x26, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x10, 0xBD, 0x0C, 0xFE, 0xCA, 0x7F, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x4F, 0xF1, 0x7E, 0xE7, 0xA3, 0x47, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x3F, 0xC1, 0xB7, 0x81, 0x3A, 0xA6, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x45, 0xCF, 0x68, 0xF0, 0x64, 0x1C, 0x1D ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x53, 0x3C, 0x26, 0x41, 0x03, 0x82, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x81, 0x91, 0x77, 0x21, 0x46, 0x46, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x29, 0x91, 0xF9, 0x4F, 0x05, 0x9C, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x58, 0xEC, 0xFE, 0x29, 0x0B, 0xB7, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xD5, 0xCF, 0x95, 0x8E, 0xEB, 0xB1, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xC2, 0xF9, 0x20, 0x75, 0x1D, 0xBE, 0x8A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x69, 0xD5, 0x89, 0xA9, 0xE0, 0x28, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xE4, 0xBD, 0x84, 0x57, 0x34, 0x3E, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x37, 0xCC, 0x0B, 0xE6, 0xC5, 0x49, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xE1, 0x6A, 0x18, 0x3A, 0x09, 0x1A, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x96, 0xF6, 0x40, 0xB9, 0x03, 0xF6, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x98, 0x94, 0xA7, 0xF1, 0xA8, 0x19, 0x74 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x0E, 0x4A, 0xC2, 0x2D, 0x00, 0xBD, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x90, 0xC2, 0xDB, 0x52, 0x31, 0xCE, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0xCF, 0x25, 0x6B, 0x3F, 0xCB, 0x3F, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x28, 0xB8, 0xF8, 0x71, 0x8F, 0x11, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x0C, 0x52, 0x33, 0xA4, 0x13, 0xCE, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x58, 0x6E, 0xCE, 0x2E, 0x15, 0x95, 0x59 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x82, 0x2E, 0x1E, 0xE6, 0x1F, 0x3E, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x03, 0xA9, 0x7B, 0x83, 0x7B, 0xBA, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x17, 0x8B, 0xC8, 0x72, 0x3B, 0x11, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x3B, 0x17, 0xED, 0x4D, 0xBA, 0x77, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xF0, 0x66, 0xB3, 0x57, 0x9E, 0x3E, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x5A, 0xA9, 0xC3, 0xF9, 0xD2, 0x19, 0x5A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x67, 0xE0, 0x03, 0xD1, 0x94, 0x93, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xA3, 0x4A, 0x2A, 0xD0, 0xE7, 0x47, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x0B, 0x71, 0xFA, 0xF8, 0x17, 0x3D, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x62, 0xFC, 0x70, 0x9B, 0x65, 0xA5, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x54, 0x26, 0xC1, 0x7F, 0x62, 0x56, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x46, 0x33, 0xE1, 0x50, 0xA5, 0x72, 0x4B ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xD1, 0xF2, 0xDF, 0x7A, 0x81, 0xE1, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xAF, 0x67, 0x28, 0x79, 0xA4, 0xFA, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x9C, 0x98, 0x9B, 0x6D, 0x5A, 0x94, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xA4, 0xFD, 0xAF, 0x01, 0xFB, 0x03, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xA7, 0xCC, 0x41, 0x30, 0x0E, 0x7A, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xE6, 0x6B, 0x61, 0xEA, 0x74, 0x95, 0x2C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x58, 0x59, 0xCC, 0x80, 0x14, 0x70, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x86, 0x36, 0xAE, 0x9A, 0x66, 0x5A, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x5C, 0x08, 0x22, 0xDD, 0x65, 0xD2, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x15, 0xFD, 0xAE, 0xF5, 0xC5, 0xEF, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x28, 0xA7, 0xFB, 0x91, 0x0B, 0x5D, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x79, 0x60, 0xC5, 0x29, 0x07, 0x06, 0x79 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x5E, 0x47, 0xC5, 0x02, 0xBE, 0xCC, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x1A, 0x6E, 0x88, 0xD2, 0xDB, 0xEC, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x34, 0x3C, 0x6C, 0xC5, 0x3A, 0xD1, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0xB1, 0x3A, 0xFA, 0x4F, 0xCB, 0x66, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x68, 0xFE, 0x71, 0xF2, 0xA0, 0xF5, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x27, 0xD1, 0xFA, 0x29, 0xF4, 0x3C, 0x47 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x12, 0x96, 0xE8, 0x6B, 0xB5, 0xC7, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x5A, 0xD1, 0x3E, 0x4A, 0x14, 0x9F, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x41, 0x15, 0x4B, 0x80, 0x9D, 0xD9, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x48, 0x20, 0x85, 0x96, 0x8C, 0x08, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x87, 0x8B, 0xF2, 0x86, 0x02, 0x10, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x07, 0xBB, 0x0B, 0xD0, 0x4C, 0x84, 0x2F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x9C, 0x57, 0x3E, 0x1F, 0xE9, 0x48, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x39, 0xA3, 0xE7, 0xD2, 0xD9, 0xF7, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x2C, 0xE9, 0xFD, 0xB6, 0x11, 0xD9, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x6E, 0xFA, 0xBC, 0x3A, 0xB8, 0xBE, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x7F, 0x90, 0x15, 0x01, 0x8D, 0x12, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x91, 0xAB, 0x7E, 0xB1, 0x91, 0xC3, 0x0E ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x35, 0x48, 0xE1, 0x7F, 0x0F, 0x04, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x9E, 0xED, 0xC5, 0x67, 0xB3, 0xE2, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x62, 0xFC, 0x13, 0x1A, 0xDC, 0x62, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x69, 0x24, 0x9F, 0xBB, 0x51, 0xBF, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x31, 0xFC, 0xE4, 0x78, 0x5B, 0x91, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xA8, 0xF9, 0xEF, 0x90, 0xAC, 0xC2, 0x25 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0xD0, 0x54, 0x2F, 0xBE, 0x21, 0x94, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x73, 0xE9, 0x86, 0xDC, 0xBE, 0x5B, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x24, 0xB2, 0x37, 0xDA, 0x6A, 0x75, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xE5, 0x33, 0x38, 0x08, 0x4D, 0x55, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x9C, 0xC2, 0xB7, 0x7C, 0x74, 0x5C, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x7C, 0x4A, 0x0A, 0x84, 0x67, 0xC9, 0x40 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xC1, 0xCF, 0x08, 0x96, 0xD8, 0x42, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xAE, 0xF8, 0xB7, 0x05, 0x69, 0x5E, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x87, 0x5F, 0xCF, 0x3D, 0x2F, 0xF3, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x8A, 0xF7, 0x41, 0x61, 0xD9, 0xC6, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xBF, 0xA3, 0x71, 0xA3, 0x4C, 0x8E, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x18, 0x9C, 0xF0, 0x1F, 0x18, 0xC6, 0x40 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x99, 0xE7, 0x87, 0x50, 0x21, 0x95, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x0D, 0xDC, 0xFE, 0x8C, 0xF1, 0x1B, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x20, 0x69, 0x15, 0x43, 0x37, 0xC1, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x73, 0x07, 0x30, 0x92, 0xCE, 0x3C, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x9B, 0x7D, 0x49, 0x43, 0x94, 0x9E, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x9C, 0x27, 0x6B, 0x28, 0x9E, 0x84, 0x6F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x4D, 0xC2, 0x61, 0x76, 0xCB, 0x83, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x1E, 0x1F, 0x8B, 0x7D, 0x84, 0x81, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xAC, 0x22, 0x70, 0x0B, 0xEE, 0xCB, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xE3, 0x61, 0x9C, 0xAF, 0xCC, 0xC1, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x56, 0x1F, 0xA4, 0xB7, 0xDF, 0xEE, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xC1, 0xCE, 0x01, 0x7B, 0x15, 0x78, 0x8B ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x2E, 0x58, 0xFC, 0x12, 0x5F, 0xAF, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xD9, 0x36, 0x4E, 0xF8, 0x8D, 0x43, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0xEC, 0x35, 0x01, 0x6C, 0xD6, 0x12, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xCF, 0xCA, 0x8F, 0x16, 0xEB, 0xF7, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x04, 0x88, 0x51, 0x8F, 0x38, 0x41, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xFA, 0x18, 0x17, 0x30, 0x4D, 0xDA, 0x0D ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xC5, 0x74, 0xE5, 0x02, 0x20, 0x2C, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0xDC, 0xFC, 0xA1, 0xAF, 0x52, 0xB1, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xF3, 0x7D, 0xFC, 0xF0, 0x53, 0x04, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x70, 0xEE, 0xDB, 0xE2, 0x5D, 0xBC, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x2A, 0xA6, 0x46, 0x52, 0x79, 0xEC, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xF7, 0x71, 0xA1, 0x1E, 0xCF, 0x37, 0x25 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x4F, 0x46, 0xD7, 0xAE, 0x96, 0x56, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x56, 0x9D, 0x5E, 0xF2, 0xEE, 0xFF, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x00, 0xE6, 0x01, 0x3E, 0x8F, 0xD0, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0x2A, 0x08, 0x5A, 0xBE, 0x81, 0x88, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xFD, 0xFF, 0x91, 0xF8, 0x40, 0x3B, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x82, 0x3D, 0xBD, 0x54, 0x5B, 0xD0, 0x80 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x59, 0x9A, 0x57, 0x78, 0x36, 0x8A, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x58, 0x05, 0xE9, 0xC9, 0x67, 0x45, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x99, 0x6F, 0x6D, 0x8A, 0x93, 0x03, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0x67, 0x55, 0xF4, 0x38, 0x93, 0x2D, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x0E, 0xF0, 0x78, 0xFE, 0x1E, 0xB2, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xA1, 0x23, 0xEB, 0x17, 0x0A, 0x8E, 0x80 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xB8, 0x12, 0x6A, 0x37, 0x21, 0x28, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x84, 0xEA, 0xAC, 0x9E, 0xDE, 0x08, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0x13, 0xAD, 0x00, 0x0C, 0x30, 0xD5, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x4B, 0x3A, 0x9E, 0xFE, 0x0D, 0xAC, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xB0, 0x12, 0x13, 0x89, 0x76, 0xE8, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x7E, 0xED, 0xFB, 0xF5, 0xCA, 0x7D, 0x4E ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xA0, 0xE4, 0xA3, 0x99, 0x62, 0x86, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x98, 0xC5, 0xDB, 0x40, 0x44, 0x01, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xDD, 0xC3, 0x44, 0x62, 0x4C, 0x90, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x56, 0xB7, 0x38, 0x3E, 0x85, 0xE9, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xE1, 0x22, 0x97, 0x84, 0x3E, 0x9D, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xA2, 0x94, 0x90, 0xBC, 0xFE, 0x2A, 0x1F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x4D, 0x77, 0xD4, 0x80, 0x0D, 0x4A, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x2C, 0xA7, 0x5E, 0xE6, 0x95, 0x68, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xFE, 0x82, 0xD5, 0x4E, 0x7B, 0xF3, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x65, 0x53, 0x86, 0x4F, 0x5E, 0xFF, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x8A, 0x9E, 0x75, 0xC8, 0xEA, 0x89, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x52, 0xD2, 0xD8, 0xCF, 0x7E, 0xFD, 0x8A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x5B, 0xFB, 0x59, 0x8C, 0xAB, 0x0D, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xD0, 0x82, 0xB8, 0x29, 0x7B, 0xE3, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x08, 0x31, 0x1D, 0xF7, 0x15, 0xDA, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x55, 0x39, 0x14, 0x89, 0xA4, 0xEB, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xA2, 0x23, 0x1E, 0x3F, 0xEB, 0xF2, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xF9, 0xE2, 0x62, 0x45, 0xD1, 0xE3, 0x3A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x46, 0x30, 0x8F, 0x3E, 0x00, 0x19, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xF0, 0x1A, 0xAA, 0x3E, 0x28, 0x28, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x3C, 0x46, 0x9F, 0x26, 0xEE, 0x61, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x64, 0xE7, 0x6F, 0x35, 0xC0, 0x12, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x96, 0x3F, 0x47, 0xA5, 0x69, 0x69, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x96, 0x68, 0xC0, 0x6B, 0x60, 0x31, 0x29 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x49, 0xF8, 0x1F, 0xC2, 0x71, 0xD5, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x37, 0x35, 0x4E, 0x73, 0x39, 0xF2, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xF7, 0x36, 0x50, 0xBA, 0x35, 0x1F, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x97, 0xF3, 0xA2, 0x3B, 0x67, 0x98, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x97, 0x6A, 0x08, 0xEF, 0x23, 0xE4, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x9D, 0x26, 0xFE, 0x4A, 0x12, 0x31, 0x6A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0xB4, 0x2B, 0x45, 0x3B, 0x71, 0xEE, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x63, 0xC1, 0x84, 0x8D, 0x55, 0x0A, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xC3, 0xE2, 0x01, 0x08, 0xCF, 0xA7, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x2C, 0xE4, 0xF9, 0xBA, 0xBE, 0xD5, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xDD, 0x5E, 0xF8, 0xF5, 0xB5, 0xCC, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x59, 0x1A, 0xC2, 0x9D, 0x65, 0x69, 0x43 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x95, 0xFC, 0xEF, 0x70, 0x03, 0x25, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x05, 0x53, 0x96, 0xB9, 0xEA, 0x44, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xF3, 0x7A, 0xED, 0x7F, 0x8F, 0xB1, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x19, 0x37, 0xE6, 0xF7, 0xCB, 0xBA, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xDC, 0x96, 0x34, 0x6B, 0x70, 0x1A, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xB3, 0x60, 0x94, 0x5A, 0x3A, 0xDA, 0x1F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xE3, 0x48, 0x20, 0x52, 0x68, 0x09, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x65, 0x32, 0xB8, 0x23, 0x91, 0x7B, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xF3, 0x52, 0xEB, 0x68, 0xFF, 0x1A, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x95, 0x4B, 0xCC, 0xC5, 0xA0, 0x26, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xA0, 0x3B, 0x86, 0xE8, 0x13, 0xE1, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x13, 0x60, 0x2F, 0x7D, 0x50, 0x34, 0x03 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x71, 0x9B, 0x78, 0x07, 0x1C, 0xCB, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0xE3, 0x3D, 0x17, 0xDC, 0x87, 0x49, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x05, 0xBD, 0x8F, 0x56, 0xB4, 0x37, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x67, 0x0D, 0xD0, 0xC8, 0xC4, 0xDA, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xF3, 0x3D, 0x80, 0x78, 0x9C, 0x04, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x65, 0x4E, 0x90, 0x18, 0x74, 0xA0, 0x64 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xCD, 0x39, 0xDF, 0xD3, 0x61, 0x62, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x78, 0x1E, 0xAC, 0x48, 0x7C, 0x13, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x20, 0x2B, 0x51, 0xB0, 0x8A, 0xEA, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0xBC, 0x40, 0x0F, 0x77, 0xF5, 0x8A, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xA8, 0xE4, 0x60, 0x0B, 0xA4, 0x02, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x42, 0x7D, 0x95, 0xDD, 0x43, 0xDF, 0x52 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0xD1, 0x0A, 0x4D, 0xEB, 0xAC, 0x3B, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x29, 0xFF, 0xC1, 0x16, 0x66, 0xCD, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x8C, 0x7B, 0x94, 0xAD, 0x52, 0xB9, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xB0, 0x4E, 0x9E, 0xBA, 0xFA, 0xA8, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xCD, 0x98, 0x50, 0xD3, 0x8B, 0xF6, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x52, 0x1F, 0x3F, 0x98, 0x4C, 0x83, 0x13 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x83, 0xA5, 0x7E, 0x85, 0xC3, 0xA9, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xE1, 0x58, 0xC5, 0x2E, 0xD6, 0x3C, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x8B, 0x92, 0xC5, 0xBE, 0xB0, 0x2D, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x13, 0x47, 0x6B, 0x97, 0xBD, 0x79, 0x03, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xF9, 0x29, 0x0B, 0xD3, 0x21, 0x01, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x2B, 0xEC, 0x7C, 0x7D, 0x88, 0x8F, 0x58 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x6F, 0xC3, 0xC1, 0xE4, 0x9D, 0x54, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x37, 0x10, 0xA3, 0xD6, 0xA2, 0xCC, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xDA, 0x9C, 0x58, 0xE7, 0xC0, 0x0A, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x68, 0xA6, 0xC6, 0x62, 0x31, 0xBD, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xD7, 0xFF, 0xFA, 0x56, 0xD2, 0xC1, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x68, 0x40, 0xBF, 0x58, 0x72, 0x2D, 0x87 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xAB, 0xD5, 0x6B, 0x9D, 0x39, 0xBA, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xEB, 0xA2, 0x01, 0x3E, 0x09, 0x43, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xD3, 0x7A, 0x84, 0x54, 0xAE, 0x21, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x76, 0x93, 0x9B, 0x1E, 0x2C, 0x02, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x12, 0xC2, 0x2A, 0x65, 0x60, 0xEF, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0xA6, 0x13, 0xCB, 0xAF, 0xB5, 0x32, 0x51 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x8A, 0xE3, 0x3B, 0x64, 0xF8, 0x2F, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xF0, 0xD1, 0x72, 0xA1, 0x70, 0xE7, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x0F, 0x5B, 0x1E, 0x10, 0x33, 0x28, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xFC, 0x3E, 0xCF, 0x3C, 0x92, 0x68, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xDB, 0x9D, 0x15, 0xEE, 0x8B, 0x77, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x2E, 0x66, 0x06, 0x53, 0x03, 0x9B, 0x56 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x20, 0x7B, 0x92, 0x74, 0x59, 0xEF, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xED, 0x78, 0x17, 0x50, 0x97, 0x88, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x04, 0x30, 0xDE, 0x62, 0xB0, 0x70, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xBC, 0x18, 0x24, 0xDB, 0x5E, 0x5B, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xAD, 0x32, 0x91, 0x28, 0x8B, 0x79, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x60, 0xD2, 0x0A, 0xD0, 0x60, 0xB3, 0x88 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xF8, 0x7F, 0xE8, 0xC4, 0xCA, 0xAC, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xE2, 0x2C, 0x30, 0x8F, 0xD4, 0xD3, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x4F, 0x66, 0x23, 0xF0, 0x9E, 0xCD, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xA9, 0xA9, 0x34, 0xBB, 0xF2, 0xC5, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x12, 0x24, 0x09, 0xC7, 0xA2, 0x96, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x08, 0xA3, 0xD9, 0x60, 0x3F, 0x0E, 0x70 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x38, 0x32, 0x91, 0x2A, 0xDF, 0xC6, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x70, 0x6D, 0xF8, 0x24, 0x07, 0xEF, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xD9, 0xD2, 0x61, 0xB0, 0x53, 0xAE, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x53, 0x20, 0x53, 0x4E, 0xD7, 0xD8, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x32, 0x31, 0xF4, 0xCB, 0xF9, 0xD5, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x93, 0x63, 0xCB, 0x9B, 0x1D, 0xF4, 0x6A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x8A, 0xE0, 0x25, 0x7D, 0xEF, 0xE0, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x12, 0x18, 0x3E, 0xA9, 0x77, 0x48, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x45, 0x13, 0xC1, 0x31, 0xAD, 0xCF, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0x68, 0x34, 0x49, 0xFC, 0x23, 0x07, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xE5, 0xBD, 0xC9, 0xE1, 0x1E, 0x3A, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xDF, 0x9A, 0x86, 0x6C, 0x34, 0xC8, 0x14 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x5B, 0x1D, 0xBC, 0xD4, 0x3F, 0x61, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x05, 0xED, 0xE2, 0x32, 0x68, 0x77, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x64, 0x37, 0xD8, 0x20, 0x9F, 0xFD, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0xDB, 0x91, 0xEE, 0x47, 0xFA, 0x94, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x1A, 0x2C, 0xB5, 0x64, 0xEB, 0xC9, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x68, 0xD4, 0x6B, 0x4C, 0xC3, 0xD6, 0x0A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x5A, 0x90, 0x5B, 0x8C, 0x5E, 0x1E, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x93, 0x73, 0x98, 0x84, 0x9D, 0xFD, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xF4, 0xC0, 0x2E, 0x58, 0x0D, 0xCB, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x22, 0xD3, 0x3F, 0x00, 0x0B, 0xCA, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xCD, 0x29, 0x95, 0x4A, 0xEB, 0xB7, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x51, 0xFA, 0xF7, 0x32, 0xBC, 0xB1, 0x5E ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xDA, 0x9F, 0x47, 0x18, 0x14, 0x37, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x33, 0x0C, 0x06, 0x76, 0x6A, 0x7C, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xB5, 0x85, 0x98, 0xC2, 0x18, 0xFC, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x38, 0xBC, 0x88, 0x5B, 0x5E, 0x47, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x09, 0xF0, 0xEA, 0xED, 0x8A, 0xB6, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x04, 0x60, 0x91, 0xDC, 0x16, 0x20, 0x5C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x5C, 0x26, 0xFC, 0xA5, 0x24, 0xD1, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xC6, 0xB8, 0x36, 0x38, 0x8C, 0x20, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xB8, 0xD1, 0x86, 0x74, 0xA0, 0xCE, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x9D, 0x39, 0x61, 0x71, 0xFF, 0x9F, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x59, 0xF9, 0x15, 0x72, 0xFD, 0xE5, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xA3, 0x7F, 0x20, 0x20, 0x64, 0x7E, 0x0C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x78, 0x60, 0x44, 0x9E, 0xD2, 0x62, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x32, 0x1C, 0x0D, 0x38, 0x40, 0x71, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0x7A, 0xDC, 0xA4, 0xED, 0x43, 0x61, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x59, 0x80, 0xDC, 0x10, 0xBC, 0xF5, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xA3, 0x29, 0x97, 0x43, 0x96, 0xF4, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0xE5, 0x71, 0xAB, 0x6E, 0x68, 0xA8, 0x5A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x0E, 0xCF, 0x84, 0x31, 0x25, 0x66, 0x52 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x81, 0x5A, 0x0C, 0xF7, 0xFC, 0x74, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x79, 0x1C, 0xBF, 0x58, 0xDD, 0x63, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xE7, 0x89, 0x30, 0x1D, 0x99, 0x88, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0xB6, 0xF8, 0x9A, 0xD2, 0xD9, 0xBD, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xD1, 0x4A, 0x0F, 0xD3, 0x1F, 0x86, 0x39 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x05, 0x52, 0xCD, 0x3C, 0x35, 0xDC, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x08, 0x13, 0xD7, 0x44, 0x34, 0xE8, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x37, 0x06, 0x61, 0x46, 0x6F, 0x2F, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xB0, 0xC2, 0x54, 0x1F, 0x18, 0x74, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xAE, 0xE9, 0x27, 0x39, 0xC1, 0xC5, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x0B, 0x2F, 0xC4, 0xC8, 0x95, 0x3C, 0x09 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x2F, 0x20, 0x84, 0x77, 0xD6, 0x61, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xFB, 0xE1, 0x4C, 0x7C, 0x99, 0x8C, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x3C, 0x10, 0x65, 0x5F, 0xD7, 0xC5, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x79, 0x15, 0x9E, 0xCF, 0xA6, 0xDF, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x30, 0x6C, 0xD9, 0x60, 0x09, 0xE1, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x53, 0x2C, 0x87, 0x4F, 0xDE, 0xEE, 0x75, 0x82 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x06, 0x8C, 0x30, 0xDC, 0x2B, 0xB1, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x2B, 0x2E, 0x5A, 0x55, 0xC8, 0x48, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x9E, 0xEB, 0x23, 0x58, 0x1F, 0xB4, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x3E, 0x78, 0xF1, 0x23, 0x76, 0x06, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xDE, 0xCA, 0x21, 0x1E, 0xC2, 0xE9, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x2D, 0x7D, 0xEA, 0x45, 0xD2, 0x74, 0x1F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xEE, 0xED, 0x72, 0xF9, 0xFF, 0x9A, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x7B, 0x95, 0x81, 0xFB, 0xD4, 0xD8, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x84, 0x48, 0xDA, 0x04, 0xBF, 0x69, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xD2, 0x20, 0x4E, 0x38, 0x15, 0x10, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xAE, 0x39, 0x57, 0xF2, 0xDB, 0xA8, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x1F, 0xB3, 0xFF, 0xFD, 0xC9, 0x92, 0x53 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xBD, 0xCC, 0x4A, 0xCC, 0x43, 0x0C, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xA7, 0x18, 0xE8, 0x16, 0x11, 0xFE, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x01, 0x41, 0x2B, 0xB3, 0xDB, 0x45, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x44, 0x6B, 0x9E, 0x69, 0x56, 0xE6, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x41, 0x12, 0xEC, 0x06, 0x94, 0x28, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x99, 0x2E, 0xDC, 0xA5, 0x44, 0x5C, 0x2E ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0xF1, 0x67, 0xF2, 0xCD, 0x6C, 0xFA, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x61, 0x50, 0x83, 0x2B, 0x05, 0xCF, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xF5, 0x48, 0xC2, 0xB8, 0x22, 0xE6, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0x8B, 0x73, 0xDA, 0x3C, 0x3D, 0x82, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xF8, 0x5C, 0x62, 0xF1, 0x80, 0xA0, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x51, 0x75, 0x4A, 0xF2, 0x99, 0xAA, 0x25 ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_26_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xEB, 0x21, 0x8D, 0x98, 0x43, 0x74, 0x98 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xCC, 0x14, 0xD8, 0x08, 0xBB, 0xA6, 0xE3 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x98, 0xF2, 0x6A, 0x18, 0xC3, 0xDD, 0x9E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x38, 0x91, 0xA0, 0x03, 0xF2, 0x04, 0x62 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xAF, 0xE8, 0xFD, 0xFB, 0x13, 0x70, 0x74 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x93, 0x87, 0x98, 0x4A, 0xE0, 0x00, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x44, 0x8C, 0xEC, 0x24, 0xFD, 0x92, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xF0, 0x56, 0x76, 0x7A, 0x0F, 0x2D, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x27, 0xBD, 0x8C, 0x82, 0xD4, 0xFF, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xEF, 0x5B, 0xCA, 0x2A, 0xBC, 0x72, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x34, 0x63, 0x88, 0x35, 0x53, 0xA4, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xB2, 0x2A, 0x0E, 0xA4, 0x4F, 0x1E, 0x0E ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_26_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x2E, 0x69, 0x9C, 0xA2, 0x2D, 0x03, 0x3F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0xFE, 0xF3, 0xB9, 0xC1, 0x85, 0x2A, 0xEE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0xFD, 0x86, 0xB1, 0xCD, 0xBF, 0x41, 0xB7 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0xD8, 0x9A, 0x21, 0xF3, 0xFE, 0xCB, 0xF1 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0x78, 0x04, 0x60, 0xB7, 0xA9, 0xA2, 0x84 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x1E, 0x66, 0x2A, 0x54, 0x51, 0xBD, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x1F, 0x49, 0xD1, 0x03, 0x3B, 0x84, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x9A, 0x22, 0x7A, 0x17, 0x86, 0x53, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x2E, 0xD0, 0x96, 0xDD, 0x7B, 0x74, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x0E, 0xBB, 0x1F, 0x95, 0xC9, 0xD5, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xA2, 0xB6, 0xCE, 0x9F, 0xCF, 0x01, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x8A, 0x13, 0x52, 0xC4, 0x2C, 0x0D, 0x75 ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_27_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x16, 0x36, 0xEF, 0x61, 0x2D, 0xEE, 0x3B ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x5F, 0x88, 0xA0, 0x13, 0x12, 0xF7, 0x23 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0xC6, 0xAD, 0x4A, 0x4A, 0x07, 0x01, 0x5B ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x74, 0xB1, 0x4F, 0xEB, 0xBD, 0xD5, 0x6B ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xF9, 0x71, 0xA2, 0x06, 0x4F, 0xD7, 0xBC ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x8B, 0x4D, 0x48, 0xE0, 0x98, 0xFB, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x89, 0xB2, 0x30, 0x49, 0xB0, 0x19, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xDA, 0xBB, 0x39, 0x7D, 0x00, 0xE8, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x68, 0xDE, 0xAB, 0x71, 0x1C, 0xBB, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xD7, 0x89, 0xC2, 0xD9, 0x4B, 0x60, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xE7, 0x38, 0xE1, 0x0C, 0x5C, 0x7A, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xDF, 0x9D, 0xAC, 0xC9, 0x4A, 0xEE, 0x24 ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_27_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0xBA, 0x10, 0xA3, 0x0D, 0x52, 0xAC, 0x3A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xD0, 0xE0, 0x36, 0xE6, 0x07, 0x3A, 0x30 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x80, 0xF0, 0xAA, 0x49, 0x22, 0x4B, 0xDD ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xC7, 0xAB, 0x1C, 0x89, 0xCD, 0x24, 0x40 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x2A, 0xFC, 0xB3, 0x6D, 0x45, 0x96, 0x49 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xE4, 0xDB, 0x52, 0x3F, 0xC4, 0xB4, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xBB, 0x9F, 0xAD, 0x7D, 0x59, 0xBF, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xD2, 0xEE, 0x96, 0xDD, 0xCA, 0x9C, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xA2, 0xED, 0x35, 0xDB, 0x3E, 0x65, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x8B, 0x90, 0x56, 0x3B, 0xB5, 0xC3, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x28, 0x2B, 0x87, 0xF9, 0xBB, 0x87, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x37, 0xA0, 0x78, 0xA4, 0xE6, 0x16, 0x8A ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_28_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xCC, 0xC8, 0x7F, 0xBB, 0x6B, 0x87, 0x47 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x21, 0x3C, 0x69, 0x7D, 0x38, 0x57, 0x50 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x4C, 0x18, 0x3C, 0x53, 0xA5, 0x48, 0x6D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xC3, 0x64, 0x45, 0xDB, 0xC4, 0x6D, 0x15 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xCC, 0xD1, 0xBB, 0x17, 0xB8, 0x34, 0x2D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x69, 0x71, 0xFA, 0xA0, 0x28, 0x4A, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xD7, 0x10, 0x6D, 0x70, 0x59, 0xED, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x64, 0x51, 0xF4, 0x07, 0x1F, 0x4F, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xC1, 0x01, 0xAF, 0x05, 0xE2, 0xEE, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x24, 0x62, 0xF1, 0xBB, 0x64, 0x5E, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xF5, 0x6C, 0x8E, 0x6C, 0x3A, 0x11, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xA0, 0x03, 0x2F, 0xDC, 0xB7, 0x28, 0x48 ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_28_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xE8, 0x9E, 0x39, 0xEA, 0x8D, 0x38, 0xDB ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x9C, 0xBB, 0xCD, 0x80, 0x1A, 0xEE, 0xB7 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xA0, 0x45, 0xBF, 0xD9, 0x22, 0x11, 0x32 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x7C, 0x5C, 0xD9, 0xC0, 0x9F, 0x69, 0xF5 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x8A, 0xA6, 0x79, 0x4E, 0x35, 0xB9, 0xD5 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x8B, 0x9A, 0x3E, 0xA1, 0xB8, 0x28, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x4C, 0x9F, 0x90, 0x48, 0x37, 0xD3, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x66, 0x1A, 0x0C, 0xF2, 0xC5, 0xDF, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0xF0, 0x7A, 0xE3, 0x38, 0xE5, 0xD5, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xAD, 0xFB, 0x07, 0x25, 0x6B, 0x2A, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x80, 0xA0, 0x87, 0xC8, 0x11, 0x19, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xC7, 0xD7, 0xCC, 0x91, 0xD8, 0xB0, 0x3F ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_29_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x2F, 0xEF, 0xBB, 0xA9, 0x72, 0x7F, 0xEA ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x34, 0xB7, 0x12, 0xB9, 0xE7, 0xC3, 0x2A ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x1D, 0xD9, 0x42, 0x77, 0x0C, 0x71, 0x6E ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x01, 0x59, 0xA7, 0x56, 0x03, 0x91, 0x8D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x91, 0x99, 0x33, 0x30, 0x3E, 0xEF, 0x13 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0xC9, 0x5A, 0x9A, 0x54, 0x66, 0xF1, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x0F, 0xB4, 0xBB, 0x9D, 0x76, 0x91, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x0E, 0xED, 0xEF, 0xA1, 0x61, 0xEE, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xB3, 0x39, 0x80, 0xFF, 0xC5, 0x7C, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x0D, 0x9F, 0xD6, 0x48, 0x16, 0x4B, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x6A, 0xBE, 0x53, 0x46, 0xDB, 0x8E, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x8C, 0xA0, 0xD8, 0x70, 0x5E, 0x89, 0x1A ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_29_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x2C, 0xB7, 0x6E, 0x71, 0x7D, 0x35, 0x30 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x0D, 0xEF, 0xD1, 0x2D, 0x99, 0x63, 0x2F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x31, 0xAF, 0x2D, 0xC9, 0xC6, 0xC2, 0xAE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xC0, 0xDF, 0x80, 0x54, 0xC4, 0xAC, 0xF3 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x6B, 0xA0, 0x84, 0x96, 0xF7, 0x31, 0xC8 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xE2, 0x7C, 0x7A, 0x41, 0x45, 0x75, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xA9, 0x9B, 0x7C, 0x79, 0xF3, 0x6E, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x06, 0xE1, 0x28, 0xD7, 0x52, 0x13, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x85, 0xA3, 0x36, 0xF4, 0x1F, 0xA0, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x00, 0x2A, 0x69, 0x4B, 0x9C, 0x1B, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x3D, 0xB5, 0x56, 0xB0, 0x37, 0x7E, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xF1, 0x8C, 0x69, 0x4B, 0x7C, 0x67, 0x2B ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_30_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xEE, 0x58, 0x31, 0xE8, 0x68, 0xD6, 0x76 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x2E, 0x48, 0xB7, 0x09, 0x9F, 0xD4, 0xCA ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xA9, 0x5C, 0xE7, 0x64, 0x43, 0x5D, 0xC9 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x58, 0x9F, 0x50, 0xAB, 0x68, 0xFF, 0x6D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x88, 0x2D, 0xBA, 0x12, 0xBF, 0x8D, 0x7D ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xDF, 0x6F, 0xB3, 0x75, 0xA4, 0x55, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x76, 0x90, 0x61, 0xC9, 0xF0, 0x46, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x80, 0xF3, 0xCE, 0x4D, 0x9E, 0x0E, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x5E, 0x6D, 0x0C, 0x08, 0x04, 0xF3, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xC1, 0x04, 0x6E, 0x3D, 0x92, 0x37, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x3F, 0x32, 0xF7, 0xB6, 0x73, 0x8C, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x28, 0xFA, 0x17, 0xE7, 0x11, 0xCE, 0x73 ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_30_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x17, 0x92, 0x39, 0xB7, 0x13, 0x37, 0x6F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x43, 0x71, 0xA7, 0xCA, 0x17, 0x1B, 0x32 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xB9, 0xB0, 0x78, 0xEF, 0xA0, 0xDA, 0x83 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x84, 0xF2, 0x0F, 0x85, 0xA2, 0xB6, 0x1F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x65, 0x2E, 0x6E, 0x45, 0xB9, 0x4C, 0x3C ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x6A, 0x8C, 0x2B, 0x77, 0x96, 0x36, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xC0, 0x1B, 0x26, 0x92, 0x12, 0xA2, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x4F, 0x7A, 0x95, 0x7D, 0x60, 0x97, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xFD, 0x53, 0xF8, 0xFF, 0xC4, 0x1D, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x7C, 0x70, 0x34, 0x7A, 0x7F, 0x3D, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xA1, 0x4A, 0xD4, 0x05, 0xF8, 0x40, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x52, 0x69, 0x38, 0x09, 0xA1, 0x25, 0x14 ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_31_X[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x7A, 0x13, 0x4A, 0x97, 0x63, 0x02, 0x10 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x1E, 0x06, 0x03, 0x8F, 0xB9, 0xEE, 0x64 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xEE, 0x8B, 0x89, 0xA9, 0x70, 0xDB, 0xCE ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x7B, 0x81, 0xC9, 0x70, 0x8D, 0x62, 0x32 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xDA, 0x46, 0xF8, 0xF9, 0x3A, 0xBE, 0x55 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x9C, 0x7A, 0x97, 0x62, 0xEB, 0xFA, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xF2, 0x01, 0x84, 0x04, 0x59, 0xF4, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x2E, 0x82, 0x13, 0x34, 0xEA, 0x97, 0x2F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xD7, 0xCB, 0x6E, 0x28, 0x6E, 0x0E, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xAB, 0x9D, 0x17, 0x43, 0x8A, 0xA9, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x95, 0x8F, 0x82, 0xCC, 0xF0, 0x6B, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0xB9, 0xC8, 0x19, 0x43, 0x82, 0xBE, 0x49 ),
 };
 static const mbedtls_mpi_uint brainpoolP384r1_T_31_Y[] = {
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x03, 0x3D, 0x3C, 0x46, 0x27, 0x9E, 0x65 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x08, 0x1C, 0xD5, 0x25, 0xAF, 0xE9, 0x40 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x69, 0xDC, 0x59, 0xF4, 0x8A, 0x7C, 0x1F ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x9A, 0x7A, 0x99, 0x21, 0x0C, 0x4E, 0xE3 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xCE, 0x85, 0x5F, 0xAC, 0xAA, 0x82, 0x10 ),
-    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x57, 0x69, 0x90, 0x76, 0xF3, 0x53, 0x3F ),
-};
-static const mbedtls_ecp_point brainpoolP384r1_T[32] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xE1, 0x27, 0xB8, 0x69, 0xEC, 0x77, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xA3, 0x0B, 0xA1, 0x36, 0x03, 0x20, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xE7, 0xF0, 0x50, 0xE8, 0x61, 0x0E, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xF5, 0x3B, 0x64, 0x41, 0x16, 0x17, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x3C, 0x01, 0x4F, 0xDA, 0x69, 0xEB, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x20, 0x46, 0x1F, 0xF4, 0x5D, 0x1C, 0x39 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_32_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x37, 0x92, 0x03, 0x2E, 0xC9, 0x54, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x3E, 0xE8, 0xCD, 0x76, 0x5A, 0x22, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x51, 0xA0, 0x57, 0x68, 0xBA, 0x7F, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0xAB, 0x94, 0xD9, 0x52, 0x56, 0x55, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xBA, 0xE1, 0x5C, 0x88, 0xBE, 0xC5, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xA4, 0x17, 0x11, 0x2B, 0x39, 0x9C, 0x31 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_32_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xF2, 0xD4, 0xD2, 0xB4, 0xE0, 0x65, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xA5, 0x02, 0x7E, 0xAB, 0x57, 0xFC, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x9A, 0x38, 0x2F, 0xAB, 0xF8, 0x1A, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x11, 0xEE, 0xEC, 0x77, 0xFB, 0x26, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xE4, 0x7D, 0xED, 0xCC, 0x32, 0xB3, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x8B, 0x78, 0xC6, 0x09, 0x15, 0xDC, 0x61 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_33_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0xC4, 0x47, 0xEB, 0xA7, 0xB1, 0x4E, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x54, 0x97, 0xC8, 0x94, 0x88, 0x2C, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x97, 0xA6, 0x02, 0x7E, 0x75, 0x0D, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x95, 0xF7, 0x5A, 0x4C, 0x06, 0xFD, 0xCE, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x09, 0x71, 0xD8, 0xC7, 0x71, 0xAA, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xD3, 0xAD, 0x32, 0x3F, 0x4A, 0x3C, 0x1F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_33_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xDE, 0xD8, 0x15, 0xDF, 0xEB, 0xD8, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x77, 0xD6, 0x6C, 0xCF, 0x6B, 0x67, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x6D, 0xEA, 0xB5, 0x62, 0xC8, 0xA4, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x40, 0x21, 0xDB, 0xA4, 0xCD, 0x11, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xAE, 0xC5, 0x60, 0xC1, 0xEF, 0xF1, 0xA7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xA3, 0x63, 0x2D, 0x16, 0x89, 0x0B, 0x1C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_34_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x34, 0x3F, 0xF5, 0x2A, 0x59, 0xD6, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x2B, 0xFA, 0x1F, 0xAA, 0xBD, 0xC2, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xD9, 0x7D, 0x3A, 0x2E, 0xEF, 0xFA, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x03, 0x41, 0x91, 0x03, 0xDB, 0xCA, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xD1, 0x35, 0x87, 0x0D, 0xB4, 0x61, 0xE0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xE4, 0x41, 0x45, 0xE7, 0x35, 0x22, 0x73 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_34_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x5D, 0x36, 0x90, 0xA1, 0xF9, 0x72, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x57, 0x70, 0xC8, 0x34, 0x7B, 0x05, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xE0, 0xB3, 0x69, 0xD5, 0x4B, 0xC6, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x5B, 0x2A, 0x80, 0x88, 0xE5, 0x22, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x4D, 0xBC, 0xCA, 0x38, 0x16, 0x71, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xB4, 0xDD, 0x98, 0xB0, 0x6B, 0xC3, 0x01 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_35_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0x4B, 0x45, 0x3C, 0x72, 0xE1, 0xD5, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x6A, 0x51, 0xA0, 0xAE, 0x77, 0x75, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x02, 0x32, 0x55, 0x18, 0xB9, 0x34, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x1B, 0xB9, 0x91, 0xA4, 0x69, 0x7B, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xDB, 0xF6, 0x34, 0xD5, 0x7E, 0xA7, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xF5, 0x4F, 0xEA, 0xDB, 0xEA, 0xE5, 0x84 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_35_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x28, 0x6F, 0xC7, 0xFA, 0x0B, 0x1C, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x01, 0xD1, 0xF2, 0xC8, 0x43, 0x6C, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x2B, 0xAD, 0x11, 0x1B, 0x8D, 0x46, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xD6, 0x4C, 0x27, 0xE4, 0x63, 0x6D, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x9B, 0xCD, 0x19, 0x1C, 0x56, 0x91, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x94, 0x32, 0xF6, 0x42, 0x54, 0x6B, 0x8A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_36_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x8D, 0x7F, 0x81, 0xB4, 0x95, 0x51, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x74, 0x9E, 0x1E, 0xE9, 0xC3, 0xED, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xB4, 0x68, 0x9F, 0xFE, 0x8E, 0x89, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xC5, 0x19, 0x24, 0x7B, 0xAD, 0xF1, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x03, 0xB0, 0x88, 0xF9, 0x64, 0xE7, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x69, 0x18, 0x36, 0xBA, 0x8F, 0xB5, 0x21 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_36_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x75, 0xD9, 0x01, 0x7D, 0x85, 0x1B, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x04, 0xC9, 0xCD, 0x2D, 0x72, 0xE2, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xFA, 0x7B, 0xB6, 0xE2, 0x62, 0xB3, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x7A, 0x5A, 0x82, 0x23, 0x40, 0x24, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0xA6, 0x41, 0x28, 0x58, 0x87, 0xD9, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x7D, 0xD2, 0xCD, 0x16, 0x0E, 0x1C, 0x34 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_37_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x2A, 0x35, 0x22, 0x41, 0x49, 0xD6, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x10, 0x6B, 0xC6, 0xD2, 0x57, 0x17, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x4B, 0x70, 0x7C, 0x53, 0x17, 0x1A, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0xC6, 0xB9, 0xE0, 0x9A, 0xD6, 0x9B, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x16, 0x31, 0x41, 0x1A, 0x82, 0x46, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x10, 0xC6, 0xC7, 0xDD, 0x47, 0x3F, 0x06 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_37_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x7D, 0x0B, 0x30, 0xCA, 0xBD, 0x59, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x95, 0xAA, 0x78, 0xFF, 0xDA, 0x1C, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x7C, 0xFF, 0xC0, 0x4B, 0xAD, 0x7F, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x7D, 0x2F, 0xCD, 0x01, 0x3E, 0xD3, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x7C, 0x8D, 0xF2, 0xA3, 0xA4, 0x75, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xA5, 0xA6, 0xEA, 0x9D, 0xBC, 0xED, 0x27 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_38_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x16, 0x23, 0x1E, 0xD3, 0x62, 0x51, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x0F, 0x51, 0x41, 0x77, 0xD4, 0x27, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xEA, 0x1E, 0x46, 0xF9, 0xDA, 0x3C, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x29, 0x8D, 0x40, 0x5E, 0x39, 0x11, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xB8, 0x9E, 0x4E, 0xF2, 0xF6, 0x92, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x05, 0x44, 0x7B, 0xBA, 0xAD, 0xDC, 0x36 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_38_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0xCE, 0x15, 0xB9, 0xF8, 0x12, 0x36, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xF0, 0x83, 0x50, 0x61, 0x1D, 0xD5, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x58, 0x5C, 0xF7, 0x14, 0xB0, 0x4C, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xE3, 0x1E, 0x24, 0x06, 0x4C, 0xE1, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xD3, 0x35, 0x2C, 0xE9, 0x2A, 0x04, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x55, 0x8E, 0x43, 0xD5, 0x71, 0x28, 0x0F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_39_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xD3, 0x8D, 0x7B, 0xDF, 0x8A, 0xFD, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x20, 0x75, 0xBF, 0xB6, 0x6C, 0x94, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xA4, 0x0C, 0x86, 0x45, 0x3B, 0x89, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x94, 0x81, 0x73, 0x77, 0x06, 0xEE, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x37, 0x5C, 0xC3, 0xFF, 0xE4, 0xD2, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xD3, 0x62, 0x0E, 0x2B, 0xBC, 0x1B, 0x0E ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_39_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0xE0, 0x72, 0xF4, 0x30, 0xE3, 0x50, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xA3, 0xD4, 0x61, 0x4C, 0x04, 0x98, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xAB, 0xA7, 0xCB, 0x35, 0x53, 0xDF, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x00, 0x75, 0xEF, 0xC0, 0x5C, 0x54, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x00, 0x89, 0x49, 0xA1, 0x2E, 0x04, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x75, 0xF1, 0xFD, 0x7E, 0x16, 0x81, 0x59 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_40_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xFD, 0x01, 0x2D, 0xBA, 0x05, 0x42, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x3B, 0x3B, 0x88, 0x82, 0x16, 0x51, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x9E, 0x40, 0x81, 0x75, 0xA0, 0x82, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x95, 0xF2, 0xA4, 0x92, 0x61, 0x3E, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x4B, 0x2E, 0xD4, 0x0B, 0xBE, 0xCC, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0x28, 0xD5, 0x37, 0x52, 0x03, 0xA5, 0x86 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_40_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xAB, 0x92, 0x97, 0x27, 0x8F, 0xC7, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x0E, 0x97, 0x43, 0x5E, 0xCB, 0x32, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xD9, 0xD4, 0x6D, 0xCE, 0xA8, 0x08, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x2E, 0x73, 0x5C, 0x20, 0x1B, 0x1B, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x18, 0xC4, 0xBB, 0x59, 0x3F, 0x09, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x3C, 0xA1, 0x30, 0xF2, 0xC6, 0xE0, 0x7D ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_41_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0xF7, 0x07, 0x1B, 0xDB, 0xEF, 0x25, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x8C, 0xA8, 0x3C, 0x1D, 0xA5, 0x03, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xBC, 0x9D, 0x8D, 0xCE, 0x14, 0x34, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xB7, 0x50, 0xFB, 0x91, 0xF5, 0x42, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x10, 0x02, 0x9C, 0x49, 0xD1, 0x00, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xAD, 0x4C, 0xFE, 0xBD, 0x56, 0xEA, 0x55 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_41_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x41, 0xF8, 0xBB, 0x9F, 0x12, 0x60, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x1C, 0xE4, 0x34, 0x65, 0xC1, 0x79, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xD1, 0x44, 0x12, 0xAB, 0xDB, 0x75, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x70, 0x5E, 0xF5, 0x1D, 0xD5, 0xC5, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0xDA, 0xAF, 0xF8, 0x4D, 0xA8, 0x06, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0x35, 0x31, 0xF3, 0xA3, 0xBD, 0xCE, 0x80 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_42_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x48, 0x80, 0x57, 0xF6, 0x33, 0x57, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xF3, 0x1C, 0x1D, 0x7E, 0x5A, 0x79, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x21, 0x9D, 0x63, 0x77, 0x90, 0x90, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x8A, 0x1B, 0x32, 0x0C, 0x6B, 0x03, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x45, 0x11, 0xC3, 0xA4, 0xB1, 0x5C, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x35, 0x02, 0xE2, 0x7C, 0xF1, 0xC9, 0x54 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_42_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xA9, 0x2D, 0x52, 0x26, 0xA1, 0x82, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xE4, 0x1C, 0x58, 0x3E, 0x32, 0x78, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x89, 0xDF, 0xCE, 0xFD, 0xCC, 0xE7, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0xEC, 0x14, 0xA3, 0x2A, 0xBA, 0xEB, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xD5, 0x23, 0x9E, 0x1A, 0x2D, 0xED, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xBC, 0xBE, 0xB8, 0x84, 0x6B, 0xE5, 0x4D ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_43_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x38, 0x92, 0x3F, 0xD4, 0x8A, 0x51, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x78, 0x4F, 0xF2, 0x13, 0x31, 0x03, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x97, 0xFB, 0xDC, 0x3E, 0xEC, 0xE2, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xAF, 0xC3, 0x38, 0x34, 0xF1, 0xD9, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xA6, 0x77, 0x26, 0x4D, 0x3D, 0x51, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xA6, 0x98, 0xA9, 0xCD, 0x13, 0x42, 0x4C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_43_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xBF, 0x9D, 0x98, 0xB7, 0x2C, 0x5A, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x24, 0x90, 0x7A, 0x9C, 0x63, 0xB0, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x7A, 0xC0, 0x6B, 0x24, 0xA9, 0x9F, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x24, 0x8C, 0xDF, 0xFF, 0x27, 0xB7, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x18, 0x96, 0x5C, 0x19, 0x33, 0x37, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x8E, 0x46, 0xE4, 0x3E, 0xFB, 0x29, 0x3E ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_44_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xC1, 0x40, 0xE3, 0x3C, 0xE8, 0x2B, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x58, 0x87, 0x46, 0x13, 0x07, 0xC8, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xE3, 0x62, 0x51, 0xD6, 0xA3, 0xE8, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x30, 0x6E, 0xEA, 0x04, 0x67, 0xB0, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x74, 0x8A, 0x10, 0x23, 0x56, 0xFC, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x4E, 0x54, 0xB3, 0xD9, 0x58, 0x7A, 0x5E ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_44_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x48, 0x09, 0x70, 0x0E, 0xF1, 0x64, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x30, 0x4F, 0xE1, 0x8C, 0x21, 0x9D, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x77, 0x80, 0x31, 0x3C, 0x20, 0x51, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x04, 0x7F, 0x3D, 0x32, 0x97, 0xD7, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xC2, 0xCA, 0x9D, 0xDC, 0xD9, 0xAA, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xC2, 0xF8, 0x50, 0x8A, 0xFF, 0x63, 0x51 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_45_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xD0, 0x46, 0x16, 0x24, 0xF7, 0x35, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x0C, 0x02, 0xE2, 0xBD, 0x91, 0x04, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x7C, 0x8E, 0x87, 0x1F, 0x83, 0x9E, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xA9, 0x7E, 0x27, 0x0B, 0xDF, 0xC3, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xD0, 0x84, 0x21, 0xE6, 0x30, 0x83, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xAC, 0x39, 0xAE, 0xA6, 0x11, 0x58, 0x35 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_45_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x76, 0xFF, 0x19, 0x63, 0x0A, 0xF3, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x3F, 0x70, 0xA4, 0xB8, 0x08, 0x89, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xAD, 0x96, 0x07, 0xCF, 0x69, 0xC3, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x10, 0xD7, 0x9B, 0xD6, 0x50, 0x09, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xB1, 0xAF, 0xEF, 0x10, 0x0C, 0x03, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x27, 0xDB, 0x3F, 0x69, 0x2C, 0x01, 0x5B ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_46_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xA6, 0xBF, 0x44, 0xE0, 0x38, 0x35, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xC3, 0xEF, 0x14, 0x20, 0x94, 0x8C, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x93, 0xC8, 0x2F, 0x48, 0x51, 0xEB, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x32, 0x5C, 0xE3, 0x33, 0x97, 0x52, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x1D, 0x5C, 0x00, 0x26, 0x45, 0x36, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x9C, 0x57, 0xAE, 0xBF, 0x05, 0x7E, 0x6F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_46_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x1E, 0xB6, 0x00, 0x26, 0x75, 0x77, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x34, 0x5B, 0x51, 0x57, 0x5A, 0x6D, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x01, 0xF0, 0xAF, 0x11, 0x02, 0x8F, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x21, 0x54, 0xC8, 0x21, 0xFC, 0xA9, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x91, 0x19, 0xC0, 0xE1, 0xD0, 0x91, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xA3, 0xCD, 0xC4, 0xF6, 0xE4, 0x5B, 0x42 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_47_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x01, 0x2C, 0x61, 0x2A, 0x33, 0x1A, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xE4, 0xC6, 0x0D, 0x1F, 0xB0, 0xB3, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xBA, 0x74, 0x1C, 0x2C, 0xB6, 0xC4, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xDF, 0xC5, 0xFC, 0x7D, 0xFC, 0x88, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x0A, 0x59, 0x46, 0xF2, 0xD9, 0x36, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x45, 0x35, 0xA6, 0x86, 0x66, 0x11, 0x2D ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_47_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xB1, 0xB8, 0x11, 0x3E, 0xD5, 0x86, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xD1, 0x71, 0x30, 0xB9, 0xA5, 0x30, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x70, 0xAB, 0xF7, 0x05, 0xEA, 0x5E, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0xCD, 0x60, 0xEC, 0x68, 0x97, 0x47, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xC5, 0x80, 0x15, 0x97, 0xB7, 0x6C, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x45, 0x7C, 0xDF, 0x31, 0x6B, 0xD2, 0x86 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_48_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x55, 0x79, 0x49, 0xBC, 0xB0, 0x4E, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0xA3, 0xDD, 0x84, 0x98, 0x1A, 0x4E, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x0B, 0x48, 0x98, 0x1A, 0x69, 0x37, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x77, 0x94, 0x13, 0x94, 0x6C, 0x93, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x0D, 0x2B, 0x6E, 0x3F, 0xAF, 0x6D, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0x5E, 0x58, 0x50, 0xB5, 0xC7, 0x86, 0x1F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_48_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xDF, 0xE4, 0x65, 0xDF, 0x7A, 0x21, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x94, 0xE7, 0x43, 0xED, 0xFC, 0x72, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x43, 0xFA, 0xF9, 0x3C, 0x3A, 0x87, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0x68, 0x18, 0xBB, 0x42, 0xBB, 0xE9, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0xC3, 0x13, 0x61, 0x70, 0x76, 0x3B, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xA0, 0x7D, 0x3E, 0x0B, 0x1E, 0xFE, 0x59 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_49_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x9E, 0xB7, 0x9A, 0x97, 0x2E, 0xDD, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xB3, 0x40, 0x7C, 0x38, 0x81, 0xAE, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x03, 0x7F, 0xB4, 0x55, 0xE7, 0x66, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0x2C, 0xA6, 0x4C, 0x75, 0xEB, 0xFC, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x32, 0x14, 0x7C, 0xD1, 0x8D, 0x64, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x74, 0x3D, 0x33, 0x4F, 0xA8, 0x9F, 0x2C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_49_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xF1, 0x11, 0xCB, 0x55, 0x84, 0x0E, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x8F, 0x80, 0x57, 0x8C, 0x8E, 0x3E, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xEE, 0xDA, 0x83, 0x23, 0xCC, 0x7E, 0x71 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x39, 0xB1, 0xE8, 0x55, 0xA4, 0xA7, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x7F, 0x76, 0x97, 0x66, 0x86, 0x97, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xE3, 0xF8, 0xDE, 0xB0, 0x54, 0x87, 0x12 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_50_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x25, 0xDE, 0xC2, 0x1F, 0xCD, 0x8E, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x9E, 0xFF, 0xFC, 0xC2, 0x73, 0x81, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0xC9, 0x04, 0x3F, 0x9E, 0x76, 0x87, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x52, 0x11, 0x13, 0xDB, 0xD0, 0x2D, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x40, 0x18, 0x18, 0x47, 0x6C, 0x48, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x2F, 0x10, 0x60, 0x0C, 0xF7, 0x3D, 0x51 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_50_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x27, 0xBC, 0x66, 0x87, 0x6B, 0x7A, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xB3, 0xB9, 0xFA, 0x0D, 0xC3, 0xE2, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xEE, 0x01, 0x2A, 0xCA, 0x95, 0xAF, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xFA, 0xD8, 0x2B, 0x05, 0x62, 0xC3, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0x75, 0x5C, 0x83, 0xD8, 0x9F, 0x98, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xD0, 0xB5, 0x2E, 0xD0, 0x31, 0xEA, 0x61 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_51_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xD0, 0x36, 0x04, 0x36, 0xB1, 0xCB, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xEE, 0x10, 0x71, 0x6A, 0xA9, 0x06, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x36, 0xCA, 0xB1, 0xB1, 0x0B, 0xD5, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0xFA, 0x16, 0x99, 0x04, 0x06, 0x1C, 0x31 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x4F, 0x11, 0x7E, 0x18, 0x3D, 0xDB, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xF1, 0xF3, 0x45, 0x5B, 0x7A, 0x4A, 0x56 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_51_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x5D, 0xEA, 0x99, 0xB4, 0x42, 0xBE, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x11, 0x41, 0xAB, 0x46, 0x6C, 0x58, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x43, 0x18, 0xA6, 0xB4, 0xDA, 0x16, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0xF7, 0xB6, 0x5B, 0x4A, 0x93, 0xB0, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x30, 0x6B, 0xAA, 0x9C, 0x82, 0xCD, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x1B, 0x85, 0xAE, 0x03, 0x26, 0x2D, 0x2A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_52_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xD5, 0x31, 0x6A, 0xD1, 0xAD, 0xA5, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0x06, 0x44, 0x55, 0xEB, 0xB3, 0x84, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x2A, 0x9D, 0x49, 0x68, 0x4C, 0x92, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x25, 0x23, 0x8A, 0x77, 0x61, 0x57, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xF5, 0x12, 0x28, 0x4A, 0xCC, 0x46, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xE4, 0x15, 0xB1, 0xDB, 0x13, 0x70, 0x6C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_52_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xEA, 0xFC, 0x9F, 0xCA, 0xA9, 0xF9, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x9C, 0xC7, 0x8F, 0x64, 0x31, 0xED, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x9F, 0xBA, 0x6A, 0xDA, 0xF4, 0x99, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xC9, 0xBD, 0x69, 0x5A, 0x1E, 0xA6, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x12, 0x9E, 0xA3, 0x6C, 0x07, 0x13, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xF8, 0xE9, 0xF6, 0x88, 0xED, 0xBF, 0x27 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_53_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x12, 0x71, 0x8F, 0xA0, 0x01, 0x05, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x2D, 0xEF, 0xF6, 0xC2, 0xF6, 0x45, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x73, 0x9E, 0x2A, 0xA3, 0x33, 0xFF, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xD7, 0xC3, 0xA1, 0x44, 0x07, 0x0B, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xC8, 0x25, 0xB3, 0x92, 0x2B, 0x73, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x58, 0xDD, 0x3A, 0x76, 0xA1, 0xF5, 0x24 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_53_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xAB, 0x69, 0x41, 0xC6, 0x24, 0x5B, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x2B, 0xD7, 0x92, 0x38, 0xED, 0x00, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x60, 0xBA, 0x3E, 0x06, 0x47, 0xFA, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x58, 0xB8, 0xE3, 0xC9, 0x7A, 0xB8, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x4E, 0x37, 0xCB, 0x0F, 0x9C, 0x3B, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0xBB, 0xBC, 0xF7, 0xC1, 0xD6, 0x80, 0x41 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_54_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xD7, 0x4B, 0x8B, 0x69, 0x53, 0xE3, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xF3, 0x90, 0x31, 0xE8, 0x09, 0x72, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xAD, 0x04, 0x54, 0xC7, 0xD4, 0x40, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0xE9, 0x5F, 0x2C, 0x0A, 0x49, 0x26, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xD7, 0x7F, 0x32, 0x68, 0x1F, 0x20, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x62, 0xC3, 0x18, 0xDE, 0x5A, 0x17, 0x8C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_54_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xC2, 0x1F, 0x47, 0x84, 0xBF, 0x04, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x41, 0x42, 0x00, 0xEA, 0x83, 0x31, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x40, 0x2C, 0x2E, 0xBA, 0x6C, 0xE1, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xD3, 0xC1, 0xBA, 0xDB, 0x1A, 0xE1, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xE2, 0xD0, 0x41, 0x25, 0x7F, 0x6C, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x4B, 0xD0, 0x89, 0x67, 0xD6, 0xF9, 0x3D ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_55_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0x91, 0x51, 0x67, 0xDF, 0x33, 0x4B, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xBF, 0xFE, 0x16, 0xC3, 0xEB, 0x6E, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x57, 0x12, 0x2A, 0xC7, 0x19, 0x75, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x03, 0xD6, 0x9D, 0x2A, 0x21, 0x9A, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x89, 0xC2, 0x99, 0xE9, 0xE2, 0xBC, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x04, 0xC9, 0x69, 0x6A, 0x8E, 0x54, 0x32 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_55_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x59, 0x23, 0x9E, 0x22, 0x5A, 0xDD, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xE5, 0x4B, 0xEA, 0x21, 0x4C, 0xA1, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0xED, 0x31, 0x1C, 0x44, 0x32, 0xF3, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xD1, 0x04, 0x20, 0x9C, 0x20, 0x46, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x75, 0x38, 0xAD, 0x0D, 0xF0, 0x9D, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x41, 0xD6, 0x57, 0x7E, 0x97, 0x80, 0x26 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_56_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x74, 0x2C, 0x47, 0x8E, 0xC7, 0xA3, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x3A, 0x80, 0xA3, 0x16, 0x4E, 0x47, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xEA, 0x73, 0xFD, 0x96, 0x98, 0x40, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x2B, 0xF8, 0xB0, 0x2B, 0x5C, 0x3F, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xA4, 0xE9, 0x87, 0x5E, 0xEB, 0xA3, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xB0, 0x42, 0x2D, 0x68, 0x86, 0xEF, 0x0D ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_56_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xD5, 0x4D, 0x69, 0x69, 0x2C, 0xAF, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xB3, 0x8A, 0xF1, 0x8B, 0x70, 0xD3, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x75, 0x30, 0x37, 0x18, 0x5E, 0x8C, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xE6, 0xEE, 0xF7, 0xF5, 0x82, 0xB3, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x59, 0xE3, 0xA5, 0xA9, 0x92, 0x61, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x00, 0x39, 0xA5, 0xE3, 0x1E, 0x6C, 0x35 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_57_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x44, 0x1A, 0xCD, 0xFA, 0x06, 0xA1, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xB8, 0xC2, 0x1C, 0xBF, 0x48, 0x96, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x7B, 0x9D, 0x01, 0xC7, 0x79, 0x47, 0xFA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0xCC, 0x94, 0xAD, 0x83, 0x1A, 0x1B, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x58, 0x6E, 0x0E, 0xF4, 0x34, 0x41, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0x8C, 0x35, 0x16, 0x1F, 0xCB, 0x36, 0x3B ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_57_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x87, 0x0B, 0x7E, 0xEB, 0x9A, 0xFC, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xC2, 0x81, 0xFD, 0x45, 0x44, 0x56, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x44, 0xA6, 0xC0, 0xDA, 0x32, 0xCF, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x92, 0x04, 0x18, 0x21, 0x67, 0x6E, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xAB, 0x20, 0x04, 0xB0, 0x8A, 0x62, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xE5, 0x15, 0x2D, 0x23, 0xFE, 0xC6, 0x6A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_58_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x5E, 0xEB, 0x3F, 0x25, 0xC5, 0x92, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0xA1, 0x00, 0x84, 0xD4, 0xF8, 0x80, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x67, 0x0E, 0xA2, 0x32, 0xF7, 0x72, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xE6, 0x00, 0xBB, 0x40, 0xC9, 0xE4, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xFC, 0x95, 0xC0, 0xBF, 0x0F, 0x3D, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x04, 0x50, 0xA7, 0x25, 0xA4, 0x8D, 0x5E ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_58_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x32, 0x83, 0xD9, 0x91, 0xAC, 0x05, 0x0B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x4F, 0xF7, 0x53, 0x9B, 0xE5, 0x77, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x9E, 0x16, 0xF6, 0xCF, 0x69, 0x5D, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0xCE, 0xC3, 0x20, 0x6F, 0x8D, 0x29, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x3A, 0xDA, 0x63, 0xB0, 0xAD, 0xC8, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x03, 0x01, 0xE7, 0x8D, 0x79, 0x95, 0x4C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_59_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x82, 0xD1, 0x68, 0xB3, 0x35, 0x4B, 0x27 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xD4, 0x6C, 0x6A, 0x42, 0xF3, 0x62, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xD3, 0x28, 0x11, 0xA6, 0x53, 0x08, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xD4, 0xC4, 0xCD, 0x7C, 0xBC, 0x10, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x06, 0xFE, 0x43, 0xA4, 0xB4, 0x84, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x1F, 0xCA, 0xA6, 0x45, 0x56, 0x17, 0x00 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_59_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xF5, 0xC6, 0xF8, 0xB4, 0x74, 0x52, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x1F, 0x44, 0x2E, 0x86, 0x24, 0x53, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x8C, 0x42, 0xD0, 0xC0, 0xED, 0xF1, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x55, 0xD8, 0x18, 0xB7, 0x69, 0x76, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xFC, 0xC9, 0x01, 0xB2, 0x27, 0x46, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xFD, 0x14, 0x4B, 0xCC, 0xCC, 0x51, 0x4F ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_60_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xD5, 0x9D, 0xCA, 0x10, 0x4F, 0xEA, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x32, 0x3F, 0x18, 0x6F, 0x21, 0x71, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xE8, 0x5C, 0x17, 0xE3, 0x7B, 0x9C, 0x6A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0xCB, 0xEE, 0x75, 0xE9, 0xA7, 0x1F, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xD2, 0x12, 0x62, 0x54, 0x94, 0x89, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xB5, 0x41, 0xBC, 0x0F, 0xE8, 0x94, 0x24 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_60_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x6F, 0x8A, 0xE2, 0x7F, 0x94, 0x7E, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x4F, 0x75, 0xFA, 0x69, 0x50, 0xE6, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xE8, 0x24, 0x2C, 0xC3, 0xA9, 0xE1, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x35, 0xCF, 0xFA, 0x77, 0x68, 0xA8, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x42, 0x70, 0xED, 0xE3, 0x1A, 0x97, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xC6, 0x19, 0x50, 0xC8, 0x54, 0xAB, 0x01 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_61_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xDA, 0x40, 0x8C, 0x35, 0x75, 0x3C, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x1B, 0x59, 0x67, 0xBC, 0xAA, 0x67, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xBE, 0xD0, 0x43, 0xBE, 0x2F, 0xB8, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0xDE, 0x7B, 0xE1, 0x76, 0xD6, 0x2E, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x3A, 0x75, 0x3B, 0xFC, 0x12, 0x9B, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xF5, 0x13, 0x4F, 0xE6, 0x24, 0x10, 0x4A ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_61_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x15, 0x41, 0x1C, 0x37, 0x08, 0x9E, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x1F, 0xCE, 0xA5, 0x1B, 0x1E, 0xA7, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x53, 0x17, 0x3A, 0xBB, 0xC8, 0x4F, 0xCB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0x40, 0x2E, 0xB1, 0x20, 0x5F, 0x1D, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x82, 0x69, 0x55, 0x5D, 0x6F, 0xFA, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x3E, 0xD5, 0x74, 0x99, 0xBF, 0xE0, 0x08 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_62_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x1E, 0x92, 0x4E, 0xE5, 0x14, 0x90, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xC6, 0xEB, 0x4F, 0x07, 0xE0, 0x69, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x59, 0xEA, 0x85, 0x3E, 0xB0, 0xB7, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x90, 0xEA, 0x6E, 0xAA, 0x62, 0xDE, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x2B, 0x5A, 0x38, 0x2E, 0x4F, 0x83, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x4F, 0xDC, 0xF6, 0x81, 0xFB, 0x4B, 0x31 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_62_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x26, 0xC3, 0xED, 0x49, 0xE6, 0xCC, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xE7, 0x46, 0xF9, 0xF9, 0xD7, 0xCF, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x8A, 0xCA, 0xDB, 0x12, 0xE5, 0xD0, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xC8, 0x15, 0x50, 0x10, 0x63, 0x53, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xF2, 0x35, 0x95, 0x7D, 0xF1, 0x2E, 0x7F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x36, 0x2F, 0xB4, 0x1F, 0x9B, 0x58, 0x25 ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_63_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0xEC, 0xFB, 0x67, 0xEF, 0x0F, 0xFE, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xDD, 0xA0, 0x01, 0x34, 0xC6, 0x32, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x83, 0x97, 0x47, 0xB6, 0x7B, 0x80, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x46, 0x86, 0xE2, 0x88, 0xBF, 0xC6, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x0E, 0xF0, 0xF0, 0xB2, 0x52, 0xAB, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0xAE, 0x9A, 0x82, 0x44, 0x3E, 0xE5, 0x5C ),
+};
+static const mbedtls_mpi_uint brainpoolP384r1_T_63_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x2B, 0xE8, 0xCB, 0x18, 0x51, 0x59, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xBD, 0x92, 0x25, 0xAA, 0xAF, 0x34, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xB6, 0x1B, 0x14, 0x02, 0xF6, 0xC8, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x3F, 0xC2, 0xB9, 0x6F, 0x00, 0xBA, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x43, 0x9B, 0xB9, 0xCF, 0x23, 0xD4, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x56, 0xA2, 0x70, 0x99, 0xFA, 0xBC, 0x5C ),
+};
+static const mbedtls_ecp_point brainpoolP384r1_T[64] = {
     ECP_POINT_INIT_XY_Z1(brainpoolP384r1_T_0_X, brainpoolP384r1_T_0_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_1_X, brainpoolP384r1_T_1_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_2_X, brainpoolP384r1_T_2_Y),
@@ -3755,6 +10195,38 @@ static const mbedtls_ecp_point brainpoolP384r1_T[32] = {
     ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_29_X, brainpoolP384r1_T_29_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_30_X, brainpoolP384r1_T_30_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_31_X, brainpoolP384r1_T_31_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_32_X, brainpoolP384r1_T_32_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_33_X, brainpoolP384r1_T_33_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_34_X, brainpoolP384r1_T_34_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_35_X, brainpoolP384r1_T_35_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_36_X, brainpoolP384r1_T_36_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_37_X, brainpoolP384r1_T_37_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_38_X, brainpoolP384r1_T_38_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_39_X, brainpoolP384r1_T_39_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_40_X, brainpoolP384r1_T_40_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_41_X, brainpoolP384r1_T_41_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_42_X, brainpoolP384r1_T_42_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_43_X, brainpoolP384r1_T_43_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_44_X, brainpoolP384r1_T_44_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_45_X, brainpoolP384r1_T_45_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_46_X, brainpoolP384r1_T_46_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_47_X, brainpoolP384r1_T_47_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_48_X, brainpoolP384r1_T_48_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_49_X, brainpoolP384r1_T_49_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_50_X, brainpoolP384r1_T_50_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_51_X, brainpoolP384r1_T_51_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_52_X, brainpoolP384r1_T_52_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_53_X, brainpoolP384r1_T_53_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_54_X, brainpoolP384r1_T_54_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_55_X, brainpoolP384r1_T_55_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_56_X, brainpoolP384r1_T_56_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_57_X, brainpoolP384r1_T_57_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_58_X, brainpoolP384r1_T_58_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_59_X, brainpoolP384r1_T_59_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_60_X, brainpoolP384r1_T_60_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_61_X, brainpoolP384r1_T_61_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_62_X, brainpoolP384r1_T_62_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP384r1_T_63_X, brainpoolP384r1_T_63_Y),
 };
 #else
 #define brainpoolP384r1_T NULL
@@ -3827,7 +10299,8 @@ static const mbedtls_mpi_uint brainpoolP512r1_n[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xC4, 0xE9, 0xDB, 0xB8, 0x9D, 0xDD, 0xAA ),
 };
 
-#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \
+    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)
 static const mbedtls_mpi_uint brainpoolP512r1_T_0_X[] = {
     MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xF8, 0xB9, 0xBC, 0x09, 0x22, 0x35, 0x8B ),
     MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x5E, 0x6A, 0x40, 0x47, 0x50, 0x6D, 0x7C ),
@@ -4502,6 +10975,1353 @@ static const mbedtls_ecp_point brainpoolP512r1_T[32] = {
     ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_30_X, brainpoolP512r1_T_30_Y),
     ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_31_X, brainpoolP512r1_T_31_Y),
 };
+#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint brainpoolP512r1_T_0_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xF8, 0xB9, 0xBC, 0x09, 0x22, 0x35, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x5E, 0x6A, 0x40, 0x47, 0x50, 0x6D, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x7D, 0xB9, 0x93, 0x7B, 0x68, 0xD1, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xD4, 0xD0, 0xE2, 0x78, 0x1F, 0x3B, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x09, 0xD0, 0xF4, 0xEE, 0x62, 0x3B, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC1, 0x16, 0xD9, 0xB5, 0x70, 0x9F, 0xED, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x6A, 0x4C, 0x9C, 0x2E, 0x32, 0x21, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xD9, 0x2E, 0xD8, 0xBD, 0xE4, 0xAE, 0x81 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_0_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x08, 0xD8, 0x3A, 0x0F, 0x1E, 0xCD, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x54, 0xF0, 0xA8, 0x2F, 0x2B, 0xCA, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x63, 0x27, 0x8A, 0xD8, 0x4B, 0xCA, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x48, 0x5F, 0x4A, 0x49, 0xDE, 0xDC, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x81, 0x1F, 0x88, 0x5B, 0xC5, 0x00, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x7B, 0xA5, 0x24, 0x00, 0xF7, 0x09, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x22, 0x78, 0xCF, 0xA9, 0xBF, 0xEA, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x32, 0x63, 0x56, 0x5D, 0x38, 0xDE, 0x7D ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_1_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x86, 0x6F, 0x2D, 0x3F, 0x2D, 0x72, 0x17 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x34, 0xB9, 0xF8, 0x58, 0x82, 0x2F, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0x8B, 0x33, 0xEF, 0xCA, 0x9B, 0x49, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0xDF, 0x90, 0x4F, 0xE6, 0xA3, 0xA0, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xE0, 0xFE, 0x4E, 0xD1, 0x9B, 0x6D, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x35, 0xDC, 0xE1, 0xE2, 0x7B, 0x4A, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x98, 0x3C, 0x8D, 0x4A, 0x48, 0x2C, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0x00, 0x5D, 0x10, 0xDC, 0xCC, 0x7D, 0x22 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_1_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x9D, 0x34, 0x48, 0x4E, 0xCE, 0x58, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xD7, 0xB2, 0x85, 0x64, 0x06, 0x47, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x48, 0xCB, 0xDB, 0x57, 0x77, 0x11, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xE1, 0x52, 0x4F, 0x21, 0x6C, 0xF9, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xCE, 0x23, 0xB9, 0x31, 0x38, 0x19, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0x35, 0x02, 0x9B, 0x06, 0xC2, 0xFF, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x56, 0xB0, 0xA2, 0x81, 0x2D, 0x90, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0xE5, 0x10, 0xF5, 0x3C, 0x4A, 0x1B, 0x3B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_2_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x5C, 0xC8, 0xEC, 0xC5, 0xD6, 0xFF, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x95, 0xCD, 0x63, 0x67, 0xB8, 0xA0, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x7A, 0x67, 0xD1, 0x8C, 0x00, 0x11, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x71, 0x94, 0x00, 0xE1, 0xAD, 0x7E, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x0A, 0x8C, 0xDF, 0x30, 0x78, 0xA7, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x99, 0x54, 0xF3, 0x98, 0x87, 0x1A, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x56, 0x5A, 0xD8, 0x81, 0xB5, 0x06, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xD7, 0x8E, 0xC4, 0x0D, 0x92, 0xB2, 0x72 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_2_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x10, 0x89, 0x8C, 0x8B, 0x46, 0xBE, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xBC, 0xD4, 0xE0, 0x87, 0x08, 0x6E, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x92, 0x25, 0x93, 0xFE, 0x64, 0x4C, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xE9, 0x04, 0x4B, 0xAB, 0x1F, 0xED, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x49, 0xD4, 0x3B, 0x4D, 0xE8, 0x2A, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xBA, 0x87, 0x9E, 0xFD, 0xCF, 0x3F, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xCA, 0x00, 0x05, 0x2C, 0xE6, 0xA5, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xBD, 0x5A, 0x8B, 0xE4, 0xA3, 0xF0, 0x48 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_3_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x5A, 0x7C, 0x54, 0xE7, 0x98, 0xDD, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x60, 0x97, 0x8C, 0xEF, 0xD8, 0x26, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB5, 0xA6, 0x63, 0x83, 0x9D, 0x6D, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x15, 0xBC, 0xFF, 0x18, 0x0F, 0x52, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x3F, 0xB8, 0x8E, 0xDC, 0x99, 0xDE, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x3A, 0xB8, 0x2A, 0xB2, 0xB0, 0x51, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x38, 0x1B, 0x98, 0x1A, 0x1C, 0xF2, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x98, 0xD3, 0x91, 0xCB, 0x38, 0x33, 0x01 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_3_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xE8, 0xDA, 0x3C, 0x7B, 0xB3, 0xA6, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x18, 0x7F, 0x75, 0x2A, 0x46, 0xDA, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x66, 0x57, 0x51, 0x20, 0xF4, 0xD8, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x32, 0x65, 0x8D, 0x12, 0x08, 0x7F, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0xC8, 0xFF, 0x4C, 0x3E, 0x70, 0x92, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xEB, 0x9F, 0x42, 0x5E, 0x6F, 0x12, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x59, 0x1B, 0x48, 0xEB, 0x14, 0x8F, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x1B, 0xF1, 0x0C, 0xF5, 0x5F, 0x52, 0x9F ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_4_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x61, 0x4D, 0x9A, 0x71, 0xA6, 0x20, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0x33, 0x33, 0x41, 0x71, 0x74, 0x5A, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x23, 0x08, 0xE1, 0x88, 0x00, 0xDF, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x6B, 0xEA, 0x19, 0xC5, 0x57, 0x1A, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x85, 0x82, 0xEB, 0x5F, 0x09, 0x6F, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xB8, 0x39, 0xAD, 0x54, 0x08, 0xF7, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xE5, 0x29, 0x2A, 0x01, 0x30, 0x95, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xAD, 0x22, 0x87, 0xD5, 0xA8, 0x5D, 0x92 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_4_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x78, 0x3B, 0x03, 0x9B, 0x02, 0xA5, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x8E, 0x9E, 0x88, 0xE0, 0xA3, 0x9A, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x5A, 0x9F, 0x1E, 0xD3, 0x59, 0xBB, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xBF, 0x85, 0xF0, 0xA9, 0xEC, 0x0B, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x34, 0xBB, 0x6F, 0xBD, 0xBA, 0x7E, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xFA, 0x2B, 0x96, 0x1B, 0x6B, 0x33, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE4, 0xC4, 0xE1, 0xA7, 0x03, 0xDE, 0xF4, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0x2D, 0xC4, 0x55, 0x48, 0x3B, 0xF2, 0x6E ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_5_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0xF0, 0x9F, 0xA2, 0x9B, 0x59, 0xF6, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x96, 0x4A, 0xF4, 0xFF, 0x6A, 0x73, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x9D, 0xA1, 0x01, 0x30, 0xA1, 0xB5, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x40, 0x8E, 0x25, 0xC4, 0x80, 0x01, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xA7, 0xC5, 0x0E, 0x0B, 0xE5, 0xB6, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0xD9, 0x52, 0x09, 0x7D, 0x12, 0xB3, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xB3, 0xBF, 0x68, 0x97, 0xF2, 0xF8, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x9C, 0xAA, 0x18, 0x3B, 0xD0, 0x06, 0x7B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_5_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x82, 0xCF, 0x1F, 0x01, 0x31, 0xE5, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x2B, 0x9A, 0x0E, 0x65, 0xEF, 0x21, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x19, 0xFA, 0x01, 0xF5, 0xEA, 0xF8, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x77, 0x97, 0x2E, 0x92, 0xD8, 0xA1, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x9C, 0xAF, 0x3A, 0x26, 0x7E, 0x34, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xEF, 0x23, 0xD6, 0xF8, 0x0A, 0xF5, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x28, 0x89, 0xC7, 0x85, 0x2E, 0xCB, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xE1, 0x9B, 0x44, 0x78, 0xB5, 0xDC, 0x22 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_6_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x81, 0xA3, 0x95, 0x1B, 0xBC, 0x01, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0xB4, 0x3F, 0x6C, 0xCB, 0x5B, 0xE8, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0xB6, 0x96, 0xF5, 0xB5, 0xFA, 0xBB, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x17, 0xE1, 0x97, 0xBF, 0x76, 0xB8, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x49, 0x40, 0x18, 0xEA, 0x48, 0x71, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x02, 0xE7, 0x41, 0x56, 0x0C, 0x7E, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x25, 0x39, 0x83, 0x83, 0x5C, 0x02, 0x93, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x05, 0xAF, 0xE9, 0x96, 0xE3, 0x6C, 0x12 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_6_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x04, 0x42, 0xAB, 0xF4, 0x99, 0xD2, 0x3B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0xA6, 0x0D, 0x71, 0x9E, 0xAE, 0x33, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x7C, 0x1C, 0xBE, 0x45, 0xBF, 0xEE, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x57, 0x33, 0x23, 0xED, 0xCB, 0x3B, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xBD, 0xA9, 0xBB, 0x70, 0x9D, 0x0E, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xD1, 0x23, 0xF7, 0xA8, 0x2B, 0x9E, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x95, 0x51, 0x5A, 0xD3, 0x93, 0xD7, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xF3, 0xEF, 0x06, 0xEB, 0x61, 0x17, 0x9A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_7_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xDF, 0x9C, 0xFC, 0x96, 0x27, 0xCB, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x1E, 0xDF, 0xB9, 0x7D, 0x9C, 0x86, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0xCD, 0xD2, 0x5D, 0x91, 0xE5, 0x28, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x4B, 0x08, 0x14, 0xB2, 0x20, 0xF5, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x65, 0xC0, 0xF2, 0x9D, 0x0B, 0xC2, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x9F, 0x8D, 0x96, 0x84, 0x94, 0x51, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x6F, 0x36, 0x27, 0x91, 0xA7, 0x75, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0xEA, 0x24, 0x14, 0x6F, 0x78, 0xDB, 0x25 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_7_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x0B, 0x39, 0xAC, 0xBA, 0x89, 0x26, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xB8, 0xE3, 0x45, 0xB0, 0x72, 0x61, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0x35, 0xE3, 0xBA, 0xE7, 0xBC, 0xB4, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x72, 0x20, 0xB8, 0xBC, 0x18, 0xEC, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xD5, 0xB1, 0xC2, 0x23, 0x88, 0xF1, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x7D, 0x9A, 0x16, 0xCF, 0xD8, 0xFB, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x5A, 0x1A, 0x9B, 0x3D, 0x09, 0x74, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x0B, 0x37, 0x08, 0xD2, 0xD6, 0xAA, 0x2A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_8_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x38, 0xD5, 0x28, 0xB1, 0xC3, 0x1D, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x2D, 0xB8, 0x31, 0x86, 0x28, 0x13, 0x12 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x50, 0x1E, 0xC9, 0x34, 0x55, 0x15, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xEC, 0xFE, 0x4A, 0x3D, 0x59, 0x4C, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x52, 0x85, 0x0D, 0x4E, 0xE6, 0xE1, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x6E, 0x3C, 0x5D, 0x07, 0x42, 0xE6, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xD2, 0xAB, 0xBA, 0xFE, 0x23, 0x2B, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0x41, 0x7E, 0xEA, 0x02, 0x2A, 0x99, 0x5D ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_8_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x3A, 0x14, 0x0D, 0x54, 0x14, 0x09, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x69, 0xF6, 0xEE, 0x9F, 0xE1, 0x5F, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x7B, 0xC5, 0x44, 0x7C, 0xBF, 0x92, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0xA9, 0x67, 0xAB, 0x79, 0x1C, 0x35, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xB3, 0x93, 0xFA, 0x57, 0x37, 0xF3, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x88, 0x85, 0x47, 0x58, 0xA5, 0xDB, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x05, 0xA6, 0x1A, 0x75, 0x9A, 0x34, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xD2, 0x70, 0x7F, 0x21, 0x5B, 0x04, 0x53 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_9_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x45, 0xA0, 0xD5, 0xBC, 0x28, 0x6A, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x95, 0xF8, 0x9D, 0x7A, 0x90, 0x9A, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xB5, 0xB9, 0x35, 0x3A, 0xFD, 0xDC, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xEC, 0x19, 0x81, 0x8C, 0x54, 0xC1, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x36, 0x31, 0xF1, 0x02, 0x8A, 0x0D, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0xCA, 0x84, 0x2E, 0x2D, 0x97, 0x3C, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x25, 0xE0, 0xCD, 0xB2, 0x15, 0xDC, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x2F, 0x9B, 0xE0, 0x57, 0x57, 0x13, 0x71 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_9_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xF7, 0xE4, 0xBB, 0x6F, 0x54, 0x9B, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xD6, 0x4C, 0xDD, 0x84, 0x5E, 0xCD, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xA9, 0x3D, 0xF4, 0xE8, 0x83, 0x8B, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x4D, 0x76, 0x28, 0x6A, 0x62, 0x8F, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xF9, 0x14, 0x1A, 0xC7, 0x11, 0x0C, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x76, 0xD9, 0x2E, 0x59, 0xD9, 0xB7, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x8C, 0x44, 0x69, 0xE5, 0x0C, 0xE8, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x77, 0x0A, 0x69, 0x6E, 0x0E, 0x3B, 0x00 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_10_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xC7, 0xDF, 0xCE, 0x52, 0xFF, 0xF4, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x5F, 0x40, 0x90, 0x15, 0x5B, 0xD2, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xC8, 0x14, 0xA4, 0x0E, 0x9E, 0x70, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x3D, 0xF3, 0xCC, 0x4E, 0x74, 0xD9, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x11, 0xC6, 0x6B, 0xCC, 0x88, 0x05, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x7B, 0xF7, 0xF7, 0x57, 0x32, 0x66, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x52, 0xBB, 0xD7, 0x52, 0xEF, 0x96, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x45, 0x01, 0x81, 0x0D, 0x35, 0xCD, 0x6D ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_10_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x0B, 0x3C, 0x92, 0x97, 0x7F, 0xD1, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x0B, 0x2B, 0xD5, 0x14, 0xA5, 0x51, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xB7, 0xD8, 0x2A, 0x45, 0x00, 0xD6, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x45, 0xD5, 0x7D, 0xA6, 0x3D, 0x5F, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x20, 0xEA, 0x5C, 0x5D, 0xDF, 0x6F, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x75, 0xD4, 0xB3, 0x89, 0x7A, 0x4D, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x41, 0x92, 0x19, 0xC1, 0xDE, 0x1E, 0xEC, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x33, 0xD4, 0x12, 0x72, 0xF0, 0x19, 0x1F ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_11_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x04, 0xA3, 0x2F, 0xB8, 0x38, 0xA6, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x6E, 0x89, 0x3E, 0x15, 0xDB, 0x00, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0xF2, 0xC3, 0x47, 0xB1, 0x92, 0x2C, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xF5, 0xB0, 0x73, 0x2D, 0xE3, 0x09, 0xD4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0x36, 0x21, 0x19, 0xB1, 0xEE, 0xB0, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xD1, 0xB1, 0x50, 0xE3, 0x7D, 0xE5, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x05, 0x5B, 0x24, 0xC1, 0x63, 0x07, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x00, 0xE6, 0x96, 0x21, 0x52, 0x4A, 0x95 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_11_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x9C, 0xAC, 0x29, 0xD4, 0x31, 0x28, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x7E, 0x19, 0xF9, 0x2B, 0x93, 0x46, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xDC, 0xDC, 0x37, 0xC1, 0xE9, 0xDC, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x96, 0xBB, 0x75, 0x41, 0xAB, 0x2F, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x59, 0x24, 0x2C, 0x1A, 0x09, 0x9B, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x14, 0x4F, 0x50, 0xA0, 0xD4, 0xAE, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x83, 0xAE, 0xF4, 0x2E, 0x83, 0x0B, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0x69, 0xEB, 0xF0, 0xBF, 0x56, 0x66, 0x6F ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_12_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x2A, 0x41, 0x24, 0x98, 0xD0, 0x3F, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x1E, 0x2F, 0x38, 0x6D, 0x69, 0xAA, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xF6, 0xC0, 0x87, 0x95, 0x33, 0xFD, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x37, 0xEB, 0x94, 0x23, 0x02, 0x5A, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0xF5, 0x6B, 0x5C, 0x33, 0xD1, 0x4D, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x75, 0x96, 0xB1, 0x38, 0x71, 0x7C, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x44, 0x37, 0x7C, 0x89, 0x10, 0x5A, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x50, 0xB0, 0x91, 0xF9, 0xA4, 0x0C, 0x2D ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_12_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x77, 0x9B, 0xA9, 0x25, 0x66, 0xD5, 0xE4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x41, 0x90, 0x6C, 0xD5, 0x49, 0xD9, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xB9, 0x29, 0xF6, 0x2D, 0x05, 0xF5, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xE2, 0xC6, 0x95, 0xC7, 0x9D, 0x09, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x3A, 0xBB, 0x24, 0x45, 0x29, 0x1D, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x85, 0x4C, 0x1C, 0x51, 0xDF, 0x50, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x8E, 0xBA, 0xD0, 0x61, 0xF2, 0x86, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x90, 0xB2, 0xB1, 0x3E, 0xCA, 0xF2, 0x3B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_13_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0xDA, 0xDC, 0xD3, 0xE5, 0xDC, 0x2B, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x62, 0x4E, 0xDA, 0xBB, 0x6D, 0x89, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x23, 0x52, 0xB8, 0xA1, 0x01, 0xEC, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x95, 0x82, 0x2B, 0xFD, 0xE2, 0xB1, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0x68, 0x01, 0xC1, 0xB6, 0x9B, 0xDC, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0xAF, 0x46, 0x85, 0x35, 0xCE, 0x5B, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC5, 0x17, 0xC2, 0x62, 0xAD, 0xD9, 0x32, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xB7, 0x39, 0xA7, 0x12, 0x91, 0xD4, 0xA7 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_13_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x58, 0x91, 0x8D, 0x88, 0x7C, 0x96, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0xA5, 0x04, 0x7B, 0xDF, 0xEE, 0xDF, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x12, 0x2A, 0xD8, 0xE2, 0xF4, 0x23, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xEA, 0xA9, 0xC0, 0xC8, 0x64, 0x62, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x54, 0x7E, 0x0B, 0x9E, 0x9B, 0x2B, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x80, 0x46, 0x99, 0xBB, 0x7E, 0xC5, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x37, 0x73, 0x64, 0x9F, 0xB1, 0x2B, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x99, 0xBB, 0x1C, 0xC3, 0xD9, 0xC5, 0x74 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_14_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x6E, 0xBC, 0x61, 0x43, 0x75, 0x0A, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x01, 0x4F, 0xDB, 0xA0, 0x23, 0xBF, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x20, 0x3E, 0x25, 0x2A, 0xE5, 0xBA, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x61, 0xBB, 0x6A, 0xC3, 0xCC, 0x9E, 0x4F, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x8C, 0xB9, 0x89, 0xDD, 0x07, 0x57, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xFF, 0xA1, 0x0C, 0x51, 0x2D, 0xAE, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xB3, 0xB6, 0x56, 0xCB, 0x29, 0x26, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0x62, 0xAA, 0x32, 0x32, 0xEE, 0xE7, 0x2B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_14_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0x8B, 0x00, 0x4B, 0xEA, 0x2B, 0x8A, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0xE9, 0x33, 0x90, 0xA9, 0x58, 0x0E, 0x36 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x7D, 0xF4, 0x73, 0x50, 0x52, 0xE8, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x64, 0x70, 0x55, 0x5C, 0xE0, 0x96, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0xD9, 0x1F, 0xEC, 0x96, 0xC1, 0x95, 0x79 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xC3, 0xCA, 0x96, 0x28, 0x40, 0xA3, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x25, 0x35, 0x36, 0x39, 0x9C, 0xB8, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xDD, 0x65, 0x8B, 0x9B, 0x0A, 0x1A, 0x97 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_15_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x83, 0xF8, 0x47, 0x49, 0x3C, 0xB3, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0x1D, 0x14, 0xC3, 0x37, 0x65, 0x0F, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x68, 0x31, 0x50, 0x3E, 0x02, 0xB2, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x7D, 0x53, 0xBD, 0xC5, 0x05, 0x1A, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x60, 0x4B, 0x3C, 0x51, 0x8D, 0xF6, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xB0, 0x1A, 0x25, 0x47, 0x60, 0xD4, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x84, 0xD3, 0xA2, 0x4F, 0x7A, 0x3D, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x74, 0xEC, 0x0B, 0x8A, 0xAA, 0xA2, 0xA6 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_15_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x12, 0xE3, 0xBD, 0xD1, 0x7D, 0x80, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x5B, 0x10, 0x4E, 0xFF, 0xA3, 0x77, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xC4, 0xBA, 0xD8, 0x66, 0x2A, 0x5B, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x32, 0xEB, 0x6F, 0xB6, 0x01, 0xE6, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x2B, 0xD6, 0xD4, 0x20, 0xE5, 0x1D, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0x19, 0xD6, 0xF3, 0xBF, 0xBE, 0x77, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xD1, 0xA0, 0xE7, 0x8E, 0x8C, 0xA6, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0x6C, 0x60, 0x69, 0x9C, 0xA1, 0xC9, 0x78 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_16_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xFF, 0x8F, 0x2D, 0xEF, 0x1B, 0x10, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xD1, 0x7D, 0x98, 0x93, 0xA5, 0x4D, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xB6, 0x5E, 0x6F, 0x45, 0xA9, 0x70, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x5D, 0xFE, 0xFD, 0x81, 0xCE, 0x92, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x07, 0x9C, 0xFB, 0xE9, 0xA4, 0x91, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xA0, 0xEC, 0x8E, 0x0A, 0x29, 0x49, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x73, 0x97, 0x9F, 0xE8, 0xFE, 0x46, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x97, 0x7A, 0x48, 0xA0, 0x64, 0x38, 0x71 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_16_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x6D, 0x6E, 0x96, 0xC2, 0xB2, 0x72, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x7E, 0xD1, 0x0D, 0x88, 0x2A, 0x8F, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xC9, 0x38, 0xC9, 0x77, 0x5C, 0xD0, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x77, 0x21, 0x72, 0xC0, 0x9D, 0xF5, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x8E, 0x7D, 0x6E, 0xD8, 0xC5, 0x37, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x56, 0x03, 0x2D, 0x8D, 0xAC, 0x32, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x67, 0xDA, 0xFB, 0x76, 0xE7, 0x8D, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x99, 0x5F, 0xEE, 0x0F, 0x32, 0x7A, 0x22 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_17_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x85, 0x81, 0xFE, 0xF9, 0x17, 0x91, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x38, 0x3E, 0xB7, 0xD7, 0xD6, 0xCC, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x05, 0x14, 0x01, 0xC0, 0xD1, 0xF2, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x20, 0x7E, 0xBD, 0xE5, 0x03, 0xDE, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xD3, 0x2E, 0x46, 0x35, 0xBA, 0x6F, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x7A, 0x8A, 0xD8, 0x57, 0xD4, 0x38, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xED, 0xAD, 0xD0, 0x02, 0xA0, 0x8F, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x04, 0x03, 0xD1, 0x16, 0xE2, 0xDE, 0x12 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_17_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x20, 0xCE, 0x43, 0xCB, 0x36, 0xFD, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x7A, 0xC8, 0x7D, 0x1C, 0xA5, 0x36, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0xB9, 0x1A, 0x97, 0xFC, 0x04, 0x38, 0xF7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xB7, 0x35, 0x12, 0xA7, 0xDA, 0x73, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x6C, 0xE8, 0xCB, 0xD3, 0x93, 0x44, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x44, 0x53, 0x75, 0x48, 0xC1, 0xB8, 0xCB, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x37, 0x93, 0xFB, 0x3F, 0xDF, 0x19, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x1E, 0x5E, 0xB1, 0x63, 0xA4, 0x3F, 0x55 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_18_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x88, 0xB9, 0x3A, 0xF8, 0x81, 0x7D, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x83, 0xA1, 0xAA, 0x20, 0xA4, 0x33, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x15, 0x0C, 0xD3, 0xA3, 0x8A, 0x44, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x83, 0xD6, 0x5E, 0x6D, 0x51, 0x3C, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x63, 0x38, 0xDB, 0x56, 0x49, 0x0C, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x1F, 0x4F, 0xC2, 0x0A, 0x69, 0xF2, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xB0, 0x7B, 0x74, 0x75, 0x3D, 0xAD, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x67, 0xB6, 0x44, 0xDA, 0x65, 0x2B, 0x48 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_18_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1A, 0x9E, 0xF7, 0x40, 0xAA, 0xA7, 0x84, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0x3E, 0x4B, 0x37, 0x3B, 0x5E, 0x86, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x8B, 0xB7, 0x4C, 0x02, 0xD8, 0x5D, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x15, 0x3E, 0x74, 0xDE, 0xEE, 0xEE, 0x94, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xEB, 0x58, 0x64, 0xA5, 0x41, 0xF4, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0x89, 0x23, 0x9B, 0x2F, 0x16, 0xBE, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xFB, 0x8C, 0xD0, 0x25, 0xC0, 0x8D, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0xE0, 0x40, 0x27, 0xFC, 0x01, 0xC8, 0x3A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_19_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xA7, 0x9E, 0x7B, 0x3A, 0x43, 0xEE, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xBA, 0x59, 0xBD, 0x84, 0xE3, 0x83, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0xC4, 0xED, 0xF4, 0x97, 0x12, 0xEC, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0x5F, 0xB7, 0xE7, 0xDB, 0x7A, 0x5B, 0xC8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0xEF, 0x18, 0xA0, 0x56, 0xBD, 0x54, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x59, 0x63, 0x41, 0xC8, 0x05, 0xE9, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xBD, 0x0B, 0xEB, 0x96, 0x08, 0x93, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0xCC, 0x21, 0x5B, 0x5E, 0xC0, 0xEC, 0x86 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_19_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xFC, 0x94, 0xAC, 0x80, 0x64, 0x03, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x26, 0xD7, 0xE7, 0xEC, 0x8D, 0xDF, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x80, 0xF1, 0x95, 0xD9, 0x1A, 0x8B, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xD5, 0xB8, 0xA3, 0x2A, 0x76, 0xFB, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xEE, 0x3B, 0xD9, 0xE6, 0x03, 0x85, 0xC2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x8C, 0xEC, 0x96, 0x29, 0xC9, 0xDA, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x21, 0x55, 0xA8, 0xF4, 0xBF, 0x34, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x9C, 0xF2, 0x11, 0x1A, 0x3F, 0x15, 0x77 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_20_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0xCB, 0xF2, 0x61, 0x8E, 0xB9, 0xB9, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC7, 0x5B, 0x79, 0xD2, 0x09, 0xEB, 0x67, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x38, 0x39, 0x53, 0x6D, 0xC8, 0x89, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x72, 0xF5, 0xC7, 0x8C, 0x28, 0x07, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x3D, 0x21, 0x35, 0x90, 0x01, 0x91, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0xC1, 0x32, 0x9F, 0x5C, 0x39, 0x1C, 0x19 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x6C, 0x44, 0x99, 0x9F, 0xF2, 0x69, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xCD, 0xB5, 0x36, 0x80, 0x23, 0xD7, 0x40 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_20_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x87, 0x8A, 0x78, 0xCF, 0x6B, 0x0C, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xDA, 0xFA, 0x76, 0x56, 0x83, 0x25, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x62, 0x6F, 0x52, 0x8B, 0x96, 0x3A, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0xE5, 0x5F, 0x33, 0x9D, 0xEB, 0x19, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x3C, 0x4E, 0xDB, 0xAF, 0x34, 0x6F, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x7D, 0x9E, 0x7B, 0x5C, 0xAE, 0xE9, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x6E, 0xE8, 0xFC, 0x5D, 0x9C, 0x13, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x30, 0xB8, 0xED, 0x18, 0xFF, 0xC5, 0x7D ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_21_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0xB6, 0x01, 0x8D, 0xDA, 0xD3, 0x05, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xA8, 0xBF, 0x40, 0xDF, 0xFF, 0x21, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0x7F, 0x0D, 0x60, 0xDE, 0x87, 0xF7, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xF1, 0x15, 0x00, 0x6C, 0x89, 0x64, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0xBD, 0x7D, 0xCA, 0x3A, 0x9C, 0x65, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0x0D, 0xB6, 0x0E, 0xB9, 0x78, 0xE0, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0xEA, 0x10, 0xC2, 0xB4, 0x92, 0x74, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x7F, 0x42, 0xDB, 0xC4, 0x0C, 0xB2, 0x8A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_21_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0xAD, 0xAB, 0xAF, 0xD8, 0xD2, 0x66, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x3A, 0x93, 0xA7, 0x17, 0x39, 0x52, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0x57, 0x86, 0x28, 0x31, 0xB0, 0x5C, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xA1, 0x5C, 0xA5, 0x2A, 0xFC, 0x1C, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x99, 0x9F, 0x61, 0x63, 0x96, 0xF7, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0x2D, 0x50, 0x56, 0x8C, 0x1A, 0xDB, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xF4, 0xCE, 0xB0, 0x83, 0xCF, 0xBD, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x8D, 0x01, 0x57, 0x82, 0x62, 0xE6, 0x59 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_22_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x45, 0x57, 0x8E, 0xB6, 0x5E, 0xD6, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x8B, 0xA2, 0xBA, 0xD2, 0x48, 0x0A, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x38, 0x9C, 0xCF, 0x83, 0xAA, 0x12, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0xA1, 0x7F, 0xE4, 0x1E, 0x6B, 0xDC, 0xB9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0xD3, 0xE7, 0x97, 0x54, 0x55, 0xB9, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x16, 0x1E, 0x1C, 0x29, 0x8C, 0x9B, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x70, 0x2A, 0x96, 0x75, 0xE1, 0xE0, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x85, 0xD6, 0x96, 0x5D, 0x6C, 0xFE, 0x72 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_22_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0xE3, 0x22, 0x4C, 0xB6, 0x7B, 0xDA, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x2D, 0xB0, 0xD3, 0xA7, 0xAD, 0x43, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x6B, 0x79, 0x0B, 0x50, 0xE3, 0x62, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x40, 0x01, 0xC0, 0x90, 0x98, 0x9E, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xC5, 0xDB, 0x3D, 0x6E, 0xB0, 0xE2, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x70, 0x37, 0xD1, 0x29, 0xD7, 0xA9, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x28, 0x34, 0x5C, 0x6D, 0x9E, 0xDB, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xC0, 0x1F, 0xB6, 0x35, 0x65, 0xB6, 0xA0 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_23_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0xF0, 0x14, 0xC5, 0x75, 0xEE, 0xC8, 0x11 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9D, 0xFE, 0x89, 0xE5, 0x38, 0x4D, 0x36, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x18, 0x9C, 0x10, 0x92, 0x97, 0x4C, 0xE5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5A, 0x62, 0x9B, 0x50, 0xEC, 0x67, 0xAD, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x2B, 0x49, 0x10, 0xF6, 0xDF, 0x39, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x9E, 0x64, 0xC0, 0x2A, 0x3A, 0x33, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xCC, 0x6A, 0x92, 0x83, 0x4F, 0xFE, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x0C, 0xCA, 0x19, 0x43, 0x52, 0x4D, 0x34 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_23_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xAA, 0x01, 0x82, 0xFE, 0xD7, 0x24, 0xAE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0x1E, 0x4F, 0x55, 0x0E, 0x5F, 0xF4, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x7E, 0xF7, 0x27, 0x66, 0x87, 0x84, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x83, 0x8E, 0x61, 0x7E, 0x5A, 0xCD, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x66, 0xE2, 0x6B, 0xD4, 0xAB, 0x1D, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0x55, 0xFF, 0xED, 0x2A, 0xE9, 0x39, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x43, 0x43, 0x70, 0xA5, 0x57, 0x07, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x8C, 0xFC, 0x02, 0x39, 0xA3, 0x7A, 0x7B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_24_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xE5, 0x35, 0x4E, 0x61, 0xDE, 0x25, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xE7, 0xFA, 0x07, 0xA2, 0x00, 0x8C, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x9B, 0x32, 0x6E, 0x03, 0x34, 0xEE, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0xD3, 0xEE, 0x85, 0xDB, 0x34, 0x46, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xB4, 0xB4, 0xCC, 0x35, 0x61, 0x5D, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0xE8, 0x06, 0x28, 0x47, 0xE7, 0xAA, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB7, 0x7D, 0xC7, 0x49, 0x8C, 0x77, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE0, 0xC5, 0xE2, 0xD4, 0x8B, 0x5D, 0x6F, 0x07 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_24_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x97, 0xE1, 0xBA, 0x10, 0x6D, 0x0B, 0x58, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0xB6, 0x1C, 0x49, 0x2D, 0xF6, 0xAB, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x7D, 0xAB, 0xA2, 0x07, 0x84, 0x3C, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x0B, 0x41, 0xC2, 0x28, 0x5E, 0x0E, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x73, 0x84, 0xDE, 0x1F, 0x13, 0x28, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0xFE, 0x45, 0xAF, 0xF9, 0x75, 0x01, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x00, 0x9E, 0x4C, 0x8E, 0xAB, 0x90, 0x37 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xB8, 0xD4, 0xE6, 0x05, 0x6F, 0xBD, 0x6F ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_25_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x0D, 0xF9, 0xCD, 0x7C, 0x90, 0xB7, 0xAB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xA8, 0x6A, 0x07, 0xCC, 0x75, 0xE8, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x00, 0x64, 0x1A, 0xFD, 0xD6, 0xAB, 0xDD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xB0, 0x9A, 0x1E, 0x23, 0x15, 0x01, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0x31, 0x3C, 0x01, 0x3E, 0xC9, 0xD7, 0x08 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x28, 0xA6, 0x05, 0x83, 0xDF, 0x5D, 0x43 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x33, 0xF8, 0x28, 0xCC, 0x1D, 0x6A, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xA6, 0xAE, 0x8B, 0x42, 0xD9, 0x09, 0x27 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_25_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x61, 0xC5, 0xD1, 0x25, 0x3C, 0xD1, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xBE, 0x9F, 0x8F, 0x20, 0xCD, 0x40, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xB8, 0x87, 0x83, 0xCB, 0xDC, 0xDD, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xD4, 0xD5, 0xF2, 0xD5, 0x75, 0x79, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0xD8, 0xF0, 0xDB, 0xD1, 0xC7, 0xFD, 0x68 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x7F, 0xF4, 0x3D, 0xDF, 0xBF, 0x0C, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x08, 0xFD, 0x95, 0x7F, 0x34, 0x1D, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x86, 0x18, 0x74, 0x95, 0x1A, 0x25, 0x49 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_26_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x41, 0x22, 0xE3, 0x1D, 0xFD, 0x49, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x98, 0x13, 0x49, 0xC7, 0x59, 0xC3, 0x21, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xD4, 0x95, 0x92, 0x3C, 0x64, 0x91, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x75, 0xC1, 0xA9, 0x93, 0xB0, 0x28, 0x35 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x56, 0x3C, 0xDA, 0x38, 0x75, 0xA9, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0xBD, 0x3E, 0x5F, 0xEB, 0x4C, 0xA3, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x8C, 0x24, 0x71, 0xB8, 0xDB, 0x94, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x55, 0x16, 0x58, 0xBB, 0xC3, 0xE8, 0x61 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_26_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x55, 0x62, 0x59, 0x1D, 0xEA, 0x5E, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x18, 0x31, 0xC9, 0x0F, 0x30, 0xC5, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x32, 0x54, 0x3B, 0x0E, 0xAA, 0x5C, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0x00, 0xD5, 0x77, 0x3D, 0xD4, 0xAC, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x92, 0x39, 0xA3, 0x99, 0xB8, 0x67, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0x65, 0x50, 0xF5, 0xB2, 0xA7, 0x49, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x3F, 0xBF, 0x49, 0x30, 0x0F, 0x25, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1E, 0x75, 0x63, 0x86, 0xB9, 0x31, 0x3E, 0x5E ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_27_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xFB, 0x17, 0x6C, 0x39, 0xFC, 0x80, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xE3, 0x9D, 0x47, 0x7F, 0x18, 0xD4, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x19, 0xD7, 0x2F, 0xC4, 0xCC, 0x27, 0x93 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x46, 0x0C, 0xA2, 0x90, 0xFD, 0xF8, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x00, 0xC4, 0xD4, 0x2B, 0x03, 0x1A, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0x41, 0x0C, 0x10, 0x64, 0x70, 0xDE, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x92, 0xCF, 0x4B, 0xB3, 0x3D, 0x8A, 0xDC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF9, 0x10, 0xFC, 0xA0, 0x4B, 0x41, 0xEC, 0x43 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_27_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xA0, 0xFC, 0x89, 0xB9, 0x1E, 0x16, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x0F, 0xFF, 0xF1, 0xC9, 0x2C, 0xF1, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0xF7, 0x80, 0xA4, 0x9A, 0x7D, 0x00, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x84, 0x0A, 0x62, 0x42, 0x5B, 0x14, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x74, 0x4D, 0xC3, 0xAF, 0x12, 0xE5, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xF4, 0x6C, 0xF1, 0x23, 0x19, 0x65, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x84, 0xC6, 0x4C, 0xA5, 0x61, 0xB0, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x02, 0xD4, 0xEC, 0xFD, 0xDD, 0xE3, 0x7E, 0xAA ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_28_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x85, 0xDD, 0xFB, 0x9E, 0x63, 0x08, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x6F, 0xEA, 0x0D, 0xC9, 0x13, 0x8D, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xEE, 0x4A, 0xE1, 0x51, 0x03, 0xED, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x73, 0x6A, 0xE1, 0x2A, 0xE6, 0x07, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0x04, 0xDB, 0x88, 0x82, 0x6C, 0xED, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x9D, 0x1D, 0x52, 0xD6, 0x7C, 0xCA, 0x65 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0xA1, 0x50, 0x0C, 0x2B, 0x28, 0xEF, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xE0, 0x68, 0x26, 0xEE, 0x90, 0x48, 0x0F ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_28_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xBD, 0x38, 0xDF, 0x0B, 0xF8, 0xCA, 0x92 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xFF, 0x75, 0x0D, 0x38, 0xAA, 0x69, 0x29 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0x26, 0x62, 0x5E, 0x6C, 0x57, 0xCC, 0x69 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0xA3, 0xD2, 0x1E, 0x7F, 0xC7, 0xED, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x81, 0x48, 0xC0, 0xAB, 0x95, 0xE8, 0x20, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x43, 0xD4, 0x03, 0xCB, 0x6F, 0x76, 0x7F, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x6E, 0xA6, 0x3F, 0x71, 0xC0, 0x4D, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xB9, 0xFB, 0xC5, 0x23, 0x92, 0xC7, 0x6E ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_29_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x13, 0xCC, 0x71, 0xA3, 0xEB, 0x70, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x50, 0xCC, 0x58, 0xAF, 0x1D, 0x6B, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x38, 0x70, 0x39, 0x6D, 0xD9, 0x30, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDC, 0x22, 0xD9, 0x3E, 0x14, 0xF6, 0xCD, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x8F, 0x05, 0xF4, 0x03, 0x41, 0x0E, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x1B, 0xFF, 0x28, 0x2F, 0xCE, 0xC3, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x2E, 0x4B, 0x10, 0xF8, 0x60, 0x20, 0xF4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDB, 0xAB, 0xEF, 0x00, 0x68, 0xAF, 0x83, 0x3C ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_29_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x71, 0x47, 0xF8, 0x9E, 0x35, 0x43, 0x5A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x39, 0x47, 0x11, 0x10, 0x41, 0xE1, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x28, 0xB5, 0x11, 0xD3, 0x6C, 0x94, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xB7, 0x09, 0xD5, 0xBF, 0x3B, 0x76, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xC3, 0xEE, 0xDA, 0x57, 0x73, 0xC5, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xA2, 0x6A, 0xEF, 0x46, 0x98, 0x60, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xF7, 0x8A, 0xC9, 0x8E, 0x17, 0x48, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x87, 0xA2, 0x91, 0x33, 0x20, 0x90, 0x10 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_30_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2E, 0xB9, 0x46, 0xAD, 0xE0, 0xCF, 0x7C, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0x49, 0x47, 0x16, 0x03, 0xDB, 0x60, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xE9, 0xB1, 0xF2, 0x0E, 0xEA, 0xF5, 0x95 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x62, 0x88, 0xFD, 0x13, 0xB6, 0x1A, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0xFC, 0x90, 0xE8, 0xB0, 0x61, 0x3B, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0xF5, 0xF5, 0x24, 0x8E, 0x23, 0xE0, 0xED ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xAE, 0x6B, 0x7E, 0x7F, 0x3D, 0x01, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x3F, 0x18, 0x31, 0xC9, 0xD9, 0xA5, 0x94 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_30_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x6F, 0x3F, 0xE2, 0x9B, 0xFB, 0x45, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x18, 0x20, 0x74, 0xB6, 0x70, 0x45, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x8E, 0x59, 0x45, 0xC4, 0x85, 0x72, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0x98, 0xBA, 0xEA, 0xF9, 0xEE, 0xC0, 0xFC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x2C, 0xCF, 0x10, 0x77, 0x44, 0xD9, 0xA8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x7B, 0x2D, 0x8E, 0xA9, 0xEF, 0x6C, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x91, 0xFC, 0xAB, 0xA2, 0xEB, 0x29, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x19, 0x7B, 0xA4, 0x87, 0x60, 0x15, 0x16 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_31_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x24, 0x19, 0x92, 0x21, 0x1C, 0xB7, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF2, 0x82, 0x04, 0x44, 0xEF, 0x1D, 0x8C, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD6, 0x3D, 0x7C, 0xDD, 0x33, 0xE0, 0xBD, 0xA1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x17, 0x5E, 0x21, 0xF0, 0xBE, 0xDC, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0xC5, 0x3A, 0x5D, 0x3D, 0xDD, 0x45, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0xB0, 0x13, 0x3D, 0x95, 0x9E, 0x2A, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xD2, 0x30, 0xED, 0xEC, 0x72, 0x2E, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x42, 0xE3, 0x0E, 0x9C, 0xFA, 0xCB, 0x2A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_31_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x41, 0x74, 0x11, 0x6B, 0x35, 0xBC, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x90, 0x99, 0x69, 0x5A, 0xB2, 0x1C, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xF1, 0x2D, 0x5C, 0x37, 0xA1, 0xED, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x9E, 0x65, 0x96, 0xEF, 0xF6, 0x1E, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x20, 0x0E, 0x20, 0xD4, 0x7B, 0x8F, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xF0, 0xDB, 0x87, 0x34, 0xD4, 0xDE, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE8, 0x0C, 0x4A, 0xB1, 0x0F, 0x56, 0xC2, 0x02 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0xAB, 0x1B, 0xBF, 0x22, 0xF7, 0x7A, 0x6E ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_32_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xED, 0x7C, 0x82, 0xC2, 0x63, 0x0C, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x5D, 0x0E, 0x87, 0x92, 0x9E, 0x1F, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x6B, 0x21, 0xFE, 0x63, 0x6F, 0x91, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x21, 0xF0, 0x8F, 0x9B, 0x50, 0x48, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x20, 0x31, 0x1D, 0x3F, 0xBC, 0x28, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x43, 0x16, 0x5D, 0x1D, 0x14, 0x05, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x67, 0xBD, 0x67, 0xA4, 0x12, 0xCC, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x72, 0x67, 0x5A, 0x05, 0x0B, 0xC6, 0xC5, 0x36 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_32_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0x0B, 0xD6, 0xDF, 0xD4, 0x59, 0x31, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xCD, 0x55, 0x6F, 0xED, 0x77, 0x28, 0x30 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x31, 0xF6, 0x4A, 0x7C, 0x14, 0xE1, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x42, 0x4F, 0xEE, 0x93, 0xE8, 0x59, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0xFD, 0xF1, 0x58, 0xDC, 0xDF, 0x08, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x86, 0x02, 0xD4, 0x62, 0x9A, 0x79, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x0C, 0xC3, 0x11, 0x4C, 0x32, 0xAF, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0x30, 0x50, 0x84, 0x94, 0xD6, 0x02, 0x2F ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_33_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xA2, 0x50, 0xD0, 0x14, 0x1D, 0xAC, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x92, 0x30, 0xBE, 0x1E, 0x91, 0x4A, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0xD3, 0xD5, 0xCC, 0x06, 0x9C, 0xA3, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0x5C, 0x78, 0x4C, 0xED, 0x4E, 0x59, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x0B, 0x55, 0xE0, 0x34, 0xFF, 0xE9, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6F, 0xA1, 0x17, 0x2B, 0xBB, 0x11, 0xDC, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x5F, 0x51, 0xE6, 0xB4, 0x66, 0xF9, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x58, 0x12, 0x7A, 0xF7, 0xE1, 0x34, 0x2A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_33_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0x1C, 0x08, 0xEB, 0x03, 0x2C, 0x1C, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x6D, 0x99, 0x32, 0x27, 0x9C, 0xB1, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x26, 0x1E, 0x68, 0x3E, 0x0E, 0x9B, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xB4, 0x8E, 0x11, 0x8F, 0x58, 0x8E, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8A, 0x06, 0x1D, 0x1D, 0xE1, 0x22, 0x0B, 0x60 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x57, 0xEC, 0x29, 0x60, 0x63, 0xEF, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0x82, 0x20, 0x3C, 0xBE, 0x1B, 0xAD, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x95, 0xF9, 0xFE, 0x45, 0xDC, 0x1F, 0x29 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_34_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5C, 0x53, 0x51, 0x21, 0x46, 0xB0, 0x6C, 0x75 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3A, 0x7F, 0xF4, 0x35, 0x08, 0x0E, 0x00, 0x9F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCD, 0x12, 0x4A, 0xD8, 0x49, 0x61, 0x05, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xCD, 0x48, 0x5F, 0xA1, 0x07, 0xBB, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE3, 0x6C, 0xB8, 0x19, 0x3A, 0x47, 0x08, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0xF3, 0x35, 0x19, 0x59, 0x7D, 0x51, 0x86 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0xB5, 0x4E, 0x98, 0xA6, 0x31, 0xCB, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x2B, 0xDB, 0x88, 0x31, 0x02, 0xE3, 0x6A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_34_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x9E, 0x5A, 0x17, 0xA1, 0xAF, 0xB0, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD4, 0x4A, 0x77, 0x20, 0x07, 0xBC, 0x8A, 0xA5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0x39, 0x75, 0x18, 0x2E, 0x1F, 0x2A, 0x97 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x07, 0x05, 0x26, 0x34, 0x90, 0x57, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0x5D, 0xDD, 0xEF, 0x71, 0x02, 0x03, 0xF8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x2D, 0xBF, 0x2D, 0x9D, 0xC1, 0x6B, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0x15, 0x53, 0x12, 0xE1, 0xEB, 0xF7, 0x8F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xC0, 0x93, 0x3E, 0x80, 0x9A, 0x0F, 0x04 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_35_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x04, 0xAB, 0x16, 0x8F, 0x39, 0x46, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x01, 0x85, 0xFD, 0x6A, 0xFB, 0x12, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x05, 0xF9, 0x76, 0x17, 0x0B, 0x80, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x49, 0xF1, 0x50, 0xC5, 0x72, 0x28, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x77, 0x7C, 0x34, 0xD7, 0x09, 0xB2, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x9A, 0x92, 0xAC, 0x42, 0x7D, 0xE5, 0xBC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0x69, 0xA6, 0x60, 0x81, 0xB8, 0x89, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xF6, 0x3D, 0xAC, 0xD3, 0x42, 0x23, 0x96 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_35_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x33, 0x0D, 0xA1, 0x99, 0x6F, 0x58, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x34, 0xB3, 0x3B, 0xEC, 0x72, 0x59, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0x12, 0x6F, 0xCC, 0xFE, 0xC2, 0xA3, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x17, 0x65, 0x1D, 0xB4, 0x74, 0xF4, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x23, 0x5D, 0xF0, 0xA1, 0xC1, 0x8B, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0xE2, 0x1F, 0xE8, 0x27, 0x08, 0xEA, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x39, 0x23, 0x95, 0x03, 0x30, 0x9F, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x43, 0x95, 0xC1, 0x7A, 0xBB, 0x1C, 0x4A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_36_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x3E, 0xC1, 0x28, 0x14, 0x12, 0x8B, 0xAD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0xEB, 0x1B, 0x34, 0x98, 0xD2, 0x6A, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFD, 0x69, 0xCD, 0x5F, 0x58, 0xE0, 0x5E, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x39, 0xD1, 0x3A, 0xB8, 0x87, 0xB5, 0xDC, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0xFF, 0x91, 0x71, 0xCA, 0x94, 0x92, 0x6B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x6B, 0x2B, 0xB1, 0xBF, 0x2C, 0xEB, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBA, 0x0D, 0x26, 0x86, 0xD1, 0x41, 0xD3, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF7, 0xEF, 0xE4, 0x5C, 0x06, 0x81, 0xED, 0x9B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_36_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x38, 0x8A, 0x6E, 0xFA, 0x5C, 0x43, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0x44, 0xA8, 0x21, 0x84, 0xDA, 0xC6, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xA1, 0xB4, 0xCC, 0x80, 0xFA, 0x92, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0x79, 0x12, 0x9E, 0xDD, 0x74, 0x3F, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xAF, 0xDE, 0x93, 0x8C, 0xA3, 0xAD, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0xC1, 0xAA, 0xCD, 0x11, 0x8D, 0x11, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x8D, 0x09, 0x7E, 0x21, 0xFF, 0x94, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xC4, 0xB8, 0xA3, 0xE6, 0x56, 0x56, 0x51 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_37_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xCD, 0x9A, 0x99, 0xE2, 0xF1, 0x05, 0xB6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xF9, 0x18, 0xF1, 0x06, 0x41, 0xFC, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xC2, 0x03, 0x99, 0x65, 0xC0, 0x3D, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0x96, 0xA8, 0xB7, 0xAE, 0x43, 0x06, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xD1, 0xF2, 0xDD, 0x41, 0x90, 0xDF, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x43, 0x09, 0x20, 0xB8, 0x6E, 0x65, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x36, 0x24, 0x5D, 0xAC, 0xB0, 0xB7, 0x96 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x96, 0x3E, 0xA6, 0x5A, 0x8E, 0xC3, 0xA2 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_37_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xC9, 0xDB, 0x15, 0x7C, 0x23, 0x0B, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0x46, 0x82, 0x83, 0x4B, 0x00, 0x98, 0x16 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x60, 0x3F, 0xC9, 0xA9, 0x55, 0xB0, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x8E, 0x78, 0x0F, 0xAF, 0x40, 0x39, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x27, 0xE0, 0xBF, 0x4B, 0xFC, 0x45, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0x2F, 0x97, 0xB8, 0x91, 0xC9, 0x66, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xB8, 0x24, 0x30, 0xFB, 0xC6, 0xFE, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF0, 0x90, 0xEC, 0x27, 0xF8, 0xF5, 0x3B, 0x76 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_38_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x37, 0x9A, 0x8D, 0xDE, 0xDC, 0xCB, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA7, 0x5E, 0x67, 0x09, 0xB2, 0xA7, 0x0D, 0x15 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0xCE, 0x09, 0x93, 0xE5, 0x32, 0xCC, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x43, 0x6A, 0xAB, 0xE0, 0x47, 0x57, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6E, 0xAE, 0x85, 0x1C, 0xCB, 0x8A, 0xAC, 0xF5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0xBE, 0xCF, 0xC3, 0x4D, 0xC1, 0xB9, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x10, 0xD9, 0xEB, 0xF1, 0x4C, 0xE7, 0xD4, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x51, 0xCF, 0xD8, 0x8F, 0x71, 0x56, 0x76 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_38_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE2, 0xC2, 0x75, 0xEF, 0xA2, 0xA2, 0x72, 0xCE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0x0E, 0xEE, 0xBF, 0x7C, 0xE9, 0x26, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x19, 0x33, 0xBE, 0x6B, 0x87, 0x7F, 0x4F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x09, 0x63, 0x99, 0x6A, 0x4E, 0xDA, 0xD1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0x34, 0x06, 0x8B, 0xF0, 0x0D, 0x36, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0xDB, 0x94, 0x64, 0x1D, 0x6C, 0x75, 0x6E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xED, 0x89, 0x24, 0x03, 0x0B, 0x54, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x7B, 0xE1, 0x97, 0xB6, 0x7C, 0x62, 0x2A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_39_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x36, 0xE1, 0x2C, 0x79, 0x02, 0xFB, 0x01, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0xE6, 0xAD, 0x9F, 0xA8, 0x63, 0x10, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFF, 0x8C, 0x39, 0xAD, 0x42, 0x5C, 0xA1, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x9D, 0x56, 0x47, 0x1C, 0xA5, 0x10, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x2E, 0x65, 0xCE, 0xF0, 0xEB, 0x10, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xD0, 0xF5, 0x51, 0x05, 0x0A, 0xFD, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0B, 0xA5, 0x34, 0xEE, 0xA7, 0x92, 0x25, 0x5F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAB, 0xB2, 0xC3, 0x8B, 0xB6, 0x50, 0xFE, 0x19 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_39_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0D, 0x37, 0x0E, 0xE1, 0x8C, 0xF0, 0xE1, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x75, 0x24, 0x33, 0x0B, 0xF2, 0x95, 0x5B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xBF, 0x0F, 0xD6, 0x25, 0xFB, 0xC5, 0x2E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xCE, 0xCC, 0x7F, 0xDE, 0x27, 0x49, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0xAA, 0xEE, 0x1F, 0x86, 0x06, 0x9F, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x62, 0x95, 0xF6, 0xA8, 0x82, 0xAA, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x37, 0x32, 0x44, 0x52, 0x68, 0xF9, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0x5A, 0x3E, 0xF8, 0x5D, 0x43, 0xD2, 0x61 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_40_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBF, 0xC4, 0xA7, 0x20, 0x43, 0x2F, 0xC8, 0x42 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x10, 0x34, 0x43, 0x7E, 0x6B, 0x6F, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0xBB, 0x47, 0x65, 0x8B, 0x6C, 0xBE, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x4D, 0x25, 0xFC, 0xD3, 0x47, 0xC5, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0xBF, 0x4B, 0x63, 0xC0, 0x0E, 0xFF, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0xD1, 0x1B, 0xFE, 0x7B, 0xA1, 0xF9, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x4A, 0x72, 0xD7, 0x24, 0x52, 0xB6, 0x90 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x68, 0x41, 0x97, 0x85, 0x60, 0xF6, 0x8B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_40_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x6B, 0xBA, 0x19, 0x07, 0x65, 0xD1, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x41, 0x11, 0x38, 0xD5, 0xE5, 0x34, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x73, 0xAF, 0x1E, 0xA3, 0x74, 0xB3, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0xAB, 0x31, 0x8B, 0xBB, 0x8F, 0x5E, 0x67 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0xC9, 0xA1, 0x32, 0x9C, 0x1C, 0x83, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x5A, 0xE5, 0x3B, 0xF3, 0xE9, 0xB4, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x74, 0xB7, 0x4B, 0xBD, 0x90, 0x65, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0xE4, 0xE0, 0xC5, 0xB3, 0xAB, 0xEE, 0x61 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_41_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6D, 0x29, 0xCA, 0x70, 0xCB, 0x31, 0xE6, 0x24 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x20, 0xCC, 0x41, 0x48, 0xDA, 0xEC, 0xDF, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x47, 0x40, 0xED, 0x64, 0x64, 0xEA, 0x8E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x37, 0xB6, 0xC4, 0x54, 0x65, 0x21, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x13, 0x15, 0x79, 0x9A, 0x6A, 0xFE, 0x0D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD7, 0x0C, 0x9C, 0x92, 0xAD, 0x43, 0x87, 0x01 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB4, 0x43, 0x70, 0x71, 0x8B, 0x8A, 0x07, 0x46 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x5C, 0x31, 0x1A, 0x64, 0x57, 0x16, 0x46 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_41_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x47, 0x5E, 0xF1, 0xDE, 0x8C, 0xA4, 0x4C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x89, 0x5B, 0xCC, 0xD4, 0xF4, 0x40, 0xCD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0xB2, 0xD3, 0x38, 0x5D, 0x44, 0xFB, 0x7A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA0, 0x46, 0xDA, 0x9B, 0xFF, 0xB7, 0xEA, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xB2, 0x70, 0xDA, 0xED, 0x00, 0x8F, 0x91 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x13, 0x5C, 0x72, 0x22, 0xB2, 0x06, 0x1A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1C, 0x03, 0x24, 0xA6, 0x87, 0x0C, 0xFC, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x73, 0x53, 0x9A, 0x93, 0xEE, 0x45, 0x62, 0x62 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_42_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0xDA, 0xE1, 0x4D, 0xC8, 0xE2, 0x08, 0x03 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x14, 0xB1, 0xF5, 0xFC, 0x59, 0xB6, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0xA2, 0x00, 0x97, 0xEB, 0x60, 0x72, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD8, 0xAF, 0xFE, 0xEF, 0xB1, 0x0C, 0x78, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x10, 0x24, 0xE8, 0x68, 0xB5, 0xAC, 0x0A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x4C, 0x95, 0x62, 0xC9, 0x02, 0xE5, 0xA9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x52, 0x01, 0x0C, 0x92, 0x6B, 0xC9, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x29, 0x8D, 0x10, 0x0F, 0x57, 0x46, 0xC8, 0x69 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_42_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x78, 0x37, 0x57, 0x9A, 0x8F, 0x78, 0xF4, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xF6, 0x6C, 0xE7, 0xE5, 0x6A, 0xB2, 0xBA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xEF, 0x4B, 0xDA, 0x4E, 0x8F, 0xAA, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x40, 0x70, 0xCA, 0xD6, 0x21, 0xE1, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x06, 0xDB, 0xF0, 0xB6, 0xBD, 0x56, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x8A, 0x78, 0x55, 0xBB, 0x5B, 0x81, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8B, 0x73, 0x98, 0x8C, 0xB3, 0x80, 0xA3, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xC7, 0x3F, 0x91, 0x16, 0xD2, 0x37, 0x45 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_43_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0C, 0x15, 0xD3, 0xBD, 0x7A, 0x5A, 0xE3, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF1, 0xB9, 0x60, 0xB1, 0x01, 0x35, 0x88, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD0, 0x59, 0xC6, 0x7A, 0xDA, 0x83, 0x13, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x17, 0xDE, 0x0D, 0xD8, 0x86, 0xB0, 0x58, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0x23, 0xEC, 0xCF, 0x9D, 0x6C, 0xA6, 0xDB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x7D, 0xBE, 0xFD, 0x11, 0xE8, 0xF4, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x28, 0xA3, 0x5D, 0x8F, 0x35, 0xEF, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xEB, 0x01, 0xD0, 0x49, 0x99, 0xBA, 0x67 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_43_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0x5B, 0x1F, 0xCB, 0x25, 0xB2, 0xF1, 0xC5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x34, 0xDD, 0x75, 0x97, 0xE6, 0xC4, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x91, 0x74, 0x6F, 0xCD, 0x9F, 0xEF, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0xB1, 0xFD, 0xE1, 0x0B, 0x65, 0x1C, 0x1E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xE6, 0x11, 0x33, 0x11, 0xF7, 0xEB, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0x84, 0x02, 0x4E, 0xA9, 0xCC, 0x05, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC0, 0xB2, 0x2F, 0x9C, 0xFB, 0x48, 0x1C, 0x55 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDF, 0x85, 0x95, 0x43, 0xCE, 0x81, 0x8A, 0xA1 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_44_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x6E, 0xBC, 0x47, 0xFD, 0x41, 0x36, 0x44 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0xD9, 0x3C, 0x92, 0xF9, 0x2B, 0x31, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x99, 0xAD, 0xBA, 0x7C, 0x28, 0x4B, 0x93, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAF, 0xFF, 0x05, 0xA9, 0x3D, 0x33, 0xA0, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x85, 0x15, 0x72, 0xBD, 0x73, 0x82, 0x29, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x07, 0x0F, 0x8D, 0x51, 0x7F, 0xCE, 0x2B, 0x5E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x4B, 0xE1, 0x10, 0xB0, 0x65, 0x21, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0x1F, 0xCD, 0x22, 0x74, 0xAA, 0x54, 0x57 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_44_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x6D, 0xD5, 0x97, 0xD6, 0x7D, 0xDC, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x32, 0xDC, 0x15, 0x7B, 0x8E, 0x9C, 0x06, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x69, 0xF2, 0x06, 0xC9, 0xF4, 0x08, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x02, 0xBD, 0x14, 0xD4, 0x1C, 0x3F, 0xF0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xA2, 0x48, 0x7A, 0x20, 0xFE, 0x2B, 0xD6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x90, 0x45, 0xC6, 0x6C, 0xAF, 0x2A, 0x11, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCA, 0x1C, 0xF3, 0xDD, 0xE2, 0x8F, 0x0F, 0x18 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFA, 0x06, 0xCF, 0xBA, 0xD7, 0x6C, 0x34, 0x10 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_45_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x67, 0xEC, 0xEA, 0x1A, 0x3B, 0x66, 0x01, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x42, 0x7B, 0x67, 0x02, 0x0F, 0x2B, 0x54, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x78, 0x60, 0xAC, 0x47, 0x9F, 0x69, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB9, 0xA9, 0x27, 0x99, 0x52, 0x2D, 0xCD, 0xFD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x86, 0x4D, 0x7C, 0xCD, 0x6E, 0x63, 0x77 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0x0C, 0x7C, 0x04, 0xA3, 0x85, 0xBA, 0x39 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0xF6, 0x96, 0xAF, 0x92, 0x30, 0x07, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0xCB, 0x33, 0x93, 0xC7, 0x85, 0x68, 0x2B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_45_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAC, 0x35, 0x0C, 0x3B, 0xA6, 0xA6, 0xDD, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x2E, 0xAF, 0x14, 0x08, 0xC6, 0x3A, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB2, 0xD3, 0xAB, 0xAB, 0x8F, 0xB1, 0x19, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x01, 0x8F, 0x25, 0xA5, 0x25, 0x8C, 0x13, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE7, 0x89, 0x9E, 0xB0, 0x39, 0xA2, 0xED, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x30, 0x05, 0xEA, 0xD4, 0xCB, 0x71, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0x0F, 0xD1, 0xB5, 0xFB, 0xF9, 0x30, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0xBF, 0x17, 0x1F, 0x94, 0x58, 0xF2, 0x70 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_46_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD3, 0xC2, 0xDB, 0x00, 0x3D, 0x2B, 0x9E, 0x9C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x48, 0xAF, 0xDA, 0x8B, 0xBC, 0xDA, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0xF8, 0xF8, 0x0A, 0x50, 0x37, 0x45, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x78, 0x74, 0x3F, 0xD1, 0x12, 0xA7, 0x78 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xB1, 0xFD, 0xAE, 0x19, 0xC1, 0x23, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCC, 0xEF, 0x8A, 0x02, 0xFB, 0xF1, 0xA4, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x45, 0x0C, 0x34, 0x6E, 0x81, 0x9A, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0xA0, 0x69, 0xE6, 0x53, 0xC3, 0xDA, 0x0D ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_46_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x22, 0x5C, 0x5A, 0x37, 0x07, 0x97, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xD6, 0x5A, 0x05, 0xF7, 0x07, 0xE5, 0x72 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x74, 0x60, 0xC8, 0x73, 0x52, 0x16, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x47, 0xB3, 0x92, 0x81, 0x23, 0x50, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDA, 0x71, 0x4C, 0xD8, 0xF8, 0x3E, 0x70, 0x50 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2C, 0xF3, 0x0B, 0x83, 0x91, 0x6F, 0x25, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x99, 0x5A, 0x6C, 0x62, 0x62, 0xA9, 0xA0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5B, 0xF9, 0x56, 0x7D, 0xF0, 0x5E, 0x6A, 0x60 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_47_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x26, 0x45, 0xE5, 0x0B, 0x07, 0x6A, 0x2D, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0xA2, 0xD6, 0x58, 0x5A, 0x55, 0xBF, 0xD2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0x79, 0x31, 0x73, 0x2E, 0x99, 0x80, 0xF9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC4, 0x48, 0x70, 0xA6, 0x33, 0x92, 0x45, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xF7, 0xD2, 0xC6, 0xE2, 0x1A, 0x4A, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x19, 0x55, 0xED, 0x1D, 0x17, 0x9F, 0x81, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4D, 0x3A, 0xC7, 0x3D, 0xBE, 0x01, 0xA1, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x7B, 0x63, 0x09, 0x44, 0xD0, 0x35, 0x66 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_47_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x1D, 0xF1, 0x31, 0xF1, 0xE8, 0x7B, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x64, 0xDC, 0x34, 0x28, 0xA3, 0x6B, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x5A, 0xF3, 0xC4, 0xB5, 0xFF, 0x94, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x46, 0x6F, 0x1F, 0xE3, 0xF9, 0xA4, 0xEF, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x9D, 0xAF, 0xD6, 0x91, 0x35, 0x2A, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB0, 0xA0, 0x72, 0xE3, 0x15, 0x6E, 0xA2, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x93, 0xCE, 0x5A, 0x0E, 0x96, 0x29, 0x59 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0x3E, 0x0B, 0x72, 0x83, 0x1B, 0xF8, 0x6F ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_48_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x91, 0x84, 0x16, 0xF6, 0x52, 0xED, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5D, 0xA8, 0x54, 0x41, 0x77, 0xD0, 0xAA, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x21, 0x1D, 0x3D, 0xFB, 0x64, 0x6A, 0xF8, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xDF, 0x64, 0x23, 0xFA, 0xEA, 0x38, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x95, 0x5B, 0x2A, 0x1F, 0xAA, 0x31, 0x57 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0x78, 0x60, 0xBA, 0x8A, 0xFF, 0xF6, 0xBB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x4C, 0xD3, 0x21, 0x93, 0x6A, 0xF6, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0x0D, 0x10, 0xD4, 0x67, 0x9E, 0x2F, 0x05 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_48_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9C, 0xDC, 0xE0, 0x89, 0xEE, 0xE5, 0xD3, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0xDB, 0xFE, 0xFE, 0xB4, 0x49, 0x72, 0x62 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0x02, 0xB9, 0x52, 0xF7, 0xD7, 0x67, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0xA2, 0xD6, 0xCB, 0xEC, 0x2D, 0x2D, 0x00 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x3E, 0x53, 0x53, 0x51, 0xDB, 0x7F, 0xD8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x70, 0xC6, 0x98, 0xA9, 0xEB, 0xB7, 0x64, 0xC7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x26, 0xB1, 0x83, 0x84, 0x55, 0xA4, 0x2A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0xA0, 0x5C, 0x90, 0x29, 0xEB, 0x1C, 0x50 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_49_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0xC3, 0x3A, 0xD9, 0x05, 0x2C, 0xC9, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xDE, 0xD8, 0xB4, 0x2D, 0x25, 0x09, 0xA3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0xD1, 0xC6, 0x75, 0xE6, 0x1A, 0x0E, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x6A, 0x4E, 0x7C, 0xA4, 0xDD, 0x12, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xF1, 0x4D, 0x2F, 0x27, 0xDC, 0x03, 0xC6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA1, 0x8D, 0x5B, 0x78, 0x2A, 0x87, 0x8E, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x06, 0x82, 0xFE, 0xFA, 0x2A, 0xBE, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x04, 0x7B, 0x32, 0x7B, 0x64, 0x3C, 0x62 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_49_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0x40, 0x4F, 0x4D, 0x6E, 0x43, 0x4C, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xA5, 0xD4, 0x4B, 0x7D, 0x64, 0x81, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x83, 0x86, 0x2F, 0x0D, 0xE0, 0x8B, 0x5A, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x22, 0xBE, 0x54, 0x0C, 0xB9, 0xEE, 0x17, 0x58 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0xB4, 0x08, 0xF5, 0xD5, 0xB8, 0x73, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9F, 0x3D, 0x09, 0x4C, 0xE6, 0x38, 0x9D, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x28, 0x26, 0x32, 0xF7, 0x48, 0x9C, 0x30, 0xBF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0x04, 0x5A, 0xF9, 0x2C, 0x8A, 0x69, 0x30 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_50_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x74, 0xB5, 0xA0, 0xA9, 0x4B, 0xA1, 0x6F, 0xB4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x72, 0x55, 0x91, 0xBA, 0xDF, 0xE9, 0xBE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x04, 0x63, 0x28, 0xDA, 0x7A, 0x84, 0xFF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x4A, 0x9C, 0xE8, 0xD4, 0x6D, 0x5D, 0x0F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0x86, 0xAE, 0x36, 0xEB, 0x80, 0x34, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x51, 0xC0, 0xC0, 0xAB, 0xDC, 0xD7, 0xEE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB7, 0x36, 0x86, 0x22, 0x45, 0xDA, 0x74, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x18, 0x79, 0x18, 0x50, 0x51, 0xA4, 0x54 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_50_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6A, 0xB1, 0xE0, 0x81, 0x2B, 0x6D, 0xF7, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBD, 0xFE, 0x66, 0xCB, 0xC1, 0xD5, 0xE7, 0x3A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x9E, 0x2E, 0x78, 0x9B, 0x4D, 0xE6, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5F, 0xA7, 0x6F, 0x73, 0xD3, 0x88, 0x61, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC9, 0x24, 0xCB, 0x77, 0x0D, 0xBF, 0x86, 0x8D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xE8, 0x69, 0x4C, 0x66, 0xF5, 0xA6, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x7C, 0xE6, 0xD1, 0x16, 0xAF, 0x5B, 0x7D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA5, 0x90, 0x98, 0xAB, 0x81, 0x13, 0x07, 0x95 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_51_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xC1, 0x8F, 0x61, 0x7F, 0xB9, 0xA2, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x77, 0x42, 0xE9, 0x7A, 0x28, 0x03, 0x4B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x63, 0x59, 0x54, 0xF4, 0xDC, 0xDD, 0x94 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xE5, 0x3F, 0x9E, 0x24, 0x04, 0x4F, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xED, 0x75, 0xC0, 0x45, 0xFA, 0x32, 0x9D, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0x96, 0xE1, 0xBA, 0x88, 0x88, 0xA7, 0x84 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAA, 0x4C, 0x4B, 0x3F, 0x8D, 0xE9, 0xD4, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1D, 0x04, 0x8C, 0x21, 0xF9, 0x4A, 0x4B, 0x78 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_51_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0xD3, 0x81, 0x09, 0xAB, 0x78, 0xF0, 0x2D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x08, 0x55, 0x5A, 0x69, 0xFC, 0x09, 0x3B, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0x0B, 0x32, 0x9A, 0x41, 0x03, 0x13, 0x10 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAE, 0xF1, 0x50, 0xE0, 0x20, 0xE5, 0x8F, 0xEB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x04, 0xFD, 0x36, 0x7A, 0x77, 0xE8, 0x23 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x45, 0xAB, 0xBF, 0x1A, 0x55, 0x44, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0x6A, 0x48, 0xD8, 0xDD, 0x29, 0x1B, 0xE7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x5E, 0x76, 0x58, 0x6D, 0x5B, 0xA3, 0x6A, 0x27 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_52_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x59, 0x82, 0x1E, 0x19, 0xB4, 0xF5, 0xCE, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0x1A, 0x16, 0x5E, 0xC4, 0x0A, 0xFC, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0xF9, 0x09, 0x0F, 0x22, 0x62, 0xED, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x05, 0xDC, 0x17, 0x54, 0x26, 0x25, 0x8A, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8F, 0xF3, 0xDF, 0x9E, 0xB6, 0xAD, 0xAC, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x33, 0x46, 0xA0, 0x0A, 0xFF, 0x18, 0x7D, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x37, 0xEC, 0x19, 0xCF, 0xA7, 0x0D, 0x76 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x92, 0x2B, 0xAD, 0xCA, 0xE3, 0x84, 0x3D, 0x24 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_52_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEE, 0x35, 0xAB, 0xBE, 0x41, 0xE8, 0x04, 0x38 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2D, 0x4B, 0x73, 0x6B, 0xFA, 0x8C, 0x99, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEB, 0x99, 0x36, 0xDC, 0xF9, 0x0C, 0xDD, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA6, 0xCB, 0x32, 0xD2, 0xE6, 0x48, 0xC0, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x6D, 0x52, 0x43, 0xB7, 0xEB, 0x94, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x55, 0x95, 0xCC, 0x3D, 0x24, 0xC0, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x69, 0xDA, 0xA0, 0x85, 0x3C, 0x4B, 0xC1, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x96, 0xDF, 0x2D, 0xAC, 0x56, 0x2C, 0xCE, 0x8B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_53_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0xF0, 0xF8, 0xCA, 0x25, 0x41, 0xDF, 0x61 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x3C, 0x55, 0xF4, 0xFD, 0xFA, 0x79, 0x9B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x14, 0x70, 0x90, 0x9F, 0x6E, 0xE5, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF4, 0xA6, 0xAE, 0xAB, 0xF9, 0xDD, 0x19, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x48, 0x48, 0xBD, 0x79, 0xEB, 0x32, 0xCC, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xA8, 0xB3, 0x0C, 0xC8, 0xF9, 0xC6, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8C, 0x15, 0x3D, 0x41, 0x22, 0x52, 0x0A, 0x4A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x4D, 0x47, 0x96, 0x97, 0x11, 0xC8, 0x40 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_53_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0x62, 0x14, 0x7F, 0xDD, 0x08, 0x96, 0x2C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFC, 0xD7, 0xC4, 0x02, 0x72, 0x19, 0xCF, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2B, 0x9F, 0x2E, 0x23, 0x86, 0x4B, 0xEC, 0xAC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x85, 0xD5, 0xD2, 0x56, 0x37, 0x0E, 0xD0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4E, 0x09, 0x66, 0x81, 0x5F, 0xA4, 0x3A, 0x4D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x76, 0x65, 0x8E, 0x8A, 0x0A, 0x3E, 0x07, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF5, 0x22, 0x82, 0x7F, 0xD5, 0xFB, 0x9D, 0x56 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x12, 0xC0, 0x79, 0xAD, 0xF7, 0xA0, 0x0F, 0x63 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_54_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x40, 0xF3, 0x46, 0xEE, 0x90, 0xBE, 0x4A, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x30, 0xC0, 0x1D, 0x4D, 0x20, 0xD0, 0x7B, 0x70 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0xBE, 0xBF, 0x87, 0x53, 0xA7, 0x39, 0xF1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0F, 0x87, 0xAC, 0xAD, 0xF7, 0xC8, 0xBF, 0x3F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0x27, 0xC8, 0xA6, 0xC7, 0x4D, 0x63, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x36, 0x51, 0xED, 0xC0, 0xBA, 0x53, 0x66 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xED, 0x34, 0xF0, 0x7D, 0x31, 0xF7, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x71, 0x53, 0xFB, 0x72, 0xA6, 0x6C, 0xF8, 0x5B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_54_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x24, 0x20, 0x19, 0x0C, 0x7A, 0x94, 0x7F, 0xDE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x88, 0x86, 0x6C, 0x89, 0x5D, 0xF9, 0x53, 0x13 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x7B, 0x00, 0x4D, 0x30, 0xA9, 0xCC, 0x3D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x94, 0x7F, 0x02, 0x5B, 0x53, 0x17, 0x11, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0xC1, 0x75, 0x44, 0xAB, 0x5A, 0x18, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x61, 0x1F, 0x0C, 0x49, 0x86, 0x4F, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xAD, 0xE1, 0x04, 0x13, 0x83, 0x3F, 0x6E, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0x12, 0x65, 0x58, 0x4C, 0xAA, 0x98, 0x2D ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_55_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0x5B, 0xBF, 0x7F, 0x82, 0xD1, 0x0A, 0xE6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7F, 0x64, 0xA7, 0xF9, 0x01, 0x6F, 0x15, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD9, 0x80, 0x89, 0x79, 0x06, 0xB6, 0x68, 0x3C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC2, 0xCD, 0x8E, 0xFC, 0x6F, 0x6E, 0xAE, 0xA6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0x20, 0x0C, 0x5C, 0x89, 0x98, 0x97, 0xEA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7E, 0x65, 0x9E, 0x5C, 0x05, 0xDC, 0x34, 0xF2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x12, 0xCF, 0xEC, 0x6C, 0x3F, 0x6B, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB8, 0x20, 0x74, 0xFE, 0x65, 0x0F, 0x29, 0x5E ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_55_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0x53, 0x05, 0x4D, 0xDA, 0xA5, 0x7B, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0x9B, 0xC2, 0x9F, 0xC1, 0xF7, 0x11, 0xCF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBE, 0x2A, 0x21, 0xD8, 0xC7, 0xF0, 0x0D, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x79, 0x03, 0x8C, 0x4F, 0x7F, 0x8F, 0x6E, 0x6F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x55, 0x24, 0x4A, 0xA9, 0xDF, 0x56, 0xDF, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF3, 0xE6, 0xBC, 0xDC, 0xF8, 0x4D, 0x08, 0xD7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA3, 0xED, 0xD6, 0x43, 0x53, 0x5F, 0x2B, 0xD9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x62, 0xDC, 0x7C, 0xAA, 0x9F, 0xA5, 0x81 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_56_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x04, 0x96, 0x45, 0x84, 0x5E, 0xD2, 0x8B, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF8, 0x38, 0xB5, 0x10, 0x18, 0x76, 0x35, 0x1C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3D, 0xAF, 0x8C, 0x9E, 0x40, 0xA4, 0x23, 0x7B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xDA, 0x71, 0x6D, 0x92, 0x08, 0xB7, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0x43, 0x4B, 0x10, 0xF6, 0x03, 0x07, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFE, 0x25, 0x2B, 0x8F, 0x31, 0x60, 0xA9, 0x47 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x77, 0x0B, 0x7A, 0x36, 0x5E, 0x0E, 0x46, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xB8, 0xE2, 0xE1, 0x29, 0xBA, 0x61, 0x50 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_56_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x38, 0x85, 0xE8, 0xC8, 0x7B, 0x86, 0x9D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEF, 0x5B, 0x31, 0x1B, 0x1D, 0x41, 0x7D, 0x8C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x81, 0x12, 0xB5, 0x97, 0x04, 0x75, 0xE2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x80, 0x8E, 0x1C, 0xE3, 0xD4, 0xD0, 0x92, 0x22 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xEF, 0x94, 0x50, 0x90, 0x77, 0xE2, 0xCC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0xB2, 0x16, 0x9F, 0x14, 0x15, 0x9B, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0A, 0xBF, 0x60, 0xFA, 0xCD, 0xEC, 0x6E, 0x41 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6C, 0xDD, 0x32, 0x3D, 0xC4, 0x0E, 0x6A, 0x96 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_57_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCB, 0xA8, 0x41, 0x40, 0xE9, 0xD5, 0xE3, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xD6, 0x45, 0xCC, 0xEA, 0xD0, 0xEC, 0xB0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA4, 0xD0, 0xF0, 0x58, 0x37, 0x7C, 0x16, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDE, 0x58, 0x29, 0xA3, 0x59, 0x06, 0x68, 0xB1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xEE, 0x37, 0xD3, 0x9C, 0xBE, 0x69, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBB, 0xC6, 0xD1, 0xC0, 0x92, 0xBF, 0x4C, 0xE1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x85, 0xC1, 0x24, 0xD8, 0xA4, 0xE3, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x2F, 0xAB, 0xA3, 0x5D, 0x66, 0x8C, 0x85 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_57_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0xC3, 0x0E, 0xC7, 0x5F, 0xA6, 0x5F, 0x04 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x03, 0xA2, 0x70, 0xA5, 0x0A, 0xE6, 0x9C, 0xF6 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0xDB, 0x82, 0x1F, 0x12, 0x81, 0x6B, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x50, 0x34, 0xAD, 0x91, 0x01, 0xA4, 0x57, 0xF3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xF6, 0xB2, 0x33, 0xA5, 0x4E, 0x97, 0xF2, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x57, 0x2A, 0x7D, 0xE9, 0xAA, 0xE3, 0xDC, 0x51 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4A, 0xF9, 0x61, 0xEF, 0xE3, 0x8E, 0xAE, 0x54 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0xB4, 0x76, 0xB4, 0xC4, 0xBB, 0xDE, 0x9B ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_58_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0xF4, 0xA4, 0x00, 0xDD, 0x69, 0x1F, 0x73 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEC, 0x3C, 0xE9, 0xC3, 0xB7, 0x9E, 0x4C, 0x3E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD2, 0x04, 0x33, 0x42, 0x8D, 0x07, 0x6A, 0xE8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x17, 0xFB, 0xB0, 0xB2, 0xFE, 0x3D, 0x8A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3E, 0xFE, 0xD8, 0x43, 0xF3, 0x78, 0x23, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE9, 0x75, 0xAD, 0xB2, 0xC0, 0xF1, 0x8C, 0xD5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0x16, 0x13, 0xF7, 0xCD, 0x46, 0x40, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB5, 0x2E, 0x9A, 0xEC, 0xF0, 0xA3, 0xB6, 0x6E ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_58_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7A, 0x77, 0xAF, 0x30, 0x27, 0xB7, 0x6D, 0x33 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC6, 0xD1, 0x40, 0xB2, 0x8E, 0xBE, 0x50, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0x81, 0xF2, 0xE5, 0x4B, 0xFC, 0xF7, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0xDD, 0x2E, 0x88, 0xEF, 0xFB, 0x69, 0x9A ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD5, 0xC1, 0xDA, 0x4D, 0x12, 0xA4, 0xD2, 0xB7 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9E, 0x3A, 0x1B, 0xC9, 0x7D, 0x04, 0xFB, 0x32 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCE, 0x22, 0x44, 0x6F, 0xCD, 0xD2, 0x5C, 0x49 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x11, 0xB9, 0xDA, 0xD6, 0x30, 0x6A, 0x57, 0x53 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_59_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA2, 0x00, 0x64, 0x58, 0x1B, 0xF7, 0xFD, 0xFE ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x0E, 0x71, 0xFE, 0x2C, 0x68, 0x83, 0x9F, 0x48 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x75, 0x52, 0x9C, 0x33, 0x89, 0xA0, 0x7C, 0xB3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7D, 0x82, 0xF6, 0x17, 0x22, 0xAD, 0xE4, 0x64 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x91, 0x37, 0x5A, 0xB9, 0xD9, 0x23, 0xFB, 0xE9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xCF, 0x77, 0x8F, 0x9E, 0xA4, 0xEB, 0x20, 0x82 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0xCA, 0x41, 0x6D, 0x67, 0x20, 0xDB, 0x20 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2A, 0xB6, 0xFA, 0x61, 0x66, 0x5E, 0x48, 0x39 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_59_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE1, 0x5F, 0xF8, 0x02, 0xBC, 0x2E, 0x72, 0xA2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x8E, 0x05, 0x5F, 0x98, 0x4B, 0x86, 0x1B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x49, 0xC0, 0x86, 0x67, 0x93, 0x5F, 0xF1, 0x8B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x84, 0xB9, 0x1B, 0x72, 0x71, 0x4C, 0x16, 0xAA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4F, 0x36, 0xD6, 0x21, 0x5D, 0x1A, 0xA6, 0x2B ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x89, 0x28, 0x78, 0xDD, 0xAC, 0x0A, 0x3E, 0x80 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x2D, 0x66, 0x17, 0x77, 0x2F, 0x1E, 0xB2 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x58, 0xDC, 0x86, 0xD1, 0xBE, 0x04, 0x74, 0x1C ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_60_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1B, 0xB1, 0x33, 0x33, 0x85, 0x6D, 0x37, 0xC9 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xEA, 0x59, 0x76, 0x92, 0x9B, 0x45, 0x42, 0xAF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0xFE, 0x74, 0xD9, 0xE6, 0x68, 0xC0, 0x5C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x68, 0xC4, 0x64, 0x5A, 0x39, 0x74, 0x31, 0xD3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4C, 0x61, 0x18, 0xB9, 0xFA, 0xBC, 0xAD, 0x28 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x56, 0xC9, 0x75, 0xF8, 0x43, 0x1E, 0x87, 0xC1 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xD1, 0xDD, 0x31, 0x1B, 0xB6, 0x6B, 0xA0, 0xDF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x87, 0x96, 0x14, 0xA9, 0x6D, 0x4B, 0x8D, 0x6A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_60_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC3, 0x41, 0x00, 0x1E, 0x83, 0x1E, 0x5B, 0x05 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0x5C, 0xD4, 0x6C, 0xDF, 0xBF, 0x28, 0x7E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8D, 0xC3, 0xEF, 0xF2, 0xD8, 0xF9, 0xC7, 0xEF ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9B, 0x7B, 0x64, 0xCB, 0xD8, 0x15, 0x59, 0x7C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x54, 0x2B, 0x5D, 0xB9, 0xC8, 0x80, 0x4B, 0x5D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xC8, 0xA3, 0x09, 0x88, 0x89, 0xEA, 0x79, 0x09 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x63, 0xCD, 0x6B, 0xD1, 0x12, 0x5D, 0xDF, 0xDA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3B, 0x39, 0x2D, 0x38, 0x7C, 0xD2, 0x7D, 0x0D ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_61_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x64, 0x18, 0x91, 0xED, 0x61, 0xC9, 0xC1, 0x99 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7C, 0xC8, 0x0E, 0x8C, 0x7E, 0x95, 0xD3, 0x1D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x7B, 0x1C, 0x60, 0x61, 0x83, 0x5B, 0x27, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x62, 0x76, 0xA1, 0x6D, 0x3A, 0x72, 0x32, 0x14 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x00, 0xEC, 0x71, 0xBC, 0x4E, 0x6D, 0x8F, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x3D, 0x87, 0xE4, 0x67, 0x0B, 0x03, 0x9E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3F, 0x0A, 0xEE, 0x6C, 0xF2, 0xA3, 0x56, 0x26 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB3, 0x5E, 0x0D, 0xF3, 0x3A, 0x23, 0x53, 0x7C ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_61_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA8, 0x6D, 0x81, 0x68, 0xA2, 0xC6, 0xA4, 0x83 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x9A, 0xA5, 0x83, 0xE1, 0x3E, 0xBC, 0xA2, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x18, 0x17, 0xDC, 0x91, 0x81, 0xB9, 0x98, 0x88 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x38, 0x53, 0x02, 0xE3, 0xA2, 0xB4, 0x6C, 0x89 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x8E, 0x84, 0x2D, 0xE9, 0x19, 0xF9, 0x67, 0x87 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x14, 0x46, 0x72, 0xA0, 0xE0, 0x33, 0xB4, 0x98 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x2F, 0xE7, 0xDB, 0x7F, 0xC0, 0x87, 0x23, 0xB5 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0x3F, 0xC1, 0x56, 0xED, 0x73, 0xD9, 0x55 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_62_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x86, 0xFA, 0xA6, 0xC5, 0xD6, 0xF0, 0x03, 0x4E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x6B, 0x6F, 0x3C, 0xEB, 0xB4, 0xFA, 0xDF, 0x0C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x37, 0x6C, 0xA8, 0xD4, 0xFB, 0x67, 0x0F, 0x81 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0xA8, 0x8E, 0x24, 0x46, 0x3D, 0xC9, 0x85 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x65, 0xDB, 0x10, 0x7C, 0x9B, 0xE5, 0x53, 0xC0 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x31, 0x1D, 0x4A, 0xDC, 0x17, 0xD2, 0xD0, 0x0E ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB6, 0x47, 0xED, 0x55, 0x33, 0x5F, 0x90, 0x6D ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xA9, 0x51, 0x25, 0x8C, 0xCF, 0x46, 0x95, 0x33 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_62_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x35, 0x5F, 0x8E, 0x98, 0x13, 0xF2, 0xB8, 0xBD ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x3C, 0x0E, 0x57, 0x31, 0xD6, 0x9C, 0x9F, 0x06 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE6, 0x48, 0x0A, 0x85, 0x97, 0xC7, 0x68, 0x45 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x51, 0xCD, 0x4D, 0x9A, 0xD7, 0xE1, 0x83, 0x53 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x23, 0x7D, 0xA3, 0x32, 0x8F, 0xB8, 0x5D, 0xE3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xB1, 0x2D, 0x32, 0xCB, 0x41, 0xEC, 0x61, 0xFB ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x09, 0xD5, 0xC3, 0xAF, 0xCA, 0xDE, 0x55, 0xCA ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x06, 0x60, 0x7D, 0xAE, 0x4D, 0x5C, 0x45, 0x28 ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_63_X[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x47, 0x7C, 0xAF, 0x56, 0x65, 0x0A, 0x13, 0xEC ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xBC, 0xF3, 0x23, 0x55, 0x24, 0xE8, 0x1C, 0x25 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x34, 0xB4, 0x88, 0x2E, 0x83, 0xC3, 0x84, 0x07 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x1F, 0xE7, 0xB5, 0x99, 0x0A, 0xA8, 0x69, 0x74 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xE5, 0xE1, 0x8E, 0xFD, 0x8A, 0x7F, 0xDE, 0xB8 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x93, 0xAF, 0x35, 0xB1, 0xE9, 0x44, 0x8F, 0xC3 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xFB, 0x34, 0xBB, 0xE9, 0x1F, 0xAC, 0xA4, 0x34 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x60, 0x73, 0xE5, 0xAC, 0x22, 0xDB, 0xDF, 0x2A ),
+};
+static const mbedtls_mpi_uint brainpoolP512r1_T_63_Y[] = {
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x82, 0x75, 0xA6, 0xD6, 0xA8, 0xAF, 0x35, 0x1F ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0xDD, 0xEB, 0x4C, 0x3A, 0x28, 0xC9, 0x1B, 0xA4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x52, 0xC8, 0xBD, 0xD3, 0xD3, 0x0D, 0x6D, 0x6C ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x45, 0x01, 0x66, 0x9C, 0x42, 0x1C, 0x88, 0x63 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x66, 0x68, 0x7D, 0x83, 0x37, 0xB6, 0x13, 0x40 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x4B, 0xF1, 0xD6, 0x47, 0xE4, 0x76, 0x84, 0x21 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x27, 0x9E, 0x1B, 0xB8, 0x01, 0x26, 0xE8, 0xC4 ),
+    MBEDTLS_BYTES_TO_T_UINT_8( 0x16, 0xD1, 0x12, 0x7E, 0x12, 0xE7, 0x3F, 0x85 ),
+};
+static const mbedtls_ecp_point brainpoolP512r1_T[64] = {
+    ECP_POINT_INIT_XY_Z1(brainpoolP512r1_T_0_X, brainpoolP512r1_T_0_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_1_X, brainpoolP512r1_T_1_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_2_X, brainpoolP512r1_T_2_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_3_X, brainpoolP512r1_T_3_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_4_X, brainpoolP512r1_T_4_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_5_X, brainpoolP512r1_T_5_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_6_X, brainpoolP512r1_T_6_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_7_X, brainpoolP512r1_T_7_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_8_X, brainpoolP512r1_T_8_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_9_X, brainpoolP512r1_T_9_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_10_X, brainpoolP512r1_T_10_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_11_X, brainpoolP512r1_T_11_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_12_X, brainpoolP512r1_T_12_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_13_X, brainpoolP512r1_T_13_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_14_X, brainpoolP512r1_T_14_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_15_X, brainpoolP512r1_T_15_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_16_X, brainpoolP512r1_T_16_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_17_X, brainpoolP512r1_T_17_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_18_X, brainpoolP512r1_T_18_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_19_X, brainpoolP512r1_T_19_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_20_X, brainpoolP512r1_T_20_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_21_X, brainpoolP512r1_T_21_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_22_X, brainpoolP512r1_T_22_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_23_X, brainpoolP512r1_T_23_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_24_X, brainpoolP512r1_T_24_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_25_X, brainpoolP512r1_T_25_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_26_X, brainpoolP512r1_T_26_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_27_X, brainpoolP512r1_T_27_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_28_X, brainpoolP512r1_T_28_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_29_X, brainpoolP512r1_T_29_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_30_X, brainpoolP512r1_T_30_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_31_X, brainpoolP512r1_T_31_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_32_X, brainpoolP512r1_T_32_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_33_X, brainpoolP512r1_T_33_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_34_X, brainpoolP512r1_T_34_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_35_X, brainpoolP512r1_T_35_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_36_X, brainpoolP512r1_T_36_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_37_X, brainpoolP512r1_T_37_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_38_X, brainpoolP512r1_T_38_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_39_X, brainpoolP512r1_T_39_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_40_X, brainpoolP512r1_T_40_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_41_X, brainpoolP512r1_T_41_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_42_X, brainpoolP512r1_T_42_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_43_X, brainpoolP512r1_T_43_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_44_X, brainpoolP512r1_T_44_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_45_X, brainpoolP512r1_T_45_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_46_X, brainpoolP512r1_T_46_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_47_X, brainpoolP512r1_T_47_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_48_X, brainpoolP512r1_T_48_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_49_X, brainpoolP512r1_T_49_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_50_X, brainpoolP512r1_T_50_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_51_X, brainpoolP512r1_T_51_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_52_X, brainpoolP512r1_T_52_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_53_X, brainpoolP512r1_T_53_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_54_X, brainpoolP512r1_T_54_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_55_X, brainpoolP512r1_T_55_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_56_X, brainpoolP512r1_T_56_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_57_X, brainpoolP512r1_T_57_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_58_X, brainpoolP512r1_T_58_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_59_X, brainpoolP512r1_T_59_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_60_X, brainpoolP512r1_T_60_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_61_X, brainpoolP512r1_T_61_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_62_X, brainpoolP512r1_T_62_Y),
+    ECP_POINT_INIT_XY_Z0(brainpoolP512r1_T_63_X, brainpoolP512r1_T_63_Y),
+};
 #else
 #define brainpoolP512r1_T NULL
 #endif
@@ -0,0 +1,63 @@
+/**
+ * \file ecp_internal.h
+ *
+ * \brief ECP library: internal interfaces shared with other library modules.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MBEDTLS_ECP_INTERNAL_H
+#define MBEDTLS_ECP_INTERNAL_H
+
+#include "common.h"
+
+#include "mbedtls/ecp.h"
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED)
+#if !defined(MBEDTLS_ECP_ALT)
+/**
+ * \brief           Compute R = m * P + n * Q where \p m and \p n are public,
+ *                  as in signature verification.
+ *
+ *                  This is mbedtls_ecp_muladd_restartable(), except that it
+ *                  may use algorithms whose timing depends on \p m and \p n,
+ *                  such as the GLV method on secp256k1. It must never be
+ *                  called with a secret scalar: use
+ *                  mbedtls_ecp_muladd_restartable() for that.
+ *
+ * \param grp       The ECP group to use.
+ * \param R         The point in which to store the result.
+ * \param m         The integer by which to multiply \p P.
+ * \param P         The point to multiply by \p m.
+ * \param n         The integer by which to multiply \p Q.
+ * \param Q         The point to be multiplied by \p n.
+ * \param rs_ctx    The restart context (NULL disables restart).
+ *
+ * \return          See mbedtls_ecp_muladd_restartable().
+ */
+int mbedtls_ecp_muladd_public_restartable(
+             mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
+             mbedtls_ecp_restart_ctx *rs_ctx );
+#else
+/* An alternative implementation only provides the generic function */
+#define mbedtls_ecp_muladd_public_restartable mbedtls_ecp_muladd_restartable
+#endif /* !MBEDTLS_ECP_ALT */
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
+
+#endif /* MBEDTLS_ECP_INTERNAL_H */
@@ -40,6 +40,11 @@
 
 #if defined(MBEDTLS_AESNI_C)
 #include "aesni.h"
+
+/* Values of the aesni field of the context */
+#define GCM_AESNI_NONE          0   /* Portable code */
+#define GCM_AESNI_GHASH         1   /* Aggregated CLMUL GHASH */
+#define GCM_AESNI_AES_GHASH     2   /* AES-NI CTR with aggregated GHASH */
 #endif
 
 #if !defined(MBEDTLS_GCM_ALT)
@@ -86,9 +91,13 @@ static int gcm_gen_table( mbedtls_gcm_context *ctx )
     ctx->HH[8] = vh;
 
 #if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
-    /* With CLMUL support, we need only h, not the rest of the table */
+    /* With CLMUL support, we need only h and its powers for the
+     * aggregated GHASH, not the rest of the table */
     if( mbedtls_aesni_has_support( MBEDTLS_AESNI_CLMUL ) )
+    {
+        mbedtls_aesni_gcm_powers( ctx->H_pow, h );
         return( 0 );
+    }
 #endif
 
     /* 0 corresponds to 0 in GF(2^128) */
@@ -153,6 +162,21 @@ int mbedtls_gcm_setkey( mbedtls_gcm_context *ctx,
     if( ( ret = gcm_gen_table( ctx ) ) != 0 )
         return( ret );
 
+#if defined(MBEDTLS_AESNI_C)
+    ctx->aesni = GCM_AESNI_NONE;
+#if defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_CLMUL ) )
+    {
+        ctx->aesni = GCM_AESNI_GHASH;
+        if( cipher == MBEDTLS_CIPHER_ID_AES &&
+            mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+        {
+            ctx->aesni = GCM_AESNI_AES_GHASH;
+        }
+    }
+#endif
+#endif /* MBEDTLS_AESNI_C */
+
     return( 0 );
 }
 
@@ -341,6 +365,18 @@ int mbedtls_gcm_update_ad( mbedtls_gcm_context *ctx,
 
     ctx->add_len += add_len;
 
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( ctx->aesni != GCM_AESNI_NONE && add_len >= 16 )
+    {
+        size_t blocks = add_len / 16;
+
+        mbedtls_aesni_gcm_ghash( ctx->buf, ctx->H_pow, p, blocks );
+
+        add_len -= 16 * blocks;
+        p += 16 * blocks;
+    }
+#endif
+
     while( add_len >= 16 )
     {
         for( i = 0; i < 16; i++ )
@@ -459,6 +495,23 @@ int mbedtls_gcm_update( mbedtls_gcm_context *ctx,
 
     ctx->len += input_length;
 
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( ctx->aesni == GCM_AESNI_AES_GHASH && input_length >= 16 )
+    {
+        size_t blocks = input_length / 16;
+
+        if( ( ret = mbedtls_aesni_gcm_crypt( ctx->cipher_ctx.cipher_ctx,
+                                             ctx->mode, blocks, ctx->y,
+                                             ctx->H_pow, ctx->buf,
+                                             p, out_p ) ) != 0 )
+            return( ret );
+
+        input_length -= 16 * blocks;
+        p += 16 * blocks;
+        out_p += 16 * blocks;
+    }
+#endif
+
     while( input_length >= 16 )
     {
         gcm_incr( ctx->y );
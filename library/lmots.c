@@ -44,6 +44,15 @@
 
 #include "psa/crypto.h"
 
+/* If PSA computes SHA-256 with the built-in implementation, batches of
+ * independent hashes go straight to mbedtls_sha256_multi() so that they are
+ * spread across SIMD lanes. Otherwise, for example with an accelerator
+ * driver, each hash goes through psa_hash_compute(). */
+#if defined(MBEDTLS_PSA_BUILTIN_ALG_SHA_256) && defined(MBEDTLS_SHA256_C)
+#include "mbedtls/sha256.h"
+#define LMS_HASH_MULTI_USE_SHA256
+#endif
+
 #define PUBLIC_KEY_TYPE_OFFSET     (0)
 #define PUBLIC_KEY_I_KEY_ID_OFFSET (PUBLIC_KEY_TYPE_OFFSET + \
                                     MBEDTLS_LMOTS_TYPE_LEN)
@@ -62,7 +71,18 @@
 
 #define DIGIT_MAX_VALUE        ((1u << W_WINTERNITZ_PARAMETER) - 1u)
 
-#define D_CONST_LEN            (2)
+/* Layout of the message hashed at each step of a Winternitz chain:
+ * I || u32str(q) || u16str(i) || u8str(j) || tmp */
+#define CHAIN_MSG_Q_LEAF_ID_OFFSET (MBEDTLS_LMOTS_I_KEY_ID_LEN)
+#define CHAIN_MSG_I_DIGIT_OFFSET   (CHAIN_MSG_Q_LEAF_ID_OFFSET + \
+                                    MBEDTLS_LMOTS_Q_LEAF_ID_LEN)
+#define CHAIN_MSG_J_HASH_OFFSET    (CHAIN_MSG_I_DIGIT_OFFSET + I_DIGIT_IDX_LEN)
+#define CHAIN_MSG_TMP_OFFSET       (CHAIN_MSG_J_HASH_OFFSET + J_HASH_IDX_LEN)
+#define CHAIN_MSG_LEN(type)        (CHAIN_MSG_TMP_OFFSET + \
+                                    MBEDTLS_LMOTS_N_HASH_LEN(type))
+#define CHAIN_MSG_LEN_MAX          (CHAIN_MSG_TMP_OFFSET + \
+                                    MBEDTLS_LMOTS_N_HASH_LEN_MAX)
+
 static const unsigned char D_PUBLIC_CONSTANT_BYTES[D_CONST_LEN] = {0x80, 0x80};
 static const unsigned char D_MESSAGE_CONSTANT_BYTES[D_CONST_LEN] = {0x81, 0x81};
 
@@ -233,86 +253,83 @@ static int hash_digit_array( const mbedtls_lmots_parameters_t *params,
                              unsigned char *output )
 {
     unsigned int i_digit_idx;
-    unsigned char i_digit_idx_bytes[I_DIGIT_IDX_LEN];
     unsigned int j_hash_idx;
-    unsigned char j_hash_idx_bytes[J_HASH_IDX_LEN];
     unsigned int j_hash_idx_min;
     unsigned int j_hash_idx_max;
-    psa_hash_operation_t op = PSA_HASH_OPERATION_INIT;
-    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-    size_t output_hash_len;
-    unsigned char tmp_hash[MBEDTLS_LMOTS_N_HASH_LEN_MAX];
+    unsigned char msg[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX][CHAIN_MSG_LEN_MAX];
+    const unsigned char *msg_ptrs[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX];
+    size_t msg_lens[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX];
+    unsigned char *out_ptrs[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX];
+    size_t count;
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    /* The output holds the current value of each chain. Only the j and tmp
+     * fields of the chain messages change from one step to the next. */
+    memcpy( output, x_digit_array,
+            MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT(params->type) *
+            MBEDTLS_LMOTS_N_HASH_LEN(params->type) );
 
     for ( i_digit_idx = 0;
           i_digit_idx < MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT(params->type);
           i_digit_idx++ )
     {
+        memcpy( msg[i_digit_idx], params->I_key_identifier,
+                MBEDTLS_LMOTS_I_KEY_ID_LEN );
+        memcpy( msg[i_digit_idx] + CHAIN_MSG_Q_LEAF_ID_OFFSET,
+                params->q_leaf_identifier, MBEDTLS_LMOTS_Q_LEAF_ID_LEN );
+        mbedtls_lms_unsigned_int_to_network_bytes( i_digit_idx,
+                                                   I_DIGIT_IDX_LEN,
+                                                   msg[i_digit_idx] +
+                                                   CHAIN_MSG_I_DIGIT_OFFSET );
+    }
 
-        memcpy( tmp_hash,
-                &x_digit_array[i_digit_idx * MBEDTLS_LMOTS_N_HASH_LEN(params->type)],
-                MBEDTLS_LMOTS_N_HASH_LEN(params->type) );
-
-        j_hash_idx_min = hash_idx_min_values != NULL ?
-                hash_idx_min_values[i_digit_idx] : 0;
-        j_hash_idx_max = hash_idx_max_values != NULL ?
-                hash_idx_max_values[i_digit_idx] : DIGIT_MAX_VALUE;
+    /* Advance all the chains in lockstep, so that each step hashes one
+     * message per chain that has not reached its end yet. */
+    for ( j_hash_idx = 0; j_hash_idx < DIGIT_MAX_VALUE; j_hash_idx++ )
+    {
+        count = 0;
 
-        for ( j_hash_idx = j_hash_idx_min;
-              j_hash_idx < j_hash_idx_max;
-              j_hash_idx++ )
+        for ( i_digit_idx = 0;
+              i_digit_idx < MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT(params->type);
+              i_digit_idx++ )
         {
-            status = psa_hash_setup( &op, PSA_ALG_SHA_256 );
-            if( status != PSA_SUCCESS )
-                goto exit;
-
-            status = psa_hash_update( &op,
-                                      params->I_key_identifier,
-                                      MBEDTLS_LMOTS_I_KEY_ID_LEN );
-            if( status != PSA_SUCCESS )
-                goto exit;
-
-            status = psa_hash_update( &op,
-                                      params->q_leaf_identifier,
-                                      MBEDTLS_LMOTS_Q_LEAF_ID_LEN );
-            if( status != PSA_SUCCESS )
-                goto exit;
-
-            mbedtls_lms_unsigned_int_to_network_bytes( i_digit_idx,
-                                                       I_DIGIT_IDX_LEN,
-                                                       i_digit_idx_bytes );
-            status = psa_hash_update( &op, i_digit_idx_bytes, I_DIGIT_IDX_LEN );
-            if( status != PSA_SUCCESS )
-                goto exit;
+            j_hash_idx_min = hash_idx_min_values != NULL ?
+                    hash_idx_min_values[i_digit_idx] : 0;
+            j_hash_idx_max = hash_idx_max_values != NULL ?
+                    hash_idx_max_values[i_digit_idx] : DIGIT_MAX_VALUE;
+
+            if( j_hash_idx < j_hash_idx_min || j_hash_idx >= j_hash_idx_max )
+                continue;
 
             mbedtls_lms_unsigned_int_to_network_bytes( j_hash_idx,
                                                        J_HASH_IDX_LEN,
-                                                       j_hash_idx_bytes );
-            status = psa_hash_update( &op, j_hash_idx_bytes, J_HASH_IDX_LEN );
-            if( status != PSA_SUCCESS )
-                goto exit;
-
-            status = psa_hash_update( &op, tmp_hash,
-                                      MBEDTLS_LMOTS_N_HASH_LEN(params->type) );
-            if( status != PSA_SUCCESS )
-                goto exit;
-
-            status = psa_hash_finish( &op, tmp_hash, sizeof( tmp_hash ),
-                                      &output_hash_len );
-            if( status != PSA_SUCCESS )
-                goto exit;
-
-            psa_hash_abort( &op );
+                                                       msg[i_digit_idx] +
+                                                       CHAIN_MSG_J_HASH_OFFSET );
+            memcpy( msg[i_digit_idx] + CHAIN_MSG_TMP_OFFSET,
+                    &output[i_digit_idx * MBEDTLS_LMOTS_N_HASH_LEN(params->type)],
+                    MBEDTLS_LMOTS_N_HASH_LEN(params->type) );
+
+            msg_ptrs[count] = msg[i_digit_idx];
+            msg_lens[count] = CHAIN_MSG_LEN(params->type);
+            out_ptrs[count] =
+                &output[i_digit_idx * MBEDTLS_LMOTS_N_HASH_LEN(params->type)];
+            count++;
         }
 
-        memcpy( &output[i_digit_idx * MBEDTLS_LMOTS_N_HASH_LEN(params->type)],
-                tmp_hash, MBEDTLS_LMOTS_N_HASH_LEN(params->type) );
+        if( count == 0 )
+            continue;
+
+        ret = mbedtls_lms_hash_multi( msg_ptrs, msg_lens, out_ptrs, count );
+        if( ret != 0 )
+            goto exit;
     }
 
+    ret = 0;
+
 exit:
-    psa_hash_abort( &op );
-    mbedtls_platform_zeroize( tmp_hash, sizeof( tmp_hash ) );
+    mbedtls_platform_zeroize( msg, sizeof( msg ) );
 
-    return( mbedtls_lms_error_from_psa( status ) );
+    return( ret );
 }
 
 /* Combine the hashes of the digit array into a public key. This is used in
@@ -374,6 +391,28 @@ exit:
     return( mbedtls_lms_error_from_psa( status ) );
 }
 
+int mbedtls_lms_hash_multi( const unsigned char * const input[],
+                            const size_t ilen[],
+                            unsigned char * const output[],
+                            size_t count )
+{
+#if defined(LMS_HASH_MULTI_USE_SHA256)
+    return( mbedtls_sha256_multi( input, ilen, output, count, 0 ) );
+#else
+    psa_status_t status = PSA_SUCCESS;
+    size_t output_hash_len;
+    size_t idx;
+
+    for( idx = 0; idx < count && status == PSA_SUCCESS; idx++ )
+    {
+        status = psa_hash_compute( PSA_ALG_SHA_256, input[idx], ilen[idx],
+                                   output[idx], 32, &output_hash_len );
+    }
+
+    return( mbedtls_lms_error_from_psa( status ) );
+#endif /* LMS_HASH_MULTI_USE_SHA256 */
+}
+
 int mbedtls_lms_error_from_psa( psa_status_t status )
 {
     switch( status )
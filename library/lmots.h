@@ -89,6 +89,31 @@ unsigned int mbedtls_lms_network_bytes_to_unsigned_int( size_t len,
  */
 int mbedtls_lms_error_from_psa( psa_status_t status );
 
+/**
+ * \brief                    This function calculates the SHA-256 hashes of
+ *                           several independent messages.
+ *
+ *                           If PSA uses the built-in SHA-256 implementation,
+ *                           this is done with mbedtls_sha256_multi(), which
+ *                           spreads the messages across SIMD lanes where the
+ *                           platform supports it. Otherwise, each message is
+ *                           hashed with psa_hash_compute().
+ *
+ * \param input              An array of \p count pointers to the messages.
+ * \param ilen               An array of \p count message lengths.
+ * \param output             An array of \p count pointers to 32-byte output
+ *                           buffers. An output buffer must not overlap any
+ *                           of the messages.
+ * \param count              The number of messages.
+ *
+ * \return                   \c 0 on success.
+ * \return                   A non-zero error code on failure.
+ */
+int mbedtls_lms_hash_multi( const unsigned char * const input[],
+                            const size_t ilen[],
+                            unsigned char * const output[],
+                            size_t count );
+
 
 /**
  * \brief                    This function initializes a public LMOTS context
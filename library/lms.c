@@ -46,6 +46,11 @@
 
 #include "mbedtls/platform.h"
 
+#if defined(MBEDTLS_LMS_KEYGEN_THREADS) && MBEDTLS_LMS_KEYGEN_THREADS > 1
+#include <pthread.h>
+#define LMS_KEYGEN_USE_THREADS
+#endif
+
 #define SIG_Q_LEAF_ID_OFFSET     (0)
 #define SIG_OTS_SIG_OFFSET       (SIG_Q_LEAF_ID_OFFSET + \
                                   MBEDTLS_LMOTS_Q_LEAF_ID_LEN)
@@ -74,6 +79,64 @@
 static const unsigned char D_LEAF_CONSTANT_BYTES[D_CONST_LEN] = {0x82, 0x82};
 static const unsigned char D_INTR_CONSTANT_BYTES[D_CONST_LEN] = {0x83, 0x83};
 
+/* Layout of the messages hashed to create Merkle tree nodes:
+ * I || u32str(r) || D_LEAF || OTS_PUB_HASH for a leaf node, and
+ * I || u32str(r) || D_INTR || left || right for an internal node. */
+#define R_NODE_IDX_LEN                 (4)
+#define MERKLE_MSG_R_NODE_IDX_OFFSET   (MBEDTLS_LMOTS_I_KEY_ID_LEN)
+#define MERKLE_MSG_D_CONST_OFFSET      (MERKLE_MSG_R_NODE_IDX_OFFSET + \
+                                        R_NODE_IDX_LEN)
+#define MERKLE_MSG_NODE_OFFSET         (MERKLE_MSG_D_CONST_OFFSET + D_CONST_LEN)
+#define MERKLE_LEAF_MSG_LEN(otstype)   (MERKLE_MSG_NODE_OFFSET + \
+                                        MBEDTLS_LMOTS_N_HASH_LEN(otstype))
+#define MERKLE_INTERNAL_MSG_LEN(type)  (MERKLE_MSG_NODE_OFFSET + \
+                                        2 * MBEDTLS_LMS_M_NODE_BYTES(type))
+#define MERKLE_MSG_LEN_MAX             (MERKLE_MSG_NODE_OFFSET + \
+                                        2 * MBEDTLS_LMS_M_NODE_BYTES_MAX)
+
+/* Number of Merkle tree nodes that are hashed together when calculating a
+ * whole tree. */
+#define MERKLE_TREE_BATCH_SIZE         (32)
+
+/* Write the message that is hashed to create a leaf node of the Merkle
+ * tree. See create_merkle_leaf_value() for the parameters. */
+static size_t merkle_leaf_message( const mbedtls_lms_parameters_t *params,
+                                   const unsigned char *pub_key,
+                                   unsigned int r_node_idx,
+                                   unsigned char *msg )
+{
+    memcpy( msg, params->I_key_identifier, MBEDTLS_LMOTS_I_KEY_ID_LEN );
+    mbedtls_lms_unsigned_int_to_network_bytes( r_node_idx, R_NODE_IDX_LEN,
+            msg + MERKLE_MSG_R_NODE_IDX_OFFSET );
+    memcpy( msg + MERKLE_MSG_D_CONST_OFFSET, D_LEAF_CONSTANT_BYTES,
+            D_CONST_LEN );
+    memcpy( msg + MERKLE_MSG_NODE_OFFSET, pub_key,
+            MBEDTLS_LMOTS_N_HASH_LEN(params->otstype) );
+
+    return( MERKLE_LEAF_MSG_LEN(params->otstype) );
+}
+
+/* Write the message that is hashed to create an internal node of the Merkle
+ * tree. See create_merkle_internal_value() for the parameters. */
+static size_t merkle_internal_message( const mbedtls_lms_parameters_t *params,
+                                       const unsigned char *left_node,
+                                       const unsigned char *right_node,
+                                       unsigned int r_node_idx,
+                                       unsigned char *msg )
+{
+    memcpy( msg, params->I_key_identifier, MBEDTLS_LMOTS_I_KEY_ID_LEN );
+    mbedtls_lms_unsigned_int_to_network_bytes( r_node_idx, R_NODE_IDX_LEN,
+            msg + MERKLE_MSG_R_NODE_IDX_OFFSET );
+    memcpy( msg + MERKLE_MSG_D_CONST_OFFSET, D_INTR_CONSTANT_BYTES,
+            D_CONST_LEN );
+    memcpy( msg + MERKLE_MSG_NODE_OFFSET, left_node,
+            MBEDTLS_LMS_M_NODE_BYTES(params->type) );
+    memcpy( msg + MERKLE_MSG_NODE_OFFSET + MBEDTLS_LMS_M_NODE_BYTES(params->type),
+            right_node, MBEDTLS_LMS_M_NODE_BYTES(params->type) );
+
+    return( MERKLE_INTERNAL_MSG_LEN(params->type) );
+}
+
 
 /* Calculate the value of a leaf node of the Merkle tree (which is a hash of a
  * public key and some other parameters like the leaf index). This function
@@ -98,44 +161,13 @@ static int create_merkle_leaf_value( const mbedtls_lms_parameters_t *params,
                                      unsigned int r_node_idx,
                                      unsigned char *out )
 {
-    psa_hash_operation_t op;
-    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-    size_t output_hash_len;
-    unsigned char r_node_idx_bytes[4];
-
-    op = psa_hash_operation_init( );
-    status = psa_hash_setup( &op, PSA_ALG_SHA_256 );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    status = psa_hash_update( &op, params->I_key_identifier,
-                              MBEDTLS_LMOTS_I_KEY_ID_LEN );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    mbedtls_lms_unsigned_int_to_network_bytes( r_node_idx, 4, r_node_idx_bytes );
-    status = psa_hash_update( &op, r_node_idx_bytes, 4 );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    status = psa_hash_update( &op, D_LEAF_CONSTANT_BYTES, D_CONST_LEN );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    status = psa_hash_update( &op, pub_key,
-                              MBEDTLS_LMOTS_N_HASH_LEN(params->otstype) );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    status = psa_hash_finish( &op, out, MBEDTLS_LMS_M_NODE_BYTES(params->type),
-                              &output_hash_len );
-    if( status != PSA_SUCCESS )
-        goto exit;
+    unsigned char msg[MERKLE_MSG_LEN_MAX];
+    const unsigned char *msg_ptr = msg;
+    size_t msg_len;
 
-exit:
-    psa_hash_abort( &op );
+    msg_len = merkle_leaf_message( params, pub_key, r_node_idx, msg );
 
-    return ( mbedtls_lms_error_from_psa( status ) );
+    return( mbedtls_lms_hash_multi( &msg_ptr, &msg_len, &out, 1 ) );
 }
 
 /* Calculate the value of an internal node of the Merkle tree (which is a hash
@@ -166,49 +198,14 @@ static int create_merkle_internal_value( const mbedtls_lms_parameters_t *params,
                                          unsigned int r_node_idx,
                                          unsigned char *out )
 {
-    psa_hash_operation_t op;
-    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-    size_t output_hash_len;
-    unsigned char r_node_idx_bytes[4];
-
-    op = psa_hash_operation_init( );
-    status = psa_hash_setup( &op, PSA_ALG_SHA_256 );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    status = psa_hash_update( &op, params->I_key_identifier,
-                              MBEDTLS_LMOTS_I_KEY_ID_LEN );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    mbedtls_lms_unsigned_int_to_network_bytes( r_node_idx, 4, r_node_idx_bytes );
-    status = psa_hash_update( &op, r_node_idx_bytes, 4 );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    status = psa_hash_update( &op, D_INTR_CONSTANT_BYTES, D_CONST_LEN );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-    status = psa_hash_update( &op, left_node,
-                              MBEDTLS_LMS_M_NODE_BYTES(params->type) );
-    if( status != PSA_SUCCESS )
-        goto exit;
+    unsigned char msg[MERKLE_MSG_LEN_MAX];
+    const unsigned char *msg_ptr = msg;
+    size_t msg_len;
 
-    status = psa_hash_update( &op, right_node,
-                              MBEDTLS_LMS_M_NODE_BYTES(params->type) );
-    if( status != PSA_SUCCESS )
-        goto exit;
+    msg_len = merkle_internal_message( params, left_node, right_node,
+                                       r_node_idx, msg );
 
-    status = psa_hash_finish( &op, out, MBEDTLS_LMS_M_NODE_BYTES(params->type),
-                           &output_hash_len );
-    if( status != PSA_SUCCESS )
-        goto exit;
-
-exit:
-    psa_hash_abort( &op );
-
-    return( mbedtls_lms_error_from_psa( status ) );
+    return( mbedtls_lms_hash_multi( &msg_ptr, &msg_len, &out, 1 ) );
 }
 
 void mbedtls_lms_public_init( mbedtls_lms_public_t *ctx )
@@ -381,11 +378,15 @@ int mbedtls_lms_verify( const mbedtls_lms_public_t *ctx,
         return( MBEDTLS_ERR_LMS_VERIFY_FAILED );
     }
 
-    create_merkle_leaf_value(
+    ret = create_merkle_leaf_value(
             &ctx->params,
             Kc_candidate_ots_pub_key,
             MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) + q_leaf_identifier,
             Tc_candidate_root_node );
+    if( ret != 0 )
+    {
+        return( MBEDTLS_ERR_LMS_VERIFY_FAILED );
+    }
 
     curr_node_id = MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) +
                    q_leaf_identifier;
@@ -409,8 +410,12 @@ int mbedtls_lms_verify( const mbedtls_lms_public_t *ctx,
                          height * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type);
         }
 
-        create_merkle_internal_value( &ctx->params, left_node, right_node,
-                                      parent_node_id, Tc_candidate_root_node);
+        ret = create_merkle_internal_value( &ctx->params, left_node, right_node,
+                                            parent_node_id, Tc_candidate_root_node );
+        if( ret != 0 )
+        {
+            return( MBEDTLS_ERR_LMS_VERIFY_FAILED );
+        }
 
         curr_node_id /= 2;
     }
@@ -426,90 +431,100 @@ int mbedtls_lms_verify( const mbedtls_lms_public_t *ctx,
 
 #if defined(MBEDTLS_LMS_PRIVATE)
 
-/* Calculate a full Merkle tree based on a private key. This function
- * implements RFC8554 section 5.3, and is used to generate a public key (as the
- * public key is the root node of the Merkle tree).
+#define PRIVATE_KEY_TYPE_OFFSET      (0)
+#define PRIVATE_KEY_OTSTYPE_OFFSET   (PRIVATE_KEY_TYPE_OFFSET + \
+                                      MBEDTLS_LMS_TYPE_LEN)
+#define PRIVATE_KEY_I_KEY_ID_OFFSET  (PRIVATE_KEY_OTSTYPE_OFFSET + \
+                                      MBEDTLS_LMOTS_TYPE_LEN)
+#define PRIVATE_KEY_Q_NEXT_OFFSET    (PRIVATE_KEY_I_KEY_ID_OFFSET + \
+                                      MBEDTLS_LMOTS_I_KEY_ID_LEN)
+#define PRIVATE_KEY_SEED_SIZE_OFFSET (PRIVATE_KEY_Q_NEXT_OFFSET + \
+                                      MBEDTLS_LMOTS_Q_LEAF_ID_LEN)
+#define PRIVATE_KEY_SEED_OFFSET      (PRIVATE_KEY_SEED_SIZE_OFFSET + \
+                                      MBEDTLS_LMS_SEED_SIZE_LEN)
+#define PRIVATE_KEY_TREE_OFFSET(seed_size) (PRIVATE_KEY_SEED_OFFSET + \
+                                            (seed_size))
+
+/* Calculate the internal nodes of a Merkle tree whose leaf nodes have already
+ * been calculated. This function implements RFC8554 section 5.3, and is used
+ * to generate a public key (as the public key is the root node of the Merkle
+ * tree).
  *
  *  ctx                 The LMS private context, containing a parameter
- *                      set and private key material consisting of both
- *                      public and private OTS.
+ *                      set and the I value of the key.
  *
- *  tree                The output tree, which is 2^(H + 1) hash outputs.
- *                      In the case of H=10 we have 2048 tree nodes (of
- *                      which 1024 of them are leaf nodes). Note that
- *                      because the Merkle tree root is 1-indexed, the 0
- *                      index tree node is never used.
+ *  tree                The tree, which is 2^(H + 1) hash outputs. In the
+ *                      case of H=10 we have 2048 tree nodes (of which 1024
+ *                      of them are leaf nodes). Note that because the
+ *                      Merkle tree root is 1-indexed, the 0 index tree
+ *                      node is never used.
  */
 static int calculate_merkle_tree( const mbedtls_lms_private_t *ctx,
                                   unsigned char *tree )
 {
-    unsigned int priv_key_idx;
+    unsigned char msg[MERKLE_TREE_BATCH_SIZE][MERKLE_MSG_LEN_MAX];
+    const unsigned char *msg_ptrs[MERKLE_TREE_BATCH_SIZE];
+    size_t msg_lens[MERKLE_TREE_BATCH_SIZE];
+    unsigned char *out_ptrs[MERKLE_TREE_BATCH_SIZE];
+    unsigned int level_first_idx;
     unsigned int r_node_idx;
+    size_t count;
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
-    /* First create the leaf nodes, in ascending order */
-    for( priv_key_idx = 0;
-         priv_key_idx < MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type);
-         priv_key_idx++ )
+    /* Work one level at a time from the leaves up, so that both children of a
+     * node are ready before the node is created. The nodes of a level don't
+     * depend on each other, so they are hashed in batches. */
+    for( level_first_idx = MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) / 2;
+         level_first_idx > 0;
+         level_first_idx /= 2 )
     {
-        r_node_idx = MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) + priv_key_idx;
+        r_node_idx = level_first_idx;
 
-        ret = create_merkle_leaf_value( &ctx->params,
-                ctx->ots_public_keys[priv_key_idx].public_key, r_node_idx,
-                &tree[r_node_idx * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)] );
-        if( ret != 0 )
+        while( r_node_idx < 2 * level_first_idx )
         {
-            return( ret );
-        }
-    }
+            for( count = 0;
+                 count < MERKLE_TREE_BATCH_SIZE && r_node_idx < 2 * level_first_idx;
+                 count++, r_node_idx++ )
+            {
+                msg_lens[count] = merkle_internal_message( &ctx->params,
+                        &tree[( r_node_idx * 2 ) * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)],
+                        &tree[( r_node_idx * 2 + 1 ) * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)],
+                        r_node_idx, msg[count] );
+
+                msg_ptrs[count] = msg[count];
+                out_ptrs[count] =
+                    &tree[r_node_idx * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)];
+            }
 
-    /* Then the internal nodes, in reverse order so that we can guarantee the
-     * parent has been created */
-    for( r_node_idx = MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) - 1;
-         r_node_idx > 0;
-         r_node_idx-- )
-    {
-        ret = create_merkle_internal_value( &ctx->params,
-                &tree[( r_node_idx * 2 ) * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)],
-                &tree[( r_node_idx * 2 + 1 ) * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)],
-                r_node_idx,
-                &tree[r_node_idx * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)] );
-        if( ret != 0 )
-        {
-            return( ret );
+            ret = mbedtls_lms_hash_multi( msg_ptrs, msg_lens, out_ptrs, count );
+            if( ret != 0 )
+            {
+                return( ret );
+            }
         }
     }
 
     return( 0 );
 }
 
-/* Calculate a path from a leaf node of the Merkle tree to the root of the tree,
- * and return the full path. This function implements RFC8554 section 5.4.1, as
- * the Merkle path is the main component of an LMS signature.
+/* Read a path from a leaf node of the Merkle tree to the root of the tree out
+ * of the tree cached in the private context. This function implements RFC8554
+ * section 5.4.1, as the Merkle path is the main component of an LMS signature.
  *
  *  ctx                 The LMS private context, containing a parameter
- *                      set and private key material consisting of both
- *                      public and private OTS.
+ *                      set and the Merkle tree.
  *
  *  leaf_node_id        Which leaf node to calculate the path from.
  *
  *  path                The output path, which is H hash outputs.
  */
-static int get_merkle_path( mbedtls_lms_private_t *ctx,
-                            unsigned int leaf_node_id,
-                            unsigned char *path )
+static void get_merkle_path( const mbedtls_lms_private_t *ctx,
+                             unsigned int leaf_node_id,
+                             unsigned char *path )
 {
-    unsigned char tree[MERKLE_TREE_NODE_AM_MAX][MBEDTLS_LMS_M_NODE_BYTES_MAX];
     unsigned int curr_node_id = leaf_node_id;
     unsigned int adjacent_node_id;
     unsigned int height;
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-
-    ret = calculate_merkle_tree( ctx, ( unsigned char * )tree );
-    if( ret != 0 )
-    {
-        goto exit;
-    }
 
     for( height = 0; height < MBEDTLS_LMS_H_TREE_HEIGHT(ctx->params.type);
          height++ )
@@ -517,18 +532,11 @@ static int get_merkle_path( mbedtls_lms_private_t *ctx,
         adjacent_node_id = curr_node_id ^ 1;
 
         memcpy( &path[height * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)],
-                &tree[adjacent_node_id],
+                &ctx->tree[adjacent_node_id * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)],
                 MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type) );
 
         curr_node_id >>=1;
     }
-
-    ret = 0;
-
-exit:
-    mbedtls_platform_zeroize( tree, sizeof( tree ) );
-
-    return( ret );
 }
 
 void mbedtls_lms_private_init( mbedtls_lms_private_t *ctx )
@@ -538,33 +546,161 @@ void mbedtls_lms_private_init( mbedtls_lms_private_t *ctx )
 
 void mbedtls_lms_private_free( mbedtls_lms_private_t *ctx )
 {
-    unsigned int idx;
+    if( ctx->seed != NULL )
+    {
+        mbedtls_platform_zeroize( ctx->seed, ctx->seed_size );
+        mbedtls_free( ctx->seed );
+    }
 
-    if( ctx->have_private_key )
+    if( ctx->tree != NULL )
     {
-        if( ctx->ots_private_keys != NULL )
-        {
-            for( idx = 0; idx < MERKLE_TREE_LEAF_NODE_AM(ctx->params.type); idx++ )
-            {
-                mbedtls_lmots_private_free( &ctx->ots_private_keys[idx] );
-            }
-        }
+        mbedtls_platform_zeroize( ctx->tree,
+                                  ( size_t )MERKLE_TREE_NODE_AM(ctx->params.type) *
+                                  MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type) );
+        mbedtls_free( ctx->tree );
+    }
 
-        if( ctx->ots_public_keys != NULL )
+    mbedtls_platform_zeroize( ctx, sizeof( *ctx ) );
+}
+
+/* Allocate the seed and tree buffers of a private context whose parameters
+ * have been set. */
+static int private_key_alloc( mbedtls_lms_private_t *ctx, size_t seed_size )
+{
+    if( seed_size > 0 )
+    {
+        ctx->seed = mbedtls_calloc( 1, seed_size );
+        if( ctx->seed == NULL )
         {
-        for( idx = 0; idx < MERKLE_TREE_LEAF_NODE_AM(ctx->params.type); idx++ )
-            {
-                mbedtls_lmots_public_free( &ctx->ots_public_keys[idx] );
-            }
+            return( MBEDTLS_ERR_LMS_ALLOC_FAILED );
         }
+    }
+    ctx->seed_size = seed_size;
 
-        mbedtls_free( ctx->ots_private_keys );
-        mbedtls_free( ctx->ots_public_keys );
+    /* Requires a cast to size_t to avoid an implicit cast warning on certain
+     * platforms (particularly Windows) */
+    ctx->tree = mbedtls_calloc( ( size_t )MERKLE_TREE_NODE_AM(ctx->params.type),
+                                MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type) );
+    if( ctx->tree == NULL )
+    {
+        return( MBEDTLS_ERR_LMS_ALLOC_FAILED );
     }
 
-    mbedtls_platform_zeroize( ctx, sizeof( *ctx ) );
+    return( 0 );
 }
 
+/* Derive the one-time private keys of the leaves first_idx to last_idx - 1
+ * from the seed, calculate the matching one-time public keys, and write the
+ * leaf nodes of the Merkle tree. */
+static int generate_ots_keys( mbedtls_lms_private_t *ctx,
+                              unsigned int first_idx, unsigned int last_idx )
+{
+    mbedtls_lmots_private_t ots_private_key;
+    mbedtls_lmots_public_t ots_public_key;
+    unsigned int idx;
+    int ret = 0;
+
+    mbedtls_lmots_private_init( &ots_private_key );
+    mbedtls_lmots_public_init( &ots_public_key );
+
+    for( idx = first_idx; idx < last_idx; idx++ )
+    {
+        ret = mbedtls_lmots_generate_private_key( &ots_private_key,
+                                                  ctx->params.otstype,
+                                                  ctx->params.I_key_identifier,
+                                                  idx, ctx->seed,
+                                                  ctx->seed_size );
+        if( ret != 0 )
+            goto exit;
+
+        ret = mbedtls_lmots_calculate_public_key( &ots_public_key,
+                                                  &ots_private_key );
+        if( ret != 0 )
+            goto exit;
+
+        ret = create_merkle_leaf_value( &ctx->params,
+                ots_public_key.public_key,
+                MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) + idx,
+                &ctx->tree[( MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) + idx ) *
+                           MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)] );
+        if( ret != 0 )
+            goto exit;
+
+        mbedtls_lmots_private_free( &ots_private_key );
+        mbedtls_lmots_public_free( &ots_public_key );
+    }
+
+exit:
+    mbedtls_lmots_private_free( &ots_private_key );
+    mbedtls_lmots_public_free( &ots_public_key );
+
+    return( ret );
+}
+
+#if defined(LMS_KEYGEN_USE_THREADS)
+typedef struct
+{
+    mbedtls_lms_private_t *ctx;
+    unsigned int first_idx;
+    unsigned int last_idx;
+    int ret;
+} lms_keygen_job_t;
+
+static void *lms_keygen_thread( void *param )
+{
+    lms_keygen_job_t *job = param;
+
+    job->ret = generate_ots_keys( job->ctx, job->first_idx, job->last_idx );
+
+    return( NULL );
+}
+
+/* Share the generation of the one-time keys between
+ * MBEDTLS_LMS_KEYGEN_THREADS threads, one of which is the calling thread.
+ * If a thread can't be created, its share of the leaves is generated in the
+ * calling thread instead. */
+static int generate_ots_keys_threaded( mbedtls_lms_private_t *ctx )
+{
+    pthread_t threads[MBEDTLS_LMS_KEYGEN_THREADS - 1];
+    int started[MBEDTLS_LMS_KEYGEN_THREADS - 1];
+    lms_keygen_job_t jobs[MBEDTLS_LMS_KEYGEN_THREADS];
+    unsigned int leaf_count = MERKLE_TREE_LEAF_NODE_AM(ctx->params.type);
+    unsigned int idx;
+
+    for( idx = 0; idx < MBEDTLS_LMS_KEYGEN_THREADS; idx++ )
+    {
+        jobs[idx].ctx = ctx;
+        jobs[idx].first_idx = leaf_count * idx / MBEDTLS_LMS_KEYGEN_THREADS;
+        jobs[idx].last_idx = leaf_count * ( idx + 1 ) /
+                             MBEDTLS_LMS_KEYGEN_THREADS;
+        jobs[idx].ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    }
+
+    for( idx = 0; idx < MBEDTLS_LMS_KEYGEN_THREADS - 1; idx++ )
+    {
+        started[idx] = pthread_create( &threads[idx], NULL,
+                                       lms_keygen_thread, &jobs[idx] ) == 0;
+        if( ! started[idx] )
+            lms_keygen_thread( &jobs[idx] );
+    }
+
+    lms_keygen_thread( &jobs[MBEDTLS_LMS_KEYGEN_THREADS - 1] );
+
+    for( idx = 0; idx < MBEDTLS_LMS_KEYGEN_THREADS - 1; idx++ )
+    {
+        if( started[idx] )
+            (void) pthread_join( threads[idx], NULL );
+    }
+
+    for( idx = 0; idx < MBEDTLS_LMS_KEYGEN_THREADS; idx++ )
+    {
+        if( jobs[idx].ret != 0 )
+            return( jobs[idx].ret );
+    }
+
+    return( 0 );
+}
+#endif /* LMS_KEYGEN_USE_THREADS */
 
 int mbedtls_lms_generate_private_key( mbedtls_lms_private_t *ctx,
                                       mbedtls_lms_algorithm_type_t type,
@@ -573,7 +709,6 @@ int mbedtls_lms_generate_private_key( mbedtls_lms_private_t *ctx,
                                       void* p_rng, const unsigned char *seed,
                                       size_t seed_size )
 {
-    unsigned int idx = 0;
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
     if( type != MBEDTLS_LMS_SHA256_M32_H10 )
@@ -586,6 +721,11 @@ int mbedtls_lms_generate_private_key( mbedtls_lms_private_t *ctx,
         return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
     }
 
+    if( seed_size > MBEDTLS_LMS_SEED_SIZE_MAX )
+    {
+        return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+    }
+
     if( ctx->have_private_key )
     {
         return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
@@ -603,47 +743,28 @@ int mbedtls_lms_generate_private_key( mbedtls_lms_private_t *ctx,
         goto exit;
     }
 
-    /* Requires a cast to size_t to avoid an implicit cast warning on certain
-     * platforms (particularly Windows) */
-    ctx->ots_private_keys = mbedtls_calloc( ( size_t )MERKLE_TREE_LEAF_NODE_AM(ctx->params.type),
-                                            sizeof( *ctx->ots_private_keys ) );
-    if( ctx->ots_private_keys == NULL )
-    {
-        ret = MBEDTLS_ERR_LMS_ALLOC_FAILED;
-        goto exit;
-    }
-
-    /* Requires a cast to size_t to avoid an implicit cast warning on certain
-     * platforms (particularly Windows) */
-    ctx->ots_public_keys = mbedtls_calloc( ( size_t )MERKLE_TREE_LEAF_NODE_AM(ctx->params.type),
-                                           sizeof( *ctx->ots_public_keys ) );
-    if( ctx->ots_public_keys == NULL )
+    ret = private_key_alloc( ctx, seed_size );
+    if( ret != 0 )
     {
-        ret = MBEDTLS_ERR_LMS_ALLOC_FAILED;
         goto exit;
     }
 
-    for( idx = 0; idx < MERKLE_TREE_LEAF_NODE_AM(ctx->params.type); idx++ )
+    if( seed_size > 0 )
     {
-        mbedtls_lmots_private_init( &ctx->ots_private_keys[idx] );
-        mbedtls_lmots_public_init( &ctx->ots_public_keys[idx] );
+        memcpy( ctx->seed, seed, seed_size );
     }
 
+#if defined(LMS_KEYGEN_USE_THREADS)
+    ret = generate_ots_keys_threaded( ctx );
+#else
+    ret = generate_ots_keys( ctx, 0, MERKLE_TREE_LEAF_NODE_AM(ctx->params.type) );
+#endif
+    if( ret != 0 )
+        goto exit;
 
-    for( idx = 0; idx < MERKLE_TREE_LEAF_NODE_AM(ctx->params.type); idx++ )
-    {
-        ret = mbedtls_lmots_generate_private_key( &ctx->ots_private_keys[idx],
-                                                  otstype,
-                                                  ctx->params.I_key_identifier,
-                                                  idx, seed, seed_size );
-        if( ret != 0 )
-            goto exit;
-
-        ret = mbedtls_lmots_calculate_public_key( &ctx->ots_public_keys[idx],
-                                                  &ctx->ots_private_keys[idx] );
-        if( ret != 0 )
-            goto exit;
-    }
+    ret = calculate_merkle_tree( ctx, ctx->tree );
+    if( ret != 0 )
+        goto exit;
 
     ctx->q_next_usable_key = 0;
 
@@ -659,9 +780,6 @@ exit:
 int mbedtls_lms_calculate_public_key( mbedtls_lms_public_t *ctx,
                                       const mbedtls_lms_private_t *priv_ctx )
 {
-    unsigned char tree[MERKLE_TREE_NODE_AM_MAX][MBEDTLS_LMS_M_NODE_BYTES_MAX];
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-
     if( ! priv_ctx->have_private_key )
     {
         return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
@@ -682,24 +800,14 @@ int mbedtls_lms_calculate_public_key( mbedtls_lms_public_t *ctx,
     memcpy( &ctx->params, &priv_ctx->params,
             sizeof( mbedtls_lmots_parameters_t ) );
 
-    ret = calculate_merkle_tree( priv_ctx, ( unsigned char * )tree );
-    if( ret != 0 )
-    {
-        goto exit;
-    }
-
     /* Root node is always at position 1, due to 1-based indexing */
-    memcpy( ctx->T_1_pub_key, &tree[1],
+    memcpy( ctx->T_1_pub_key,
+            &priv_ctx->tree[1 * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)],
             MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type) );
 
     ctx->have_public_key = 1;
 
-    ret = 0;
-
-exit:
-    mbedtls_platform_zeroize( tree, sizeof( tree ) );
-
-    return( ret );
+    return( 0 );
 }
 
 
@@ -710,6 +818,7 @@ int mbedtls_lms_sign( mbedtls_lms_private_t *ctx,
                       size_t *sig_len )
 {
     uint32_t q_leaf_identifier;
+    mbedtls_lmots_private_t ots_private_key;
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
     if( ! ctx->have_private_key )
@@ -751,14 +860,28 @@ int mbedtls_lms_sign( mbedtls_lms_private_t *ctx,
         return ( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
     }
 
-    ret = mbedtls_lmots_sign( &ctx->ots_private_keys[q_leaf_identifier],
+    /* The one-time private key is derived from the seed when it is needed,
+     * and is erased by mbedtls_lmots_sign() once it has been used. */
+    mbedtls_lmots_private_init( &ots_private_key );
+
+    ret = mbedtls_lmots_generate_private_key( &ots_private_key,
+                                              ctx->params.otstype,
+                                              ctx->params.I_key_identifier,
+                                              q_leaf_identifier,
+                                              ctx->seed, ctx->seed_size );
+    if( ret != 0 )
+    {
+        goto exit;
+    }
+
+    ret = mbedtls_lmots_sign( &ots_private_key,
                               f_rng, p_rng, msg, msg_size,
                               sig + SIG_OTS_SIG_OFFSET,
                               MBEDTLS_LMS_SIG_LEN(ctx->params.type, ctx->params.otstype) - SIG_OTS_SIG_OFFSET,
                               NULL );
     if( ret != 0 )
     {
-        return( ret );
+        goto exit;
     }
 
     mbedtls_lms_unsigned_int_to_network_bytes( ctx->params.type,
@@ -768,21 +891,201 @@ int mbedtls_lms_sign( mbedtls_lms_private_t *ctx,
             MBEDTLS_LMOTS_Q_LEAF_ID_LEN,
             sig + SIG_Q_LEAF_ID_OFFSET );
 
-    ret = get_merkle_path( ctx,
+    get_merkle_path( ctx,
             MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) + q_leaf_identifier,
             sig + SIG_PATH_OFFSET(ctx->params.otstype) );
+
+    if( sig_len != NULL )
+    {
+        *sig_len = MBEDTLS_LMS_SIG_LEN(ctx->params.type, ctx->params.otstype);
+    }
+
+    ret = 0;
+
+exit:
+    mbedtls_lmots_private_free( &ots_private_key );
+
+    return( ret );
+}
+
+int mbedtls_lms_export_private_key( const mbedtls_lms_private_t *ctx,
+                                    unsigned char *key, size_t key_size,
+                                    size_t *key_len )
+{
+    if( ! ctx->have_private_key )
+    {
+        return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+    }
+
+    if( key_size < MBEDTLS_LMS_PRIVATE_KEY_LEN(ctx->params.type,
+                                               ctx->seed_size) )
+    {
+        return( MBEDTLS_ERR_LMS_BUFFER_TOO_SMALL );
+    }
+
+    mbedtls_lms_unsigned_int_to_network_bytes( ctx->params.type,
+            MBEDTLS_LMS_TYPE_LEN, key + PRIVATE_KEY_TYPE_OFFSET );
+    mbedtls_lms_unsigned_int_to_network_bytes( ctx->params.otstype,
+            MBEDTLS_LMOTS_TYPE_LEN, key + PRIVATE_KEY_OTSTYPE_OFFSET );
+    memcpy( key + PRIVATE_KEY_I_KEY_ID_OFFSET,
+            ctx->params.I_key_identifier,
+            MBEDTLS_LMOTS_I_KEY_ID_LEN );
+    mbedtls_lms_unsigned_int_to_network_bytes( ctx->q_next_usable_key,
+            MBEDTLS_LMOTS_Q_LEAF_ID_LEN, key + PRIVATE_KEY_Q_NEXT_OFFSET );
+    mbedtls_lms_unsigned_int_to_network_bytes( ( unsigned int )ctx->seed_size,
+            MBEDTLS_LMS_SEED_SIZE_LEN, key + PRIVATE_KEY_SEED_SIZE_OFFSET );
+    if( ctx->seed_size > 0 )
+    {
+        memcpy( key + PRIVATE_KEY_SEED_OFFSET, ctx->seed, ctx->seed_size );
+    }
+
+    /* Node 0 of the tree is unused, so it is not exported. */
+    memcpy( key + PRIVATE_KEY_TREE_OFFSET(ctx->seed_size),
+            &ctx->tree[1 * MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type)],
+            MBEDTLS_LMS_TREE_NODE_COUNT(ctx->params.type) *
+            MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type) );
+
+    if( key_len != NULL )
+    {
+        *key_len = MBEDTLS_LMS_PRIVATE_KEY_LEN(ctx->params.type,
+                                               ctx->seed_size);
+    }
+
+    return( 0 );
+}
+
+int mbedtls_lms_import_private_key( mbedtls_lms_private_t *ctx,
+                                    const unsigned char *key, size_t key_size )
+{
+    mbedtls_lms_private_t imported;
+    mbedtls_lms_algorithm_type_t type;
+    mbedtls_lmots_algorithm_type_t otstype;
+    uint32_t q_next_usable_key;
+    size_t seed_size;
+    const unsigned char *tree;
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( key_size < PRIVATE_KEY_SEED_OFFSET )
+    {
+        return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+    }
+
+    type = mbedtls_lms_network_bytes_to_unsigned_int( MBEDTLS_LMS_TYPE_LEN,
+            key + PRIVATE_KEY_TYPE_OFFSET );
+    if( type != MBEDTLS_LMS_SHA256_M32_H10 )
+    {
+        return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+    }
+
+    otstype = mbedtls_lms_network_bytes_to_unsigned_int( MBEDTLS_LMOTS_TYPE_LEN,
+            key + PRIVATE_KEY_OTSTYPE_OFFSET );
+    if( otstype != MBEDTLS_LMOTS_SHA256_N32_W8 )
+    {
+        return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+    }
+
+    /* A key whose private keys have all been used can still be imported, but
+     * signing with it fails. */
+    q_next_usable_key = mbedtls_lms_network_bytes_to_unsigned_int(
+            MBEDTLS_LMOTS_Q_LEAF_ID_LEN, key + PRIVATE_KEY_Q_NEXT_OFFSET );
+    if( q_next_usable_key > MERKLE_TREE_LEAF_NODE_AM(type) )
+    {
+        return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+    }
+
+    seed_size = mbedtls_lms_network_bytes_to_unsigned_int(
+            MBEDTLS_LMS_SEED_SIZE_LEN, key + PRIVATE_KEY_SEED_SIZE_OFFSET );
+    if( key_size != MBEDTLS_LMS_PRIVATE_KEY_LEN(type, seed_size) )
+    {
+        return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+    }
+
+    tree = key + PRIVATE_KEY_TREE_OFFSET(seed_size);
+
+    /* Reloading the state of the key that is already in the context must not
+     * go back to a one-time key that the context has used. */
+    if( ctx->have_private_key )
+    {
+        if( type != ctx->params.type ||
+            otstype != ctx->params.otstype ||
+            memcmp( key + PRIVATE_KEY_I_KEY_ID_OFFSET,
+                    ctx->params.I_key_identifier,
+                    MBEDTLS_LMOTS_I_KEY_ID_LEN ) != 0 ||
+            memcmp( tree, &ctx->tree[1 * MBEDTLS_LMS_M_NODE_BYTES(type)],
+                    MBEDTLS_LMS_M_NODE_BYTES(type) ) != 0 )
+        {
+            return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+        }
+
+        if( q_next_usable_key < ctx->q_next_usable_key )
+        {
+            return( MBEDTLS_ERR_LMS_BAD_INPUT_DATA );
+        }
+    }
+
+    mbedtls_lms_private_init( &imported );
+
+    imported.params.type = type;
+    imported.params.otstype = otstype;
+    memcpy( imported.params.I_key_identifier,
+            key + PRIVATE_KEY_I_KEY_ID_OFFSET,
+            MBEDTLS_LMOTS_I_KEY_ID_LEN );
+    imported.q_next_usable_key = q_next_usable_key;
+
+    ret = private_key_alloc( &imported, seed_size );
     if( ret != 0 )
     {
-        return( ret );
+        goto exit;
     }
 
-    if( sig_len != NULL )
+    if( seed_size > 0 )
     {
-        *sig_len = MBEDTLS_LMS_SIG_LEN(ctx->params.type, ctx->params.otstype);
+        memcpy( imported.seed, key + PRIVATE_KEY_SEED_OFFSET, seed_size );
     }
 
+    memcpy( &imported.tree[1 * MBEDTLS_LMS_M_NODE_BYTES(type)], tree,
+            MBEDTLS_LMS_TREE_NODE_COUNT(type) *
+            MBEDTLS_LMS_M_NODE_BYTES(type) );
+
+    /* Check the state before trusting it: derive the leaf of the next usable
+     * key from the seed, then recalculate the internal nodes up to the root,
+     * which is the public key. Any difference with the stored nodes means
+     * that the state is corrupted. */
+    if( q_next_usable_key < MERKLE_TREE_LEAF_NODE_AM(type) )
+    {
+        ret = generate_ots_keys( &imported, q_next_usable_key,
+                                 q_next_usable_key + 1 );
+        if( ret != 0 )
+        {
+            goto exit;
+        }
+    }
+
+    ret = calculate_merkle_tree( &imported, imported.tree );
+    if( ret != 0 )
+    {
+        goto exit;
+    }
+
+    if( memcmp( &imported.tree[1 * MBEDTLS_LMS_M_NODE_BYTES(type)], tree,
+                MBEDTLS_LMS_TREE_NODE_COUNT(type) *
+                MBEDTLS_LMS_M_NODE_BYTES(type) ) != 0 )
+    {
+        ret = MBEDTLS_ERR_LMS_BAD_INPUT_DATA;
+        goto exit;
+    }
+
+    imported.have_private_key = 1;
+
+    mbedtls_lms_private_free( ctx );
+    *ctx = imported;
 
     return( 0 );
+
+exit:
+    mbedtls_lms_private_free( &imported );
+
+    return( ret );
 }
 
 #endif /* defined(MBEDTLS_LMS_PRIVATE) */
@@ -39,6 +39,15 @@
 
 #define POLY1305_BLOCK_SIZE_BYTES ( 16U )
 
+/*
+ * On 64-bit platforms with a 64x64->128-bit multiplier, the blocks are
+ * processed with 44-bit limbs, four at a time.
+ */
+#if defined(__GNUC__) && !defined(MBEDTLS_NO_64BIT_MULTIPLICATION) && \
+    ( defined(__amd64__) || defined(__x86_64__) || defined(__aarch64__) )
+#define POLY1305_USE_64BIT_LIMBS
+#endif
+
 /*
  * Our implementation is tuned for 32-bit platforms with a 64-bit multiplier.
  * However we provided an alternative for platforms without such a multiplier.
@@ -67,6 +76,213 @@ static inline uint64_t mul64( uint32_t a, uint32_t b )
 #endif
 
 
+#if defined(POLY1305_USE_64BIT_LIMBS)
+/*
+ * 64-bit implementation.
+ *
+ * Numbers modulo 2^130 - 5 are represented with three limbs h0, h1, h2 of
+ * 44, 44 and 42 bits. Since 2^132 = 20 mod 2^130 - 5, the cross products
+ * that overflow 2^130 are folded back by multiplying the limbs of r by 20.
+ *
+ * Four blocks m1..m4 are processed at once as
+ *     acc = ( acc + m1 ) * r^4 + m2 * r^3 + m3 * r^2 + m4 * r
+ * which sums the four products before a single carry propagation, and
+ * lets the multiplications proceed in parallel.
+ */
+typedef unsigned int poly1305_uint128 __attribute__((mode(TI)));
+
+#define POLY1305_MASK44 ( ( (uint64_t) 1 << 44 ) - 1 )
+#define POLY1305_MASK42 ( ( (uint64_t) 1 << 42 ) - 1 )
+
+/**
+ * \brief                   Accumulate the product of two numbers.
+ *
+ * \param d                 The unreduced 3-limb sum, d += a * b.
+ * \param a                 The first factor, with limbs of at most 45 bits.
+ * \param b                 The second factor, a power of r.
+ */
+static inline void poly1305_mac_44( poly1305_uint128 d[3],
+                                    const uint64_t a[3],
+                                    const uint64_t b[3] )
+{
+    const uint64_t s1 = b[1] * 20U;
+    const uint64_t s2 = b[2] * 20U;
+
+    d[0] += (poly1305_uint128) a[0] * b[0] +
+            (poly1305_uint128) a[1] * s2 +
+            (poly1305_uint128) a[2] * s1;
+    d[1] += (poly1305_uint128) a[0] * b[1] +
+            (poly1305_uint128) a[1] * b[0] +
+            (poly1305_uint128) a[2] * s2;
+    d[2] += (poly1305_uint128) a[0] * b[2] +
+            (poly1305_uint128) a[1] * b[1] +
+            (poly1305_uint128) a[2] * b[0];
+}
+
+/**
+ * \brief                   Propagate the carries of a sum of products.
+ *
+ * \param h                 The result, partially reduced: h0 and h2 fit
+ *                          in 44 and 42 bits, h1 may exceed 44 bits by
+ *                          a small carry.
+ * \param d                 The sum from poly1305_mac_44().
+ */
+static inline void poly1305_carry_44( uint64_t h[3],
+                                      const poly1305_uint128 d[3] )
+{
+    poly1305_uint128 t;
+    uint64_t c;
+
+    h[0] = (uint64_t) d[0] & POLY1305_MASK44;
+    t = d[1] + (uint64_t) ( d[0] >> 44 );
+    h[1] = (uint64_t) t & POLY1305_MASK44;
+    t = d[2] + (uint64_t) ( t >> 44 );
+    h[2] = (uint64_t) t & POLY1305_MASK42;
+    c = (uint64_t) ( t >> 42 );
+
+    h[0] += c * 5U;
+    h[1] += h[0] >> 44;
+    h[0] &= POLY1305_MASK44;
+}
+
+/**
+ * \brief                   Load a block as a 3-limb number.
+ *
+ * \param m                 The limbs of the block.
+ * \param input             The 16-byte block.
+ * \param pad               The padding bit (2^128) to add, 0 or 1.
+ */
+static inline void poly1305_load_44( uint64_t m[3],
+                                     const unsigned char *input,
+                                     uint64_t pad )
+{
+    const uint64_t t0 = MBEDTLS_GET_UINT64_LE( input, 0 );
+    const uint64_t t1 = MBEDTLS_GET_UINT64_LE( input, 8 );
+
+    m[0] = t0 & POLY1305_MASK44;
+    m[1] = ( ( t0 >> 44 ) | ( t1 << 20 ) ) & POLY1305_MASK44;
+    m[2] = ( t1 >> 24 ) | ( pad << 40 );
+}
+
+/**
+ * \brief                   Compute r^1 to r^4 for poly1305_process().
+ *
+ * \param ctx               The Poly1305 context, with r set.
+ */
+static void poly1305_compute_r_powers( mbedtls_poly1305_context *ctx )
+{
+    poly1305_uint128 d[3];
+    const uint64_t t0 = (uint64_t) ctx->r[0] | (uint64_t) ctx->r[1] << 32;
+    const uint64_t t1 = (uint64_t) ctx->r[2] | (uint64_t) ctx->r[3] << 32;
+    size_t i;
+
+    ctx->r_pow[0][0] = t0 & POLY1305_MASK44;
+    ctx->r_pow[0][1] = ( ( t0 >> 44 ) | ( t1 << 20 ) ) & POLY1305_MASK44;
+    ctx->r_pow[0][2] = t1 >> 24;
+
+    for( i = 1U; i < 4U; i++ )
+    {
+        d[0] = d[1] = d[2] = 0U;
+        poly1305_mac_44( d, ctx->r_pow[i - 1], ctx->r_pow[0] );
+        poly1305_carry_44( ctx->r_pow[i], d );
+    }
+
+    mbedtls_platform_zeroize( d, sizeof( d ) );
+}
+
+/**
+ * \brief                   Process blocks with Poly1305.
+ *
+ * \param ctx               The Poly1305 context.
+ * \param nblocks           Number of blocks to process. Note that this
+ *                          function only processes full blocks.
+ * \param input             Buffer containing the input block(s).
+ * \param needs_padding     Set to 0 if the padding bit has already been
+ *                          applied to the input data before calling this
+ *                          function.  Otherwise, set this parameter to 1.
+ */
+static void poly1305_process( mbedtls_poly1305_context *ctx,
+                              size_t nblocks,
+                              const unsigned char *input,
+                              uint32_t needs_padding )
+{
+    poly1305_uint128 d[3];
+    uint64_t h[3], m[3];
+    uint64_t t0, t1, c;
+    size_t offset = 0U;
+
+    /* Convert the accumulator to 44-bit limbs */
+    t0 = (uint64_t) ctx->acc[0] | (uint64_t) ctx->acc[1] << 32;
+    t1 = (uint64_t) ctx->acc[2] | (uint64_t) ctx->acc[3] << 32;
+    h[0] = t0 & POLY1305_MASK44;
+    h[1] = ( ( t0 >> 44 ) | ( t1 << 20 ) ) & POLY1305_MASK44;
+    h[2] = ( t1 >> 24 ) | ( (uint64_t) ctx->acc[4] << 40 );
+
+    /* Process 4 blocks at a time */
+    for( ; nblocks >= 4U; nblocks -= 4U )
+    {
+        poly1305_load_44( m, input + offset, needs_padding );
+        h[0] += m[0];
+        h[1] += m[1];
+        h[2] += m[2];
+
+        d[0] = d[1] = d[2] = 0U;
+        poly1305_mac_44( d, h, ctx->r_pow[3] );
+        poly1305_load_44( m, input + offset + 16U, needs_padding );
+        poly1305_mac_44( d, m, ctx->r_pow[2] );
+        poly1305_load_44( m, input + offset + 32U, needs_padding );
+        poly1305_mac_44( d, m, ctx->r_pow[1] );
+        poly1305_load_44( m, input + offset + 48U, needs_padding );
+        poly1305_mac_44( d, m, ctx->r_pow[0] );
+        poly1305_carry_44( h, d );
+
+        offset += 4U * POLY1305_BLOCK_SIZE_BYTES;
+    }
+
+    /* Process the remaining blocks */
+    for( ; nblocks > 0U; nblocks-- )
+    {
+        poly1305_load_44( m, input + offset, needs_padding );
+        h[0] += m[0];
+        h[1] += m[1];
+        h[2] += m[2];
+
+        d[0] = d[1] = d[2] = 0U;
+        poly1305_mac_44( d, h, ctx->r_pow[0] );
+        poly1305_carry_44( h, d );
+
+        offset += POLY1305_BLOCK_SIZE_BYTES;
+    }
+
+    /* Carry fully so that the accumulator is less than 2^130 + 2^44,
+     * as poly1305_compute_mac() expects */
+    c = h[1] >> 44;
+    h[1] &= POLY1305_MASK44;
+    h[2] += c;
+    c = h[2] >> 42;
+    h[2] &= POLY1305_MASK42;
+    h[0] += c * 5U;
+    c = h[0] >> 44;
+    h[0] &= POLY1305_MASK44;
+    h[1] += c;
+    c = h[1] >> 44;
+    h[1] &= POLY1305_MASK44;
+    h[2] += c;
+
+    /* Convert back to 32-bit limbs */
+    ctx->acc[0] = (uint32_t) h[0];
+    ctx->acc[1] = (uint32_t) ( ( h[0] >> 32 ) | ( h[1] << 12 ) );
+    ctx->acc[2] = (uint32_t) ( ( h[1] >> 20 ) | ( h[2] << 24 ) );
+    ctx->acc[3] = (uint32_t) ( h[2] >> 8 );
+    ctx->acc[4] = (uint32_t) ( h[2] >> 40 );
+
+    mbedtls_platform_zeroize( d, sizeof( d ) );
+    mbedtls_platform_zeroize( h, sizeof( h ) );
+    mbedtls_platform_zeroize( m, sizeof( m ) );
+}
+
+#else /* POLY1305_USE_64BIT_LIMBS */
+
 /**
  * \brief                   Process blocks with Poly1305.
  *
@@ -179,6 +395,8 @@ static void poly1305_process( mbedtls_poly1305_context *ctx,
     ctx->acc[4] = acc4;
 }
 
+#endif /* POLY1305_USE_64BIT_LIMBS */
+
 /**
  * \brief                   Compute the Poly1305 MAC
  *
@@ -270,6 +488,10 @@ int mbedtls_poly1305_starts( mbedtls_poly1305_context *ctx,
     ctx->s[2] = MBEDTLS_GET_UINT32_LE( key, 24 );
     ctx->s[3] = MBEDTLS_GET_UINT32_LE( key, 28 );
 
+#if defined(POLY1305_USE_64BIT_LIMBS)
+    poly1305_compute_r_powers( ctx );
+#endif
+
     /* Initial accumulator state */
     ctx->acc[0] = 0U;
     ctx->acc[1] = 0U;
@@ -113,7 +113,8 @@ typedef struct
 
 static psa_global_data_t global_data;
 
-#if !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
+#if !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG) && \
+    !defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
 mbedtls_psa_drbg_context_t *const mbedtls_psa_random_state =
     &global_data.rng.drbg;
 #endif
@@ -970,8 +971,36 @@ static psa_status_t psa_get_and_lock_transparent_key_slot_with_policy(
     return( PSA_SUCCESS );
 }
 
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+/** Free the parsed form of the key data cached in a slot, if any. */
+static void psa_free_key_representation( psa_key_slot_t *slot )
+{
+    void *representation = slot->cache.representation;
+
+    if( representation == NULL )
+        return;
+
+#if defined(MBEDTLS_RSA_C)
+    if( PSA_KEY_TYPE_IS_RSA( slot->attr.type ) )
+        mbedtls_rsa_free( representation );
+#endif
+#if defined(MBEDTLS_ECP_C)
+    if( PSA_KEY_TYPE_IS_ECC( slot->attr.type ) )
+        mbedtls_ecp_keypair_free( representation );
+#endif
+    mbedtls_free( representation );
+
+    slot->cache.representation = NULL;
+    slot->cache.in_use = 0;
+}
+#endif /* MBEDTLS_PSA_KEY_REPRESENTATION_CACHE */
+
 psa_status_t psa_remove_key_data_from_memory( psa_key_slot_t *slot )
 {
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+    psa_free_key_representation( slot );
+#endif
+
     /* Data pointer will always be either a valid pointer or NULL in an
      * initialized slot, so we can just free it. */
     if( slot->key.data != NULL )
@@ -989,6 +1018,7 @@ psa_status_t psa_remove_key_data_from_memory( psa_key_slot_t *slot )
 psa_status_t psa_wipe_key_slot( psa_key_slot_t *slot )
 {
     psa_status_t status = psa_remove_key_data_from_memory( slot );
+    struct key_slot_links links;
 
    /*
     * As the return error code may not be handled in case of multiple errors,
@@ -1011,8 +1041,13 @@ psa_status_t psa_wipe_key_slot( psa_key_slot_t *slot )
      * key material can linger until all operations are completed. */
     /* At this point, key material and other type-specific content has
      * been wiped. Clear remaining metadata. We can call memset and not
-     * zeroize because the metadata is not particularly sensitive. */
+     * zeroize because the metadata is not particularly sensitive.
+     * The slot manager's bookkeeping is kept: the slot is just
+     * returned to the pool of free slots. */
+    psa_unregister_key_slot( slot );
+    links = slot->links;
     memset( slot, 0, sizeof( *slot ) );
+    slot->links = links;
     return( status );
 }
 
@@ -1021,6 +1056,8 @@ psa_status_t psa_destroy_key( mbedtls_svc_key_id_t key )
     psa_key_slot_t *slot;
     psa_status_t status; /* status of the last operation */
     psa_status_t overall_status = PSA_SUCCESS;
+    psa_status_t lock_status;
+    int use_storage;
 #if defined(MBEDTLS_PSA_CRYPTO_SE_C)
     psa_se_drv_table_entry_t *driver;
 #endif /* MBEDTLS_PSA_CRYPTO_SE_C */
@@ -1039,6 +1076,31 @@ psa_status_t psa_destroy_key( mbedtls_svc_key_id_t key )
     if( status != PSA_SUCCESS )
         return( status );
 
+    /*
+     * Hold the key storage mutex until the key is destroyed in storage, so
+     * that no other thread can load it again in the meantime.
+     */
+    use_storage = ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) ||
+                  psa_key_lifetime_is_external( slot->attr.lifetime );
+    if( use_storage )
+    {
+        status = psa_key_storage_mutex_lock( );
+        if( status != PSA_SUCCESS )
+        {
+            psa_unlock_key_slot( slot );
+            return( status );
+        }
+    }
+
+    status = psa_key_slot_mutex_lock( );
+    if( status != PSA_SUCCESS )
+    {
+        if( use_storage )
+            (void) psa_key_storage_mutex_unlock( );
+        psa_unlock_key_slot( slot );
+        return( status );
+    }
+
     /*
      * If the key slot containing the key description is under access by the
      * library (apart from the present access), the key cannot be destroyed
@@ -1048,10 +1110,24 @@ psa_status_t psa_destroy_key( mbedtls_svc_key_id_t key )
      */
     if( slot->lock_count > 1 )
     {
+       (void) psa_key_slot_mutex_unlock( );
+       if( use_storage )
+           (void) psa_key_storage_mutex_unlock( );
        psa_unlock_key_slot( slot );
        return( PSA_ERROR_GENERIC_ERROR );
     }
 
+    /*
+     * Make the key unfindable, then release the key slot mutex while the
+     * key is destroyed in storage. No other thread can lock the slot any
+     * longer, and a thread that looks the key up tries to load it from
+     * storage, which waits for the storage mutex.
+     */
+    psa_unindex_key_slot( slot );
+    overall_status = psa_key_slot_mutex_unlock( );
+    if( overall_status != PSA_SUCCESS )
+        goto exit;
+
     if( PSA_KEY_LIFETIME_IS_READ_ONLY( slot->attr.lifetime ) )
     {
         /* Refuse the destruction of a read-only key (which may or may not work
@@ -1125,10 +1201,23 @@ psa_status_t psa_destroy_key( mbedtls_svc_key_id_t key )
 #endif /* MBEDTLS_PSA_CRYPTO_SE_C */
 
 exit:
+    /* Wipe the slot even if the mutex cannot be taken: it is not findable,
+     * so no other thread can reach it. */
+    lock_status = psa_key_slot_mutex_lock( );
     status = psa_wipe_key_slot( slot );
     /* Prioritize CORRUPTION_DETECTED from wiping over a storage error */
     if( status != PSA_SUCCESS )
         overall_status = status;
+    if( lock_status == PSA_SUCCESS )
+        lock_status = psa_key_slot_mutex_unlock( );
+    if( overall_status == PSA_SUCCESS )
+        overall_status = lock_status;
+    if( use_storage )
+    {
+        status = psa_key_storage_mutex_unlock( );
+        if( overall_status == PSA_SUCCESS )
+            overall_status = status;
+    }
     return( overall_status );
 }
 
@@ -1434,11 +1523,10 @@ psa_status_t psa_export_public_key( mbedtls_svc_key_id_t key,
          goto exit;
     }
 
-    psa_key_attributes_t attributes = {
-        .core = slot->attr
-    };
+    psa_key_slot_attributes_t slot_attributes =
+        psa_key_slot_attributes( slot );
     status = psa_driver_wrapper_export_public_key(
-        &attributes, slot->key.data, slot->key.bytes,
+        &slot_attributes.attributes, slot->key.data, slot->key.bytes,
         data, data_size, data_length );
 
 exit:
@@ -1584,7 +1672,14 @@ static psa_status_t psa_start_key_creation(
     if( status != PSA_SUCCESS )
         return( status );
 
+    status = psa_key_slot_mutex_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
     status = psa_get_empty_key_slot( &volatile_key_id, p_slot );
+    if( status == PSA_SUCCESS )
+        status = psa_key_slot_mutex_unlock( );
+    else
+        (void) psa_key_slot_mutex_unlock( );
     if( status != PSA_SUCCESS )
         return( status );
     slot = *p_slot;
@@ -1595,7 +1690,9 @@ static psa_status_t psa_start_key_creation(
      * an input (generate, device) but not for those where the bit-size
      * is optional (import, copy). In case of a volatile key, assign it the
      * volatile key identifier associated to the slot returned to contain its
-     * definition. */
+     * definition. The key cannot be looked up until psa_finish_key_creation()
+     * registers it, so the slot can be filled without holding the key slot
+     * mutex. */
 
     slot->attr = attributes->core;
     if( PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) )
@@ -1704,9 +1801,19 @@ static psa_status_t psa_finish_key_creation(
     mbedtls_svc_key_id_t *key)
 {
     psa_status_t status = PSA_SUCCESS;
+    psa_status_t unlock_status;
     (void) slot;
     (void) driver;
 
+    /* Hold the key storage mutex until the key is registered, so that a
+     * concurrent psa_get_and_lock_key_slot() cannot load a second copy of
+     * a persistent key from storage while it is being saved. The slot is
+     * not findable yet, so the key slot mutex is only needed to register
+     * it. */
+    status = psa_key_storage_mutex_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
 #if defined(MBEDTLS_PSA_CRYPTO_STORAGE_C)
     if( ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) )
     {
@@ -1752,12 +1859,27 @@ static psa_status_t psa_finish_key_creation(
         if( status != PSA_SUCCESS )
         {
             psa_destroy_persistent_key( slot->attr.id );
+            (void) psa_key_storage_mutex_unlock( );
             return( status );
         }
         status = psa_crypto_stop_transaction( );
     }
 #endif /* MBEDTLS_PSA_CRYPTO_SE_C */
 
+    if( status == PSA_SUCCESS )
+    {
+        status = psa_key_slot_mutex_lock( );
+        if( status == PSA_SUCCESS )
+        {
+            psa_register_key_slot( slot );
+            status = psa_key_slot_mutex_unlock( );
+        }
+    }
+
+    unlock_status = psa_key_storage_mutex_unlock( );
+    if( status == PSA_SUCCESS )
+        status = unlock_status;
+
     if( status == PSA_SUCCESS )
     {
         *key = slot->attr.id;
@@ -1784,6 +1906,7 @@ static psa_status_t psa_finish_key_creation(
 static void psa_fail_key_creation( psa_key_slot_t *slot,
                                    psa_se_drv_table_entry_t *driver )
 {
+    psa_status_t lock_status;
     (void) driver;
 
     if( slot == NULL )
@@ -1806,7 +1929,12 @@ static void psa_fail_key_creation( psa_key_slot_t *slot,
     (void) psa_crypto_stop_transaction( );
 #endif /* MBEDTLS_PSA_CRYPTO_SE_C */
 
+    /* Wipe the slot even if the mutex cannot be taken: the slot is not
+     * registered yet, so no other thread can reach it. */
+    lock_status = psa_key_slot_mutex_lock( );
     psa_wipe_key_slot( slot );
+    if( lock_status == PSA_SUCCESS )
+        (void) psa_key_slot_mutex_unlock( );
 }
 
 /** Validate optional attributes during key creation.
@@ -2723,14 +2851,13 @@ static psa_status_t psa_sign_internal( mbedtls_svc_key_id_t key,
         goto exit;
     }
 
-    psa_key_attributes_t attributes = {
-      .core = slot->attr
-    };
+    psa_key_slot_attributes_t slot_attributes =
+        psa_key_slot_attributes( slot );
 
     if( input_is_message )
     {
         status = psa_driver_wrapper_sign_message(
-            &attributes, slot->key.data, slot->key.bytes,
+            &slot_attributes.attributes, slot->key.data, slot->key.bytes,
             alg, input, input_length,
             signature, signature_size, signature_length );
     }
@@ -2738,7 +2865,7 @@ static psa_status_t psa_sign_internal( mbedtls_svc_key_id_t key,
     {
 
         status = psa_driver_wrapper_sign_hash(
-            &attributes, slot->key.data, slot->key.bytes,
+            &slot_attributes.attributes, slot->key.data, slot->key.bytes,
             alg, input, input_length,
             signature, signature_size, signature_length );
     }
@@ -2787,21 +2914,20 @@ static psa_status_t psa_verify_internal( mbedtls_svc_key_id_t key,
     if( status != PSA_SUCCESS )
         return( status );
 
-    psa_key_attributes_t attributes = {
-      .core = slot->attr
-    };
+    psa_key_slot_attributes_t slot_attributes =
+        psa_key_slot_attributes( slot );
 
     if( input_is_message )
     {
         status = psa_driver_wrapper_verify_message(
-            &attributes, slot->key.data, slot->key.bytes,
+            &slot_attributes.attributes, slot->key.data, slot->key.bytes,
             alg, input, input_length,
             signature, signature_length );
     }
     else
     {
         status = psa_driver_wrapper_verify_hash(
-            &attributes, slot->key.data, slot->key.bytes,
+            &slot_attributes.attributes, slot->key.data, slot->key.bytes,
             alg, input, input_length,
             signature, signature_length );
     }
@@ -3044,6 +3170,160 @@ psa_status_t psa_verify_hash( mbedtls_svc_key_id_t key,
         signature, signature_length );
 }
 
+/* Number of key slots that mbedtls_psa_verify_hash_batch() locks at once */
+#define PSA_VERIFY_HASH_BATCH_CHUNK 16
+
+#if ( defined(MBEDTLS_PSA_BUILTIN_ALG_ECDSA) ||                \
+      defined(MBEDTLS_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA) ) && \
+    !defined(MBEDTLS_PSA_ACCEL_ALG_ECDSA) &&                   \
+    !defined(MBEDTLS_PSA_ACCEL_ALG_DETERMINISTIC_ECDSA) &&     \
+    !defined(PSA_CRYPTO_DRIVER_TEST)
+#define PSA_VERIFY_HASH_BATCH_ECDSA
+
+/* Would psa_driver_wrapper_verify_hash() end up in the built-in ECDSA? */
+static int psa_verify_hash_batch_is_ecdsa( const psa_key_attributes_t *attributes,
+                                           psa_algorithm_t alg )
+{
+    return( PSA_KEY_LIFETIME_GET_LOCATION( attributes->core.lifetime ) ==
+                PSA_KEY_LOCATION_LOCAL_STORAGE &&
+            PSA_KEY_TYPE_IS_ECC( attributes->core.type ) &&
+            PSA_ALG_IS_ECDSA( alg ) );
+}
+#endif
+
+psa_status_t mbedtls_psa_verify_hash_batch( const mbedtls_svc_key_id_t keys[],
+                                            psa_algorithm_t alg,
+                                            const uint8_t * const hashes[],
+                                            const size_t hash_lengths[],
+                                            const uint8_t * const signatures[],
+                                            const size_t signature_lengths[],
+                                            size_t count,
+                                            uint8_t *results )
+{
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    psa_status_t unlock_status = PSA_SUCCESS;
+    psa_key_slot_t *slots[PSA_VERIFY_HASH_BATCH_CHUNK];
+    psa_key_slot_attributes_t slot_attributes[PSA_VERIFY_HASH_BATCH_CHUNK];
+    const psa_key_attributes_t *attributes[PSA_VERIFY_HASH_BATCH_CHUNK];
+#if defined(PSA_VERIFY_HASH_BATCH_ECDSA)
+    const uint8_t *key_buffers[PSA_VERIFY_HASH_BATCH_CHUNK];
+    size_t key_buffer_sizes[PSA_VERIFY_HASH_BATCH_CHUNK];
+    uint8_t run_results[PSA_VERIFY_HASH_BATCH_CHUNK / 8];
+    size_t k;
+#endif
+    size_t i, j, run, chunk, locked = 0;
+    int invalid = 0;
+
+    status = psa_sign_verify_check_alg( 0, alg );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    memset( results, 0, ( count + 7 ) / 8 );
+
+    for( i = 0; i < count; i += chunk )
+    {
+        chunk = count - i < PSA_VERIFY_HASH_BATCH_CHUNK ?
+                count - i : PSA_VERIFY_HASH_BATCH_CHUNK;
+
+        for( locked = 0; locked < chunk; locked++ )
+        {
+            status = psa_get_and_lock_key_slot_with_policy(
+                        keys[i + locked], &slots[locked],
+                        PSA_KEY_USAGE_VERIFY_HASH, alg );
+            if( status != PSA_SUCCESS )
+                goto exit;
+
+            slot_attributes[locked] = psa_key_slot_attributes( slots[locked] );
+            attributes[locked] = &slot_attributes[locked].attributes;
+#if defined(PSA_VERIFY_HASH_BATCH_ECDSA)
+            key_buffers[locked] = slots[locked]->key.data;
+            key_buffer_sizes[locked] = slots[locked]->key.bytes;
+#endif
+        }
+
+        for( j = 0; j < chunk; j += run )
+        {
+            run = 1;
+
+#if defined(PSA_VERIFY_HASH_BATCH_ECDSA)
+            if( psa_verify_hash_batch_is_ecdsa( attributes[j], alg ) )
+            {
+                /* Verify the longest run of keys on the same curve */
+                while( j + run < chunk &&
+                       psa_verify_hash_batch_is_ecdsa( attributes[j + run],
+                                                       alg ) &&
+                       attributes[j + run]->core.type ==
+                           attributes[j]->core.type &&
+                       attributes[j + run]->core.bits ==
+                           attributes[j]->core.bits )
+                {
+                    run++;
+                }
+
+                status = mbedtls_psa_ecdsa_verify_hash_batch(
+                            &attributes[j], &key_buffers[j],
+                            &key_buffer_sizes[j], alg,
+                            &hashes[i + j], &hash_lengths[i + j],
+                            &signatures[i + j], &signature_lengths[i + j],
+                            run, run_results );
+                if( status != PSA_SUCCESS &&
+                    status != PSA_ERROR_INVALID_SIGNATURE )
+                    goto exit;
+
+                for( k = 0; k < run; k++ )
+                {
+                    if( status == PSA_SUCCESS ||
+                        ( run_results[k / 8] >> ( k % 8 ) & 1 ) )
+                    {
+                        results[( i + j + k ) / 8] |=
+                            (uint8_t) ( 1 << ( ( i + j + k ) % 8 ) );
+                    }
+                }
+            }
+            else
+#endif /* PSA_VERIFY_HASH_BATCH_ECDSA */
+            {
+                status = psa_driver_wrapper_verify_hash(
+                            attributes[j], slots[j]->key.data,
+                            slots[j]->key.bytes, alg,
+                            hashes[i + j], hash_lengths[i + j],
+                            signatures[i + j], signature_lengths[i + j] );
+                if( status != PSA_SUCCESS &&
+                    status != PSA_ERROR_INVALID_SIGNATURE )
+                    goto exit;
+
+                if( status == PSA_SUCCESS )
+                {
+                    results[( i + j ) / 8] |=
+                        (uint8_t) ( 1 << ( ( i + j ) % 8 ) );
+                }
+            }
+
+            if( status == PSA_ERROR_INVALID_SIGNATURE )
+                invalid = 1;
+        }
+
+        while( locked > 0 )
+        {
+            status = psa_unlock_key_slot( slots[--locked] );
+            if( status != PSA_SUCCESS )
+                goto exit;
+        }
+    }
+
+    status = invalid ? PSA_ERROR_INVALID_SIGNATURE : PSA_SUCCESS;
+
+exit:
+    while( locked > 0 )
+    {
+        psa_status_t slot_status = psa_unlock_key_slot( slots[--locked] );
+        if( unlock_status == PSA_SUCCESS )
+            unlock_status = slot_status;
+    }
+
+    return( ( status == PSA_SUCCESS ) ? unlock_status : status );
+}
+
 psa_status_t psa_asymmetric_encrypt( mbedtls_svc_key_id_t key,
                                      psa_algorithm_t alg,
                                      const uint8_t *input,
@@ -3080,12 +3360,11 @@ psa_status_t psa_asymmetric_encrypt( mbedtls_svc_key_id_t key,
         goto exit;
     }
 
-    psa_key_attributes_t attributes = {
-      .core = slot->attr
-    };
+    psa_key_slot_attributes_t slot_attributes =
+        psa_key_slot_attributes( slot );
 
     status = psa_driver_wrapper_asymmetric_encrypt(
-        &attributes, slot->key.data, slot->key.bytes,
+        &slot_attributes.attributes, slot->key.data, slot->key.bytes,
         alg, input, input_length, salt, salt_length,
         output, output_size, output_length );
 exit:
@@ -3129,12 +3408,11 @@ psa_status_t psa_asymmetric_decrypt( mbedtls_svc_key_id_t key,
         goto exit;
     }
 
-    psa_key_attributes_t attributes = {
-      .core = slot->attr
-    };
+    psa_key_slot_attributes_t slot_attributes =
+        psa_key_slot_attributes( slot );
 
     status = psa_driver_wrapper_asymmetric_decrypt(
-        &attributes, slot->key.data, slot->key.bytes,
+        &slot_attributes.attributes, slot->key.data, slot->key.bytes,
         alg, input, input_length, salt, salt_length,
         output, output_size, output_length );
 
@@ -5808,9 +6086,10 @@ static psa_status_t psa_key_agreement_raw_internal( psa_algorithm_t alg,
             if( ! PSA_KEY_TYPE_IS_ECC_KEY_PAIR( private_key->attr.type ) )
                 return( PSA_ERROR_INVALID_ARGUMENT );
             mbedtls_ecp_keypair *ecp = NULL;
-            psa_status_t status = mbedtls_psa_ecp_load_representation(
-                                      private_key->attr.type,
-                                      private_key->attr.bits,
+            psa_key_slot_attributes_t slot_attributes =
+                psa_key_slot_attributes( private_key );
+            psa_status_t status = mbedtls_psa_ecp_get_representation(
+                                      &slot_attributes.attributes,
                                       private_key->key.data,
                                       private_key->key.bytes,
                                       &ecp );
@@ -5820,8 +6099,8 @@ static psa_status_t psa_key_agreement_raw_internal( psa_algorithm_t alg,
                                              ecp,
                                              shared_secret, shared_secret_size,
                                              shared_secret_length );
-            mbedtls_ecp_keypair_free( ecp );
-            mbedtls_free( ecp );
+            mbedtls_psa_ecp_release_representation(
+                &slot_attributes.attributes, ecp );
             return( status );
 #endif /* MBEDTLS_PSA_BUILTIN_ALG_ECDH */
         default:
@@ -5974,6 +6253,239 @@ exit:
 /* Random generation */
 /****************************************************************/
 
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+#include <pthread.h>
+
+/* A DRBG instance owned by a single thread.
+ *
+ * Instances are created on demand and linked into psa_thread_drbg_list so
+ * that mbedtls_psa_crypto_free() can wipe all of them. An instance stays
+ * allocated until its thread exits (or, for the thread that calls
+ * mbedtls_psa_crypto_free(), until then), but its DRBG state only lives
+ * between psa_crypto_init() and mbedtls_psa_crypto_free().
+ *
+ * The list is protected by mbedtls_threading_psa_globaldata_mutex. The
+ * DRBG state and the seeded flag are protected by the instance's own
+ * mutex, which is held by the owning thread while it uses the DRBG and by
+ * mbedtls_psa_crypto_free() while it wipes the DRBG. Lock the global data
+ * mutex first if both are needed.
+ */
+typedef struct psa_thread_drbg_s
+{
+    mbedtls_threading_mutex_t mutex;
+    mbedtls_psa_drbg_context_t drbg;
+    unsigned seeded;
+    unsigned fork_generation;
+    struct psa_thread_drbg_s *next;
+} psa_thread_drbg_t;
+
+static pthread_once_t psa_thread_drbg_once = PTHREAD_ONCE_INIT;
+static pthread_key_t psa_thread_drbg_key;
+static int psa_thread_drbg_key_ret = -1;
+static psa_thread_drbg_t *psa_thread_drbg_list = NULL;
+
+/* Incremented in the child process after each fork(). A thread whose DRBG
+ * was seeded in an earlier generation must reseed it before use, otherwise
+ * the parent and the child would generate the same output. */
+static unsigned psa_fork_generation = 0;
+
+static void psa_thread_drbg_after_fork( void )
+{
+    ++psa_fork_generation;
+}
+
+/* Unlink a DRBG instance from psa_thread_drbg_list and free it. Must be
+ * called with mbedtls_threading_psa_globaldata_mutex held, by the owning
+ * thread. */
+static void psa_thread_drbg_remove( psa_thread_drbg_t *thread_drbg )
+{
+    psa_thread_drbg_t **p;
+
+    for( p = &psa_thread_drbg_list; *p != NULL; p = &( *p )->next )
+    {
+        if( *p == thread_drbg )
+        {
+            *p = thread_drbg->next;
+            break;
+        }
+    }
+    /* No other thread can reach the instance once it is unlinked. */
+    if( thread_drbg->seeded )
+        mbedtls_psa_drbg_free( &thread_drbg->drbg );
+    mbedtls_mutex_free( &thread_drbg->mutex );
+    mbedtls_free( thread_drbg );
+}
+
+/* Thread-specific data destructor: called when a thread that used the
+ * PSA random generator exits. */
+static void psa_thread_drbg_destroy( void *data )
+{
+    /* If the list cannot be updated, leak the instance rather than leave
+     * a dangling pointer in the list. */
+    if( mbedtls_mutex_lock( &mbedtls_threading_psa_globaldata_mutex ) != 0 )
+        return;
+    psa_thread_drbg_remove( data );
+    (void) mbedtls_mutex_unlock( &mbedtls_threading_psa_globaldata_mutex );
+}
+
+static void psa_thread_drbg_setup( void )
+{
+    psa_thread_drbg_key_ret = pthread_key_create( &psa_thread_drbg_key,
+                                                  psa_thread_drbg_destroy );
+    if( psa_thread_drbg_key_ret == 0 )
+    {
+        psa_thread_drbg_key_ret =
+            pthread_atfork( NULL, NULL, psa_thread_drbg_after_fork );
+    }
+}
+
+/* Return the DRBG of the calling thread, creating and seeding it if
+ * necessary. Must be called with mbedtls_threading_psa_globaldata_mutex
+ * held, after the entropy context has been initialized. The instance mutex
+ * is not locked: only the owning thread seeds its DRBG, and
+ * mbedtls_psa_crypto_free() cannot run concurrently since it needs the
+ * global data mutex. */
+static int psa_thread_drbg_get_locked( psa_thread_drbg_t **p_thread_drbg )
+{
+    const unsigned char drbg_seed[] = "PSA";
+    psa_thread_drbg_t *thread_drbg;
+    int ret;
+
+    if( pthread_once( &psa_thread_drbg_once, psa_thread_drbg_setup ) != 0 ||
+        psa_thread_drbg_key_ret != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    thread_drbg = pthread_getspecific( psa_thread_drbg_key );
+    if( thread_drbg == NULL )
+    {
+        thread_drbg = mbedtls_calloc( 1, sizeof( *thread_drbg ) );
+        if( thread_drbg == NULL )
+            return( MBEDTLS_ERR_ENTROPY_SOURCE_FAILED );
+        if( pthread_setspecific( psa_thread_drbg_key, thread_drbg ) != 0 )
+        {
+            mbedtls_free( thread_drbg );
+            return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+        }
+        mbedtls_mutex_init( &thread_drbg->mutex );
+        thread_drbg->next = psa_thread_drbg_list;
+        psa_thread_drbg_list = thread_drbg;
+    }
+
+    if( ! thread_drbg->seeded )
+    {
+        mbedtls_psa_drbg_init( &thread_drbg->drbg );
+        ret = mbedtls_psa_drbg_seed( &thread_drbg->drbg,
+                                     &global_data.rng.entropy,
+                                     drbg_seed, sizeof( drbg_seed ) - 1 );
+        if( ret != 0 )
+        {
+            mbedtls_psa_drbg_free( &thread_drbg->drbg );
+            return( ret );
+        }
+        thread_drbg->seeded = 1;
+        thread_drbg->fork_generation = psa_fork_generation;
+    }
+
+    *p_thread_drbg = thread_drbg;
+    return( 0 );
+}
+
+/* Return the DRBG of the calling thread, ready for use. On success, the
+ * instance mutex is locked and the caller must unlock it once it is done
+ * with the DRBG. */
+static int psa_thread_drbg_get( psa_thread_drbg_t **p_thread_drbg )
+{
+    psa_thread_drbg_t *thread_drbg;
+    int ret;
+
+    if( pthread_once( &psa_thread_drbg_once, psa_thread_drbg_setup ) != 0 ||
+        psa_thread_drbg_key_ret != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    thread_drbg = pthread_getspecific( psa_thread_drbg_key );
+
+    if( thread_drbg != NULL )
+    {
+        /* The instance mutex is uncontended unless
+         * mbedtls_psa_crypto_free() is wiping the DRBG right now. */
+        if( mbedtls_mutex_lock( &thread_drbg->mutex ) != 0 )
+            return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+        if( ! thread_drbg->seeded &&
+            mbedtls_mutex_unlock( &thread_drbg->mutex ) != 0 )
+            return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+    }
+
+    if( thread_drbg == NULL || ! thread_drbg->seeded )
+    {
+        /* First use in this thread since psa_crypto_init(). */
+        if( mbedtls_mutex_lock( &mbedtls_threading_psa_globaldata_mutex ) != 0 )
+            return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+        if( global_data.rng_state == RNG_SEEDED )
+            ret = psa_thread_drbg_get_locked( &thread_drbg );
+        else
+            ret = MBEDTLS_ERR_ENTROPY_SOURCE_FAILED;
+        if( ret == 0 && mbedtls_mutex_lock( &thread_drbg->mutex ) != 0 )
+            ret = MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+        if( mbedtls_mutex_unlock( &mbedtls_threading_psa_globaldata_mutex ) != 0 )
+        {
+            if( ret == 0 )
+                (void) mbedtls_mutex_unlock( &thread_drbg->mutex );
+            return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+        }
+        if( ret != 0 )
+            return( ret );
+    }
+    else if( thread_drbg->fork_generation != psa_fork_generation )
+    {
+        /* This is the first use in a child process. */
+        ret = mbedtls_psa_drbg_reseed( &thread_drbg->drbg );
+        if( ret != 0 )
+        {
+            (void) mbedtls_mutex_unlock( &thread_drbg->mutex );
+            return( ret );
+        }
+        thread_drbg->fork_generation = psa_fork_generation;
+    }
+
+    *p_thread_drbg = thread_drbg;
+    return( 0 );
+}
+
+/* Free the DRBG state of all threads, and the whole DRBG instance of the
+ * calling thread, whose thread-specific data destructor may never run if
+ * it is the main thread. Must be called with
+ * mbedtls_threading_psa_globaldata_mutex held. */
+static void psa_thread_drbg_free_all( void )
+{
+    psa_thread_drbg_t *thread_drbg;
+    psa_thread_drbg_t *own_drbg = NULL;
+
+    if( psa_thread_drbg_key_ret == 0 )
+        own_drbg = pthread_getspecific( psa_thread_drbg_key );
+
+    for( thread_drbg = psa_thread_drbg_list;
+         thread_drbg != NULL;
+         thread_drbg = thread_drbg->next )
+    {
+        /* Wait until the owning thread is done with its DRBG. If the mutex
+         * cannot be taken, leave the DRBG alone rather than free it under
+         * the owning thread's feet; it is freed when the thread exits. */
+        if( mbedtls_mutex_lock( &thread_drbg->mutex ) != 0 )
+            continue;
+        if( thread_drbg->seeded )
+        {
+            mbedtls_psa_drbg_free( &thread_drbg->drbg );
+            thread_drbg->seeded = 0;
+        }
+        (void) mbedtls_mutex_unlock( &thread_drbg->mutex );
+    }
+
+    if( own_drbg != NULL &&
+        pthread_setspecific( psa_thread_drbg_key, NULL ) == 0 )
+        psa_thread_drbg_remove( own_drbg );
+}
+#endif /* MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD */
+
 /** Initialize the PSA random generator.
  */
 static void mbedtls_psa_random_init( mbedtls_psa_random_context_t *rng )
@@ -6000,7 +6512,9 @@ static void mbedtls_psa_random_init( mbedtls_psa_random_context_t *rng )
                                 MBEDTLS_ENTROPY_SOURCE_STRONG );
 #endif
 
-    mbedtls_psa_drbg_init( MBEDTLS_PSA_RANDOM_STATE );
+#if !defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+    mbedtls_psa_drbg_init( &rng->drbg );
+#endif
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 }
 
@@ -6011,7 +6525,11 @@ static void mbedtls_psa_random_free( mbedtls_psa_random_context_t *rng )
 #if defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
     memset( rng, 0, sizeof( *rng ) );
 #else /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
-    mbedtls_psa_drbg_free( MBEDTLS_PSA_RANDOM_STATE );
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+    psa_thread_drbg_free_all( );
+#else
+    mbedtls_psa_drbg_free( &rng->drbg );
+#endif
     rng->entropy_free( &rng->entropy );
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 }
@@ -6024,9 +6542,15 @@ static psa_status_t mbedtls_psa_random_seed( mbedtls_psa_random_context_t *rng )
     /* Do nothing: the external RNG seeds itself. */
     (void) rng;
     return( PSA_SUCCESS );
+#elif defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+    /* Seed the DRBG of the calling thread. This checks that the entropy
+     * sources work. Other threads seed their DRBG on first use. */
+    psa_thread_drbg_t *thread_drbg;
+    (void) rng;
+    return( mbedtls_to_psa_error( psa_thread_drbg_get_locked( &thread_drbg ) ) );
 #else /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
     const unsigned char drbg_seed[] = "PSA";
-    int ret = mbedtls_psa_drbg_seed( &rng->entropy,
+    int ret = mbedtls_psa_drbg_seed( &rng->drbg, &rng->entropy,
                                      drbg_seed, sizeof( drbg_seed ) - 1 );
     return mbedtls_to_psa_error( ret );
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
@@ -6102,6 +6626,29 @@ int mbedtls_psa_get_random( void *p_rng,
 }
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+/* With a per-thread random generator, `mbedtls_psa_get_random` must find
+ * the DRBG of the calling thread, so it is a function rather than an alias
+ * of `mbedtls_xxx_drbg_random`. psa_generate_random() calls it too. */
+int mbedtls_psa_get_random( void *p_rng,
+                            unsigned char *output,
+                            size_t output_size )
+{
+    psa_thread_drbg_t *thread_drbg;
+    int ret;
+
+    (void) p_rng;
+    ret = psa_thread_drbg_get( &thread_drbg );
+    if( ret != 0 )
+        return( ret );
+    ret = mbedtls_psa_drbg_random_unlocked( &thread_drbg->drbg,
+                                            output, output_size );
+    if( mbedtls_mutex_unlock( &thread_drbg->mutex ) != 0 && ret == 0 )
+        ret = MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+    return( ret );
+}
+#endif /* MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD */
+
 #if defined(MBEDTLS_PSA_INJECT_ENTROPY)
 #include "entropy_poll.h"
 
@@ -6316,7 +6863,8 @@ psa_status_t mbedtls_psa_crypto_configure_entropy_sources(
 }
 #endif /* !defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG) */
 
-void mbedtls_psa_crypto_free( void )
+/* Must be called with mbedtls_threading_psa_globaldata_mutex held. */
+static void psa_crypto_free_internal( void )
 {
     psa_wipe_all_key_slots( );
     if( global_data.rng_state != RNG_NOT_INITIALIZED )
@@ -6332,6 +6880,22 @@ void mbedtls_psa_crypto_free( void )
     psa_driver_wrapper_free( );
 }
 
+void mbedtls_psa_crypto_free( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    /* Free the global data even if the mutex cannot be taken, as there is
+     * no way to report the failure. */
+    int ret = mbedtls_mutex_lock( &mbedtls_threading_psa_globaldata_mutex );
+#endif /* MBEDTLS_THREADING_C */
+
+    psa_crypto_free_internal( );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ret == 0 )
+        (void) mbedtls_mutex_unlock( &mbedtls_threading_psa_globaldata_mutex );
+#endif /* MBEDTLS_THREADING_C */
+}
+
 #if defined(PSA_CRYPTO_STORAGE_HAS_TRANSACTIONS)
 /** Recover a transaction that was interrupted by a power failure.
  *
@@ -6362,9 +6926,17 @@ psa_status_t psa_crypto_init( void )
 {
     psa_status_t status;
 
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &mbedtls_threading_psa_globaldata_mutex ) != 0 )
+        return( PSA_ERROR_GENERIC_ERROR );
+#endif /* MBEDTLS_THREADING_C */
+
     /* Double initialization is explicitly allowed. */
     if( global_data.initialized != 0 )
-        return( PSA_SUCCESS );
+    {
+        status = PSA_SUCCESS;
+        goto unlock;
+    }
 
     /* Initialize and seed the random generator. */
     mbedtls_psa_random_init( &global_data.rng );
@@ -6404,7 +6976,14 @@ psa_status_t psa_crypto_init( void )
 
 exit:
     if( status != PSA_SUCCESS )
-        mbedtls_psa_crypto_free( );
+        psa_crypto_free_internal( );
+
+unlock:
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &mbedtls_threading_psa_globaldata_mutex ) != 0 &&
+        status == PSA_SUCCESS )
+        status = PSA_ERROR_GENERIC_ERROR;
+#endif /* MBEDTLS_THREADING_C */
     return( status );
 }
 
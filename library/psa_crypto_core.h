@@ -26,6 +26,10 @@
 #include "psa/crypto.h"
 #include "psa/crypto_se_driver.h"
 
+#if defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
 /** Constant-time buffer comparison
  *
  * \param[in]  a    Left-hand buffer for comparison.
@@ -46,6 +50,123 @@ static inline int mbedtls_psa_safer_memcmp(
     return( diff );
 }
 
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+/** The parsed form of the key in a key slot, kept across operations.
+ *
+ * The core passes a pointer to this structure to the drivers along with the
+ * key attributes, in a ::psa_key_slot_attributes_t. A built-in driver gets
+ * it with psa_get_key_representation_cache() and acquires it with
+ * psa_acquire_key_representation() for the duration of an operation. If it
+ * cannot, because another operation is using it, the driver works on a
+ * private copy.
+ */
+typedef struct
+{
+    void *representation;   /* mbedtls_rsa_context or mbedtls_ecp_keypair,
+                             * depending on the key type, or NULL. */
+    unsigned in_use;        /* Whether an operation is using it. */
+} psa_key_representation_cache_t;
+
+/** Acquire the key representation cached in a key slot.
+ *
+ * The key slot must be locked. Only one operation at a time can acquire
+ * the cached representation; the others get 0 and must parse the key
+ * themselves.
+ *
+ * \param[in,out] cache     The cache. May be NULL.
+ *
+ * \retval 1 on success. \c cache->representation now belongs to the caller
+ *         until it calls psa_release_key_representation(). If it is NULL,
+ *         the caller may store a new representation there.
+ * \retval 0 if \p cache is NULL or in use.
+ */
+static inline int psa_acquire_key_representation(
+    psa_key_representation_cache_t *cache )
+{
+    int acquired = 0;
+
+    if( cache == NULL )
+        return( 0 );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &mbedtls_threading_key_slot_mutex ) != 0 )
+        return( 0 );
+#endif
+    if( ! cache->in_use )
+    {
+        cache->in_use = 1;
+        acquired = 1;
+    }
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &mbedtls_threading_key_slot_mutex );
+#endif
+
+    return( acquired );
+}
+
+/** Store a new representation in a key representation cache that the caller
+ * acquired with psa_acquire_key_representation() and found empty.
+ *
+ * \param[in,out] cache         The cache.
+ * \param[in] representation    The representation. The cache takes
+ *                              ownership of it.
+ */
+static inline void psa_fill_key_representation(
+    psa_key_representation_cache_t *cache, void *representation )
+{
+#if defined(MBEDTLS_THREADING_C)
+    /* The mutex is needed because psa_release_key_representation() reads
+     * the cached pointer in other threads. If it cannot be taken, give up
+     * on caching; the caller's release will free the representation. */
+    if( mbedtls_mutex_lock( &mbedtls_threading_key_slot_mutex ) != 0 )
+        return;
+#endif
+    cache->representation = representation;
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &mbedtls_threading_key_slot_mutex );
+#endif
+}
+
+/** Release a key representation acquired with
+ * psa_acquire_key_representation().
+ *
+ * \param[in,out] cache         The cache. May be NULL.
+ * \param[in] representation    The representation that the operation used,
+ *                              or NULL if the caller acquired the cache but
+ *                              failed to fill it.
+ *
+ * \retval 1 if \p representation is the one cached in \p cache, which has
+ *         been released.
+ * \retval 0 if \p representation is a private copy, which the caller must
+ *         free.
+ */
+static inline int psa_release_key_representation(
+    psa_key_representation_cache_t *cache, const void *representation )
+{
+    int cached = 0;
+
+    if( cache == NULL )
+        return( 0 );
+
+#if defined(MBEDTLS_THREADING_C)
+    /* If the mutex cannot be taken, leave the cache marked in use: the
+     * drivers will parse the key for each operation from now on. */
+    if( mbedtls_mutex_lock( &mbedtls_threading_key_slot_mutex ) != 0 )
+        return( cache->representation == representation );
+#endif
+    if( cache->representation == representation )
+    {
+        cache->in_use = 0;
+        cached = 1;
+    }
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &mbedtls_threading_key_slot_mutex );
+#endif
+
+    return( cached );
+}
+#endif /* MBEDTLS_PSA_KEY_REPRESENTATION_CACHE */
+
 /** The data structure representing a key slot, containing key material
  * and metadata for one key.
  */
@@ -75,6 +196,9 @@ typedef struct
      * . In case of a multi-threaded application where one thread asks to close
      *   or purge or destroy a key while it is in used by the library through
      *   another thread.
+     *
+     * With MBEDTLS_THREADING_C, this counter is only accessed with the key
+     * slot mutex held (see psa_crypto_slot_management.h).
      */
     size_t lock_count;
 
@@ -85,13 +209,100 @@ typedef struct
         uint8_t *data;
         size_t bytes;
     } key;
+
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+    /* Parsed form of the key data, freed with it. */
+    psa_key_representation_cache_t cache;
+#endif /* MBEDTLS_PSA_KEY_REPRESENTATION_CACHE */
+
+    /* Bookkeeping of the key slot manager (psa_crypto_slot_management.c),
+     * used to find key slots in constant time. Slots are designated by
+     * their index in the key slot table, or PSA_KEY_SLOT_NONE.
+     *
+     * psa_wipe_key_slot() resets every other field of the slot but leaves
+     * this one to the key slot manager. */
+    struct key_slot_links
+    {
+        size_t index;           /* Index of this slot in the slot table. */
+        size_t prev;            /* Neighbours in the list of free slots */
+        size_t next;            /* or in the list of evictable slots. */
+        size_t bucket_next;     /* Next slot in the same key id bucket. */
+        uint8_t list;           /* PSA_KEY_SLOT_LIST_xxx this slot is in. */
+        uint8_t indexed;        /* Whether the key can be looked up by its
+                                 * identifier (psa_register_key_slot()). */
+    } links;
 } psa_key_slot_t;
 
-/* A mask of key attribute flags used only internally.
- * Currently there aren't any. */
-#define PSA_KA_MASK_INTERNAL_ONLY (     \
+/** Value of a key slot link that designates no slot. */
+#define PSA_KEY_SLOT_NONE SIZE_MAX
+
+/** Internal flag set in the core attributes of a ::psa_key_slot_attributes_t,
+ * so that built-in drivers can tell them from plain key attributes. It is
+ * never set in a key slot. */
+#define PSA_KA_FLAG_HAS_REPRESENTATION_CACHE    \
+    ( (psa_key_attributes_flag_t) 0x8000 )
+
+/* A mask of key attribute flags used only internally. */
+#define PSA_KA_MASK_INTERNAL_ONLY (             \
+        PSA_KA_FLAG_HAS_REPRESENTATION_CACHE |  \
         0 )
 
+/** The key attributes that the core passes to the drivers with the key
+ * material of a key slot.
+ *
+ * The representation cache of the slot is kept here rather than in
+ * ::psa_key_attributes_t, which applications copy by value.
+ */
+typedef struct
+{
+    psa_key_attributes_t attributes;    /* Must be the first member. */
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+    psa_key_representation_cache_t *cache;
+#endif
+} psa_key_slot_attributes_t;
+
+/** Build the attributes to pass to the drivers with the key material of a
+ * key slot.
+ *
+ * \param[in] slot      The key slot. It must be locked.
+ *
+ * \return The attributes of \p slot, with its key representation cache.
+ */
+static inline psa_key_slot_attributes_t psa_key_slot_attributes(
+    psa_key_slot_t *slot )
+{
+    psa_key_slot_attributes_t slot_attributes = {
+        .attributes = { .core = slot->attr }
+    };
+
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+    slot_attributes.attributes.core.flags |=
+        PSA_KA_FLAG_HAS_REPRESENTATION_CACHE;
+    slot_attributes.cache = &slot->cache;
+#endif
+
+    return( slot_attributes );
+}
+
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+/** Get the key representation cache that the core passed to a driver.
+ *
+ * \param[in] attributes    Key attributes received by a driver.
+ *
+ * \return The representation cache of the key slot that \p attributes
+ *         were built from with psa_key_slot_attributes(), or NULL if they
+ *         do not come from a key slot.
+ */
+static inline psa_key_representation_cache_t *psa_get_key_representation_cache(
+    const psa_key_attributes_t *attributes )
+{
+    if( ( attributes->core.flags & PSA_KA_FLAG_HAS_REPRESENTATION_CACHE ) == 0 )
+        return( NULL );
+
+    return( ( (const psa_key_slot_attributes_t *) attributes )->cache );
+}
+#endif /* MBEDTLS_PSA_KEY_REPRESENTATION_CACHE */
+
 /** Test whether a key slot is occupied.
  *
  * A key slot is occupied iff the key type is nonzero. This works because
@@ -187,6 +398,9 @@ static inline psa_key_slot_number_t psa_key_slot_get_slot_number(
  *
  * Persistent storage is not affected.
  *
+ * The caller must hold the only lock on the slot, and the key slot mutex
+ * (see psa_crypto_slot_management.h).
+ *
  * \param[in,out] slot  The key slot to wipe.
  *
  * \retval #PSA_SUCCESS
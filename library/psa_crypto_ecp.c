@@ -151,6 +151,65 @@ exit:
 
     return( status );
 }
+
+psa_status_t mbedtls_psa_ecp_get_representation(
+    const psa_key_attributes_t *attributes,
+    const uint8_t *key_buffer, size_t key_buffer_size,
+    mbedtls_ecp_keypair **p_ecp )
+{
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+    psa_key_representation_cache_t *cache =
+        psa_get_key_representation_cache( attributes );
+
+    if( psa_acquire_key_representation( cache ) )
+    {
+        if( cache->representation == NULL )
+        {
+            mbedtls_ecp_keypair *ecp = NULL;
+            psa_status_t status = mbedtls_psa_ecp_load_representation(
+                attributes->core.type, attributes->core.bits,
+                key_buffer, key_buffer_size, &ecp );
+            if( status != PSA_SUCCESS )
+            {
+                (void) psa_release_key_representation( cache, NULL );
+                return( status );
+            }
+            psa_fill_key_representation( cache, ecp );
+            *p_ecp = ecp;
+        }
+        else
+            *p_ecp = cache->representation;
+        return( PSA_SUCCESS );
+    }
+#endif /* MBEDTLS_PSA_KEY_REPRESENTATION_CACHE */
+
+    return( mbedtls_psa_ecp_load_representation( attributes->core.type,
+                                                 attributes->core.bits,
+                                                 key_buffer,
+                                                 key_buffer_size,
+                                                 p_ecp ) );
+}
+
+void mbedtls_psa_ecp_release_representation(
+    const psa_key_attributes_t *attributes,
+    mbedtls_ecp_keypair *ecp )
+{
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+    psa_key_representation_cache_t *cache =
+        psa_get_key_representation_cache( attributes );
+
+    if( ecp == NULL )
+        return;
+
+    if( psa_release_key_representation( cache, ecp ) )
+        return;
+#else
+    (void) attributes;
+#endif /* MBEDTLS_PSA_KEY_REPRESENTATION_CACHE */
+
+    mbedtls_ecp_keypair_free( ecp );
+    mbedtls_free( ecp );
+}
 #endif /* defined(MBEDTLS_PSA_BUILTIN_KEY_TYPE_ECC_KEY_PAIR) ||
         * defined(MBEDTLS_PSA_BUILTIN_KEY_TYPE_ECC_PUBLIC_KEY) ||
         * defined(MBEDTLS_PSA_BUILTIN_ALG_ECDSA) ||
@@ -259,9 +318,10 @@ psa_status_t mbedtls_psa_ecp_export_public_key(
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     mbedtls_ecp_keypair *ecp = NULL;
 
-    status = mbedtls_psa_ecp_load_representation(
-        attributes->core.type, attributes->core.bits,
-        key_buffer, key_buffer_size, &ecp );
+    status = mbedtls_psa_ecp_get_representation( attributes,
+                                                 key_buffer,
+                                                 key_buffer_size,
+                                                 &ecp );
     if( status != PSA_SUCCESS )
         return( status );
 
@@ -270,8 +330,7 @@ psa_status_t mbedtls_psa_ecp_export_public_key(
                      PSA_KEY_TYPE_ECC_GET_FAMILY( attributes->core.type ) ),
                  ecp, data, data_size, data_length );
 
-    mbedtls_ecp_keypair_free( ecp );
-    mbedtls_free( ecp );
+    mbedtls_psa_ecp_release_representation( attributes, ecp );
 
     return( status );
 }
@@ -341,11 +400,10 @@ psa_status_t mbedtls_psa_ecdsa_sign_hash(
     size_t curve_bytes;
     mbedtls_mpi r, s;
 
-    status = mbedtls_psa_ecp_load_representation( attributes->core.type,
-                                                  attributes->core.bits,
-                                                  key_buffer,
-                                                  key_buffer_size,
-                                                  &ecp );
+    status = mbedtls_psa_ecp_get_representation( attributes,
+                                                 key_buffer,
+                                                 key_buffer_size,
+                                                 &ecp );
     if( status != PSA_SUCCESS )
         return( status );
 
@@ -396,8 +454,7 @@ cleanup:
     if( ret == 0 )
         *signature_length = 2 * curve_bytes;
 
-    mbedtls_ecp_keypair_free( ecp );
-    mbedtls_free( ecp );
+    mbedtls_psa_ecp_release_representation( attributes, ecp );
 
     return( mbedtls_to_psa_error( ret ) );
 }
@@ -416,11 +473,10 @@ psa_status_t mbedtls_psa_ecdsa_verify_hash(
 
     (void)alg;
 
-    status = mbedtls_psa_ecp_load_representation( attributes->core.type,
-                                                  attributes->core.bits,
-                                                  key_buffer,
-                                                  key_buffer_size,
-                                                  &ecp );
+    status = mbedtls_psa_ecp_get_representation( attributes,
+                                                 key_buffer,
+                                                 key_buffer_size,
+                                                 &ecp );
     if( status != PSA_SUCCESS )
         return( status );
 
@@ -455,12 +511,123 @@ psa_status_t mbedtls_psa_ecdsa_verify_hash(
 cleanup:
     mbedtls_mpi_free( &r );
     mbedtls_mpi_free( &s );
-    mbedtls_ecp_keypair_free( ecp );
-    mbedtls_free( ecp );
+    mbedtls_psa_ecp_release_representation( attributes, ecp );
 
     return( mbedtls_to_psa_error( ret ) );
 }
 
+psa_status_t mbedtls_psa_ecdsa_verify_hash_batch(
+    const psa_key_attributes_t * const attributes[],
+    const uint8_t * const key_buffers[], const size_t key_buffer_sizes[],
+    psa_algorithm_t alg,
+    const uint8_t * const hashes[], const size_t hash_lengths[],
+    const uint8_t * const signatures[], const size_t signature_lengths[],
+    size_t count, uint8_t *results )
+{
+    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    mbedtls_ecp_keypair **ecp = NULL;
+    const mbedtls_ecp_point **Q = NULL;
+    mbedtls_mpi *r = NULL, *s = NULL;
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t curve_bytes, i, j;
+
+    (void)alg;
+
+    if( count == 0 )
+        return( PSA_SUCCESS );
+
+    ecp = mbedtls_calloc( count, sizeof( *ecp ) );
+    Q = mbedtls_calloc( count, sizeof( *Q ) );
+    r = mbedtls_calloc( count, sizeof( *r ) );
+    s = mbedtls_calloc( count, sizeof( *s ) );
+    if( ecp == NULL || Q == NULL || r == NULL || s == NULL )
+    {
+        status = PSA_ERROR_INSUFFICIENT_MEMORY;
+        goto exit;
+    }
+
+    for( i = 0; i < count; i++ )
+    {
+        mbedtls_mpi_init( &r[i] );
+        mbedtls_mpi_init( &s[i] );
+    }
+
+    for( i = 0; i < count; i++ )
+    {
+        /* Parse each key once, even if it signed several items */
+        for( j = 0; j < i; j++ )
+        {
+            if( ecp[j] != NULL && key_buffers[j] == key_buffers[i] )
+                break;
+        }
+
+        if( j < i )
+            Q[i] = Q[j];
+        else
+        {
+            status = mbedtls_psa_ecp_get_representation( attributes[i],
+                                                         key_buffers[i],
+                                                         key_buffer_sizes[i],
+                                                         &ecp[i] );
+            if( status != PSA_SUCCESS )
+                goto exit;
+
+            /* Check whether the public part is loaded. If not, load it. */
+            if( mbedtls_ecp_is_zero( &ecp[i]->Q ) )
+            {
+                MBEDTLS_MPI_CHK(
+                    mbedtls_ecp_mul( &ecp[i]->grp, &ecp[i]->Q, &ecp[i]->d,
+                                     &ecp[i]->grp.G, mbedtls_psa_get_random,
+                                     MBEDTLS_PSA_RANDOM_STATE ) );
+            }
+            Q[i] = &ecp[i]->Q;
+        }
+
+        /* A signature of the wrong length keeps r = 0, which is invalid */
+        curve_bytes = PSA_BITS_TO_BYTES( ecp[0]->grp.pbits );
+        if( signature_lengths[i] != 2 * curve_bytes )
+            continue;
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &r[i],
+                                                  signatures[i],
+                                                  curve_bytes ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &s[i],
+                                                  signatures[i] + curve_bytes,
+                                                  curve_bytes ) );
+    }
+
+    ret = mbedtls_ecdsa_verify_batch( &ecp[0]->grp, hashes, hash_lengths,
+                                      Q, r, s, count, results );
+
+cleanup:
+    status = mbedtls_to_psa_error( ret );
+
+exit:
+    if( ecp != NULL )
+    {
+        for( i = 0; i < count; i++ )
+        {
+            if( ecp[i] != NULL )
+                mbedtls_psa_ecp_release_representation( attributes[i],
+                                                        ecp[i] );
+        }
+    }
+    if( r != NULL && s != NULL )
+    {
+        for( i = 0; i < count; i++ )
+        {
+            mbedtls_mpi_free( &r[i] );
+            mbedtls_mpi_free( &s[i] );
+        }
+    }
+    mbedtls_free( ecp );
+    mbedtls_free( Q );
+    mbedtls_free( r );
+    mbedtls_free( s );
+
+    return( status );
+}
+
 #endif /* defined(MBEDTLS_PSA_BUILTIN_ALG_ECDSA) || \
         * defined(MBEDTLS_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA) */
 
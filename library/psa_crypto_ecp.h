@@ -48,6 +48,38 @@ psa_status_t mbedtls_psa_ecp_load_representation( psa_key_type_t type,
                                                   size_t data_length,
                                                   mbedtls_ecp_keypair **p_ecp );
 
+/** Get the internal ECP representation of a key buffer for an operation
+ *
+ * If \p attributes were built from a key slot with psa_key_slot_attributes()
+ * and #MBEDTLS_PSA_KEY_REPRESENTATION_CACHE is enabled, the representation is
+ * taken from the slot's cache, and loaded into it on first use. Otherwise, or if the cached
+ * representation is already in use, this function behaves like
+ * mbedtls_psa_ecp_load_representation().
+ *
+ * \param[in] attributes        The attributes of the key.
+ * \param[in] key_buffer        The buffer containing the key data.
+ * \param[in] key_buffer_size   The size in bytes of \p key_buffer.
+ * \param[out] p_ecp            Returns a pointer to an ECP context on success.
+ *                              The caller must release it with
+ *                              mbedtls_psa_ecp_release_representation()
+ *                              when done, and must not modify the key it
+ *                              contains.
+ */
+psa_status_t mbedtls_psa_ecp_get_representation(
+    const psa_key_attributes_t *attributes,
+    const uint8_t *key_buffer, size_t key_buffer_size,
+    mbedtls_ecp_keypair **p_ecp );
+
+/** Release an ECP representation obtained with
+ * mbedtls_psa_ecp_get_representation().
+ *
+ * \param[in] attributes        The attributes passed when getting \p ecp.
+ * \param[in] ecp               The ECP context to release. May be NULL.
+ */
+void mbedtls_psa_ecp_release_representation(
+    const psa_key_attributes_t *attributes,
+    mbedtls_ecp_keypair *ecp );
+
 /** Import an ECP key in binary format.
  *
  * \note The signature of this function is that of a PSA driver
@@ -218,4 +250,44 @@ psa_status_t mbedtls_psa_ecdsa_verify_hash(
     const uint8_t *key_buffer, size_t key_buffer_size,
     psa_algorithm_t alg, const uint8_t *hash, size_t hash_length,
     const uint8_t *signature, size_t signature_length );
+
+/**
+ * \brief Verify a batch of ECDSA hash signatures made with keys on the same
+ *        curve.
+ *
+ * This is the batch counterpart of mbedtls_psa_ecdsa_verify_hash(), see
+ * mbedtls_ecdsa_verify_batch(). It is not a PSA driver entry point.
+ *
+ * \param[in]  attributes        The attributes of the \p count ECC keys.
+ *                               The keys must all have the same type and
+ *                               size.
+ * \param[in]  key_buffers       The buffers containing the keys.
+ * \param[in]  key_buffer_sizes  The sizes of the \p key_buffers in bytes.
+ * \param[in]  alg               Randomized or deterministic ECDSA algorithm.
+ * \param[in]  hashes            The hashes whose signatures are to be
+ *                               verified.
+ * \param[in]  hash_lengths      The sizes of the \p hashes in bytes.
+ * \param[in]  signatures        The signatures to verify.
+ * \param[in]  signature_lengths The sizes of the \p signatures in bytes.
+ * \param      count             The number of signatures.
+ * \param[out] results           A bitmap of (\p count + 7) / 8 bytes: bit
+ *                               (i % 8) of results[i / 8] is set if
+ *                               and only if signature i is valid.
+ *
+ * \retval #PSA_SUCCESS
+ *         All the signatures are valid.
+ * \retval #PSA_ERROR_INVALID_SIGNATURE
+ *         The calculation was performed successfully, but at least one
+ *         signature is not valid.
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ * \retval #PSA_ERROR_INVALID_ARGUMENT
+ * \retval #PSA_ERROR_INSUFFICIENT_MEMORY
+ */
+psa_status_t mbedtls_psa_ecdsa_verify_hash_batch(
+    const psa_key_attributes_t * const attributes[],
+    const uint8_t * const key_buffers[], const size_t key_buffer_sizes[],
+    psa_algorithm_t alg,
+    const uint8_t * const hashes[], const size_t hash_lengths[],
+    const uint8_t * const signatures[], const size_t signature_lengths[],
+    size_t count, uint8_t *results );
 #endif /* PSA_CRYPTO_ECP_H */
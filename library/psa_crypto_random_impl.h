@@ -121,7 +121,11 @@ typedef struct
     void (* entropy_init )( mbedtls_entropy_context *ctx );
     void (* entropy_free )( mbedtls_entropy_context *ctx );
     mbedtls_entropy_context entropy;
+#if !defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+    /* With MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD, each thread has its own
+     * DRBG instance, managed in psa_crypto.c. */
     mbedtls_psa_drbg_context_t drbg;
+#endif
 } mbedtls_psa_random_context_t;
 
 /* Defined in include/mbedtls/psa_util.h so that it's visible to
@@ -134,7 +138,11 @@ typedef struct
  * Observed with Visual Studio 2013. A known bug apparently:
  * https://stackoverflow.com/questions/8146541/duplicate-external-static-declarations-not-allowed-in-visual-studio
  */
-#if !defined(_MSC_VER)
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+int mbedtls_psa_get_random( void *p_rng,
+                            unsigned char *output,
+                            size_t output_size );
+#elif !defined(_MSC_VER)
 static mbedtls_f_rng_t *const mbedtls_psa_get_random;
 #endif
 
@@ -147,6 +155,13 @@ static mbedtls_f_rng_t *const mbedtls_psa_get_random;
 #define MBEDTLS_PSA_RANDOM_MAX_REQUEST MBEDTLS_HMAC_DRBG_MAX_REQUEST
 #endif
 
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+
+/* mbedtls_psa_get_random() finds the DRBG of the calling thread by itself. */
+#define MBEDTLS_PSA_RANDOM_STATE NULL
+
+#else /* MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD */
+
 /** A pointer to the PSA DRBG state.
  *
  * This variable is only intended to be used through the macro
@@ -169,8 +184,11 @@ extern mbedtls_psa_drbg_context_t *const mbedtls_psa_random_state;
  */
 #define MBEDTLS_PSA_RANDOM_STATE mbedtls_psa_random_state
 
+#endif /* MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD */
+
 /** Seed the PSA DRBG.
  *
+ * \param drbg_ctx      The DRBG context to seed.
  * \param entropy       An entropy context to read the seed from.
  * \param custom        The personalization string.
  *                      This can be \c NULL, in which case the personalization
@@ -181,18 +199,19 @@ extern mbedtls_psa_drbg_context_t *const mbedtls_psa_random_state;
  * \return              An Mbed TLS error code (\c MBEDTLS_ERR_xxx) on failure.
  */
 static inline int mbedtls_psa_drbg_seed(
+    mbedtls_psa_drbg_context_t *drbg_ctx,
     mbedtls_entropy_context *entropy,
     const unsigned char *custom, size_t len )
 {
 #if defined(MBEDTLS_CTR_DRBG_C)
-    return( mbedtls_ctr_drbg_seed( MBEDTLS_PSA_RANDOM_STATE,
+    return( mbedtls_ctr_drbg_seed( drbg_ctx,
                                    mbedtls_entropy_func,
                                    entropy,
                                    custom, len ) );
 #elif defined(MBEDTLS_HMAC_DRBG_C)
     const mbedtls_md_info_t *md_info =
         mbedtls_md_info_from_type( MBEDTLS_PSA_HMAC_DRBG_MD_TYPE );
-    return( mbedtls_hmac_drbg_seed( MBEDTLS_PSA_RANDOM_STATE,
+    return( mbedtls_hmac_drbg_seed( drbg_ctx,
                                     md_info,
                                     mbedtls_entropy_func,
                                     entropy,
@@ -200,6 +219,51 @@ static inline int mbedtls_psa_drbg_seed(
 #endif
 }
 
+#if defined(MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD)
+/** Reseed the PSA DRBG from the entropy source it was seeded from.
+ *
+ * \param drbg_ctx      The DRBG context to reseed.
+ *
+ * \return              \c 0 on success.
+ * \return              An Mbed TLS error code (\c MBEDTLS_ERR_xxx) on failure.
+ */
+static inline int mbedtls_psa_drbg_reseed(
+    mbedtls_psa_drbg_context_t *drbg_ctx )
+{
+#if defined(MBEDTLS_CTR_DRBG_C)
+    return( mbedtls_ctr_drbg_reseed( drbg_ctx, NULL, 0 ) );
+#elif defined(MBEDTLS_HMAC_DRBG_C)
+    return( mbedtls_hmac_drbg_reseed( drbg_ctx, NULL, 0 ) );
+#endif
+}
+
+/** Generate random data from a PSA DRBG owned by the calling thread.
+ *
+ * Unlike mbedtls_ctr_drbg_random() and mbedtls_hmac_drbg_random(), this
+ * does not lock the DRBG context's mutex. The caller holds the mutex of the
+ * per-thread instance instead.
+ *
+ * \param drbg_ctx      The DRBG context.
+ * \param output        The buffer to fill.
+ * \param output_size   The number of bytes to write to \p output.
+ *
+ * \return              \c 0 on success.
+ * \return              An Mbed TLS error code (\c MBEDTLS_ERR_xxx) on failure.
+ */
+static inline int mbedtls_psa_drbg_random_unlocked(
+    mbedtls_psa_drbg_context_t *drbg_ctx,
+    unsigned char *output, size_t output_size )
+{
+#if defined(MBEDTLS_CTR_DRBG_C)
+    return( mbedtls_ctr_drbg_random_with_add( drbg_ctx, output, output_size,
+                                              NULL, 0 ) );
+#elif defined(MBEDTLS_HMAC_DRBG_C)
+    return( mbedtls_hmac_drbg_random_with_add( drbg_ctx, output, output_size,
+                                               NULL, 0 ) );
+#endif
+}
+#endif /* MBEDTLS_PSA_CRYPTO_RNG_PER_THREAD */
+
 #endif /* MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG */
 
 #endif /* PSA_CRYPTO_RANDOM_IMPL_H */
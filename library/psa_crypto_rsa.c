@@ -118,6 +118,68 @@ exit:
     mbedtls_pk_free( &ctx );
     return( status );
 }
+
+psa_status_t mbedtls_psa_rsa_get_representation(
+    const psa_key_attributes_t *attributes,
+    const uint8_t *key_buffer, size_t key_buffer_size,
+    mbedtls_rsa_context **p_rsa )
+{
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+    psa_key_representation_cache_t *cache =
+        psa_get_key_representation_cache( attributes );
+
+    if( psa_acquire_key_representation( cache ) )
+    {
+        if( cache->representation == NULL )
+        {
+            mbedtls_rsa_context *rsa = NULL;
+            psa_status_t status = mbedtls_psa_rsa_load_representation(
+                attributes->core.type, key_buffer, key_buffer_size, &rsa );
+            if( status != PSA_SUCCESS )
+            {
+                (void) psa_release_key_representation( cache, NULL );
+                return( status );
+            }
+            psa_fill_key_representation( cache, rsa );
+            *p_rsa = rsa;
+        }
+        else
+            *p_rsa = cache->representation;
+        return( PSA_SUCCESS );
+    }
+#endif /* MBEDTLS_PSA_KEY_REPRESENTATION_CACHE */
+
+    return( mbedtls_psa_rsa_load_representation( attributes->core.type,
+                                                  key_buffer,
+                                                  key_buffer_size,
+                                                  p_rsa ) );
+}
+
+void mbedtls_psa_rsa_release_representation(
+    const psa_key_attributes_t *attributes,
+    mbedtls_rsa_context *rsa )
+{
+#if defined(MBEDTLS_PSA_KEY_REPRESENTATION_CACHE)
+    psa_key_representation_cache_t *cache =
+        psa_get_key_representation_cache( attributes );
+
+    if( rsa == NULL )
+        return;
+
+    /* Leave the context as mbedtls_psa_rsa_load_representation() creates
+     * it, so that the next operation finds the default padding mode if it
+     * is the cached one. This cannot fail. */
+    (void) mbedtls_rsa_set_padding( rsa, MBEDTLS_RSA_PKCS_V15,
+                                    MBEDTLS_MD_NONE );
+    if( psa_release_key_representation( cache, rsa ) )
+        return;
+#else
+    (void) attributes;
+#endif /* MBEDTLS_PSA_KEY_REPRESENTATION_CACHE */
+
+    mbedtls_rsa_free( rsa );
+    mbedtls_free( rsa );
+}
 #endif /* defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_PKCS1V15_CRYPT) ||
         * defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_OAEP) ||
         * defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_PKCS1V15_SIGN) ||
@@ -228,8 +290,10 @@ psa_status_t mbedtls_psa_rsa_export_public_key(
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
     mbedtls_rsa_context *rsa = NULL;
 
-    status = mbedtls_psa_rsa_load_representation(
-                 attributes->core.type, key_buffer, key_buffer_size, &rsa );
+    status = mbedtls_psa_rsa_get_representation( attributes,
+                                                 key_buffer,
+                                                 key_buffer_size,
+                                                 &rsa );
     if( status != PSA_SUCCESS )
         return( status );
 
@@ -239,8 +303,7 @@ psa_status_t mbedtls_psa_rsa_export_public_key(
                                          data_size,
                                          data_length );
 
-    mbedtls_rsa_free( rsa );
-    mbedtls_free( rsa );
+    mbedtls_psa_rsa_release_representation( attributes, rsa );
 
     return( status );
 }
@@ -356,10 +419,10 @@ psa_status_t mbedtls_psa_rsa_sign_hash(
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
     mbedtls_md_type_t md_alg;
 
-    status = mbedtls_psa_rsa_load_representation( attributes->core.type,
-                                                  key_buffer,
-                                                  key_buffer_size,
-                                                  &rsa );
+    status = mbedtls_psa_rsa_get_representation( attributes,
+                                                 key_buffer,
+                                                 key_buffer_size,
+                                                 &rsa );
     if( status != PSA_SUCCESS )
         return( status );
 
@@ -419,8 +482,7 @@ psa_status_t mbedtls_psa_rsa_sign_hash(
     status = mbedtls_to_psa_error( ret );
 
 exit:
-    mbedtls_rsa_free( rsa );
-    mbedtls_free( rsa );
+    mbedtls_psa_rsa_release_representation( attributes, rsa );
 
     return( status );
 }
@@ -457,10 +519,10 @@ psa_status_t mbedtls_psa_rsa_verify_hash(
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
     mbedtls_md_type_t md_alg;
 
-    status = mbedtls_psa_rsa_load_representation( attributes->core.type,
-                                                  key_buffer,
-                                                  key_buffer_size,
-                                                  &rsa );
+    status = mbedtls_psa_rsa_get_representation( attributes,
+                                                 key_buffer,
+                                                 key_buffer_size,
+                                                 &rsa );
     if( status != PSA_SUCCESS )
         goto exit;
 
@@ -521,8 +583,7 @@ psa_status_t mbedtls_psa_rsa_verify_hash(
              mbedtls_to_psa_error( ret );
 
 exit:
-    mbedtls_rsa_free( rsa );
-    mbedtls_free( rsa );
+    mbedtls_psa_rsa_release_representation( attributes, rsa );
 
     return( status );
 }
@@ -573,10 +634,10 @@ psa_status_t mbedtls_psa_asymmetric_encrypt( const psa_key_attributes_t *attribu
 #if defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_PKCS1V15_CRYPT) || \
     defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_OAEP)
         mbedtls_rsa_context *rsa = NULL;
-        status = mbedtls_psa_rsa_load_representation( attributes->core.type,
-                                                      key_buffer,
-                                                      key_buffer_size,
-                                                      &rsa );
+        status = mbedtls_psa_rsa_get_representation( attributes,
+                                                     key_buffer,
+                                                     key_buffer_size,
+                                                     &rsa );
         if( status != PSA_SUCCESS )
             goto rsa_exit;
 
@@ -632,8 +693,7 @@ rsa_exit:
         if( status == PSA_SUCCESS )
             *output_length = mbedtls_rsa_get_len( rsa );
 
-        mbedtls_rsa_free( rsa );
-        mbedtls_free( rsa );
+        mbedtls_psa_rsa_release_representation( attributes, rsa );
 #endif /* defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_PKCS1V15_CRYPT) ||
         * defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_OAEP) */
     }
@@ -675,10 +735,10 @@ psa_status_t mbedtls_psa_asymmetric_decrypt( const psa_key_attributes_t *attribu
 #if defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_PKCS1V15_CRYPT) || \
     defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_OAEP)
         mbedtls_rsa_context *rsa = NULL;
-        status = mbedtls_psa_rsa_load_representation( attributes->core.type,
-                                                      key_buffer,
-                                                      key_buffer_size,
-                                                      &rsa );
+        status = mbedtls_psa_rsa_get_representation( attributes,
+                                                     key_buffer,
+                                                     key_buffer_size,
+                                                     &rsa );
         if( status != PSA_SUCCESS )
             goto rsa_exit;
 
@@ -735,8 +795,7 @@ psa_status_t mbedtls_psa_asymmetric_decrypt( const psa_key_attributes_t *attribu
 #if defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_PKCS1V15_CRYPT) || \
     defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_OAEP)
 rsa_exit:
-        mbedtls_rsa_free( rsa );
-        mbedtls_free( rsa );
+        mbedtls_psa_rsa_release_representation( attributes, rsa );
 #endif /* defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_PKCS1V15_CRYPT) ||
         * defined(MBEDTLS_PSA_BUILTIN_ALG_RSA_OAEP) */
     }
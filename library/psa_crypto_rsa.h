@@ -39,6 +39,41 @@ psa_status_t mbedtls_psa_rsa_load_representation( psa_key_type_t type,
                                                   size_t data_length,
                                                   mbedtls_rsa_context **p_rsa );
 
+/** Get the internal RSA representation of a key buffer for an operation
+ *
+ * If \p attributes were built from a key slot with psa_key_slot_attributes()
+ * and #MBEDTLS_PSA_KEY_REPRESENTATION_CACHE is enabled, the representation is
+ * taken from the slot's cache, and loaded into it on first use. Otherwise, or if the cached
+ * representation is already in use, this function behaves like
+ * mbedtls_psa_rsa_load_representation().
+ *
+ * The padding mode of the returned context is always PKCS#1 v1.5, as for a
+ * freshly loaded context.
+ *
+ * \param[in] attributes        The attributes of the key.
+ * \param[in] key_buffer        The buffer containing the key data.
+ * \param[in] key_buffer_size   The size in bytes of \p key_buffer.
+ * \param[out] p_rsa            Returns a pointer to an RSA context on success.
+ *                              The caller must release it with
+ *                              mbedtls_psa_rsa_release_representation()
+ *                              when done, and may only change its padding
+ *                              mode.
+ */
+psa_status_t mbedtls_psa_rsa_get_representation(
+    const psa_key_attributes_t *attributes,
+    const uint8_t *key_buffer, size_t key_buffer_size,
+    mbedtls_rsa_context **p_rsa );
+
+/** Release an RSA representation obtained with
+ * mbedtls_psa_rsa_get_representation().
+ *
+ * \param[in] attributes        The attributes passed when getting \p rsa.
+ * \param[in] rsa               The RSA context to release. May be NULL.
+ */
+void mbedtls_psa_rsa_release_representation(
+    const psa_key_attributes_t *attributes,
+    mbedtls_rsa_context *rsa );
+
 /** Import an RSA key in binary format.
  *
  * \note The signature of this function is that of a PSA driver
@@ -38,14 +38,179 @@
 
 #define ARRAY_LENGTH( array ) ( sizeof( array ) / sizeof( *( array ) ) )
 
+/* The key slot table is made of blocks of MBEDTLS_PSA_KEY_SLOT_COUNT slots.
+ * The first block is allocated statically, the others are allocated on
+ * demand. Blocks never move, so that pointers to key slots remain valid. */
+#define PSA_KEY_SLOT_BLOCK_SIZE   MBEDTLS_PSA_KEY_SLOT_COUNT
+#define PSA_KEY_SLOT_BLOCK_COUNT  ( ( MBEDTLS_PSA_KEY_SLOT_MAX_COUNT +      \
+                                      PSA_KEY_SLOT_BLOCK_SIZE - 1 ) /      \
+                                    PSA_KEY_SLOT_BLOCK_SIZE )
+
+/* Lists that a key slot can be in (psa_key_slot_t::links::list). */
+#define PSA_KEY_SLOT_LIST_NONE      0 /* In use, or not evictable */
+#define PSA_KEY_SLOT_LIST_FREE      1 /* Empty */
+#define PSA_KEY_SLOT_LIST_EVICTABLE 2 /* Unlocked persistent key */
+
 typedef struct
 {
-    psa_key_slot_t key_slots[MBEDTLS_PSA_KEY_SLOT_COUNT];
+    psa_key_slot_t key_slots[PSA_KEY_SLOT_BLOCK_SIZE];
+    size_t key_slot_buckets[PSA_KEY_SLOT_BLOCK_SIZE];
+    psa_key_slot_t *blocks[PSA_KEY_SLOT_BLOCK_COUNT];
+    /* Number of key slots in the allocated blocks. */
+    size_t slot_count;
+    /* Hash table of the slots containing persistent keys, with one bucket
+     * per key slot. */
+    size_t *buckets;
+    /* Singly linked list of empty slots. */
+    size_t free_head;
+    /* Doubly linked list of the unlocked slots containing a persistent key,
+     * from the least recently used to the most recently used. */
+    size_t evictable_head;
+    size_t evictable_tail;
     unsigned key_slots_initialized : 1;
 } psa_global_data_t;
 
 static psa_global_data_t global_data;
 
+static psa_key_slot_t *psa_key_slot_at( size_t index )
+{
+    return( &global_data.blocks[index / PSA_KEY_SLOT_BLOCK_SIZE]
+                               [index % PSA_KEY_SLOT_BLOCK_SIZE] );
+}
+
+static size_t psa_key_id_bucket( mbedtls_svc_key_id_t key )
+{
+    uint32_t hash = MBEDTLS_SVC_KEY_ID_GET_KEY_ID( key );
+
+#if defined(MBEDTLS_PSA_CRYPTO_KEY_ID_ENCODES_OWNER)
+    hash ^= (uint32_t) MBEDTLS_SVC_KEY_ID_GET_OWNER_ID( key ) * 0x85EBCA6Bu;
+#endif
+    hash *= 0x9E3779B1u;
+    hash ^= hash >> 16;
+
+    return( hash % global_data.slot_count );
+}
+
+/* Whether a key slot is in a bucket of the key identifier index. Slots
+ * containing a volatile key are found through their index instead. */
+static int psa_key_slot_is_in_bucket( const psa_key_slot_t *slot )
+{
+    return( slot->links.indexed &&
+            ! psa_key_id_is_volatile(
+                MBEDTLS_SVC_KEY_ID_GET_KEY_ID( slot->attr.id ) ) );
+}
+
+static void psa_push_free_key_slot( psa_key_slot_t *slot )
+{
+    slot->links.next = global_data.free_head;
+    slot->links.prev = PSA_KEY_SLOT_NONE;
+    slot->links.list = PSA_KEY_SLOT_LIST_FREE;
+    global_data.free_head = slot->links.index;
+}
+
+static psa_key_slot_t *psa_pop_free_key_slot( void )
+{
+    psa_key_slot_t *slot;
+
+    if( global_data.free_head == PSA_KEY_SLOT_NONE )
+        return( NULL );
+
+    slot = psa_key_slot_at( global_data.free_head );
+    global_data.free_head = slot->links.next;
+    slot->links.next = PSA_KEY_SLOT_NONE;
+    slot->links.list = PSA_KEY_SLOT_LIST_NONE;
+
+    return( slot );
+}
+
+static void psa_append_evictable_key_slot( psa_key_slot_t *slot )
+{
+    slot->links.next = PSA_KEY_SLOT_NONE;
+    slot->links.prev = global_data.evictable_tail;
+    if( global_data.evictable_tail != PSA_KEY_SLOT_NONE )
+        psa_key_slot_at( global_data.evictable_tail )->links.next =
+            slot->links.index;
+    else
+        global_data.evictable_head = slot->links.index;
+    global_data.evictable_tail = slot->links.index;
+    slot->links.list = PSA_KEY_SLOT_LIST_EVICTABLE;
+}
+
+static void psa_remove_evictable_key_slot( psa_key_slot_t *slot )
+{
+    if( slot->links.prev != PSA_KEY_SLOT_NONE )
+        psa_key_slot_at( slot->links.prev )->links.next = slot->links.next;
+    else
+        global_data.evictable_head = slot->links.next;
+
+    if( slot->links.next != PSA_KEY_SLOT_NONE )
+        psa_key_slot_at( slot->links.next )->links.prev = slot->links.prev;
+    else
+        global_data.evictable_tail = slot->links.prev;
+
+    slot->links.prev = PSA_KEY_SLOT_NONE;
+    slot->links.next = PSA_KEY_SLOT_NONE;
+    slot->links.list = PSA_KEY_SLOT_LIST_NONE;
+}
+
+/* Add a block of key slots to the key slot table, and rebuild the key
+ * identifier index with as many buckets as there are key slots. */
+static psa_status_t psa_extend_key_slots( void )
+{
+    size_t old_count = global_data.slot_count;
+    size_t new_count, i;
+    psa_key_slot_t *block = NULL;
+    size_t *buckets = NULL;
+
+    if( old_count >= MBEDTLS_PSA_KEY_SLOT_MAX_COUNT )
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+
+    new_count = old_count + PSA_KEY_SLOT_BLOCK_SIZE;
+    if( new_count > MBEDTLS_PSA_KEY_SLOT_MAX_COUNT )
+        new_count = MBEDTLS_PSA_KEY_SLOT_MAX_COUNT;
+
+    block = mbedtls_calloc( new_count - old_count, sizeof( *block ) );
+    buckets = mbedtls_calloc( new_count, sizeof( *buckets ) );
+    if( block == NULL || buckets == NULL )
+    {
+        mbedtls_free( block );
+        mbedtls_free( buckets );
+        return( PSA_ERROR_INSUFFICIENT_MEMORY );
+    }
+
+    global_data.blocks[old_count / PSA_KEY_SLOT_BLOCK_SIZE] = block;
+    if( global_data.buckets != global_data.key_slot_buckets )
+        mbedtls_free( global_data.buckets );
+    global_data.buckets = buckets;
+    global_data.slot_count = new_count;
+
+    for( i = 0; i < new_count; i++ )
+        buckets[i] = PSA_KEY_SLOT_NONE;
+
+    for( i = 0; i < old_count; i++ )
+    {
+        psa_key_slot_t *slot = psa_key_slot_at( i );
+        if( psa_key_slot_is_in_bucket( slot ) )
+        {
+            size_t bucket = psa_key_id_bucket( slot->attr.id );
+            slot->links.bucket_next = buckets[bucket];
+            buckets[bucket] = i;
+        }
+    }
+
+    /* Push the new slots in reverse order, so that they are handed out
+     * in increasing order. */
+    for( i = new_count; i > old_count; i-- )
+    {
+        psa_key_slot_t *slot = psa_key_slot_at( i - 1 );
+        slot->links.index = i - 1;
+        slot->links.bucket_next = PSA_KEY_SLOT_NONE;
+        psa_push_free_key_slot( slot );
+    }
+
+    return( PSA_SUCCESS );
+}
+
 int psa_is_valid_key_id( mbedtls_svc_key_id_t key, int vendor_ok )
 {
     psa_key_id_t key_id = MBEDTLS_SVC_KEY_ID_GET_KEY_ID( key );
@@ -75,11 +240,15 @@ int psa_is_valid_key_id( mbedtls_svc_key_id_t key, int vendor_ok )
  *
  * For volatile key identifiers, only one key slot is queried as a volatile
  * key with identifier key_id can only be stored in slot of index
- * ( key_id - #PSA_KEY_ID_VOLATILE_MIN ).
+ * ( key_id - #PSA_KEY_ID_VOLATILE_MIN ). For other key identifiers, only
+ * the key slots in the bucket of the key identifier index that corresponds
+ * to \p key are queried.
  *
  * On success, the function locks the key slot. It is the responsibility of
  * the caller to unlock the key slot when it does not access it anymore.
  *
+ * The caller must hold the key slot mutex.
+ *
  * \param key           Key identifier to query.
  * \param[out] p_slot   On success, `*p_slot` contains a pointer to the
  *                      key slot containing the description of the key
@@ -103,17 +272,23 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(
 
     if( psa_key_id_is_volatile( key_id ) )
     {
-        slot = &global_data.key_slots[ key_id - PSA_KEY_ID_VOLATILE_MIN ];
+        slot_idx = key_id - PSA_KEY_ID_VOLATILE_MIN;
+        if( slot_idx >= global_data.slot_count )
+            return( PSA_ERROR_DOES_NOT_EXIST );
+
+        slot = psa_key_slot_at( slot_idx );
 
         /*
          * Check if both the PSA key identifier key_id and the owner
-         * identifier of key match those of the key slot.
+         * identifier of key match those of the key slot, and that the key
+         * is complete.
          *
          * Note that, if the key slot is not occupied, its PSA key identifier
          * is equal to zero. This is an invalid value for a PSA key identifier
          * and thus cannot be equal to the valid PSA key identifier key_id.
          */
-        status = mbedtls_svc_key_id_equal( key, slot->attr.id ) ?
+        status = ( slot->links.indexed &&
+                   mbedtls_svc_key_id_equal( key, slot->attr.id ) ) ?
                  PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST;
     }
     else
@@ -121,14 +296,21 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(
         if ( !psa_is_valid_key_id( key, 1 ) )
             return( PSA_ERROR_INVALID_HANDLE );
 
-        for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
+        if( global_data.slot_count == 0 )
+            return( PSA_ERROR_DOES_NOT_EXIST );
+
+        status = PSA_ERROR_DOES_NOT_EXIST;
+        for( slot_idx = global_data.buckets[psa_key_id_bucket( key )];
+             slot_idx != PSA_KEY_SLOT_NONE;
+             slot_idx = slot->links.bucket_next )
         {
-            slot = &global_data.key_slots[ slot_idx ];
+            slot = psa_key_slot_at( slot_idx );
             if( mbedtls_svc_key_id_equal( key, slot->attr.id ) )
+            {
+                status = PSA_SUCCESS;
                 break;
+            }
         }
-        status = ( slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT ) ?
-                 PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST;
     }
 
     if( status == PSA_SUCCESS )
@@ -143,32 +325,117 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(
 
 psa_status_t psa_initialize_key_slots( void )
 {
-    /* Nothing to do: program startup and psa_wipe_all_key_slots() both
-     * guarantee that the key slots are initialized to all-zero, which
-     * means that all the key slots are in a valid, empty state. */
+    psa_status_t status;
+    size_t slot_idx;
+
+    status = psa_key_slot_mutex_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    /* Program startup and psa_wipe_all_key_slots() both guarantee that the
+     * key slots are initialized to all-zero, which means that all the key
+     * slots are in a valid, empty state. Only the bookkeeping of the slot
+     * manager needs to be set up. */
+    global_data.blocks[0] = global_data.key_slots;
+    global_data.buckets = global_data.key_slot_buckets;
+    global_data.slot_count = PSA_KEY_SLOT_BLOCK_SIZE;
+    global_data.free_head = PSA_KEY_SLOT_NONE;
+    global_data.evictable_head = PSA_KEY_SLOT_NONE;
+    global_data.evictable_tail = PSA_KEY_SLOT_NONE;
+
+    for( slot_idx = PSA_KEY_SLOT_BLOCK_SIZE; slot_idx > 0; slot_idx-- )
+    {
+        psa_key_slot_t *slot = &global_data.key_slots[ slot_idx - 1 ];
+        slot->links.index = slot_idx - 1;
+        slot->links.bucket_next = PSA_KEY_SLOT_NONE;
+        slot->links.indexed = 0;
+        global_data.key_slot_buckets[ slot_idx - 1 ] = PSA_KEY_SLOT_NONE;
+        psa_push_free_key_slot( slot );
+    }
+
     global_data.key_slots_initialized = 1;
-    return( PSA_SUCCESS );
+
+    return( psa_key_slot_mutex_unlock( ) );
 }
 
 void psa_wipe_all_key_slots( void )
 {
     size_t slot_idx;
 
-    for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
+    /* Wipe the key slots even if the mutex cannot be taken: no other
+     * thread is allowed to use keys at this point. */
+    psa_status_t status = psa_key_slot_mutex_lock( );
+
+    for( slot_idx = 0; slot_idx < global_data.slot_count; slot_idx++ )
     {
-        psa_key_slot_t *slot = &global_data.key_slots[ slot_idx ];
+        psa_key_slot_t *slot = psa_key_slot_at( slot_idx );
         slot->lock_count = 1;
         (void) psa_wipe_key_slot( slot );
     }
+
+    for( slot_idx = 1; slot_idx < PSA_KEY_SLOT_BLOCK_COUNT; slot_idx++ )
+    {
+        mbedtls_free( global_data.blocks[slot_idx] );
+        global_data.blocks[slot_idx] = NULL;
+    }
+    if( global_data.buckets != global_data.key_slot_buckets )
+        mbedtls_free( global_data.buckets );
+    global_data.buckets = NULL;
+    global_data.slot_count = 0;
+
     global_data.key_slots_initialized = 0;
+
+    if( status == PSA_SUCCESS )
+        (void) psa_key_slot_mutex_unlock( );
+}
+
+void psa_register_key_slot( psa_key_slot_t *slot )
+{
+    size_t bucket;
+
+    slot->links.indexed = 1;
+
+    /* The identifier of a volatile key designates its slot directly. */
+    if( psa_key_id_is_volatile( MBEDTLS_SVC_KEY_ID_GET_KEY_ID( slot->attr.id ) ) )
+        return;
+
+    bucket = psa_key_id_bucket( slot->attr.id );
+    slot->links.bucket_next = global_data.buckets[bucket];
+    global_data.buckets[bucket] = slot->links.index;
+}
+
+void psa_unindex_key_slot( psa_key_slot_t *slot )
+{
+    if( slot->links.list == PSA_KEY_SLOT_LIST_EVICTABLE )
+        psa_remove_evictable_key_slot( slot );
+
+    if( psa_key_slot_is_in_bucket( slot ) )
+    {
+        size_t *link = &global_data.buckets[psa_key_id_bucket( slot->attr.id )];
+
+        while( *link != slot->links.index )
+            link = &psa_key_slot_at( *link )->links.bucket_next;
+        *link = slot->links.bucket_next;
+
+        slot->links.bucket_next = PSA_KEY_SLOT_NONE;
+    }
+    slot->links.indexed = 0;
+}
+
+void psa_unregister_key_slot( psa_key_slot_t *slot )
+{
+    if( slot->links.list == PSA_KEY_SLOT_LIST_FREE )
+        return;
+
+    psa_unindex_key_slot( slot );
+    psa_push_free_key_slot( slot );
 }
 
 psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
                                      psa_key_slot_t **p_slot )
 {
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-    size_t slot_idx;
-    psa_key_slot_t *selected_slot, *unlocked_persistent_key_slot;
+    psa_key_slot_t *selected_slot;
 
     if( ! global_data.key_slots_initialized )
     {
@@ -176,37 +443,24 @@ psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
         goto error;
     }
 
-    selected_slot = unlocked_persistent_key_slot = NULL;
-    for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
-    {
-        psa_key_slot_t *slot = &global_data.key_slots[ slot_idx ];
-        if( ! psa_is_key_slot_occupied( slot ) )
-        {
-            selected_slot = slot;
-            break;
-        }
-
-        if( ( unlocked_persistent_key_slot == NULL ) &&
-            ( ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) ) &&
-            ( ! psa_is_key_slot_locked( slot ) ) )
-            unlocked_persistent_key_slot = slot;
-    }
-
     /*
-     * If there is no unused key slot and there is at least one unlocked key
-     * slot containing the description of a persistent key, recycle the first
-     * such key slot we encountered. If we later need to operate on the
-     * persistent key we are evicting now, we will reload its description from
-     * storage.
+     * If there is no unused key slot, try to extend the key slot table.
+     * If it has reached its maximum size but there is at least one unlocked
+     * key slot containing the description of a persistent key, recycle the
+     * least recently used such key slot. If we later need to operate on the
+     * persistent key we are evicting now, we will reload its description
+     * from storage.
      */
-    if( ( selected_slot == NULL ) &&
-        ( unlocked_persistent_key_slot != NULL ) )
+    if( global_data.free_head == PSA_KEY_SLOT_NONE &&
+        psa_extend_key_slots( ) != PSA_SUCCESS &&
+        global_data.evictable_head != PSA_KEY_SLOT_NONE )
     {
-        selected_slot = unlocked_persistent_key_slot;
+        selected_slot = psa_key_slot_at( global_data.evictable_head );
         selected_slot->lock_count = 1;
         psa_wipe_key_slot( selected_slot );
     }
 
+    selected_slot = psa_pop_free_key_slot( );
     if( selected_slot != NULL )
     {
        status = psa_lock_key_slot( selected_slot );
@@ -214,7 +468,7 @@ psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
            goto error;
 
         *volatile_key_id = PSA_KEY_ID_VOLATILE_MIN +
-            ( (psa_key_id_t)( selected_slot - global_data.key_slots ) );
+            ( (psa_key_id_t) selected_slot->links.index );
         *p_slot = selected_slot;
 
         return( PSA_SUCCESS );
@@ -340,70 +594,185 @@ exit:
 }
 #endif /* MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
 
-psa_status_t psa_get_and_lock_key_slot( mbedtls_svc_key_id_t key,
-                                        psa_key_slot_t **p_slot )
+/* Look a key up in memory with the key slot mutex held. */
+static psa_status_t psa_find_and_lock_key_slot( mbedtls_svc_key_id_t key,
+                                                psa_key_slot_t **p_slot )
 {
-    psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+    psa_status_t status, unlock_status;
+
+    status = psa_key_slot_mutex_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
 
-    *p_slot = NULL;
     if( ! global_data.key_slots_initialized )
-        return( PSA_ERROR_BAD_STATE );
+        status = PSA_ERROR_BAD_STATE;
+    else
+        status = psa_get_and_lock_key_slot_in_memory( key, p_slot );
 
-    /*
-     * On success, the pointer to the slot is passed directly to the caller
-     * thus no need to unlock the key slot here.
-     */
-    status = psa_get_and_lock_key_slot_in_memory( key, p_slot );
-    if( status != PSA_ERROR_DOES_NOT_EXIST )
-        return( status );
+    unlock_status = psa_key_slot_mutex_unlock( );
+    if( unlock_status != PSA_SUCCESS && status == PSA_SUCCESS )
+    {
+        /* The mutex is in an unknown state: do not touch the slot again. */
+        *p_slot = NULL;
+        status = unlock_status;
+    }
+
+    return( status );
+}
 
-    /* Loading keys from storage requires support for such a mechanism */
 #if defined(MBEDTLS_PSA_CRYPTO_STORAGE_C) || \
     defined(MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS)
+/* Load a key that is not in memory into a key slot and lock it.
+ *
+ * The key storage mutex is held throughout, so that two threads cannot load
+ * the same key into two slots, but the key slot mutex is only held to find
+ * and register the slot: the slot is filled while other threads look up
+ * keys. Until it is registered, the slot is locked and not findable, so no
+ * other thread can reach it. */
+static psa_status_t psa_load_and_lock_key_slot( mbedtls_svc_key_id_t key,
+                                                psa_key_slot_t **p_slot )
+{
+    psa_status_t status, lock_status, unlock_status = PSA_SUCCESS;
     psa_key_id_t volatile_key_id;
+    psa_key_slot_t *slot = NULL;
 
-    status = psa_get_empty_key_slot( &volatile_key_id, p_slot );
+    status = psa_key_storage_mutex_lock( );
     if( status != PSA_SUCCESS )
         return( status );
 
-    (*p_slot)->attr.id = key;
-    (*p_slot)->attr.lifetime = PSA_KEY_LIFETIME_PERSISTENT;
+    status = psa_key_slot_mutex_lock( );
+    if( status != PSA_SUCCESS )
+        goto exit;
+
+    /* Another thread may have loaded the key while this one was waiting
+     * for the storage mutex. */
+    if( ! global_data.key_slots_initialized )
+        status = PSA_ERROR_BAD_STATE;
+    else
+        status = psa_get_and_lock_key_slot_in_memory( key, p_slot );
+
+    if( status == PSA_ERROR_DOES_NOT_EXIST )
+    {
+        status = psa_get_empty_key_slot( &volatile_key_id, &slot );
+        if( status == PSA_SUCCESS )
+        {
+            slot->attr.id = key;
+            slot->attr.lifetime = PSA_KEY_LIFETIME_PERSISTENT;
+        }
+    }
+
+    unlock_status = psa_key_slot_mutex_unlock( );
+    if( status != PSA_SUCCESS || slot == NULL )
+        goto exit;
 
-    status = PSA_ERROR_DOES_NOT_EXIST;
+    status = unlock_status;
+    if( status == PSA_SUCCESS )
+        status = PSA_ERROR_DOES_NOT_EXIST;
 #if defined(MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS)
     /* Load keys in the 'builtin' range through their own interface */
-    status = psa_load_builtin_key_into_slot( *p_slot );
+    if( status == PSA_ERROR_DOES_NOT_EXIST )
+        status = psa_load_builtin_key_into_slot( slot );
 #endif /* MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
 
 #if defined(MBEDTLS_PSA_CRYPTO_STORAGE_C)
     if( status == PSA_ERROR_DOES_NOT_EXIST )
-        status = psa_load_persistent_key_into_slot( *p_slot );
+        status = psa_load_persistent_key_into_slot( slot );
 #endif /* defined(MBEDTLS_PSA_CRYPTO_STORAGE_C) */
 
-    if( status != PSA_SUCCESS )
+    lock_status = psa_key_slot_mutex_lock( );
+    if( status == PSA_SUCCESS )
+        status = lock_status;
+
+    if( status == PSA_SUCCESS )
     {
-        psa_wipe_key_slot( *p_slot );
+        /* Add implicit usage flags. */
+        psa_extend_key_usage_flags( &slot->attr.policy.usage );
+        psa_register_key_slot( slot );
+        *p_slot = slot;
+    }
+    else
+    {
+        /* Wipe the slot even if the mutex cannot be taken: it is not
+         * registered, so no other thread can reach it. */
+        psa_wipe_key_slot( slot );
         if( status == PSA_ERROR_DOES_NOT_EXIST )
             status = PSA_ERROR_INVALID_HANDLE;
     }
-    else
-        /* Add implicit usage flags. */
-        psa_extend_key_usage_flags( &(*p_slot)->attr.policy.usage );
+
+    if( lock_status == PSA_SUCCESS )
+        unlock_status = psa_key_slot_mutex_unlock( );
+
+exit:
+    if( status == PSA_SUCCESS )
+        status = unlock_status;
+    unlock_status = psa_key_storage_mutex_unlock( );
+    if( status == PSA_SUCCESS )
+        status = unlock_status;
+    if( status != PSA_SUCCESS )
+    {
+        /* The mutexes are in an unknown state: do not touch the slot
+         * again. */
+        *p_slot = NULL;
+    }
 
     return( status );
+}
+#endif /* MBEDTLS_PSA_CRYPTO_STORAGE_C || MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
+
+psa_status_t psa_get_and_lock_key_slot( mbedtls_svc_key_id_t key,
+                                        psa_key_slot_t **p_slot )
+{
+    psa_status_t status;
+
+    *p_slot = NULL;
+
+    /*
+     * On success, the pointer to the slot is passed directly to the caller
+     * thus no need to unlock the key slot here.
+     */
+    status = psa_find_and_lock_key_slot( key, p_slot );
+    if( status != PSA_ERROR_DOES_NOT_EXIST )
+        return( status );
+
+    /* Loading keys from storage requires support for such a mechanism */
+#if defined(MBEDTLS_PSA_CRYPTO_STORAGE_C) || \
+    defined(MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS)
+    return( psa_load_and_lock_key_slot( key, p_slot ) );
 #else /* MBEDTLS_PSA_CRYPTO_STORAGE_C || MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
     return( PSA_ERROR_INVALID_HANDLE );
 #endif /* MBEDTLS_PSA_CRYPTO_STORAGE_C || MBEDTLS_PSA_CRYPTO_BUILTIN_KEYS */
 }
 
-psa_status_t psa_unlock_key_slot( psa_key_slot_t *slot )
+psa_status_t psa_lock_key_slot( psa_key_slot_t *slot )
 {
-    if( slot == NULL )
-        return( PSA_SUCCESS );
+    if( slot->lock_count >= SIZE_MAX )
+        return( PSA_ERROR_CORRUPTION_DETECTED );
+
+    if( slot->links.list == PSA_KEY_SLOT_LIST_EVICTABLE )
+        psa_remove_evictable_key_slot( slot );
+
+    slot->lock_count++;
+
+    return( PSA_SUCCESS );
+}
 
+/* The body of psa_unlock_key_slot(), to call with the key slot mutex
+ * held. */
+static psa_status_t psa_decrement_key_slot_lock_count( psa_key_slot_t *slot )
+{
     if( slot->lock_count > 0 )
     {
         slot->lock_count--;
+
+        /* An unlocked persistent key can be evicted to make room for
+         * another key, the least recently used one first. */
+        if( slot->lock_count == 0 &&
+            psa_is_key_slot_occupied( slot ) &&
+            ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) )
+        {
+            psa_append_evictable_key_slot( slot );
+        }
+
         return( PSA_SUCCESS );
     }
 
@@ -419,6 +788,23 @@ psa_status_t psa_unlock_key_slot( psa_key_slot_t *slot )
     return( PSA_ERROR_CORRUPTION_DETECTED );
 }
 
+psa_status_t psa_unlock_key_slot( psa_key_slot_t *slot )
+{
+    psa_status_t status, unlock_status;
+
+    if( slot == NULL )
+        return( PSA_SUCCESS );
+
+    status = psa_key_slot_mutex_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
+    status = psa_decrement_key_slot_lock_count( slot );
+
+    unlock_status = psa_key_slot_mutex_unlock( );
+    return( status != PSA_SUCCESS ? status : unlock_status );
+}
+
 psa_status_t psa_validate_key_location( psa_key_lifetime_t lifetime,
                                         psa_se_drv_table_entry_t **p_drv )
 {
@@ -502,40 +888,52 @@ psa_status_t psa_open_key( mbedtls_svc_key_id_t key, psa_key_handle_t *handle )
 
 psa_status_t psa_close_key( psa_key_handle_t handle )
 {
-    psa_status_t status;
+    psa_status_t status, unlock_status;
     psa_key_slot_t *slot;
 
     if( psa_key_handle_is_null( handle ) )
         return( PSA_SUCCESS );
 
+    status = psa_key_slot_mutex_lock( );
+    if( status != PSA_SUCCESS )
+        return( status );
+
     status = psa_get_and_lock_key_slot_in_memory( handle, &slot );
     if( status != PSA_SUCCESS )
     {
         if( status == PSA_ERROR_DOES_NOT_EXIST )
             status = PSA_ERROR_INVALID_HANDLE;
-
-        return( status );
     }
-    if( slot->lock_count <= 1 )
-        return( psa_wipe_key_slot( slot ) );
+    else if( slot->lock_count <= 1 )
+        status = psa_wipe_key_slot( slot );
     else
-        return( psa_unlock_key_slot( slot ) );
+        status = psa_decrement_key_slot_lock_count( slot );
+
+    unlock_status = psa_key_slot_mutex_unlock( );
+    return( status != PSA_SUCCESS ? status : unlock_status );
 }
 
 psa_status_t psa_purge_key( mbedtls_svc_key_id_t key )
 {
-    psa_status_t status;
+    psa_status_t status, unlock_status;
     psa_key_slot_t *slot;
 
-    status = psa_get_and_lock_key_slot_in_memory( key, &slot );
+    status = psa_key_slot_mutex_lock( );
     if( status != PSA_SUCCESS )
         return( status );
 
-    if( ( ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) ) &&
-        ( slot->lock_count <= 1 ) )
-        return( psa_wipe_key_slot( slot ) );
-    else
-        return( psa_unlock_key_slot( slot ) );
+    status = psa_get_and_lock_key_slot_in_memory( key, &slot );
+    if( status == PSA_SUCCESS )
+    {
+        if( ( ! PSA_KEY_LIFETIME_IS_VOLATILE( slot->attr.lifetime ) ) &&
+            ( slot->lock_count <= 1 ) )
+            status = psa_wipe_key_slot( slot );
+        else
+            status = psa_decrement_key_slot_lock_count( slot );
+    }
+
+    unlock_status = psa_key_slot_mutex_unlock( );
+    return( status != PSA_SUCCESS ? status : unlock_status );
 }
 
 void mbedtls_psa_get_stats( mbedtls_psa_stats_t *stats )
@@ -544,9 +942,12 @@ void mbedtls_psa_get_stats( mbedtls_psa_stats_t *stats )
 
     memset( stats, 0, sizeof( *stats ) );
 
-    for( slot_idx = 0; slot_idx < MBEDTLS_PSA_KEY_SLOT_COUNT; slot_idx++ )
+    if( psa_key_slot_mutex_lock( ) != PSA_SUCCESS )
+        return;
+
+    for( slot_idx = 0; slot_idx < global_data.slot_count; slot_idx++ )
     {
-        const psa_key_slot_t *slot = &global_data.key_slots[ slot_idx ];
+        const psa_key_slot_t *slot = psa_key_slot_at( slot_idx );
         if( psa_is_key_slot_locked( slot ) )
         {
             ++stats->locked_slots;
@@ -574,6 +975,8 @@ void mbedtls_psa_get_stats( mbedtls_psa_stats_t *stats )
                 stats->max_open_external_key_id = id;
         }
     }
+
+    (void) psa_key_slot_mutex_unlock( );
 }
 
 #endif /* MBEDTLS_PSA_CRYPTO_C */
@@ -25,9 +25,13 @@
 #include "psa_crypto_core.h"
 #include "psa_crypto_se.h"
 
+#if defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
 /** Range of volatile key identifiers.
  *
- *  The last #MBEDTLS_PSA_KEY_SLOT_COUNT identifiers of the implementation
+ *  The last #MBEDTLS_PSA_KEY_SLOT_MAX_COUNT identifiers of the implementation
  *  range of key identifiers are reserved for volatile key identifiers.
  *  A volatile key identifier is equal to #PSA_KEY_ID_VOLATILE_MIN plus the
  *  index of the key slot containing the volatile key definition.
@@ -36,7 +40,7 @@
 /** The minimum value for a volatile key identifier.
  */
 #define PSA_KEY_ID_VOLATILE_MIN  ( PSA_KEY_ID_VENDOR_MAX - \
-                                   MBEDTLS_PSA_KEY_SLOT_COUNT + 1 )
+                                   MBEDTLS_PSA_KEY_SLOT_MAX_COUNT + 1 )
 
 /** The maximum value for a volatile key identifier.
  */
@@ -57,6 +61,103 @@ static inline int psa_key_id_is_volatile( psa_key_id_t key_id )
             ( key_id <= PSA_KEY_ID_VOLATILE_MAX ) );
 }
 
+/* Thread safety
+ *
+ * With #MBEDTLS_THREADING_C, the key slot table is protected by
+ * #mbedtls_threading_key_slot_mutex. The mutex is only held to find, lock,
+ * unlock, fill or wipe a key slot, not while the key in a locked slot is
+ * used, so operations with different keys, or with the same key, run
+ * concurrently.
+ *
+ * psa_get_and_lock_key_slot() and psa_unlock_key_slot() take the mutex
+ * themselves. The other functions that access the key slot table require
+ * their caller to hold the mutex (see psa_key_slot_mutex_lock()), which is
+ * noted in their description.
+ *
+ * The content of a key slot (its attributes and key material) does not
+ * change while the slot is locked, except through psa_wipe_key_slot() by the
+ * only holder of the lock. A key slot that is being filled is not findable
+ * until psa_register_key_slot() is called on it.
+ *
+ * Persistent storage is accessed without the key slot mutex, so that a slow
+ * storage backend does not delay the lookup of keys that are in memory.
+ * Instead, #mbedtls_threading_key_storage_mutex serializes loading, saving
+ * and destroying persistent keys (see psa_key_storage_mutex_lock()). It is
+ * always taken before the key slot mutex. While the storage is accessed, the
+ * key slot involved is locked by the caller and not findable: a slot being
+ * loaded or created is registered only afterwards, and a slot being
+ * destroyed is unregistered first with psa_unindex_key_slot().
+ */
+
+/** Take the mutex that protects the key slot table.
+ *
+ * This function does nothing if #MBEDTLS_THREADING_C is disabled.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_GENERIC_ERROR
+ *         The mutex could not be locked.
+ */
+static inline psa_status_t psa_key_slot_mutex_lock( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &mbedtls_threading_key_slot_mutex ) != 0 )
+        return( PSA_ERROR_GENERIC_ERROR );
+#endif
+    return( PSA_SUCCESS );
+}
+
+/** Release the mutex that protects the key slot table.
+ *
+ * This function does nothing if #MBEDTLS_THREADING_C is disabled.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_GENERIC_ERROR
+ *         The mutex could not be unlocked.
+ */
+static inline psa_status_t psa_key_slot_mutex_unlock( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &mbedtls_threading_key_slot_mutex ) != 0 )
+        return( PSA_ERROR_GENERIC_ERROR );
+#endif
+    return( PSA_SUCCESS );
+}
+
+/** Take the mutex that serializes the accesses to persistent storage.
+ *
+ * This function does nothing if #MBEDTLS_THREADING_C is disabled. The
+ * caller must not hold the key slot mutex.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_GENERIC_ERROR
+ *         The mutex could not be locked.
+ */
+static inline psa_status_t psa_key_storage_mutex_lock( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &mbedtls_threading_key_storage_mutex ) != 0 )
+        return( PSA_ERROR_GENERIC_ERROR );
+#endif
+    return( PSA_SUCCESS );
+}
+
+/** Release the mutex that serializes the accesses to persistent storage.
+ *
+ * This function does nothing if #MBEDTLS_THREADING_C is disabled.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_GENERIC_ERROR
+ *         The mutex could not be unlocked.
+ */
+static inline psa_status_t psa_key_storage_mutex_unlock( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &mbedtls_threading_key_storage_mutex ) != 0 )
+        return( PSA_ERROR_GENERIC_ERROR );
+#endif
+    return( PSA_SUCCESS );
+}
+
 /** Get the description of a key given its identifier and lock it.
  *
  * The descriptions of volatile keys and loaded persistent keys are stored in
@@ -69,6 +170,8 @@ static inline int psa_key_id_is_volatile( psa_key_id_t key_id )
  * On success, the returned key slot is locked. It is the responsibility of
  * the caller to unlock the key slot when it does not access it anymore.
  *
+ * The caller must not hold the key slot mutex or the key storage mutex.
+ *
  * \param key           Key identifier to query.
  * \param[out] p_slot   On success, `*p_slot` contains a pointer to the
  *                      key slot containing the description of the key
@@ -96,6 +199,8 @@ psa_status_t psa_get_and_lock_key_slot( mbedtls_svc_key_id_t key,
                                         psa_key_slot_t **p_slot );
 
 /** Initialize the key slot structures.
+ *
+ * The caller must not hold the key slot mutex.
  *
  * \retval #PSA_SUCCESS
  *         Currently this function always succeeds.
@@ -104,7 +209,8 @@ psa_status_t psa_initialize_key_slots( void );
 
 /** Delete all data from key slots in memory.
  *
- * This does not affect persistent storage. */
+ * This does not affect persistent storage. No other thread may use keys
+ * during this call. The caller must not hold the key slot mutex. */
 void psa_wipe_all_key_slots( void );
 
 /** Find a free key slot.
@@ -114,6 +220,12 @@ void psa_wipe_all_key_slots( void );
  * the responsibility of the caller to unlock the key slot when it does not
  * access it anymore.
  *
+ * If there is no free key slot, the key slot table is extended if it has
+ * fewer than #MBEDTLS_PSA_KEY_SLOT_MAX_COUNT slots. Otherwise the least
+ * recently used unlocked slot containing a persistent key is reclaimed.
+ *
+ * The caller must hold the key slot mutex.
+ *
  * \param[out] volatile_key_id   On success, volatile key identifier
  *                               associated to the returned slot.
  * \param[out] p_slot            On success, a pointer to the slot.
@@ -125,10 +237,49 @@ void psa_wipe_all_key_slots( void );
 psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
                                      psa_key_slot_t **p_slot );
 
+/** Make a key slot findable from the key identifier it contains.
+ *
+ * This function must be called once the key in a slot returned by
+ * psa_get_empty_key_slot() is complete. Until then, looking up its key
+ * identifier fails as if the key did not exist.
+ *
+ * The caller must hold the key slot mutex.
+ *
+ * \param[in] slot  The key slot.
+ */
+void psa_register_key_slot( psa_key_slot_t *slot );
+
+/** Make a key slot unfindable from the key identifier it contains.
+ *
+ * Looking up the key identifier of the slot then fails as if the key did
+ * not exist, but the content of the slot is left unchanged: the caller can
+ * keep using it until it wipes the slot. psa_destroy_key() calls this
+ * function before it destroys the key in storage.
+ *
+ * The caller must hold the key slot mutex.
+ *
+ * \param[in] slot  The key slot.
+ */
+void psa_unindex_key_slot( psa_key_slot_t *slot );
+
+/** Remove a key slot from the lookup structures of the key slot manager
+ *  and return it to the pool of free slots.
+ *
+ * This function is called by psa_wipe_key_slot() before it resets the
+ * content of the slot.
+ *
+ * The caller must hold the key slot mutex.
+ *
+ * \param[in] slot  The key slot.
+ */
+void psa_unregister_key_slot( psa_key_slot_t *slot );
+
 /** Lock a key slot.
  *
  * This function increments the key slot lock counter by one.
  *
+ * The caller must hold the key slot mutex.
+ *
  * \param[in] slot  The key slot.
  *
  * \retval #PSA_SUCCESS
@@ -137,15 +288,7 @@ psa_status_t psa_get_empty_key_slot( psa_key_id_t *volatile_key_id,
  *             The lock counter already reached its maximum value and was not
  *             increased.
  */
-static inline psa_status_t psa_lock_key_slot( psa_key_slot_t *slot )
-{
-    if( slot->lock_count >= SIZE_MAX )
-        return( PSA_ERROR_CORRUPTION_DETECTED );
-
-    slot->lock_count++;
-
-    return( PSA_SUCCESS );
-}
+psa_status_t psa_lock_key_slot( psa_key_slot_t *slot );
 
 /** Unlock a key slot.
  *
@@ -155,6 +298,8 @@ static inline psa_status_t psa_lock_key_slot( psa_key_slot_t *slot )
  *       a NULL input pointer is valid, and the function returns
  *       successfully without doing anything in that case.
  *
+ * The caller must not hold the key slot mutex.
+ *
  * \param[in] slot  The key slot.
  * \retval #PSA_SUCCESS
  *             \p slot is NULL or the key slot lock counter has been
@@ -41,6 +41,8 @@
 
 #include "mbedtls/rsa.h"
 #include "rsa_alt_helpers.h"
+#include "rsa_internal.h"
+#include "bignum_internal.h"
 #include "mbedtls/oid.h"
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
@@ -65,6 +67,11 @@
 
 #include "mbedtls/platform.h"
 
+#if defined(MBEDTLS_RSA_GEN_KEY_PARALLEL)
+#include "mbedtls/threading.h"
+#include <pthread.h>
+#endif
+
 #if !defined(MBEDTLS_RSA_ALT)
 
 int mbedtls_rsa_import( mbedtls_rsa_context *ctx,
@@ -513,6 +520,105 @@ size_t mbedtls_rsa_get_len( const mbedtls_rsa_context *ctx )
 
 #if defined(MBEDTLS_GENPRIME)
 
+#if defined(MBEDTLS_RSA_GEN_KEY_PARALLEL)
+/*
+ * Random generator shared by the two prime searches of mbedtls_rsa_gen_key():
+ * the caller's generator is only ever called by one thread at a time.
+ */
+typedef struct
+{
+    int (*f_rng)(void *, unsigned char *, size_t);
+    void *p_rng;
+    mbedtls_threading_mutex_t mutex;
+} rsa_gen_key_rng_t;
+
+static int rsa_gen_key_rng( void *param, unsigned char *output, size_t len )
+{
+    rsa_gen_key_rng_t *rng = param;
+    int ret;
+
+    if( ( ret = mbedtls_mutex_lock( &rng->mutex ) ) != 0 )
+        return( ret );
+
+    ret = rng->f_rng( rng->p_rng, output, len );
+
+    if( mbedtls_mutex_unlock( &rng->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    return( ret );
+}
+
+typedef struct
+{
+    mbedtls_mpi *X;
+    size_t nbits;
+    int flags;
+    rsa_gen_key_rng_t *rng;
+    int ret;
+} rsa_gen_prime_job_t;
+
+static void *rsa_gen_prime_thread( void *param )
+{
+    rsa_gen_prime_job_t *job = param;
+
+    job->ret = mbedtls_mpi_gen_prime( job->X, job->nbits, job->flags,
+                                      rsa_gen_key_rng, job->rng );
+
+    return( NULL );
+}
+#endif /* MBEDTLS_RSA_GEN_KEY_PARALLEL */
+
+/*
+ * Generate the two primes P and Q of nbits bits each. With
+ * MBEDTLS_RSA_GEN_KEY_PARALLEL, P is searched for in a new thread while the
+ * calling thread searches for Q; if the thread can't be created, both are
+ * searched for in the calling thread.
+ */
+static int rsa_gen_primes( mbedtls_mpi *P, mbedtls_mpi *Q, size_t nbits,
+                           int flags,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng )
+{
+#if defined(MBEDTLS_RSA_GEN_KEY_PARALLEL)
+    int ret;
+    rsa_gen_key_rng_t rng;
+    rsa_gen_prime_job_t job;
+    pthread_t thread;
+    int started;
+
+    rng.f_rng = f_rng;
+    rng.p_rng = p_rng;
+    mbedtls_mutex_init( &rng.mutex );
+
+    job.X = P;
+    job.nbits = nbits;
+    job.flags = flags;
+    job.rng = &rng;
+    job.ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    started = pthread_create( &thread, NULL, rsa_gen_prime_thread, &job ) == 0;
+    if( ! started )
+        rsa_gen_prime_thread( &job );
+
+    ret = mbedtls_mpi_gen_prime( Q, nbits, flags, rsa_gen_key_rng, &rng );
+
+    if( started )
+        (void) pthread_join( thread, NULL );
+
+    mbedtls_mutex_free( &rng.mutex );
+
+    return( job.ret != 0 ? job.ret : ret );
+#else
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_gen_prime( P, nbits, flags, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_gen_prime( Q, nbits, flags, f_rng, p_rng ) );
+
+cleanup:
+    return( ret );
+#endif /* MBEDTLS_RSA_GEN_KEY_PARALLEL */
+}
+
 /*
  * Generate an RSA keypair
  *
@@ -556,11 +662,8 @@ int mbedtls_rsa_gen_key( mbedtls_rsa_context *ctx,
 
     do
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_gen_prime( &ctx->P, nbits >> 1,
-                                                prime_quality, f_rng, p_rng ) );
-
-        MBEDTLS_MPI_CHK( mbedtls_mpi_gen_prime( &ctx->Q, nbits >> 1,
-                                                prime_quality, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( rsa_gen_primes( &ctx->P, &ctx->Q, nbits >> 1,
+                                         prime_quality, f_rng, p_rng ) );
 
         /* make sure the difference between p and q is not too small (FIPS 186-4 §B.3.3 step 5.4) */
         MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &H, &ctx->P, &ctx->Q ) );
@@ -840,11 +943,162 @@ cleanup:
 #define RSA_EXPONENT_BLINDING 28
 
 /*
- * Do an RSA private key operation
+ * The blinding values of one private key operation
  */
-int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
-                 int (*f_rng)(void *, unsigned char *, size_t),
-                 void *p_rng,
+typedef struct
+{
+    mbedtls_mpi Vi, Vf;         /* Input blinding value and its inverse */
+#if defined(MBEDTLS_RSA_NO_CRT)
+    mbedtls_mpi R;              /* Exponent blinding factor */
+#else
+    mbedtls_mpi RP, RQ;         /* Exponent blinding factors mod P and mod Q */
+#endif
+} rsa_blinding_values;
+
+static void rsa_blinding_values_init( rsa_blinding_values *blinding )
+{
+    mbedtls_mpi_init( &blinding->Vi );
+    mbedtls_mpi_init( &blinding->Vf );
+#if defined(MBEDTLS_RSA_NO_CRT)
+    mbedtls_mpi_init( &blinding->R );
+#else
+    mbedtls_mpi_init( &blinding->RP );
+    mbedtls_mpi_init( &blinding->RQ );
+#endif
+}
+
+static void rsa_blinding_values_free( rsa_blinding_values *blinding )
+{
+    mbedtls_mpi_free( &blinding->Vi );
+    mbedtls_mpi_free( &blinding->Vf );
+#if defined(MBEDTLS_RSA_NO_CRT)
+    mbedtls_mpi_free( &blinding->R );
+#else
+    mbedtls_mpi_free( &blinding->RP );
+    mbedtls_mpi_free( &blinding->RQ );
+#endif
+}
+
+/*
+ * Take the blinding values for count private key operations, draw their
+ * exponent blinding factors, and fill in the cached Montgomery constants
+ * that they use. Also take the working memory kept in the context, if any,
+ * into *W and *W_limbs; rsa_private_release() gives it back.
+ *
+ * This is the only part of a private key operation that modifies the
+ * context or calls f_rng, so it is the only part that runs under the
+ * mutex: after it returns, the exponentiations only read the context and
+ * several threads can perform them concurrently with the same key. Keeping
+ * every call to f_rng under the mutex means that, as before, f_rng does not
+ * need to be thread-safe when the RNG context is shared along with the key.
+ */
+static int rsa_private_setup( mbedtls_rsa_context *ctx,
+                 int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                 rsa_blinding_values *blinding, size_t count,
+                 mbedtls_mpi_uint **W, size_t *W_limbs )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
+        return( ret );
+#endif
+
+    /* Concurrent operations with the same key find it gone and allocate
+     * their own */
+    *W = ctx->W;
+    *W_limbs = ctx->W_limbs;
+    ctx->W = NULL;
+    ctx->W_limbs = 0;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_prepare_rr( &ctx->RN, &ctx->N ) );
+#if !defined(MBEDTLS_RSA_NO_CRT)
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_prepare_rr( &ctx->RP, &ctx->P ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_prepare_rr( &ctx->RQ, &ctx->Q ) );
+#endif
+
+    /* Each operation gets its own blinding values: advance the shared ones
+     * once per operation, as if the operations were performed one by one */
+    for( i = 0; i < count; i++ )
+    {
+        MBEDTLS_MPI_CHK( rsa_prepare_blinding( ctx, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &blinding[i].Vi, &ctx->Vi ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &blinding[i].Vf, &ctx->Vf ) );
+
+#if defined(MBEDTLS_RSA_NO_CRT)
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &blinding[i].R,
+                         RSA_EXPONENT_BLINDING, f_rng, p_rng ) );
+#else
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &blinding[i].RP,
+                         RSA_EXPONENT_BLINDING, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &blinding[i].RQ,
+                         RSA_EXPONENT_BLINDING, f_rng, p_rng ) );
+#endif
+    }
+
+cleanup:
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+#endif
+
+    return( ret );
+}
+
+/*
+ * Give the working memory of private key operations back to the context,
+ * wiped, for the next operations. If a concurrent operation has already
+ * given its own back, keep the larger of the two.
+ */
+static void rsa_private_release( mbedtls_rsa_context *ctx,
+                                 mbedtls_mpi_uint *W, size_t W_limbs )
+{
+    mbedtls_mpi_uint *old_W;
+    size_t old_W_limbs;
+
+    if( W == NULL )
+        return;
+
+    mbedtls_platform_zeroize( W, W_limbs * sizeof( mbedtls_mpi_uint ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &ctx->mutex ) != 0 )
+    {
+        mbedtls_free( W );
+        return;
+    }
+#endif
+
+    old_W = ctx->W;
+    old_W_limbs = ctx->W_limbs;
+    if( old_W_limbs < W_limbs )
+    {
+        ctx->W = W;
+        ctx->W_limbs = W_limbs;
+        W = old_W;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &ctx->mutex );
+#endif
+
+    mbedtls_free( W );
+}
+
+/*
+ * Do an RSA private key operation with the given blinding values, once
+ * rsa_private_setup() has been called. This only reads the context: the
+ * cached Montgomery constants passed to the exponentiations are already
+ * filled in, so they are not modified. It does not call the RNG either.
+ *
+ * *W is working memory of *W_limbs limbs for the exponentiations. It is
+ * reallocated if it is too small, so that a batch of operations can share
+ * it. The caller must give it back with rsa_private_release().
+ */
+static int rsa_private_blinded( mbedtls_rsa_context *ctx,
+                 const rsa_blinding_values *blinding,
+                 mbedtls_mpi_uint **W, size_t *W_limbs,
                  const unsigned char *input,
                  unsigned char *output )
 {
@@ -854,9 +1108,11 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
     /* Temporary holding the result */
     mbedtls_mpi T;
 
-    /* Temporaries holding P-1, Q-1 and the
-     * exponent blinding factor, respectively. */
-    mbedtls_mpi P1, Q1, R;
+    /* Temporaries holding P-1 and Q-1 */
+    mbedtls_mpi P1, Q1;
+
+    /* Number of limbs of working memory needed for this operation */
+    size_t W_needed;
 
 #if !defined(MBEDTLS_RSA_NO_CRT)
     /* Temporaries holding the results mod p resp. mod q. */
@@ -865,44 +1121,20 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
     /* Temporaries holding the blinded exponents for
      * the mod p resp. mod q computation (if used). */
     mbedtls_mpi DP_blind, DQ_blind;
-
-    /* Pointers to actual exponents to be used - either the unblinded
-     * or the blinded ones, depending on the presence of a PRNG. */
-    mbedtls_mpi *DP = &ctx->DP;
-    mbedtls_mpi *DQ = &ctx->DQ;
 #else
     /* Temporary holding the blinded exponent (if used). */
     mbedtls_mpi D_blind;
-
-    /* Pointer to actual exponent to be used - either the unblinded
-     * or the blinded one, depending on the presence of a PRNG. */
-    mbedtls_mpi *D = &ctx->D;
 #endif /* MBEDTLS_RSA_NO_CRT */
 
     /* Temporaries holding the initial input and the double
      * checked result; should be the same in the end. */
     mbedtls_mpi I, C;
 
-    if( f_rng == NULL )
-        return( MBEDTLS_ERR_RSA_BAD_INPUT_DATA );
-
-    if( rsa_check_context( ctx, 1 /* private key checks */,
-                                1 /* blinding on        */ ) != 0 )
-    {
-        return( MBEDTLS_ERR_RSA_BAD_INPUT_DATA );
-    }
-
-#if defined(MBEDTLS_THREADING_C)
-    if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
-        return( ret );
-#endif
-
     /* MPI Initialization */
     mbedtls_mpi_init( &T );
 
     mbedtls_mpi_init( &P1 );
     mbedtls_mpi_init( &Q1 );
-    mbedtls_mpi_init( &R );
 
 #if defined(MBEDTLS_RSA_NO_CRT)
     mbedtls_mpi_init( &D_blind );
@@ -933,8 +1165,7 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
      * Blinding
      * T = T * Vi mod N
      */
-    MBEDTLS_MPI_CHK( rsa_prepare_blinding( ctx, f_rng, p_rng ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &T, &ctx->Vi ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &T, &blinding->Vi ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T, &ctx->N ) );
 
     /*
@@ -947,39 +1178,52 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
     /*
      * D_blind = ( P - 1 ) * ( Q - 1 ) * R + D
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &R, RSA_EXPONENT_BLINDING,
-                     f_rng, p_rng ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &D_blind, &P1, &Q1 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &D_blind, &D_blind, &R ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &D_blind, &D_blind, &blinding->R ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &D_blind, &D_blind, &ctx->D ) );
 
-    D = &D_blind;
+    W_needed = mbedtls_mpi_exp_mod_ct_working_limbs( &D_blind, &ctx->N );
 #else
     /*
-     * DP_blind = ( P - 1 ) * R + DP
+     * DP_blind = ( P - 1 ) * RP + DP
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &R, RSA_EXPONENT_BLINDING,
-                     f_rng, p_rng ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &DP_blind, &P1, &R ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &DP_blind, &P1, &blinding->RP ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &DP_blind, &DP_blind,
                 &ctx->DP ) );
 
-    DP = &DP_blind;
-
     /*
-     * DQ_blind = ( Q - 1 ) * R + DQ
+     * DQ_blind = ( Q - 1 ) * RQ + DQ
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &R, RSA_EXPONENT_BLINDING,
-                     f_rng, p_rng ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &DQ_blind, &Q1, &R ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &DQ_blind, &Q1, &blinding->RQ ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &DQ_blind, &DQ_blind,
                 &ctx->DQ ) );
 
-    DQ = &DQ_blind;
+    W_needed = mbedtls_mpi_exp_mod_ct_working_limbs( &DP_blind, &ctx->P );
+    if( W_needed < mbedtls_mpi_exp_mod_ct_working_limbs( &DQ_blind, &ctx->Q ) )
+        W_needed = mbedtls_mpi_exp_mod_ct_working_limbs( &DQ_blind, &ctx->Q );
 #endif /* MBEDTLS_RSA_NO_CRT */
 
+    if( *W_limbs < W_needed )
+    {
+        if( *W != NULL )
+        {
+            mbedtls_platform_zeroize( *W, *W_limbs * sizeof( mbedtls_mpi_uint ) );
+            mbedtls_free( *W );
+        }
+
+        *W_limbs = 0;
+        *W = mbedtls_calloc( W_needed, sizeof( mbedtls_mpi_uint ) );
+        if( *W == NULL )
+        {
+            ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+            goto cleanup;
+        }
+        *W_limbs = W_needed;
+    }
+
 #if defined(MBEDTLS_RSA_NO_CRT)
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &T, &T, D, &ctx->N, &ctx->RN ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_ct( &T, &T, &D_blind, &ctx->N, &ctx->RN,
+                                             *W, *W_limbs ) );
 #else
     /*
      * Faster decryption using the CRT
@@ -988,8 +1232,10 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
      * TQ = input ^ dQ mod Q
      */
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &TP, &T, DP, &ctx->P, &ctx->RP ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &TQ, &T, DQ, &ctx->Q, &ctx->RQ ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_ct( &TP, &T, &DP_blind, &ctx->P, &ctx->RP,
+                                             *W, *W_limbs ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_ct( &TQ, &T, &DQ_blind, &ctx->Q, &ctx->RQ,
+                                             *W, *W_limbs ) );
 
     /*
      * T = (TP - TQ) * (Q^-1 mod P) mod P
@@ -1009,7 +1255,7 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
      * Unblind
      * T = T * Vf mod N
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &T, &ctx->Vf ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &T, &blinding->Vf ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T, &ctx->N ) );
 
     /* Verify the result to prevent glitching attacks. */
@@ -1025,14 +1271,8 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
     MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( &T, output, olen ) );
 
 cleanup:
-#if defined(MBEDTLS_THREADING_C)
-    if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
-        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
-#endif
-
     mbedtls_mpi_free( &P1 );
     mbedtls_mpi_free( &Q1 );
-    mbedtls_mpi_free( &R );
 
 #if defined(MBEDTLS_RSA_NO_CRT)
     mbedtls_mpi_free( &D_blind );
@@ -1050,6 +1290,114 @@ cleanup:
     mbedtls_mpi_free( &C );
     mbedtls_mpi_free( &I );
 
+    return( ret );
+}
+
+/*
+ * Do an RSA private key operation
+ */
+int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
+                 int (*f_rng)(void *, unsigned char *, size_t),
+                 void *p_rng,
+                 const unsigned char *input,
+                 unsigned char *output )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    /* This operation's blinding values, taken from the context */
+    rsa_blinding_values blinding;
+
+    /* Working memory for the private exponentiation(s), shared by both
+     * halves of the CRT computation, and kept in the context between
+     * operations. */
+    mbedtls_mpi_uint *W = NULL;
+    size_t W_limbs = 0;
+
+    if( f_rng == NULL )
+        return( MBEDTLS_ERR_RSA_BAD_INPUT_DATA );
+
+    if( rsa_check_context( ctx, 1 /* private key checks */,
+                                1 /* blinding on        */ ) != 0 )
+    {
+        return( MBEDTLS_ERR_RSA_BAD_INPUT_DATA );
+    }
+
+    rsa_blinding_values_init( &blinding );
+
+    MBEDTLS_MPI_CHK( rsa_private_setup( ctx, f_rng, p_rng, &blinding, 1,
+                                        &W, &W_limbs ) );
+    MBEDTLS_MPI_CHK( rsa_private_blinded( ctx, &blinding, &W, &W_limbs,
+                                          input, output ) );
+
+cleanup:
+    rsa_blinding_values_free( &blinding );
+
+    rsa_private_release( ctx, W, W_limbs );
+
+    if( ret != 0 && ret >= -0x007f )
+        return( MBEDTLS_ERROR_ADD( MBEDTLS_ERR_RSA_PRIVATE_FAILED, ret ) );
+
+    return( ret );
+}
+
+/*
+ * Do several RSA private key operations with the same key
+ */
+int mbedtls_rsa_private_batch( mbedtls_rsa_context *ctx,
+                 int (*f_rng)(void *, unsigned char *, size_t),
+                 void *p_rng,
+                 const unsigned char * const input[],
+                 unsigned char * const output[],
+                 size_t count )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    rsa_blinding_values *blinding = NULL;
+    mbedtls_mpi_uint *W = NULL;
+    size_t W_limbs = 0;
+    size_t i;
+
+    if( f_rng == NULL || ( count != 0 && ( input == NULL || output == NULL ) ) )
+        return( MBEDTLS_ERR_RSA_BAD_INPUT_DATA );
+
+    if( rsa_check_context( ctx, 1 /* private key checks */,
+                                1 /* blinding on        */ ) != 0 )
+    {
+        return( MBEDTLS_ERR_RSA_BAD_INPUT_DATA );
+    }
+
+    if( count == 0 )
+        return( 0 );
+
+    blinding = mbedtls_calloc( count, sizeof( rsa_blinding_values ) );
+    if( blinding == NULL )
+    {
+        ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    for( i = 0; i < count; i++ )
+        rsa_blinding_values_init( &blinding[i] );
+
+    /* A single trip through the mutex for the whole batch */
+    MBEDTLS_MPI_CHK( rsa_private_setup( ctx, f_rng, p_rng, blinding, count,
+                                        &W, &W_limbs ) );
+
+    for( i = 0; i < count; i++ )
+    {
+        MBEDTLS_MPI_CHK( rsa_private_blinded( ctx, &blinding[i], &W, &W_limbs,
+                                              input[i], output[i] ) );
+    }
+
+cleanup:
+    if( blinding != NULL )
+    {
+        for( i = 0; i < count; i++ )
+            rsa_blinding_values_free( &blinding[i] );
+    }
+    mbedtls_free( blinding );
+
+    rsa_private_release( ctx, W, W_limbs );
+
     if( ret != 0 && ret >= -0x007f )
         return( MBEDTLS_ERROR_ADD( MBEDTLS_ERR_RSA_PRIVATE_FAILED, ret ) );
 
@@ -1755,11 +2103,11 @@ int mbedtls_rsa_rsassa_pss_sign( mbedtls_rsa_context *ctx,
  * - dst points to a buffer of size at least dst_len.
  *
  */
-static int rsa_rsassa_pkcs1_v15_encode( mbedtls_md_type_t md_alg,
-                                        unsigned int hashlen,
-                                        const unsigned char *hash,
-                                        size_t dst_len,
-                                        unsigned char *dst )
+int mbedtls_rsa_rsassa_pkcs1_v15_encode( mbedtls_md_type_t md_alg,
+                                         unsigned int hashlen,
+                                         const unsigned char *hash,
+                                         size_t dst_len,
+                                         unsigned char *dst )
 {
     size_t oid_size  = 0;
     size_t nb_pad    = dst_len;
@@ -1892,8 +2240,8 @@ int mbedtls_rsa_rsassa_pkcs1_v15_sign( mbedtls_rsa_context *ctx,
      * Prepare PKCS1-v1.5 encoding (padding and hash identifier)
      */
 
-    if( ( ret = rsa_rsassa_pkcs1_v15_encode( md_alg, hashlen, hash,
-                                             ctx->len, sig ) ) != 0 )
+    if( ( ret = mbedtls_rsa_rsassa_pkcs1_v15_encode( md_alg, hashlen, hash,
+                                                     ctx->len, sig ) ) != 0 )
         return( ret );
 
     /* Private key operation
@@ -2132,8 +2480,9 @@ int mbedtls_rsa_rsassa_pkcs1_v15_verify( mbedtls_rsa_context *ctx,
         goto cleanup;
     }
 
-    if( ( ret = rsa_rsassa_pkcs1_v15_encode( md_alg, hashlen, hash, sig_len,
-                                             encoded_expected ) ) != 0 )
+    if( ( ret = mbedtls_rsa_rsassa_pkcs1_v15_encode( md_alg, hashlen, hash,
+                                                     sig_len,
+                                                     encoded_expected ) ) != 0 )
         goto cleanup;
 
     /*
@@ -2268,6 +2617,11 @@ void mbedtls_rsa_free( mbedtls_rsa_context *ctx )
     mbedtls_mpi_free( &ctx->DP );
 #endif /* MBEDTLS_RSA_NO_CRT */
 
+    /* Already wiped by rsa_private_release() */
+    mbedtls_free( ctx->W );
+    ctx->W = NULL;
+    ctx->W_limbs = 0;
+
 #if defined(MBEDTLS_THREADING_C)
     /* Free the mutex, but only if it hasn't been freed already. */
     if( ctx->ver != 0 )
@@ -0,0 +1,62 @@
+/**
+ * \file rsa_internal.h
+ *
+ * \brief RSA library: internal interfaces shared with other library modules.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MBEDTLS_RSA_INTERNAL_H
+#define MBEDTLS_RSA_INTERNAL_H
+
+#include "common.h"
+
+#include "mbedtls/md.h"
+
+#if defined(MBEDTLS_RSA_C) && defined(MBEDTLS_PKCS1_V15) && \
+    !defined(MBEDTLS_RSA_ALT)
+/**
+ * \brief          Encode a message digest as in EMSA-PKCS1-v1_5 (RFC 8017,
+ *                 section 9.2), ready for the RSA private key operation.
+ *
+ *                 This is the encoding that
+ *                 mbedtls_rsa_rsassa_pkcs1_v15_sign() applies before calling
+ *                 mbedtls_rsa_private(). It lets callers that perform the
+ *                 private key operation themselves, for example with
+ *                 mbedtls_rsa_private_batch(), produce the same signatures.
+ *
+ * \param md_alg   The message-digest algorithm used to hash \p hash, or
+ *                 #MBEDTLS_MD_NONE if \p hash is the DigestInfo to pad.
+ * \param hashlen  The length of \p hash in Bytes. It must match \p md_alg if
+ *                 that is not #MBEDTLS_MD_NONE.
+ * \param hash     The message digest.
+ * \param dst_len  The length of the encoded message, which is the length of
+ *                 the RSA modulus in Bytes.
+ * \param dst      The buffer for the encoded message, of \p dst_len Bytes.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_RSA_BAD_INPUT_DATA if \p md_alg is not
+ *                 supported or \p dst_len is too small.
+ */
+int mbedtls_rsa_rsassa_pkcs1_v15_encode( mbedtls_md_type_t md_alg,
+                                         unsigned int hashlen,
+                                         const unsigned char *hash,
+                                         size_t dst_len,
+                                         unsigned char *dst );
+#endif /* MBEDTLS_RSA_C && MBEDTLS_PKCS1_V15 && !MBEDTLS_RSA_ALT */
+
+#endif /* MBEDTLS_RSA_INTERNAL_H */
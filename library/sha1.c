@@ -34,8 +34,80 @@
 
 #include "mbedtls/platform.h"
 
+#if defined(MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT)
+#  if defined(__GNUC__) && ( defined(__amd64__) || defined(__x86_64__) ) && \
+      defined(MBEDTLS_HAVE_ASM)
+#    include <immintrin.h>
+#    ifndef asm
+#      define asm __asm
+#    endif
+#  else
+#    undef MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT
+#  endif
+#endif
+
+#if defined(MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT)
+/*
+ * The CPU features are detected once per process, and several threads may
+ * hash at the same time, so with pthreads the detection runs under
+ * pthread_once(), as in sha256.c.
+ */
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include "mbedtls/threading.h"
+
+typedef pthread_once_t sha1_once_t;
+#define SHA1_ONCE_INIT PTHREAD_ONCE_INIT
+
+static inline void sha1_call_once( sha1_once_t *once,
+                                   void (*init)( void ) )
+{
+    (void) pthread_once( once, init );
+}
+#else
+typedef int sha1_once_t;
+#define SHA1_ONCE_INIT 0
+
+static inline void sha1_call_once( sha1_once_t *once,
+                                   void (*init)( void ) )
+{
+    if( !*once )
+    {
+        init();
+        *once = 1;
+    }
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+/*
+ * x86-64 SHA extensions detection: the kernel also needs SSSE3 (pshufb)
+ * and SSE4.1 (pextrd).
+ */
+static int mbedtls_x86_shani_sha1_determine_support( void )
+{
+    unsigned int a, b, c, d;
+
+    /* volatile: cpuid may trap to a hypervisor, so it must not be hoisted
+     * out of the one-time check in the caller */
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (0), "c" (0) );
+    if( a < 7 )
+        return( 0 );
+
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (1), "c" (0) );
+    if( ( c & ( 1U << 9 ) ) == 0 || ( c & ( 1U << 19 ) ) == 0 )
+        return( 0 );
+
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (7), "c" (0) );
+    return( ( b & ( 1U << 29 ) ) ? 1 : 0 );
+}
+#endif  /* MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT */
+
 #if !defined(MBEDTLS_SHA1_ALT)
 
+#define SHA1_BLOCK_SIZE 64
+
 void mbedtls_sha1_init( mbedtls_sha1_context *ctx )
 {
     memset( ctx, 0, sizeof( mbedtls_sha1_context ) );
@@ -72,9 +144,161 @@ int mbedtls_sha1_starts( mbedtls_sha1_context *ctx )
     return( 0 );
 }
 
+#if defined(MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT)
+
+/*
+ * Four rounds with the SHA extensions, interleaved with the message schedule
+ * for the following groups: sha1msg1, xor and sha1msg2 each advance a
+ * different schedule register, for the groups 3, 2 and 1 ahead respectively.
+ * e_in holds E (from sha1nexte) for these rounds, e_out saves ABCD so that
+ * the next group can derive its E from it.
+ */
+#define SHA1_X86_SHANI_ROUNDS4( e_in, e_out, m, m_next, m_xor, m_msg1, f )  \
+    do                                                                  \
+    {                                                                   \
+        e_in = _mm_sha1nexte_epu32( e_in, m );                          \
+        e_out = abcd;                                                   \
+        m_next = _mm_sha1msg2_epu32( m_next, m );                       \
+        abcd = _mm_sha1rnds4_epu32( abcd, e_in, f );                    \
+        m_msg1 = _mm_sha1msg1_epu32( m_msg1, m );                       \
+        m_xor = _mm_xor_si128( m_xor, m );                              \
+    } while( 0 )
+
+__attribute__((target("sha,sse4.1")))
+static size_t mbedtls_internal_sha1_process_many_x86_shani(
+                  mbedtls_sha1_context *ctx, const uint8_t *msg, size_t len )
+{
+    const __m128i bswap = _mm_set_epi64x( 0x0001020304050607ULL,
+                                          0x08090a0b0c0d0e0fULL );
+    __m128i abcd, e0, e1;
+    __m128i sched0, sched1, sched2, sched3;
+
+    size_t processed = 0;
+
+    /* The SHA extensions want A in the most significant lane */
+    abcd = _mm_loadu_si128( (const __m128i *) &ctx->state[0] );
+    abcd = _mm_shuffle_epi32( abcd, 0x1B );
+    e0 = _mm_set_epi32( (int) ctx->state[4], 0, 0, 0 );
+
+    for( ;
+         len >= SHA1_BLOCK_SIZE;
+         processed += SHA1_BLOCK_SIZE,
+               msg += SHA1_BLOCK_SIZE,
+               len -= SHA1_BLOCK_SIZE )
+    {
+        __m128i abcd_orig = abcd;
+        __m128i e0_orig = e0;
+
+        sched0 = _mm_loadu_si128( (const __m128i *) ( msg + 16 * 0 ) );
+        sched1 = _mm_loadu_si128( (const __m128i *) ( msg + 16 * 1 ) );
+        sched2 = _mm_loadu_si128( (const __m128i *) ( msg + 16 * 2 ) );
+        sched3 = _mm_loadu_si128( (const __m128i *) ( msg + 16 * 3 ) );
+
+        sched0 = _mm_shuffle_epi8( sched0, bswap );
+        sched1 = _mm_shuffle_epi8( sched1, bswap );
+        sched2 = _mm_shuffle_epi8( sched2, bswap );
+        sched3 = _mm_shuffle_epi8( sched3, bswap );
+
+        /* Rounds 0 to 3 */
+        e0 = _mm_add_epi32( e0, sched0 );
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 0 );
+
+        /* Rounds 4 to 7 */
+        e1 = _mm_sha1nexte_epu32( e1, sched1 );
+        e0 = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 0 );
+        sched0 = _mm_sha1msg1_epu32( sched0, sched1 );
+
+        /* Rounds 8 to 11 */
+        e0 = _mm_sha1nexte_epu32( e0, sched2 );
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 0 );
+        sched1 = _mm_sha1msg1_epu32( sched1, sched2 );
+        sched0 = _mm_xor_si128( sched0, sched2 );
+
+        /* Rounds 12 to 63 */
+        SHA1_X86_SHANI_ROUNDS4( e1, e0, sched3, sched0, sched1, sched2, 0 );
+        SHA1_X86_SHANI_ROUNDS4( e0, e1, sched0, sched1, sched2, sched3, 0 );
+        SHA1_X86_SHANI_ROUNDS4( e1, e0, sched1, sched2, sched3, sched0, 1 );
+        SHA1_X86_SHANI_ROUNDS4( e0, e1, sched2, sched3, sched0, sched1, 1 );
+        SHA1_X86_SHANI_ROUNDS4( e1, e0, sched3, sched0, sched1, sched2, 1 );
+        SHA1_X86_SHANI_ROUNDS4( e0, e1, sched0, sched1, sched2, sched3, 1 );
+        SHA1_X86_SHANI_ROUNDS4( e1, e0, sched1, sched2, sched3, sched0, 1 );
+        SHA1_X86_SHANI_ROUNDS4( e0, e1, sched2, sched3, sched0, sched1, 2 );
+        SHA1_X86_SHANI_ROUNDS4( e1, e0, sched3, sched0, sched1, sched2, 2 );
+        SHA1_X86_SHANI_ROUNDS4( e0, e1, sched0, sched1, sched2, sched3, 2 );
+        SHA1_X86_SHANI_ROUNDS4( e1, e0, sched1, sched2, sched3, sched0, 2 );
+        SHA1_X86_SHANI_ROUNDS4( e0, e1, sched2, sched3, sched0, sched1, 2 );
+        SHA1_X86_SHANI_ROUNDS4( e1, e0, sched3, sched0, sched1, sched2, 3 );
+
+        /* Rounds 64 to 67 */
+        e0 = _mm_sha1nexte_epu32( e0, sched0 );
+        e1 = abcd;
+        sched1 = _mm_sha1msg2_epu32( sched1, sched0 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 3 );
+        sched3 = _mm_sha1msg1_epu32( sched3, sched0 );
+        sched2 = _mm_xor_si128( sched2, sched0 );
+
+        /* Rounds 68 to 71 */
+        e1 = _mm_sha1nexte_epu32( e1, sched1 );
+        e0 = abcd;
+        sched2 = _mm_sha1msg2_epu32( sched2, sched1 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 3 );
+        sched3 = _mm_xor_si128( sched3, sched1 );
+
+        /* Rounds 72 to 75 */
+        e0 = _mm_sha1nexte_epu32( e0, sched2 );
+        e1 = abcd;
+        sched3 = _mm_sha1msg2_epu32( sched3, sched2 );
+        abcd = _mm_sha1rnds4_epu32( abcd, e0, 3 );
+
+        /* Rounds 76 to 79 */
+        e1 = _mm_sha1nexte_epu32( e1, sched3 );
+        e0 = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, 3 );
+
+        e0 = _mm_sha1nexte_epu32( e0, e0_orig );
+        abcd = _mm_add_epi32( abcd, abcd_orig );
+    }
+
+    abcd = _mm_shuffle_epi32( abcd, 0x1B );
+    _mm_storeu_si128( (__m128i *) &ctx->state[0], abcd );
+    ctx->state[4] = (uint32_t) _mm_extract_epi32( e0, 3 );
+
+    return( processed );
+}
+
+#undef SHA1_X86_SHANI_ROUNDS4
+
+static int mbedtls_internal_sha1_process_x86_shani( mbedtls_sha1_context *ctx,
+        const unsigned char data[SHA1_BLOCK_SIZE] )
+{
+    return( ( mbedtls_internal_sha1_process_many_x86_shani( ctx, data,
+                SHA1_BLOCK_SIZE ) == SHA1_BLOCK_SIZE ) ? 0 : -1 );
+}
+
+#endif /* MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT */
+
+
+#if !defined(MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT)
+#define mbedtls_internal_sha1_process_many_c mbedtls_internal_sha1_process_many
+#define mbedtls_internal_sha1_process_c      mbedtls_internal_sha1_process
+#endif
+
+
 #if !defined(MBEDTLS_SHA1_PROCESS_ALT)
-int mbedtls_internal_sha1_process( mbedtls_sha1_context *ctx,
-                                   const unsigned char data[64] )
+
+#if defined(MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT)
+/*
+ * This function is for internal use only if we are building both C and
+ * SHA-NI versions, otherwise it is renamed to be the public
+ * mbedtls_internal_sha1_process()
+ */
+static
+#endif
+int mbedtls_internal_sha1_process_c( mbedtls_sha1_context *ctx,
+                                     const unsigned char data[SHA1_BLOCK_SIZE] )
 {
     struct
     {
@@ -244,6 +468,65 @@ int mbedtls_internal_sha1_process( mbedtls_sha1_context *ctx,
 
 #endif /* !MBEDTLS_SHA1_PROCESS_ALT */
 
+
+static size_t mbedtls_internal_sha1_process_many_c(
+                  mbedtls_sha1_context *ctx, const uint8_t *data, size_t len )
+{
+    size_t processed = 0;
+
+    while( len >= SHA1_BLOCK_SIZE )
+    {
+        if( mbedtls_internal_sha1_process_c( ctx, data ) != 0 )
+            return( 0 );
+
+        data += SHA1_BLOCK_SIZE;
+        len  -= SHA1_BLOCK_SIZE;
+
+        processed += SHA1_BLOCK_SIZE;
+    }
+
+    return( processed );
+}
+
+
+#if defined(MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT)
+
+static sha1_once_t x86_shani_sha1_once = SHA1_ONCE_INIT;
+static int x86_shani_sha1_supported = 0;
+
+static void mbedtls_x86_shani_sha1_detect( void )
+{
+    x86_shani_sha1_supported = mbedtls_x86_shani_sha1_determine_support();
+}
+
+static int mbedtls_x86_shani_sha1_has_support( void )
+{
+    sha1_call_once( &x86_shani_sha1_once, mbedtls_x86_shani_sha1_detect );
+
+    return( x86_shani_sha1_supported );
+}
+
+static size_t mbedtls_internal_sha1_process_many( mbedtls_sha1_context *ctx,
+                  const uint8_t *msg, size_t len )
+{
+    if( mbedtls_x86_shani_sha1_has_support() )
+        return( mbedtls_internal_sha1_process_many_x86_shani( ctx, msg, len ) );
+    else
+        return( mbedtls_internal_sha1_process_many_c( ctx, msg, len ) );
+}
+
+int mbedtls_internal_sha1_process( mbedtls_sha1_context *ctx,
+                                   const unsigned char data[SHA1_BLOCK_SIZE] )
+{
+    if( mbedtls_x86_shani_sha1_has_support() )
+        return( mbedtls_internal_sha1_process_x86_shani( ctx, data ) );
+    else
+        return( mbedtls_internal_sha1_process_c( ctx, data ) );
+}
+
+#endif /* MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT */
+
+
 /*
  * SHA-1 process buffer
  */
@@ -279,13 +562,15 @@ int mbedtls_sha1_update( mbedtls_sha1_context *ctx,
         left = 0;
     }
 
-    while( ilen >= 64 )
+    while( ilen >= SHA1_BLOCK_SIZE )
     {
-        if( ( ret = mbedtls_internal_sha1_process( ctx, input ) ) != 0 )
-            return( ret );
+        size_t processed =
+                    mbedtls_internal_sha1_process_many( ctx, input, ilen );
+        if( processed < SHA1_BLOCK_SIZE )
+            return( MBEDTLS_ERR_ERROR_GENERIC_ERROR );
 
-        input += 64;
-        ilen  -= 64;
+        input += processed;
+        ilen  -= processed;
     }
 
     if( ilen > 0 )
@@ -27,6 +27,7 @@
 #if defined(MBEDTLS_SHA256_C)
 
 #include "mbedtls/sha256.h"
+#include "sha256_invasive.h"
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
 
@@ -59,6 +60,69 @@
 #  undef MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT
 #endif
 
+#if defined(MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT)
+#  if defined(__GNUC__) && ( defined(__amd64__) || defined(__x86_64__) ) && \
+      defined(MBEDTLS_HAVE_ASM)
+#    include <immintrin.h>
+#    ifndef asm
+#      define asm __asm
+#    endif
+#  else
+#    undef MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT
+#  endif
+#endif
+
+/*
+ * SIMD support for mbedtls_sha256_multi(), selected at build time; AVX2 is
+ * also checked at runtime.
+ */
+#if !defined(MBEDTLS_SHA256_ALT) && !defined(MBEDTLS_SHA256_PROCESS_ALT)
+#  if defined(__GNUC__) && ( defined(__amd64__) || defined(__x86_64__) ) && \
+      defined(MBEDTLS_HAVE_ASM)
+#    define SHA256_MULTI_AVX2
+#    include <immintrin.h>
+#    ifndef asm
+#      define asm __asm
+#    endif
+#  elif defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#    define SHA256_MULTI_NEON
+#    include <arm_neon.h>
+#  endif
+#endif
+
+/*
+ * The CPU features are detected once per process. Several threads may hash
+ * at the same time (for example LMS key generation with
+ * MBEDTLS_LMS_KEYGEN_THREADS), so with pthreads the detection runs under
+ * pthread_once(): the SIGILL probe is not reentrant, and the result must be
+ * visible to every thread before it is used.
+ */
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include "mbedtls/threading.h"
+
+typedef pthread_once_t sha256_once_t;
+#define SHA256_ONCE_INIT PTHREAD_ONCE_INIT
+
+static inline void sha256_call_once( sha256_once_t *once,
+                                     void (*init)( void ) )
+{
+    (void) pthread_once( once, init );
+}
+#else
+typedef int sha256_once_t;
+#define SHA256_ONCE_INIT 0
+
+static inline void sha256_call_once( sha256_once_t *once,
+                                     void (*init)( void ) )
+{
+    if( !*once )
+    {
+        init();
+        *once = 1;
+    }
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
 #if defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT)
 /*
  * Capability detection code comes early, so we can disable
@@ -139,6 +203,34 @@ static int mbedtls_a64_crypto_sha256_determine_support( void )
 
 #endif  /* MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT */
 
+#if defined(MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT)
+/*
+ * x86-64 SHA extensions detection: the kernel also needs SSSE3 (pshufb,
+ * palignr) and SSE4.1 (pblendw), which every SHA-capable CPU has, but check
+ * them anyway rather than rely on that.
+ */
+static int mbedtls_x86_shani_sha256_determine_support( void )
+{
+    unsigned int a, b, c, d;
+
+    /* volatile: cpuid may trap to a hypervisor, so it must not be hoisted
+     * out of the one-time check in the caller */
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (0), "c" (0) );
+    if( a < 7 )
+        return( 0 );
+
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (1), "c" (0) );
+    if( ( c & ( 1U << 9 ) ) == 0 || ( c & ( 1U << 19 ) ) == 0 )
+        return( 0 );
+
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (7), "c" (0) );
+    return( ( b & ( 1U << 29 ) ) ? 1 : 0 );
+}
+#endif  /* MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT */
+
 #if !defined(MBEDTLS_SHA256_ALT)
 
 #define SHA256_BLOCK_SIZE 64
@@ -355,7 +447,119 @@ int mbedtls_internal_sha256_process_a64_crypto( mbedtls_sha256_context *ctx,
 #endif /* MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT || MBEDTLS_SHA256_USE_A64_CRYPTO_ONLY */
 
 
-#if !defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT)
+#if defined(MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT)
+
+/*
+ * The SHA extensions keep the working variables in two registers, ABEF and
+ * CDGH (most significant lane first), and sha256rnds2 performs two rounds,
+ * taking its two message + constant words from the low half of the third
+ * operand.
+ */
+#define SHA256_X86_SHANI_ROUNDS4( sched, t )                           \
+    do                                                                  \
+    {                                                                   \
+        tmp = _mm_add_epi32( (sched),                                   \
+                    _mm_loadu_si128( (const __m128i *) &K[(t)] ) );     \
+        cdgh = _mm_sha256rnds2_epu32( cdgh, abef, tmp );                \
+        tmp = _mm_shuffle_epi32( tmp, 0x0E );                           \
+        abef = _mm_sha256rnds2_epu32( abef, cdgh, tmp );                \
+    } while( 0 )
+
+__attribute__((target("sha,sse4.1")))
+static size_t mbedtls_internal_sha256_process_many_x86_shani(
+                  mbedtls_sha256_context *ctx, const uint8_t *msg, size_t len )
+{
+    const __m128i bswap = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL,
+                                          0x0405060700010203ULL );
+    __m128i abef, cdgh, tmp;
+    int t;
+
+    size_t processed = 0;
+
+    /* DCBA, HGFE -> ABEF, CDGH */
+    tmp  = _mm_loadu_si128( (const __m128i *) &ctx->state[0] );
+    cdgh = _mm_loadu_si128( (const __m128i *) &ctx->state[4] );
+    tmp  = _mm_shuffle_epi32( tmp, 0xB1 );
+    cdgh = _mm_shuffle_epi32( cdgh, 0x1B );
+    abef = _mm_alignr_epi8( tmp, cdgh, 8 );
+    cdgh = _mm_blend_epi16( cdgh, tmp, 0xF0 );
+
+    for( ;
+         len >= SHA256_BLOCK_SIZE;
+         processed += SHA256_BLOCK_SIZE,
+               msg += SHA256_BLOCK_SIZE,
+               len -= SHA256_BLOCK_SIZE )
+    {
+        __m128i abef_orig = abef;
+        __m128i cdgh_orig = cdgh;
+
+        __m128i sched0 = _mm_loadu_si128( (const __m128i *) ( msg + 16 * 0 ) );
+        __m128i sched1 = _mm_loadu_si128( (const __m128i *) ( msg + 16 * 1 ) );
+        __m128i sched2 = _mm_loadu_si128( (const __m128i *) ( msg + 16 * 2 ) );
+        __m128i sched3 = _mm_loadu_si128( (const __m128i *) ( msg + 16 * 3 ) );
+
+        sched0 = _mm_shuffle_epi8( sched0, bswap );
+        sched1 = _mm_shuffle_epi8( sched1, bswap );
+        sched2 = _mm_shuffle_epi8( sched2, bswap );
+        sched3 = _mm_shuffle_epi8( sched3, bswap );
+
+        SHA256_X86_SHANI_ROUNDS4( sched0, 0 );
+        SHA256_X86_SHANI_ROUNDS4( sched1, 4 );
+        SHA256_X86_SHANI_ROUNDS4( sched2, 8 );
+        SHA256_X86_SHANI_ROUNDS4( sched3, 12 );
+
+        for( t = 16; t < 64; t += 16 )
+        {
+            sched0 = _mm_sha256msg2_epu32( _mm_add_epi32(
+                         _mm_sha256msg1_epu32( sched0, sched1 ),
+                         _mm_alignr_epi8( sched3, sched2, 4 ) ), sched3 );
+            SHA256_X86_SHANI_ROUNDS4( sched0, t );
+
+            sched1 = _mm_sha256msg2_epu32( _mm_add_epi32(
+                         _mm_sha256msg1_epu32( sched1, sched2 ),
+                         _mm_alignr_epi8( sched0, sched3, 4 ) ), sched0 );
+            SHA256_X86_SHANI_ROUNDS4( sched1, t + 4 );
+
+            sched2 = _mm_sha256msg2_epu32( _mm_add_epi32(
+                         _mm_sha256msg1_epu32( sched2, sched3 ),
+                         _mm_alignr_epi8( sched1, sched0, 4 ) ), sched1 );
+            SHA256_X86_SHANI_ROUNDS4( sched2, t + 8 );
+
+            sched3 = _mm_sha256msg2_epu32( _mm_add_epi32(
+                         _mm_sha256msg1_epu32( sched3, sched0 ),
+                         _mm_alignr_epi8( sched2, sched1, 4 ) ), sched2 );
+            SHA256_X86_SHANI_ROUNDS4( sched3, t + 12 );
+        }
+
+        abef = _mm_add_epi32( abef, abef_orig );
+        cdgh = _mm_add_epi32( cdgh, cdgh_orig );
+    }
+
+    /* ABEF, CDGH -> DCBA, HGFE */
+    tmp  = _mm_shuffle_epi32( abef, 0x1B );
+    cdgh = _mm_shuffle_epi32( cdgh, 0xB1 );
+    abef = _mm_blend_epi16( tmp, cdgh, 0xF0 );
+    cdgh = _mm_alignr_epi8( cdgh, tmp, 8 );
+    _mm_storeu_si128( (__m128i *) &ctx->state[0], abef );
+    _mm_storeu_si128( (__m128i *) &ctx->state[4], cdgh );
+
+    return( processed );
+}
+
+#undef SHA256_X86_SHANI_ROUNDS4
+
+static int mbedtls_internal_sha256_process_x86_shani( mbedtls_sha256_context *ctx,
+        const unsigned char data[SHA256_BLOCK_SIZE] )
+{
+    return( ( mbedtls_internal_sha256_process_many_x86_shani( ctx, data,
+                SHA256_BLOCK_SIZE ) == SHA256_BLOCK_SIZE ) ? 0 : -1 );
+}
+
+#endif /* MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT */
+
+
+#if !defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT) && \
+    !defined(MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT)
 #define mbedtls_internal_sha256_process_many_c mbedtls_internal_sha256_process_many
 #define mbedtls_internal_sha256_process_c      mbedtls_internal_sha256_process
 #endif
@@ -390,10 +594,12 @@ int mbedtls_internal_sha256_process_a64_crypto( mbedtls_sha256_context *ctx,
         (d) += local.temp1; (h) = local.temp1 + local.temp2;        \
     } while( 0 )
 
-#if defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT)
+#if defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT) || \
+    defined(MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT)
 /*
- * This function is for internal use only if we are building both C and A64
- * versions, otherwise it is renamed to be the public mbedtls_internal_sha256_process()
+ * This function is for internal use only if we are building both C and
+ * accelerated versions, otherwise it is renamed to be the public
+ * mbedtls_internal_sha256_process()
  */
 static
 #endif
@@ -511,18 +717,20 @@ static size_t mbedtls_internal_sha256_process_many_c(
 
 #if defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT)
 
-static int mbedtls_a64_crypto_sha256_has_support( void )
+static sha256_once_t a64_crypto_sha256_once = SHA256_ONCE_INIT;
+static int a64_crypto_sha256_supported = 0;
+
+static void mbedtls_a64_crypto_sha256_detect( void )
 {
-    static int done = 0;
-    static int supported = 0;
+    a64_crypto_sha256_supported = mbedtls_a64_crypto_sha256_determine_support();
+}
 
-    if( !done )
-    {
-        supported = mbedtls_a64_crypto_sha256_determine_support();
-        done = 1;
-    }
+static int mbedtls_a64_crypto_sha256_has_support( void )
+{
+    sha256_call_once( &a64_crypto_sha256_once,
+                      mbedtls_a64_crypto_sha256_detect );
 
-    return( supported );
+    return( a64_crypto_sha256_supported );
 }
 
 static size_t mbedtls_internal_sha256_process_many( mbedtls_sha256_context *ctx,
@@ -546,6 +754,45 @@ int mbedtls_internal_sha256_process( mbedtls_sha256_context *ctx,
 #endif /* MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT */
 
 
+#if defined(MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT)
+
+static sha256_once_t x86_shani_sha256_once = SHA256_ONCE_INIT;
+static int x86_shani_sha256_supported = 0;
+
+static void mbedtls_x86_shani_sha256_detect( void )
+{
+    x86_shani_sha256_supported = mbedtls_x86_shani_sha256_determine_support();
+}
+
+static int mbedtls_x86_shani_sha256_has_support( void )
+{
+    sha256_call_once( &x86_shani_sha256_once,
+                      mbedtls_x86_shani_sha256_detect );
+
+    return( x86_shani_sha256_supported );
+}
+
+static size_t mbedtls_internal_sha256_process_many( mbedtls_sha256_context *ctx,
+                  const uint8_t *msg, size_t len )
+{
+    if( mbedtls_x86_shani_sha256_has_support() )
+        return( mbedtls_internal_sha256_process_many_x86_shani( ctx, msg, len ) );
+    else
+        return( mbedtls_internal_sha256_process_many_c( ctx, msg, len ) );
+}
+
+int mbedtls_internal_sha256_process( mbedtls_sha256_context *ctx,
+        const unsigned char data[SHA256_BLOCK_SIZE] )
+{
+    if( mbedtls_x86_shani_sha256_has_support() )
+        return( mbedtls_internal_sha256_process_x86_shani( ctx, data ) );
+    else
+        return( mbedtls_internal_sha256_process_c( ctx, data ) );
+}
+
+#endif /* MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT */
+
+
 /*
  * SHA-256 process buffer
  */
@@ -665,6 +912,382 @@ int mbedtls_sha256_finish( mbedtls_sha256_context *ctx,
     return( 0 );
 }
 
+#if defined(MBEDTLS_TEST_HOOKS)
+int mbedtls_sha256_multi_force_simd = 0;
+#endif
+
+#if defined(SHA256_MULTI_AVX2) || defined(SHA256_MULTI_NEON)
+
+#if defined(MBEDTLS_TEST_HOOKS)
+#define SHA256_MULTI_FORCE_SIMD mbedtls_sha256_multi_force_simd
+#else
+#define SHA256_MULTI_FORCE_SIMD 0
+#endif
+
+/*
+ * Multi-buffer SHA-256: independent messages are hashed together, one per
+ * 32-bit lane of a vector register. Between blocks, the working state and
+ * the message words are kept transposed in memory (word-major, lane-minor)
+ * so that the compression function only needs plain vector loads.
+ */
+#if defined(SHA256_MULTI_AVX2)
+
+#define SHA256_MULTI_LANES  8
+#define SHA256_MULTI_TARGET __attribute__((target("avx2")))
+
+typedef __m256i sha256_multi_vec;
+
+#define SHA256_V_LOAD(p)     _mm256_loadu_si256( (const __m256i *) (p) )
+#define SHA256_V_STORE(p,v)  _mm256_storeu_si256( (__m256i *) (p), (v) )
+#define SHA256_V_SET1(x)     _mm256_set1_epi32( (int) (x) )
+#define SHA256_V_ADD(x,y)    _mm256_add_epi32( (x), (y) )
+#define SHA256_V_AND(x,y)    _mm256_and_si256( (x), (y) )
+#define SHA256_V_OR(x,y)     _mm256_or_si256( (x), (y) )
+#define SHA256_V_XOR(x,y)    _mm256_xor_si256( (x), (y) )
+#define SHA256_V_SHR(x,n)    _mm256_srli_epi32( (x), (n) )
+#define SHA256_V_ROTR(x,n)   _mm256_or_si256( _mm256_srli_epi32( (x), (n) ), \
+                                              _mm256_slli_epi32( (x), 32 - (n) ) )
+
+static sha256_once_t sha256_multi_once = SHA256_ONCE_INIT;
+static int sha256_multi_avx2_supported = 0;
+
+static void sha256_multi_detect( void )
+{
+    unsigned int a, b, c, d;
+
+    /* volatile: cpuid may trap to a hypervisor, so keep it in here */
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (1), "c" (0) );
+
+    /* OSXSAVE and AVX, then check that the OS saves the YMM state */
+    if( ( c & ( 1U << 27 ) ) != 0 && ( c & ( 1U << 28 ) ) != 0 )
+    {
+        asm volatile( ".byte 0x0f, 0x01, 0xd0" : "=a" (a), "=d" (d)
+                                               : "c" (0) );
+        if( ( a & 0x6 ) == 0x6 )
+        {
+            asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                                  : "a" (7), "c" (0) );
+            sha256_multi_avx2_supported = ( b & ( 1U << 5 ) ) != 0;
+        }
+    }
+}
+
+static int sha256_multi_has_support( void )
+{
+#if defined(MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT)
+    /* The SHA extensions beat eight AVX2 lanes */
+    if( mbedtls_x86_shani_sha256_has_support() &&
+        !SHA256_MULTI_FORCE_SIMD )
+        return( 0 );
+#endif
+
+    sha256_call_once( &sha256_multi_once, sha256_multi_detect );
+
+    return( sha256_multi_avx2_supported );
+}
+
+#else /* SHA256_MULTI_NEON */
+
+#define SHA256_MULTI_LANES  4
+#define SHA256_MULTI_TARGET
+
+typedef uint32x4_t sha256_multi_vec;
+
+#define SHA256_V_LOAD(p)     vld1q_u32( (p) )
+#define SHA256_V_STORE(p,v)  vst1q_u32( (p), (v) )
+#define SHA256_V_SET1(x)     vdupq_n_u32( (x) )
+#define SHA256_V_ADD(x,y)    vaddq_u32( (x), (y) )
+#define SHA256_V_AND(x,y)    vandq_u32( (x), (y) )
+#define SHA256_V_OR(x,y)     vorrq_u32( (x), (y) )
+#define SHA256_V_XOR(x,y)    veorq_u32( (x), (y) )
+#define SHA256_V_SHR(x,n)    vshrq_n_u32( (x), (n) )
+#define SHA256_V_ROTR(x,n)   vsriq_n_u32( vshlq_n_u32( (x), 32 - (n) ), (x), (n) )
+
+static int sha256_multi_has_support( void )
+{
+#if defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT)
+    /* The SHA-256 instructions beat four Neon lanes */
+    return( !mbedtls_a64_crypto_sha256_has_support() ||
+            SHA256_MULTI_FORCE_SIMD );
+#elif defined(MBEDTLS_SHA256_USE_A64_CRYPTO_ONLY)
+    return( SHA256_MULTI_FORCE_SIMD );
+#else
+    return( 1 );
+#endif
+}
+
+#endif /* SHA256_MULTI_AVX2 */
+
+#define SHA256_V_XOR3(x,y,z) SHA256_V_XOR( SHA256_V_XOR( (x), (y) ), (z) )
+
+#define SHA256_V_S0(x) SHA256_V_XOR3( SHA256_V_ROTR(x, 7), SHA256_V_ROTR(x,18), \
+                                      SHA256_V_SHR(x, 3) )
+#define SHA256_V_S1(x) SHA256_V_XOR3( SHA256_V_ROTR(x,17), SHA256_V_ROTR(x,19), \
+                                      SHA256_V_SHR(x,10) )
+#define SHA256_V_S2(x) SHA256_V_XOR3( SHA256_V_ROTR(x, 2), SHA256_V_ROTR(x,13), \
+                                      SHA256_V_ROTR(x,22) )
+#define SHA256_V_S3(x) SHA256_V_XOR3( SHA256_V_ROTR(x, 6), SHA256_V_ROTR(x,11), \
+                                      SHA256_V_ROTR(x,25) )
+
+#define SHA256_V_F0(x,y,z) SHA256_V_OR( SHA256_V_AND( (x), (y) ),              \
+                               SHA256_V_AND( (z), SHA256_V_OR( (x), (y) ) ) )
+#define SHA256_V_F1(x,y,z) SHA256_V_XOR( (z),                                  \
+                               SHA256_V_AND( (x), SHA256_V_XOR( (y), (z) ) ) )
+
+/* Message schedule for round t >= 16, with k = t % 16 */
+#define SHA256_V_R(k)                                                       \
+    (                                                                       \
+        W[k] = SHA256_V_ADD(                                                \
+            SHA256_V_ADD( SHA256_V_S1( W[((k) + 14) & 15] ),                \
+                          W[((k) +  9) & 15] ),                             \
+            SHA256_V_ADD( SHA256_V_S0( W[((k) +  1) & 15] ),                \
+                          W[k] ) )                                          \
+    )
+
+#define SHA256_V_P(a,b,c,d,e,f,g,h,x,t)                                     \
+    do                                                                      \
+    {                                                                       \
+        temp1 = SHA256_V_ADD(                                               \
+            SHA256_V_ADD( SHA256_V_ADD( (h), SHA256_V_S3(e) ),              \
+                          SHA256_V_F1( (e), (f), (g) ) ),                   \
+            SHA256_V_ADD( SHA256_V_SET1( K[t] ), (x) ) );                   \
+        temp2 = SHA256_V_ADD( SHA256_V_S2(a), SHA256_V_F0( (a), (b), (c) ) ); \
+        (d) = SHA256_V_ADD( (d), temp1 );                                   \
+        (h) = SHA256_V_ADD( temp1, temp2 );                                 \
+    } while( 0 )
+
+#define SHA256_V_ROUNDS8(i,x0,x1,x2,x3,x4,x5,x6,x7)                         \
+    do                                                                      \
+    {                                                                       \
+        SHA256_V_P( A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7], x0, (i) + 0 ); \
+        SHA256_V_P( A[7], A[0], A[1], A[2], A[3], A[4], A[5], A[6], x1, (i) + 1 ); \
+        SHA256_V_P( A[6], A[7], A[0], A[1], A[2], A[3], A[4], A[5], x2, (i) + 2 ); \
+        SHA256_V_P( A[5], A[6], A[7], A[0], A[1], A[2], A[3], A[4], x3, (i) + 3 ); \
+        SHA256_V_P( A[4], A[5], A[6], A[7], A[0], A[1], A[2], A[3], x4, (i) + 4 ); \
+        SHA256_V_P( A[3], A[4], A[5], A[6], A[7], A[0], A[1], A[2], x5, (i) + 5 ); \
+        SHA256_V_P( A[2], A[3], A[4], A[5], A[6], A[7], A[0], A[1], x6, (i) + 6 ); \
+        SHA256_V_P( A[1], A[2], A[3], A[4], A[5], A[6], A[7], A[0], x7, (i) + 7 ); \
+    } while( 0 )
+
+/*
+ * Compress one block in each lane.
+ */
+SHA256_MULTI_TARGET
+static void sha256_multi_compress( uint32_t state[8][SHA256_MULTI_LANES],
+                                   const uint32_t msg[16][SHA256_MULTI_LANES] )
+{
+    sha256_multi_vec A[8], W[16], temp1, temp2;
+    unsigned int i;
+
+    for( i = 0; i < 8; i++ )
+        A[i] = SHA256_V_LOAD( state[i] );
+
+    for( i = 0; i < 16; i++ )
+        W[i] = SHA256_V_LOAD( msg[i] );
+
+    SHA256_V_ROUNDS8( 0, W[0], W[1], W[2], W[3], W[4], W[5], W[6], W[7] );
+    SHA256_V_ROUNDS8( 8, W[8], W[9], W[10], W[11], W[12], W[13], W[14], W[15] );
+
+    for( i = 16; i < 64; i += 16 )
+    {
+        SHA256_V_ROUNDS8( i, SHA256_V_R( 0 ), SHA256_V_R( 1 ),
+                             SHA256_V_R( 2 ), SHA256_V_R( 3 ),
+                             SHA256_V_R( 4 ), SHA256_V_R( 5 ),
+                             SHA256_V_R( 6 ), SHA256_V_R( 7 ) );
+        SHA256_V_ROUNDS8( i + 8, SHA256_V_R( 8 ), SHA256_V_R( 9 ),
+                                 SHA256_V_R( 10 ), SHA256_V_R( 11 ),
+                                 SHA256_V_R( 12 ), SHA256_V_R( 13 ),
+                                 SHA256_V_R( 14 ), SHA256_V_R( 15 ) );
+    }
+
+    for( i = 0; i < 8; i++ )
+        SHA256_V_STORE( state[i], SHA256_V_ADD( SHA256_V_LOAD( state[i] ), A[i] ) );
+}
+
+/*
+ * One message being hashed in a lane: the full blocks are read from the
+ * caller's buffer, the padded final block(s) from tail.
+ */
+typedef struct
+{
+    size_t index;               /* message index, or count if the lane is idle */
+    const unsigned char *input; /* next full block of the message */
+    size_t blocks;              /* full blocks left in input */
+    const unsigned char *next;  /* next block of tail */
+    size_t tail_blocks;         /* blocks left in tail */
+    unsigned char tail[2 * SHA256_BLOCK_SIZE];
+}
+sha256_multi_lane;
+
+static void sha256_multi_lane_start( sha256_multi_lane *lane,
+                                     uint32_t state[8][SHA256_MULTI_LANES],
+                                     unsigned int l, const uint32_t iv[8],
+                                     size_t index,
+                                     const unsigned char *input, size_t ilen )
+{
+    size_t left = ilen % SHA256_BLOCK_SIZE;
+    size_t tail_len;
+    unsigned int i;
+
+    lane->index = index;
+    lane->input = input;
+    lane->blocks = ilen / SHA256_BLOCK_SIZE;
+
+    memset( lane->tail, 0, sizeof( lane->tail ) );
+    if( left > 0 )
+        memcpy( lane->tail, input + ilen - left, left );
+    lane->tail[left] = 0x80;
+
+    lane->next = lane->tail;
+    lane->tail_blocks = ( left < SHA256_BLOCK_SIZE - 8 ) ? 1 : 2;
+    tail_len = lane->tail_blocks * SHA256_BLOCK_SIZE;
+
+    MBEDTLS_PUT_UINT32_BE( (uint32_t) ( ( (uint64_t) ilen ) >> 29 ),
+                           lane->tail, tail_len - 8 );
+    MBEDTLS_PUT_UINT32_BE( (uint32_t) ( ilen << 3 ), lane->tail, tail_len - 4 );
+
+    for( i = 0; i < 8; i++ )
+        state[i][l] = iv[i];
+}
+
+static int sha256_multi_simd( const unsigned char * const input[],
+                              const size_t ilen[],
+                              unsigned char * const output[],
+                              size_t count, int is224 )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_sha256_context ctx;
+    struct
+    {
+        sha256_multi_lane lane[SHA256_MULTI_LANES];
+        uint32_t state[8][SHA256_MULTI_LANES];
+        uint32_t msg[16][SHA256_MULTI_LANES];
+    } local;
+    uint32_t iv[8];
+    size_t next = 0;
+    unsigned int active = 0;
+    unsigned int i, l;
+
+    mbedtls_sha256_init( &ctx );
+
+    if( ( ret = mbedtls_sha256_starts( &ctx, is224 ) ) != 0 )
+        goto exit;
+    memcpy( iv, ctx.state, sizeof( iv ) );
+
+    memset( &local, 0, sizeof( local ) );
+
+    for( l = 0; l < SHA256_MULTI_LANES; l++ )
+    {
+        if( next < count )
+        {
+            sha256_multi_lane_start( &local.lane[l], local.state, l, iv,
+                                     next, input[next], ilen[next] );
+            next++;
+            active++;
+        }
+        else
+            local.lane[l].index = count;
+    }
+
+    /* Run all lanes together while more than one is busy */
+    while( active > 1 )
+    {
+        for( l = 0; l < SHA256_MULTI_LANES; l++ )
+        {
+            const sha256_multi_lane *lane = &local.lane[l];
+            const unsigned char *block;
+
+            if( lane->index == count )
+                block = lane->tail;
+            else if( lane->blocks > 0 )
+                block = lane->input;
+            else
+                block = lane->next;
+
+            for( i = 0; i < 16; i++ )
+                local.msg[i][l] = MBEDTLS_GET_UINT32_BE( block, 4 * i );
+        }
+
+        sha256_multi_compress( local.state, local.msg );
+
+        for( l = 0; l < SHA256_MULTI_LANES; l++ )
+        {
+            sha256_multi_lane *lane = &local.lane[l];
+
+            if( lane->index == count )
+                continue;
+
+            if( lane->blocks > 0 )
+            {
+                lane->input += SHA256_BLOCK_SIZE;
+                lane->blocks--;
+                continue;
+            }
+
+            lane->next += SHA256_BLOCK_SIZE;
+            if( --lane->tail_blocks > 0 )
+                continue;
+
+            for( i = 0; i < ( is224 ? 7U : 8U ); i++ )
+                MBEDTLS_PUT_UINT32_BE( local.state[i][l], output[lane->index], 4 * i );
+
+            if( next < count )
+            {
+                sha256_multi_lane_start( lane, local.state, l, iv,
+                                         next, input[next], ilen[next] );
+                next++;
+            }
+            else
+            {
+                lane->index = count;
+                active--;
+            }
+        }
+    }
+
+    /* Finish the last message, if any, with the single-buffer code */
+    for( l = 0; l < SHA256_MULTI_LANES && active > 0; l++ )
+    {
+        sha256_multi_lane *lane = &local.lane[l];
+
+        if( lane->index == count )
+            continue;
+
+        for( i = 0; i < 8; i++ )
+            ctx.state[i] = local.state[i][l];
+
+        for( ; lane->blocks > 0; lane->blocks-- )
+        {
+            if( ( ret = mbedtls_internal_sha256_process( &ctx, lane->input ) ) != 0 )
+                goto exit;
+            lane->input += SHA256_BLOCK_SIZE;
+        }
+
+        for( ; lane->tail_blocks > 0; lane->tail_blocks-- )
+        {
+            if( ( ret = mbedtls_internal_sha256_process( &ctx, lane->next ) ) != 0 )
+                goto exit;
+            lane->next += SHA256_BLOCK_SIZE;
+        }
+
+        for( i = 0; i < ( is224 ? 7U : 8U ); i++ )
+            MBEDTLS_PUT_UINT32_BE( ctx.state[i], output[lane->index], 4 * i );
+
+        active--;
+    }
+
+    ret = 0;
+
+exit:
+    mbedtls_sha256_free( &ctx );
+    mbedtls_platform_zeroize( &local, sizeof( local ) );
+
+    return( ret );
+}
+
+#endif /* SHA256_MULTI_AVX2 || SHA256_MULTI_NEON */
+
 #endif /* !MBEDTLS_SHA256_ALT */
 
 /*
@@ -703,6 +1326,40 @@ exit:
     return( ret );
 }
 
+/*
+ * output[i] = SHA-256( input[i] ) for several buffers
+ */
+int mbedtls_sha256_multi( const unsigned char * const input[],
+                          const size_t ilen[],
+                          unsigned char * const output[],
+                          size_t count,
+                          int is224 )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i;
+
+#if defined(MBEDTLS_SHA224_C)
+    if( is224 != 0 && is224 != 1 )
+        return MBEDTLS_ERR_SHA256_BAD_INPUT_DATA;
+#else
+    if( is224 != 0 )
+        return MBEDTLS_ERR_SHA256_BAD_INPUT_DATA;
+#endif
+
+#if defined(SHA256_MULTI_AVX2) || defined(SHA256_MULTI_NEON)
+    if( count > 1 && sha256_multi_has_support() )
+        return( sha256_multi_simd( input, ilen, output, count, is224 ) );
+#endif
+
+    for( i = 0; i < count; i++ )
+    {
+        if( ( ret = mbedtls_sha256( input[i], ilen[i], output[i], is224 ) ) != 0 )
+            return( ret );
+    }
+
+    return( 0 );
+}
+
 #if defined(MBEDTLS_SELF_TEST)
 /*
  * FIPS-180-2 test vectors
@@ -0,0 +1,45 @@
+/**
+ * \file sha256_invasive.h
+ *
+ * \brief SHA-256 module: interfaces for invasive testing only.
+ *
+ * The interfaces in this file are intended for testing purposes only.
+ * They SHOULD NOT be made available in library integrations except when
+ * building the library for testing.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef MBEDTLS_SHA256_INVASIVE_H
+#define MBEDTLS_SHA256_INVASIVE_H
+
+#include "common.h"
+#include "mbedtls/sha256.h"
+
+#if defined(MBEDTLS_TEST_HOOKS) && defined(MBEDTLS_SHA256_C)
+
+/** Force mbedtls_sha256_multi() to use its vector implementation.
+ *
+ * By default, mbedtls_sha256_multi() hashes the messages one at a time
+ * when the SHA-256 instructions are available, since they are faster
+ * than the AVX2 or Neon lanes. When this is nonzero, the lanes are used
+ * whenever the CPU supports them, so that they can be tested on any host.
+ */
+extern int mbedtls_sha256_multi_force_simd;
+
+#endif /* MBEDTLS_TEST_HOOKS && MBEDTLS_SHA256_C */
+
+#endif /* MBEDTLS_SHA256_INVASIVE_H */
@@ -65,6 +65,55 @@
 #  undef MBEDTLS_SHA512_USE_A64_CRYPTO_IF_PRESENT
 #endif
 
+/*
+ * SIMD support for mbedtls_sha512_multi(), selected at build time; AVX2 is
+ * also checked at runtime.
+ */
+#if !defined(MBEDTLS_SHA512_ALT) && !defined(MBEDTLS_SHA512_PROCESS_ALT)
+#  if defined(__GNUC__) && ( defined(__amd64__) || defined(__x86_64__) ) && \
+      defined(MBEDTLS_HAVE_ASM)
+#    define SHA512_MULTI_AVX2
+#    include <immintrin.h>
+#    ifndef asm
+#      define asm __asm
+#    endif
+#  elif defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#    define SHA512_MULTI_NEON
+#    include <arm_neon.h>
+#  endif
+#endif
+
+/*
+ * The CPU features are detected once per process, and several threads may
+ * hash at the same time, so with pthreads the detection runs under
+ * pthread_once(), as in sha256.c.
+ */
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include "mbedtls/threading.h"
+
+typedef pthread_once_t sha512_once_t;
+#define SHA512_ONCE_INIT PTHREAD_ONCE_INIT
+
+static inline void sha512_call_once( sha512_once_t *once,
+                                     void (*init)( void ) )
+{
+    (void) pthread_once( once, init );
+}
+#else
+typedef int sha512_once_t;
+#define SHA512_ONCE_INIT 0
+
+static inline void sha512_call_once( sha512_once_t *once,
+                                     void (*init)( void ) )
+{
+    if( !*once )
+    {
+        init();
+        *once = 1;
+    }
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
 #if defined(MBEDTLS_SHA512_USE_A64_CRYPTO_IF_PRESENT)
 /*
  * Capability detection code comes early, so we can disable
@@ -669,18 +718,20 @@ static size_t mbedtls_internal_sha512_process_many_c(
 
 #if defined(MBEDTLS_SHA512_USE_A64_CRYPTO_IF_PRESENT)
 
-static int mbedtls_a64_crypto_sha512_has_support( void )
+static sha512_once_t a64_crypto_sha512_once = SHA512_ONCE_INIT;
+static int a64_crypto_sha512_supported = 0;
+
+static void mbedtls_a64_crypto_sha512_detect( void )
 {
-    static int done = 0;
-    static int supported = 0;
+    a64_crypto_sha512_supported = mbedtls_a64_crypto_sha512_determine_support();
+}
 
-    if( !done )
-    {
-        supported = mbedtls_a64_crypto_sha512_determine_support();
-        done = 1;
-    }
+static int mbedtls_a64_crypto_sha512_has_support( void )
+{
+    sha512_call_once( &a64_crypto_sha512_once,
+                      mbedtls_a64_crypto_sha512_detect );
 
-    return( supported );
+    return( a64_crypto_sha512_supported );
 }
 
 static size_t mbedtls_internal_sha512_process_many( mbedtls_sha512_context *ctx,
@@ -823,6 +874,363 @@ int mbedtls_sha512_finish( mbedtls_sha512_context *ctx,
     return( 0 );
 }
 
+#if defined(SHA512_MULTI_AVX2) || defined(SHA512_MULTI_NEON)
+
+/*
+ * Multi-buffer SHA-512: independent messages are hashed together, one per
+ * 64-bit lane of a vector register. Between blocks, the working state and
+ * the message words are kept transposed in memory (word-major, lane-minor)
+ * so that the compression function only needs plain vector loads.
+ */
+#if defined(SHA512_MULTI_AVX2)
+
+#define SHA512_MULTI_LANES  4
+#define SHA512_MULTI_TARGET __attribute__((target("avx2")))
+
+typedef __m256i sha512_multi_vec;
+
+#define SHA512_V_LOAD(p)     _mm256_loadu_si256( (const __m256i *) (p) )
+#define SHA512_V_STORE(p,v)  _mm256_storeu_si256( (__m256i *) (p), (v) )
+#define SHA512_V_SET1(x)     _mm256_set1_epi64x( (long long) (x) )
+#define SHA512_V_ADD(x,y)    _mm256_add_epi64( (x), (y) )
+#define SHA512_V_AND(x,y)    _mm256_and_si256( (x), (y) )
+#define SHA512_V_OR(x,y)     _mm256_or_si256( (x), (y) )
+#define SHA512_V_XOR(x,y)    _mm256_xor_si256( (x), (y) )
+#define SHA512_V_SHR(x,n)    _mm256_srli_epi64( (x), (n) )
+#define SHA512_V_ROTR(x,n)   _mm256_or_si256( _mm256_srli_epi64( (x), (n) ), \
+                                              _mm256_slli_epi64( (x), 64 - (n) ) )
+
+static sha512_once_t sha512_multi_once = SHA512_ONCE_INIT;
+static int sha512_multi_avx2_supported = 0;
+
+static void sha512_multi_detect( void )
+{
+    unsigned int a, b, c, d;
+
+    /* volatile: cpuid may trap to a hypervisor, so keep it in here */
+    asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                          : "a" (1), "c" (0) );
+
+    /* OSXSAVE and AVX, then check that the OS saves the YMM state */
+    if( ( c & ( 1U << 27 ) ) != 0 && ( c & ( 1U << 28 ) ) != 0 )
+    {
+        asm volatile( ".byte 0x0f, 0x01, 0xd0" : "=a" (a), "=d" (d)
+                                               : "c" (0) );
+        if( ( a & 0x6 ) == 0x6 )
+        {
+            asm volatile( "cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+                                  : "a" (7), "c" (0) );
+            sha512_multi_avx2_supported = ( b & ( 1U << 5 ) ) != 0;
+        }
+    }
+}
+
+static int sha512_multi_has_support( void )
+{
+    sha512_call_once( &sha512_multi_once, sha512_multi_detect );
+
+    return( sha512_multi_avx2_supported );
+}
+
+#else /* SHA512_MULTI_NEON */
+
+#define SHA512_MULTI_LANES  2
+#define SHA512_MULTI_TARGET
+
+typedef uint64x2_t sha512_multi_vec;
+
+#define SHA512_V_LOAD(p)     vld1q_u64( (p) )
+#define SHA512_V_STORE(p,v)  vst1q_u64( (p), (v) )
+#define SHA512_V_SET1(x)     vdupq_n_u64( (x) )
+#define SHA512_V_ADD(x,y)    vaddq_u64( (x), (y) )
+#define SHA512_V_AND(x,y)    vandq_u64( (x), (y) )
+#define SHA512_V_OR(x,y)     vorrq_u64( (x), (y) )
+#define SHA512_V_XOR(x,y)    veorq_u64( (x), (y) )
+#define SHA512_V_SHR(x,n)    vshrq_n_u64( (x), (n) )
+#define SHA512_V_ROTR(x,n)   vsriq_n_u64( vshlq_n_u64( (x), 64 - (n) ), (x), (n) )
+
+static int sha512_multi_has_support( void )
+{
+#if defined(MBEDTLS_SHA512_USE_A64_CRYPTO_IF_PRESENT)
+    /* The SHA-512 instructions beat two Neon lanes */
+    return( !mbedtls_a64_crypto_sha512_has_support() );
+#elif defined(MBEDTLS_SHA512_USE_A64_CRYPTO_ONLY)
+    return( 0 );
+#else
+    return( 1 );
+#endif
+}
+
+#endif /* SHA512_MULTI_AVX2 */
+
+#define SHA512_V_XOR3(x,y,z) SHA512_V_XOR( SHA512_V_XOR( (x), (y) ), (z) )
+
+#define SHA512_V_S0(x) SHA512_V_XOR3( SHA512_V_ROTR(x, 1), SHA512_V_ROTR(x, 8), \
+                                      SHA512_V_SHR(x, 7) )
+#define SHA512_V_S1(x) SHA512_V_XOR3( SHA512_V_ROTR(x,19), SHA512_V_ROTR(x,61), \
+                                      SHA512_V_SHR(x, 6) )
+#define SHA512_V_S2(x) SHA512_V_XOR3( SHA512_V_ROTR(x,28), SHA512_V_ROTR(x,34), \
+                                      SHA512_V_ROTR(x,39) )
+#define SHA512_V_S3(x) SHA512_V_XOR3( SHA512_V_ROTR(x,14), SHA512_V_ROTR(x,18), \
+                                      SHA512_V_ROTR(x,41) )
+
+#define SHA512_V_F0(x,y,z) SHA512_V_OR( SHA512_V_AND( (x), (y) ),              \
+                               SHA512_V_AND( (z), SHA512_V_OR( (x), (y) ) ) )
+#define SHA512_V_F1(x,y,z) SHA512_V_XOR( (z),                                  \
+                               SHA512_V_AND( (x), SHA512_V_XOR( (y), (z) ) ) )
+
+/* Message schedule for round t >= 16, with k = t % 16 */
+#define SHA512_V_R(k)                                                       \
+    (                                                                       \
+        W[k] = SHA512_V_ADD(                                                \
+            SHA512_V_ADD( SHA512_V_S1( W[((k) + 14) & 15] ),                \
+                          W[((k) +  9) & 15] ),                             \
+            SHA512_V_ADD( SHA512_V_S0( W[((k) +  1) & 15] ),                \
+                          W[k] ) )                                          \
+    )
+
+#define SHA512_V_P(a,b,c,d,e,f,g,h,x,t)                                     \
+    do                                                                      \
+    {                                                                       \
+        temp1 = SHA512_V_ADD(                                               \
+            SHA512_V_ADD( SHA512_V_ADD( (h), SHA512_V_S3(e) ),              \
+                          SHA512_V_F1( (e), (f), (g) ) ),                   \
+            SHA512_V_ADD( SHA512_V_SET1( K[t] ), (x) ) );                   \
+        temp2 = SHA512_V_ADD( SHA512_V_S2(a), SHA512_V_F0( (a), (b), (c) ) ); \
+        (d) = SHA512_V_ADD( (d), temp1 );                                   \
+        (h) = SHA512_V_ADD( temp1, temp2 );                                 \
+    } while( 0 )
+
+#define SHA512_V_ROUNDS8(i,x0,x1,x2,x3,x4,x5,x6,x7)                         \
+    do                                                                      \
+    {                                                                       \
+        SHA512_V_P( A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7], x0, (i) + 0 ); \
+        SHA512_V_P( A[7], A[0], A[1], A[2], A[3], A[4], A[5], A[6], x1, (i) + 1 ); \
+        SHA512_V_P( A[6], A[7], A[0], A[1], A[2], A[3], A[4], A[5], x2, (i) + 2 ); \
+        SHA512_V_P( A[5], A[6], A[7], A[0], A[1], A[2], A[3], A[4], x3, (i) + 3 ); \
+        SHA512_V_P( A[4], A[5], A[6], A[7], A[0], A[1], A[2], A[3], x4, (i) + 4 ); \
+        SHA512_V_P( A[3], A[4], A[5], A[6], A[7], A[0], A[1], A[2], x5, (i) + 5 ); \
+        SHA512_V_P( A[2], A[3], A[4], A[5], A[6], A[7], A[0], A[1], x6, (i) + 6 ); \
+        SHA512_V_P( A[1], A[2], A[3], A[4], A[5], A[6], A[7], A[0], x7, (i) + 7 ); \
+    } while( 0 )
+
+/*
+ * Compress one block in each lane.
+ */
+SHA512_MULTI_TARGET
+static void sha512_multi_compress( uint64_t state[8][SHA512_MULTI_LANES],
+                                   const uint64_t msg[16][SHA512_MULTI_LANES] )
+{
+    sha512_multi_vec A[8], W[16], temp1, temp2;
+    unsigned int i;
+
+    for( i = 0; i < 8; i++ )
+        A[i] = SHA512_V_LOAD( state[i] );
+
+    for( i = 0; i < 16; i++ )
+        W[i] = SHA512_V_LOAD( msg[i] );
+
+    SHA512_V_ROUNDS8( 0, W[0], W[1], W[2], W[3], W[4], W[5], W[6], W[7] );
+    SHA512_V_ROUNDS8( 8, W[8], W[9], W[10], W[11], W[12], W[13], W[14], W[15] );
+
+    for( i = 16; i < 80; i += 16 )
+    {
+        SHA512_V_ROUNDS8( i, SHA512_V_R( 0 ), SHA512_V_R( 1 ),
+                             SHA512_V_R( 2 ), SHA512_V_R( 3 ),
+                             SHA512_V_R( 4 ), SHA512_V_R( 5 ),
+                             SHA512_V_R( 6 ), SHA512_V_R( 7 ) );
+        SHA512_V_ROUNDS8( i + 8, SHA512_V_R( 8 ), SHA512_V_R( 9 ),
+                                 SHA512_V_R( 10 ), SHA512_V_R( 11 ),
+                                 SHA512_V_R( 12 ), SHA512_V_R( 13 ),
+                                 SHA512_V_R( 14 ), SHA512_V_R( 15 ) );
+    }
+
+    for( i = 0; i < 8; i++ )
+        SHA512_V_STORE( state[i], SHA512_V_ADD( SHA512_V_LOAD( state[i] ), A[i] ) );
+}
+
+/*
+ * One message being hashed in a lane: the full blocks are read from the
+ * caller's buffer, the padded final block(s) from tail.
+ */
+typedef struct
+{
+    size_t index;               /* message index, or count if the lane is idle */
+    const unsigned char *input; /* next full block of the message */
+    size_t blocks;              /* full blocks left in input */
+    const unsigned char *next;  /* next block of tail */
+    size_t tail_blocks;         /* blocks left in tail */
+    unsigned char tail[2 * SHA512_BLOCK_SIZE];
+}
+sha512_multi_lane;
+
+static void sha512_multi_lane_start( sha512_multi_lane *lane,
+                                     uint64_t state[8][SHA512_MULTI_LANES],
+                                     unsigned int l, const uint64_t iv[8],
+                                     size_t index,
+                                     const unsigned char *input, size_t ilen )
+{
+    size_t left = ilen % SHA512_BLOCK_SIZE;
+    size_t tail_len;
+    unsigned int i;
+
+    lane->index = index;
+    lane->input = input;
+    lane->blocks = ilen / SHA512_BLOCK_SIZE;
+
+    memset( lane->tail, 0, sizeof( lane->tail ) );
+    if( left > 0 )
+        memcpy( lane->tail, input + ilen - left, left );
+    lane->tail[left] = 0x80;
+
+    lane->next = lane->tail;
+    lane->tail_blocks = ( left < SHA512_BLOCK_SIZE - 16 ) ? 1 : 2;
+    tail_len = lane->tail_blocks * SHA512_BLOCK_SIZE;
+
+    sha512_put_uint64_be( ( (uint64_t) ilen ) >> 61, lane->tail, tail_len - 16 );
+    sha512_put_uint64_be( ( (uint64_t) ilen ) << 3, lane->tail, tail_len - 8 );
+
+    for( i = 0; i < 8; i++ )
+        state[i][l] = iv[i];
+}
+
+static int sha512_multi_simd( const unsigned char * const input[],
+                              const size_t ilen[],
+                              unsigned char * const output[],
+                              size_t count, int is384 )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_sha512_context ctx;
+    struct
+    {
+        sha512_multi_lane lane[SHA512_MULTI_LANES];
+        uint64_t state[8][SHA512_MULTI_LANES];
+        uint64_t msg[16][SHA512_MULTI_LANES];
+    } local;
+    uint64_t iv[8];
+    size_t next = 0;
+    unsigned int active = 0;
+    unsigned int i, l;
+
+    mbedtls_sha512_init( &ctx );
+
+    if( ( ret = mbedtls_sha512_starts( &ctx, is384 ) ) != 0 )
+        goto exit;
+    memcpy( iv, ctx.state, sizeof( iv ) );
+
+    memset( &local, 0, sizeof( local ) );
+
+    for( l = 0; l < SHA512_MULTI_LANES; l++ )
+    {
+        if( next < count )
+        {
+            sha512_multi_lane_start( &local.lane[l], local.state, l, iv,
+                                     next, input[next], ilen[next] );
+            next++;
+            active++;
+        }
+        else
+            local.lane[l].index = count;
+    }
+
+    /* Run all lanes together while more than one is busy */
+    while( active > 1 )
+    {
+        for( l = 0; l < SHA512_MULTI_LANES; l++ )
+        {
+            const sha512_multi_lane *lane = &local.lane[l];
+            const unsigned char *block;
+
+            if( lane->index == count )
+                block = lane->tail;
+            else if( lane->blocks > 0 )
+                block = lane->input;
+            else
+                block = lane->next;
+
+            for( i = 0; i < 16; i++ )
+                local.msg[i][l] = MBEDTLS_GET_UINT64_BE( block, 8 * i );
+        }
+
+        sha512_multi_compress( local.state, local.msg );
+
+        for( l = 0; l < SHA512_MULTI_LANES; l++ )
+        {
+            sha512_multi_lane *lane = &local.lane[l];
+
+            if( lane->index == count )
+                continue;
+
+            if( lane->blocks > 0 )
+            {
+                lane->input += SHA512_BLOCK_SIZE;
+                lane->blocks--;
+                continue;
+            }
+
+            lane->next += SHA512_BLOCK_SIZE;
+            if( --lane->tail_blocks > 0 )
+                continue;
+
+            for( i = 0; i < ( is384 ? 6U : 8U ); i++ )
+                sha512_put_uint64_be( local.state[i][l], output[lane->index], 8 * i );
+
+            if( next < count )
+            {
+                sha512_multi_lane_start( lane, local.state, l, iv,
+                                         next, input[next], ilen[next] );
+                next++;
+            }
+            else
+            {
+                lane->index = count;
+                active--;
+            }
+        }
+    }
+
+    /* Finish the last message, if any, with the single-buffer code */
+    for( l = 0; l < SHA512_MULTI_LANES && active > 0; l++ )
+    {
+        sha512_multi_lane *lane = &local.lane[l];
+
+        if( lane->index == count )
+            continue;
+
+        for( i = 0; i < 8; i++ )
+            ctx.state[i] = local.state[i][l];
+
+        for( ; lane->blocks > 0; lane->blocks-- )
+        {
+            if( ( ret = mbedtls_internal_sha512_process( &ctx, lane->input ) ) != 0 )
+                goto exit;
+            lane->input += SHA512_BLOCK_SIZE;
+        }
+
+        for( ; lane->tail_blocks > 0; lane->tail_blocks-- )
+        {
+            if( ( ret = mbedtls_internal_sha512_process( &ctx, lane->next ) ) != 0 )
+                goto exit;
+            lane->next += SHA512_BLOCK_SIZE;
+        }
+
+        for( i = 0; i < ( is384 ? 6U : 8U ); i++ )
+            sha512_put_uint64_be( ctx.state[i], output[lane->index], 8 * i );
+
+        active--;
+    }
+
+    ret = 0;
+
+exit:
+    mbedtls_sha512_free( &ctx );
+    mbedtls_platform_zeroize( &local, sizeof( local ) );
+
+    return( ret );
+}
+
+#endif /* SHA512_MULTI_AVX2 || SHA512_MULTI_NEON */
+
 #endif /* !MBEDTLS_SHA512_ALT */
 
 /*
@@ -861,6 +1269,40 @@ exit:
     return( ret );
 }
 
+/*
+ * output[i] = SHA-512( input[i] ) for several buffers
+ */
+int mbedtls_sha512_multi( const unsigned char * const input[],
+                          const size_t ilen[],
+                          unsigned char * const output[],
+                          size_t count,
+                          int is384 )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i;
+
+#if defined(MBEDTLS_SHA384_C)
+    if( is384 != 0 && is384 != 1 )
+        return MBEDTLS_ERR_SHA512_BAD_INPUT_DATA;
+#else
+    if( is384 != 0 )
+        return MBEDTLS_ERR_SHA512_BAD_INPUT_DATA;
+#endif
+
+#if defined(SHA512_MULTI_AVX2) || defined(SHA512_MULTI_NEON)
+    if( count > 1 && sha512_multi_has_support() )
+        return( sha512_multi_simd( input, ilen, output, count, is384 ) );
+#endif
+
+    for( i = 0; i < count; i++ )
+    {
+        if( ( ret = mbedtls_sha512( input[i], ilen[i], output[i], is384 ) ) != 0 )
+            return( ret );
+    }
+
+    return( 0 );
+}
+
 #if defined(MBEDTLS_SELF_TEST)
 
 /*
@@ -0,0 +1,819 @@
+/*
+ *  Asynchronous private key operations on a pool of worker threads
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/*
+ * The start callbacks copy their input into a job and append it to the
+ * queue. A worker thread takes the first job in the queue together with the
+ * following jobs that use the same key, performs them, and appends them to
+ * the list of ready jobs. When that list becomes non-empty, the worker writes
+ * a byte to a pipe; the byte is read back when the list becomes empty again,
+ * so the read end of the pipe is readable exactly when there are ready jobs.
+ */
+
+#include "common.h"
+
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+
+#include "mbedtls/platform.h"
+
+#include "mbedtls/ssl_async_engine.h"
+#include "ssl_misc.h"
+#include "mbedtls/error.h"
+#include "mbedtls/platform_util.h"
+
+#if defined(MBEDTLS_RSA_C) && defined(MBEDTLS_PKCS1_V15) && \
+    !defined(MBEDTLS_RSA_ALT)
+#define SSL_ASYNC_ENGINE_RSA
+#include "mbedtls/rsa.h"
+#include "rsa_internal.h"
+#include "constant_time_internal.h"
+#include "mbedtls/constant_time.h"
+#endif
+
+#if defined(MBEDTLS_ECDSA_C)
+#include "mbedtls/ecdsa.h"
+#endif
+
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+typedef enum
+{
+    SSL_ASYNC_JOB_QUEUED,       /*!< In the queue                               */
+    SSL_ASYNC_JOB_RUNNING,      /*!< Taken by a worker                          */
+    SSL_ASYNC_JOB_READY,        /*!< In the list of ready jobs                  */
+    SSL_ASYNC_JOB_REPORTED,     /*!< Returned by next_completed()               */
+} ssl_async_job_state_t;
+
+typedef enum
+{
+    SSL_ASYNC_OP_SIGN,
+    SSL_ASYNC_OP_DECRYPT,
+} ssl_async_operation_t;
+
+struct mbedtls_ssl_async_job
+{
+    mbedtls_ssl_context *ssl;           /*!< Context that started the job       */
+    mbedtls_pk_context *pk;             /*!< Private key                        */
+    mbedtls_ssl_async_job *next;        /*!< Next job in the queue or list      */
+    ssl_async_job_state_t state;
+    ssl_async_operation_t op;
+    mbedtls_md_type_t md_alg;           /*!< Hash algorithm for signatures      */
+    int ret;                            /*!< Result of the operation            */
+    size_t input_len;
+    size_t output_len;
+    unsigned char input[MBEDTLS_PK_SIGNATURE_MAX_SIZE];
+    unsigned char output[MBEDTLS_PK_SIGNATURE_MAX_SIZE];
+};
+
+static void ssl_async_job_free( mbedtls_ssl_async_job *job )
+{
+    mbedtls_platform_zeroize( job, sizeof( *job ) );
+    mbedtls_free( job );
+}
+
+/*
+ * Whether the engine can perform an operation with a key. Opaque and
+ * RSA-alt keys, and RSA keys set up for PKCS#1 v2.1, are left to the
+ * handshake.
+ */
+static int ssl_async_engine_can_do( const mbedtls_pk_context *pk,
+                                    ssl_async_operation_t op )
+{
+    switch( mbedtls_pk_get_type( pk ) )
+    {
+#if defined(SSL_ASYNC_ENGINE_RSA)
+        case MBEDTLS_PK_RSA:
+            return( mbedtls_pk_rsa( *pk )->padding == MBEDTLS_RSA_PKCS_V15 &&
+                    mbedtls_pk_get_len( pk ) <= MBEDTLS_MPI_MAX_SIZE );
+#endif
+#if defined(MBEDTLS_ECDSA_C)
+        case MBEDTLS_PK_ECKEY:
+        case MBEDTLS_PK_ECDSA:
+            return( op == SSL_ASYNC_OP_SIGN );
+#endif
+        default:
+            (void) op;
+            return( 0 );
+    }
+}
+
+/*
+ * EC keys cache precomputed multiples of the generator in their group the
+ * first time they are used, which is not thread-safe: only one worker at a
+ * time may use a given EC key. RSA keys can be shared (see mbedtls_rsa_private()).
+ */
+static int ssl_async_key_is_exclusive( const mbedtls_pk_context *pk )
+{
+    return( mbedtls_pk_get_type( pk ) != MBEDTLS_PK_RSA );
+}
+
+static int ssl_async_engine_is_busy( const mbedtls_ssl_async_engine *engine,
+                                     const mbedtls_pk_context *pk )
+{
+    size_t i;
+
+    for( i = 0; i < engine->thread_count; i++ )
+    {
+        if( engine->busy[i] == pk )
+            return( 1 );
+    }
+
+    return( 0 );
+}
+
+/*
+ * Lock and unlock an engine. The workers and the cancel callback wait on
+ * condition variables, which must be paired with a pthread mutex, so the
+ * engine owns a plain pthread mutex rather than an mbedtls mutex.
+ */
+static int ssl_async_engine_lock( mbedtls_ssl_async_engine *engine )
+{
+    if( pthread_mutex_lock( &engine->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+    return( 0 );
+}
+
+static int ssl_async_engine_unlock( mbedtls_ssl_async_engine *engine )
+{
+    if( pthread_mutex_unlock( &engine->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+    return( 0 );
+}
+
+/* Called with the lock held */
+static void ssl_async_engine_notify( mbedtls_ssl_async_engine *engine )
+{
+    ssize_t written = write( engine->fd[1], "", 1 );
+    (void) written;
+}
+
+/* Called with the lock held */
+static void ssl_async_engine_drain( mbedtls_ssl_async_engine *engine )
+{
+    unsigned char buf[16];
+
+    while( read( engine->fd[0], buf, sizeof( buf ) ) > 0 )
+        continue;
+}
+
+/* Remove a job from a list. Called with the lock held. */
+static void ssl_async_list_remove( mbedtls_ssl_async_job **head,
+                                   mbedtls_ssl_async_job ***tail,
+                                   mbedtls_ssl_async_job *job )
+{
+    mbedtls_ssl_async_job **p = head;
+
+    while( *p != job )
+        p = &( *p )->next;
+
+    *p = job->next;
+    if( *p == NULL )
+        *tail = p;
+    job->next = NULL;
+}
+
+/* Called with the lock held */
+static void ssl_async_engine_remove_ready( mbedtls_ssl_async_engine *engine,
+                                          mbedtls_ssl_async_job *job )
+{
+    ssl_async_list_remove( &engine->ready, &engine->ready_tail, job );
+    if( engine->ready == NULL )
+        ssl_async_engine_drain( engine );
+}
+
+/*
+ * Take the first job in the queue whose key is available, and the jobs
+ * queued after it with the same key. Called with the lock held.
+ *
+ * An RSA key can be used by several workers at once, so leave some of its
+ * jobs to the other workers rather than taking a full batch. An EC key can
+ * only be used by one worker, so take as many of its jobs as possible, and
+ * reserve the key in a free slot of engine->busy: there are as many slots
+ * as workers, so there is always a free one.
+ */
+static size_t ssl_async_engine_take( mbedtls_ssl_async_engine *engine,
+                                     mbedtls_ssl_async_job **batch,
+                                     size_t *slot )
+{
+    mbedtls_ssl_async_job **p = &engine->queue;
+    mbedtls_ssl_async_job *job;
+    const mbedtls_pk_context *pk = NULL;
+    size_t count = 0, max = MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH;
+    size_t i;
+
+    *slot = engine->thread_count;
+
+    while( *p != NULL && count < max )
+    {
+        job = *p;
+
+        if( pk == NULL )
+        {
+            if( ssl_async_key_is_exclusive( job->pk ) &&
+                ssl_async_engine_is_busy( engine, job->pk ) )
+            {
+                p = &job->next;
+                continue;
+            }
+
+            pk = job->pk;
+            if( ! ssl_async_key_is_exclusive( pk ) )
+            {
+                max = engine->queued / engine->thread_count;
+                if( max > MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH )
+                    max = MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH;
+                if( max == 0 )
+                    max = 1;
+            }
+        }
+        else if( job->pk != pk )
+        {
+            p = &job->next;
+            continue;
+        }
+
+        *p = job->next;
+        if( *p == NULL )
+            engine->queue_tail = p;
+        job->next = NULL;
+        job->state = SSL_ASYNC_JOB_RUNNING;
+        batch[count++] = job;
+    }
+
+    engine->queued -= count;
+
+    if( count > 0 && ssl_async_key_is_exclusive( pk ) )
+    {
+        for( i = 0; engine->busy[i] != NULL; i++ )
+            continue;
+        engine->busy[i] = pk;
+        *slot = i;
+    }
+
+    return( count );
+}
+
+#if defined(SSL_ASYNC_ENGINE_RSA)
+/*
+ * Check that an input is smaller than the modulus, and fail with the same
+ * error as mbedtls_rsa_private() otherwise: such an input would fail the
+ * whole batch that it is part of.
+ */
+static int ssl_async_rsa_check_input( const mbedtls_rsa_context *rsa,
+                                      const unsigned char *input,
+                                      size_t len )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi T;
+
+    mbedtls_mpi_init( &T );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &T, input, len ) );
+    if( mbedtls_mpi_cmp_mpi( &T, &rsa->N ) >= 0 )
+    {
+        ret = MBEDTLS_ERROR_ADD( MBEDTLS_ERR_RSA_PRIVATE_FAILED,
+                                 MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+    }
+
+cleanup:
+    mbedtls_mpi_free( &T );
+
+    return( ret );
+}
+
+/*
+ * Perform the private key operations of a batch of jobs with the same RSA
+ * key together. Signatures are encoded first and checked afterwards, as in
+ * mbedtls_rsa_rsassa_pkcs1_v15_sign(). Decryptions are left padded; see
+ * ssl_async_job_output().
+ */
+static void ssl_async_engine_run_rsa( mbedtls_ssl_async_engine *engine,
+                                      mbedtls_ssl_async_job **batch,
+                                      size_t count )
+{
+    mbedtls_rsa_context *rsa = mbedtls_pk_rsa( *batch[0]->pk );
+    const unsigned char *input[MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH];
+    unsigned char *output[MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH];
+    unsigned char verif[MBEDTLS_MPI_MAX_SIZE];
+    mbedtls_ssl_async_job *job;
+    size_t len = mbedtls_rsa_get_len( rsa );
+    size_t i, n = 0;
+    int ret;
+
+    for( i = 0; i < count; i++ )
+    {
+        job = batch[i];
+        job->ret = 0;
+
+        if( job->op == SSL_ASYNC_OP_SIGN )
+        {
+            /* Replace the hash by the encoded message, which the signature
+             * is checked against below. */
+            job->ret = mbedtls_rsa_rsassa_pkcs1_v15_encode( job->md_alg,
+                                                (unsigned int) job->input_len,
+                                                job->input, len, job->output );
+            if( job->ret != 0 )
+                continue;
+            memcpy( job->input, job->output, len );
+            job->input_len = len;
+        }
+        else if( job->input_len != len )
+        {
+            job->ret = MBEDTLS_ERR_RSA_BAD_INPUT_DATA;
+            continue;
+        }
+
+        job->ret = ssl_async_rsa_check_input( rsa, job->input, len );
+        if( job->ret != 0 )
+            continue;
+
+        input[n] = job->input;
+        output[n] = job->output;
+        n++;
+    }
+
+    ret = mbedtls_rsa_private_batch( rsa, engine->f_rng, engine->p_rng,
+                                     input, output, n );
+
+    for( i = 0; i < count; i++ )
+    {
+        job = batch[i];
+        if( job->ret != 0 )
+            continue;
+
+        job->ret = ret;
+        job->output_len = len;
+
+        if( job->ret == 0 && job->op == SSL_ASYNC_OP_SIGN )
+        {
+            /* Prevent Lenstra's attack */
+            job->ret = mbedtls_rsa_public( rsa, job->output, verif );
+            if( job->ret == 0 &&
+                mbedtls_ct_memcmp( verif, job->input, len ) != 0 )
+            {
+                job->ret = MBEDTLS_ERR_RSA_PRIVATE_FAILED;
+            }
+        }
+    }
+
+    mbedtls_platform_zeroize( verif, sizeof( verif ) );
+}
+#endif /* SSL_ASYNC_ENGINE_RSA */
+
+static void ssl_async_engine_run( mbedtls_ssl_async_engine *engine,
+                                  mbedtls_ssl_async_job **batch,
+                                  size_t count )
+{
+#if defined(MBEDTLS_ECDSA_C)
+    mbedtls_ssl_async_job *job;
+    size_t i;
+#endif
+
+#if defined(SSL_ASYNC_ENGINE_RSA)
+    if( mbedtls_pk_get_type( batch[0]->pk ) == MBEDTLS_PK_RSA )
+    {
+        ssl_async_engine_run_rsa( engine, batch, count );
+        return;
+    }
+#endif
+
+#if defined(MBEDTLS_ECDSA_C)
+    for( i = 0; i < count; i++ )
+    {
+        job = batch[i];
+        job->ret = mbedtls_ecdsa_write_signature( mbedtls_pk_ec( *job->pk ),
+                                                  job->md_alg,
+                                                  job->input, job->input_len,
+                                                  job->output,
+                                                  sizeof( job->output ),
+                                                  &job->output_len,
+                                                  engine->f_rng,
+                                                  engine->p_rng );
+    }
+#else
+    (void) engine;
+    (void) batch;
+    (void) count;
+#endif
+}
+
+static void *ssl_async_engine_worker( void *arg )
+{
+    mbedtls_ssl_async_engine *engine = arg;
+    pthread_mutex_t *mutex = &engine->mutex;
+    mbedtls_ssl_async_job *batch[MBEDTLS_SSL_ASYNC_ENGINE_MAX_BATCH];
+    size_t count, slot, i;
+
+    pthread_mutex_lock( mutex );
+    while( ! engine->stop )
+    {
+        count = ssl_async_engine_take( engine, batch, &slot );
+        if( count == 0 )
+        {
+            pthread_cond_wait( &engine->work, mutex );
+            continue;
+        }
+        pthread_mutex_unlock( mutex );
+
+        ssl_async_engine_run( engine, batch, count );
+
+        pthread_mutex_lock( mutex );
+        for( i = 0; i < count; i++ )
+        {
+            batch[i]->state = SSL_ASYNC_JOB_READY;
+            *engine->ready_tail = batch[i];
+            engine->ready_tail = &batch[i]->next;
+            if( engine->ready == batch[i] )
+                ssl_async_engine_notify( engine );
+        }
+        /* Wake up mbedtls_ssl_async_engine_cancel() if it is waiting for
+         * one of these jobs */
+        pthread_cond_broadcast( &engine->done );
+
+        /* Other workers may be waiting for this key */
+        if( slot < engine->thread_count )
+        {
+            engine->busy[slot] = NULL;
+            pthread_cond_broadcast( &engine->work );
+        }
+    }
+    pthread_mutex_unlock( mutex );
+
+    return( NULL );
+}
+
+void mbedtls_ssl_async_engine_init( mbedtls_ssl_async_engine *engine )
+{
+    memset( engine, 0, sizeof( mbedtls_ssl_async_engine ) );
+
+    engine->queue_tail = &engine->queue;
+    engine->ready_tail = &engine->ready;
+    engine->fd[0] = -1;
+    engine->fd[1] = -1;
+
+    (void) pthread_mutex_init( &engine->mutex, NULL );
+}
+
+/*
+ * Stop the workers and release everything but the mutex, leaving the engine
+ * as mbedtls_ssl_async_engine_init() does.
+ */
+static void ssl_async_engine_teardown( mbedtls_ssl_async_engine *engine )
+{
+    mbedtls_ssl_async_job *job;
+    size_t i;
+
+    if( engine->threads != NULL )
+    {
+        pthread_mutex_lock( &engine->mutex );
+        engine->stop = 1;
+        pthread_cond_broadcast( &engine->work );
+        pthread_mutex_unlock( &engine->mutex );
+
+        for( i = 0; i < engine->thread_count; i++ )
+            (void) pthread_join( engine->threads[i], NULL );
+
+        pthread_cond_destroy( &engine->work );
+        pthread_cond_destroy( &engine->done );
+        mbedtls_free( engine->threads );
+        engine->threads = NULL;
+    }
+    engine->thread_count = 0;
+    engine->stop = 0;
+
+    mbedtls_free( engine->busy );
+    engine->busy = NULL;
+
+    while( ( job = engine->queue ) != NULL )
+    {
+        engine->queue = job->next;
+        ssl_async_job_free( job );
+    }
+    engine->queue_tail = &engine->queue;
+    engine->queued = 0;
+
+    while( ( job = engine->ready ) != NULL )
+    {
+        engine->ready = job->next;
+        ssl_async_job_free( job );
+    }
+    engine->ready_tail = &engine->ready;
+
+    for( i = 0; i < 2; i++ )
+    {
+        if( engine->fd[i] >= 0 )
+            close( engine->fd[i] );
+        engine->fd[i] = -1;
+    }
+}
+
+int mbedtls_ssl_async_engine_setup( mbedtls_ssl_async_engine *engine,
+                                    size_t threads,
+                                    int (*f_rng)(void *, unsigned char *, size_t),
+                                    void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    int fd[2];
+    size_t i;
+
+    if( threads == 0 || f_rng == NULL || engine->threads != NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    engine->f_rng = f_rng;
+    engine->p_rng = p_rng;
+
+    if( pipe( fd ) != 0 )
+        return( MBEDTLS_ERR_SSL_ALLOC_FAILED );
+    engine->fd[0] = fd[0];
+    engine->fd[1] = fd[1];
+
+    for( i = 0; i < 2; i++ )
+    {
+        if( fcntl( fd[i], F_SETFL, fcntl( fd[i], F_GETFL ) | O_NONBLOCK ) != 0 ||
+            fcntl( fd[i], F_SETFD, FD_CLOEXEC ) != 0 )
+        {
+            ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+            goto cleanup;
+        }
+    }
+
+    engine->busy = mbedtls_calloc( threads, sizeof( *engine->busy ) );
+    if( engine->busy == NULL )
+    {
+        ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    if( pthread_cond_init( &engine->work, NULL ) != 0 )
+    {
+        ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+        goto cleanup;
+    }
+    if( pthread_cond_init( &engine->done, NULL ) != 0 )
+    {
+        pthread_cond_destroy( &engine->work );
+        ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    /* From here on, the teardown destroys the condition variables and joins
+     * the first engine->thread_count threads. */
+    engine->threads = mbedtls_calloc( threads, sizeof( *engine->threads ) );
+    if( engine->threads == NULL )
+    {
+        pthread_cond_destroy( &engine->work );
+        pthread_cond_destroy( &engine->done );
+        ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    /* The workers read engine->thread_count with the lock held */
+    ret = 0;
+    pthread_mutex_lock( &engine->mutex );
+    for( i = 0; i < threads; i++ )
+    {
+        if( pthread_create( &engine->threads[i], NULL,
+                            ssl_async_engine_worker, engine ) != 0 )
+        {
+            ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+            break;
+        }
+        engine->thread_count++;
+    }
+    pthread_mutex_unlock( &engine->mutex );
+
+cleanup:
+    if( ret != 0 )
+        ssl_async_engine_teardown( engine );
+
+    return( ret );
+}
+
+static int ssl_async_engine_start( mbedtls_ssl_context *ssl,
+                                   mbedtls_x509_crt *cert,
+                                   ssl_async_operation_t op,
+                                   mbedtls_md_type_t md_alg,
+                                   const unsigned char *input,
+                                   size_t input_len )
+{
+    mbedtls_ssl_async_engine *engine =
+        mbedtls_ssl_conf_get_async_config_data( ssl->conf );
+    mbedtls_pk_context *pk = mbedtls_ssl_own_key( ssl );
+    mbedtls_ssl_async_job *job;
+
+    /* The private key is the one that the handshake selected along with
+     * cert, so there is no need to match cert against a list of keys. */
+    if( engine == NULL || engine->threads == NULL ||
+        cert != mbedtls_ssl_own_cert( ssl ) || pk == NULL ||
+        ! ssl_async_engine_can_do( pk, op ) ||
+        input_len > sizeof( job->input ) )
+    {
+        return( MBEDTLS_ERR_SSL_HW_ACCEL_FALLTHROUGH );
+    }
+
+    job = mbedtls_calloc( 1, sizeof( *job ) );
+    if( job == NULL )
+        return( MBEDTLS_ERR_SSL_ALLOC_FAILED );
+
+    job->ssl = ssl;
+    job->pk = pk;
+    job->state = SSL_ASYNC_JOB_QUEUED;
+    job->op = op;
+    job->md_alg = md_alg;
+    memcpy( job->input, input, input_len );
+    job->input_len = input_len;
+
+    if( ssl_async_engine_lock( engine ) != 0 )
+    {
+        ssl_async_job_free( job );
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+    }
+
+    *engine->queue_tail = job;
+    engine->queue_tail = &job->next;
+    engine->queued++;
+    pthread_cond_signal( &engine->work );
+
+    mbedtls_ssl_set_async_operation_data( ssl, job );
+
+    if( ssl_async_engine_unlock( engine ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    return( MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS );
+}
+
+int mbedtls_ssl_async_engine_sign( mbedtls_ssl_context *ssl,
+                                   mbedtls_x509_crt *cert,
+                                   mbedtls_md_type_t md_alg,
+                                   const unsigned char *hash,
+                                   size_t hash_len )
+{
+    return( ssl_async_engine_start( ssl, cert, SSL_ASYNC_OP_SIGN,
+                                    md_alg, hash, hash_len ) );
+}
+
+int mbedtls_ssl_async_engine_decrypt( mbedtls_ssl_context *ssl,
+                                      mbedtls_x509_crt *cert,
+                                      const unsigned char *input,
+                                      size_t input_len )
+{
+    return( ssl_async_engine_start( ssl, cert, SSL_ASYNC_OP_DECRYPT,
+                                    MBEDTLS_MD_NONE, input, input_len ) );
+}
+
+/*
+ * Copy the result of a completed job. The padding of decrypted messages is
+ * only removed here, in constant time, as in mbedtls_rsa_pkcs1_decrypt().
+ */
+static int ssl_async_job_output( mbedtls_ssl_async_job *job,
+                                 unsigned char *output,
+                                 size_t *output_len,
+                                 size_t output_size )
+{
+#if defined(SSL_ASYNC_ENGINE_RSA)
+    if( job->op == SSL_ASYNC_OP_DECRYPT )
+    {
+        return( mbedtls_ct_rsaes_pkcs1_v15_unpadding( job->output,
+                                                      job->output_len,
+                                                      output, output_size,
+                                                      output_len ) );
+    }
+#endif /* SSL_ASYNC_ENGINE_RSA */
+
+    if( job->output_len > output_size )
+        return( MBEDTLS_ERR_PK_BUFFER_TOO_SMALL );
+
+    memcpy( output, job->output, job->output_len );
+    *output_len = job->output_len;
+
+    return( 0 );
+}
+
+int mbedtls_ssl_async_engine_resume( mbedtls_ssl_context *ssl,
+                                     unsigned char *output,
+                                     size_t *output_len,
+                                     size_t output_size )
+{
+    mbedtls_ssl_async_engine *engine =
+        mbedtls_ssl_conf_get_async_config_data( ssl->conf );
+    mbedtls_ssl_async_job *job = mbedtls_ssl_get_async_operation_data( ssl );
+    int ret;
+
+    if( ssl_async_engine_lock( engine ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    if( job->state != SSL_ASYNC_JOB_READY &&
+        job->state != SSL_ASYNC_JOB_REPORTED )
+    {
+        if( ssl_async_engine_unlock( engine ) != 0 )
+            return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+        return( MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS );
+    }
+
+    if( job->state == SSL_ASYNC_JOB_READY )
+        ssl_async_engine_remove_ready( engine, job );
+
+    if( ssl_async_engine_unlock( engine ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    ret = job->ret;
+    if( ret == 0 )
+        ret = ssl_async_job_output( job, output, output_len, output_size );
+
+    ssl_async_job_free( job );
+
+    return( ret );
+}
+
+void mbedtls_ssl_async_engine_cancel( mbedtls_ssl_context *ssl )
+{
+    mbedtls_ssl_async_engine *engine =
+        mbedtls_ssl_conf_get_async_config_data( ssl->conf );
+    mbedtls_ssl_async_job *job = mbedtls_ssl_get_async_operation_data( ssl );
+
+    if( job == NULL || ssl_async_engine_lock( engine ) != 0 )
+        return;
+
+    switch( job->state )
+    {
+        case SSL_ASYNC_JOB_QUEUED:
+            ssl_async_list_remove( &engine->queue, &engine->queue_tail, job );
+            engine->queued--;
+            break;
+        case SSL_ASYNC_JOB_RUNNING:
+            /* The worker is using the private key, which the caller may
+             * free as soon as we return. Wait until the worker is done. */
+            while( job->state == SSL_ASYNC_JOB_RUNNING )
+                pthread_cond_wait( &engine->done, &engine->mutex );
+            ssl_async_engine_remove_ready( engine, job );
+            break;
+        case SSL_ASYNC_JOB_READY:
+            ssl_async_engine_remove_ready( engine, job );
+            break;
+        default:
+            break;
+    }
+
+    (void) ssl_async_engine_unlock( engine );
+
+    if( job != NULL )
+        ssl_async_job_free( job );
+}
+
+int mbedtls_ssl_async_engine_get_fd( const mbedtls_ssl_async_engine *engine )
+{
+    return( engine->fd[0] );
+}
+
+mbedtls_ssl_context *mbedtls_ssl_async_engine_next_completed(
+                                        mbedtls_ssl_async_engine *engine )
+{
+    mbedtls_ssl_async_job *job;
+    mbedtls_ssl_context *ssl = NULL;
+
+    if( ssl_async_engine_lock( engine ) != 0 )
+        return( NULL );
+
+    job = engine->ready;
+    if( job != NULL )
+    {
+        ssl_async_engine_remove_ready( engine, job );
+        job->state = SSL_ASYNC_JOB_REPORTED;
+        ssl = job->ssl;
+    }
+
+    (void) ssl_async_engine_unlock( engine );
+
+    return( ssl );
+}
+
+void mbedtls_ssl_async_engine_free( mbedtls_ssl_async_engine *engine )
+{
+    if( engine == NULL )
+        return;
+
+    ssl_async_engine_teardown( engine );
+    (void) pthread_mutex_destroy( &engine->mutex );
+
+    mbedtls_platform_zeroize( engine, sizeof( mbedtls_ssl_async_engine ) );
+}
+
+#endif /* MBEDTLS_SSL_ASYNC_ENGINE_C */
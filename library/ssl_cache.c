@@ -19,6 +19,12 @@
 /*
  * These session callbacks use a simple chained list
  * to store and retrieve the session information.
+ *
+ * With MBEDTLS_SSL_CACHE_INDEXED, the entries are instead split into
+ * shards by a hash of the session ID. Each shard has its own hash table,
+ * its own list of entries sorted by age and its own mutex. The number of
+ * entries and the insertion counter are global, under the cache mutex,
+ * which is only ever taken last.
  */
 
 #include "common.h"
@@ -34,6 +40,10 @@
 
 void mbedtls_ssl_cache_init( mbedtls_ssl_cache_context *cache )
 {
+#if defined(MBEDTLS_THREADING_C) && defined(MBEDTLS_SSL_CACHE_INDEXED)
+    int i;
+#endif
+
     memset( cache, 0, sizeof( mbedtls_ssl_cache_context ) );
 
     cache->timeout = MBEDTLS_SSL_CACHE_DEFAULT_TIMEOUT;
@@ -41,9 +51,511 @@ void mbedtls_ssl_cache_init( mbedtls_ssl_cache_context *cache )
 
 #if defined(MBEDTLS_THREADING_C)
     mbedtls_mutex_init( &cache->mutex );
+#if defined(MBEDTLS_SSL_CACHE_INDEXED)
+    for( i = 0; i < MBEDTLS_SSL_CACHE_SHARDS; i++ )
+        mbedtls_mutex_init( &cache->shards[i].mutex );
 #endif
+#endif
+}
+
+#if defined(MBEDTLS_SSL_CACHE_INDEXED)
+
+/* Bounds on the size (log2) of the hash table of a shard. The table is
+ * grown on demand so that it has at least as many buckets as entries. */
+#define SSL_CACHE_MIN_BUCKET_BITS   4
+#define SSL_CACHE_MAX_BUCKET_BITS  24
+
+/*
+ * 32-bit FNV-1a hash of a session ID.
+ */
+static uint32_t ssl_cache_hash( unsigned char const *session_id,
+                                size_t session_id_len )
+{
+    uint32_t hash = 0x811C9DC5;
+    size_t i;
+
+    for( i = 0; i < session_id_len; i++ )
+    {
+        hash ^= session_id[i];
+        hash *= 0x01000193;
+    }
+
+    return( hash );
+}
+
+/*
+ * Select the shard in charge of a given hash. The mapping only depends on
+ * MBEDTLS_SSL_CACHE_SHARDS, so that changing max_entries never moves an
+ * entry to another shard.
+ */
+static mbedtls_ssl_cache_shard *ssl_cache_get_shard(
+                                    mbedtls_ssl_cache_context *cache,
+                                    uint32_t hash )
+{
+    return( &cache->shards[hash % MBEDTLS_SSL_CACHE_SHARDS] );
+}
+
+/*
+ * Add delta to the number of entries in the cache and, if seq is not NULL,
+ * take the next insertion number.
+ */
+static int ssl_cache_update_count( mbedtls_ssl_cache_context *cache,
+                                   int delta, uint64_t *seq )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &cache->mutex ) != 0 )
+        return( 1 );
+#endif
+
+    cache->count += delta;
+    if( seq != NULL )
+        *seq = cache->seq++;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &cache->mutex ) != 0 )
+        return( 1 );
+#endif
+
+    return( 0 );
+}
+
+/*
+ * Return the head of the hash bucket chain for a given hash. The bucket is
+ * taken from the top bits of a multiplicative hash so that it is independent
+ * of the shard index, which is derived from the low bits.
+ */
+static mbedtls_ssl_cache_entry **ssl_cache_bucket( mbedtls_ssl_cache_shard *shard,
+                                                   uint32_t hash )
+{
+    uint32_t mixed = (uint32_t) ( hash * 0x9E3779B1u );
+
+    return( &shard->buckets[mixed >> ( 32 - shard->bucket_bits )] );
+}
+
+static mbedtls_ssl_cache_entry *ssl_cache_find_entry( mbedtls_ssl_cache_shard *shard,
+                                                      unsigned char const *session_id,
+                                                      size_t session_id_len,
+                                                      uint32_t hash )
+{
+    mbedtls_ssl_cache_entry *cur;
+
+    if( shard->buckets == NULL )
+        return( NULL );
+
+    for( cur = *ssl_cache_bucket( shard, hash ); cur != NULL;
+         cur = cur->bucket_next )
+    {
+        if( cur->hash == hash &&
+            session_id_len == cur->session_id_len &&
+            memcmp( session_id, cur->session_id, cur->session_id_len ) == 0 )
+        {
+            return( cur );
+        }
+    }
+
+    return( NULL );
+}
+
+/*
+ * Insert an entry in the hash table and at the end of the age list.
+ * The hash table must have been allocated already.
+ */
+static void ssl_cache_link( mbedtls_ssl_cache_shard *shard,
+                            mbedtls_ssl_cache_entry *entry )
+{
+    mbedtls_ssl_cache_entry **bucket = ssl_cache_bucket( shard, entry->hash );
+
+    entry->bucket_next = *bucket;
+    *bucket = entry;
+
+    entry->next = NULL;
+    entry->prev = shard->newest;
+    if( shard->newest != NULL )
+        shard->newest->next = entry;
+    else
+        shard->oldest = entry;
+    shard->newest = entry;
+
+    shard->count++;
+}
+
+/*
+ * Remove an entry from the hash table and from the age list.
+ */
+static void ssl_cache_unlink( mbedtls_ssl_cache_shard *shard,
+                              mbedtls_ssl_cache_entry *entry )
+{
+    mbedtls_ssl_cache_entry **link = ssl_cache_bucket( shard, entry->hash );
+
+    while( *link != entry )
+        link = &( *link )->bucket_next;
+    *link = entry->bucket_next;
+    entry->bucket_next = NULL;
+
+    if( entry->prev != NULL )
+        entry->prev->next = entry->next;
+    else
+        shard->oldest = entry->next;
+
+    if( entry->next != NULL )
+        entry->next->prev = entry->prev;
+    else
+        shard->newest = entry->prev;
+
+    entry->next = NULL;
+    entry->prev = NULL;
+
+    shard->count--;
 }
 
+static void ssl_cache_entry_free( mbedtls_ssl_cache_entry *entry )
+{
+    mbedtls_free( entry->session );
+    mbedtls_free( entry );
+}
+
+#if defined(MBEDTLS_HAVE_TIME)
+static int ssl_cache_entry_expired( const mbedtls_ssl_cache_context *cache,
+                                    const mbedtls_ssl_cache_entry *entry,
+                                    mbedtls_time_t t )
+{
+    return( cache->timeout != 0 &&
+            (int) ( t - entry->timestamp ) > cache->timeout );
+}
+
+/*
+ * Drop all outdated entries of a shard. They are at the beginning of the
+ * age list. Return the number of entries dropped.
+ */
+static int ssl_cache_expire( mbedtls_ssl_cache_context *cache,
+                             mbedtls_ssl_cache_shard *shard,
+                             mbedtls_time_t t )
+{
+    mbedtls_ssl_cache_entry *cur;
+    int removed = 0;
+
+    while( ( cur = shard->oldest ) != NULL &&
+           ssl_cache_entry_expired( cache, cur, t ) )
+    {
+        ssl_cache_unlink( shard, cur );
+        ssl_cache_entry_free( cur );
+        removed++;
+    }
+
+    return( removed );
+}
+#endif /* MBEDTLS_HAVE_TIME */
+
+/*
+ * Make sure that the hash table of a shard has room for one more entry,
+ * doubling its size if needed. If the table can't be grown, keep using the
+ * existing one with longer chains.
+ */
+MBEDTLS_CHECK_RETURN_CRITICAL
+static int ssl_cache_reserve( mbedtls_ssl_cache_shard *shard )
+{
+    mbedtls_ssl_cache_entry **old_buckets = shard->buckets;
+    size_t old_size, i;
+    unsigned bits;
+    mbedtls_ssl_cache_entry *cur, *next;
+
+    if( old_buckets == NULL )
+        bits = SSL_CACHE_MIN_BUCKET_BITS;
+    else if( (size_t) shard->count < ( (size_t) 1 << shard->bucket_bits ) ||
+             shard->bucket_bits >= SSL_CACHE_MAX_BUCKET_BITS )
+        return( 0 );
+    else
+        bits = shard->bucket_bits + 1;
+
+    shard->buckets = mbedtls_calloc( (size_t) 1 << bits,
+                                     sizeof( mbedtls_ssl_cache_entry * ) );
+    if( shard->buckets == NULL )
+    {
+        shard->buckets = old_buckets;
+        return( old_buckets == NULL ? 1 : 0 );
+    }
+
+    old_size = old_buckets == NULL ? 0 : (size_t) 1 << shard->bucket_bits;
+    shard->bucket_bits = bits;
+
+    for( i = 0; i < old_size; i++ )
+    {
+        for( cur = old_buckets[i]; cur != NULL; cur = next )
+        {
+            mbedtls_ssl_cache_entry **bucket = ssl_cache_bucket( shard, cur->hash );
+
+            next = cur->bucket_next;
+            cur->bucket_next = *bucket;
+            *bucket = cur;
+        }
+    }
+
+    mbedtls_free( old_buckets );
+
+    return( 0 );
+}
+
+/*
+ * Evict the oldest entries of the whole cache until it holds no more than
+ * max_entries entries.
+ *
+ * The oldest entry of each shard is at the head of its age list, so the
+ * oldest entry of the cache is the one with the smallest insertion number
+ * among these heads. The shards are locked one at a time, never while
+ * holding another shard's lock. Concurrent insertions may make the entry
+ * evicted slightly younger than the true oldest one, but the number of
+ * entries is always brought back to max_entries.
+ */
+MBEDTLS_CHECK_RETURN_CRITICAL
+static int ssl_cache_evict( mbedtls_ssl_cache_context *cache )
+{
+    mbedtls_ssl_cache_shard *shard, *victim;
+    mbedtls_ssl_cache_entry *cur;
+    uint64_t oldest = 0;
+    int count, i;
+
+    for( ;; )
+    {
+#if defined(MBEDTLS_THREADING_C)
+        if( mbedtls_mutex_lock( &cache->mutex ) != 0 )
+            return( 1 );
+#endif
+        count = cache->count;
+#if defined(MBEDTLS_THREADING_C)
+        if( mbedtls_mutex_unlock( &cache->mutex ) != 0 )
+            return( 1 );
+#endif
+
+        if( count <= cache->max_entries )
+            return( 0 );
+
+        victim = NULL;
+        for( i = 0; i < MBEDTLS_SSL_CACHE_SHARDS; i++ )
+        {
+            shard = &cache->shards[i];
+
+#if defined(MBEDTLS_THREADING_C)
+            if( mbedtls_mutex_lock( &shard->mutex ) != 0 )
+                return( 1 );
+#endif
+            if( shard->oldest != NULL &&
+                ( victim == NULL || shard->oldest->seq < oldest ) )
+            {
+                victim = shard;
+                oldest = shard->oldest->seq;
+            }
+#if defined(MBEDTLS_THREADING_C)
+            if( mbedtls_mutex_unlock( &shard->mutex ) != 0 )
+                return( 1 );
+#endif
+        }
+
+        if( victim == NULL )
+            return( 0 );
+
+#if defined(MBEDTLS_THREADING_C)
+        if( mbedtls_mutex_lock( &victim->mutex ) != 0 )
+            return( 1 );
+#endif
+        /* Another thread may have emptied the shard in the meantime. */
+        cur = victim->oldest;
+        if( cur != NULL )
+        {
+            ssl_cache_unlink( victim, cur );
+            ssl_cache_entry_free( cur );
+        }
+#if defined(MBEDTLS_THREADING_C)
+        if( mbedtls_mutex_unlock( &victim->mutex ) != 0 )
+            return( 1 );
+#endif
+
+        if( cur != NULL && ssl_cache_update_count( cache, -1, NULL ) != 0 )
+            return( 1 );
+    }
+}
+
+int mbedtls_ssl_cache_get( void *data,
+                           unsigned char const *session_id,
+                           size_t session_id_len,
+                           mbedtls_ssl_session *session )
+{
+    int ret = 1;
+    mbedtls_ssl_cache_context *cache = (mbedtls_ssl_cache_context *) data;
+    uint32_t hash = ssl_cache_hash( session_id, session_id_len );
+    mbedtls_ssl_cache_shard *shard = ssl_cache_get_shard( cache, hash );
+    mbedtls_ssl_cache_entry *entry;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &shard->mutex ) != 0 )
+        return( 1 );
+#endif
+
+    entry = ssl_cache_find_entry( shard, session_id, session_id_len, hash );
+    if( entry == NULL )
+        goto exit;
+
+#if defined(MBEDTLS_HAVE_TIME)
+    if( ssl_cache_entry_expired( cache, entry, mbedtls_time( NULL ) ) )
+    {
+        ssl_cache_unlink( shard, entry );
+        ssl_cache_entry_free( entry );
+        (void) ssl_cache_update_count( cache, -1, NULL );
+        goto exit;
+    }
+#endif
+
+    ret = mbedtls_ssl_session_load( session,
+                                    entry->session,
+                                    entry->session_len );
+    if( ret != 0 )
+        goto exit;
+
+    ret = 0;
+
+exit:
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &shard->mutex ) != 0 )
+        ret = 1;
+#endif
+
+    return( ret );
+}
+
+int mbedtls_ssl_cache_set( void *data,
+                           unsigned char const *session_id,
+                           size_t session_id_len,
+                           const mbedtls_ssl_session *session )
+{
+    int ret = 1;
+    mbedtls_ssl_cache_context *cache = (mbedtls_ssl_cache_context *) data;
+    uint32_t hash;
+    uint64_t seq;
+    mbedtls_ssl_cache_shard *shard;
+    mbedtls_ssl_cache_entry *cur;
+    int added = 0;
+#if defined(MBEDTLS_HAVE_TIME)
+    int removed;
+#endif
+
+    size_t session_serialized_len;
+    unsigned char *session_serialized = NULL;
+
+    if( session_id_len > sizeof( cur->session_id ) )
+        return( 1 );
+
+    /* This should only happen on an ill-configured cache
+     * with max_entries == 0. */
+    if( cache->max_entries <= 0 )
+        return( 1 );
+
+    /* Serialize the session before taking the lock, so that the critical
+     * section only covers the update of the shard. */
+    ret = mbedtls_ssl_session_save( session, NULL, 0, &session_serialized_len );
+    if( ret != MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL )
+        return( 1 );
+
+    session_serialized = mbedtls_calloc( 1, session_serialized_len );
+    if( session_serialized == NULL )
+        return( MBEDTLS_ERR_SSL_ALLOC_FAILED );
+
+    ret = mbedtls_ssl_session_save( session,
+                                    session_serialized,
+                                    session_serialized_len,
+                                    &session_serialized_len );
+    if( ret != 0 )
+        goto cleanup;
+
+    hash = ssl_cache_hash( session_id, session_id_len );
+    shard = ssl_cache_get_shard( cache, hash );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = mbedtls_mutex_lock( &shard->mutex ) ) != 0 )
+        goto cleanup;
+#endif
+
+#if defined(MBEDTLS_HAVE_TIME)
+    removed = ssl_cache_expire( cache, shard, mbedtls_time( NULL ) );
+    if( removed != 0 &&
+        ssl_cache_update_count( cache, -removed, NULL ) != 0 )
+    {
+        ret = 1;
+        goto exit;
+    }
+#endif
+
+    /* Pick the entry to write: an existing entry with the given session ID,
+     * or else a new entry. If the cache is full, the oldest entry is evicted
+     * once the shard is unlocked. */
+    cur = ssl_cache_find_entry( shard, session_id, session_id_len, hash );
+    if( cur == NULL )
+    {
+        ret = ssl_cache_reserve( shard );
+        if( ret != 0 )
+            goto exit;
+
+        cur = mbedtls_calloc( 1, sizeof( mbedtls_ssl_cache_entry ) );
+        if( cur == NULL )
+        {
+            ret = 1;
+            goto exit;
+        }
+        added = 1;
+    }
+
+    if( ssl_cache_update_count( cache, added, &seq ) != 0 )
+    {
+        if( added )
+            mbedtls_free( cur );
+        added = 0;
+        ret = 1;
+        goto exit;
+    }
+
+    if( ! added )
+        ssl_cache_unlink( shard, cur );
+
+    /* If we're reusing an entry, free it first. */
+    mbedtls_free( cur->session );
+
+#if defined(MBEDTLS_HAVE_TIME)
+    cur->timestamp = mbedtls_time( NULL );
+#endif
+    cur->hash = hash;
+    cur->seq = seq;
+    cur->session_id_len = session_id_len;
+    memset( cur->session_id, 0, sizeof( cur->session_id ) );
+    memcpy( cur->session_id, session_id, session_id_len );
+
+    cur->session = session_serialized;
+    cur->session_len = session_serialized_len;
+    session_serialized = NULL;
+
+    ssl_cache_link( shard, cur );
+
+    ret = 0;
+
+exit:
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &shard->mutex ) != 0 )
+        ret = 1;
+#endif
+
+    if( added && ssl_cache_evict( cache ) != 0 )
+        ret = 1;
+
+cleanup:
+    if( session_serialized != NULL )
+    {
+        mbedtls_platform_zeroize( session_serialized, session_serialized_len );
+        mbedtls_free( session_serialized );
+        session_serialized = NULL;
+    }
+
+    return( ret );
+}
+
+#else /* MBEDTLS_SSL_CACHE_INDEXED */
+
 MBEDTLS_CHECK_RETURN_CRITICAL
 static int ssl_cache_find_entry( mbedtls_ssl_cache_context *cache,
                                  unsigned char const *session_id,
@@ -317,6 +829,8 @@ exit:
     return( ret );
 }
 
+#endif /* MBEDTLS_SSL_CACHE_INDEXED */
+
 #if defined(MBEDTLS_HAVE_TIME)
 void mbedtls_ssl_cache_set_timeout( mbedtls_ssl_cache_context *cache, int timeout )
 {
@@ -336,7 +850,42 @@ void mbedtls_ssl_cache_set_max_entries( mbedtls_ssl_cache_context *cache, int ma
 void mbedtls_ssl_cache_free( mbedtls_ssl_cache_context *cache )
 {
     mbedtls_ssl_cache_entry *cur, *prv;
+#if defined(MBEDTLS_SSL_CACHE_INDEXED)
+    int i;
+#endif
+
+#if defined(MBEDTLS_SSL_CACHE_INDEXED)
+    for( i = 0; i < MBEDTLS_SSL_CACHE_SHARDS; i++ )
+    {
+        mbedtls_ssl_cache_shard *shard = &cache->shards[i];
+
+        cur = shard->oldest;
+
+        while( cur != NULL )
+        {
+            prv = cur;
+            cur = cur->next;
+
+            ssl_cache_entry_free( prv );
+        }
+
+        mbedtls_free( shard->buckets );
 
+#if defined(MBEDTLS_THREADING_C)
+        mbedtls_mutex_free( &shard->mutex );
+#endif
+        shard->buckets = NULL;
+        shard->bucket_bits = 0;
+        shard->count = 0;
+        shard->oldest = NULL;
+        shard->newest = NULL;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &cache->mutex );
+#endif
+    cache->count = 0;
+#else /* MBEDTLS_SSL_CACHE_INDEXED */
     cur = cache->chain;
 
     while( cur != NULL )
@@ -352,6 +901,7 @@ void mbedtls_ssl_cache_free( mbedtls_ssl_cache_context *cache )
     mbedtls_mutex_free( &cache->mutex );
 #endif
     cache->chain = NULL;
+#endif /* MBEDTLS_SSL_CACHE_INDEXED */
 }
 
 #endif /* MBEDTLS_SSL_CACHE_C */
@@ -2377,6 +2377,18 @@ psa_status_t mbedtls_ssl_cipher_to_psa( mbedtls_cipher_type_t mbedtls_cipher_typ
 #endif /* MBEDTLS_USE_PSA_CRYPTO || MBEDTLS_SSL_PROTO_TLS1_3 */
 
 #if defined(MBEDTLS_DHM_C) && defined(MBEDTLS_SSL_SRV_C)
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+/*
+ * Precompute the table for the DHE generator. The table is only an
+ * optimization: if it cannot be set up, G^X is computed without it.
+ */
+static void ssl_conf_dh_fixed_base( mbedtls_ssl_config *conf )
+{
+    (void) mbedtls_dhm_fixed_base_setup( &conf->dhm_fixed_base,
+                                         &conf->dhm_P, &conf->dhm_G );
+}
+#endif /* MBEDTLS_DHM_FIXED_BASE */
+
 int mbedtls_ssl_conf_dh_param_bin( mbedtls_ssl_config *conf,
                                    const unsigned char *dhm_P, size_t P_len,
                                    const unsigned char *dhm_G, size_t G_len )
@@ -2385,6 +2397,9 @@ int mbedtls_ssl_conf_dh_param_bin( mbedtls_ssl_config *conf,
 
     mbedtls_mpi_free( &conf->dhm_P );
     mbedtls_mpi_free( &conf->dhm_G );
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+    mbedtls_dhm_fixed_base_free( &conf->dhm_fixed_base );
+#endif
 
     if( ( ret = mbedtls_mpi_read_binary( &conf->dhm_P, dhm_P, P_len ) ) != 0 ||
         ( ret = mbedtls_mpi_read_binary( &conf->dhm_G, dhm_G, G_len ) ) != 0 )
@@ -2394,6 +2409,10 @@ int mbedtls_ssl_conf_dh_param_bin( mbedtls_ssl_config *conf,
         return( ret );
     }
 
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+    ssl_conf_dh_fixed_base( conf );
+#endif
+
     return( 0 );
 }
 
@@ -2403,6 +2422,9 @@ int mbedtls_ssl_conf_dh_param_ctx( mbedtls_ssl_config *conf, mbedtls_dhm_context
 
     mbedtls_mpi_free( &conf->dhm_P );
     mbedtls_mpi_free( &conf->dhm_G );
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+    mbedtls_dhm_fixed_base_free( &conf->dhm_fixed_base );
+#endif
 
     if( ( ret = mbedtls_dhm_get_value( dhm_ctx, MBEDTLS_DHM_PARAM_P,
                                        &conf->dhm_P ) ) != 0 ||
@@ -2414,6 +2436,10 @@ int mbedtls_ssl_conf_dh_param_ctx( mbedtls_ssl_config *conf, mbedtls_dhm_context
         return( ret );
     }
 
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+    ssl_conf_dh_fixed_base( conf );
+#endif
+
     return( 0 );
 }
 #endif /* MBEDTLS_DHM_C && MBEDTLS_SSL_SRV_C */
@@ -4910,6 +4936,9 @@ void mbedtls_ssl_config_free( mbedtls_ssl_config *conf )
 #if defined(MBEDTLS_DHM_C)
     mbedtls_mpi_free( &conf->dhm_P );
     mbedtls_mpi_free( &conf->dhm_G );
+#if defined(MBEDTLS_DHM_FIXED_BASE) && defined(MBEDTLS_SSL_SRV_C)
+    mbedtls_dhm_fixed_base_free( &conf->dhm_fixed_base );
+#endif
 #endif
 
 #if defined(MBEDTLS_SSL_HANDSHAKE_WITH_PSK_ENABLED)
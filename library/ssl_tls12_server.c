@@ -2865,6 +2865,18 @@ static int ssl_prepare_server_key_exchange( mbedtls_ssl_context *ssl,
          *     opaque dh_Ys<1..2^16-1>;
          * } ServerDHParams;
          */
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+        if( ssl->conf->dhm_fixed_base.table != NULL )
+        {
+            if( ( ret = mbedtls_dhm_set_fixed_base( &ssl->handshake->dhm_ctx,
+                                            &ssl->conf->dhm_fixed_base ) ) != 0 )
+            {
+                MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_dhm_set_fixed_base", ret );
+                return( ret );
+            }
+        }
+        else
+#endif /* MBEDTLS_DHM_FIXED_BASE */
         if( ( ret = mbedtls_dhm_set_group( &ssl->handshake->dhm_ctx,
                                            &ssl->conf->dhm_P,
                                            &ssl->conf->dhm_G ) ) != 0 )
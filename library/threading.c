@@ -155,6 +155,11 @@ void mbedtls_threading_set_alt( void (*mutex_init)( mbedtls_threading_mutex_t *
 #if defined(THREADING_USE_GMTIME)
     mbedtls_mutex_init( &mbedtls_threading_gmtime_mutex );
 #endif
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+    mbedtls_mutex_init( &mbedtls_threading_key_slot_mutex );
+    mbedtls_mutex_init( &mbedtls_threading_key_storage_mutex );
+    mbedtls_mutex_init( &mbedtls_threading_psa_globaldata_mutex );
+#endif
 }
 
 /*
@@ -168,6 +173,11 @@ void mbedtls_threading_free_alt( void )
 #if defined(THREADING_USE_GMTIME)
     mbedtls_mutex_free( &mbedtls_threading_gmtime_mutex );
 #endif
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+    mbedtls_mutex_free( &mbedtls_threading_key_slot_mutex );
+    mbedtls_mutex_free( &mbedtls_threading_key_storage_mutex );
+    mbedtls_mutex_free( &mbedtls_threading_psa_globaldata_mutex );
+#endif
 }
 #endif /* MBEDTLS_THREADING_ALT */
 
@@ -183,5 +193,10 @@ mbedtls_threading_mutex_t mbedtls_threading_readdir_mutex MUTEX_INIT;
 #if defined(THREADING_USE_GMTIME)
 mbedtls_threading_mutex_t mbedtls_threading_gmtime_mutex MUTEX_INIT;
 #endif
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+mbedtls_threading_mutex_t mbedtls_threading_key_slot_mutex MUTEX_INIT;
+mbedtls_threading_mutex_t mbedtls_threading_key_storage_mutex MUTEX_INIT;
+mbedtls_threading_mutex_t mbedtls_threading_psa_globaldata_mutex MUTEX_INIT;
+#endif
 
 #endif /* MBEDTLS_THREADING_C */
@@ -57,6 +57,11 @@ int main( void )
 #include "mbedtls/ssl_cookie.h"
 #endif
 
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+#include "mbedtls/ssl_async_engine.h"
+#include <poll.h>
+#endif
+
 #if defined(MBEDTLS_SSL_SERVER_NAME_INDICATION) && defined(MBEDTLS_FS_IO)
 #define SNI_OPTION
 #endif
@@ -93,6 +98,7 @@ int main( void )
 #define DFL_ASYNC_PRIVATE_DELAY1 ( -1 )
 #define DFL_ASYNC_PRIVATE_DELAY2 ( -1 )
 #define DFL_ASYNC_PRIVATE_ERROR  ( 0 )
+#define DFL_ASYNC_ENGINE        0
 #define DFL_PSK                 ""
 #define DFL_PSK_OPAQUE          0
 #define DFL_PSK_LIST_OPAQUE     0
@@ -215,6 +221,15 @@ int main( void )
 #define USAGE_KEY_OPAQUE ""
 #endif
 
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+#define USAGE_SSL_ASYNC_ENGINE \
+    "    async_engine=%%d          Threads of the built-in engine for\n" \
+    "                              asynchronous private key operations\n" \
+    "                              default: 0 (off, see async_operations)\n"
+#else
+#define USAGE_SSL_ASYNC_ENGINE ""
+#endif /* MBEDTLS_SSL_ASYNC_ENGINE_C */
+
 #if defined(MBEDTLS_SSL_ASYNC_PRIVATE)
 #define USAGE_SSL_ASYNC \
     "    async_operations=%%c...   d=decrypt, s=sign (default: -=off)\n" \
@@ -222,7 +237,8 @@ int main( void )
     "    async_private_delay2=%%d  Asynchronous delay for key_file2 and sni\n" \
     "                              default: -1 (not asynchronous)\n" \
     "    async_private_error=%%d   Async callback error injection (default=0=none,\n" \
-    "                              1=start, 2=cancel, 3=resume, negative=first time only)"
+    "                              1=start, 2=cancel, 3=resume, negative=first time only)\n" \
+    USAGE_SSL_ASYNC_ENGINE
 #else
 #define USAGE_SSL_ASYNC ""
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
@@ -608,6 +624,7 @@ struct options
     int async_private_delay1;   /* number of times f_async_resume needs to be called for key 1, or -1 for no async */
     int async_private_delay2;   /* number of times f_async_resume needs to be called for key 2, or -1 for no async */
     int async_private_error;    /* inject error in async private callback */
+    int async_engine;           /* threads of the built-in async engine     */
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     int psk_opaque;
     int psk_list_opaque;
@@ -1472,6 +1489,9 @@ int main( int argc, char *argv[] )
 #if defined(MBEDTLS_SSL_ASYNC_PRIVATE)
     ssl_async_key_context_t ssl_async_keys;
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+    mbedtls_ssl_async_engine async_engine;
+#endif
 #if defined(MBEDTLS_DHM_C) && defined(MBEDTLS_FS_IO)
     mbedtls_dhm_context dhm;
 #endif
@@ -1562,6 +1582,9 @@ int main( int argc, char *argv[] )
 #if defined(MBEDTLS_SSL_ASYNC_PRIVATE)
     memset( &ssl_async_keys, 0, sizeof( ssl_async_keys ) );
 #endif
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+    mbedtls_ssl_async_engine_init( &async_engine );
+#endif
 #if defined(MBEDTLS_DHM_C) && defined(MBEDTLS_FS_IO)
     mbedtls_dhm_init( &dhm );
 #endif
@@ -1648,6 +1671,7 @@ int main( int argc, char *argv[] )
     opt.async_private_delay1 = DFL_ASYNC_PRIVATE_DELAY1;
     opt.async_private_delay2 = DFL_ASYNC_PRIVATE_DELAY2;
     opt.async_private_error = DFL_ASYNC_PRIVATE_ERROR;
+    opt.async_engine        = DFL_ASYNC_ENGINE;
     opt.psk                 = DFL_PSK;
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     opt.psk_opaque          = DFL_PSK_OPAQUE;
@@ -1812,6 +1836,14 @@ int main( int argc, char *argv[] )
             opt.async_private_error = n;
         }
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+        else if( strcmp( p, "async_engine" ) == 0 )
+        {
+            opt.async_engine = atoi( q );
+            if( opt.async_engine < 0 )
+                goto usage;
+        }
+#endif /* MBEDTLS_SSL_ASYNC_ENGINE_C */
 #if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
         else if( strcmp( p, "cid" ) == 0 )
         {
@@ -3193,6 +3225,26 @@ int main( int argc, char *argv[] )
                                            &ssl_async_keys );
     }
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
+
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+    if( opt.async_engine > 0 )
+    {
+        if( ( ret = mbedtls_ssl_async_engine_setup( &async_engine,
+                                                    opt.async_engine,
+                                                    rng_get, &rng ) ) != 0 )
+        {
+            mbedtls_printf( " failed\n  ! mbedtls_ssl_async_engine_setup returned -0x%x\n\n", (unsigned int) -ret );
+            goto exit;
+        }
+
+        mbedtls_ssl_conf_async_private_cb( &conf,
+                                           mbedtls_ssl_async_engine_sign,
+                                           mbedtls_ssl_async_engine_decrypt,
+                                           mbedtls_ssl_async_engine_resume,
+                                           mbedtls_ssl_async_engine_cancel,
+                                           &async_engine );
+    }
+#endif /* MBEDTLS_SSL_ASYNC_ENGINE_C */
 #endif /* MBEDTLS_SSL_HANDSHAKE_WITH_CERT_ENABLED */
 
 #if defined(SNI_OPTION)
@@ -3518,6 +3570,22 @@ handshake:
         }
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
 
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+        if( ret == MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS && opt.async_engine > 0 )
+        {
+            /* Wait for a worker thread to complete the operation. An event
+             * loop would wait for this descriptor along with the sockets. */
+            struct pollfd pfd;
+
+            pfd.fd = mbedtls_ssl_async_engine_get_fd( &async_engine );
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            (void) poll( &pfd, 1, -1 );
+            (void) mbedtls_ssl_async_engine_next_completed( &async_engine );
+            continue;
+        }
+#endif /* MBEDTLS_SSL_ASYNC_ENGINE_C */
+
         if( ! mbedtls_status_is_ssl_in_progress( ret ) )
             break;
 
@@ -4296,6 +4364,10 @@ exit:
     mbedtls_ssl_free( &ssl );
     mbedtls_ssl_config_free( &conf );
 
+#if defined(MBEDTLS_SSL_ASYNC_ENGINE_C)
+    mbedtls_ssl_async_engine_free( &async_engine );
+#endif
+
 #if defined(MBEDTLS_SSL_CACHE_C)
     mbedtls_ssl_cache_free( &cache );
 #endif
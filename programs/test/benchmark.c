@@ -58,6 +58,9 @@ int main( void )
 #include "mbedtls/dhm.h"
 #include "mbedtls/ecdsa.h"
 #include "mbedtls/ecdh.h"
+#include "mbedtls/lms.h"
+
+#include "psa/crypto.h"
 
 #include "mbedtls/error.h"
 
@@ -109,16 +112,20 @@ static void mbedtls_set_alarm( int seconds );
 #define HEAP_SIZE       (1u << 16)  /* 64k */
 
 #define BUFSIZE         1024
+#define ECDSA_BATCH_SIZE    16
+#define ECDSA_NONCE_POOL_SIZE   256
+#define RSA_BATCH_SIZE      8
+#define RSA_THREADS         4
 #define HEADER_FORMAT   "  %-24s :  "
 #define TITLE_LEN       25
 
 #define OPTIONS                                                         \
     "md5, ripemd160, sha1, sha256, sha512,\n"                      \
     "des3, des, camellia, chacha20,\n"                  \
-    "aes_cbc, aes_gcm, aes_ccm, aes_xts, chachapoly,\n"                 \
+    "aes_cbc, aes_ctr, aes_gcm, aes_ccm, aes_xts, chachapoly,\n"        \
     "aes_cmac, des3_cmac, poly1305\n"                                   \
     "ctr_drbg, hmac_drbg\n"                                     \
-    "rsa, dhm, ecdsa, ecdh.\n"
+    "rsa, dhm, ecdsa, ecdh, lms.\n"
 
 #if defined(MBEDTLS_ERROR_C)
 #define PRINT_ERROR                                                     \
@@ -203,7 +210,8 @@ do {                                                                    \
 #define MEMORY_MEASURE_PRINT( title_len )
 #endif
 
-#define TIME_PUBLIC( TITLE, TYPE, CODE )                                \
+/* CODE performs COUNT operations at once */
+#define TIME_PUBLIC_BATCH( TITLE, TYPE, COUNT, CODE )                   \
 do {                                                                    \
     unsigned long ii;                                                   \
     int ret;                                                            \
@@ -231,12 +239,15 @@ do {                                                                    \
     }                                                                   \
     else                                                                \
     {                                                                   \
-        mbedtls_printf( "%6lu " TYPE "/s", ii / 3 );                    \
+        mbedtls_printf( "%6lu " TYPE "/s", ii * ( COUNT ) / 3 );        \
         MEMORY_MEASURE_PRINT( sizeof( TYPE ) + 1 );                     \
         mbedtls_printf( "\n" );                                         \
     }                                                                   \
 } while( 0 )
 
+#define TIME_PUBLIC( TITLE, TYPE, CODE )                                \
+    TIME_PUBLIC_BATCH( TITLE, TYPE, 1, CODE )
+
 #if !defined(HAVE_HARDCLOCK) && defined(MBEDTLS_HAVE_ASM) &&  \
     ( defined(_MSC_VER) && defined(_M_IX86) ) || defined(__WATCOMC__)
 
@@ -480,6 +491,37 @@ static int myrand( void *rng_state, unsigned char *output, size_t len )
     return( 0 );
 }
 
+#if defined(MBEDTLS_RSA_C) && defined(MBEDTLS_GENPRIME) && \
+    defined(MBEDTLS_THREADING_PTHREAD)
+#include <pthread.h>
+
+typedef struct
+{
+    mbedtls_rsa_context *rsa;
+    unsigned long ops;
+    int ret;
+} rsa_thread_info;
+
+/* Private key operations on a context shared with the other threads,
+ * until the alarm fires */
+static void *rsa_private_thread( void *arg )
+{
+    rsa_thread_info *info = (rsa_thread_info *) arg;
+    unsigned char tmp[512];
+
+    memset( tmp, 0, sizeof( tmp ) );
+
+    while( ! mbedtls_timing_alarmed && info->ret == 0 )
+    {
+        tmp[0] = 0;
+        info->ret = mbedtls_rsa_private( info->rsa, myrand, NULL, tmp, tmp );
+        info->ops++;
+    }
+
+    return( NULL );
+}
+#endif /* MBEDTLS_RSA_C && MBEDTLS_GENPRIME && MBEDTLS_THREADING_PTHREAD */
+
 #define CHECK_AND_CONTINUE( R )                                         \
     {                                                                   \
         int CHECK_AND_CONTINUE_ret = ( R );                             \
@@ -512,12 +554,12 @@ unsigned char buf[BUFSIZE];
 typedef struct {
     char md5, ripemd160, sha1, sha256, sha512,
          des3, des,
-         aes_cbc, aes_gcm, aes_ccm, aes_xts, chachapoly,
+         aes_cbc, aes_ctr, aes_gcm, aes_ccm, aes_xts, chachapoly,
          aes_cmac, des3_cmac,
          aria, camellia, chacha20,
          poly1305,
          ctr_drbg, hmac_drbg,
-         rsa, dhm, ecdsa, ecdh;
+         rsa, dhm, ecdsa, ecdh, lms;
 } todo_list;
 
 
@@ -568,6 +610,8 @@ int main( int argc, char *argv[] )
                 todo.des = 1;
             else if( strcmp( argv[i], "aes_cbc" ) == 0 )
                 todo.aes_cbc = 1;
+            else if( strcmp( argv[i], "aes_ctr" ) == 0 )
+                todo.aes_ctr = 1;
             else if( strcmp( argv[i], "aes_xts" ) == 0 )
                 todo.aes_xts = 1;
             else if( strcmp( argv[i], "aes_gcm" ) == 0 )
@@ -600,6 +644,8 @@ int main( int argc, char *argv[] )
                 todo.ecdsa = 1;
             else if( strcmp( argv[i], "ecdh" ) == 0 )
                 todo.ecdh = 1;
+            else if( strcmp( argv[i], "lms" ) == 0 )
+                todo.lms = 1;
 #if defined(MBEDTLS_ECP_C)
             else if( set_ecp_curve( argv[i], single_curve ) )
                 curve_list = single_curve;
@@ -710,6 +756,41 @@ int main( int argc, char *argv[] )
             TIME_AND_TSC( title,
                 mbedtls_aes_crypt_cbc( &aes, MBEDTLS_AES_ENCRYPT, BUFSIZE, tmp, buf, buf ) );
         }
+        for( keysize = 128; keysize <= 256; keysize += 64 )
+        {
+            mbedtls_snprintf( title, sizeof( title ), "AES-CBC-dec-%d", keysize );
+
+            memset( buf, 0, sizeof( buf ) );
+            memset( tmp, 0, sizeof( tmp ) );
+            CHECK_AND_CONTINUE( mbedtls_aes_setkey_dec( &aes, tmp, keysize ) );
+
+            TIME_AND_TSC( title,
+                mbedtls_aes_crypt_cbc( &aes, MBEDTLS_AES_DECRYPT, BUFSIZE, tmp, buf, buf ) );
+        }
+        mbedtls_aes_free( &aes );
+    }
+#endif
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+    if( todo.aes_ctr )
+    {
+        int keysize;
+        size_t nc_off;
+        unsigned char stream_block[16];
+        mbedtls_aes_context aes;
+        mbedtls_aes_init( &aes );
+        for( keysize = 128; keysize <= 256; keysize += 64 )
+        {
+            mbedtls_snprintf( title, sizeof( title ), "AES-CTR-%d", keysize );
+
+            memset( buf, 0, sizeof( buf ) );
+            memset( tmp, 0, sizeof( tmp ) );
+            nc_off = 0;
+            CHECK_AND_CONTINUE( mbedtls_aes_setkey_enc( &aes, tmp, keysize ) );
+
+            TIME_AND_TSC( title,
+                mbedtls_aes_crypt_ctr( &aes, BUFSIZE, &nc_off, tmp, stream_block,
+                                       buf, buf ) );
+        }
         mbedtls_aes_free( &aes );
     }
 #endif
@@ -966,6 +1047,9 @@ int main( int argc, char *argv[] )
     {
         int keysize;
         mbedtls_rsa_context rsa;
+        unsigned char rsa_batch[RSA_BATCH_SIZE][512];
+        const unsigned char *rsa_batch_in[RSA_BATCH_SIZE];
+        unsigned char *rsa_batch_out[RSA_BATCH_SIZE];
         for( keysize = 2048; keysize <= 4096; keysize *= 2 )
         {
             mbedtls_snprintf( title, sizeof( title ), "RSA-%d", keysize );
@@ -981,6 +1065,59 @@ int main( int argc, char *argv[] )
                     buf[0] = 0;
                     ret = mbedtls_rsa_private( &rsa, myrand, NULL, buf, buf ) );
 
+            for( i = 0; i < RSA_BATCH_SIZE; i++ )
+            {
+                memset( rsa_batch[i], 0, sizeof( rsa_batch[i] ) );
+                rsa_batch_in[i] = rsa_batch[i];
+                rsa_batch_out[i] = rsa_batch[i];
+            }
+
+            TIME_PUBLIC_BATCH( title, "private batch", RSA_BATCH_SIZE,
+                    ret = mbedtls_rsa_private_batch( &rsa, myrand, NULL,
+                                                     rsa_batch_in, rsa_batch_out,
+                                                     RSA_BATCH_SIZE ) );
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+            {
+                /* Several threads signing with the same key: the mutex is
+                 * only held to update the blinding values */
+                pthread_t tid[RSA_THREADS];
+                rsa_thread_info info[RSA_THREADS];
+                unsigned long ops = 0;
+                int ret = 0;
+
+                mbedtls_snprintf( title, sizeof( title ), "RSA-%d, %d threads",
+                                  keysize, RSA_THREADS );
+                mbedtls_printf( HEADER_FORMAT, title );
+                fflush( stdout );
+
+                mbedtls_set_alarm( 3 );
+                for( i = 0; i < RSA_THREADS; i++ )
+                {
+                    info[i].rsa = &rsa;
+                    info[i].ops = 0;
+                    info[i].ret = 0;
+                    if( pthread_create( &tid[i], NULL, rsa_private_thread,
+                                        &info[i] ) != 0 )
+                        mbedtls_exit( 1 );
+                }
+                for( i = 0; i < RSA_THREADS; i++ )
+                {
+                    pthread_join( tid[i], NULL );
+                    ops += info[i].ops;
+                    if( info[i].ret != 0 )
+                        ret = info[i].ret;
+                }
+
+                if( ret != 0 )
+                {
+                    PRINT_ERROR;
+                }
+                else
+                    mbedtls_printf( "%6lu private/s\n", ops / 3 );
+            }
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
             mbedtls_rsa_free( &rsa );
         }
     }
@@ -1008,11 +1145,17 @@ int main( int argc, char *argv[] )
                                       sizeof( dhm_G_3072 ) };
 
         mbedtls_dhm_context dhm;
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+        mbedtls_dhm_fixed_base dhm_fb;
+#endif
         size_t olen;
         size_t n;
         for( i = 0; (size_t) i < sizeof( dhm_sizes ) / sizeof( dhm_sizes[0] ); i++ )
         {
             mbedtls_dhm_init( &dhm );
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+            mbedtls_dhm_fixed_base_init( &dhm_fb );
+#endif
 
             if( mbedtls_mpi_read_binary( &dhm.P, dhm_P[i],
                                          dhm_P_size[i] ) != 0 ||
@@ -1037,7 +1180,24 @@ int main( int argc, char *argv[] )
             TIME_PUBLIC( title, "handshake",
                     ret |= mbedtls_dhm_calc_secret( &dhm, buf, sizeof( buf ), &olen, myrand, NULL ) );
 
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+            if( mbedtls_dhm_fixed_base_setup( &dhm_fb, &dhm.P, &dhm.G ) != 0 ||
+                mbedtls_dhm_set_fixed_base( &dhm, &dhm_fb ) != 0 )
+            {
+                mbedtls_exit( 1 );
+            }
+
+            mbedtls_snprintf( title, sizeof( title ), "DHE-%d fixed-base", dhm_sizes[i] );
+            TIME_PUBLIC( title, "handshake",
+                    ret |= mbedtls_dhm_make_public( &dhm, (int) n, buf, n,
+                                            myrand, NULL );
+                    ret |= mbedtls_dhm_calc_secret( &dhm, buf, sizeof( buf ), &olen, myrand, NULL ) );
+#endif
+
             mbedtls_dhm_free( &dhm );
+#if defined(MBEDTLS_DHM_FIXED_BASE)
+            mbedtls_dhm_fixed_base_free( &dhm_fb );
+#endif
         }
     }
 #endif
@@ -1096,6 +1256,109 @@ int main( int argc, char *argv[] )
 
             mbedtls_ecdsa_free( &ecdsa );
         }
+
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+        /* Signing with precomputed nonces. With MBEDTLS_THREADING_PTHREAD a
+         * background thread refills the pool, otherwise signing falls back
+         * to inline nonces once the pool is empty. */
+        for( curve_info = curve_list;
+             curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
+             curve_info++ )
+        {
+            mbedtls_ecdsa_nonce_pool pool;
+            mbedtls_mpi r, s;
+
+            if( ! mbedtls_ecdsa_can_do( curve_info->grp_id ) )
+                continue;
+
+            mbedtls_ecdsa_init( &ecdsa );
+            mbedtls_ecdsa_nonce_pool_init( &pool );
+            mbedtls_mpi_init( &r );
+            mbedtls_mpi_init( &s );
+
+            if( mbedtls_ecdsa_genkey( &ecdsa, curve_info->grp_id, myrand, NULL ) != 0 ||
+                mbedtls_ecdsa_nonce_pool_setup( &pool, curve_info->grp_id,
+                                                ECDSA_NONCE_POOL_SIZE,
+                                                myrand, NULL ) != 0 ||
+                mbedtls_ecdsa_nonce_pool_fill( &pool, ECDSA_NONCE_POOL_SIZE ) != 0 )
+            {
+                mbedtls_exit( 1 );
+            }
+#if defined(MBEDTLS_THREADING_PTHREAD)
+            if( mbedtls_ecdsa_nonce_pool_start( &pool ) != 0 )
+                mbedtls_exit( 1 );
+#endif
+
+            mbedtls_snprintf( title, sizeof( title ), "ECDSA-%s",
+                                              curve_info->name );
+            TIME_PUBLIC( title, "pooled sign",
+                    ret = mbedtls_ecdsa_sign_pooled( &ecdsa.grp, &r, &s, &ecdsa.d,
+                                                     buf, curve_info->bit_size / 8,
+                                                     &pool, myrand, NULL ) );
+
+            mbedtls_mpi_free( &r );
+            mbedtls_mpi_free( &s );
+            mbedtls_ecdsa_nonce_pool_free( &pool );
+            mbedtls_ecdsa_free( &ecdsa );
+        }
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
+
+        for( curve_info = curve_list;
+             curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
+             curve_info++ )
+        {
+            mbedtls_ecp_group grp;
+            mbedtls_ecp_point Q[ECDSA_BATCH_SIZE];
+            const mbedtls_ecp_point *Qp[ECDSA_BATCH_SIZE];
+            mbedtls_mpi d, r[ECDSA_BATCH_SIZE], s[ECDSA_BATCH_SIZE];
+            const unsigned char *hashes[ECDSA_BATCH_SIZE];
+            size_t hash_lengths[ECDSA_BATCH_SIZE];
+            unsigned char results[( ECDSA_BATCH_SIZE + 7 ) / 8];
+
+            if( ! mbedtls_ecdsa_can_do( curve_info->grp_id ) )
+                continue;
+
+            mbedtls_ecp_group_init( &grp );
+            mbedtls_mpi_init( &d );
+            for( i = 0; i < ECDSA_BATCH_SIZE; i++ )
+            {
+                mbedtls_ecp_point_init( &Q[i] );
+                mbedtls_mpi_init( &r[i] );
+                mbedtls_mpi_init( &s[i] );
+                Qp[i] = &Q[i];
+                hashes[i] = buf;
+                hash_lengths[i] = 32;
+            }
+
+            if( mbedtls_ecp_group_load( &grp, curve_info->grp_id ) != 0 )
+                mbedtls_exit( 1 );
+
+            for( i = 0; i < ECDSA_BATCH_SIZE; i++ )
+            {
+                if( mbedtls_ecp_gen_keypair( &grp, &d, &Q[i], myrand, NULL ) != 0 ||
+                    mbedtls_ecdsa_sign( &grp, &r[i], &s[i], &d, hashes[i],
+                                        hash_lengths[i], myrand, NULL ) != 0 )
+                {
+                    mbedtls_exit( 1 );
+                }
+            }
+
+            mbedtls_snprintf( title, sizeof( title ), "ECDSA-%s",
+                                              curve_info->name );
+            TIME_PUBLIC_BATCH( title, "batch verify", ECDSA_BATCH_SIZE,
+                    ret = mbedtls_ecdsa_verify_batch( &grp, hashes, hash_lengths,
+                                                      Qp, r, s, ECDSA_BATCH_SIZE,
+                                                      results ) );
+
+            for( i = 0; i < ECDSA_BATCH_SIZE; i++ )
+            {
+                mbedtls_ecp_point_free( &Q[i] );
+                mbedtls_mpi_free( &r[i] );
+                mbedtls_mpi_free( &s[i] );
+            }
+            mbedtls_mpi_free( &d );
+            mbedtls_ecp_group_free( &grp );
+        }
     }
 #endif
 
@@ -1268,6 +1531,72 @@ int main( int argc, char *argv[] )
     }
 #endif
 
+#if defined(MBEDTLS_LMS_PRIVATE)
+    if( todo.lms )
+    {
+        mbedtls_lms_private_t lms_priv;
+        mbedtls_lms_public_t lms_pub;
+        unsigned char lms_seed[32];
+        unsigned char *lms_sig = NULL;
+        unsigned char *lms_state = NULL;
+        size_t lms_sig_len = MBEDTLS_LMS_SIG_LEN( MBEDTLS_LMS_SHA256_M32_H10,
+                                                  MBEDTLS_LMOTS_SHA256_N32_W8 );
+        size_t lms_state_len = MBEDTLS_LMS_PRIVATE_KEY_LEN( MBEDTLS_LMS_SHA256_M32_H10,
+                                                            sizeof( lms_seed ) );
+
+        memset( buf, 0x2A, sizeof( buf ) );
+        memset( lms_seed, 0x2B, sizeof( lms_seed ) );
+        (void) psa_crypto_init( );
+
+        TIME_PUBLIC( "LMS-SHA256-M32-H10", "keygen",
+                mbedtls_lms_private_init( &lms_priv );
+                ret = mbedtls_lms_generate_private_key( &lms_priv,
+                        MBEDTLS_LMS_SHA256_M32_H10, MBEDTLS_LMOTS_SHA256_N32_W8,
+                        myrand, NULL, lms_seed, sizeof( lms_seed ) );
+                mbedtls_lms_private_free( &lms_priv ) );
+
+        mbedtls_lms_private_init( &lms_priv );
+        mbedtls_lms_public_init( &lms_pub );
+        lms_sig = mbedtls_calloc( 1, lms_sig_len );
+        lms_state = mbedtls_calloc( 1, lms_state_len );
+
+        if( lms_sig == NULL || lms_state == NULL ||
+            mbedtls_lms_generate_private_key( &lms_priv,
+                    MBEDTLS_LMS_SHA256_M32_H10, MBEDTLS_LMOTS_SHA256_N32_W8,
+                    myrand, NULL, lms_seed, sizeof( lms_seed ) ) != 0 ||
+            mbedtls_lms_calculate_public_key( &lms_pub, &lms_priv ) != 0 ||
+            mbedtls_lms_export_private_key( &lms_priv, lms_state,
+                                            lms_state_len, NULL ) != 0 )
+        {
+            mbedtls_printf( HEADER_FORMAT "FAILED\n", "LMS-SHA256-M32-H10" );
+        }
+        else
+        {
+            /* Start again from the saved state when all the one-time keys
+             * have been used up. */
+            TIME_PUBLIC( "LMS-SHA256-M32-H10", "sign",
+                    ret = mbedtls_lms_sign( &lms_priv, myrand, NULL, buf, BUFSIZE,
+                                            lms_sig, lms_sig_len, NULL );
+                    if( ret == MBEDTLS_ERR_LMS_OUT_OF_PRIVATE_KEYS )
+                    {
+                        mbedtls_lms_private_free( &lms_priv );
+                        mbedtls_lms_private_init( &lms_priv );
+                        ret = mbedtls_lms_import_private_key( &lms_priv, lms_state,
+                                                              lms_state_len );
+                    } );
+
+            TIME_PUBLIC( "LMS-SHA256-M32-H10", "verify",
+                    ret = mbedtls_lms_verify( &lms_pub, buf, BUFSIZE,
+                                              lms_sig, lms_sig_len ) );
+        }
+
+        mbedtls_free( lms_sig );
+        mbedtls_free( lms_state );
+        mbedtls_lms_public_free( &lms_pub );
+        mbedtls_lms_private_free( &lms_priv );
+    }
+#endif
+
     mbedtls_printf( "\n" );
 
 #if defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C)
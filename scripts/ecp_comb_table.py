@@ -31,11 +31,14 @@ If you are trying to add new curve, you can follow these steps:
 
 1. Define curve parameters (<curve>_p, <curve>_gx, etc...) in ecp_curves.c.
 2. Add a macro to define <curve>_T to NULL following these parameters.
-3. Build mbedcrypto
+3. Build mbedcrypto with MBEDTLS_ECP_WINDOW_SIZE set to 7
 4. Run this script with an argument of new curve
-5. Copy the output of this script into ecp_curves.c and replace the macro added
-   in Step 2
-6. Rebuild and test if everything is ok
+5. Build mbedcrypto again with MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW also
+   enabled, and run this script again to get the tables with a larger window
+6. Copy the outputs of Step 4 and Step 5, in this order, into ecp_curves.c
+   just before the macro added in Step 2, and close the block by putting that
+   macro between "#else" and "#endif"
+7. Rebuild and test if everything is ok
 
 Replace the <curve> in the above with the name of the curve you want to add."""
 
@@ -43,6 +46,7 @@ CC = os.getenv('CC', 'cc')
 MBEDTLS_LIBRARY_PATH = os.getenv('MBEDTLS_LIBRARY_PATH', "library")
 
 SRC_DUMP_COMB_TABLE = r'''
+#define MBEDTLS_ALLOW_PRIVATE_ACCESS
 #include <stdio.h>
 #include <stdlib.h>
 #include "mbedtls/ecp.h"
@@ -58,7 +62,7 @@ static void dump_mpi_initialize( const char *name, const mbedtls_mpi *d )
     mbedtls_mpi_write_binary_le( d, buf, olen );
     printf("static const mbedtls_mpi_uint %s[] = {\n", name);
     for (p = buf; p < buf + olen; p += 8) {
-        printf( "    BYTES_TO_T_UINT_8( 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X ),\n",
+        printf( "    MBEDTLS_BYTES_TO_T_UINT_8( 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X, 0x%02X ),\n",
                 p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7] );
     }
     printf("};\n");
@@ -68,7 +72,15 @@ static void dump_T( const mbedtls_ecp_group *grp )
 {
     char name[128];
 
-    printf( "#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1\n" );
+    /* The default tables use a window of 5 bits, or 6 bits for curves of
+     * 384 bits or more, see ecp_pick_window_size() */
+    size_t default_size = grp->nbits >= 384 ? 32 : 16;
+
+    if( grp->T_size > default_size )
+        printf( "#elif MBEDTLS_ECP_FIXED_POINT_OPTIM == 1\n" );
+    else
+        printf( "#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 && \\\n"
+                "    !defined(MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW)\n" );
 
     for (size_t i = 0; i < grp->T_size; ++i) {
         snprintf( name, sizeof(name), "%s_T_%zu_X", CURVE_NAME, i );
@@ -95,7 +107,18 @@ static void dump_T( const mbedtls_ecp_group *grp )
                 CURVE_NAME, i
         );
     }
-    printf("};\n#endif\n\n");
+    printf("};\n");
+}
+
+/* The table does not depend on the random values used to blind the
+ * computation, so any non-constant sequence will do. */
+static int dummy_rng( void *ctx, unsigned char *output, size_t len )
+{
+    static unsigned char counter = 0;
+    (void) ctx;
+    for( size_t i = 0; i < len; ++i )
+        output[i] = ++counter;
+    return( 0 );
 }
 
 int main()
@@ -117,7 +140,7 @@ int main()
     mbedtls_ecp_point_init( &R );
     mbedtls_mpi_init( &m);
     mbedtls_mpi_lset( &m, 1 );
-    rc = mbedtls_ecp_mul( &grp, &R, &m, &grp.G, NULL, NULL );
+    rc = mbedtls_ecp_mul( &grp, &R, &m, &grp.G, dummy_rng, NULL );
     if ( rc != 0 ) {
         char buf[100];
         mbedtls_strerror( rc, buf, sizeof(buf) );
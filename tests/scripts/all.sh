@@ -175,6 +175,8 @@ pre_initialize_variables () {
     : ${ARMC6_BIN_DIR:=/usr/bin}
     : ${ARM_NONE_EABI_GCC_PREFIX:=arm-none-eabi-}
     : ${ARM_LINUX_GNUEABI_GCC_PREFIX:=arm-linux-gnueabi-}
+    : ${AARCH64_LINUX_GNU_GCC_PREFIX:=aarch64-linux-gnu-}
+    : ${QEMU_AARCH64:=qemu-aarch64}
 
     # if MAKEFLAGS is not set add the -j option to speed up invocations of make
     if [ -z "${MAKEFLAGS+set}" ]; then
@@ -249,6 +251,12 @@ General options:
      --arm-linux-gnueabi-gcc-prefix=<string>
                         Prefix for a cross-compiler for arm-linux-gnueabi
                         (default: "${ARM_LINUX_GNUEABI_GCC_PREFIX}")
+     --aarch64-linux-gnu-gcc-prefix=<string>
+                        Prefix for a cross-compiler for aarch64-linux-gnu
+                        (default: "${AARCH64_LINUX_GNU_GCC_PREFIX}")
+     --qemu-aarch64=<path>
+                        Path to the QEMU user-mode emulator for AArch64
+                        (default: "${QEMU_AARCH64}")
      --armcc            Run ARM Compiler builds (on by default).
      --restore          First clean up the build tree, restoring backed up
                         files. Do not run any components unless they are
@@ -424,6 +432,8 @@ pre_parse_command_line () {
             --append-outcome) append_outcome=1;;
             --arm-none-eabi-gcc-prefix) shift; ARM_NONE_EABI_GCC_PREFIX="$1";;
             --arm-linux-gnueabi-gcc-prefix) shift; ARM_LINUX_GNUEABI_GCC_PREFIX="$1";;
+            --aarch64-linux-gnu-gcc-prefix) shift; AARCH64_LINUX_GNU_GCC_PREFIX="$1";;
+            --qemu-aarch64) shift; QEMU_AARCH64="$1";;
             --armcc) no_armcc=;;
             --armc5-bin-dir) shift; ARMC5_BIN_DIR="$1";;
             --armc6-bin-dir) shift; ARMC6_BIN_DIR="$1";;
@@ -1576,6 +1586,7 @@ component_test_memsan_constant_flow () {
     scripts/config.py set MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN
     scripts/config.py unset MBEDTLS_USE_PSA_CRYPTO
     scripts/config.py unset MBEDTLS_AESNI_C # memsan doesn't grok asm
+    scripts/config.py unset MBEDTLS_MPI_MONTMUL_ASM # memsan doesn't grok asm
     CC=clang cmake -D CMAKE_BUILD_TYPE:String=MemSan .
     make
 
@@ -1594,6 +1605,7 @@ component_test_memsan_constant_flow_psa () {
     scripts/config.py full
     scripts/config.py set MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN
     scripts/config.py unset MBEDTLS_AESNI_C # memsan doesn't grok asm
+    scripts/config.py unset MBEDTLS_MPI_MONTMUL_ASM # memsan doesn't grok asm
     CC=clang cmake -D CMAKE_BUILD_TYPE:String=MemSan .
     make
 
@@ -1863,6 +1875,10 @@ component_build_module_alt () {
     # MBEDTLS_SHA512_*ALT can't be used with MBEDTLS_SHA512_USE_A64_CRYPTO_*
     scripts/config.py unset MBEDTLS_SHA512_USE_A64_CRYPTO_IF_PRESENT
     scripts/config.py unset MBEDTLS_SHA512_USE_A64_CRYPTO_ONLY
+    # MBEDTLS_SHA1_*ALT and MBEDTLS_SHA256_*ALT can't be used with
+    # MBEDTLS_SHA*_USE_X86_SHANI_IF_PRESENT
+    scripts/config.py unset MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT
+    scripts/config.py unset MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT
     # Enable all MBEDTLS_XXX_ALT for whole modules. Do not enable
     # MBEDTLS_XXX_YYY_ALT which are for single functions.
     scripts/config.py set-all 'MBEDTLS_([A-Z0-9]*|NIST_KW)_ALT'
@@ -2086,9 +2102,11 @@ component_test_psa_crypto_config_accel_hash_use_psa () {
     scripts/config.py unset MBEDTLS_MD5_C
     scripts/config.py unset MBEDTLS_RIPEMD160_C
     scripts/config.py unset MBEDTLS_SHA1_C
+    scripts/config.py unset MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT
     scripts/config.py unset MBEDTLS_SHA224_C
     scripts/config.py unset MBEDTLS_SHA256_C # see external RNG below
     scripts/config.py unset MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT
+    scripts/config.py unset MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT
     scripts/config.py unset MBEDTLS_SHA384_C
     scripts/config.py unset MBEDTLS_SHA512_C
     scripts/config.py unset MBEDTLS_SHA512_USE_A64_CRYPTO_IF_PRESENT
@@ -3049,6 +3067,94 @@ component_test_min_mpi_window_size () {
     make test
 }
 
+component_test_no_mpi_montmul_asm () {
+    msg "build: default config minus MBEDTLS_MPI_MONTMUL_ASM"
+    scripts/config.py unset MBEDTLS_MPI_MONTMUL_ASM
+    make CC=gcc CFLAGS='-Werror -Wall -Wextra -O2'
+
+    msg "test: default config minus MBEDTLS_MPI_MONTMUL_ASM"
+    make test
+}
+
+component_test_aarch64_mpi_montmul_asm () {
+    msg "build: ${AARCH64_LINUX_GNU_GCC_PREFIX}gcc, MBEDTLS_MPI_MONTMUL_ASM_A64" # ~ 1 min
+    scripts/config.py set MBEDTLS_MPI_MONTMUL_ASM_A64
+    # Link statically so that QEMU does not need an AArch64 sysroot.
+    make CC="${AARCH64_LINUX_GNU_GCC_PREFIX}gcc" AR="${AARCH64_LINUX_GNU_GCC_PREFIX}ar" CFLAGS='-Werror -Wall -Wextra -O2' LDFLAGS='-static' lib tests
+
+    msg "test: bignum and public-key suites under ${QEMU_AARCH64}, MBEDTLS_MPI_MONTMUL_ASM_A64"
+    cd tests
+    for suite in test_suite_bignum* test_suite_ecp test_suite_ecdsa test_suite_ecdh test_suite_dhm test_suite_rsa; do
+        case "$suite" in
+            *.c|*.datax) continue;;
+        esac
+        ${QEMU_AARCH64} ./$suite
+    done
+    cd ..
+}
+support_test_aarch64_mpi_montmul_asm () {
+    type ${AARCH64_LINUX_GNU_GCC_PREFIX}gcc >/dev/null 2>&1 &&
+    type ${QEMU_AARCH64} >/dev/null 2>&1
+}
+
+component_test_sha_x86_shani () {
+    msg "build: default config + MBEDTLS_SHA{1,256}_USE_X86_SHANI_IF_PRESENT"
+    scripts/config.py set MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT
+    scripts/config.py set MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT
+    make CC=gcc CFLAGS='-Werror -Wall -Wextra -O2'
+
+    msg "test: default config + MBEDTLS_SHA{1,256}_USE_X86_SHANI_IF_PRESENT"
+    make test
+}
+support_test_sha_x86_shani () {
+    # The options fall back to C silently, so only run where the SHA
+    # extensions are actually exercised.
+    grep -q -w sha_ni /proc/cpuinfo 2>/dev/null
+}
+
+component_test_chacha20_simd () {
+    msg "build: default config + MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT"
+    scripts/config.py set MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT
+    make CC=gcc CFLAGS='-Werror -Wall -Wextra -O2'
+
+    msg "test: default config + MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT"
+    make test
+}
+
+component_test_aarch64_chacha20_simd () {
+    msg "build: ${AARCH64_LINUX_GNU_GCC_PREFIX}gcc, MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT" # ~ 1 min
+    scripts/config.py set MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT
+    make CC="${AARCH64_LINUX_GNU_GCC_PREFIX}gcc" AR="${AARCH64_LINUX_GNU_GCC_PREFIX}ar" CFLAGS='-Werror -Wall -Wextra -O2' LDFLAGS='-static' lib tests
+
+    msg "test: ChaCha20 suites under ${QEMU_AARCH64}, MBEDTLS_CHACHA20_USE_SIMD_IF_PRESENT"
+    cd tests
+    ${QEMU_AARCH64} ./test_suite_chacha20
+    ${QEMU_AARCH64} ./test_suite_chachapoly
+    ${QEMU_AARCH64} ./test_suite_cipher.chachapoly
+    cd ..
+}
+support_test_aarch64_chacha20_simd () {
+    support_test_aarch64_mpi_montmul_asm
+}
+
+component_test_aarch64_sha256_multi_neon () {
+    msg "build: ${AARCH64_LINUX_GNU_GCC_PREFIX}gcc, MBEDTLS_TEST_HOOKS, MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT" # ~ 1 min
+    scripts/config.py set MBEDTLS_TEST_HOOKS
+    scripts/config.py set MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT
+    make CC="${AARCH64_LINUX_GNU_GCC_PREFIX}gcc" AR="${AARCH64_LINUX_GNU_GCC_PREFIX}ar" CFLAGS='-Werror -Wall -Wextra -O2' LDFLAGS='-static' lib tests
+
+    # The "forced SIMD" cases run the Neon lanes of mbedtls_sha256_multi()
+    # even though qemu provides the SHA-256 instructions.
+    msg "test: SHA suites under ${QEMU_AARCH64}, MBEDTLS_TEST_HOOKS, MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT"
+    cd tests
+    ${QEMU_AARCH64} ./test_suite_shax
+    ${QEMU_AARCH64} ./test_suite_md
+    cd ..
+}
+support_test_aarch64_sha256_multi_neon () {
+    support_test_aarch64_mpi_montmul_asm
+}
+
 component_test_have_int32 () {
     msg "build: gcc, force 32-bit bignum limbs"
     scripts/config.py unset MBEDTLS_HAVE_ASM
@@ -3091,6 +3197,87 @@ component_test_no_64bit_multiplication () {
     make test
 }
 
+component_test_ecp_fixed_point_large_window () {
+    msg "build: full + MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW, restartable" # ~ 10s
+    scripts/config.py full
+    scripts/config.py unset MBEDTLS_USE_PSA_CRYPTO
+    scripts/config.py set MBEDTLS_ECP_RESTARTABLE
+    scripts/config.py set MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW
+    make CFLAGS='-Werror -O1'
+
+    msg "test: full + MBEDTLS_ECP_FIXED_POINT_LARGE_WINDOW, restartable" # ~ 10s
+    make test
+}
+
+component_test_no_ecp_nist_fixed_limbs () {
+    msg "build: full minus MBEDTLS_ECP_NIST_FIXED_LIMBS" # ~ 10s
+    scripts/config.py full
+    scripts/config.py unset MBEDTLS_ECP_NIST_FIXED_LIMBS
+    make CFLAGS='-Werror -O1'
+
+    msg "test: full minus MBEDTLS_ECP_NIST_FIXED_LIMBS" # ~ 10s
+    make test
+}
+
+component_test_no_ecp_montgomery_fixed_limbs () {
+    msg "build: full minus MBEDTLS_ECP_MONTGOMERY_FIXED_LIMBS" # ~ 10s
+    scripts/config.py full
+    scripts/config.py unset MBEDTLS_ECP_MONTGOMERY_FIXED_LIMBS
+    make CFLAGS='-Werror -O1'
+
+    msg "test: full minus MBEDTLS_ECP_MONTGOMERY_FIXED_LIMBS" # ~ 10s
+    make test
+}
+
+component_test_ecdsa_nonce_pool_pthread () {
+    msg "build: full + MBEDTLS_ECDSA_NONCE_POOL with pthread refill thread" # ~ 10s
+    scripts/config.py full
+    scripts/config.py set MBEDTLS_ECDSA_NONCE_POOL
+    scripts/config.py set MBEDTLS_THREADING_C
+    scripts/config.py set MBEDTLS_THREADING_PTHREAD
+    CC=gcc cmake -D LINK_WITH_PTHREAD=ON -D CMAKE_BUILD_TYPE:String=Release .
+    make
+
+    msg "test: full + MBEDTLS_ECDSA_NONCE_POOL with pthread refill thread" # ~ 10s
+    make test
+}
+
+component_test_rsa_gen_key_parallel () {
+    msg "build: full + MBEDTLS_RSA_GEN_KEY_PARALLEL" # ~ 10s
+    scripts/config.py full
+    scripts/config.py set MBEDTLS_RSA_GEN_KEY_PARALLEL
+    scripts/config.py set MBEDTLS_THREADING_C
+    scripts/config.py set MBEDTLS_THREADING_PTHREAD
+    CC=gcc cmake -D LINK_WITH_PTHREAD=ON -D CMAKE_BUILD_TYPE:String=Release .
+    make
+
+    msg "test: full + MBEDTLS_RSA_GEN_KEY_PARALLEL" # ~ 10s
+    make test
+}
+
+component_test_ssl_async_engine () {
+    msg "build: full + MBEDTLS_SSL_ASYNC_ENGINE_C" # ~ 10s
+    scripts/config.py full
+    scripts/config.py set MBEDTLS_SSL_ASYNC_ENGINE_C
+    scripts/config.py set MBEDTLS_THREADING_C
+    scripts/config.py set MBEDTLS_THREADING_PTHREAD
+    CC=gcc cmake -D LINK_WITH_PTHREAD=ON -D CMAKE_BUILD_TYPE:String=Release .
+    make
+
+    msg "test: full + MBEDTLS_SSL_ASYNC_ENGINE_C" # ~ 10s
+    make test
+}
+
+component_test_mpi_gen_prime_small_sieve () {
+    msg "build: default + MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND=3 (ASan build)" # ~ 10s
+    scripts/config.py set MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND 3
+    CC=gcc cmake -D CMAKE_BUILD_TYPE:String=Asan .
+    make
+
+    msg "test: MBEDTLS_MPI_GEN_PRIME_SIEVE_BOUND=3 - main suites (ASan build)" # ~ 10s
+    make test
+}
+
 component_test_no_strings () {
     msg "build: no strings" # ~10s
     scripts/config.py full
@@ -3358,6 +3545,7 @@ support_build_mingw() {
 component_test_memsan () {
     msg "build: MSan (clang)" # ~ 1 min 20s
     scripts/config.py unset MBEDTLS_AESNI_C # memsan doesn't grok asm
+    scripts/config.py unset MBEDTLS_MPI_MONTMUL_ASM # memsan doesn't grok asm
     CC=clang cmake -D CMAKE_BUILD_TYPE:String=MemSan .
     make
 
@@ -259,6 +259,7 @@ REVERSE_DEPENDENCIES = {
                          'MBEDTLS_SHA224_C',
                          'MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT',
                          'MBEDTLS_SHA256_USE_A64_CRYPTO_ONLY',
+                         'MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT',
                          'MBEDTLS_LMS_C',
                          'MBEDTLS_LMS_PRIVATE'],
     'MBEDTLS_SHA512_C': ['MBEDTLS_SHA384_C',
@@ -268,7 +269,9 @@ REVERSE_DEPENDENCIES = {
                          'MBEDTLS_ENTROPY_FORCE_SHA256',
                          'MBEDTLS_SHA256_C',
                          'MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT',
-                         'MBEDTLS_SHA256_USE_A64_CRYPTO_ONLY'],
+                         'MBEDTLS_SHA256_USE_A64_CRYPTO_ONLY',
+                         'MBEDTLS_SHA256_USE_X86_SHANI_IF_PRESENT'],
+    'MBEDTLS_SHA1_C': ['MBEDTLS_SHA1_USE_X86_SHANI_IF_PRESENT'],
     'MBEDTLS_X509_RSASSA_PSS_SUPPORT': []
 }
 
@@ -98,6 +98,21 @@ static mutex_functions_t mutex_functions;
  */
 static int live_mutexes;
 
+/** Protects #live_mutexes, so that test code can create and free mutexes
+ * from several threads. This mutex is managed with the underlying functions
+ * directly, so it is not itself subject to usage verification.
+ */
+static mbedtls_threading_mutex_t live_mutexes_mutex;
+
+static void mbedtls_test_add_live_mutexes( int delta )
+{
+    if( mutex_functions.lock( &live_mutexes_mutex ) == 0 )
+    {
+        live_mutexes += delta;
+        mutex_functions.unlock( &live_mutexes_mutex );
+    }
+}
+
 static void mbedtls_test_mutex_usage_error( mbedtls_threading_mutex_t *mutex,
                                             const char *msg )
 {
@@ -115,7 +130,7 @@ static void mbedtls_test_wrap_mutex_init( mbedtls_threading_mutex_t *mutex )
 {
     mutex_functions.init( mutex );
     if( mutex->is_valid )
-        ++live_mutexes;
+        mbedtls_test_add_live_mutexes( 1 );
 }
 
 static void mbedtls_test_wrap_mutex_free( mbedtls_threading_mutex_t *mutex )
@@ -137,7 +152,7 @@ static void mbedtls_test_wrap_mutex_free( mbedtls_threading_mutex_t *mutex )
             break;
     }
     if( mutex->is_valid )
-        --live_mutexes;
+        mbedtls_test_add_live_mutexes( -1 );
     mutex_functions.free( mutex );
 }
 
@@ -165,7 +180,9 @@ static int mbedtls_test_wrap_mutex_lock( mbedtls_threading_mutex_t *mutex )
 
 static int mbedtls_test_wrap_mutex_unlock( mbedtls_threading_mutex_t *mutex )
 {
-    int ret = mutex_functions.unlock( mutex );
+    int ret;
+    /* Update the state before releasing the mutex: once it is released,
+     * another thread may lock it and change the state. */
     switch( mutex->is_valid )
     {
         case MUTEX_FREED:
@@ -175,14 +192,16 @@ static int mbedtls_test_wrap_mutex_unlock( mbedtls_threading_mutex_t *mutex )
             mbedtls_test_mutex_usage_error( mutex, "unlock without lock" );
             break;
         case MUTEX_LOCKED:
-            if( ret == 0 )
-                mutex->is_valid = MUTEX_IDLE;
-            break;
+            mutex->is_valid = MUTEX_IDLE;
+            ret = mutex_functions.unlock( mutex );
+            if( ret != 0 )
+                mutex->is_valid = MUTEX_LOCKED;
+            return( ret );
         default:
             mbedtls_test_mutex_usage_error( mutex, "corrupted state" );
             break;
     }
-    return( ret );
+    return( mutex_functions.unlock( mutex ) );
 }
 
 void mbedtls_test_mutex_usage_init( void )
@@ -191,6 +210,7 @@ void mbedtls_test_mutex_usage_init( void )
     mutex_functions.free = mbedtls_mutex_free;
     mutex_functions.lock = mbedtls_mutex_lock;
     mutex_functions.unlock = mbedtls_mutex_unlock;
+    mutex_functions.init( &live_mutexes_mutex );
     mbedtls_mutex_init = &mbedtls_test_wrap_mutex_init;
     mbedtls_mutex_free = &mbedtls_test_wrap_mutex_free;
     mbedtls_mutex_lock = &mbedtls_test_wrap_mutex_lock;
@@ -199,6 +219,7 @@ void mbedtls_test_mutex_usage_init( void )
 
 void mbedtls_test_mutex_usage_check( void )
 {
+    /* Called between test cases, when no other thread is running. */
     if( live_mutexes != 0 )
     {
         /* A positive number (more init than free) means that a mutex resource
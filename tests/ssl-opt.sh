@@ -8822,6 +8822,53 @@ run_test    "SSL async private: renegotiation: server-initiated, decrypt" \
             -s "Async decrypt callback: using key slot " \
             -s "Async resume (slot [0-9]): decrypt done, status=0"
 
+# Tests of the built-in asynchronous private key engine
+
+requires_config_enabled MBEDTLS_SSL_ASYNC_ENGINE_C
+requires_config_enabled MBEDTLS_SSL_PROTO_TLS1_2
+run_test    "SSL async engine: sign RSA" \
+            "$P_SRV debug_level=2 async_engine=2 \
+             crt_file=data_files/server2.crt key_file=data_files/server2.key" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-RSA-WITH-AES-128-CBC-SHA256" \
+            0 \
+            -s "ssl_resume_server_key_exchange() returned 0" \
+            -s "Successful connection"
+
+requires_config_enabled MBEDTLS_SSL_ASYNC_ENGINE_C
+requires_config_enabled MBEDTLS_SSL_PROTO_TLS1_2
+requires_config_enabled MBEDTLS_ECDSA_C
+run_test    "SSL async engine: sign ECDSA" \
+            "$P_SRV debug_level=2 async_engine=2 \
+             crt_file=data_files/server5.crt key_file=data_files/server5.key" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-CBC-SHA256" \
+            0 \
+            -s "ssl_resume_server_key_exchange() returned 0" \
+            -s "Successful connection"
+
+requires_config_enabled MBEDTLS_SSL_ASYNC_ENGINE_C
+requires_config_enabled MBEDTLS_SSL_PROTO_TLS1_2
+run_test    "SSL async engine: decrypt" \
+            "$P_SRV debug_level=2 async_engine=1 \
+             crt_file=data_files/server2.crt key_file=data_files/server2.key" \
+            "$P_CLI force_ciphersuite=TLS-RSA-WITH-AES-128-CBC-SHA" \
+            0 \
+            -s "ssl_decrypt_encrypted_pms() returned 0" \
+            -s "Successful connection"
+
+requires_config_enabled MBEDTLS_SSL_ASYNC_ENGINE_C
+requires_config_enabled MBEDTLS_SSL_RENEGOTIATION
+requires_config_enabled MBEDTLS_SSL_PROTO_TLS1_2
+run_test    "SSL async engine: renegotiation, sign" \
+            "$P_SRV debug_level=2 async_engine=2 \
+             crt_file=data_files/server2.crt key_file=data_files/server2.key \
+             exchanges=2 renegotiation=1" \
+            "$P_CLI exchanges=2 renegotiation=1 renegotiate=1 \
+             force_ciphersuite=TLS-ECDHE-RSA-WITH-AES-128-CBC-SHA256" \
+            0 \
+            -s "ssl_resume_server_key_exchange() returned 0" \
+            -s "=> renegotiate" \
+            -s "Successful connection"
+
 # Tests for ECC extensions (rfc 4492)
 
 requires_config_enabled MBEDTLS_AES_C